@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Benchmark_Harness.cpp
+//! \author Alex Robinson
+//! \brief  Benchmark harness definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <ctime>
+
+// System Includes
+#include <sys/resource.h>
+
+// Boost Includes
+#include <boost/property_tree/json_parser.hpp>
+
+// FRENSIE Includes
+#include "FRENSIE_config.hpp"
+#include "Benchmark_Harness.hpp"
+#include "MonteCarlo_TransportInstrumentation.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Benchmark{
+
+// Constructor
+BenchmarkResults::BenchmarkResults( const std::string& suite_name )
+  : d_suite_name( suite_name ),
+    d_results(),
+    d_skipped_benchmarks(),
+    d_number_of_results( 0 )
+{ /* ... */ }
+
+// Add a benchmark result
+void BenchmarkResults::addResult( const std::string& benchmark_name,
+                                  const unsigned threads,
+                                  const Metrics& metrics )
+{
+  Utility::PropertyTree result;
+
+  result.put( "name", benchmark_name );
+  result.put( "threads", threads );
+
+  for( auto&& metric : metrics )
+    result.put( metric.first, metric.second );
+
+  d_results.push_back( std::make_pair( "", result ) );
+
+  ++d_number_of_results;
+}
+
+// Add a skipped benchmark
+/*! \details Benchmarks are generally skipped because the data that they
+ * require is not present in the database that was provided.
+ */
+void BenchmarkResults::addSkippedBenchmark( const std::string& benchmark_name,
+                                            const std::string& reason )
+{
+  Utility::PropertyTree skipped_benchmark;
+
+  skipped_benchmark.put( "name", benchmark_name );
+  skipped_benchmark.put( "reason", reason );
+
+  d_skipped_benchmarks.push_back( std::make_pair( "", skipped_benchmark ) );
+}
+
+// Return the number of results
+size_t BenchmarkResults::getNumberOfResults() const
+{
+  return d_number_of_results;
+}
+
+// Export the results to a JSON file
+void BenchmarkResults::exportToJSON(
+                       const boost::filesystem::path& json_file_name ) const
+{
+  Utility::PropertyTree json_ptree;
+
+  json_ptree.put( "suite", d_suite_name );
+
+  {
+    std::time_t current_time = std::time( nullptr );
+
+    std::ostringstream oss;
+    oss << std::put_time( std::gmtime( &current_time ), "%Y-%m-%dT%H:%M:%SZ" );
+
+    json_ptree.put( "date", oss.str() );
+  }
+
+  json_ptree.put( "openmp", Utility::OpenMPProperties::isOpenMPUsed() );
+  json_ptree.put( "dbc", (bool)HAVE_FRENSIE_DBC );
+  json_ptree.put( "transport_instrumentation",
+                  MonteCarlo::TransportInstrumentation::isEnabled() );
+
+  // Empty arrays cannot be written by the boost json parser
+  if( !d_results.empty() )
+    json_ptree.put_child( "results", d_results );
+
+  if( !d_skipped_benchmarks.empty() )
+    json_ptree.put_child( "skipped", d_skipped_benchmarks );
+
+  std::ofstream json_file( json_file_name.string() );
+
+  TEST_FOR_EXCEPTION( !json_file.good(),
+                      std::runtime_error,
+                      "The benchmark results file " << json_file_name <<
+                      " could not be opened!" );
+
+  boost::property_tree::write_json( json_file, json_ptree );
+}
+
+// Print the results
+void BenchmarkResults::printResults( std::ostream& os ) const
+{
+  os << d_suite_name << " benchmark results:\n";
+
+  for( auto&& result : d_results )
+  {
+    os << "  " << std::left << std::setw( 36 )
+       << result.second.get<std::string>( "name" )
+       << " threads=" << std::setw( 3 )
+       << result.second.get<std::string>( "threads" );
+
+    for( auto&& metric : result.second )
+    {
+      if( metric.first != "name" && metric.first != "threads" )
+      {
+        os << " " << metric.first << "="
+           << metric.second.get_value<std::string>();
+      }
+    }
+
+    os << "\n";
+  }
+
+  for( auto&& skipped_benchmark : d_skipped_benchmarks )
+  {
+    os << "  " << std::left << std::setw( 36 )
+       << skipped_benchmark.second.get<std::string>( "name" )
+       << " skipped: "
+       << skipped_benchmark.second.get<std::string>( "reason" ) << "\n";
+  }
+
+  os << std::flush;
+}
+
+// Return the thread counts that will be benchmarked (1, 2, 4, ..., max)
+std::vector<unsigned> getThreadCounts( const unsigned max_threads )
+{
+  TEST_FOR_EXCEPTION( max_threads == 0,
+                      std::runtime_error,
+                      "At least one thread must be benchmarked!" );
+
+  std::vector<unsigned> thread_counts;
+
+  for( unsigned threads = 1; threads < max_threads; threads *= 2 )
+    thread_counts.push_back( threads );
+
+  thread_counts.push_back( max_threads );
+
+  return thread_counts;
+}
+
+// Return the peak resident set size of the process (MB)
+/*! \details The peak resident set size can only increase. When several
+ * benchmarks are run by the same process the value reported for a benchmark
+ * is the largest value observed up to the end of that benchmark.
+ */
+double getPeakMemoryUsage()
+{
+  struct rusage usage;
+
+  if( getrusage( RUSAGE_SELF, &usage ) != 0 )
+    return 0.0;
+
+  // Linux reports the max resident set size in kB (macOS reports bytes)
+#ifdef __APPLE__
+  return usage.ru_maxrss/(1024.0*1024.0);
+#else
+  return usage.ru_maxrss/1024.0;
+#endif
+}
+
+} // end Benchmark namespace
+
+//---------------------------------------------------------------------------//
+// end Benchmark_Harness.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Benchmark_Harness.hpp
+//! \author Alex Robinson
+//! \brief  Benchmark harness declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef BENCHMARK_HARNESS_HPP
+#define BENCHMARK_HARNESS_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <iostream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_PropertyTree.hpp"
+
+namespace Benchmark{
+
+//! The benchmark metrics (metric name, metric value)
+typedef std::map<std::string,double> Metrics;
+
+/*! The benchmark results class
+ * \details The results of every benchmark run in a suite are collected and
+ * exported as a JSON file so that they can be compared against the results
+ * of a previous build (see compare_benchmarks.py).
+ */
+class BenchmarkResults
+{
+
+public:
+
+  //! Constructor
+  BenchmarkResults( const std::string& suite_name );
+
+  //! Destructor
+  ~BenchmarkResults()
+  { /* ... */ }
+
+  //! Add a benchmark result
+  void addResult( const std::string& benchmark_name,
+                  const unsigned threads,
+                  const Metrics& metrics );
+
+  //! Add a skipped benchmark
+  void addSkippedBenchmark( const std::string& benchmark_name,
+                            const std::string& reason );
+
+  //! Return the number of results
+  size_t getNumberOfResults() const;
+
+  //! Export the results to a JSON file
+  void exportToJSON( const boost::filesystem::path& json_file_name ) const;
+
+  //! Print the results
+  void printResults( std::ostream& os ) const;
+
+private:
+
+  // The suite name
+  std::string d_suite_name;
+
+  // The benchmark results
+  Utility::PropertyTree d_results;
+
+  // The skipped benchmarks
+  Utility::PropertyTree d_skipped_benchmarks;
+
+  // The number of results
+  size_t d_number_of_results;
+};
+
+//! Return the thread counts that will be benchmarked (1, 2, 4, ..., max)
+std::vector<unsigned> getThreadCounts( const unsigned max_threads );
+
+//! Return the peak resident set size of the process (MB)
+double getPeakMemoryUsage();
+
+//! Return the wall time required to execute a callable (s)
+template<typename Callable>
+inline double timeExecution( const Callable& callable )
+{
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  callable();
+
+  std::chrono::duration<double> elapsed_time =
+    std::chrono::steady_clock::now() - start_time;
+
+  return elapsed_time.count();
+}
+
+} // end Benchmark namespace
+
+#endif // end BENCHMARK_HARNESS_HPP
+
+//---------------------------------------------------------------------------//
+// end Benchmark_Harness.hpp
+//---------------------------------------------------------------------------//
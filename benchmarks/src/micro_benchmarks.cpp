@@ -0,0 +1,365 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   micro_benchmarks.cpp
+//! \author Alex Robinson
+//! \brief  Transport kernel micro-benchmarks
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <cmath>
+
+// Boost Includes
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+// FRENSIE Includes
+#include "Benchmark_Harness.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+namespace Details{
+
+//! The micro-benchmark kernel (thread id, operations) -> checksum
+typedef std::function<double(unsigned,uint64_t)> Kernel;
+
+//! Create a log spaced grid
+std::vector<double> createLogGrid( const double min_value,
+                                   const double max_value,
+                                   const size_t points )
+{
+  std::vector<double> grid( points );
+
+  const double log_spacing = std::log( max_value/min_value )/(points - 1);
+
+  for( size_t i = 0; i < points; ++i )
+    grid[i] = min_value*std::exp( i*log_spacing );
+
+  grid.back() = max_value;
+
+  return grid;
+}
+
+//! Run a kernel with the desired number of threads
+/*! \details Every thread will execute the requested number of operations.
+ * The reported time per operation is the time required by a single thread
+ * (the operation rate is the aggregate rate of all threads).
+ */
+Benchmark::Metrics runKernel( const Kernel& kernel,
+                              const unsigned threads,
+                              const uint64_t operations_per_thread )
+{
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  std::vector<double> checksums( threads, 0.0 );
+
+  const double wall_time = Benchmark::timeExecution( [&](){
+      Utility::OpenMPProperties::parallelFor( threads, [&](const size_t i){
+          Utility::RandomNumberGenerator::initialize( i );
+
+          checksums[i] = kernel( Utility::OpenMPProperties::getThreadId(),
+                                 operations_per_thread );
+        } );
+    } );
+
+  double checksum = 0.0;
+
+  for( auto&& thread_checksum : checksums )
+    checksum += thread_checksum;
+
+  Benchmark::Metrics metrics;
+  metrics["wall_time_s"] = wall_time;
+  metrics["operations_per_second"] =
+    threads*operations_per_thread/wall_time;
+  metrics["ns_per_operation"] = wall_time/operations_per_thread*1e9;
+  metrics["peak_memory_mb"] = Benchmark::getPeakMemoryUsage();
+  metrics["checksum"] = checksum;
+
+  return metrics;
+}
+
+} // end Details namespace
+
+int main( int argc, char** argv )
+{
+  Utility::GlobalMPISession mpi_session( argc, argv );
+
+  boost::program_options::variables_map command_line_arguments;
+
+  {
+    // Create the command line options
+    boost::program_options::options_description command_line_options;
+    command_line_options.add_options()
+      ("help,h", "produce help message")
+      ("max_threads",
+       boost::program_options::value<unsigned>()->default_value(1),
+       "specify the max number of threads to benchmark (1, 2, 4, ..., max)")
+      ("operations",
+       boost::program_options::value<uint64_t>()->default_value(1000000),
+       "specify the number of operations that each thread will execute")
+      ("output",
+       boost::program_options::value<std::string>()->default_value("micro_benchmarks.json"),
+       "specify the name of the JSON results file");
+
+    boost::program_options::store(
+         boost::program_options::command_line_parser(argc, argv).options(command_line_options).run(),
+         command_line_arguments );
+
+    boost::program_options::notify( command_line_arguments );
+
+    if( command_line_arguments.count( "help" ) )
+    {
+      std::cout << command_line_options << std::endl;
+
+      return 0;
+    }
+  }
+
+  const std::vector<unsigned> thread_counts = Benchmark::getThreadCounts(
+                        command_line_arguments["max_threads"].as<unsigned>() );
+
+  const uint64_t operations =
+    command_line_arguments["operations"].as<uint64_t>();
+
+  const unsigned max_threads = thread_counts.back();
+
+  // The energy grid (similar in size to a unionized photon energy grid)
+  std::shared_ptr<const std::vector<double> > energy_grid(
+      new std::vector<double>( Details::createLogGrid( 1e-11, 20.0, 100000 ) ) );
+
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+    hash_grid_searcher(
+           new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                                        energy_grid, 1000 ) );
+
+  // The tabular distribution
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+    tabular_distribution;
+
+  {
+    std::vector<double> independent_values =
+      Details::createLogGrid( 1e-3, 20.0, 1000 );
+
+    std::vector<double> dependent_values( independent_values.size() );
+
+    for( size_t i = 0; i < independent_values.size(); ++i )
+      dependent_values[i] = std::exp( -independent_values[i] );
+
+    tabular_distribution.reset(
+                   new Utility::TabularDistribution<Utility::LinLin>(
+                                                          independent_values,
+                                                          dependent_values ) );
+  }
+
+  // The bivariate distribution
+  std::shared_ptr<const Utility::BasicBivariateDistribution>
+    bivariate_distribution;
+
+  {
+    std::vector<double> primary_grid = Details::createLogGrid( 1e-3, 20.0, 100 );
+
+    std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+      secondary_dists( primary_grid.size() );
+
+    for( size_t i = 0; i < primary_grid.size(); ++i )
+    {
+      std::vector<double> secondary_grid =
+        Details::createLogGrid( 1e-3, primary_grid[i]+1e-3, 100 );
+
+      std::vector<double> secondary_values( secondary_grid.size() );
+
+      for( size_t j = 0; j < secondary_grid.size(); ++j )
+        secondary_values[j] = 1.0/secondary_grid[j];
+
+      secondary_dists[i].reset(
+                     new Utility::TabularDistribution<Utility::LinLin>(
+                                                          secondary_grid,
+                                                          secondary_values ) );
+    }
+
+    bivariate_distribution.reset(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<Utility::UnitBaseCorrelated<Utility::LinLinLin> >(
+                                                             primary_grid,
+                                                             secondary_dists,
+                                                             1e-3,
+                                                             1e-7 ) );
+  }
+
+  // The estimator
+  std::shared_ptr<MonteCarlo::Estimator> estimator;
+
+  {
+    std::vector<MonteCarlo::StandardCellEstimator::CellIdType> cell_ids( 1, 1 );
+    std::vector<double> cell_volumes( 1, 1.0 );
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+      cell_estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                                0,
+                                                                1.0,
+                                                                cell_ids,
+                                                                cell_volumes ) );
+
+    cell_estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                           Details::createLogGrid( 1e-11, 20.0, 100 ) );
+    cell_estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::NEUTRON ) );
+    cell_estimator->enableThreadSupport( max_threads );
+
+    estimator = cell_estimator;
+  }
+
+  // The micro-benchmark kernels
+  std::vector<std::pair<std::string,Details::Kernel> > kernels;
+
+  kernels.push_back( std::make_pair( std::string( "grid_search_binary" ),
+    [&]( unsigned, uint64_t operations ){
+      double checksum = 0.0;
+
+      for( uint64_t i = 0; i < operations; ++i )
+      {
+        const double energy = 1e-11*std::pow( 2e12, Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+        checksum += Utility::Search::binaryLowerBoundIndex(
+                             energy_grid->begin(), energy_grid->end(), energy );
+      }
+
+      return checksum;
+    } ) );
+
+  kernels.push_back( std::make_pair( std::string( "grid_search_hash" ),
+    [&]( unsigned, uint64_t operations ){
+      double checksum = 0.0;
+
+      for( uint64_t i = 0; i < operations; ++i )
+      {
+        const double energy = 1e-11*std::pow( 2e12, Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+        checksum += hash_grid_searcher->findLowerBinIndex( energy );
+      }
+
+      return checksum;
+    } ) );
+
+  kernels.push_back( std::make_pair( std::string( "tabular_sampling" ),
+    [&]( unsigned, uint64_t operations ){
+      double checksum = 0.0;
+
+      for( uint64_t i = 0; i < operations; ++i )
+        checksum += tabular_distribution->sample();
+
+      return checksum;
+    } ) );
+
+  kernels.push_back( std::make_pair( std::string( "bivariate_sampling" ),
+    [&]( unsigned, uint64_t operations ){
+      double checksum = 0.0;
+
+      for( uint64_t i = 0; i < operations; ++i )
+      {
+        const double primary_value = 1e-3*std::pow( 2e4, Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+        checksum +=
+          bivariate_distribution->sampleSecondaryConditional( primary_value );
+      }
+
+      return checksum;
+    } ) );
+
+  kernels.push_back( std::make_pair( std::string( "estimator_commit" ),
+    [&]( unsigned thread_id, uint64_t operations ){
+      MonteCarlo::NeutronState neutron( 0 );
+      neutron.setWeight( 1.0 );
+
+      MonteCarlo::ParticleCollidingInCellEventObserver& observer =
+        dynamic_cast<MonteCarlo::ParticleCollidingInCellEventObserver&>( *estimator );
+
+      for( uint64_t i = 0; i < operations; ++i )
+      {
+        neutron.setEnergy( 1e-11*std::pow( 2e12, Utility::RandomNumberGenerator::getRandomNumber<double>() ) );
+
+        observer.updateFromParticleCollidingInCellEvent( neutron, 1, 1.0 );
+
+        estimator->commitHistoryContribution();
+      }
+
+      return (double)thread_id;
+    } ) );
+
+  kernels.push_back( std::make_pair( std::string( "bank_push_pop" ),
+    [&]( unsigned, uint64_t operations ){
+      MonteCarlo::ParticleBank bank;
+
+      MonteCarlo::NeutronState neutron( 0 );
+      neutron.setEnergy( 1.0 );
+
+      double checksum = 0.0;
+
+      // Simulate the bank usage pattern of a short shower
+      const uint64_t batch_size = 16;
+
+      for( uint64_t i = 0; i < operations; i += batch_size )
+      {
+        for( uint64_t j = 0; j < batch_size; ++j )
+        {
+          neutron.setWeight( (double)j );
+
+          bank.push( neutron );
+        }
+
+        while( !bank.isEmpty() )
+        {
+          checksum += bank.top().getWeight();
+
+          bank.pop();
+        }
+      }
+
+      return checksum;
+    } ) );
+
+  Benchmark::BenchmarkResults results( "micro" );
+
+  try{
+    for( auto&& kernel : kernels )
+    {
+      for( auto&& threads : thread_counts )
+      {
+        std::cout << "Running " << kernel.first << " with " << threads
+                  << " thread(s)... " << std::flush;
+
+        Benchmark::Metrics metrics =
+          Details::runKernel( kernel.second, threads, operations );
+
+        std::cout << metrics["ns_per_operation"] << " ns/op" << std::endl;
+
+        results.addResult( kernel.first, threads, metrics );
+      }
+    }
+  }
+  EXCEPTION_CATCH_AND_EXIT( std::exception,
+                            "Unable to complete the micro-benchmarks!" );
+
+  results.printResults( std::cout );
+
+  results.exportToJSON( command_line_arguments["output"].as<std::string>() );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end micro_benchmarks.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,600 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   transport_benchmarks.cpp
+//! \author Alex Robinson
+//! \brief  Canonical transport benchmarks
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+// FRENSIE Includes
+#include "Benchmark_Harness.hpp"
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_StandardCollisionForcer.hpp"
+#include "MonteCarlo_TransportInstrumentation.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_JustInTimeInitializer.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+namespace Details{
+
+//! The canonical transport problem
+struct TransportProblem
+{
+  //! The problem name
+  std::string name;
+
+  //! The particle mode
+  MonteCarlo::ParticleModeType mode;
+
+  //! The source particle type
+  MonteCarlo::ParticleType source_particle_type;
+
+  //! The source energy (MeV)
+  double source_energy;
+
+  //! The material mass density (g/cm^3)
+  double mass_density;
+
+  //! The material component zaids
+  std::vector<unsigned> zaids;
+
+  //! The material component atom fractions
+  std::vector<double> atom_fractions;
+
+  //! The number of mesh elements per dimension (0 for no mesh tally)
+  unsigned mesh_elements_per_dimension;
+
+  //! The radius of the material sphere (cm) (0 for an infinite medium)
+  double sphere_radius;
+
+  //! Force collisions of source particles in the material sphere
+  bool force_collisions;
+};
+
+//! Return the canonical transport problems
+std::vector<TransportProblem> getTransportProblems()
+{
+  std::vector<TransportProblem> problems;
+
+  problems.push_back( {"neutron_water", MonteCarlo::NEUTRON_MODE,
+                       MonteCarlo::NEUTRON, 2.0, 1.0,
+                       {1001, 8016}, {2.0, 1.0}, 0, 0.0, false} );
+
+  problems.push_back( {"neutron_steel", MonteCarlo::NEUTRON_MODE,
+                       MonteCarlo::NEUTRON, 2.0, 8.0,
+                       {26056, 24052, 28058}, {0.72, 0.19, 0.09}, 0, 0.0, false} );
+
+  problems.push_back( {"photon_lead", MonteCarlo::PHOTON_MODE,
+                       MonteCarlo::PHOTON, 1.0, 11.35,
+                       {82000}, {1.0}, 0, 0.0, false} );
+
+  problems.push_back( {"electron_aluminum", MonteCarlo::ELECTRON_MODE,
+                       MonteCarlo::ELECTRON, 1.0, 2.699,
+                       {13000}, {1.0}, 0, 0.0, false} );
+
+  problems.push_back( {"photon_electron_shower_lead",
+                       MonteCarlo::PHOTON_ELECTRON_MODE,
+                       MonteCarlo::PHOTON, 20.0, 11.35,
+                       {82000}, {1.0}, 0, 0.0, false} );
+
+  problems.push_back( {"photon_water_mesh_tally", MonteCarlo::PHOTON_MODE,
+                       MonteCarlo::PHOTON, 1.0, 1.0,
+                       {1000, 8000}, {2.0, 1.0}, 64, 0.0, false} );
+
+  // An optically thin lead sphere in a void - the forced collision problem
+  // should have a much larger scattered flux figure of merit
+  problems.push_back( {"photon_lead_sphere_analog", MonteCarlo::PHOTON_MODE,
+                       MonteCarlo::PHOTON, 1.0, 11.35,
+                       {82000}, {1.0}, 0, 0.1, false} );
+
+  problems.push_back( {"photon_lead_sphere_forced", MonteCarlo::PHOTON_MODE,
+                       MonteCarlo::PHOTON, 1.0, 11.35,
+                       {82000}, {1.0}, 0, 0.1, true} );
+
+  return problems;
+}
+
+//! Check if a particle type is transported in a particle mode
+bool isParticleTypeTransported( const MonteCarlo::ParticleModeType mode,
+                                const MonteCarlo::ParticleType type )
+{
+  switch( mode )
+  {
+  case MonteCarlo::NEUTRON_MODE:
+    return type == MonteCarlo::NEUTRON;
+  case MonteCarlo::PHOTON_MODE:
+    return type == MonteCarlo::PHOTON;
+  case MonteCarlo::ELECTRON_MODE:
+    return type == MonteCarlo::ELECTRON;
+  case MonteCarlo::NEUTRON_PHOTON_MODE:
+    return type == MonteCarlo::NEUTRON || type == MonteCarlo::PHOTON;
+  case MonteCarlo::PHOTON_ELECTRON_MODE:
+    return type == MonteCarlo::PHOTON || type == MonteCarlo::ELECTRON ||
+      type == MonteCarlo::POSITRON;
+  case MonteCarlo::NEUTRON_PHOTON_ELECTRON_MODE:
+    return type == MonteCarlo::NEUTRON || type == MonteCarlo::PHOTON ||
+      type == MonteCarlo::ELECTRON || type == MonteCarlo::POSITRON;
+  default:
+    return false;
+  }
+}
+
+//! Create the filled infinite medium model for a problem
+/*! \details An exception will be thrown if the database does not contain
+ * the data required by the problem.
+ */
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> createFilledModel(
+          const TransportProblem& problem,
+          const boost::filesystem::path& database_path,
+          const Data::ScatteringCenterPropertiesDatabase& database,
+          const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+{
+  std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+    scattering_center_definitions(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  std::vector<std::string> component_names;
+
+  for( auto&& zaid : problem.zaids )
+  {
+    const std::string name = Data::ZAID( zaid ).toName();
+
+    MonteCarlo::ScatteringCenterDefinition& definition =
+      scattering_center_definitions->createDefinition( name, zaid );
+
+    if( isParticleTypeTransported( problem.mode, MonteCarlo::NEUTRON ) )
+    {
+      const Data::NuclideProperties& nuclide_properties =
+        database.getNuclideProperties( zaid );
+
+      definition.setNuclearDataProperties(
+          nuclide_properties.getSharedNuclearDataProperties(
+              Data::NuclearDataProperties::ACE_FILE,
+              nuclide_properties.getRecommendedDataFileVersion(
+                                      Data::NuclearDataProperties::ACE_FILE ),
+              2.53010E-08*MeV,
+              false ) );
+    }
+
+    if( isParticleTypeTransported( problem.mode, MonteCarlo::PHOTON ) )
+    {
+      const Data::AtomProperties& atom_properties =
+        database.getAtomProperties( Data::ZAID( zaid ) );
+
+      definition.setPhotoatomicDataProperties(
+          atom_properties.getSharedPhotoatomicDataProperties(
+              Data::PhotoatomicDataProperties::Native_EPR_FILE,
+              atom_properties.getRecommendedDataFileVersion(
+                         Data::PhotoatomicDataProperties::Native_EPR_FILE ) ) );
+    }
+
+    if( isParticleTypeTransported( problem.mode, MonteCarlo::ELECTRON ) )
+    {
+      const Data::AtomProperties& atom_properties =
+        database.getAtomProperties( Data::ZAID( zaid ) );
+
+      definition.setElectroatomicDataProperties(
+          atom_properties.getSharedElectroatomicDataProperties(
+              Data::ElectroatomicDataProperties::Native_EPR_FILE,
+              atom_properties.getRecommendedDataFileVersion(
+                       Data::ElectroatomicDataProperties::Native_EPR_FILE ) ) );
+    }
+
+    component_names.push_back( name );
+  }
+
+  std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+    material_definitions( new MonteCarlo::MaterialDefinitionDatabase );
+
+  material_definitions->addDefinition( problem.name, 1,
+                                       component_names,
+                                       problem.atom_fractions );
+
+  std::shared_ptr<const Geometry::Model> unfilled_model;
+
+  if( problem.sphere_radius > 0.0 )
+  {
+    // Material sphere (cell 1) inside of a void sphere (cell 2)
+    std::vector<Geometry::QuadricSurface> surfaces;
+    surfaces.push_back( Geometry::QuadricSurface::createSphere(
+                             1, 0.0, 0.0, 0.0, problem.sphere_radius ) );
+    surfaces.push_back( Geometry::QuadricSurface::createSphere(
+                             2, 0.0, 0.0, 0.0, 10*problem.sphere_radius ) );
+
+    std::vector<Geometry::NativeCell> cells;
+    cells.push_back( Geometry::NativeCell(
+                     1, "-1", 1, -problem.mass_density/cubic_centimeter ) );
+    cells.push_back( Geometry::NativeCell( 2, "1 -2" ) );
+    cells.push_back( Geometry::NativeCell( 3, "2" ) );
+    cells.back().setTermination();
+
+    unfilled_model.reset( new Geometry::NativeModel( surfaces, cells ) );
+  }
+  else
+  {
+    unfilled_model.reset( new Geometry::InfiniteMediumModel(
+                           1, 1, -problem.mass_density/cubic_centimeter ) );
+  }
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                  new MonteCarlo::FilledGeometryModel( database_path,
+                                                       scattering_center_definitions,
+                                                       material_definitions,
+                                                       properties,
+                                                       unfilled_model,
+                                                       false ) );
+
+  // Load the data now so that it is not included in the transport timing
+  Utility::JustInTimeInitializer::getInstance().initializeObjectsAndClear();
+
+  return model;
+}
+
+//! Create the source for a problem
+std::shared_ptr<MonteCarlo::ParticleSource> createSource(
+         const TransportProblem& problem,
+         const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model )
+{
+  std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+    particle_distribution( new MonteCarlo::StandardParticleDistribution(
+                                                         problem.name ) );
+
+  particle_distribution->setEnergy( problem.source_energy );
+  particle_distribution->constructDimensionDistributionDependencyTree();
+
+  const std::shared_ptr<const Geometry::Model> unfilled_model = *model;
+
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent> source_component;
+
+  switch( problem.source_particle_type )
+  {
+  case MonteCarlo::NEUTRON:
+    source_component.reset( new MonteCarlo::StandardNeutronSourceComponent(
+                           0, 1.0, unfilled_model, particle_distribution ) );
+    break;
+  case MonteCarlo::PHOTON:
+    source_component.reset( new MonteCarlo::StandardPhotonSourceComponent(
+                           0, 1.0, unfilled_model, particle_distribution ) );
+    break;
+  case MonteCarlo::ELECTRON:
+    source_component.reset( new MonteCarlo::StandardElectronSourceComponent(
+                           0, 1.0, unfilled_model, particle_distribution ) );
+    break;
+  default:
+    THROW_EXCEPTION( std::runtime_error,
+                     "Source particle type "
+                     << problem.source_particle_type <<
+                     " is not supported by the benchmarks!" );
+  }
+
+  return std::shared_ptr<MonteCarlo::ParticleSource>(
+                new MonteCarlo::StandardParticleSource( {source_component} ) );
+}
+
+//! Create the event handler for a problem
+std::shared_ptr<MonteCarlo::EventHandler> createEventHandler(
+         const TransportProblem& problem,
+         const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+         const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+{
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                         new MonteCarlo::EventHandler( model, *properties ) );
+
+  if( problem.mesh_elements_per_dimension > 0 )
+  {
+    // The mesh covers +/- 32 cm around the point source
+    std::vector<double> planes( problem.mesh_elements_per_dimension+1 );
+
+    for( size_t i = 0; i < planes.size(); ++i )
+    {
+      planes[i] = -32.0 + 64.0*i/problem.mesh_elements_per_dimension;
+    }
+
+    std::shared_ptr<const Utility::Mesh> mesh(
+                    new Utility::StructuredHexMesh( planes, planes, planes ) );
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+      estimator( new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                               0, 1.0, mesh ) );
+
+    std::vector<double> energy_bins( 11 );
+
+    for( size_t i = 0; i < energy_bins.size(); ++i )
+      energy_bins[i] = 1e-3 + i*(problem.source_energy - 1e-3)/10;
+
+    estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                                energy_bins );
+    estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>(
+                                        1, problem.source_particle_type ) );
+
+    event_handler->addEstimator( estimator );
+  }
+
+  if( problem.sphere_radius > 0.0 )
+  {
+    // Tally the scattered (first bin) and uncollided (second bin) flux in
+    // the material sphere
+    const double sphere_volume = 4.0/3.0*Utility::PhysicalConstants::pi*
+      problem.sphere_radius*problem.sphere_radius*problem.sphere_radius;
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+      estimator( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                   1, 1.0,
+                                   std::vector<Geometry::Model::EntityId>( {1} ),
+                                   std::vector<double>( 1, sphere_volume ) ) );
+
+    std::vector<double> energy_bins( {1e-3,
+                                      0.99*problem.source_energy,
+                                      problem.source_energy} );
+
+    estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                                energy_bins );
+    estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>(
+                                        1, problem.source_particle_type ) );
+
+    event_handler->addEstimator( estimator );
+  }
+
+  return event_handler;
+}
+
+//! Create the collision forcer for a problem
+std::shared_ptr<const MonteCarlo::CollisionForcer> createCollisionForcer(
+         const TransportProblem& problem,
+         const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model )
+{
+  if( problem.force_collisions )
+  {
+    std::shared_ptr<MonteCarlo::StandardCollisionForcer>
+      collision_forcer( new MonteCarlo::StandardCollisionForcer );
+
+    // A collided particle will always be generated
+    collision_forcer->setForcedCollisionCells(
+                    *model,
+                    problem.source_particle_type,
+                    std::vector<MonteCarlo::CollisionForcer::CellIdType>( 1, 1 ),
+                    1.0 );
+
+    return collision_forcer;
+  }
+  else
+    return MonteCarlo::CollisionForcer::getDefault();
+}
+
+//! Run a transport problem with the desired number of threads
+Benchmark::Metrics runProblem(
+         const TransportProblem& problem,
+         const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+         const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties,
+         const unsigned threads )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    MonteCarlo::ParticleSimulationManagerFactory factory(
+                                 model,
+                                 createSource( problem, model ),
+                                 createEventHandler( problem, model, properties ),
+                                 properties,
+                                 problem.name + "_benchmark",
+                                 "bin",
+                                 threads );
+
+    factory.setCollisionForcer( createCollisionForcer( problem, model ) );
+
+    manager = factory.getManager();
+  }
+
+  const double wall_time =
+    Benchmark::timeExecution( [&manager](){ manager->runSimulation(); } );
+
+  const uint64_t histories = manager->getNextHistory();
+
+  Benchmark::Metrics metrics;
+  metrics["wall_time_s"] = wall_time;
+  metrics["histories"] = histories;
+  metrics["histories_per_second"] = histories/wall_time;
+  metrics["peak_memory_mb"] = Benchmark::getPeakMemoryUsage();
+
+  // The collision counts are only available when the instrumentation hooks
+  // have been compiled in
+  if( MonteCarlo::TransportInstrumentation::isEnabled() )
+  {
+    const uint64_t collisions =
+      manager->getTransportInstrumentation().getEventCount(
+                       MonteCarlo::TransportInstrumentation::COLLISION_EVENT );
+
+    metrics["collisions"] = collisions;
+
+    if( collisions > 0 )
+    {
+      metrics["ns_per_collision"] = wall_time*threads/collisions*1e9;
+    }
+  }
+
+  // Report the scattered flux in the material sphere so that the
+  // efficiency of the variance reduction techniques can be compared
+  if( problem.sphere_radius > 0.0 )
+  {
+    MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( histories );
+    MonteCarlo::ParticleHistoryObserver::setElapsedTime( wall_time );
+
+    std::vector<double> mean, relative_error, vov, fom;
+
+    manager->getEventHandler().getEstimator( 1 ).getEntityBinProcessedData(
+                                           1, mean, relative_error, vov, fom );
+
+    metrics["tally_mean"] = mean.front();
+    metrics["tally_relative_error"] = relative_error.front();
+    metrics["tally_figure_of_merit"] = fom.front();
+  }
+
+  return metrics;
+}
+
+} // end Details namespace
+
+int main( int argc, char** argv )
+{
+  Utility::GlobalMPISession mpi_session( argc, argv );
+
+  boost::program_options::variables_map command_line_arguments;
+
+  {
+    // Create the command line options
+    boost::program_options::options_description command_line_options;
+    command_line_options.add_options()
+      ("help,h", "produce help message")
+      ("database",
+       boost::program_options::value<std::string>(),
+       "specify the scattering center properties database (with path)")
+      ("max_threads",
+       boost::program_options::value<unsigned>()->default_value(1),
+       "specify the max number of threads to benchmark (1, 2, 4, ..., max)")
+      ("histories",
+       boost::program_options::value<uint64_t>()->default_value(10000),
+       "specify the number of histories to run for each problem")
+      ("problem",
+       boost::program_options::value<std::vector<std::string> >(),
+       "specify a problem to run (all problems will be run by default)")
+      ("output",
+       boost::program_options::value<std::string>()->default_value("transport_benchmarks.json"),
+       "specify the name of the JSON results file");
+
+    boost::program_options::store(
+         boost::program_options::command_line_parser(argc, argv).options(command_line_options).run(),
+         command_line_arguments );
+
+    boost::program_options::notify( command_line_arguments );
+
+    if( command_line_arguments.count( "help" ) )
+    {
+      std::cout << command_line_options << std::endl;
+
+      return 0;
+    }
+
+    if( !command_line_arguments.count( "database" ) )
+    {
+      std::cerr << "The database must be specified!" << std::endl;
+
+      return 1;
+    }
+  }
+
+  const boost::filesystem::path database_path =
+    command_line_arguments["database"].as<std::string>();
+
+  const std::vector<unsigned> thread_counts = Benchmark::getThreadCounts(
+                        command_line_arguments["max_threads"].as<unsigned>() );
+
+  std::vector<std::string> requested_problems;
+
+  if( command_line_arguments.count( "problem" ) )
+  {
+    requested_problems =
+      command_line_arguments["problem"].as<std::vector<std::string> >();
+  }
+
+  std::unique_ptr<const Data::ScatteringCenterPropertiesDatabase> database;
+
+  try{
+    database.reset(
+              new Data::ScatteringCenterPropertiesDatabase( database_path ) );
+  }
+  EXCEPTION_CATCH_AND_EXIT( std::exception,
+                            "Unable to load the database!" );
+
+  Benchmark::BenchmarkResults results( "transport" );
+
+  for( auto&& problem : Details::getTransportProblems() )
+  {
+    if( !requested_problems.empty() &&
+        std::find( requested_problems.begin(),
+                   requested_problems.end(),
+                   problem.name ) == requested_problems.end() )
+    {
+      continue;
+    }
+
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( problem.mode );
+    properties->setNumberOfHistories(
+                       command_line_arguments["histories"].as<uint64_t>() );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model;
+
+    // Problems that require data that is not in the database are skipped
+    try{
+      model = Details::createFilledModel( problem,
+                                          database_path,
+                                          *database,
+                                          properties );
+    }
+    catch( const std::exception& exception )
+    {
+      std::cout << "Skipping " << problem.name << ": " << exception.what()
+                << std::endl;
+
+      results.addSkippedBenchmark( problem.name, exception.what() );
+
+      continue;
+    }
+
+    try{
+      for( auto&& threads : thread_counts )
+      {
+        std::cout << "Running " << problem.name << " with " << threads
+                  << " thread(s)... " << std::flush;
+
+        Benchmark::Metrics metrics =
+          Details::runProblem( problem, model, properties, threads );
+
+        std::cout << metrics["histories_per_second"] << " histories/s"
+                  << std::endl;
+
+        results.addResult( problem.name, threads, metrics );
+      }
+    }
+    EXCEPTION_CATCH_AND_EXIT( std::exception,
+                              "Unable to complete the " << problem.name <<
+                              " benchmark!" );
+  }
+
+  results.printResults( std::cout );
+
+  results.exportToJSON( command_line_arguments["output"].as<std::string>() );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end transport_benchmarks.cpp
+//---------------------------------------------------------------------------//
@@ -294,6 +294,40 @@ typedef long unsigned int uint64_t;
   %append_output(PyFrensie::convertToPython( *$1 ));
 }
 
+// The ArrayView processed data overloads are used by the NumPy array
+// interface below (the overloads that return lists are wrapped instead)
+%ignore MonteCarlo::Estimator::getTotalBinProcessedData( const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>& ) const;
+%ignore MonteCarlo::Estimator::getEntityBinProcessedData( const EntityId, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>& ) const;
+%ignore MonteCarlo::Estimator::getTotalProcessedData( const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>& ) const;
+%ignore MonteCarlo::Estimator::getEntityTotalProcessedData( const EntityId, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>&, const Utility::ArrayView<double>& ) const;
+
+// Add the NumPy array interface methods
+%extend MonteCarlo::Estimator
+{
+  %pythoncode
+  %{
+    def getTotalBinDataMomentsArray( self, order ):
+        "Return a read-only (response, dim 0 bins, dim 1 bins, ...) view of the total bin data moments of the requested order (no copy is made)"
+        return getEstimatorTotalBinDataMomentsArray( self, order )
+
+    def getEntityBinDataMomentsArray( self, entity_id, order ):
+        "Return a read-only (response, dim 0 bins, dim 1 bins, ...) view of the entity bin data moments of the requested order (no copy is made)"
+        return getEstimatorEntityBinDataMomentsArray( self, entity_id, order )
+
+    def getTotalBinProcessedDataArrays( self ):
+        "Return a dictionary of (response, dim 0 bins, dim 1 bins, ...) arrays of the total bin processed data (mean, re, vov, fom)"
+        return getEstimatorTotalBinProcessedDataArrays( self )
+
+    def getEntityBinProcessedDataArrays( self, entity_id ):
+        "Return a dictionary of (response, dim 0 bins, dim 1 bins, ...) arrays of the entity bin processed data (mean, re, vov, fom)"
+        return getEstimatorEntityBinProcessedDataArrays( self, entity_id )
+
+    def getAllEntityBinProcessedDataArrays( self ):
+        "Return the sorted entity ids and a dictionary of (entity, response, dim 0 bins, dim 1 bins, ...) arrays of the entity bin processed data (mean, re, vov, fom)"
+        return getEstimatorAllEntityBinProcessedDataArrays( self )
+  %}
+};
+
 %shared_ptr( MonteCarlo::Estimator )
 %include "MonteCarlo_Estimator.hpp"
 
@@ -315,6 +349,365 @@ typedef long unsigned int uint64_t;
 %template(getCosineDiscretization) MonteCarlo::Estimator::getDiscretization<MonteCarlo::OBSERVER_COSINE_DIMENSION, std::vector<double> >;
 %template(getSourceIdDiscretization) MonteCarlo::Estimator::getDiscretization<MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION, std::vector<std::set<uint32_t> > >;
 
+//---------------------------------------------------------------------------//
+// Add Estimator NumPy array support
+//---------------------------------------------------------------------------//
+
+// The bin data of an estimator is stored with the first discretized dimension
+// varying fastest and the response function index varying slowest. The arrays
+// returned by the functions below have the shape
+// (response, dim 0 bins, dim 1 bins, ...), which is described with strides so
+// that the estimator memory never has to be rearranged or copied.
+%{
+namespace PyFrensie{
+
+namespace Details{
+
+// Calculate the shape and strides (bytes) of the estimator bin data
+void calculateEstimatorBinDataShape( const MonteCarlo::Estimator& estimator,
+                                     std::vector<npy_intp>& dims,
+                                     std::vector<npy_intp>& strides )
+{
+  std::vector<MonteCarlo::ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  estimator.getDiscretizedDimensions( discretized_dimensions );
+
+  dims.resize( discretized_dimensions.size()+1 );
+  strides.resize( discretized_dimensions.size()+1 );
+
+  dims[0] = estimator.getNumberOfResponseFunctions();
+  strides[0] = estimator.getNumberOfBins()*sizeof(double);
+
+  npy_intp stride = sizeof(double);
+
+  for( size_t i = 0; i < discretized_dimensions.size(); ++i )
+  {
+    dims[i+1] = estimator.getNumberOfBins( discretized_dimensions[i] );
+    strides[i+1] = stride;
+
+    stride *= dims[i+1];
+  }
+}
+
+// Destroy the estimator owner stored in a capsule
+void destroyEstimatorOwnerCapsule( PyObject* capsule )
+{
+  delete reinterpret_cast<std::shared_ptr<const MonteCarlo::Estimator>*>(
+                                      PyCapsule_GetPointer( capsule, NULL ) );
+}
+
+// Create a view of estimator bin data moments
+PyObject* createEstimatorBinDataMomentsArray(
+            const std::shared_ptr<const MonteCarlo::Estimator>& estimator,
+            const Utility::ArrayView<const double>& moments )
+{
+  std::vector<npy_intp> dims, strides;
+
+  calculateEstimatorBinDataShape( *estimator, dims, strides );
+
+  // The capsule shares ownership of the estimator, which keeps the moments
+  // alive for as long as the view exists
+  PyObject* owner = PyCapsule_New(
+                new std::shared_ptr<const MonteCarlo::Estimator>( estimator ),
+                NULL,
+                &destroyEstimatorOwnerCapsule );
+
+  if( !owner )
+    return NULL;
+
+  return PyFrensie::Details::convertArrayViewToStridedPythonView(
+                                             moments, dims, strides, owner );
+}
+
+// Create the processed data arrays (mean, re, vov, fom)
+/*! \details The estimator fills each NumPy buffer directly. The flat buffer
+ * is the base object of the shaped array that is stored in the dictionary.
+ */
+template<typename ProcessedDataFunctor>
+PyObject* createEstimatorProcessedDataArrays(
+                                     const std::vector<npy_intp>& dims,
+                                     const std::vector<npy_intp>& strides,
+                                     const size_t size,
+                                     ProcessedDataFunctor get_processed_data )
+{
+  const char* names[4] = {"mean", "re", "vov", "fom"};
+
+  PyObject* flat_arrays[4] = {NULL, NULL, NULL, NULL};
+  Utility::ArrayView<double> views[4];
+
+  npy_intp flat_dims[1] = { static_cast<npy_intp>( size ) };
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    flat_arrays[i] = PyArray_SimpleNew( 1, flat_dims, NPY_DOUBLE );
+
+    if( !flat_arrays[i] )
+    {
+      for( size_t j = 0; j < i; ++j )
+        Py_DECREF( flat_arrays[j] );
+
+      return NULL;
+    }
+
+    views[i] = Utility::ArrayView<double>(
+                    (double*)PyArray_DATA( (PyArrayObject*)flat_arrays[i] ),
+                    size );
+  }
+
+  try{
+    get_processed_data( views[0], views[1], views[2], views[3] );
+  }
+  catch( const std::exception& exception )
+  {
+    for( size_t i = 0; i < 4; ++i )
+      Py_DECREF( flat_arrays[i] );
+
+    PyErr_SetString( PyExc_RuntimeError, exception.what() );
+
+    return NULL;
+  }
+
+  PyObject* processed_data = PyDict_New();
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    // The shaped array steals the flat array reference
+    PyObject* array = NULL;
+
+    if( processed_data )
+    {
+      array = PyFrensie::Details::convertArrayViewToStridedPythonView(
+                                  views[i], dims, strides, flat_arrays[i] );
+    }
+    else
+      Py_DECREF( flat_arrays[i] );
+
+    if( array )
+    {
+      PyDict_SetItemString( processed_data, names[i], array );
+
+      Py_DECREF( array );
+    }
+    else if( processed_data )
+    {
+      Py_DECREF( processed_data );
+
+      processed_data = NULL;
+    }
+  }
+
+  return processed_data;
+}
+
+// Get the moments of the requested order
+template<typename MomentsFunctor>
+bool getEstimatorMoments( const unsigned order,
+                          MomentsFunctor get_moments,
+                          Utility::ArrayView<const double>& moments )
+{
+  if( order < 1 || order > 4 )
+  {
+    PyErr_SetString( PyExc_ValueError,
+                     "The moment order must be 1, 2, 3 or 4!" );
+
+    return false;
+  }
+
+  try{
+    moments = get_moments( order );
+  }
+  catch( const std::exception& exception )
+  {
+    PyErr_SetString( PyExc_RuntimeError, exception.what() );
+
+    return false;
+  }
+
+  return true;
+}
+
+} // end Details namespace
+
+} // end PyFrensie namespace
+%}
+
+%inline %{
+// Return a read-only view of the total bin data moments of an estimator
+PyObject* getEstimatorTotalBinDataMomentsArray(
+                 const std::shared_ptr<const MonteCarlo::Estimator>& estimator,
+                 const unsigned order )
+{
+  Utility::ArrayView<const double> moments;
+
+  if( !PyFrensie::Details::getEstimatorMoments( order,
+         [&estimator]( const unsigned order ){
+           switch( order )
+           {
+             case 1: return estimator->getTotalBinDataFirstMoments();
+             case 2: return estimator->getTotalBinDataSecondMoments();
+             case 3: return estimator->getTotalBinDataThirdMoments();
+             default: return estimator->getTotalBinDataFourthMoments();
+           }
+         },
+         moments ) )
+    return NULL;
+
+  return PyFrensie::Details::createEstimatorBinDataMomentsArray( estimator,
+                                                                 moments );
+}
+
+// Return a read-only view of the entity bin data moments of an estimator
+PyObject* getEstimatorEntityBinDataMomentsArray(
+                 const std::shared_ptr<const MonteCarlo::Estimator>& estimator,
+                 const MonteCarlo::Estimator::EntityId entity_id,
+                 const unsigned order )
+{
+  if( !estimator->isEntityAssigned( entity_id ) )
+  {
+    PyErr_SetString( PyExc_ValueError,
+                     "The entity is not assigned to the estimator!" );
+
+    return NULL;
+  }
+
+  Utility::ArrayView<const double> moments;
+
+  if( !PyFrensie::Details::getEstimatorMoments( order,
+         [&estimator, entity_id]( const unsigned order ){
+           switch( order )
+           {
+             case 1: return estimator->getEntityBinDataFirstMoments( entity_id );
+             case 2: return estimator->getEntityBinDataSecondMoments( entity_id );
+             case 3: return estimator->getEntityBinDataThirdMoments( entity_id );
+             default: return estimator->getEntityBinDataFourthMoments( entity_id );
+           }
+         },
+         moments ) )
+    return NULL;
+
+  return PyFrensie::Details::createEstimatorBinDataMomentsArray( estimator,
+                                                                 moments );
+}
+
+// Return the total bin processed data arrays of an estimator
+PyObject* getEstimatorTotalBinProcessedDataArrays(
+               const std::shared_ptr<const MonteCarlo::Estimator>& estimator )
+{
+  std::vector<npy_intp> dims, strides;
+
+  PyFrensie::Details::calculateEstimatorBinDataShape( *estimator, dims, strides );
+
+  return PyFrensie::Details::createEstimatorProcessedDataArrays(
+           dims,
+           strides,
+           estimator->getNumberOfBins()*estimator->getNumberOfResponseFunctions(),
+           [&estimator]( const Utility::ArrayView<double>& mean,
+                         const Utility::ArrayView<double>& relative_error,
+                         const Utility::ArrayView<double>& variance_of_variance,
+                         const Utility::ArrayView<double>& figure_of_merit ){
+             estimator->getTotalBinProcessedData( mean,
+                                                  relative_error,
+                                                  variance_of_variance,
+                                                  figure_of_merit );
+           } );
+}
+
+// Return the entity bin processed data arrays of an estimator
+PyObject* getEstimatorEntityBinProcessedDataArrays(
+                 const std::shared_ptr<const MonteCarlo::Estimator>& estimator,
+                 const MonteCarlo::Estimator::EntityId entity_id )
+{
+  if( !estimator->isEntityAssigned( entity_id ) )
+  {
+    PyErr_SetString( PyExc_ValueError,
+                     "The entity is not assigned to the estimator!" );
+
+    return NULL;
+  }
+
+  std::vector<npy_intp> dims, strides;
+
+  PyFrensie::Details::calculateEstimatorBinDataShape( *estimator, dims, strides );
+
+  return PyFrensie::Details::createEstimatorProcessedDataArrays(
+           dims,
+           strides,
+           estimator->getNumberOfBins()*estimator->getNumberOfResponseFunctions(),
+           [&estimator, entity_id](
+                         const Utility::ArrayView<double>& mean,
+                         const Utility::ArrayView<double>& relative_error,
+                         const Utility::ArrayView<double>& variance_of_variance,
+                         const Utility::ArrayView<double>& figure_of_merit ){
+             estimator->getEntityBinProcessedData( entity_id,
+                                                   mean,
+                                                   relative_error,
+                                                   variance_of_variance,
+                                                   figure_of_merit );
+           } );
+}
+
+// Return the entity ids and the processed data arrays of every entity
+PyObject* getEstimatorAllEntityBinProcessedDataArrays(
+               const std::shared_ptr<const MonteCarlo::Estimator>& estimator )
+{
+  std::set<MonteCarlo::Estimator::EntityId> entity_ids;
+
+  estimator->getEntityIds( entity_ids );
+
+  std::vector<npy_intp> dims, strides;
+
+  PyFrensie::Details::calculateEstimatorBinDataShape( *estimator, dims, strides );
+
+  const size_t entity_size =
+    estimator->getNumberOfBins()*estimator->getNumberOfResponseFunctions();
+
+  dims.insert( dims.begin(), entity_ids.size() );
+  strides.insert( strides.begin(), entity_size*sizeof(double) );
+
+  PyObject* processed_data =
+    PyFrensie::Details::createEstimatorProcessedDataArrays(
+           dims,
+           strides,
+           entity_ids.size()*entity_size,
+           [&estimator, &entity_ids, entity_size](
+                         const Utility::ArrayView<double>& mean,
+                         const Utility::ArrayView<double>& relative_error,
+                         const Utility::ArrayView<double>& variance_of_variance,
+                         const Utility::ArrayView<double>& figure_of_merit ){
+             size_t offset = 0;
+
+             for( auto&& entity_id : entity_ids )
+             {
+               estimator->getEntityBinProcessedData(
+                         entity_id,
+                         mean( offset, entity_size ),
+                         relative_error( offset, entity_size ),
+                         variance_of_variance( offset, entity_size ),
+                         figure_of_merit( offset, entity_size ) );
+
+               offset += entity_size;
+             }
+           } );
+
+  if( !processed_data )
+    return NULL;
+
+  std::vector<MonteCarlo::Estimator::EntityId>
+    sorted_entity_ids( entity_ids.begin(), entity_ids.end() );
+
+  PyObject* py_entity_ids = PyFrensie::convertToPython( sorted_entity_ids );
+
+  if( !py_entity_ids )
+  {
+    Py_DECREF( processed_data );
+
+    return NULL;
+  }
+
+  return Py_BuildValue( "(NN)", py_entity_ids, processed_data );
+}
+%}
+
 //---------------------------------------------------------------------------//
 // Add EntityEstimator support
 //---------------------------------------------------------------------------//
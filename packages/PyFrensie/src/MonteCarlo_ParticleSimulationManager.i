@@ -12,12 +12,14 @@
 #include <functional>
 #include <thread>
 #include <set>
+#include <sstream>
   
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
 #include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManager.hpp"
+#include "MonteCarlo_TransportInstrumentation.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
@@ -81,6 +83,31 @@ typedef unsigned long int uint64_t;
 %shared_ptr(MonteCarlo::SimulationProperties);
 %shared_ptr(MonteCarlo::CollisionForcer);
 
+// ---------------------------------------------------------------------------//
+// Add TransportInstrumentation support
+// ---------------------------------------------------------------------------//
+
+// The scoped event timer is only used by the transport loop
+%ignore MonteCarlo::TransportInstrumentation::ScopedEventTimer;
+%ignore MonteCarlo::TransportInstrumentation::printSummary;
+
+%extend MonteCarlo::TransportInstrumentation
+{
+  // String conversion method
+  std::string __str__() const
+  {
+    std::ostringstream oss;
+
+    $self->printSummary( oss );
+
+    return oss.str();
+  }
+}
+
+%shared_ptr(MonteCarlo::TransportInstrumentation);
+
+%include "MonteCarlo_TransportInstrumentation.hpp"
+
 // ---------------------------------------------------------------------------//
 // Add ParticleSimulationManager support
 // ---------------------------------------------------------------------------//
@@ -9,6 +9,7 @@
 %{
 // FRENSIE Includes
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackFileReader.hpp"
 
 using namespace MonteCarlo;
 %}
@@ -22,6 +23,20 @@ using namespace MonteCarlo;
 
 %template(LongUnsignedSet) std::set<unsigned long>;
 
+// Add typemaps for converting file_path to and from Python string
+%typemap(in) const boost::filesystem::path& ( boost::filesystem::path temp ){
+  temp = PyFrensie::convertFromPython<std::string>( $input );
+  $1 = &temp;
+}
+
+%typemap(out) const boost::filesystem::path& {
+  %append_output(PyFrensie::convertToPython( $1->string() ) );
+}
+
+%typemap(typecheck, precedence=1140) (const boost::filesystem::path&) {
+  $1 = (PyString_Check($input)) ? 1 : 0;
+}
+
 // ---------------------------------------------------------------------------//
 // Add ParticleTracker support
 // ---------------------------------------------------------------------------//
@@ -48,6 +63,49 @@ using namespace MonteCarlo;
 %shared_ptr(MonteCarlo::ParticleTracker)
 %include "MonteCarlo_ParticleTracker.hpp"
 
+// ---------------------------------------------------------------------------//
+// Add ParticleTrackFileReader support
+// ---------------------------------------------------------------------------//
+
+%extend MonteCarlo::ParticleTrackFileReader
+{
+  // Return the history numbers in the file (sorted)
+  PyObject* getHistoryNumbers() const
+  {
+    std::vector<uint64_t> history_numbers;
+
+    $self->getHistoryNumbers( history_numbers );
+
+    return PyFrensie::convertToPython( history_numbers );
+  }
+
+  // Read the tracks of a history
+  PyObject* readHistory( const uint64_t history_number )
+  {
+    MonteCarlo::ParticleTracker::ParticleTypeSubmap history_data;
+
+    $self->readHistory( history_number, history_data );
+
+    return PyFrensie::Details::convertMapToPython( history_data );
+  }
+
+  // Read the tracks of every history (only use with small files)
+  PyObject* readAllHistories()
+  {
+    MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+    $self->readAllHistories( history_map );
+
+    return PyFrensie::Details::convertMapToPython( history_map );
+  }
+};
+
+%ignore *::getHistoryNumbers;
+%ignore *::readHistory;
+%ignore *::readAllHistories;
+
+%include "MonteCarlo_ParticleTrackFileReader.hpp"
+
 //---------------------------------------------------------------------------//
 // end MonteCarlo_ParticleTracker.i
 //---------------------------------------------------------------------------//
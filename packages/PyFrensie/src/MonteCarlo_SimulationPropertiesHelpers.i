@@ -170,6 +170,23 @@ MonteCarlo::PROPERTIES::setPhotonuclearInteractionModeOff;
 %feature("autodoc", "isPhotonuclearInteractionModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isPhotonuclearInteractionModeOn;
 
+// Set tabular incoherent sampling mode On/Off
+%feature("autodoc", "setTabularIncoherentSamplingModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setTabularIncoherentSamplingModeOn;
+
+%feature("autodoc", "setTabularIncoherentSamplingModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setTabularIncoherentSamplingModeOff;
+
+%feature("autodoc", "isTabularIncoherentSamplingModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isTabularIncoherentSamplingModeOn;
+
+// Set/get the integrated cross section table tolerance
+%feature("autodoc", "setIntegratedCrossSectionTableTolerance(PROPERTIES self, const double tolerance) -> void")
+MonteCarlo::PROPERTIES::setIntegratedCrossSectionTableTolerance;
+
+%feature("autodoc", "getIntegratedCrossSectionTableTolerance(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getIntegratedCrossSectionTableTolerance;
+
 %atomic_simulation_properties_setup_helper( PROPERTIES )
 
 %enddef
@@ -193,6 +210,13 @@ MonteCarlo::PROPERTIES::setCriticalAdjointPhotonLineEnergies;
 %feature("autodoc", "getCriticalAdjointPhotonLineEnergies(PROPERTIES self) -> const std::vector<double>&")
 MonteCarlo::PROPERTIES::getCriticalAdjointPhotonLineEnergies;
 
+// Set/get the integrated cross section table tolerance
+%feature("autodoc", "setAdjointIntegratedCrossSectionTableTolerance(PROPERTIES self, const double tolerance) -> void")
+MonteCarlo::PROPERTIES::setAdjointIntegratedCrossSectionTableTolerance;
+
+%feature("autodoc", "getAdjointIntegratedCrossSectionTableTolerance(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getAdjointIntegratedCrossSectionTableTolerance;
+
 %enddef
 
 //---------------------------------------------------------------------------//
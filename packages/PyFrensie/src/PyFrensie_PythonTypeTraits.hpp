@@ -72,6 +72,14 @@ STLCompliantArray convertPythonToArray( PyObject* py_obj );
 template<typename T>
 PyObject* convertArrayViewToPython( const Utility::ArrayView<T>& obj );
 
+// Create a strided Python (NumPy) view of an ArrayView object's memory
+template<typename T>
+PyObject* convertArrayViewToStridedPythonView(
+                                     const Utility::ArrayView<T>& obj,
+                                     const std::vector<npy_intp>& dims,
+                                     const std::vector<npy_intp>& strides,
+                                     PyObject* owner );
+
 // Create an ArrayView object from a Python object
 template<typename T>
 Utility::ArrayView<T> convertPythonToArrayView( PyObject* py_obj );
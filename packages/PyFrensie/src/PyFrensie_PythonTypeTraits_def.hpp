@@ -401,6 +401,60 @@ PyObject* convertArrayViewToPython( const Utility::ArrayView<T>& obj )
   return PyArray_SimpleNewFromData( 1, dims, typecode, (void*)obj.data() );
 }
 
+// Create a strided Python (NumPy) view of an ArrayView object's memory
+/*! \details The strides are in bytes. No copy of the data will be made. The
+ * view will only be writeable if the ArrayView is not an ArrayView of const.
+ * The owner will be set as the base object of the view (the reference is
+ * stolen), which keeps the memory alive for the lifetime of the view. If the
+ * view cannot be created the owner reference will be released and NULL will
+ * be returned.
+ */
+template<typename T>
+PyObject* convertArrayViewToStridedPythonView(
+                                     const Utility::ArrayView<T>& obj,
+                                     const std::vector<npy_intp>& dims,
+                                     const std::vector<npy_intp>& strides,
+                                     PyObject* owner )
+{
+  typedef typename std::remove_const<T>::type ValueType;
+
+  // Make sure that the dims and strides are valid
+  testPrecondition( dims.size() == strides.size() );
+  testPrecondition( dims.size() > 0 );
+
+  int typecode = numpyTypecode( ValueType() );
+  int flags = NPY_ARRAY_ALIGNED;
+
+  if( !std::is_const<T>::value )
+    flags |= NPY_ARRAY_WRITEABLE;
+
+  PyObject* py_array = PyArray_New( &PyArray_Type,
+                                    dims.size(),
+                                    const_cast<npy_intp*>( dims.data() ),
+                                    typecode,
+                                    const_cast<npy_intp*>( strides.data() ),
+                                    (void*)obj.data(),
+                                    0,
+                                    flags,
+                                    NULL );
+
+  if( !py_array )
+  {
+    Py_XDECREF( owner );
+
+    return NULL;
+  }
+
+  if( PyArray_SetBaseObject( (PyArrayObject*)py_array, owner ) != 0 )
+  {
+    Py_DECREF( py_array );
+
+    return NULL;
+  }
+
+  return py_array;
+}
+
 // Create a Python (NumPy) object from a fixed size array object
 template<typename FixedSizeArray>
 PyObject* convertFixedSizeArrayToPython( const FixedSizeArray& obj )
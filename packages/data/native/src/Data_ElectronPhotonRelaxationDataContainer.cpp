@@ -17,39 +17,83 @@
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_DataContainerHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Data{
 
 // Initialize static member data
 const std::string ElectronPhotonRelaxationDataContainer::s_archive_name( "container" );
+const std::string ElectronPhotonRelaxationDataContainer::s_indexed_archive_extension( ".ibin" );
+
+// Default constructor
+ElectronPhotonRelaxationDataContainer::ElectronPhotonRelaxationDataContainer()
+  : d_indexed_archive_name(),
+    d_data_block_offsets()
+{
+  this->setAllDataBlocksLoaded( true );
+}
 
 // Constructor (from saved archive)
+/*! \details If the archive is an indexed archive (.ibin) the data blocks
+ * will be loaded from the archive the first time that they are accessed.
+ */
 ElectronPhotonRelaxationDataContainer::ElectronPhotonRelaxationDataContainer(
                            const boost::filesystem::path& file_name_with_path )
+  : d_indexed_archive_name(),
+    d_data_block_offsets()
 {
+  this->setAllDataBlocksLoaded( true );
+
   // Import the data in the archive
   this->loadFromFile( file_name_with_path );
 }
 
 // Load the archived object (implementation)
+/*! \details The bpis pointer is shared by every container, so it is only
+ * reset inside of the critical section that guards all of the archive I/O
+ * of the electron-photon-relaxation data containers.
+ */
 void ElectronPhotonRelaxationDataContainer::loadFromFileImpl(
                         const boost::filesystem::path& archive_name_with_path )
 {
   std::string extension = archive_name_with_path.extension().string();
 
-  // The bpis pointer must be NULL. Depending on the libraries that have been
-  // loaded (e.g. utility_grid) the bpis might be initialized to a non-NULL
-  // value
-  const boost::archive::detail::basic_pointer_iserializer* bpis =
-    this->resetBpisPointer<std::vector<double> >( extension );
+  // Only the header and the data block index of an indexed archive are loaded
+  if( extension == s_indexed_archive_extension )
+  {
+    this->loadFromIndexedArchive( archive_name_with_path );
 
-  // Import the data in the archive
-  BaseType::loadFromFileImpl( archive_name_with_path );
+    return;
+  }
 
-  // The bpis pointer must be restored to its original value so that libraries
-  // that expect it to be non-NULL behave correctly
-  this->restoreBpisPointer<std::vector<double> >( extension, bpis );
+  std::string error_message;
+
+  #pragma omp critical( epr_data_container_archive_io )
+  {
+    // The bpis pointer must be NULL. Depending on the libraries that have
+    // been loaded (e.g. utility_grid) the bpis might be initialized to a
+    // non-NULL value
+    const boost::archive::detail::basic_pointer_iserializer* bpis =
+      this->resetBpisPointer<std::vector<double> >( extension );
+
+    // Import the data in the archive
+    try{
+      BaseType::loadFromFileImpl( archive_name_with_path );
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+
+    // The bpis pointer must be restored to its original value so that
+    // libraries that expect it to be non-NULL behave correctly
+    this->restoreBpisPointer<std::vector<double> >( extension, bpis );
+  }
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      error_message );
 }
 
 // Archive the object (implementation)
@@ -59,18 +103,54 @@ void ElectronPhotonRelaxationDataContainer::saveToFileImpl(
 {
   std::string extension = archive_name_with_path.extension().string();
 
-  // The bpos pointer must be NULL. Depending on the libraries that have been
-  // loaded (e.g. utility_grid) the bpos might be initialized to a non-NULL
-  // value
-  const boost::archive::detail::basic_pointer_oserializer* bpos =
-    this->resetBposPointer<std::vector<double> >( extension );
-
-  // Import the data in the archive
-  BaseType::saveToFileImpl( archive_name_with_path, overwrite );
-
-  // The bpos pointer must be restored to its original value so that libraries
-  // that expect it to be non-NULL behave correctly
-  this->restoreBposPointer<std::vector<double> >( extension, bpos );
+  if( extension == s_indexed_archive_extension )
+  {
+    // Check if overwriting is permitted
+    if( !overwrite )
+    {
+      TEST_FOR_EXCEPTION( boost::filesystem::exists( archive_name_with_path ),
+                          std::runtime_error,
+                          "A file with the specified path and name already "
+                          "exists!" );
+    }
+
+    this->saveToIndexedArchive( archive_name_with_path );
+
+    return;
+  }
+
+  // Data blocks that are still in an indexed archive must be loaded before
+  // the critical section is entered (named critical sections can't be
+  // nested)
+  this->loadAllDataBlocks();
+
+  std::string error_message;
+
+  #pragma omp critical( epr_data_container_archive_io )
+  {
+    // The bpos pointer must be NULL. Depending on the libraries that have
+    // been loaded (e.g. utility_grid) the bpos might be initialized to a
+    // non-NULL value
+    const boost::archive::detail::basic_pointer_oserializer* bpos =
+      this->resetBposPointer<std::vector<double> >( extension );
+
+    // Export the data to the archive
+    try{
+      BaseType::saveToFileImpl( archive_name_with_path, overwrite );
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+
+    // The bpos pointer must be restored to its original value so that
+    // libraries that expect it to be non-NULL behave correctly
+    this->restoreBposPointer<std::vector<double> >( extension, bpos );
+  }
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      error_message );
 }
 
 // The database name used in an archive
@@ -79,6 +159,270 @@ const char* ElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Check if a data block has been loaded
+bool ElectronPhotonRelaxationDataContainer::isDataBlockLoaded(
+                                                const DataBlock block ) const
+{
+  // Make sure the data block is valid
+  testPrecondition( block < DataBlock_END );
+
+  return d_data_block_loaded[block].load( std::memory_order_acquire );
+}
+
+// Set the loaded flag of every data block
+void ElectronPhotonRelaxationDataContainer::setAllDataBlocksLoaded(
+                                                    const bool loaded ) const
+{
+  for( auto&& data_block_loaded : d_data_block_loaded )
+    data_block_loaded.store( loaded, std::memory_order_release );
+}
+
+// Check if every data block has been loaded
+bool ElectronPhotonRelaxationDataContainer::areAllDataBlocksLoaded() const
+{
+  for( auto&& data_block_loaded : d_data_block_loaded )
+  {
+    if( !data_block_loaded.load( std::memory_order_acquire ) )
+      return false;
+  }
+
+  return true;
+}
+
+// Load the indexed archive header and data block index
+/*! \details The indexed archive layout is the offset of the index (uint64),
+ * followed by the data blocks (each is a separate binary archive), followed
+ * by the index (a binary archive that stores the data block offsets and the
+ * header data).
+ */
+void ElectronPhotonRelaxationDataContainer::loadFromIndexedArchive(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  // Verify that the archive exists
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( archive_name_with_path ),
+                      std::runtime_error,
+                      "Cannot load the indexed archive "
+                      << archive_name_with_path.string() <<
+                      " because the file does not exist!" );
+
+  std::ifstream iarchive_stream( archive_name_with_path.string(),
+                                 std::ifstream::binary );
+
+  uint64_t index_offset;
+
+  iarchive_stream.read( reinterpret_cast<char*>( &index_offset ),
+                        sizeof(index_offset) );
+  iarchive_stream.seekg( index_offset );
+
+  TEST_FOR_EXCEPTION( !iarchive_stream.good(),
+                      std::runtime_error,
+                      "The indexed archive "
+                      << archive_name_with_path.string() <<
+                      " is not valid!" );
+
+  std::vector<uint64_t> data_block_offsets;
+  std::string error_message;
+
+  #pragma omp critical( epr_data_container_archive_io )
+  {
+    // The bpis pointer must be NULL (see loadFromFileImpl)
+    const boost::archive::detail::basic_pointer_iserializer* bpis =
+      this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+    try{
+      boost::archive::binary_iarchive archive( iarchive_stream );
+
+      archive >> boost::serialization::make_nvp( "data_block_offsets",
+                                                 data_block_offsets );
+
+      this->serializeIndexedArchiveHeader( archive );
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+
+    this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+  }
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      "Could not load the index of the indexed archive "
+                      << archive_name_with_path.string() << ": "
+                      << error_message );
+
+  TEST_FOR_EXCEPTION( data_block_offsets.size() != DataBlock_END,
+                      std::runtime_error,
+                      "The indexed archive "
+                      << archive_name_with_path.string() <<
+                      " has " << data_block_offsets.size() << " data blocks "
+                      "(" << DataBlock_END << " expected)!" );
+
+  d_indexed_archive_name = archive_name_with_path;
+  d_data_block_offsets.swap( data_block_offsets );
+  this->setAllDataBlocksLoaded( false );
+}
+
+// Save the data to an indexed archive
+void ElectronPhotonRelaxationDataContainer::saveToIndexedArchive(
+                  const boost::filesystem::path& archive_name_with_path ) const
+{
+  // Data blocks that are still in an indexed archive must be loaded first
+  this->loadAllDataBlocks();
+
+  // Verify that the parent directory exists
+  if( archive_name_with_path.has_parent_path() )
+  {
+    TEST_FOR_EXCEPTION( !boost::filesystem::exists( archive_name_with_path.parent_path() ),
+                        std::runtime_error,
+                        "Cannot create the indexed archive "
+                        << archive_name_with_path.string() <<
+                        " because the parent directory does not exist!" );
+  }
+
+  std::ofstream oarchive_stream( archive_name_with_path.string(),
+                                 std::ofstream::binary );
+
+  // Reserve space for the index offset
+  uint64_t index_offset = 0;
+
+  oarchive_stream.write( reinterpret_cast<const char*>( &index_offset ),
+                         sizeof(index_offset) );
+
+  // The serialization methods are shared with loading
+  ElectronPhotonRelaxationDataContainer& mutable_container =
+    const_cast<ElectronPhotonRelaxationDataContainer&>( *this );
+
+  std::string error_message;
+
+  #pragma omp critical( epr_data_container_archive_io )
+  {
+    // The bpos pointer must be NULL (see saveToFileImpl)
+    const boost::archive::detail::basic_pointer_oserializer* bpos =
+      this->resetBposPointer<std::vector<double> >( ".bin" );
+
+    try{
+      std::vector<uint64_t> data_block_offsets( DataBlock_END );
+
+      for( size_t i = 0; i < DataBlock_END; ++i )
+      {
+        data_block_offsets[i] = oarchive_stream.tellp();
+
+        boost::archive::binary_oarchive archive( oarchive_stream );
+
+        mutable_container.serializeDataBlock( archive, (DataBlock)i );
+      }
+
+      index_offset = oarchive_stream.tellp();
+
+      {
+        boost::archive::binary_oarchive archive( oarchive_stream );
+
+        archive << boost::serialization::make_nvp( "data_block_offsets",
+                                                   data_block_offsets );
+
+        mutable_container.serializeIndexedArchiveHeader( archive );
+      }
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+
+    this->restoreBposPointer<std::vector<double> >( ".bin", bpos );
+  }
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      "Could not write the indexed archive "
+                      << archive_name_with_path.string() << ": "
+                      << error_message );
+
+  // Record the index offset
+  oarchive_stream.seekp( 0 );
+  oarchive_stream.write( reinterpret_cast<const char*>( &index_offset ),
+                         sizeof(index_offset) );
+
+  TEST_FOR_EXCEPTION( !oarchive_stream.good(),
+                      std::runtime_error,
+                      "Could not write the indexed archive "
+                      << archive_name_with_path.string() << "!" );
+}
+
+// Load a data block from the indexed archive (if not already loaded)
+/*! \details The loaded data will be stored in the container, which allows
+ * the getters to return references to it. A data block that has already
+ * been loaded is detected with an atomic flag, so the critical section is
+ * only entered while the data block is still in the indexed archive. The
+ * indexed archive name is cleared once every data block has been loaded.
+ * This method is thread safe.
+ */
+void ElectronPhotonRelaxationDataContainer::loadDataBlock(
+                                                 const DataBlock block ) const
+{
+  // Make sure the data block is valid
+  testPrecondition( block < DataBlock_END );
+
+  // The data block has already been loaded
+  if( d_data_block_loaded[block].load( std::memory_order_acquire ) )
+    return;
+
+  std::string error_message;
+
+  #pragma omp critical( epr_data_container_archive_io )
+  {
+    if( !d_data_block_loaded[block].load( std::memory_order_relaxed ) )
+    {
+      // The bpis pointer must be NULL (see loadFromFileImpl)
+      const boost::archive::detail::basic_pointer_iserializer* bpis =
+        this->resetBpisPointer<std::vector<double> >( ".bin" );
+
+      try{
+        std::ifstream iarchive_stream( d_indexed_archive_name.string(),
+                                       std::ifstream::binary );
+
+        iarchive_stream.seekg( d_data_block_offsets[block] );
+
+        boost::archive::binary_iarchive archive( iarchive_stream );
+
+        const_cast<ElectronPhotonRelaxationDataContainer*>( this )->serializeDataBlock( archive, block );
+
+        d_data_block_loaded[block].store( true, std::memory_order_release );
+      }
+      catch( const std::exception& exception )
+      {
+        std::ostringstream oss;
+
+        oss << "Could not load data block " << (unsigned)block
+            << " from the indexed archive "
+            << d_indexed_archive_name.string() << ": " << exception.what();
+
+        error_message = oss.str();
+      }
+
+      this->restoreBpisPointer<std::vector<double> >( ".bin", bpis );
+
+      // The indexed archive is no longer needed
+      if( this->areAllDataBlocksLoaded() )
+      {
+        d_indexed_archive_name.clear();
+        d_data_block_offsets.clear();
+      }
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      error_message );
+}
+
+// Load all data blocks from the indexed archive
+void ElectronPhotonRelaxationDataContainer::loadAllDataBlocks() const
+{
+  for( size_t i = 0; i < DataBlock_END; ++i )
+    this->loadDataBlock( (DataBlock)i );
+}
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -286,6 +630,8 @@ double ElectronPhotonRelaxationDataContainer::getSubshellBindingEnergy(
 // Return if there is relaxation data
 bool ElectronPhotonRelaxationDataContainer::hasRelaxationData() const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   return d_relaxation_transitions.size() > 0;
 }
 
@@ -293,6 +639,8 @@ bool ElectronPhotonRelaxationDataContainer::hasRelaxationData() const
 bool ElectronPhotonRelaxationDataContainer::hasSubshellRelaxationData(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -305,6 +653,8 @@ bool ElectronPhotonRelaxationDataContainer::hasSubshellRelaxationData(
 unsigned ElectronPhotonRelaxationDataContainer::getSubshellRelaxationTransitions(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -317,6 +667,8 @@ const std::vector<std::pair<unsigned,unsigned> >&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationVacancies(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -329,6 +681,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationParticleEnergies(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -341,6 +695,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellRelaxationProbabilities(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -357,6 +713,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getComptonProfileMomentumGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -369,6 +727,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getComptonProfile(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -381,6 +741,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getOccupationNumberMomentumGrid(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( OCCUPATION_NUMBER_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -393,6 +755,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getOccupationNumber(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( OCCUPATION_NUMBER_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -404,6 +768,8 @@ ElectronPhotonRelaxationDataContainer::getOccupationNumber(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function_momentum_grid;
 }
 
@@ -411,6 +777,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentu
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_scattering_function;
 }
 
@@ -418,12 +786,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() cons
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor_momentum_grid;
 }
 
 // Return the Waller-Hartree atomic form factor
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_atomic_form_factor;
 }
 
@@ -431,6 +803,8 @@ const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
 }
 
@@ -438,6 +812,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSq
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   return d_waller_hartree_squared_atomic_form_factor;
 }
 
@@ -445,12 +821,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor()
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getPhotonEnergyGrid() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photon_energy_grid;
 }
 
 // Check if there are average heating numbers
 bool ElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_has_average_photon_heating_numbers;
 }
 
@@ -458,6 +838,8 @@ bool ElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() con
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_average_photon_heating_numbers;
 }
 
@@ -465,6 +847,8 @@ ElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_incoherent_cross_section;
 }
 
@@ -472,6 +856,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection()
 unsigned
 ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_incoherent_cross_section_threshold_index;
 }
 
@@ -479,6 +865,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_incoherent_cross_section;
 }
 
@@ -486,6 +874,8 @@ ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection()
 unsigned
 ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_incoherent_cross_section_threshold_index;
 }
 
@@ -494,6 +884,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -506,6 +898,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -517,6 +911,8 @@ ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSe
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_coherent_cross_section;
 }
 
@@ -524,6 +920,8 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() co
 unsigned
 ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_coherent_cross_section_threshold_index;
 }
 
@@ -531,12 +929,16 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThres
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getPairProductionCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_pair_production_cross_section;
 }
 
 // Return the pair production cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_pair_production_cross_section_threshold_index;
 }
 
@@ -544,24 +946,32 @@ unsigned ElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThr
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_triplet_production_cross_section;
 }
 
 // Return the triplet production cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_triplet_production_cross_section_threshold_index;
 }
 
 // Return the Photoelectric effect cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photoelectric_cross_section;
 }
 
 // Return the Photoelectric effect cross section threshold energy bin index
 unsigned ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_photoelectric_cross_section_threshold_index;
 }
 
@@ -570,6 +980,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSection(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -582,6 +994,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThresholdEnergyIndex(
                                                 const unsigned subshell ) const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) !=
                     d_subshells.end() );
@@ -592,12 +1006,16 @@ ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThres
 // Return the Waller-Hartree total cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_waller_hartree_total_cross_section;
 }
 
 // Return the impulse approx. total cross section
 const std::vector<double>& ElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   return d_impulse_approx_total_cross_section;
 }
 
@@ -624,6 +1042,8 @@ ElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_angular_energy_grid;
 }
 
@@ -631,6 +1051,8 @@ ElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticInterpPolicy() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_cutoff_elastic_interp;
 }
 
@@ -638,6 +1060,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticInterpPolicy() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_cutoff_elastic_angles;
 }
 
@@ -645,6 +1069,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_cutoff_elastic_pdf;
 }
 
@@ -653,6 +1079,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticAngles(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -665,6 +1093,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -695,6 +1125,8 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticPDF(
 // Return if there is moment preserving data
 bool ElectronPhotonRelaxationDataContainer::hasMomentPreservingData() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_moment_preserving_elastic_discrete_angles.size() > 0;
 }
 
@@ -702,6 +1134,8 @@ bool ElectronPhotonRelaxationDataContainer::hasMomentPreservingData() const
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_moment_preserving_elastic_discrete_angles;
 }
 
@@ -709,6 +1143,8 @@ ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles(
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_moment_preserving_elastic_weights;
 }
 
@@ -717,6 +1153,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -729,6 +1167,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -742,6 +1182,8 @@ ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getMomentPreservingCrossSectionReduction() const
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   return d_moment_preserving_cross_section_reductions;
 }
 
@@ -750,6 +1192,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectroionizationEnergyGrid(
                             const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -760,6 +1204,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationEnergyGrid(
 const std::string&
 ElectronPhotonRelaxationDataContainer::getElectroionizationInterpPolicy() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   return d_electroionization_interp;
 }
 
@@ -768,6 +1214,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilEnergy(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -780,6 +1228,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilEnergy(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -798,6 +1248,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -810,6 +1262,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -826,6 +1280,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
 // Return if there is electroionization outgoing energy data
 bool ElectronPhotonRelaxationDataContainer::hasElectroionizationOutgoingEnergyData() const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   return d_electroionization_outgoing_energy.size() > 0;
 }
 
@@ -834,6 +1290,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingEnergy(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -846,6 +1304,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingEnergy(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -866,6 +1326,8 @@ const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
                            const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -880,6 +1342,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
                            const unsigned subshell,
                            const double incoming_energy ) const
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure there is outgoing energy data
   testPrecondition( this->hasElectroionizationOutgoingEnergyData() );
   // Make sure the subshell is valid
@@ -899,6 +1363,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   return d_bremsstrahlung_energy_grid;
 }
 
@@ -906,6 +1372,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonInterpPolicy() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_interp;
 }
 
@@ -913,6 +1381,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonInterpPolicy() con
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_energy;
 }
 
@@ -921,6 +1391,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -932,6 +1404,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy(
 const std::map<double,std::vector<double> >&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF() const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   return d_bremsstrahlung_photon_pdf;
 }
 
@@ -940,6 +1414,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
                             const double incoming_energy ) const
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -951,6 +1427,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_grid;
 }
 
@@ -958,6 +1436,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_loss_interp;
 }
 
@@ -965,6 +1445,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   return d_atomic_excitation_energy_loss;
 }
 
@@ -972,6 +1454,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electron_energy_grid;
 }
 
@@ -979,6 +1463,8 @@ ElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const
 const std::string&
 ElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electron_cross_section_interp;
 }
 
@@ -986,6 +1472,8 @@ ElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() con
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_electron_cross_section;
 }
 
@@ -993,6 +1481,8 @@ ElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_cutoff_elastic_cross_section;
 }
 
@@ -1000,12 +1490,16 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_cutoff_elastic_cross_section_threshold_index;
 }
 // Return the screened Rutherford elastic electron cross section
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_screened_rutherford_elastic_cross_section;
 }
 
@@ -1013,6 +1507,8 @@ ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection(
 unsigned
 ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_screened_rutherford_elastic_cross_section_threshold_index;
 }
 
@@ -1020,6 +1516,8 @@ ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionT
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_elastic_cross_section;
 }
 
@@ -1027,6 +1525,8 @@ ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_total_elastic_cross_section_threshold_index;
 }
 
@@ -1035,6 +1535,8 @@ const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSection(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electroionization_subshell_cross_section.find( subshell )->second;
 }
 
@@ -1043,6 +1545,8 @@ unsigned
 ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThresholdEnergyIndex(
     const unsigned subshell ) const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_electroionization_subshell_cross_section_threshold_index.find( subshell )->second;
 }
 
@@ -1050,6 +1554,8 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThreshold
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_bremsstrahlung_cross_section;
 }
 
@@ -1057,6 +1563,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_bremsstrahlung_cross_section_threshold_index;
 }
 
@@ -1064,6 +1572,8 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEne
 const std::vector<double>&
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_atomic_excitation_cross_section;
 }
 
@@ -1071,6 +1581,8 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const
 unsigned
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSectionThresholdEnergyIndex() const
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   return d_atomic_excitation_cross_section_threshold_index;
 }
 
@@ -1400,6 +1912,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationTransitions(
                            const unsigned subshell,
                            const unsigned transitions )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -1411,6 +1925,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationVacancies(
        const unsigned subshell,
        const std::vector<std::pair<unsigned,unsigned> >& relaxation_vacancies )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation vacancies are valid
@@ -1425,6 +1941,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationParticleEnergie
               const unsigned subshell,
               const std::vector<double>& relaxation_particle_energies )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation particle energies are valid
@@ -1439,6 +1957,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellRelaxationProbabilities(
                           const unsigned subshell,
                           const std::vector<double>& relaxation_probabilities )
 {
+  this->loadDataBlock( RELAXATION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the relaxation cdf is valid
@@ -1458,6 +1978,8 @@ void ElectronPhotonRelaxationDataContainer::setComptonProfileMomentumGrid(
                      const unsigned subshell,
                      const std::vector<double>& compton_profile_momentum_grid )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the momentum grid is valid
@@ -1475,6 +1997,8 @@ void ElectronPhotonRelaxationDataContainer::setComptonProfile(
                                    const unsigned subshell,
                                    const std::vector<double>& compton_profile )
 {
+  this->loadDataBlock( COMPTON_PROFILE_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the compton_profile is valid
@@ -1490,6 +2014,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumberMomentumGrid(
                     const unsigned subshell,
                     const std::vector<double>& occupation_number_momentum_grid )
 {
+  this->loadDataBlock( OCCUPATION_NUMBER_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number momentum grid is valid
@@ -1507,6 +2033,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumber(
                                   const unsigned subshell,
                                   const std::vector<double>& occupation_number )
 {
+  this->loadDataBlock( OCCUPATION_NUMBER_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the occupation number is valid
@@ -1522,6 +2050,8 @@ void ElectronPhotonRelaxationDataContainer::setOccupationNumber(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunctionMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1535,6 +2065,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunctionMo
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunction(
                                const std::vector<double>& scattering_function )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the scattering function is valid
   testPrecondition( scattering_function.size() ==
                     d_waller_hartree_scattering_function_momentum_grid.size());
@@ -1548,6 +2080,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeScatteringFunction(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactorMomentumGrid(
                                      const std::vector<double>& momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending( momentum_grid.begin(),
@@ -1561,6 +2095,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactorMome
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactor(
                                 const std::vector<double>& atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition( atomic_form_factor.size() ==
                     d_waller_hartree_atomic_form_factor_momentum_grid.size() );
@@ -1577,6 +2113,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeAtomicFormFactor(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid(
                              const std::vector<double>& squared_momentum_grid )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the momentum grid is valid
   testPrecondition( squared_momentum_grid.size() > 1 );
   testPrecondition( Utility::Sort::isSortedAscending(
@@ -1592,6 +2130,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFac
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFactor(
                         const std::vector<double>& squared_atomic_form_factor )
 {
+  this->loadDataBlock( FORM_FACTOR_DATA_BLOCK );
+
   // Make sure the atomic form factor is valid
   testPrecondition(
      squared_atomic_form_factor.size() ==
@@ -1610,6 +2150,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeSquaredAtomicFormFac
 void ElectronPhotonRelaxationDataContainer::setPhotonEnergyGrid(
                                        const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -1620,6 +2162,8 @@ void ElectronPhotonRelaxationDataContainer::setPhotonEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setHasAveragePhotonHeatingNumbers(
                                                const bool has_heating_numbers )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   d_has_average_photon_heating_numbers = has_heating_numbers;
 }
 
@@ -1627,6 +2171,8 @@ void ElectronPhotonRelaxationDataContainer::setHasAveragePhotonHeatingNumbers(
 void ElectronPhotonRelaxationDataContainer::setAveragePhotonHeatingNumbers(
                                    const std::vector<double>& heating_numbers )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the heating numbers are valid
   testPrecondition( heating_numbers.size() == d_photon_energy_grid.size() );
 
@@ -1637,6 +2183,8 @@ void ElectronPhotonRelaxationDataContainer::setAveragePhotonHeatingNumbers(
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSection(
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoherent cross section is valid
   testPrecondition( incoherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1649,6 +2197,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_waller_hartree_incoherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1660,6 +2210,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSection(
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the incoherent cross section is valid
   testPrecondition( incoherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1672,6 +2224,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSecti
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_impulse_approx_incoherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1684,6 +2238,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
                           const unsigned subshell,
                           const std::vector<double>& incoherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoherent cross section is valid
@@ -1700,6 +2256,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the threshold index is valid
@@ -1718,6 +2276,8 @@ void ElectronPhotonRelaxationDataContainer::setImpulseApproxSubshellIncoherentCr
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection(
                             const std::vector<double>& coherent_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the coherent cross section is valid
   testPrecondition( coherent_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1730,6 +2290,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_waller_hartree_coherent_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1741,6 +2303,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeCoherentCrossSection
 void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSection(
                      const std::vector<double>& pair_production_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the pair production cross section is valid
   testPrecondition( pair_production_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1753,6 +2317,8 @@ void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSection(
 void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_pair_production_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1764,6 +2330,8 @@ void ElectronPhotonRelaxationDataContainer::setPairProductionCrossSectionThresho
 void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSection(
                   const std::vector<double>& triplet_production_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the triplet production cross section is valid
   testPrecondition( triplet_production_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1776,6 +2344,8 @@ void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSection(
 void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_triplet_production_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1787,6 +2357,8 @@ void ElectronPhotonRelaxationDataContainer::setTripletProductionCrossSectionThre
 void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSection(
                        const std::vector<double>& photoelectric_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the photoelectric cross section is valid
   testPrecondition( photoelectric_cross_section.size() <=
                     d_photon_energy_grid.size() );
@@ -1798,6 +2370,8 @@ void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSection(
 void ElectronPhotonRelaxationDataContainer::setPhotoelectricCrossSectionThresholdEnergyIndex(
                                                          const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition( d_photoelectric_cross_section.size() + index ==
                     d_photon_energy_grid.size() );
@@ -1810,6 +2384,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
                        const unsigned subshell,
                        const std::vector<double>& photoelectric_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the photoelectric cross section is valid
@@ -1826,6 +2402,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
                                                        const unsigned subshell,
                                                        const unsigned index )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the index is valid
@@ -1843,6 +2421,8 @@ void ElectronPhotonRelaxationDataContainer::setSubshellPhotoelectricCrossSection
 void ElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() == d_photon_energy_grid.size());
   testPrecondition( Data::valuesGreaterThanZero( total_cross_section ) );
@@ -1854,6 +2434,8 @@ void ElectronPhotonRelaxationDataContainer::setWallerHartreeTotalCrossSection(
 void ElectronPhotonRelaxationDataContainer::setImpulseApproxTotalCrossSection(
                                const std::vector<double>& total_cross_section )
 {
+  this->loadDataBlock( PHOTON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total cross section is valid
   testPrecondition( total_cross_section.size() == d_photon_energy_grid.size());
   testPrecondition( Data::valuesGreaterThanZero( total_cross_section ) );
@@ -1890,6 +2472,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronTwoDGridPolicy(
 void ElectronPhotonRelaxationDataContainer::setElasticAngularEnergyGrid(
                        const std::vector<double>& angular_energy_grid )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the angular energy grid is valid
   testPrecondition( angular_energy_grid.back() > 0 );
   testPrecondition(
@@ -1905,6 +2489,8 @@ void ElectronPhotonRelaxationDataContainer::setElasticAngularEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticInterpPolicy(
     const std::string& cutoff_elastic_interp )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( cutoff_elastic_interp ) );
 
@@ -1916,6 +2502,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticAnglesAtEnergy(
     const double incoming_energy,
     const std::vector<double>& cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -1937,6 +2525,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDFAtEnergy(
     const double incoming_energy,
     const std::vector<double>& cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -1949,6 +2539,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDFAtEnergy(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticAngles(
     const std::map<double,std::vector<double> >& cutoff_elastic_angles )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   d_cutoff_elastic_angles = cutoff_elastic_angles;
 }
 
@@ -1956,12 +2548,16 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticAngles(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticPDF(
     const std::map<double,std::vector<double> >& cutoff_elastic_pdf )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   d_cutoff_elastic_pdf = cutoff_elastic_pdf;
 }
 
 // Clear all the moment preserving data
 void ElectronPhotonRelaxationDataContainer::clearMomentPreservingData()
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   d_moment_preserving_elastic_discrete_angles.clear();
   d_moment_preserving_elastic_weights.clear();
   d_moment_preserving_cross_section_reductions.clear();
@@ -1971,6 +2567,8 @@ void ElectronPhotonRelaxationDataContainer::clearMomentPreservingData()
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAngles(
   const std::map<double,std::vector<double> >& moment_preserving_elastic_discrete_angles)
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the moment preserving elastic discrete angles are valid
   testPrecondition( moment_preserving_elastic_discrete_angles.size() ==
                     this->getElasticAngularEnergyGrid().size() );
@@ -1982,6 +2580,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAn
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
   const std::map<double,std::vector<double> >& moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the moment preserving elastic weights are valid
   testPrecondition( moment_preserving_elastic_weights.size() ==
                     this->getElasticAngularEnergyGrid().size() );
@@ -1994,6 +2594,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticDiscreteAn
             const double incoming_energy,
             const std::vector<double>& moment_preserving_elastic_discrete_angles )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -2018,6 +2620,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
             const double incoming_energy,
             const std::vector<double>& moment_preserving_elastic_weights )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_angular_energy_grid.front() );
   testPrecondition( incoming_energy <= d_angular_energy_grid.back() );
@@ -2040,6 +2644,8 @@ void ElectronPhotonRelaxationDataContainer::setMomentPreservingElasticWeights(
 void ElectronPhotonRelaxationDataContainer::setMomentPreservingCrossSectionReduction(
     const std::vector<double>& cross_section_reduction )
 {
+  this->loadDataBlock( ELASTIC_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the cross_section_reduction is valid
   testPrecondition( cross_section_reduction.size() ==
                     d_angular_energy_grid.size() );
@@ -2052,6 +2658,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationEnergyGrid(
             const unsigned subshell,
             const std::vector<double>& electroionization_energy_grid )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   testPrecondition( Data::energyGridValid( electroionization_energy_grid ) );
@@ -2063,6 +2671,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setElectroionizationInterpPolicy(
     const std::string& electroionization_interp )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( electroionization_interp ) );
 
@@ -2075,6 +2685,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilEnergyAtIn
             const double incoming_energy,
             const std::vector<double>& electroionization_recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2093,6 +2705,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilPDFAtIncom
             const double incoming_energy,
             const std::vector<double>& electroionization_recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2110,6 +2724,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilEnergy(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_recoil_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2122,6 +2738,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationRecoilPDF(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_recoil_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2135,6 +2753,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingEnergyAt
             const double incoming_energy,
             const std::vector<double>& electroionization_outgoing_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2158,6 +2778,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDFAtInc
             const double incoming_energy,
             const std::vector<double>& electroionization_outgoing_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the incoming energy is valid
@@ -2179,6 +2801,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingEnergy(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_outgoing_energy )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2191,6 +2815,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDF(
     const unsigned subshell,
     const std::map<double,std::vector<double> >& electroionization_outgoing_pdf )
 {
+  this->loadDataBlock( ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
@@ -2202,6 +2828,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationOutgoingPDF(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungEnergyGrid(
                        const std::vector<double>& bremsstrahlung_energy_grid )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( bremsstrahlung_energy_grid ) );
 
@@ -2212,6 +2840,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonInterpPolicy(
     const std::string& bremsstrahlung_photon_interp )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( bremsstrahlung_photon_interp ) );
 
@@ -2223,6 +2853,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergyAtIncom
              const double incoming_energy,
              const std::vector<double>&  bremsstrahlung_photon_energy )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -2238,6 +2870,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDFAtIncoming
              const double incoming_energy,
              const std::vector<double>& bremsstrahlung_photon_pdf )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the incoming_energy is valid
   testPrecondition( incoming_energy >= d_bremsstrahlung_energy_grid.front() );
   testPrecondition( incoming_energy <= d_bremsstrahlung_energy_grid.back() );
@@ -2251,6 +2885,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDFAtIncoming
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergy(
     const std::map<double,std::vector<double> >&  bremsstrahlung_photon_energy )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   d_bremsstrahlung_photon_energy = bremsstrahlung_photon_energy;
 }
 
@@ -2258,6 +2894,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonEnergy(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDF(
     const std::map<double,std::vector<double> >& bremsstrahlung_photon_pdf )
 {
+  this->loadDataBlock( BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK );
+
   d_bremsstrahlung_photon_pdf = bremsstrahlung_photon_pdf;
 }
 
@@ -2265,6 +2903,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungPhotonPDF(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyGrid(
                        const std::vector<double>& atomic_excitation_energy_grid )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( atomic_excitation_energy_grid ) );
 
@@ -2275,6 +2915,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLossInterpPolicy(
     const std::string& atomic_excitation_energy_loss_interp )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the string is valid
   testPrecondition( isInterpPolicyValid( atomic_excitation_energy_loss_interp ) );
 
@@ -2285,6 +2927,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLossInterpP
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLoss(
              const std::vector<double>&  atomic_excitation_energy_loss )
 {
+  this->loadDataBlock( ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK );
+
   // Make sure the atomic excitation energy loss are valid
   testPrecondition( Data::valuesGreaterThanZero( atomic_excitation_energy_loss ) );
 
@@ -2295,6 +2939,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationEnergyLoss(
 void ElectronPhotonRelaxationDataContainer::setElectronEnergyGrid(
                        const std::vector<double>& energy_grid )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the energy grid is valid
   testPrecondition( Data::energyGridValid( energy_grid ) );
 
@@ -2305,6 +2951,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronEnergyGrid(
 void ElectronPhotonRelaxationDataContainer::setElectronCrossSectionInterpPolicy(
     const std::string& electron_cross_section_interp )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the atomic excitation energy loss are valid
   testPrecondition( isInterpPolicyValid( electron_cross_section_interp ) );
 
@@ -2315,6 +2963,8 @@ void ElectronPhotonRelaxationDataContainer::setElectronCrossSectionInterpPolicy(
 void ElectronPhotonRelaxationDataContainer::setTotalElectronCrossSection(
              const std::vector<double>& total_electron_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total electron cross section is valid
   testPrecondition( total_electron_cross_section.size() ==
                     d_electron_energy_grid.size() );
@@ -2327,6 +2977,8 @@ void ElectronPhotonRelaxationDataContainer::setTotalElectronCrossSection(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSection(
              const std::vector<double>& cutoff_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the cutoff elastic cross section is valid
   testPrecondition( cutoff_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2339,6 +2991,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSection(
 void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_cutoff_elastic_cross_section.size() + index ==
@@ -2351,6 +3005,8 @@ void ElectronPhotonRelaxationDataContainer::setCutoffElasticCrossSectionThreshol
 void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSection(
              const std::vector<double>& screened_rutherford_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the screened rutherford elastic cross section is valid
   testPrecondition( screened_rutherford_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2366,6 +3022,8 @@ void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSec
 void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_screened_rutherford_elastic_cross_section.size() + index ==
@@ -2378,6 +3036,8 @@ void ElectronPhotonRelaxationDataContainer::setScreenedRutherfordElasticCrossSec
 void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSection(
              const std::vector<double>& total_elastic_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the total elastic cross section is valid
   testPrecondition( total_elastic_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2390,6 +3050,8 @@ void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSection(
 void ElectronPhotonRelaxationDataContainer::setTotalElasticCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_total_elastic_cross_section.size() + index ==
@@ -2403,6 +3065,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSection(
             const unsigned subshell,
             const std::vector<double>& electroionization_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the electroionization cross section is valid
@@ -2419,6 +3083,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSectionThre
             const unsigned subshell,
             const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the subshell is valid
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
   // Make sure the threshold index is valid
@@ -2433,6 +3099,8 @@ void ElectronPhotonRelaxationDataContainer::setElectroionizationCrossSectionThre
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSection(
              const std::vector<double>& bremsstrahlung_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the bremsstrahlung cross section is valid
   testPrecondition( bremsstrahlung_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2445,6 +3113,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSection(
 void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_bremsstrahlung_cross_section.size() + index ==
@@ -2457,6 +3127,8 @@ void ElectronPhotonRelaxationDataContainer::setBremsstrahlungCrossSectionThresho
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSection(
              const std::vector<double>& atomic_excitation_cross_section )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the atomic excitation cross section is valid
   testPrecondition( atomic_excitation_cross_section.size() <=
                     d_electron_energy_grid.size() );
@@ -2469,6 +3141,8 @@ void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSection(
 void ElectronPhotonRelaxationDataContainer::setAtomicExcitationCrossSectionThresholdEnergyIndex(
                                 const unsigned index )
 {
+  this->loadDataBlock( ELECTRON_CROSS_SECTION_DATA_BLOCK );
+
   // Make sure the threshold index is valid
   testPrecondition(
         d_atomic_excitation_cross_section.size() + index ==
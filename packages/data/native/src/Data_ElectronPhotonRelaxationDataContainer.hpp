@@ -11,6 +11,9 @@
 
 // Std Lib Includes
 #include <string>
+#include <cstdint>
+#include <array>
+#include <atomic>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -28,7 +31,14 @@
 namespace Data{
 
 /*! The electron-photon-relaxation data container
- * \details Linear-linear interpolation should be used for all data.
+ * \details Linear-linear interpolation should be used for all data. When the
+ * container is saved to or loaded from an indexed binary archive (.ibin) the
+ * data is grouped into blocks (see
+ * Data::ElectronPhotonRelaxationDataContainer::DataBlock) that are archived
+ * separately. Only the table data, the subshell data and the block index are
+ * loaded when the container is constructed from an indexed archive - each
+ * data block will be loaded the first time that it is accessed. A photon-only
+ * simulation will therefore never load the electron data blocks.
  */
 class ElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<ElectronPhotonRelaxationDataContainer>
 {
@@ -37,6 +47,21 @@ class ElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<E
 
 public:
 
+  //! The data blocks of an indexed archive
+  enum DataBlock{
+    RELAXATION_DATA_BLOCK = 0,
+    COMPTON_PROFILE_DATA_BLOCK,
+    OCCUPATION_NUMBER_DATA_BLOCK,
+    FORM_FACTOR_DATA_BLOCK,
+    PHOTON_CROSS_SECTION_DATA_BLOCK,
+    ELASTIC_DISTRIBUTION_DATA_BLOCK,
+    ELECTROIONIZATION_DISTRIBUTION_DATA_BLOCK,
+    BREMSSTRAHLUNG_DISTRIBUTION_DATA_BLOCK,
+    ATOMIC_EXCITATION_DISTRIBUTION_DATA_BLOCK,
+    ELECTRON_CROSS_SECTION_DATA_BLOCK,
+    DataBlock_END
+  };
+
   //! Constructor (from saved archive)
   ElectronPhotonRelaxationDataContainer(
                           const boost::filesystem::path& file_name_with_path );
@@ -48,6 +73,9 @@ public:
   //! The database name used in an archive
   const char* getArchiveName() const override;
 
+  //! Check if a data block has been loaded
+  bool isDataBlockLoaded( const DataBlock block ) const;
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
@@ -467,8 +495,7 @@ public:
 protected:
 
   //! Default constructor
-  ElectronPhotonRelaxationDataContainer()
-  { /* ... */ }
+  ElectronPhotonRelaxationDataContainer();
 
   //! Load the archived object (implementation)
   void loadFromFileImpl( const boost::filesystem::path& archive_name_with_path ) final override;
@@ -959,6 +986,34 @@ protected:
 
 private:
 
+  // Load the indexed archive header and data block index
+  void loadFromIndexedArchive(
+                       const boost::filesystem::path& archive_name_with_path );
+
+  // Save the data to an indexed archive
+  void saveToIndexedArchive(
+                 const boost::filesystem::path& archive_name_with_path ) const;
+
+  // Load a data block from the indexed archive (if not already loaded)
+  void loadDataBlock( const DataBlock block ) const;
+
+  // Load all data blocks from the indexed archive
+  void loadAllDataBlocks() const;
+
+  // Set the loaded flag of every data block
+  void setAllDataBlocksLoaded( const bool loaded ) const;
+
+  // Check if every data block has been loaded
+  bool areAllDataBlocksLoaded() const;
+
+  // Serialize the indexed archive header data
+  template<typename Archive>
+  void serializeIndexedArchiveHeader( Archive& ar );
+
+  // Serialize a data block
+  template<typename Archive>
+  void serializeDataBlock( Archive& ar, const DataBlock block );
+
   // Save the data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -975,6 +1030,24 @@ private:
   // The name used in archive name-value pairs
   static const std::string s_archive_name;
 
+  // The indexed archive extension
+  static const std::string s_indexed_archive_extension;
+
+//---------------------------------------------------------------------------//
+// INDEXED ARCHIVE DATA
+//---------------------------------------------------------------------------//
+
+  // The indexed archive that the data blocks will be loaded from (empty
+  // if all data has been loaded)
+  mutable boost::filesystem::path d_indexed_archive_name;
+
+  // The offset of each data block in the indexed archive
+  mutable std::vector<uint64_t> d_data_block_offsets;
+
+  // Records if each data block has been loaded (the flags are atomic so that
+  // loaded data blocks can be accessed without entering a critical section)
+  mutable std::array<std::atomic<bool>,DataBlock_END> d_data_block_loaded;
+
 //---------------------------------------------------------------------------//
 // NOTES
 //---------------------------------------------------------------------------//
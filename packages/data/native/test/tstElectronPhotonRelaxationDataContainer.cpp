@@ -2171,6 +2171,102 @@ FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
                        0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be exported to and lazily imported from an indexed
+// archive
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   export_importData_indexed )
+{
+  const std::string test_indexed_file_name( "test_epr_data_container.ibin" );
+
+  epr_data_container.saveToFile( test_indexed_file_name, true );
+
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_indexed_file_name );
+
+  // Only the header data is loaded with the container
+  for( unsigned i = 0; i < Data::ElectronPhotonRelaxationDataContainer::DataBlock_END; ++i )
+  {
+    FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( (Data::ElectronPhotonRelaxationDataContainer::DataBlock)i ) );
+  }
+
+  // Table Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(), notes );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMinPhotonEnergy(), 0.001 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxPhotonEnergy(), 20.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMinElectronEnergy(), 1.0e-5 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxElectronEnergy(), 1.0e5 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffAngleCosine(),
+                       0.9 );
+  FRENSIE_CHECK( epr_data_container_copy.getSubshells().count( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellOccupancy( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellBindingEnergy( 1 ),
+                       1.361e-5 );
+
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::RELAXATION_DATA_BLOCK ) );
+
+  // Relaxation Tests
+  FRENSIE_CHECK( epr_data_container_copy.hasRelaxationData() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationTransitions(1),
+                       1 );
+
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::RELAXATION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::COMPTON_PROFILE_DATA_BLOCK ) );
+
+  // Photon Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfile( 1 ),
+                       epr_data_container.getComptonProfile( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::COMPTON_PROFILE_DATA_BLOCK ) );
+  FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::PHOTON_CROSS_SECTION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::ELASTIC_DISTRIBUTION_DATA_BLOCK ) );
+  FRENSIE_CHECK( !epr_data_container_copy.isDataBlockLoaded( Data::ElectronPhotonRelaxationDataContainer::ELECTRON_CROSS_SECTION_DATA_BLOCK ) );
+
+  // Repeated accesses return the loaded data
+  FRENSIE_CHECK_EQUAL( &epr_data_container_copy.getPhotonEnergyGrid(),
+                       &epr_data_container_copy.getPhotonEnergyGrid() );
+
+  // Electron Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronTwoDInterpPolicy(),
+                       epr_data_container.getElectronTwoDInterpPolicy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffElasticAngles(),
+                       epr_data_container.getCutoffElasticAngles() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronEnergyGrid(),
+                       epr_data_container.getElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationCrossSectionThresholdEnergyIndex(),
+                       0 );
+
+  // A lazily loaded container can be exported
+  const std::string test_ascii_file_name( "test_epr_data_container_from_indexed.txt" );
+
+  epr_data_container_copy.saveToFile( test_ascii_file_name, true );
+
+  for( unsigned i = 0; i < Data::ElectronPhotonRelaxationDataContainer::DataBlock_END; ++i )
+  {
+    FRENSIE_CHECK( epr_data_container_copy.isDataBlockLoaded( (Data::ElectronPhotonRelaxationDataContainer::DataBlock)i ) );
+  }
+
+  // The data can still be accessed once the indexed archive is released
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_copy_2( test_ascii_file_name );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getOccupationNumber( 1 ),
+                       epr_data_container.getOccupationNumber( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy_2.getElectroionizationRecoilEnergy( 1 ),
+                       epr_data_container.getElectroionizationRecoilEnergy( 1 ) );
+}
+
 //---------------------------------------------------------------------------//
 // end tstElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
@@ -11,11 +11,13 @@
 
 // Std Lib Includes
 #include <algorithm>
+#include <utility>
 
 // FRENSIE Includes
 #include "Utility_GaussKronrodIntegrator.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace DataGen{
@@ -428,20 +430,36 @@ void AdjointElectronGridGenerator<TwoDInterpPolicy>::generateAndEvaluateDistribu
   testPrecondition( threshold_index >= 0 );
   testPrecondition( adjoint_cross_sections.size() + threshold_index == primary_energy_grid.size() );
 
+  // Create the map entries up front - the maps can't be modified by multiple
+  // threads but the entries can
+  std::vector<std::pair<unsigned,double> > incoming_energies;
+  std::vector<std::vector<double>*> outgoing_energy_grids;
+  std::vector<std::vector<double>*> evaluated_pdfs;
+
   for( unsigned i = 0; i < adjoint_cross_sections.size(); ++i )
   {
     double incoming_energy = primary_energy_grid[i + threshold_index];
 
     if( this->getNudgedMinEnergy( incoming_energy ) < this->getMaxOutgoingEnergy() )
     {
-      this->generateAndEvaluateDistribution(
-              outgoing_energy_grid[incoming_energy],
-              evaluated_pdf[incoming_energy],
-              evaluation_tol,
-              incoming_energy,
-              adjoint_cross_sections[i] );
+      incoming_energies.push_back( std::make_pair( i, incoming_energy ) );
+      outgoing_energy_grids.push_back( &outgoing_energy_grid[incoming_energy] );
+      evaluated_pdfs.push_back( &evaluated_pdf[incoming_energy] );
     }
   }
+
+  // The distributions at each incoming energy are independent so they are
+  // distributed between the threads
+  Utility::OpenMPProperties::parallelFor( incoming_energies.size(),
+                                          [&]( const size_t j )
+  {
+    this->generateAndEvaluateDistribution(
+              *outgoing_energy_grids[j],
+              *evaluated_pdfs[j],
+              evaluation_tol,
+              incoming_energies[j].second,
+              adjoint_cross_sections[incoming_energies[j].first] );
+  } );
 }
 
 // Initialize the secondary energy grid at an energy grid point
@@ -94,6 +94,11 @@ AdjointElectronPhotonRelaxationDataGenerator::AdjointElectronPhotonRelaxationDat
   // Have the default grid generators throw exception on dirty convergence
   d_default_photon_grid_generator->throwExceptionOnDirtyConvergence();
   d_default_electron_grid_generator->throwExceptionOnDirtyConvergence();
+
+  // Evaluate the candidate grid points in parallel (the grids are identical
+  // to the serial grids)
+  d_default_photon_grid_generator->setParallelRefinementModeOn();
+  d_default_electron_grid_generator->setParallelRefinementModeOn();
 }
 
 // Constructor (existing data container)
@@ -116,6 +121,11 @@ AdjointElectronPhotonRelaxationDataGenerator::AdjointElectronPhotonRelaxationDat
   // Have the default grid generators throw exception on dirty convergence
   d_default_photon_grid_generator->throwExceptionOnDirtyConvergence();
   d_default_electron_grid_generator->throwExceptionOnDirtyConvergence();
+
+  // Evaluate the candidate grid points in parallel (the grids are identical
+  // to the serial grids)
+  d_default_photon_grid_generator->setParallelRefinementModeOn();
+  d_default_electron_grid_generator->setParallelRefinementModeOn();
 }
 
 // Set the table notes
@@ -79,6 +79,11 @@ ElectronPhotonRelaxationDataGenerator::ElectronPhotonRelaxationDataGenerator(
   // Have the default grid generators throw exception on dirty convergence
   d_default_photon_grid_generator->throwExceptionOnDirtyConvergence();
   d_default_electron_grid_generator->throwExceptionOnDirtyConvergence();
+
+  // Evaluate the candidate grid points in parallel (the grids are identical
+  // to the serial grids)
+  d_default_photon_grid_generator->setParallelRefinementModeOn();
+  d_default_electron_grid_generator->setParallelRefinementModeOn();
 }
 
 // Constructor (existing data container)
@@ -99,6 +104,11 @@ ElectronPhotonRelaxationDataGenerator::ElectronPhotonRelaxationDataGenerator(
   // Have the default grid generators throw exception on dirty convergence
   d_default_photon_grid_generator->throwExceptionOnDirtyConvergence();
   d_default_electron_grid_generator->throwExceptionOnDirtyConvergence();
+
+  // Evaluate the candidate grid points in parallel (the grids are identical
+  // to the serial grids)
+  d_default_photon_grid_generator->setParallelRefinementModeOn();
+  d_default_electron_grid_generator->setParallelRefinementModeOn();
 }
 
 // Get the atomic number
@@ -34,6 +34,7 @@
 #include "Utility_TabularDistribution.hpp"
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_GridGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_SloanRadauQuadrature.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_StaticOutputFormatter.hpp"
@@ -994,6 +995,9 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
   // Throw an exception if dirty convergence occurs
   grid_generator.throwExceptionOnDirtyConvergence();
 
+  // Evaluate the candidate secondary grid points in parallel
+  grid_generator.setParallelSecondaryRefinementModeOn();
+
   std::function<double(double,double)> cs_evaluation_wrapper =
     grid_generator.createCrossSectionEvaluator(
                 cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
@@ -1039,6 +1043,9 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
     // Throw an exception if dirty convergence occurs
     grid_generator.throwExceptionOnDirtyConvergence();
 
+    // Evaluate the candidate secondary grid points in parallel
+    grid_generator.setParallelSecondaryRefinementModeOn();
+
     std::function<double(double,double)> cs_evaluation_wrapper =
       grid_generator.createCrossSectionEvaluator(
                 cs_evaluator,  this->getAdjointIncoherentEvaluationTolerance() );
@@ -1103,6 +1110,9 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateAdjointPhotonUn
     // Throw an exception if dirty convergence occurs
     grid_generator.throwExceptionOnDirtyConvergence();
 
+    // Evaluate the candidate secondary grid points in parallel
+    grid_generator.setParallelSecondaryRefinementModeOn();
+
     std::function<double(double,double)> cs_evaluation_wrapper =
       grid_generator.createCrossSectionEvaluator(
                 cs_evaluator,  this->getAdjointIncoherentEvaluationTolerance() );
@@ -1174,39 +1184,30 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                            cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
+  // Evaluate the cross section at every energy grid point (the energy grid
+  // points are independent so they are distributed between the threads)
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-  while( energy_grid_it != union_energy_grid.end() )
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() > *energy_grid_it )
+    if( max_energy_grid[i].front() > energy_grid[i] )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert( max_energy_grid_it->begin(),
-                                  *energy_grid_it );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert( max_energy_grid[i].begin(), energy_grid[i] );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1249,40 +1250,32 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
   // Evaluate the cross section at every energy grid point at or above the
-  // threshold energy
-  std::list<double>::const_iterator energy_grid_it = start;
+  // threshold energy (the energy grid points are independent so they are
+  // distributed between the threads)
+  const std::vector<double> energy_grid( start, union_energy_grid.end() );
 
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
+    if( max_energy_grid[i].front() >
+        energy_grid[i] + cs_evaluator->getSubshellBindingEnergy() )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert(
+                      max_energy_grid[i].begin(),
+                      energy_grid[i] + cs_evaluator->getSubshellBindingEnergy() );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1312,41 +1305,33 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
+  // Evaluate the cross section at every energy grid point (the energy grid
+  // points are independent so they are distributed between the threads)
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-  while( energy_grid_it != union_energy_grid.end() )
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
+    if( max_energy_grid[i].front() >
+        energy_grid[i] + cs_evaluator->getSubshellBindingEnergy() )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert(
+                      max_energy_grid[i].begin(),
+                      energy_grid[i] + cs_evaluator->getSubshellBindingEnergy() );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1355,22 +1340,18 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
           const std::shared_ptr<const Utility::UnivariateDistribution>& cs_evaluator,
           std::vector<double>& cross_section ) const
 {
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
+
   // Resize the cross section array
-  cross_section.resize( union_energy_grid.size() );
+  cross_section.resize( energy_grid.size() );
 
   // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<double>::iterator cross_section_it = cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    *cross_section_it = cs_evaluator->evaluate( *energy_grid_it );
-
-    ++energy_grid_it;
-    ++cross_section_it;
-  }
+    cross_section[i] = cs_evaluator->evaluate( energy_grid[i] );
+  } );
 }
 
 // Calculate the total incoherent adjoint cross section
@@ -1387,16 +1368,16 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointImpul
   std::vector<std::vector<double> > max_energy_grid( energy_grid.size() );
   std::vector<std::vector<double> > cross_section( energy_grid.size() );
 
-  // The max_energy_grid at an energy
-  std::list<double> local_max_energy_grid;
-
   // Get the subshells
   const std::set<unsigned>& subshells = data_container.getSubshells();
 
-  // Generate the max energy grid at each energy grid point
-  for( unsigned i = 0u; i < energy_grid.size(); ++i )
+  // Generate the max energy grid at each energy grid point (the energy grid
+  // points are independent so they are distributed between the threads)
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    local_max_energy_grid.clear();
+    // The max_energy_grid at this energy
+    std::list<double> local_max_energy_grid;
 
     std::set<unsigned>::const_iterator subshell = subshells.begin();
 
@@ -1445,7 +1426,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointImpul
 
       ++subshell;
     }
-  }
+  } );
 
   // Set the adjoint impulse approx total incoherent cross section
   data_container.setAdjointImpulseApproxIncoherentMaxEnergyGrid(
@@ -1471,16 +1452,16 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointDoppl
   std::vector<std::vector<double> > max_energy_grid( energy_grid.size() );
   std::vector<std::vector<double> > cross_section( energy_grid.size() );
 
-  // The max_energy_grid at an energy
-  std::list<double> local_max_energy_grid;
-
   // Get the subshells
   const std::set<unsigned>& subshells = data_container.getSubshells();
 
-  // Generate the max energy grid at each energy grid point
-  for( unsigned i = 0u; i < energy_grid.size(); ++i )
+  // Generate the max energy grid at each energy grid point (the energy grid
+  // points are independent so they are distributed between the threads)
+  Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                          [&]( const size_t i )
   {
-    local_max_energy_grid.clear();
+    // The max_energy_grid at this energy
+    std::list<double> local_max_energy_grid;
 
     std::set<unsigned>::const_iterator subshell = subshells.begin();
 
@@ -1519,7 +1500,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointDoppl
 
       ++subshell;
     }
-  }
+  } );
 
   // Set the adjoint Doppler broadened impulse approx total incoherent cross section
   data_container.setAdjointDopplerBroadenedImpulseApproxIncoherentMaxEnergyGrid(
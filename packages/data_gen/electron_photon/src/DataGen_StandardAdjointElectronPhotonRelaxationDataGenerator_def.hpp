@@ -9,6 +9,12 @@
 #ifndef DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 #define DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 
+// Std Lib Includes
+#include <utility>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+
 namespace DataGen{
 
 // Create the cross section on the union energy grid
@@ -22,20 +28,19 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
    std::vector<double>& cross_section,
    unsigned& threshold_index ) const
 {
-   std::vector<double> raw_cross_section( union_energy_grid.size() );
+   const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                          union_energy_grid.end() );
 
-   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
+   std::vector<double> raw_cross_section( energy_grid.size() );
 
-   unsigned index = 0u;
-
-   while( energy_grid_pt != union_energy_grid.end() )
+   // The energy grid points are independent so they are distributed between
+   // the threads
+   Utility::OpenMPProperties::parallelFor( energy_grid.size(),
+                                           [&]( const size_t index )
    {
      raw_cross_section[index] =
-       adjoint_cross_section_functor( *energy_grid_pt );
-
-     ++energy_grid_pt;
-     ++index;
-   }
+       adjoint_cross_section_functor( energy_grid[index] );
+   } );
 
    std::vector<double>::iterator start =
      std::find_if( raw_cross_section.begin(),
@@ -63,6 +68,9 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
 {
   std::vector<double> raw_cross_section( union_energy_grid.size() );
 
+  // The energy grid points that are not in the old union energy grid
+  std::vector<std::pair<unsigned,double> > new_energy_grid_points;
+
   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
   std::list<double>::const_iterator old_energy_grid_pt =
     old_union_energy_grid.begin();
@@ -72,7 +80,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
 
   while( energy_grid_pt != union_energy_grid.end() )
   {
-    if ( *energy_grid_pt == *old_energy_grid_pt )
+    if ( old_energy_grid_pt != old_union_energy_grid.end() &&
+         *energy_grid_pt == *old_energy_grid_pt )
     {
       raw_cross_section[index] = old_cross_section[old_index];
    
@@ -81,14 +90,23 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
     }
     else
     {
-      raw_cross_section[index] =
-        adjoint_cross_section_functor( *energy_grid_pt );
+      new_energy_grid_points.push_back(
+                                    std::make_pair( index, *energy_grid_pt ) );
     }
 
     ++energy_grid_pt;
     ++index;
   }
 
+  // Evaluate the cross section at the new energy grid points (the points are
+  // independent so they are distributed between the threads)
+  Utility::OpenMPProperties::parallelFor( new_energy_grid_points.size(),
+                                          [&]( const size_t i )
+  {
+    raw_cross_section[new_energy_grid_points[i].first] =
+      adjoint_cross_section_functor( new_energy_grid_points[i].second );
+  } );
+
   std::vector<double>::iterator start =
     std::find_if( raw_cross_section.begin(),
                   raw_cross_section.end(),
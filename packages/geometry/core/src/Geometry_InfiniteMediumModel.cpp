@@ -85,6 +85,21 @@ bool InfiniteMediumModel::doesCellExist( const EntityId cell ) const
     return false;
 }
 
+// Get the number of cells
+size_t InfiniteMediumModel::getNumberOfCells() const
+{
+  return 1;
+}
+
+// Get the cell index
+size_t InfiniteMediumModel::getCellIndex( const EntityId cell ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell ) );
+
+  return 0;
+}
+
 // Check if the cell is a termination cell
 /*! \details An infinite medium has no termination cell.
  */
@@ -168,6 +168,12 @@ auto InfiniteMediumNavigator::getCurrentCell() const -> EntityId
   return d_cell;
 }
 
+// Get the index of the cell that contains the internal ray
+size_t InfiniteMediumNavigator::getCurrentCellIndex() const
+{
+  return 0;
+}
+
 // Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
 //! \details An infinite medium has no surface.
 auto InfiniteMediumNavigator::getDistanceToClosestBoundary() -> Length
@@ -85,6 +85,9 @@ public:
   //! Get the cell that contains the internal ray
   EntityId getCurrentCell() const override;
 
+  //! Get the index of the cell that contains the internal ray
+  size_t getCurrentCellIndex() const override;
+
   //! Get the distance from the internal ray pos. to the nearest boundary in all directions
   Length getDistanceToClosestBoundary() override;
 
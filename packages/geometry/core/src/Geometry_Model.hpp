@@ -131,6 +131,18 @@ public:
   //! Check if a cell exists
   virtual bool doesCellExist( const EntityId cell ) const = 0;
 
+  //! Get the number of cells
+  virtual size_t getNumberOfCells() const = 0;
+
+  /*! Get the (dense) index of a cell
+   *
+   * The cells of a model are numbered from zero to the number of cells minus
+   * one so that per-cell data can be stored in arrays instead of maps. The
+   * index of the cell that contains a navigator's internal ray can be
+   * retrieved directly (see Geometry::Navigator::getCurrentCellIndex).
+   */
+  virtual size_t getCellIndex( const EntityId cell ) const = 0;
+
   //! Check if the cell is a termination cell
   virtual bool isTerminationCell( const EntityId cell ) const = 0;
 
@@ -140,6 +152,23 @@ public:
   //! Get the cell volume
   virtual Volume getCellVolume( const EntityId cell ) const = 0;
 
+  /*! Get the number of instances of a cell
+   *
+   * Models that support repeated structures can place a cell more than once.
+   * The instances of a cell are numbered from zero (see
+   * Geometry::Navigator::getCurrentCellInstance).
+   */
+  virtual size_t getNumberOfCellInstances( const EntityId cell ) const;
+
+  /*! Get the bounding box of a cell
+   *
+   * The bounds are given in the global coordinate system. False will be
+   * returned if the model cannot provide a finite bounding box for the cell.
+   */
+  virtual bool getCellBoundingBox( const EntityId cell,
+                                   Length lower_bounds[3],
+                                   Length upper_bounds[3] ) const;
+
   //! The invalid cell id
   static EntityId invalidCellId();
 
@@ -196,6 +225,20 @@ inline bool Model::isAdvanced() const
   return false;
 }
 
+// Get the number of instances of a cell
+inline size_t Model::getNumberOfCellInstances( const EntityId ) const
+{
+  return 1;
+}
+
+// Get the bounding box of a cell
+inline bool Model::getCellBoundingBox( const EntityId,
+                                       Length[3],
+                                       Length[3] ) const
+{
+  return false;
+}
+
 // Create a raw, heap-allocated navigator
 inline Geometry::Navigator* Model::createNavigatorAdvanced() const
 {
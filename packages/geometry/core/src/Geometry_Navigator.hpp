@@ -217,6 +217,22 @@ public:
    */
   virtual EntityId getCurrentCell() const = 0;
 
+  /*! Get the index of the cell that contains the internal ray
+   *
+   * This is the dense index of the current cell (see
+   * Geometry::Model::getCellIndex).
+   */
+  virtual size_t getCurrentCellIndex() const = 0;
+
+  /*! Get the instance of the cell that contains the internal ray
+   *
+   * Models that support repeated structures can place a cell more than once.
+   * The instance can be used to resolve per instance data (e.g. tallies or
+   * materials). Models that don't support repeated structures will always
+   * return zero.
+   */
+  virtual size_t getCurrentCellInstance() const;
+
   /*! Get the distance from the internal ray pos. to the nearest boundary in all directions
    *
    * A std::runtime_error (or class derived from it) must be thrown if a ray
@@ -382,6 +398,12 @@ inline void Navigator::setState( const Ray& ray,
   this->setState( ray.getPosition(), ray.getDirection() );
 }
 
+// Get the instance of the cell that contains the internal ray
+inline size_t Navigator::getCurrentCellInstance() const
+{
+  return 0;
+}
+
 // Fire the internal ray through the geometry
 inline auto Navigator::fireRay( EntityId& surface_hit ) -> Length
 {
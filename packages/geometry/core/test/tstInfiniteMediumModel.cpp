@@ -155,6 +155,16 @@ FRENSIE_UNIT_TEST( InfiniteMediumModel, doesCellExist )
   FRENSIE_CHECK( !model.doesCellExist( 3 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cell indices can be returned
+FRENSIE_UNIT_TEST( InfiniteMediumModel, getCellIndex )
+{
+  Geometry::InfiniteMediumModel model( 2 );
+
+  FRENSIE_CHECK_EQUAL( model.getNumberOfCells(), 1 );
+  FRENSIE_CHECK_EQUAL( model.getCellIndex( 2 ), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check if the cell is a termination cell
 FRENSIE_UNIT_TEST( InfiniteMediumModel, isTerminationCell )
@@ -169,6 +169,7 @@ FRENSIE_UNIT_TEST( InfiniteMediumNavigator, setState )
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 0.0 );
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 1.0 );
   FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(), 0 );
 
   navigator->setState(
                    Utility::QuantityTraits<Geometry::Navigator::Length>::max(),
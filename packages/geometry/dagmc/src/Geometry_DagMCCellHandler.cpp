@@ -53,6 +53,13 @@ size_t DagMCCellHandler::getNumberOfCells() const
   return this->getNumberOfEntities();
 }
 
+// Get the cell index from a cell handle
+size_t DagMCCellHandler::getCellIndex(
+                                  const moab::EntityHandle cell_handle ) const
+{
+  return this->getEntityIndex( cell_handle );
+}
+
 // Check if the cell handle exists
 bool DagMCCellHandler::doesCellHandleExist(
                                   const moab::EntityHandle cell_handle ) const
@@ -37,6 +37,9 @@ public:
   //! Get the number of cells
   size_t getNumberOfCells() const;
 
+  //! Get the cell index from a cell handle
+  size_t getCellIndex( const moab::EntityHandle cell_handle ) const;
+
   //! Check if the cell exists
   virtual bool doesCellExist( const EntityId cell_id ) const = 0;
 
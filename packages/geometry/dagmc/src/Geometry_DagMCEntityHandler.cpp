@@ -47,6 +47,18 @@ bool DagMCEntityHandler::doesEntityHandleExist(
   return d_entities.find( entity_handle ) != d_entities.end();
 }
 
+// Get the index of an entity
+/*! \details The index is the position of the entity in the entity range.
+ */
+size_t DagMCEntityHandler::getEntityIndex(
+                                 const moab::EntityHandle entity_handle ) const
+{
+  // Make sure that the entity exists
+  testPrecondition( this->doesEntityHandleExist( entity_handle ) );
+
+  return d_entities.index( entity_handle );
+}
+
 // Get the beginning const iterator
 moab::Range::const_iterator DagMCEntityHandler::begin() const
 {
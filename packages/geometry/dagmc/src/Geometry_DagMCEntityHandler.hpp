@@ -47,6 +47,9 @@ protected:
   //! Check if the entity exists
   bool doesEntityHandleExist( const moab::EntityHandle entity_handle ) const;
 
+  //! Get the index of an entity
+  size_t getEntityIndex( const moab::EntityHandle entity_handle ) const;
+
 private:
 
   // The entities
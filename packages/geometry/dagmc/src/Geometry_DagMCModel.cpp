@@ -642,6 +642,24 @@ bool DagMCModel::doesCellExist( const EntityId cell_id ) const
   return d_cell_handler->doesCellExist( cell_id );
 }
 
+// Get the number of cells
+size_t DagMCModel::getNumberOfCells() const
+{
+  return d_cell_handler->getNumberOfCells();
+}
+
+// Get the cell index
+/*! \details The cell index is the position of the cell in the DagMC volume
+ * range.
+ */
+size_t DagMCModel::getCellIndex( const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return d_cell_handler->getCellIndex( d_cell_handler->getCellHandle( cell_id ) );
+}
+
 // Check if the surface exists
 bool DagMCModel::doesSurfaceExist( const EntityId surface_id ) const
 {
@@ -673,6 +691,37 @@ auto DagMCModel::getCellVolume( const EntityId cell_id ) const -> Volume
   return Volume::from_value(raw_volume);
 }
 
+// Get the bounding box of a cell
+/*! \details The axis-aligned box that encloses the oriented bounding box of
+ * the cell will be returned. False will be returned if the box cannot be
+ * calculated (e.g. the implicit complement).
+ */
+bool DagMCModel::getCellBoundingBox( const EntityId cell_id,
+                                     Length lower_bounds[3],
+                                     Length upper_bounds[3] ) const
+{
+  // Make sure the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  moab::EntityHandle cell_handle = d_cell_handler->getCellHandle( cell_id );
+
+  double raw_lower_bounds[3], raw_upper_bounds[3];
+
+  moab::ErrorCode return_value =
+    d_dagmc->getobb( cell_handle, raw_lower_bounds, raw_upper_bounds );
+
+  if( return_value != moab::MB_SUCCESS )
+    return false;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    lower_bounds[i] = Length::from_value( raw_lower_bounds[i] );
+    upper_bounds[i] = Length::from_value( raw_upper_bounds[i] );
+  }
+
+  return true;
+}
+
 // Get the surface area
 auto DagMCModel::getSurfaceArea( const EntityId surface_id ) const -> Area
 {
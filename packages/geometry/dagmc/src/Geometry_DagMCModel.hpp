@@ -83,6 +83,12 @@ public:
   //! Check if a cell exists
   bool doesCellExist( const EntityId cell_id ) const override;
 
+  //! Get the number of cells
+  size_t getNumberOfCells() const override;
+
+  //! Get the cell index
+  size_t getCellIndex( const EntityId cell_id ) const override;
+
   //! Check if the cell is a termination cell
   bool isTerminationCell( const EntityId cell_id ) const override;
 
@@ -92,6 +98,11 @@ public:
   //! Get the cell volume
   Volume getCellVolume( const EntityId cell_id ) const override;
 
+  //! Get the bounding box of a cell
+  bool getCellBoundingBox( const EntityId cell_id,
+                           Length lower_bounds[3],
+                           Length upper_bounds[3] ) const override;
+
   //! Get the problem surfaces
   void getSurfaces( SurfaceIdSet& surface_set ) const override;
 
@@ -48,6 +48,36 @@ DagMCNavigator::DagMCNavigator( const DagMCNavigator& other )
     d_internal_ray( other.d_internal_ray )
 { /* ... */ }
 
+// Copy constructor (with new callback)
+/*! \details This constructor should only be used by the clone method. The
+ * internal ray, including its history and intersection data, will be copied
+ * so that the new navigator can continue from the exact state of the
+ * other navigator without any additional ray tracing.
+ */
+DagMCNavigator::DagMCNavigator(
+          const DagMCNavigator& other,
+          const AdvanceCompleteCallback& advance_complete_callback )
+  : Navigator( advance_complete_callback ),
+    d_dagmc_model( other.d_dagmc_model ),
+    d_internal_ray( other.d_internal_ray )
+{ /* ... */ }
+
+// Get the cell location cache of the calling thread
+/*! \details The cache stores the cells that have been entered from each
+ * cell (and the boundary surface that was crossed) and the last cell that
+ * was located by the thread. Because it is owned by the thread, and not
+ * by a navigator, it is shared by all of the navigators that are used by
+ * a thread (e.g. the navigators of secondary particles). Since the
+ * DagMCModel is a singleton the cached handles are always valid. The cache
+ * size is bounded by the number of surfaces in the model.
+ */
+auto DagMCNavigator::getCellLocationCache() -> CellLocationCache&
+{
+  thread_local CellLocationCache cell_location_cache = {{}, 0};
+
+  return cell_location_cache;
+}
+
 // Get the point location w.r.t. a given cell
 /*! \details This function will only return if a point is inside of or
  * outside of the cell of interest (not on the cell). The ray direction will be
@@ -269,6 +299,15 @@ auto DagMCNavigator::getCurrentCell() const -> EntityId
   return d_dagmc_model->getCellHandler().getCellId( d_internal_ray.getCurrentCell() );
 }
 
+// Get the index of the cell containing the internal DagMC ray position
+size_t DagMCNavigator::getCurrentCellIndex() const
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_dagmc_model->getCellHandler().getCellIndex( d_internal_ray.getCurrentCell() );
+}
+
 // Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
 auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
 {
@@ -519,10 +558,25 @@ PointLocation DagMCNavigator::getPointLocationWithCellHandle(
 }
 
 // Get the boundary cell handle
+/*! \details The cell adjacency cache of the calling thread will be checked
+ * before querying DagMC. Both directions of a crossing will be added to
+ * the cache.
+ */
 moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
                        const moab::EntityHandle cell_handle,
                        const moab::EntityHandle boundary_surface_handle ) const
 {
+  CellLocationCache& cell_location_cache = this->getCellLocationCache();
+
+  CellAdjacencyList& adjacent_cells =
+    cell_location_cache.adjacent_cells[cell_handle];
+
+  for( size_t i = 0; i < adjacent_cells.size(); ++i )
+  {
+    if( adjacent_cells[i].first == boundary_surface_handle )
+      return adjacent_cells[i].second;
+  }
+
   moab::EntityHandle boundary_cell_handle;
 
   moab::ErrorCode return_value =
@@ -543,10 +597,24 @@ moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
                "  Boundary Surface: "
                << d_dagmc_model->getSurfaceHandler().getSurfaceId( boundary_surface_handle ) );
 
+  // Cache the crossing in both directions
+  adjacent_cells.push_back( std::make_pair( boundary_surface_handle,
+                                            boundary_cell_handle ) );
+
+  cell_location_cache.adjacent_cells[boundary_cell_handle].push_back(
+                      std::make_pair( boundary_surface_handle, cell_handle ) );
+
   return boundary_cell_handle;
 }
 
 // Find the cell handle that contains the ray
+/*! \details The search will start with the current cell (or the last cell
+ * located by the calling thread if the internal ray has not been set) and
+ * the cells that have been entered from it. All other cells will only be
+ * checked if the ray is not in any of these cells. This avoids most of
+ * the point in volume queries (and OBB-tree traversals) when locating
+ * source particles and collision-born secondaries.
+ */
 moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
                                            const Length position[3],
                                            const double direction[3],
@@ -555,6 +623,94 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
   // Make sure that the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
 
+  CellLocationCache& cell_location_cache = this->getCellLocationCache();
+
+  moab::EntityHandle start_cell_handle;
+
+  if( this->isStateSet() )
+    start_cell_handle = d_internal_ray.getCurrentCell();
+  else
+    start_cell_handle = cell_location_cache.last_located_cell_handle;
+
+  moab::EntityHandle cell_handle = 0;
+
+  if( start_cell_handle != 0 )
+  {
+    cell_handle = this->findCellHandleContainingRayNearCell( position,
+                                                             direction,
+                                                             start_cell_handle );
+  }
+
+  if( cell_handle == 0 )
+    cell_handle = this->findCellHandleContainingRayGlobally( position, direction );
+
+  cell_location_cache.last_located_cell_handle = cell_handle;
+
+  if( check_on_boundary )
+  {
+    moab::EntityHandle surface_hit_handle;
+
+    Length distance_to_boundary = this->fireRayWithCellHandle(
+                                                          position,
+                                                          direction,
+                                                          cell_handle,
+                                                          surface_hit_handle );
+
+    // Return the next cell instead
+    if( distance_to_boundary.value() < s_boundary_tol )
+    {
+      cell_handle = this->getBoundaryCellHandle( cell_handle,
+                                                 surface_hit_handle );
+    }
+  }
+
+  return cell_handle;
+}
+
+// Find the cell handle that contains the ray (search start cell neighbors)
+/*! \details Only the start cell and the cells that have been entered from
+ * it (according to the cell adjacency cache of the calling thread) will be
+ * checked. If the ray is not in any of these cells 0 will be returned.
+ */
+moab::EntityHandle DagMCNavigator::findCellHandleContainingRayNearCell(
+                            const Length position[3],
+                            const double direction[3],
+                            const moab::EntityHandle start_cell_handle ) const
+{
+  if( this->getPointLocationWithCellHandle( position,
+                                            direction,
+                                            start_cell_handle ) ==
+      POINT_INSIDE_CELL )
+    return start_cell_handle;
+
+  const CellLocationCache& cell_location_cache = this->getCellLocationCache();
+
+  std::unordered_map<moab::EntityHandle,CellAdjacencyList>::const_iterator
+    adjacent_cells_it =
+    cell_location_cache.adjacent_cells.find( start_cell_handle );
+
+  if( adjacent_cells_it != cell_location_cache.adjacent_cells.end() )
+  {
+    const CellAdjacencyList& adjacent_cells = adjacent_cells_it->second;
+
+    for( size_t i = 0; i < adjacent_cells.size(); ++i )
+    {
+      if( this->getPointLocationWithCellHandle( position,
+                                                direction,
+                                                adjacent_cells[i].second ) ==
+          POINT_INSIDE_CELL )
+        return adjacent_cells[i].second;
+    }
+  }
+
+  return 0;
+}
+
+// Find the cell handle that contains the ray (search all cells)
+moab::EntityHandle DagMCNavigator::findCellHandleContainingRayGlobally(
+                                            const Length position[3],
+                                            const double direction[3] ) const
+{
   moab::EntityHandle cell_handle = 0;
 
   // Test all of the cells
@@ -600,24 +756,6 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
                       "  Direction: "
                       << this->arrayToString( direction ) );
 
-  if( check_on_boundary )
-  {
-    moab::EntityHandle surface_hit_handle;
-
-    Length distance_to_boundary = this->fireRayWithCellHandle(
-                                                          position,
-                                                          direction,
-                                                          cell_handle,
-                                                          surface_hit_handle );
-
-    // Return the next cell instead
-    if( distance_to_boundary.value() < s_boundary_tol )
-    {
-      cell_handle = this->getBoundaryCellHandle( cell_handle,
-                                                 surface_hit_handle );
-    }
-  }
-
   return cell_handle;
 }
 
@@ -721,19 +859,14 @@ void DagMCNavigator::setStateWithCellHandle(
   Navigator::fireRay();
 }
 
-//! Clone the navigator
+// Clone the navigator
+/*! \details The internal ray (including the ray history) will be copied so
+ * that the clone (e.g. the navigator of a secondary particle) inherits the
+ * state of this navigator without having to locate the ray or fire it again.
+ */
 DagMCNavigator* DagMCNavigator::clone( const AdvanceCompleteCallback& advance_complete_callback ) const
 {
-  // Copy the geometry data
-  DagMCNavigator* clone = new DagMCNavigator( d_dagmc_model,
-                                              advance_complete_callback );
-
-  // Copy the current position and direction
-  clone->setState( this->getPosition(),
-                   this->getDirection(),
-                   this->getCurrentCell() );
-
-  return clone;
+  return new DagMCNavigator( *this, advance_complete_callback );
 }
 
 // Clone the navigator
@@ -9,6 +9,10 @@
 #ifndef GEOMETRY_DAGMC_NAVIGATOR_HPP
 #define GEOMETRY_DAGMC_NAVIGATOR_HPP
 
+// Std Lib Includes
+#include <unordered_map>
+#include <vector>
+
 // Boost Includes
 #include <boost/bimap.hpp>
 
@@ -107,6 +111,9 @@ public:
   //! Get the cell containing the internal DagMC ray position
   EntityId getCurrentCell() const override;
 
+  //! Get the index of the cell containing the internal DagMC ray position
+  size_t getCurrentCellIndex() const override;
+
   //! Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
   Length getDistanceToClosestBoundary() override;
 
@@ -138,9 +145,30 @@ protected:
 
 private:
 
+  // The cell adjacency list type (boundary surface handle, boundary cell handle)
+  typedef std::vector<std::pair<moab::EntityHandle,moab::EntityHandle> >
+  CellAdjacencyList;
+
+  // The cell location cache
+  struct CellLocationCache
+  {
+    // The cells that have been entered from each cell (with the surface)
+    std::unordered_map<moab::EntityHandle,CellAdjacencyList> adjacent_cells;
+
+    // The last cell that was located (0 for none)
+    moab::EntityHandle last_located_cell_handle;
+  };
+
   // Default constructor
   DagMCNavigator();
 
+  // Copy constructor (with new callback)
+  DagMCNavigator( const DagMCNavigator& other,
+                  const AdvanceCompleteCallback& advance_complete_callback );
+
+  // Get the cell location cache of the calling thread
+  static CellLocationCache& getCellLocationCache();
+
   // Check if the surface handle is a reflecting surface
   bool isReflectingSurfaceHandle(
                                const moab::EntityHandle surface_handle ) const;
@@ -171,6 +199,17 @@ private:
                                   const double direction[3],
                                   const bool check_on_boundary = false ) const;
 
+  // Find the cell handle that contains the ray (search start cell neighbors)
+  moab::EntityHandle findCellHandleContainingRayNearCell(
+                           const Length position[3],
+                           const double direction[3],
+                           const moab::EntityHandle start_cell_handle ) const;
+
+  // Find the cell handle that contains the ray (search all cells)
+  moab::EntityHandle findCellHandleContainingRayGlobally(
+                                     const Length position[3],
+                                     const double direction[3] ) const;
+
   // Find the cell handle that contains the ray
   moab::EntityHandle findCellHandleContainingRay(
                                   const Length x_position,
@@ -766,6 +766,58 @@ FRENSIE_UNIT_TEST( DagMCNavigator, clone )
   FRENSIE_CHECK_EQUAL( number_of_advances, 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a clone inherits the internal ray state at a cell boundary
+FRENSIE_UNIT_TEST( DagMCNavigator, clone_at_boundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    model->createNavigator();
+
+  // Initialize the ray
+  navigator->setState( -40.0*cgs::centimeter,
+                       -40.0*cgs::centimeter,
+                       59.0*cgs::centimeter,
+                       0.0, 0.0, 1.0,
+                       53 );
+
+  // Advance the ray to the boundary surface
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 54 );
+
+  // Clone the ray (e.g. for a secondary particle)
+  std::shared_ptr<Geometry::Navigator> navigator_clone(
+     navigator->clone( [](const Geometry::Navigator::Length){ /* ... */ } ) );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 54 );
+
+  Geometry::Navigator::EntityId surface_hit, clone_surface_hit;
+
+  Geometry::Navigator::Length distance_to_boundary =
+    navigator->fireRay( &surface_hit );
+
+  Geometry::Navigator::Length clone_distance_to_boundary =
+    navigator_clone->fireRay( &clone_surface_hit );
+
+  FRENSIE_CHECK_EQUAL( clone_surface_hit, surface_hit );
+  FRENSIE_CHECK_EQUAL( clone_distance_to_boundary, distance_to_boundary );
+
+  // Both navigators should enter the same cell
+  navigator->advanceToCellBoundary();
+  navigator_clone->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(),
+                       navigator->getCurrentCell() );
+
+  // A new ray near the last located cell should be found
+  navigator_clone->setState( -40.0*cgs::centimeter,
+                             -40.0*cgs::centimeter,
+                             61.0*cgs::centimeter,
+                             0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 54 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
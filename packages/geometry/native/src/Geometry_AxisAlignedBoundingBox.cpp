@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_AxisAlignedBoundingBox.cpp
+//! \author Alex Robinson
+//! \brief  The axis-aligned bounding box class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_AxisAlignedBoundingBox.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Create an infinite bounding box
+AxisAlignedBoundingBox AxisAlignedBoundingBox::createInfiniteBox()
+{
+  return AxisAlignedBoundingBox();
+}
+
+// Create an empty bounding box
+/*! \details The empty box is the identity element of the merge operation.
+ */
+AxisAlignedBoundingBox AxisAlignedBoundingBox::createEmptyBox()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  return AxisAlignedBoundingBox( inf, -inf, inf, -inf, inf, -inf );
+}
+
+// Default constructor (infinite box)
+AxisAlignedBoundingBox::AxisAlignedBoundingBox()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    d_lower_bounds[i] = -inf;
+    d_upper_bounds[i] = inf;
+  }
+}
+
+// Constructor
+AxisAlignedBoundingBox::AxisAlignedBoundingBox( const double x_min,
+                                                const double x_max,
+                                                const double y_min,
+                                                const double y_max,
+                                                const double z_min,
+                                                const double z_max )
+{
+  d_lower_bounds[0] = x_min;
+  d_lower_bounds[1] = y_min;
+  d_lower_bounds[2] = z_min;
+
+  d_upper_bounds[0] = x_max;
+  d_upper_bounds[1] = y_max;
+  d_upper_bounds[2] = z_max;
+}
+
+// Get the lower bound of a dimension
+double AxisAlignedBoundingBox::getLowerBound( const unsigned dimension ) const
+{
+  // Make sure the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  return d_lower_bounds[dimension];
+}
+
+// Get the upper bound of a dimension
+double AxisAlignedBoundingBox::getUpperBound( const unsigned dimension ) const
+{
+  // Make sure the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  return d_upper_bounds[dimension];
+}
+
+// Set the lower bound of a dimension
+void AxisAlignedBoundingBox::setLowerBound( const unsigned dimension,
+                                            const double bound )
+{
+  // Make sure the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  d_lower_bounds[dimension] = bound;
+}
+
+// Set the upper bound of a dimension
+void AxisAlignedBoundingBox::setUpperBound( const unsigned dimension,
+                                            const double bound )
+{
+  // Make sure the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  d_upper_bounds[dimension] = bound;
+}
+
+// Get the center of a dimension
+/*! \details If the dimension is not finite zero will be returned.
+ */
+double AxisAlignedBoundingBox::getCenter( const unsigned dimension ) const
+{
+  // Make sure the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  const double center =
+    0.5*(d_lower_bounds[dimension] + d_upper_bounds[dimension]);
+
+  if( std::isfinite( center ) )
+    return center;
+  else
+    return 0.0;
+}
+
+// Check if the box is finite in every dimension
+bool AxisAlignedBoundingBox::isFinite() const
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    if( !std::isfinite( d_lower_bounds[i] ) ||
+        !std::isfinite( d_upper_bounds[i] ) )
+      return false;
+  }
+
+  return true;
+}
+
+// Check if the box is empty
+bool AxisAlignedBoundingBox::isEmpty() const
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    if( d_lower_bounds[i] > d_upper_bounds[i] )
+      return true;
+  }
+
+  return false;
+}
+
+// Intersect this box with another box
+void AxisAlignedBoundingBox::intersect(
+                                   const AxisAlignedBoundingBox& other_box )
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    d_lower_bounds[i] = std::max( d_lower_bounds[i],
+                                  other_box.d_lower_bounds[i] );
+    d_upper_bounds[i] = std::min( d_upper_bounds[i],
+                                  other_box.d_upper_bounds[i] );
+  }
+}
+
+// Merge this box with another box (smallest box containing both)
+void AxisAlignedBoundingBox::merge( const AxisAlignedBoundingBox& other_box )
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    d_lower_bounds[i] = std::min( d_lower_bounds[i],
+                                  other_box.d_lower_bounds[i] );
+    d_upper_bounds[i] = std::max( d_upper_bounds[i],
+                                  other_box.d_upper_bounds[i] );
+  }
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_AxisAlignedBoundingBox.cpp
+//---------------------------------------------------------------------------//
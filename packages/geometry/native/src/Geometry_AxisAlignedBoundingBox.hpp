@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_AxisAlignedBoundingBox.hpp
+//! \author Alex Robinson
+//! \brief  The axis-aligned bounding box class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_AXIS_ALIGNED_BOUNDING_BOX_HPP
+#define GEOMETRY_AXIS_ALIGNED_BOUNDING_BOX_HPP
+
+// Std Lib Includes
+#include <limits>
+
+namespace Geometry{
+
+/*! The axis-aligned bounding box
+ * \details A bounding box can be infinite in any direction. The default
+ * bounding box is the entire space.
+ */
+class AxisAlignedBoundingBox
+{
+
+public:
+
+  //! Create an infinite bounding box
+  static AxisAlignedBoundingBox createInfiniteBox();
+
+  //! Create an empty bounding box
+  static AxisAlignedBoundingBox createEmptyBox();
+
+  //! Default constructor (infinite box)
+  AxisAlignedBoundingBox();
+
+  //! Constructor
+  AxisAlignedBoundingBox( const double x_min,
+                          const double x_max,
+                          const double y_min,
+                          const double y_max,
+                          const double z_min,
+                          const double z_max );
+
+  //! Destructor
+  ~AxisAlignedBoundingBox()
+  { /* ... */ }
+
+  //! Get the lower bound of a dimension
+  double getLowerBound( const unsigned dimension ) const;
+
+  //! Get the upper bound of a dimension
+  double getUpperBound( const unsigned dimension ) const;
+
+  //! Set the lower bound of a dimension
+  void setLowerBound( const unsigned dimension, const double bound );
+
+  //! Set the upper bound of a dimension
+  void setUpperBound( const unsigned dimension, const double bound );
+
+  //! Get the center of a dimension
+  double getCenter( const unsigned dimension ) const;
+
+  //! Check if the box is finite in every dimension
+  bool isFinite() const;
+
+  //! Check if the box is empty
+  bool isEmpty() const;
+
+  //! Check if a point is inside of the box (boundary included)
+  bool isPointInside( const double point[3] ) const;
+
+  //! Intersect this box with another box
+  void intersect( const AxisAlignedBoundingBox& other_box );
+
+  //! Merge this box with another box (smallest box containing both)
+  void merge( const AxisAlignedBoundingBox& other_box );
+
+private:
+
+  // The lower bounds
+  double d_lower_bounds[3];
+
+  // The upper bounds
+  double d_upper_bounds[3];
+};
+
+// Check if a point is inside of the box (boundary included)
+inline bool AxisAlignedBoundingBox::isPointInside( const double point[3] ) const
+{
+  return point[0] >= d_lower_bounds[0] && point[0] <= d_upper_bounds[0] &&
+    point[1] >= d_lower_bounds[1] && point[1] <= d_upper_bounds[1] &&
+    point[2] >= d_lower_bounds[2] && point[2] <= d_upper_bounds[2];
+}
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_AXIS_ALIGNED_BOUNDING_BOX_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_AxisAlignedBoundingBox.hpp
+//---------------------------------------------------------------------------//
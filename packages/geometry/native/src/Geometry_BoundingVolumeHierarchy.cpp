@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_BoundingVolumeHierarchy.cpp
+//! \author Alex Robinson
+//! \brief  The bounding volume hierarchy class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_BoundingVolumeHierarchy.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor (empty hierarchy)
+BoundingVolumeHierarchy::BoundingVolumeHierarchy()
+{ /* ... */ }
+
+// Constructor
+/*! \details Empty boxes will never contain a point and are ignored.
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+                         const std::vector<AxisAlignedBoundingBox>& boxes,
+                         const unsigned max_leaf_size )
+{
+  // Make sure the max leaf size is valid
+  testPrecondition( max_leaf_size > 0 );
+
+  for( size_t i = 0; i < boxes.size(); ++i )
+  {
+    if( boxes[i].isEmpty() )
+      continue;
+
+    if( boxes[i].isFinite() )
+      d_box_indices.push_back( i );
+    else
+      d_unbounded_box_indices.push_back( i );
+  }
+
+  if( !d_box_indices.empty() )
+  {
+    d_nodes.reserve( 2*d_box_indices.size() );
+
+    this->buildNode( boxes, 0, d_box_indices.size(), max_leaf_size );
+  }
+}
+
+// Build a node of the hierarchy
+/*! \details Splitting at the median guarantees a balanced tree, which keeps
+ * the depth (and therefore the traversal stack size) logarithmic in the
+ * number of boxes.
+ */
+void BoundingVolumeHierarchy::buildNode(
+                              const std::vector<AxisAlignedBoundingBox>& boxes,
+                              const size_t start,
+                              const size_t end,
+                              const unsigned max_leaf_size )
+{
+  const size_t node_index = d_nodes.size();
+
+  d_nodes.push_back( Node() );
+
+  AxisAlignedBoundingBox node_box = AxisAlignedBoundingBox::createEmptyBox();
+  AxisAlignedBoundingBox center_box = AxisAlignedBoundingBox::createEmptyBox();
+
+  for( size_t i = start; i < end; ++i )
+  {
+    const AxisAlignedBoundingBox& box = boxes[d_box_indices[i]];
+
+    node_box.merge( box );
+
+    center_box.merge( AxisAlignedBoundingBox( box.getCenter( 0 ),
+                                              box.getCenter( 0 ),
+                                              box.getCenter( 1 ),
+                                              box.getCenter( 1 ),
+                                              box.getCenter( 2 ),
+                                              box.getCenter( 2 ) ) );
+  }
+
+  d_nodes[node_index].box = node_box;
+  d_nodes[node_index].right_child_index = 0;
+  d_nodes[node_index].start = start;
+  d_nodes[node_index].count = end - start;
+
+  if( end - start <= max_leaf_size )
+    return;
+
+  // Split along the axis with the largest spread of box centers
+  unsigned split_axis = 0;
+  double max_extent = 0.0;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    const double extent =
+      center_box.getUpperBound( i ) - center_box.getLowerBound( i );
+
+    if( extent > max_extent )
+    {
+      max_extent = extent;
+      split_axis = i;
+    }
+  }
+
+  // All of the box centers coincide - the boxes cannot be partitioned
+  if( max_extent == 0.0 )
+    return;
+
+  const size_t middle = start + (end - start)/2;
+
+  std::nth_element( d_box_indices.begin() + start,
+                    d_box_indices.begin() + middle,
+                    d_box_indices.begin() + end,
+                    [&boxes, split_axis]( const size_t lhs, const size_t rhs ){
+                      return boxes[lhs].getCenter( split_axis ) <
+                        boxes[rhs].getCenter( split_axis );
+                    } );
+
+  d_nodes[node_index].count = 0;
+
+  this->buildNode( boxes, start, middle, max_leaf_size );
+
+  d_nodes[node_index].right_child_index = d_nodes.size();
+
+  this->buildNode( boxes, middle, end, max_leaf_size );
+}
+
+// Get the number of nodes in the hierarchy
+size_t BoundingVolumeHierarchy::getNumberOfNodes() const
+{
+  return d_nodes.size();
+}
+
+// Get the number of unbounded boxes
+size_t BoundingVolumeHierarchy::getNumberOfUnboundedBoxes() const
+{
+  return d_unbounded_box_indices.size();
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_BoundingVolumeHierarchy.cpp
+//---------------------------------------------------------------------------//
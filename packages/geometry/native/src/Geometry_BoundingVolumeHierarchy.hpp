@@ -0,0 +1,150 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_BoundingVolumeHierarchy.hpp
+//! \author Alex Robinson
+//! \brief  The bounding volume hierarchy class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_BOUNDING_VOLUME_HIERARCHY_HPP
+#define GEOMETRY_BOUNDING_VOLUME_HIERARCHY_HPP
+
+// Std Lib Includes
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Geometry_AxisAlignedBoundingBox.hpp"
+#include "Utility_Vector.hpp"
+
+namespace Geometry{
+
+/*! The bounding volume hierarchy
+ * \details The hierarchy is built over a set of axis-aligned bounding boxes
+ * (e.g. the bounding boxes of the cells in a model) by recursively splitting
+ * the boxes at the median center along the longest axis. The nodes are stored
+ * in a flat array (depth first order) and are traversed using an explicit
+ * stack so that queries never allocate memory. Boxes that are not finite
+ * cannot be partitioned in a meaningful way and are stored in a separate
+ * list that is always visited.
+ */
+class BoundingVolumeHierarchy
+{
+
+public:
+
+  //! Default constructor (empty hierarchy)
+  BoundingVolumeHierarchy();
+
+  //! Constructor
+  BoundingVolumeHierarchy( const std::vector<AxisAlignedBoundingBox>& boxes,
+                           const unsigned max_leaf_size = 4 );
+
+  //! Destructor
+  ~BoundingVolumeHierarchy()
+  { /* ... */ }
+
+  //! Get the number of nodes in the hierarchy
+  size_t getNumberOfNodes() const;
+
+  //! Get the number of unbounded boxes
+  size_t getNumberOfUnboundedBoxes() const;
+
+  //! Visit the boxes that contain a point
+  template<typename Visitor>
+  bool visitBoxesContainingPoint( const double point[3],
+                                  const Visitor& visitor ) const;
+
+private:
+
+  // Build a node of the hierarchy
+  void buildNode( const std::vector<AxisAlignedBoundingBox>& boxes,
+                  const size_t start,
+                  const size_t end,
+                  const unsigned max_leaf_size );
+
+  // The hierarchy node
+  struct Node
+  {
+    // The bounding box of the node
+    AxisAlignedBoundingBox box;
+
+    // The index of the right child (the left child is the next node)
+    uint32_t right_child_index;
+
+    // The first box index (leaf nodes only)
+    uint32_t start;
+
+    // The number of box indices (zero for interior nodes)
+    uint32_t count;
+  };
+
+  // The max traversal stack size
+  static const unsigned s_max_stack_size = 64;
+
+  // The hierarchy nodes
+  std::vector<Node> d_nodes;
+
+  // The box indices (ordered by leaf)
+  std::vector<size_t> d_box_indices;
+
+  // The unbounded box indices
+  std::vector<size_t> d_unbounded_box_indices;
+};
+
+// Visit the boxes that contain a point
+/*! \details The visitor will be called with the index of every box that
+ * might contain the point (the box indices correspond to the boxes that were
+ * used to construct the hierarchy). Unbounded boxes are visited last. If the
+ * visitor returns true the traversal will stop and true will be returned.
+ */
+template<typename Visitor>
+bool BoundingVolumeHierarchy::visitBoxesContainingPoint(
+                                                 const double point[3],
+                                                 const Visitor& visitor ) const
+{
+  if( !d_nodes.empty() )
+  {
+    uint32_t node_stack[s_max_stack_size];
+    unsigned stack_size = 0;
+
+    node_stack[stack_size++] = 0;
+
+    while( stack_size > 0 )
+    {
+      const Node& node = d_nodes[node_stack[--stack_size]];
+
+      if( !node.box.isPointInside( point ) )
+        continue;
+
+      if( node.count > 0 )
+      {
+        for( uint32_t i = node.start; i < node.start + node.count; ++i )
+        {
+          if( visitor( d_box_indices[i] ) )
+            return true;
+        }
+      }
+      else
+      {
+        node_stack[stack_size++] = node.right_child_index;
+        node_stack[stack_size++] = (&node - d_nodes.data()) + 1;
+      }
+    }
+  }
+
+  for( size_t i = 0; i < d_unbounded_box_indices.size(); ++i )
+  {
+    if( visitor( d_unbounded_box_indices[i] ) )
+      return true;
+  }
+
+  return false;
+}
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_BOUNDING_VOLUME_HIERARCHY_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_BoundingVolumeHierarchy.hpp
+//---------------------------------------------------------------------------//
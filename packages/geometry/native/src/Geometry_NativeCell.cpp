@@ -0,0 +1,446 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.cpp
+//! \author Alex Robinson
+//! \brief  The native cell class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cctype>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_NativeCell.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor
+NativeCell::NativeCell()
+  : d_id( Model::invalidCellId() ),
+    d_definition(),
+    d_material_id( Model::invalidMaterialId() ),
+    d_density( 0.0*Model::DensityUnit() ),
+    d_termination( false ),
+    d_volume( 1.0 ),
+    d_universe_id( NativeCell::rootUniverseId() ),
+    d_fill_universe_id( Model::invalidCellId() ),
+    d_surface_ids(),
+    d_instructions()
+{
+  d_fill_translation[0] = 0.0;
+  d_fill_translation[1] = 0.0;
+  d_fill_translation[2] = 0.0;
+}
+
+// Void cell constructor
+NativeCell::NativeCell( const EntityId id, const std::string& definition )
+  : NativeCell( id,
+                definition,
+                Model::invalidMaterialId(),
+                0.0*Model::DensityUnit() )
+{ /* ... */ }
+
+// Material cell constructor
+/*! \details A cell with a density of zero is a void cell. A negative density
+ * is a mass density and a positive density is an atom density (see
+ * Geometry::Model::DensityUnit). The cell volume defaults to 1.0 cm^3 and must
+ * be set explicitly if it is needed (e.g. by a cell estimator).
+ */
+NativeCell::NativeCell( const EntityId id,
+                        const std::string& definition,
+                        const MaterialId material_id,
+                        const Density density )
+  : d_id( id ),
+    d_definition( definition ),
+    d_material_id( material_id ),
+    d_density( density ),
+    d_termination( false ),
+    d_volume( 1.0 ),
+    d_universe_id( NativeCell::rootUniverseId() ),
+    d_fill_universe_id( Model::invalidCellId() ),
+    d_surface_ids(),
+    d_instructions()
+{
+  d_fill_translation[0] = 0.0;
+  d_fill_translation[1] = 0.0;
+  d_fill_translation[2] = 0.0;
+
+  TEST_FOR_EXCEPTION( id == Model::invalidCellId(),
+                      InvalidNativeCellDefinition,
+                      "The cell id " << id << " is reserved!" );
+
+  this->compile();
+}
+
+// Compile the cell definition
+/*! \details The shunting-yard algorithm is used to convert the infix cell
+ * definition to a postfix program. Complement has the highest precedence,
+ * followed by intersection and then union.
+ */
+void NativeCell::compile()
+{
+  d_surface_ids.clear();
+  d_instructions.clear();
+
+  // The operator stack (LEFT_PARENTHESIS is only used on this stack)
+  enum StackOperator{
+    STACK_INTERSECTION = 0,
+    STACK_UNION,
+    STACK_COMPLEMENT,
+    LEFT_PARENTHESIS
+  };
+
+  std::vector<StackOperator> operator_stack;
+
+  // Pop an operator from the operator stack to the program
+  auto pop_operator = [this, &operator_stack](){
+    Instruction instruction;
+    instruction.sense = 0;
+    instruction.local_surface_index = 0;
+
+    switch( operator_stack.back() )
+    {
+      case STACK_INTERSECTION:
+        instruction.opcode = INTERSECTION;
+        break;
+      case STACK_UNION:
+        instruction.opcode = UNION;
+        break;
+      default:
+        instruction.opcode = COMPLEMENT;
+    }
+
+    d_instructions.push_back( instruction );
+    operator_stack.pop_back();
+  };
+
+  // Push a binary operator (lower precedence operators are applied later)
+  auto push_binary_operator = [&operator_stack, &pop_operator](
+                                                const StackOperator op ){
+    while( !operator_stack.empty() &&
+           operator_stack.back() != LEFT_PARENTHESIS &&
+           (operator_stack.back() == STACK_COMPLEMENT ||
+            operator_stack.back() <= op) )
+      pop_operator();
+
+    operator_stack.push_back( op );
+  };
+
+  // Whether the previous token completed an operand (implicit intersection)
+  bool previous_token_ends_operand = false;
+
+  size_t i = 0;
+
+  while( i < d_definition.size() )
+  {
+    const char token = d_definition[i];
+
+    if( std::isspace( token ) )
+    {
+      ++i;
+      continue;
+    }
+
+    const bool token_starts_operand = token == '(' || token == '#' ||
+      token == '+' || token == '-' || std::isdigit( token );
+
+    if( token_starts_operand && previous_token_ends_operand )
+      push_binary_operator( STACK_INTERSECTION );
+
+    if( token == '(' )
+    {
+      operator_stack.push_back( LEFT_PARENTHESIS );
+
+      previous_token_ends_operand = false;
+      ++i;
+    }
+    else if( token == ')' )
+    {
+      while( !operator_stack.empty() &&
+             operator_stack.back() != LEFT_PARENTHESIS )
+        pop_operator();
+
+      TEST_FOR_EXCEPTION( operator_stack.empty(),
+                          InvalidNativeCellDefinition,
+                          "Cell " << d_id << " has unbalanced parentheses "
+                          "in its definition (" << d_definition << ")!" );
+
+      operator_stack.pop_back();
+
+      previous_token_ends_operand = true;
+      ++i;
+    }
+    else if( token == ':' )
+    {
+      TEST_FOR_EXCEPTION( !previous_token_ends_operand,
+                          InvalidNativeCellDefinition,
+                          "Cell " << d_id << " has a union with a missing "
+                          "operand in its definition (" << d_definition <<
+                          ")!" );
+
+      push_binary_operator( STACK_UNION );
+
+      previous_token_ends_operand = false;
+      ++i;
+    }
+    else if( token == '#' )
+    {
+      operator_stack.push_back( STACK_COMPLEMENT );
+
+      previous_token_ends_operand = false;
+      ++i;
+    }
+    else if( token_starts_operand )
+    {
+      // Parse the signed surface id
+      int sense = 1;
+
+      if( token == '+' || token == '-' )
+      {
+        if( token == '-' )
+          sense = -1;
+
+        ++i;
+      }
+
+      size_t id_start = i;
+
+      while( i < d_definition.size() && std::isdigit( d_definition[i] ) )
+        ++i;
+
+      TEST_FOR_EXCEPTION( id_start == i,
+                          InvalidNativeCellDefinition,
+                          "Cell " << d_id << " has a sense without a "
+                          "surface id in its definition (" << d_definition <<
+                          ")!" );
+
+      const EntityId surface_id =
+        std::stoull( d_definition.substr( id_start, i - id_start ) );
+
+      TEST_FOR_EXCEPTION( surface_id == Model::invalidSurfaceId(),
+                          InvalidNativeCellDefinition,
+                          "Cell " << d_id << " references the reserved "
+                          "surface id " << surface_id << "!" );
+
+      // Assign the local surface index
+      std::vector<EntityId>::const_iterator surface_id_it =
+        std::find( d_surface_ids.begin(), d_surface_ids.end(), surface_id );
+
+      Instruction instruction;
+      instruction.opcode = PUSH_HALF_SPACE;
+      instruction.sense = sense;
+      instruction.local_surface_index =
+        std::distance( d_surface_ids.cbegin(), surface_id_it );
+
+      if( surface_id_it == d_surface_ids.end() )
+        d_surface_ids.push_back( surface_id );
+
+      d_instructions.push_back( instruction );
+
+      // Apply any pending complement operators directly to the operand
+      while( !operator_stack.empty() &&
+             operator_stack.back() == STACK_COMPLEMENT )
+        pop_operator();
+
+      previous_token_ends_operand = true;
+    }
+    else
+    {
+      THROW_EXCEPTION( InvalidNativeCellDefinition,
+                       "Cell " << d_id << " has an invalid character ("
+                       << token << ") in its definition (" << d_definition <<
+                       ")!" );
+    }
+  }
+
+  while( !operator_stack.empty() )
+  {
+    TEST_FOR_EXCEPTION( operator_stack.back() == LEFT_PARENTHESIS,
+                        InvalidNativeCellDefinition,
+                        "Cell " << d_id << " has unbalanced parentheses "
+                        "in its definition (" << d_definition << ")!" );
+
+    pop_operator();
+  }
+
+  // Validate the program
+  unsigned stack_size = 0;
+
+  for( size_t j = 0; j < d_instructions.size(); ++j )
+  {
+    switch( d_instructions[j].opcode )
+    {
+      case PUSH_HALF_SPACE:
+        ++stack_size;
+        break;
+      case INTERSECTION:
+      case UNION:
+        TEST_FOR_EXCEPTION( stack_size < 2,
+                            InvalidNativeCellDefinition,
+                            "Cell " << d_id << " has an operator with a "
+                            "missing operand in its definition ("
+                            << d_definition << ")!" );
+        --stack_size;
+        break;
+      case COMPLEMENT:
+        TEST_FOR_EXCEPTION( stack_size < 1,
+                            InvalidNativeCellDefinition,
+                            "Cell " << d_id << " has a complement with a "
+                            "missing operand in its definition ("
+                            << d_definition << ")!" );
+        break;
+    }
+
+    TEST_FOR_EXCEPTION( stack_size > s_max_stack_size,
+                        InvalidNativeCellDefinition,
+                        "Cell " << d_id << " has a definition that is too "
+                        "deeply nested (" << d_definition << ")!" );
+  }
+
+  TEST_FOR_EXCEPTION( stack_size != 1,
+                      InvalidNativeCellDefinition,
+                      "Cell " << d_id << " has an invalid definition ("
+                      << d_definition << ")!" );
+}
+
+// Get the cell id
+auto NativeCell::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Get the cell definition
+const std::string& NativeCell::getDefinition() const
+{
+  return d_definition;
+}
+
+// Get the ids of the surfaces that bound the cell (local index order)
+auto NativeCell::getSurfaceIds() const -> const std::vector<EntityId>&
+{
+  return d_surface_ids;
+}
+
+// Get the material id
+auto NativeCell::getMaterialId() const -> MaterialId
+{
+  return d_material_id;
+}
+
+// Get the density
+auto NativeCell::getDensity() const -> Density
+{
+  return d_density;
+}
+
+// Check if the cell is void
+bool NativeCell::isVoid() const
+{
+  return d_density == 0.0*Model::DensityUnit();
+}
+
+// Check if the cell is a termination cell
+bool NativeCell::isTermination() const
+{
+  return d_termination;
+}
+
+// Set the termination cell flag
+void NativeCell::setTermination( const bool termination )
+{
+  d_termination = termination;
+}
+
+// Get the id of the universe that the cell belongs to
+auto NativeCell::getUniverseId() const -> EntityId
+{
+  return d_universe_id;
+}
+
+// Set the id of the universe that the cell belongs to
+void NativeCell::setUniverseId( const EntityId universe_id )
+{
+  TEST_FOR_EXCEPTION( universe_id == Model::invalidCellId(),
+                      InvalidNativeCellDefinition,
+                      "Cell " << d_id << " cannot be placed in the reserved "
+                      "universe " << universe_id << "!" );
+
+  d_universe_id = universe_id;
+}
+
+// Check if the cell is filled with a universe
+bool NativeCell::isFilled() const
+{
+  return d_fill_universe_id != Model::invalidCellId();
+}
+
+// Get the id of the universe that fills the cell
+auto NativeCell::getFillUniverseId() const -> EntityId
+{
+  return d_fill_universe_id;
+}
+
+// Get the translation of the universe that fills the cell (cm)
+const double* NativeCell::getFillTranslation() const
+{
+  return d_fill_translation;
+}
+
+// Fill the cell with a universe
+/*! \details The translation is the position of the fill universe origin
+ * in the coordinate system of the universe that contains the cell. Only void
+ * cells can be filled.
+ */
+void NativeCell::setFill( const EntityId fill_universe_id,
+                          const double x_translation,
+                          const double y_translation,
+                          const double z_translation )
+{
+  TEST_FOR_EXCEPTION( fill_universe_id == Model::invalidCellId() ||
+                      fill_universe_id == NativeCell::rootUniverseId(),
+                      InvalidNativeCellDefinition,
+                      "Cell " << d_id << " cannot be filled with the "
+                      "reserved universe " << fill_universe_id << "!" );
+
+  TEST_FOR_EXCEPTION( !this->isVoid(),
+                      InvalidNativeCellDefinition,
+                      "Cell " << d_id << " cannot be filled with universe "
+                      << fill_universe_id << " because it contains a "
+                      "material!" );
+
+  d_fill_universe_id = fill_universe_id;
+
+  d_fill_translation[0] = x_translation;
+  d_fill_translation[1] = y_translation;
+  d_fill_translation[2] = z_translation;
+}
+
+// The root universe id
+auto NativeCell::rootUniverseId() -> EntityId
+{
+  return 0;
+}
+
+// Get the cell volume (cm^3)
+double NativeCell::getVolume() const
+{
+  return d_volume;
+}
+
+// Set the cell volume (cm^3)
+void NativeCell::setVolume( const double volume )
+{
+  // Make sure the volume is valid
+  testPrecondition( volume > 0.0 );
+
+  d_volume = volume;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.cpp
+//---------------------------------------------------------------------------//
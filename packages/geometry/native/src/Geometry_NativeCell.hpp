@@ -0,0 +1,343 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCell.hpp
+//! \author Alex Robinson
+//! \brief  The native cell class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_CELL_HPP
+#define GEOMETRY_NATIVE_CELL_HPP
+
+// Std Lib Includes
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Geometry_Model.hpp"
+#include "Geometry_AxisAlignedBoundingBox.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace Geometry{
+
+/*! The native cell
+ * \details A native cell is defined by a logical combination of quadric
+ * surface half spaces. The definition uses the familiar syntax where a signed
+ * surface id selects a half space (e.g. "-1" is the negative sense of surface
+ * 1), whitespace is an intersection, ":" is a union, "#" is a complement and
+ * parentheses can be used for grouping (e.g. "-1 2 (-3 : 4) #(5 -6)").
+ * Intersection has a higher precedence than union. The definition is
+ * compiled once into a postfix (reverse polish notation) program that can be
+ * evaluated without any string processing or memory allocation. The surfaces
+ * are referred to by local indices (the order in which they first appear in
+ * the definition) so that the model can map them to its own surface storage.
+ * This class replaces the Teuchos based Geometry::Cell and
+ * Geometry::BooleanCellFunctor classes.
+ *
+ * Every cell belongs to a universe (the root universe by default). A void
+ * cell can be filled with another universe (or a Geometry::NativeLattice),
+ * optionally translated, which allows a repeated structure to be defined once
+ * and placed many times.
+ */
+class NativeCell
+{
+
+public:
+
+  //! The cell id type
+  typedef Model::EntityId EntityId;
+
+  //! The material id type
+  typedef Model::MaterialId MaterialId;
+
+  //! The density type
+  typedef Model::Density Density;
+
+  //! Void cell constructor
+  NativeCell( const EntityId id, const std::string& definition );
+
+  //! Material cell constructor
+  NativeCell( const EntityId id,
+              const std::string& definition,
+              const MaterialId material_id,
+              const Density density );
+
+  //! Destructor
+  ~NativeCell()
+  { /* ... */ }
+
+  //! Get the cell id
+  EntityId getId() const;
+
+  //! Get the cell definition
+  const std::string& getDefinition() const;
+
+  //! Get the ids of the surfaces that bound the cell (local index order)
+  const std::vector<EntityId>& getSurfaceIds() const;
+
+  //! Get the material id
+  MaterialId getMaterialId() const;
+
+  //! Get the density
+  Density getDensity() const;
+
+  //! Check if the cell is void
+  bool isVoid() const;
+
+  //! Check if the cell is a termination cell
+  bool isTermination() const;
+
+  //! Set the termination cell flag
+  void setTermination( const bool termination = true );
+
+  //! Get the id of the universe that the cell belongs to
+  EntityId getUniverseId() const;
+
+  //! Set the id of the universe that the cell belongs to
+  void setUniverseId( const EntityId universe_id );
+
+  //! Check if the cell is filled with a universe
+  bool isFilled() const;
+
+  //! Get the id of the universe that fills the cell
+  EntityId getFillUniverseId() const;
+
+  //! Get the translation of the universe that fills the cell (cm)
+  const double* getFillTranslation() const;
+
+  //! Fill the cell with a universe
+  void setFill( const EntityId fill_universe_id,
+                const double x_translation = 0.0,
+                const double y_translation = 0.0,
+                const double z_translation = 0.0 );
+
+  //! Get the cell volume (cm^3)
+  double getVolume() const;
+
+  //! Set the cell volume (cm^3)
+  void setVolume( const double volume );
+
+  //! The root universe id
+  static EntityId rootUniverseId();
+
+  //! Check if a point is inside the cell
+  template<typename SurfaceSenseFunctor>
+  bool isInside( const SurfaceSenseFunctor& surface_sense ) const;
+
+  //! Calculate a (conservative) bounding box for the cell
+  template<typename HalfSpaceBoundingBoxFunctor>
+  AxisAlignedBoundingBox calculateBoundingBox(
+               const HalfSpaceBoundingBoxFunctor& half_space_bounding_box ) const;
+
+private:
+
+  // Default constructor
+  NativeCell();
+
+  // Compile the cell definition
+  void compile();
+
+  // Serialize the cell
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The instruction opcodes
+  enum Opcode : unsigned char{
+    PUSH_HALF_SPACE = 0,
+    INTERSECTION,
+    UNION,
+    COMPLEMENT
+  };
+
+  // The compiled instruction
+  struct Instruction
+  {
+    Opcode opcode;
+    int sense;
+    uint32_t local_surface_index;
+  };
+
+  // The max number of values on the evaluation stack
+  static const unsigned s_max_stack_size = 64;
+
+  // The cell id
+  EntityId d_id;
+
+  // The cell definition
+  std::string d_definition;
+
+  // The material id
+  MaterialId d_material_id;
+
+  // The density
+  Density d_density;
+
+  // The termination cell flag
+  bool d_termination;
+
+  // The cell volume
+  double d_volume;
+
+  // The universe id
+  EntityId d_universe_id;
+
+  // The fill universe id
+  EntityId d_fill_universe_id;
+
+  // The fill universe translation
+  double d_fill_translation[3];
+
+  // The surface ids (local index order)
+  std::vector<EntityId> d_surface_ids;
+
+  // The compiled cell definition (postfix)
+  std::vector<Instruction> d_instructions;
+};
+
+//! The invalid native cell definition error
+class InvalidNativeCellDefinition : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeCellDefinition( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+// Check if a point is inside the cell
+/*! \details The surface sense functor must take a local surface index and
+ * return the sense (+1 or -1) of the point w.r.t. that surface. The
+ * evaluation stack is stored in the bits of a single integer.
+ */
+template<typename SurfaceSenseFunctor>
+bool NativeCell::isInside( const SurfaceSenseFunctor& surface_sense ) const
+{
+  uint64_t stack = 0;
+
+  for( size_t i = 0; i < d_instructions.size(); ++i )
+  {
+    const Instruction& instruction = d_instructions[i];
+
+    switch( instruction.opcode )
+    {
+      case PUSH_HALF_SPACE:
+      {
+        const uint64_t value =
+          (surface_sense( instruction.local_surface_index ) ==
+           instruction.sense ? 1 : 0);
+
+        stack = (stack << 1) | value;
+        break;
+      }
+      case INTERSECTION:
+      {
+        const uint64_t top = stack & 1;
+
+        stack >>= 1;
+        stack &= (~uint64_t(1) | top);
+        break;
+      }
+      case UNION:
+      {
+        const uint64_t top = stack & 1;
+
+        stack >>= 1;
+        stack |= top;
+        break;
+      }
+      case COMPLEMENT:
+      {
+        stack ^= 1;
+        break;
+      }
+    }
+  }
+
+  return (stack & 1) == 1;
+}
+
+// Calculate a (conservative) bounding box for the cell
+/*! \details The half space bounding box functor must take a local surface
+ * index and a sense and return the bounding box of the half space. The
+ * bounding box of a complement is assumed to be infinite.
+ */
+template<typename HalfSpaceBoundingBoxFunctor>
+AxisAlignedBoundingBox NativeCell::calculateBoundingBox(
+            const HalfSpaceBoundingBoxFunctor& half_space_bounding_box ) const
+{
+  std::vector<AxisAlignedBoundingBox> stack;
+
+  for( size_t i = 0; i < d_instructions.size(); ++i )
+  {
+    const Instruction& instruction = d_instructions[i];
+
+    switch( instruction.opcode )
+    {
+      case PUSH_HALF_SPACE:
+      {
+        stack.push_back( half_space_bounding_box(
+                                            instruction.local_surface_index,
+                                            instruction.sense ) );
+        break;
+      }
+      case INTERSECTION:
+      {
+        AxisAlignedBoundingBox top = stack.back();
+        stack.pop_back();
+
+        stack.back().intersect( top );
+        break;
+      }
+      case UNION:
+      {
+        AxisAlignedBoundingBox top = stack.back();
+        stack.pop_back();
+
+        stack.back().merge( top );
+        break;
+      }
+      case COMPLEMENT:
+      {
+        stack.back() = AxisAlignedBoundingBox::createInfiniteBox();
+        break;
+      }
+    }
+  }
+
+  return stack.back();
+}
+
+// Serialize the cell
+template<typename Archive>
+void NativeCell::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_definition );
+  ar & BOOST_SERIALIZATION_NVP( d_material_id );
+  ar & BOOST_SERIALIZATION_NVP( d_density );
+  ar & BOOST_SERIALIZATION_NVP( d_termination );
+  ar & BOOST_SERIALIZATION_NVP( d_volume );
+  ar & BOOST_SERIALIZATION_NVP( d_universe_id );
+  ar & BOOST_SERIALIZATION_NVP( d_fill_universe_id );
+  ar & BOOST_SERIALIZATION_NVP( d_fill_translation );
+
+  // The compiled definition is not archived
+  if( Archive::is_loading::value )
+    this->compile();
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeCell, Geometry, 0 );
+
+#endif // end GEOMETRY_NATIVE_CELL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCell.hpp
+//---------------------------------------------------------------------------//
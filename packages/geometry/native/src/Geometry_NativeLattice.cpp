@@ -0,0 +1,462 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeLattice.cpp
+//! \author Alex Robinson
+//! \brief  The native lattice class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeLattice.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+namespace{
+
+// sqrt(3)/2
+const double s_sqrt_3_over_2 = 0.8660254037844386;
+
+// The hexagonal element shifts (one per flat side, counterclockwise from +x)
+const int s_hex_shifts[6][2] =
+  {{1,0}, {0,1}, {-1,1}, {-1,0}, {0,-1}, {1,-1}};
+
+// The hexagonal element side unit normals
+const double s_hex_normals[6][2] =
+  {{1.0, 0.0},
+   {0.5, s_sqrt_3_over_2},
+   {-0.5, s_sqrt_3_over_2},
+   {-1.0, 0.0},
+   {-0.5, -s_sqrt_3_over_2},
+   {0.5, -s_sqrt_3_over_2}};
+
+} // end local namespace
+
+// Initialize static member data
+const double NativeLattice::s_tol = 1e-9;
+
+// Default constructor
+NativeLattice::NativeLattice()
+  : d_id( Model::invalidCellId() ),
+    d_type( RECTANGULAR ),
+    d_element_universe_ids(),
+    d_outer_universe_id( Model::invalidCellId() )
+{
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    d_origin[i] = 0.0;
+    d_pitch[i] = 1.0;
+    d_dimensions[i] = 1;
+  }
+}
+
+// Constructor
+NativeLattice::NativeLattice( const EntityId id,
+                              const Type type,
+                              const double origin[3],
+                              const double pitch[3],
+                              const unsigned dimensions[3],
+                              const std::vector<EntityId>& element_universe_ids,
+                              const EntityId outer_universe_id )
+  : d_id( id ),
+    d_type( type ),
+    d_element_universe_ids( element_universe_ids ),
+    d_outer_universe_id( outer_universe_id )
+{
+  TEST_FOR_EXCEPTION( id == Model::invalidCellId(),
+                      InvalidNativeLatticeDefinition,
+                      "The lattice id " << id << " is reserved!" );
+
+  size_t number_of_elements = 1;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    TEST_FOR_EXCEPTION( !(pitch[i] > 0.0),
+                        InvalidNativeLatticeDefinition,
+                        "Lattice " << id << " has an invalid pitch ("
+                        << pitch[i] << ")!" );
+
+    TEST_FOR_EXCEPTION( dimensions[i] == 0,
+                        InvalidNativeLatticeDefinition,
+                        "Lattice " << id << " has an empty dimension!" );
+
+    TEST_FOR_EXCEPTION( !NativeLattice::isAxisDivided( pitch[i] ) &&
+                        dimensions[i] != 1,
+                        InvalidNativeLatticeDefinition,
+                        "Lattice " << id << " has an undivided axis with "
+                        "more than one element!" );
+
+    d_origin[i] = NativeLattice::isAxisDivided( pitch[i] ) ? origin[i] : 0.0;
+    d_pitch[i] = pitch[i];
+    d_dimensions[i] = dimensions[i];
+
+    number_of_elements *= dimensions[i];
+  }
+
+  TEST_FOR_EXCEPTION( element_universe_ids.size() != number_of_elements,
+                      InvalidNativeLatticeDefinition,
+                      "Lattice " << id << " has " << number_of_elements <<
+                      " elements but " << element_universe_ids.size() <<
+                      " element universe ids were given!" );
+}
+
+// Create a rectangular lattice
+/*! \details The lower left corner is the corner of element (0,0,0) with the
+ * smallest coordinates.
+ */
+NativeLattice NativeLattice::createRectangularLattice(
+                            const EntityId id,
+                            const double lower_left_corner[3],
+                            const double pitch[3],
+                            const unsigned dimensions[3],
+                            const std::vector<EntityId>& element_universe_ids,
+                            const EntityId outer_universe_id )
+{
+  return NativeLattice( id,
+                        RECTANGULAR,
+                        lower_left_corner,
+                        pitch,
+                        dimensions,
+                        element_universe_ids,
+                        outer_universe_id );
+}
+
+// Create a hexagonal lattice
+/*! \details The pitch is the flat-to-flat distance of an element. The
+ * center is the center of element (0,0,0). The axial pitch can be set to
+ * infinity to create a two-dimensional lattice.
+ */
+NativeLattice NativeLattice::createHexagonalLattice(
+                            const EntityId id,
+                            const double center[3],
+                            const double pitch,
+                            const double axial_pitch,
+                            const unsigned dimensions[3],
+                            const std::vector<EntityId>& element_universe_ids,
+                            const EntityId outer_universe_id )
+{
+  TEST_FOR_EXCEPTION( !NativeLattice::isAxisDivided( pitch ),
+                      InvalidNativeLatticeDefinition,
+                      "Lattice " << id << " must have a finite hexagonal "
+                      "pitch!" );
+
+  const double pitches[3] = {pitch, pitch, axial_pitch};
+
+  return NativeLattice( id,
+                        HEXAGONAL,
+                        center,
+                        pitches,
+                        dimensions,
+                        element_universe_ids,
+                        outer_universe_id );
+}
+
+// Get the lattice id
+auto NativeLattice::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Get the lattice type
+auto NativeLattice::getType() const -> Type
+{
+  return d_type;
+}
+
+// Get the lattice dimensions
+const unsigned* NativeLattice::getDimensions() const
+{
+  return d_dimensions;
+}
+
+// Get the number of elements
+size_t NativeLattice::getNumberOfElements() const
+{
+  return d_element_universe_ids.size();
+}
+
+// Get the element universe ids (i-fastest order)
+auto NativeLattice::getElementUniverseIds() const
+  -> const std::vector<EntityId>&
+{
+  return d_element_universe_ids;
+}
+
+// Get the outer universe id
+auto NativeLattice::getOuterUniverseId() const -> EntityId
+{
+  return d_outer_universe_id;
+}
+
+// Check if the element indices are in the lattice element range
+bool NativeLattice::isElementInRange( const int element[3] ) const
+{
+  return element[0] >= 0 && element[0] < (int)d_dimensions[0] &&
+    element[1] >= 0 && element[1] < (int)d_dimensions[1] &&
+    element[2] >= 0 && element[2] < (int)d_dimensions[2];
+}
+
+// Get the flat (i-fastest) index of an element
+size_t NativeLattice::getElementIndex( const int element[3] ) const
+{
+  // Make sure that the element is in range
+  testPrecondition( this->isElementInRange( element ) );
+
+  return element[0] +
+    d_dimensions[0]*(element[1] + (size_t)d_dimensions[1]*element[2]);
+}
+
+// Find the element that contains a point (lattice coordinates)
+/*! \details The element indices are calculated directly from the position.
+ * If the point is on an element boundary the direction is used to select the
+ * element that the point is entering. The returned element can be out of the
+ * element range (i.e. the point is in the outer universe).
+ */
+void NativeLattice::findElement( const double position[3],
+                                 const double direction[3],
+                                 int element[3] ) const
+{
+  // The rectangular axes (only the axial axis for hexagonal lattices)
+  const unsigned first_rectangular_axis = (d_type == RECTANGULAR ? 0 : 2);
+
+  for( unsigned i = first_rectangular_axis; i < 3; ++i )
+  {
+    if( !NativeLattice::isAxisDivided( d_pitch[i] ) )
+    {
+      element[i] = 0;
+      continue;
+    }
+
+    // Hexagonal lattice axial layers are centered on the origin
+    const double scaled_position = (position[i] - d_origin[i])/d_pitch[i] +
+      (d_type == HEXAGONAL ? 0.5 : 0.0);
+
+    const double index = std::floor( scaled_position );
+
+    element[i] = (int)index;
+
+    if( (scaled_position - index)*d_pitch[i] < s_tol && direction[i] < 0.0 )
+      --element[i];
+    else if( (index + 1.0 - scaled_position)*d_pitch[i] < s_tol &&
+             direction[i] > 0.0 )
+      ++element[i];
+  }
+
+  if( d_type == HEXAGONAL )
+  {
+    // Points on a side are nudged into the element that they are entering
+    const double x = position[0] - d_origin[0] + s_tol*direction[0];
+    const double y = position[1] - d_origin[1] + s_tol*direction[1];
+
+    const double j_coord = y/(d_pitch[0]*s_sqrt_3_over_2);
+    const double i_coord = x/d_pitch[0] - 0.5*j_coord;
+
+    const int i_floor = (int)std::floor( i_coord );
+    const int j_floor = (int)std::floor( j_coord );
+
+    // The point is in the parallelogram spanned by four element centers,
+    // one of which must be the closest center
+    double min_distance_squared = std::numeric_limits<double>::infinity();
+
+    for( int di = 0; di < 2; ++di )
+    {
+      for( int dj = 0; dj < 2; ++dj )
+      {
+        const double center_x =
+          d_pitch[0]*(i_floor + di + 0.5*(j_floor + dj));
+        const double center_y =
+          d_pitch[0]*s_sqrt_3_over_2*(j_floor + dj);
+
+        const double distance_squared =
+          (x - center_x)*(x - center_x) + (y - center_y)*(y - center_y);
+
+        if( distance_squared < min_distance_squared )
+        {
+          min_distance_squared = distance_squared;
+
+          element[0] = i_floor + di;
+          element[1] = j_floor + dj;
+        }
+      }
+    }
+  }
+}
+
+// Get the center of an element (lattice coordinates)
+void NativeLattice::getElementCenter( const int element[3],
+                                      double center[3] ) const
+{
+  if( d_type == RECTANGULAR )
+  {
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      if( NativeLattice::isAxisDivided( d_pitch[i] ) )
+        center[i] = d_origin[i] + (element[i] + 0.5)*d_pitch[i];
+      else
+        center[i] = 0.0;
+    }
+  }
+  else
+  {
+    center[0] = d_origin[0] + d_pitch[0]*(element[0] + 0.5*element[1]);
+    center[1] = d_origin[1] + d_pitch[0]*s_sqrt_3_over_2*element[1];
+
+    if( NativeLattice::isAxisDivided( d_pitch[2] ) )
+      center[2] = d_origin[2] + element[2]*d_pitch[2];
+    else
+      center[2] = 0.0;
+  }
+}
+
+// Get the distance to the element boundary (element coordinates)
+/*! \details The element coordinates have their origin at the element center.
+ * The element shift is the change in the element indices that occurs when
+ * the boundary is crossed. If the ray does not intersect the boundary the
+ * distance will be infinite.
+ */
+double NativeLattice::getDistanceToElementBoundary(
+                                                const double position[3],
+                                                const double direction[3],
+                                                int element_shift[3] ) const
+{
+  double min_distance = std::numeric_limits<double>::infinity();
+
+  element_shift[0] = 0;
+  element_shift[1] = 0;
+  element_shift[2] = 0;
+
+  // The rectangular axes (only the axial axis for hexagonal lattices)
+  const unsigned first_rectangular_axis = (d_type == RECTANGULAR ? 0 : 2);
+
+  for( unsigned i = first_rectangular_axis; i < 3; ++i )
+  {
+    if( !NativeLattice::isAxisDivided( d_pitch[i] ) || direction[i] == 0.0 )
+      continue;
+
+    const double half_pitch = 0.5*d_pitch[i];
+
+    const double distance =
+      (direction[i] > 0.0 ? half_pitch - position[i] :
+       -half_pitch - position[i])/direction[i];
+
+    if( distance < min_distance )
+    {
+      min_distance = distance;
+
+      element_shift[0] = 0;
+      element_shift[1] = 0;
+      element_shift[2] = 0;
+      element_shift[i] = (direction[i] > 0.0 ? 1 : -1);
+    }
+  }
+
+  if( d_type == HEXAGONAL )
+  {
+    const double half_pitch = 0.5*d_pitch[0];
+
+    for( unsigned side = 0; side < 6; ++side )
+    {
+      const double cos_angle = direction[0]*s_hex_normals[side][0] +
+        direction[1]*s_hex_normals[side][1];
+
+      if( cos_angle <= 0.0 )
+        continue;
+
+      const double distance = (half_pitch -
+                               position[0]*s_hex_normals[side][0] -
+                               position[1]*s_hex_normals[side][1])/cos_angle;
+
+      if( distance < min_distance )
+      {
+        min_distance = distance;
+
+        element_shift[0] = s_hex_shifts[side][0];
+        element_shift[1] = s_hex_shifts[side][1];
+        element_shift[2] = 0;
+      }
+    }
+  }
+
+  // Round-off can place the point slightly outside of the element
+  return std::max( min_distance, 0.0 );
+}
+
+// Get the distance to the closest element boundary (element coordinates)
+double NativeLattice::getDistanceToClosestElementBoundary(
+                                           const double position[3] ) const
+{
+  double min_distance = std::numeric_limits<double>::infinity();
+
+  const unsigned first_rectangular_axis = (d_type == RECTANGULAR ? 0 : 2);
+
+  for( unsigned i = first_rectangular_axis; i < 3; ++i )
+  {
+    if( NativeLattice::isAxisDivided( d_pitch[i] ) )
+    {
+      min_distance = std::min( min_distance,
+                               0.5*d_pitch[i] - std::fabs( position[i] ) );
+    }
+  }
+
+  if( d_type == HEXAGONAL )
+  {
+    for( unsigned side = 0; side < 6; ++side )
+    {
+      min_distance = std::min( min_distance,
+                               0.5*d_pitch[0] -
+                               position[0]*s_hex_normals[side][0] -
+                               position[1]*s_hex_normals[side][1] );
+    }
+  }
+
+  return std::max( min_distance, 0.0 );
+}
+
+// Get the unit normal of the element boundary that leads to a neighbor
+/*! \details The normal will point from the current element to the neighbor
+ * element.
+ */
+void NativeLattice::getElementBoundaryNormal( const int element_shift[3],
+                                              double normal[3] ) const
+{
+  normal[0] = 0.0;
+  normal[1] = 0.0;
+  normal[2] = element_shift[2];
+
+  if( d_type == RECTANGULAR )
+  {
+    normal[0] = element_shift[0];
+    normal[1] = element_shift[1];
+  }
+  else if( element_shift[2] == 0 )
+  {
+    for( unsigned side = 0; side < 6; ++side )
+    {
+      if( s_hex_shifts[side][0] == element_shift[0] &&
+          s_hex_shifts[side][1] == element_shift[1] )
+      {
+        normal[0] = s_hex_normals[side][0];
+        normal[1] = s_hex_normals[side][1];
+
+        break;
+      }
+    }
+  }
+}
+
+// Check if an axis is divided into elements
+bool NativeLattice::isAxisDivided( const double pitch )
+{
+  return pitch < std::numeric_limits<double>::infinity();
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeLattice.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeLattice.hpp
+//! \author Alex Robinson
+//! \brief  The native lattice class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_LATTICE_HPP
+#define GEOMETRY_NATIVE_LATTICE_HPP
+
+// Std Lib Includes
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Geometry_Model.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace Geometry{
+
+/*! The native lattice
+ * \details A lattice is a universe that tiles space with elements, each of
+ * which is filled with a (translated) copy of another universe. The lattice
+ * shares the universe id space of the cells, so a cell can be filled with a
+ * lattice just like it can be filled with a universe. The element that
+ * contains a point is found arithmetically instead of by searching.
+ *
+ * A rectangular lattice is defined by the lower left corner of element
+ * (0,0,0) and the element pitch along each axis. A hexagonal lattice has its
+ * axis parallel to the z-axis and is defined by the center of element (0,0,0),
+ * the flat-to-flat pitch and the axial pitch. Hexagonal elements are indexed
+ * using the skewed basis vectors (p,0) and (p/2,p*sqrt(3)/2), so element
+ * (i,j) shares a flat side with elements (i+-1,j), (i,j+-1), (i+1,j-1) and
+ * (i-1,j+1). Any axis can be left undivided by setting its pitch to infinity
+ * (the corresponding dimension must be one).
+ *
+ * The element universe ids are stored in x-fastest (i-fastest) order. Points
+ * outside of the element range are in the outer universe, which is optional.
+ * An element can be given the invalid universe id (Model::invalidCellId) to
+ * place it in the outer universe (e.g. the corners of a hexagonal assembly).
+ */
+class NativeLattice
+{
+
+public:
+
+  //! The lattice (universe) id type
+  typedef Model::EntityId EntityId;
+
+  //! The lattice type
+  enum Type{
+    RECTANGULAR = 0,
+    HEXAGONAL
+  };
+
+  //! Create a rectangular lattice
+  static NativeLattice createRectangularLattice(
+                  const EntityId id,
+                  const double lower_left_corner[3],
+                  const double pitch[3],
+                  const unsigned dimensions[3],
+                  const std::vector<EntityId>& element_universe_ids,
+                  const EntityId outer_universe_id = Model::invalidCellId() );
+
+  //! Create a hexagonal lattice
+  static NativeLattice createHexagonalLattice(
+                  const EntityId id,
+                  const double center[3],
+                  const double pitch,
+                  const double axial_pitch,
+                  const unsigned dimensions[3],
+                  const std::vector<EntityId>& element_universe_ids,
+                  const EntityId outer_universe_id = Model::invalidCellId() );
+
+  //! Destructor
+  ~NativeLattice()
+  { /* ... */ }
+
+  //! Get the lattice id
+  EntityId getId() const;
+
+  //! Get the lattice type
+  Type getType() const;
+
+  //! Get the lattice dimensions
+  const unsigned* getDimensions() const;
+
+  //! Get the number of elements
+  size_t getNumberOfElements() const;
+
+  //! Get the element universe ids (i-fastest order)
+  const std::vector<EntityId>& getElementUniverseIds() const;
+
+  //! Get the outer universe id
+  EntityId getOuterUniverseId() const;
+
+  //! Check if the element indices are in the lattice element range
+  bool isElementInRange( const int element[3] ) const;
+
+  //! Get the flat (i-fastest) index of an element
+  size_t getElementIndex( const int element[3] ) const;
+
+  //! Find the element that contains a point (lattice coordinates)
+  void findElement( const double position[3],
+                    const double direction[3],
+                    int element[3] ) const;
+
+  //! Get the center of an element (lattice coordinates)
+  void getElementCenter( const int element[3], double center[3] ) const;
+
+  //! Get the distance to the element boundary (element coordinates)
+  double getDistanceToElementBoundary( const double position[3],
+                                       const double direction[3],
+                                       int element_shift[3] ) const;
+
+  //! Get the distance to the closest element boundary (element coordinates)
+  double getDistanceToClosestElementBoundary(
+                                          const double position[3] ) const;
+
+  //! Get the unit normal of the element boundary that leads to a neighbor
+  void getElementBoundaryNormal( const int element_shift[3],
+                                 double normal[3] ) const;
+
+private:
+
+  // Default constructor
+  NativeLattice();
+
+  // Constructor
+  NativeLattice( const EntityId id,
+                 const Type type,
+                 const double origin[3],
+                 const double pitch[3],
+                 const unsigned dimensions[3],
+                 const std::vector<EntityId>& element_universe_ids,
+                 const EntityId outer_universe_id );
+
+  // Check if an axis is divided into elements
+  static bool isAxisDivided( const double pitch );
+
+  // Serialize the lattice
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The on element boundary tolerance (cm)
+  static const double s_tol;
+
+  // The lattice id
+  EntityId d_id;
+
+  // The lattice type
+  Type d_type;
+
+  // The lattice origin (lower left corner or center of element (0,0,0))
+  double d_origin[3];
+
+  // The element pitch (the hexagonal pitch is stored in the first two)
+  double d_pitch[3];
+
+  // The lattice dimensions
+  unsigned d_dimensions[3];
+
+  // The element universe ids (i-fastest order)
+  std::vector<EntityId> d_element_universe_ids;
+
+  // The outer universe id
+  EntityId d_outer_universe_id;
+};
+
+//! The invalid native lattice definition error
+class InvalidNativeLatticeDefinition : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeLatticeDefinition( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+// Serialize the lattice
+template<typename Archive>
+void NativeLattice::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & BOOST_SERIALIZATION_NVP( d_type );
+  ar & BOOST_SERIALIZATION_NVP( d_origin );
+  ar & BOOST_SERIALIZATION_NVP( d_pitch );
+  ar & BOOST_SERIALIZATION_NVP( d_dimensions );
+  ar & BOOST_SERIALIZATION_NVP( d_element_universe_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_outer_universe_id );
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeLattice, Geometry, 0 );
+
+#endif // end GEOMETRY_NATIVE_LATTICE_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeLattice.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,834 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.cpp
+//! \author Alex Robinson
+//! \brief  The native geometry model class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const size_t NativeModel::s_invalid_index =
+  std::numeric_limits<size_t>::max();
+
+const size_t NativeModel::s_root_universe_index = 0;
+
+// Default constructor
+NativeModel::NativeModel()
+{ /* ... */ }
+
+// Constructor
+/*! \details At least one of the cells must be a termination cell and every
+ * surface that is referenced by a cell definition must be present. Every
+ * universe (or lattice) that fills a cell must be present and no universe
+ * can contain itself.
+ */
+NativeModel::NativeModel( const std::vector<QuadricSurface>& surfaces,
+                          const std::vector<NativeCell>& cells,
+                          const std::vector<NativeLattice>& lattices )
+  : AdvancedModel(),
+    d_surfaces( surfaces ),
+    d_cells( cells ),
+    d_lattices( lattices )
+{
+  this->initialize();
+}
+
+// Initialize the model
+void NativeModel::initialize()
+{
+  d_surface_id_index_map.clear();
+  d_cell_id_index_map.clear();
+  d_cell_surface_indices.clear();
+  d_surface_cell_indices.clear();
+
+  // Create the surface id index map
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_surface_id_index_map.count( d_surfaces[i].getId() ),
+                        InvalidNativeGeometry,
+                        "Surface " << d_surfaces[i].getId() << " has been "
+                        "defined more than once!" );
+
+    d_surface_id_index_map[d_surfaces[i].getId()] = i;
+  }
+
+  // Create the cell id index map and the cell surface indices
+  d_cell_surface_indices.resize( d_cells.size() );
+  d_surface_cell_indices.resize( d_surfaces.size() );
+
+  bool termination_cell_found = false;
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_cell_id_index_map.count( d_cells[i].getId() ),
+                        InvalidNativeGeometry,
+                        "Cell " << d_cells[i].getId() << " has been "
+                        "defined more than once!" );
+
+    d_cell_id_index_map[d_cells[i].getId()] = i;
+
+    const std::vector<EntityId>& cell_surface_ids =
+      d_cells[i].getSurfaceIds();
+
+    d_cell_surface_indices[i].resize( cell_surface_ids.size() );
+
+    for( size_t j = 0; j < cell_surface_ids.size(); ++j )
+    {
+      std::unordered_map<EntityId,size_t>::const_iterator surface_index_it =
+        d_surface_id_index_map.find( cell_surface_ids[j] );
+
+      TEST_FOR_EXCEPTION( surface_index_it == d_surface_id_index_map.end(),
+                          InvalidNativeGeometry,
+                          "Cell " << d_cells[i].getId() << " references "
+                          "surface " << cell_surface_ids[j] << ", which "
+                          "does not exist!" );
+
+      d_cell_surface_indices[i][j] = surface_index_it->second;
+
+      d_surface_cell_indices[surface_index_it->second].push_back( i );
+    }
+
+    if( d_cells[i].isTermination() )
+    {
+      TEST_FOR_EXCEPTION( d_cells[i].isFilled(),
+                          InvalidNativeGeometry,
+                          "Termination cell " << d_cells[i].getId() <<
+                          " cannot be filled with a universe!" );
+
+      termination_cell_found = true;
+    }
+  }
+
+  // Make sure that at least one termination cell has been set
+  TEST_FOR_EXCEPTION( !termination_cell_found,
+                      InvalidNativeGeometry,
+                      "At least one termination cell must be set!" );
+
+  this->initializeUniverses();
+}
+
+// Initialize the universes and lattices
+/*! \details The root universe always has index zero. A bounding volume
+ * hierarchy is built over the cells of each universe.
+ */
+void NativeModel::initializeUniverses()
+{
+  d_universe_id_index_map.clear();
+  d_lattice_id_index_map.clear();
+  d_cell_universe_indices.clear();
+  d_cell_fill_universe_indices.clear();
+  d_cell_fill_lattice_indices.clear();
+  d_universe_cell_indices.clear();
+  d_universe_cell_bvhs.clear();
+  d_lattice_element_universe_indices.clear();
+  d_universe_cell_instance_counts.clear();
+  d_cell_fill_instance_offsets.clear();
+  d_lattice_element_instance_offsets.clear();
+
+  // Assign the universe indices (the root universe is always first)
+  d_universe_id_index_map[NativeCell::rootUniverseId()] =
+    s_root_universe_index;
+  d_universe_cell_indices.resize( 1 );
+
+  d_cell_universe_indices.resize( d_cells.size() );
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    std::unordered_map<EntityId,size_t>::const_iterator universe_index_it =
+      d_universe_id_index_map.find( d_cells[i].getUniverseId() );
+
+    size_t universe_index;
+
+    if( universe_index_it == d_universe_id_index_map.end() )
+    {
+      universe_index = d_universe_cell_indices.size();
+
+      d_universe_id_index_map[d_cells[i].getUniverseId()] = universe_index;
+      d_universe_cell_indices.resize( universe_index + 1 );
+    }
+    else
+      universe_index = universe_index_it->second;
+
+    d_cell_universe_indices[i] = universe_index;
+    d_universe_cell_indices[universe_index].push_back( i );
+  }
+
+  TEST_FOR_EXCEPTION( d_universe_cell_indices[s_root_universe_index].empty(),
+                      InvalidNativeGeometry,
+                      "The root universe does not contain any cells!" );
+
+  // Assign the lattice indices
+  for( size_t i = 0; i < d_lattices.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_lattice_id_index_map.count( d_lattices[i].getId() ) ||
+                        d_universe_id_index_map.count( d_lattices[i].getId() ),
+                        InvalidNativeGeometry,
+                        "Universe " << d_lattices[i].getId() << " has been "
+                        "defined more than once!" );
+
+    d_lattice_id_index_map[d_lattices[i].getId()] = i;
+  }
+
+  // Resolve the lattice element universes
+  d_lattice_element_universe_indices.resize( d_lattices.size() );
+
+  for( size_t i = 0; i < d_lattices.size(); ++i )
+  {
+    std::vector<EntityId> element_universe_ids =
+      d_lattices[i].getElementUniverseIds();
+    element_universe_ids.push_back( d_lattices[i].getOuterUniverseId() );
+
+    std::vector<size_t>& element_universe_indices =
+      d_lattice_element_universe_indices[i];
+
+    element_universe_indices.resize( element_universe_ids.size() );
+
+    for( size_t j = 0; j < element_universe_ids.size(); ++j )
+    {
+      if( element_universe_ids[j] == Model::invalidCellId() )
+      {
+        element_universe_indices[j] = s_invalid_index;
+        continue;
+      }
+
+      std::unordered_map<EntityId,size_t>::const_iterator universe_index_it =
+        d_universe_id_index_map.find( element_universe_ids[j] );
+
+      TEST_FOR_EXCEPTION( universe_index_it == d_universe_id_index_map.end(),
+                          InvalidNativeGeometry,
+                          "Lattice " << d_lattices[i].getId() << " references "
+                          "universe " << element_universe_ids[j] << ", which "
+                          "does not exist (lattice elements cannot be filled "
+                          "with lattices)!" );
+
+      TEST_FOR_EXCEPTION( universe_index_it->second == s_root_universe_index,
+                          InvalidNativeGeometry,
+                          "Lattice " << d_lattices[i].getId() << " cannot "
+                          "contain the root universe!" );
+
+      element_universe_indices[j] = universe_index_it->second;
+    }
+  }
+
+  // Resolve the cell fills
+  d_cell_fill_universe_indices.resize( d_cells.size(), s_invalid_index );
+  d_cell_fill_lattice_indices.resize( d_cells.size(), s_invalid_index );
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isFilled() )
+      continue;
+
+    const EntityId fill_universe_id = d_cells[i].getFillUniverseId();
+
+    std::unordered_map<EntityId,size_t>::const_iterator fill_index_it =
+      d_universe_id_index_map.find( fill_universe_id );
+
+    if( fill_index_it != d_universe_id_index_map.end() )
+      d_cell_fill_universe_indices[i] = fill_index_it->second;
+    else
+    {
+      fill_index_it = d_lattice_id_index_map.find( fill_universe_id );
+
+      TEST_FOR_EXCEPTION( fill_index_it == d_lattice_id_index_map.end(),
+                          InvalidNativeGeometry,
+                          "Cell " << d_cells[i].getId() << " is filled with "
+                          "universe " << fill_universe_id << ", which does "
+                          "not exist!" );
+
+      d_cell_fill_lattice_indices[i] = fill_index_it->second;
+    }
+  }
+
+  // Calculate the cell bounding boxes
+  d_cell_bounding_boxes.resize( d_cells.size() );
+
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    const std::vector<size_t>& cell_surface_indices =
+      d_cell_surface_indices[i];
+
+    d_cell_bounding_boxes[i] = d_cells[i].calculateBoundingBox(
+          [this, &cell_surface_indices]( const uint32_t local_surface_index,
+                                         const int sense ){
+            return d_surfaces[cell_surface_indices[local_surface_index]].getHalfSpaceBoundingBox( sense );
+          } );
+  }
+
+  // Construct the cell bounding volume hierarchy of each universe
+  d_universe_cell_bvhs.resize( d_universe_cell_indices.size() );
+
+  for( size_t i = 0; i < d_universe_cell_indices.size(); ++i )
+  {
+    std::vector<AxisAlignedBoundingBox>
+      cell_boxes( d_universe_cell_indices[i].size() );
+
+    for( size_t j = 0; j < d_universe_cell_indices[i].size(); ++j )
+      cell_boxes[j] = d_cell_bounding_boxes[d_universe_cell_indices[i][j]];
+
+    d_universe_cell_bvhs[i] = BoundingVolumeHierarchy( cell_boxes );
+  }
+
+  // Number the cell instances (this also detects recursive universes)
+  d_universe_cell_instance_counts.resize( d_universe_cell_indices.size() );
+  d_cell_fill_instance_offsets.resize( d_cells.size() );
+  d_lattice_element_instance_offsets.resize( d_lattices.size() );
+
+  std::vector<unsigned> universe_heights( d_universe_cell_indices.size(), 0 );
+  std::vector<bool> calculated_lattices( d_lattices.size(), false );
+
+  for( size_t i = 0; i < d_universe_cell_indices.size(); ++i )
+  {
+    const unsigned height =
+      this->calculateUniverseCellInstanceCounts( i,
+                                                 universe_heights,
+                                                 calculated_lattices );
+
+    TEST_FOR_EXCEPTION( height > NativeNavigator::s_max_path_length,
+                        InvalidNativeGeometry,
+                        "The universes are nested more than "
+                        << NativeNavigator::s_max_path_length <<
+                        " levels deep!" );
+  }
+}
+
+// Calculate the cell instance counts of a universe
+/*! \details The instances of a cell are numbered in the order that they are
+ * encountered in a depth first traversal of the universe (cells in the order
+ * that they were defined, lattice elements in i-fastest order with the outer
+ * universe last). The instance offsets of each fill record the number of
+ * instances of each cell that come before the fill, which allows the
+ * navigator to calculate the instance of a cell by summing the offsets along
+ * its path. All of the out of range elements of a lattice share a single set
+ * of outer universe instances. The height of the universe (the number of
+ * nested levels that it contains, including its own) will be returned.
+ */
+unsigned NativeModel::calculateUniverseCellInstanceCounts(
+                                    const size_t universe_index,
+                                    std::vector<unsigned>& universe_heights,
+                                    std::vector<bool>& calculated_lattices )
+{
+  // The height of a universe that is being calculated is set to the max value
+  const unsigned in_progress = std::numeric_limits<unsigned>::max();
+
+  const std::vector<size_t>& universe_cell_indices =
+    d_universe_cell_indices[universe_index];
+
+  TEST_FOR_EXCEPTION( universe_heights[universe_index] == in_progress,
+                      InvalidNativeGeometry,
+                      "Universe " << d_cells[universe_cell_indices.front()].getUniverseId() <<
+                      " contains itself!" );
+
+  if( universe_heights[universe_index] > 0 )
+    return universe_heights[universe_index];
+
+  universe_heights[universe_index] = in_progress;
+
+  unsigned max_fill_height = 0;
+
+  CellInstanceCountMap& universe_counts =
+    d_universe_cell_instance_counts[universe_index];
+
+  for( size_t i = 0; i < universe_cell_indices.size(); ++i )
+  {
+    const size_t cell_index = universe_cell_indices[i];
+
+    const size_t fill_universe_index =
+      d_cell_fill_universe_indices[cell_index];
+    const size_t fill_lattice_index = d_cell_fill_lattice_indices[cell_index];
+
+    // Count the instances in the fill
+    CellInstanceCountMap fill_counts;
+
+    if( fill_universe_index != s_invalid_index )
+    {
+      max_fill_height = std::max( max_fill_height,
+                                  this->calculateUniverseCellInstanceCounts(
+                                                        fill_universe_index,
+                                                        universe_heights,
+                                                        calculated_lattices ) );
+
+      fill_counts = d_universe_cell_instance_counts[fill_universe_index];
+    }
+    else if( fill_lattice_index != s_invalid_index )
+    {
+      const std::vector<size_t>& element_universe_indices =
+        d_lattice_element_universe_indices[fill_lattice_index];
+
+      std::vector<CellInstanceCountMap>& element_offsets =
+        d_lattice_element_instance_offsets[fill_lattice_index];
+
+      if( !calculated_lattices[fill_lattice_index] )
+        element_offsets.resize( element_universe_indices.size() );
+
+      for( size_t j = 0; j < element_universe_indices.size(); ++j )
+      {
+        if( element_universe_indices[j] == s_invalid_index )
+          continue;
+
+        max_fill_height = std::max( max_fill_height,
+                                    this->calculateUniverseCellInstanceCounts(
+                                                element_universe_indices[j],
+                                                universe_heights,
+                                                calculated_lattices ) );
+
+        const CellInstanceCountMap& element_counts =
+          d_universe_cell_instance_counts[element_universe_indices[j]];
+
+        for( CellInstanceCountMap::const_iterator count_it =
+               element_counts.begin();
+             count_it != element_counts.end();
+             ++count_it )
+        {
+          if( !calculated_lattices[fill_lattice_index] )
+            element_offsets[j][count_it->first] = fill_counts[count_it->first];
+
+          fill_counts[count_it->first] += count_it->second;
+        }
+      }
+
+      calculated_lattices[fill_lattice_index] = true;
+    }
+    else
+    {
+      universe_counts[cell_index] += 1;
+
+      continue;
+    }
+
+    // Record the instance offsets of the fill
+    CellInstanceCountMap& fill_offsets =
+      d_cell_fill_instance_offsets[cell_index];
+
+    for( CellInstanceCountMap::const_iterator count_it = fill_counts.begin();
+         count_it != fill_counts.end();
+         ++count_it )
+    {
+      fill_offsets[count_it->first] = universe_counts[count_it->first];
+
+      universe_counts[count_it->first] += count_it->second;
+    }
+  }
+
+  universe_heights[universe_index] = max_fill_height + 1;
+
+  return universe_heights[universe_index];
+}
+
+// Get the instance offset of a cell
+size_t NativeModel::getCellInstanceOffset( const CellInstanceCountMap& offsets,
+                                           const size_t cell_index )
+{
+  CellInstanceCountMap::const_iterator offset_it = offsets.find( cell_index );
+
+  if( offset_it != offsets.end() )
+    return offset_it->second;
+  else
+    return 0;
+}
+
+// Get the model name
+std::string NativeModel::getName() const
+{
+  return "Native";
+}
+
+// Check if the model has cell estimator data
+bool NativeModel::hasCellEstimatorData() const
+{
+  return false;
+}
+
+// Get the material ids
+void NativeModel::getMaterialIds( MaterialIdSet& material_ids ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      material_ids.insert( d_cells[i].getMaterialId() );
+  }
+}
+
+// Get the cells
+/*! \details Cells that are filled with a universe are never returned since
+ * a particle can never be in one.
+ */
+void NativeModel::getCells( CellIdSet& cell_set,
+                            const bool include_void_cells,
+                            const bool include_termination_cells ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    // Check if it is a filled cell
+    if( d_cells[i].isFilled() )
+      continue;
+    // Check if it is a termination cell
+    else if( d_cells[i].isTermination() )
+    {
+      if( include_termination_cells )
+        cell_set.insert( d_cells[i].getId() );
+    }
+    // Check if it is a void cell
+    else if( d_cells[i].isVoid() )
+    {
+      if( include_void_cells )
+        cell_set.insert( d_cells[i].getId() );
+    }
+    else
+      cell_set.insert( d_cells[i].getId() );
+  }
+}
+
+// Get the cell material ids
+/*! \details Only the cells that are not void will be added to the map.
+ */
+void NativeModel::getCellMaterialIds(
+                                     CellIdMatIdMap& cell_id_mat_id_map ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      cell_id_mat_id_map[d_cells[i].getId()] = d_cells[i].getMaterialId();
+  }
+}
+
+// Get the cell densities
+/*! \details Only the cells that are not void will be added to the map.
+ */
+void NativeModel::getCellDensities(
+                                  CellIdDensityMap& cell_id_density_map ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( !d_cells[i].isVoid() )
+      cell_id_density_map[d_cells[i].getId()] = d_cells[i].getDensity();
+  }
+}
+
+// Get the cell estimator data
+void NativeModel::getCellEstimatorData( CellEstimatorIdDataMap& ) const
+{ /* ... */ }
+
+// Check if a cell exists
+bool NativeModel::doesCellExist( const EntityId cell ) const
+{
+  return d_cell_id_index_map.find( cell ) != d_cell_id_index_map.end();
+}
+
+// Get the number of cells
+size_t NativeModel::getNumberOfCells() const
+{
+  return d_cells.size();
+}
+
+// Check if the cell is a termination cell
+bool NativeModel::isTerminationCell( const EntityId cell ) const
+{
+  return d_cells[this->getCellIndex( cell )].isTermination();
+}
+
+// Check if a cell is void
+bool NativeModel::isVoidCell( const EntityId cell ) const
+{
+  return d_cells[this->getCellIndex( cell )].isVoid();
+}
+
+// Get the cell volume
+auto NativeModel::getCellVolume( const EntityId cell ) const -> Volume
+{
+  return Volume::from_value( d_cells[this->getCellIndex( cell )].getVolume() );
+}
+
+// Get the bounding box of a cell
+/*! \details Only cells in the root universe have a bounding box in the
+ * global coordinate system. False will be returned for all other cells and
+ * for cells that are not bounded in every dimension.
+ */
+bool NativeModel::getCellBoundingBox( const EntityId cell,
+                                      Length lower_bounds[3],
+                                      Length upper_bounds[3] ) const
+{
+  const size_t cell_index = this->getCellIndex( cell );
+
+  if( d_cell_universe_indices[cell_index] != s_root_universe_index )
+    return false;
+
+  const AxisAlignedBoundingBox& cell_box = d_cell_bounding_boxes[cell_index];
+
+  if( !cell_box.isFinite() )
+    return false;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    lower_bounds[i] = Length::from_value( cell_box.getLowerBound( i ) );
+    upper_bounds[i] = Length::from_value( cell_box.getUpperBound( i ) );
+  }
+
+  return true;
+}
+
+// Get the number of instances of a cell
+/*! \details Only the instances that can be reached from the root universe
+ * are counted.
+ */
+size_t NativeModel::getNumberOfCellInstances( const EntityId cell ) const
+{
+  return NativeModel::getCellInstanceOffset(
+                   d_universe_cell_instance_counts[s_root_universe_index],
+                   this->getCellIndex( cell ) );
+}
+
+// Check if the model has surface estimator data
+bool NativeModel::hasSurfaceEstimatorData() const
+{
+  return false;
+}
+
+// Get the surfaces
+void NativeModel::getSurfaces( SurfaceIdSet& surfaces ) const
+{
+  for( size_t i = 0; i < d_surfaces.size(); ++i )
+    surfaces.insert( d_surfaces[i].getId() );
+}
+
+// Get the surface estimator data
+void NativeModel::getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& ) const
+{ /* ... */ }
+
+// Check if a surface exists
+bool NativeModel::doesSurfaceExist( const EntityId surface_id ) const
+{
+  return d_surface_id_index_map.find( surface_id ) !=
+    d_surface_id_index_map.end();
+}
+
+// Get the surface area
+auto NativeModel::getSurfaceArea( const EntityId surface_id ) const -> Area
+{
+  return Area::from_value(
+                    d_surfaces[this->getSurfaceIndex( surface_id )].getArea() );
+}
+
+// Check if the surface is a reflecting surface
+bool NativeModel::isReflectingSurface( const EntityId surface_id ) const
+{
+  return d_surfaces[this->getSurfaceIndex( surface_id )].isReflecting();
+}
+
+// Create a raw, heap-allocated navigator
+NativeNavigator* NativeModel::createNavigatorAdvanced(
+    const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  return new NativeNavigator( this->shared_from_this(),
+                              advance_complete_callback );
+}
+
+// Create a raw, heap-allocated navigator (no callback)
+NativeNavigator* NativeModel::createNavigatorAdvanced() const
+{
+  return new NativeNavigator( this->shared_from_this() );
+}
+
+// Check if the model has been initialized
+bool NativeModel::isInitialized() const
+{
+  return true;
+}
+
+// Initialize the model just-in-time
+/*! \details The native model is always initialized when it is constructed
+ * or loaded from an archive.
+ */
+void NativeModel::initializeJustInTime()
+{ /* ... */ }
+
+// Get the cell index
+/*! \details The cell index is the position of the cell in the cell array
+ * that was passed to the constructor.
+ */
+size_t NativeModel::getCellIndex( const EntityId cell ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell ) );
+
+  return d_cell_id_index_map.find( cell )->second;
+}
+
+// Get the surface index
+size_t NativeModel::getSurfaceIndex( const EntityId surface ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( this->doesSurfaceExist( surface ) );
+
+  return d_surface_id_index_map.find( surface )->second;
+}
+
+// Check if a point is in a cell
+/*! \details The direction is used to determine the sense of the point
+ * w.r.t. any surface that the point is on.
+ */
+bool NativeModel::isPointInCell( const size_t cell_index,
+                                 const double position[3],
+                                 const double direction[3] ) const
+{
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cells.size() );
+
+  const std::vector<size_t>& cell_surface_indices =
+    d_cell_surface_indices[cell_index];
+
+  return d_cells[cell_index].isInside(
+           [this, &cell_surface_indices, position, direction](
+                                        const uint32_t local_surface_index ){
+             return d_surfaces[cell_surface_indices[local_surface_index]].getSense( position, direction );
+           } );
+}
+
+// Find the index of the cell in a universe that contains a point
+/*! \details The position must be in the coordinate system of the universe.
+ * Only the cells with bounding boxes that contain the point will be tested.
+ * If no cell contains the point the invalid index will be returned.
+ */
+size_t NativeModel::findCellIndexContainingPoint(
+                                             const size_t universe_index,
+                                             const double position[3],
+                                             const double direction[3] ) const
+{
+  // Make sure that the universe index is valid
+  testPrecondition( universe_index < d_universe_cell_indices.size() );
+
+  const std::vector<size_t>& universe_cell_indices =
+    d_universe_cell_indices[universe_index];
+
+  size_t found_cell_index = s_invalid_index;
+
+  d_universe_cell_bvhs[universe_index].visitBoxesContainingPoint(
+                position,
+                [this, &universe_cell_indices, position, direction,
+                 &found_cell_index]( const size_t local_index ){
+                  const size_t cell_index = universe_cell_indices[local_index];
+
+                  if( this->isPointInCell( cell_index, position, direction ) )
+                  {
+                    found_cell_index = cell_index;
+
+                    return true;
+                  }
+                  else
+                    return false;
+                } );
+
+  return found_cell_index;
+}
+
+// Find the index of the cell on the other side of a surface
+/*! \details The cells in the same universe that are bounded by the surface
+ * will be tested first. A search of the universe will only be conducted if
+ * none of those cells contains the point (e.g. when a cell is bounded by a
+ * complemented cell). The position must be in the coordinate system of the
+ * universe.
+ */
+size_t NativeModel::findBoundaryCellIndex( const size_t cell_index,
+                                           const size_t surface_index,
+                                           const double position[3],
+                                           const double direction[3] ) const
+{
+  // Make sure that the surface index is valid
+  testPrecondition( surface_index < d_surfaces.size() );
+
+  const std::vector<size_t>& neighbor_cell_indices =
+    d_surface_cell_indices[surface_index];
+
+  const size_t universe_index = d_cell_universe_indices[cell_index];
+
+  for( size_t i = 0; i < neighbor_cell_indices.size(); ++i )
+  {
+    if( neighbor_cell_indices[i] == cell_index )
+      continue;
+
+    if( d_cell_universe_indices[neighbor_cell_indices[i]] != universe_index )
+      continue;
+
+    if( this->isPointInCell( neighbor_cell_indices[i], position, direction ) )
+      return neighbor_cell_indices[i];
+  }
+
+  return this->findCellIndexContainingPoint( universe_index,
+                                             position,
+                                             direction );
+}
+
+// Get the distance to the boundary of a cell along a ray
+/*! \details If the ray does not intersect any of the cell surfaces the
+ * returned distance will be infinite and the surface index will be invalid.
+ */
+double NativeModel::getDistanceToCellBoundary( const size_t cell_index,
+                                               const double position[3],
+                                               const double direction[3],
+                                               size_t& surface_index ) const
+{
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cells.size() );
+
+  const std::vector<size_t>& cell_surface_indices =
+    d_cell_surface_indices[cell_index];
+
+  double min_distance = std::numeric_limits<double>::infinity();
+  surface_index = s_invalid_index;
+
+  for( size_t i = 0; i < cell_surface_indices.size(); ++i )
+  {
+    const double distance =
+      d_surfaces[cell_surface_indices[i]].getDistance( position, direction );
+
+    if( distance < min_distance )
+    {
+      min_distance = distance;
+      surface_index = cell_surface_indices[i];
+    }
+  }
+
+  return min_distance;
+}
+
+// Get the distance to the closest boundary of a cell in any direction
+double NativeModel::getDistanceToClosestCellBoundary(
+                                          const size_t cell_index,
+                                          const double position[3] ) const
+{
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cells.size() );
+
+  const std::vector<size_t>& cell_surface_indices =
+    d_cell_surface_indices[cell_index];
+
+  double min_distance = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < cell_surface_indices.size(); ++i )
+  {
+    min_distance = std::min( min_distance,
+                             d_surfaces[cell_surface_indices[i]].getDistanceToClosestPoint( position ) );
+  }
+
+  return min_distance;
+}
+
+} // end Geometry namespace
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( NativeModel, Geometry );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.cpp
+//---------------------------------------------------------------------------//
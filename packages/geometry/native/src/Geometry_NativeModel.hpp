@@ -0,0 +1,334 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.hpp
+//! \author Alex Robinson
+//! \brief  The native geometry model class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_MODEL_HPP
+#define GEOMETRY_NATIVE_MODEL_HPP
+
+// Std Lib Includes
+#include <string>
+#include <stdexcept>
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Geometry_AdvancedModel.hpp"
+#include "Geometry_QuadricSurface.hpp"
+#include "Geometry_NativeCell.hpp"
+#include "Geometry_NativeLattice.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_BoundingVolumeHierarchy.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_Vector.hpp"
+
+namespace Geometry{
+
+/*! The native geometry model
+ * \details The native model is a constructive solid geometry (CSG) model
+ * that is built from quadric surfaces and cells that are defined by logical
+ * combinations of the surface half spaces. No external geometry library is
+ * required. All of the geometry data is immutable once the model has been
+ * constructed so any number of navigators (e.g. one per thread) can share a
+ * single model. To accelerate cell lookups a bounding volume hierarchy is
+ * built over the cell bounding boxes and the cells that neighbor each surface
+ * are cached so that a surface crossing only needs to test a few cells.
+ *
+ * Repeated structures are supported through universes and lattices (see
+ * Geometry::NativeCell::setFill and Geometry::NativeLattice). A structure is
+ * only stored once no matter how many times it is placed, and every universe
+ * has its own bounding volume hierarchy. Each placement of a cell is a cell
+ * instance. The instances of a cell are numbered contiguously so that tallies
+ * and material data can be resolved per instance (see
+ * Geometry::NativeNavigator::getCurrentCellInstance).
+ */
+class NativeModel : public AdvancedModel,
+                    public std::enable_shared_from_this<NativeModel>
+{
+
+public:
+
+  //! Constructor
+  NativeModel( const std::vector<QuadricSurface>& surfaces,
+               const std::vector<NativeCell>& cells,
+               const std::vector<NativeLattice>& lattices =
+               std::vector<NativeLattice>() );
+
+  //! Destructor
+  ~NativeModel()
+  { /* ... */ }
+
+  //! Get the model name
+  std::string getName() const override;
+
+  //! Check if the model has cell estimator data
+  bool hasCellEstimatorData() const override;
+
+  //! Get the material ids
+  void getMaterialIds( MaterialIdSet& material_ids ) const override;
+
+  //! Get the cells
+  void getCells( CellIdSet& cell_set,
+                 const bool include_void_cells,
+                 const bool include_termination_cells ) const override;
+
+  //! Get the cell material ids
+  void getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const override;
+
+  //! Get the cell densities
+  void getCellDensities( CellIdDensityMap& cell_density_map ) const override;
+
+  //! Get the cell estimator data
+  void getCellEstimatorData(
+           CellEstimatorIdDataMap& cell_estimator_id_data_map ) const override;
+
+  //! Check if a cell exists
+  bool doesCellExist( const EntityId cell ) const override;
+
+  //! Get the number of cells
+  size_t getNumberOfCells() const override;
+
+  //! Get the cell index
+  size_t getCellIndex( const EntityId cell ) const override;
+
+  //! Check if the cell is a termination cell
+  bool isTerminationCell( const EntityId cell ) const override;
+
+  //! Check if a cell is void
+  bool isVoidCell( const EntityId cell ) const override;
+
+  //! Get the cell volume
+  Volume getCellVolume( const EntityId cell ) const override;
+
+  //! Get the bounding box of a cell
+  bool getCellBoundingBox( const EntityId cell,
+                           Length lower_bounds[3],
+                           Length upper_bounds[3] ) const override;
+
+  //! Get the number of instances of a cell
+  size_t getNumberOfCellInstances( const EntityId cell ) const override;
+
+  //! Check if the model has surface estimator data
+  bool hasSurfaceEstimatorData() const override;
+
+  //! Get the surfaces
+  void getSurfaces( SurfaceIdSet& surfaces ) const override;
+
+  //! Get the surface estimator data
+  void getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& surface_estimator_id_data_map ) const override;
+
+  //! Check if a surface exists
+  bool doesSurfaceExist( const EntityId surface_id ) const override;
+
+  //! Get the surface area
+  Area getSurfaceArea( const EntityId surface_id ) const override;
+
+  //! Check if the surface is a reflecting surface
+  bool isReflectingSurface( const EntityId surface_id ) const override;
+
+  //! Create a raw, heap-allocated navigator
+  NativeNavigator* createNavigatorAdvanced(
+                                    const Navigator::AdvanceCompleteCallback&
+                                    advance_complete_callback ) const override;
+
+  //! Create a raw, heap-allocated navigator (no callback)
+  NativeNavigator* createNavigatorAdvanced() const override;
+
+  //! Check if the model has been initialized
+  bool isInitialized() const final override;
+
+protected:
+
+  //! Initialize the model just-in-time
+  void initializeJustInTime() final override;
+
+private:
+
+  // The cell instance count map type
+  typedef std::unordered_map<size_t,size_t> CellInstanceCountMap;
+
+  // Default constructor
+  NativeModel();
+
+  // Initialize the model
+  void initialize();
+
+  // Initialize the universes and lattices
+  void initializeUniverses();
+
+  // Calculate the cell instance counts of a universe
+  unsigned calculateUniverseCellInstanceCounts(
+                                    const size_t universe_index,
+                                    std::vector<unsigned>& universe_heights,
+                                    std::vector<bool>& calculated_lattices );
+
+  // Get the instance offset of a cell
+  static size_t getCellInstanceOffset( const CellInstanceCountMap& offsets,
+                                       const size_t cell_index );
+
+  // Get the surface index
+  size_t getSurfaceIndex( const EntityId surface ) const;
+
+  // Check if a point is in a cell
+  bool isPointInCell( const size_t cell_index,
+                      const double position[3],
+                      const double direction[3] ) const;
+
+  // Find the index of the cell in a universe that contains a point
+  size_t findCellIndexContainingPoint( const size_t universe_index,
+                                       const double position[3],
+                                       const double direction[3] ) const;
+
+  // Find the index of the cell on the other side of a surface
+  size_t findBoundaryCellIndex( const size_t cell_index,
+                                const size_t surface_index,
+                                const double position[3],
+                                const double direction[3] ) const;
+
+  // Get the distance to the boundary of a cell along a ray
+  double getDistanceToCellBoundary( const size_t cell_index,
+                                    const double position[3],
+                                    const double direction[3],
+                                    size_t& surface_index ) const;
+
+  // Get the distance to the closest boundary of a cell in any direction
+  double getDistanceToClosestCellBoundary( const size_t cell_index,
+                                           const double position[3] ) const;
+
+  // Save the model to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the model from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // Declare the NativeNavigator as a friend
+  friend class NativeNavigator;
+
+  // The invalid index
+  static const size_t s_invalid_index;
+
+  // The root universe index
+  static const size_t s_root_universe_index;
+
+  // The surfaces
+  std::vector<QuadricSurface> d_surfaces;
+
+  // The cells
+  std::vector<NativeCell> d_cells;
+
+  // The lattices
+  std::vector<NativeLattice> d_lattices;
+
+  // The surface id index map
+  std::unordered_map<EntityId,size_t> d_surface_id_index_map;
+
+  // The cell id index map
+  std::unordered_map<EntityId,size_t> d_cell_id_index_map;
+
+  // The surface indices of each cell (cell local index order)
+  std::vector<std::vector<size_t> > d_cell_surface_indices;
+
+  // The indices of the cells that are bounded by each surface
+  std::vector<std::vector<size_t> > d_surface_cell_indices;
+
+  // The universe id index map (lattices are not included)
+  std::unordered_map<EntityId,size_t> d_universe_id_index_map;
+
+  // The lattice id index map
+  std::unordered_map<EntityId,size_t> d_lattice_id_index_map;
+
+  // The index of the universe that contains each cell
+  std::vector<size_t> d_cell_universe_indices;
+
+  // The index of the universe that fills each cell (if any)
+  std::vector<size_t> d_cell_fill_universe_indices;
+
+  // The index of the lattice that fills each cell (if any)
+  std::vector<size_t> d_cell_fill_lattice_indices;
+
+  // The indices of the cells in each universe
+  std::vector<std::vector<size_t> > d_universe_cell_indices;
+
+  // The bounding box of each cell (universe coordinates)
+  std::vector<AxisAlignedBoundingBox> d_cell_bounding_boxes;
+
+  // The cell bounding volume hierarchy of each universe
+  std::vector<BoundingVolumeHierarchy> d_universe_cell_bvhs;
+
+  // The element universe indices of each lattice (outer universe last)
+  std::vector<std::vector<size_t> > d_lattice_element_universe_indices;
+
+  // The number of instances of each cell in each universe
+  std::vector<CellInstanceCountMap> d_universe_cell_instance_counts;
+
+  // The cell instance offsets of the universe (or lattice) in each cell
+  std::vector<CellInstanceCountMap> d_cell_fill_instance_offsets;
+
+  // The cell instance offsets of each lattice element (outer universe last)
+  std::vector<std::vector<CellInstanceCountMap> >
+  d_lattice_element_instance_offsets;
+};
+
+// Save the model to an archive
+template<typename Archive>
+void NativeModel::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Save the surfaces, cells and lattices - all other data will be
+  // reinitialized
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_lattices );
+}
+
+// Load the model from an archive
+template<typename Archive>
+void NativeModel::load( Archive& ar, const unsigned version )
+{
+  // Load the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Load the surfaces, cells and lattices only - all other data must be
+  // reinitialized
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_lattices );
+
+  this->initialize();
+}
+
+//! The invalid native geometry error
+class InvalidNativeGeometry : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeGeometry( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeModel, Geometry, 0 );
+BOOST_SERIALIZATION_ENABLE_SHARED_FROM_THIS( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( NativeModel, Geometry );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, NativeModel );
+
+#endif // end GEOMETRY_NATIVE_MODEL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,871 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  The native model navigator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const unsigned NativeNavigator::s_max_path_length;
+
+// Constructor
+NativeNavigator::NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback )
+  : Navigator( advance_complete_callback ),
+    d_native_model( native_model ),
+    d_path_length( 0 ),
+    d_intersection_distance( std::numeric_limits<double>::infinity() ),
+    d_intersection_surface_index( NativeModel::s_invalid_index ),
+    d_intersection_level( 0 )
+{
+  // Make sure that the model is valid
+  testPrecondition( native_model.get() );
+
+  d_position[0] = 0.0*boost::units::cgs::centimeter;
+  d_position[1] = 0.0*boost::units::cgs::centimeter;
+  d_position[2] = 0.0*boost::units::cgs::centimeter;
+
+  d_direction[0] = 0.0;
+  d_direction[1] = 0.0;
+  d_direction[2] = 1.0;
+
+  d_intersection_element_shift[0] = 0;
+  d_intersection_element_shift[1] = 0;
+  d_intersection_element_shift[2] = 0;
+}
+
+// Copy constructor
+/*! \details This constructor should only be used within the clone method. The
+ * Navigator::AdvanceCompleteCallback will also be copied
+ */
+NativeNavigator::NativeNavigator( const NativeNavigator& other )
+  : Navigator( other ),
+    d_native_model( other.d_native_model )
+{
+  this->copyState( other );
+}
+
+// Get the location of a point w.r.t. a given cell
+/*! \details A point is on the cell boundary if it is inside of the cell
+ * when traveling in the given direction but outside of the cell when
+ * traveling in the opposite direction (or vice versa). A point is inside of
+ * a cell that is not in the root universe if any instance of the cell
+ * contains the point.
+ */
+PointLocation NativeNavigator::getPointLocation(
+                                            const Length position[3],
+                                            const double direction[3],
+                                            const EntityId cell ) const
+{
+  const size_t cell_index = d_native_model->getCellIndex( cell );
+
+  const double* raw_position = Utility::reinterpretAsRaw( position );
+
+  const double reverse_direction[3] =
+    {-direction[0], -direction[1], -direction[2]};
+
+  bool inside, inside_reverse;
+
+  if( d_native_model->d_cell_universe_indices[cell_index] ==
+      NativeModel::s_root_universe_index )
+  {
+    inside =
+      d_native_model->isPointInCell( cell_index, raw_position, direction );
+
+    inside_reverse =
+      d_native_model->isPointInCell( cell_index, raw_position, reverse_direction );
+  }
+  else
+  {
+    auto is_cell_on_path = [this, cell_index, raw_position](
+                                              const double path_direction[3] ){
+      PathLevel path[s_max_path_length];
+      unsigned path_length;
+
+      if( !this->findPath( raw_position, path_direction, path, path_length ) )
+        return false;
+
+      for( unsigned i = 0; i < path_length; ++i )
+      {
+        if( path[i].cell_index == cell_index )
+          return true;
+      }
+
+      return false;
+    };
+
+    inside = is_cell_on_path( direction );
+    inside_reverse = is_cell_on_path( reverse_direction );
+  }
+
+  if( inside && inside_reverse )
+    return POINT_INSIDE_CELL;
+  else if( !inside && !inside_reverse )
+    return POINT_OUTSIDE_CELL;
+  else
+    return POINT_ON_CELL;
+}
+
+// Get the surface normal at a point on the surface
+/*! \details The position must be in the coordinate system of the universe
+ * that contains the surface.
+ */
+void NativeNavigator::getSurfaceNormal( const EntityId surface_id,
+                                        const Length position[3],
+                                        const double direction[3],
+                                        double normal[3] ) const
+{
+  const QuadricSurface& surface =
+    d_native_model->d_surfaces[d_native_model->getSurfaceIndex( surface_id )];
+
+  surface.getUnitNormal( Utility::reinterpretAsRaw( position ), normal );
+
+  // The dot product of the direction and normal must be positive
+  if( Utility::calculateCosineOfAngleBetweenUnitVectors( direction, normal ) < 0.0 )
+  {
+    normal[0] = -normal[0];
+    normal[1] = -normal[1];
+    normal[2] = -normal[2];
+  }
+}
+
+// Find the cell that contains a given ray
+/*! \details Only the cached cells in the root universe can be checked
+ * directly. The universe path must be found for all other cells.
+ */
+auto NativeNavigator::findCellContainingRay(
+                          const Length position[3],
+                          const double direction[3],
+                          CellIdSet& found_cell_cache ) const -> EntityId
+{
+  const double* raw_position = Utility::reinterpretAsRaw( position );
+
+  // Check the cache first
+  for( CellIdSet::const_iterator cell_it = found_cell_cache.begin();
+       cell_it != found_cell_cache.end();
+       ++cell_it )
+  {
+    if( !d_native_model->doesCellExist( *cell_it ) )
+      continue;
+
+    const size_t cell_index = d_native_model->getCellIndex( *cell_it );
+
+    if( d_native_model->d_cell_universe_indices[cell_index] !=
+        NativeModel::s_root_universe_index ||
+        d_native_model->d_cells[cell_index].isFilled() )
+      continue;
+
+    if( d_native_model->isPointInCell( cell_index, raw_position, direction ) )
+      return *cell_it;
+  }
+
+  EntityId cell = this->findCellContainingRay( position, direction );
+
+  found_cell_cache.insert( cell );
+
+  return cell;
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay(
+                                 const Length position[3],
+                                 const double direction[3] ) const -> EntityId
+{
+  PathLevel path[s_max_path_length];
+  unsigned path_length;
+
+  TEST_FOR_EXCEPTION( !this->findPath( Utility::reinterpretAsRaw( position ),
+                                       direction,
+                                       path,
+                                       path_length ),
+                      GeometryError,
+                      "Could not find the cell that contains point ("
+                      << position[0] << "," << position[1] << ","
+                      << position[2] << ")!" );
+
+  return d_native_model->d_cells[path[path_length-1].cell_index].getId();
+}
+
+// Check if an internal ray has been set
+bool NativeNavigator::isStateSet() const
+{
+  return d_path_length > 0;
+}
+
+// Set the internal ray with unknown starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_position[0] = x_position;
+  d_position[1] = y_position;
+  d_position[2] = z_position;
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  if( !this->findPath( this->getRawPosition(),
+                       d_direction,
+                       d_path,
+                       d_path_length ) )
+  {
+    d_path_length = 0;
+
+    THROW_EXCEPTION( GeometryError,
+                     "Could not find the cell that contains point ("
+                     << x_position << "," << y_position << ","
+                     << z_position << ")!" );
+  }
+
+  this->updateIntersection();
+}
+
+// Set the internal ray with known starting cell
+/*! \details The universe path to a cell that is not in the root universe
+ * is not unique so the path will be found from the position.
+ */
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction,
+                                const EntityId start_cell )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  const size_t cell_index = d_native_model->getCellIndex( start_cell );
+
+  if( d_native_model->d_cell_universe_indices[cell_index] ==
+      NativeModel::s_root_universe_index &&
+      !d_native_model->d_cells[cell_index].isFilled() )
+  {
+    d_position[0] = x_position;
+    d_position[1] = y_position;
+    d_position[2] = z_position;
+
+    d_direction[0] = x_direction;
+    d_direction[1] = y_direction;
+    d_direction[2] = z_direction;
+
+    PathLevel& root_level = d_path[0];
+
+    root_level.universe_index = NativeModel::s_root_universe_index;
+    root_level.cell_index = cell_index;
+    root_level.lattice_index = NativeModel::s_invalid_index;
+    root_level.lattice_element_index = NativeModel::s_invalid_index;
+    root_level.translation[0] = 0.0;
+    root_level.translation[1] = 0.0;
+    root_level.translation[2] = 0.0;
+
+    d_path_length = 1;
+
+    this->updateIntersection();
+  }
+  else
+  {
+    this->setState( x_position, y_position, z_position,
+                    x_direction, y_direction, z_direction );
+  }
+}
+
+// Get the internal ray position
+auto NativeNavigator::getPosition() const -> const Length*
+{
+  return d_position;
+}
+
+// Get the internal ray direction
+const double* NativeNavigator::getDirection() const
+{
+  return d_direction;
+}
+
+// Get the cell that contains the internal ray
+auto NativeNavigator::getCurrentCell() const -> EntityId
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_native_model->d_cells[d_path[d_path_length-1].cell_index].getId();
+}
+
+// Get the index of the cell that contains the internal ray
+size_t NativeNavigator::getCurrentCellIndex() const
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_path[d_path_length-1].cell_index;
+}
+
+// Get the instance of the cell that contains the internal ray
+/*! \details The instance is the sum of the instance offsets of the fills
+ * along the universe path (see Geometry::NativeModel).
+ */
+size_t NativeNavigator::getCurrentCellInstance() const
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  const size_t cell_index = d_path[d_path_length-1].cell_index;
+
+  size_t instance = 0;
+
+  for( unsigned i = 1; i < d_path_length; ++i )
+  {
+    instance += NativeModel::getCellInstanceOffset(
+         d_native_model->d_cell_fill_instance_offsets[d_path[i-1].cell_index],
+         cell_index );
+
+    if( d_path[i].lattice_index != NativeModel::s_invalid_index )
+    {
+      instance += NativeModel::getCellInstanceOffset(
+        d_native_model->d_lattice_element_instance_offsets[d_path[i].lattice_index][d_path[i].lattice_element_index],
+        cell_index );
+    }
+  }
+
+  return instance;
+}
+
+// Get the distance from the internal ray pos. to the nearest boundary in all directions
+auto NativeNavigator::getDistanceToClosestBoundary() -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  double min_distance = std::numeric_limits<double>::infinity();
+
+  for( unsigned i = 0; i < d_path_length; ++i )
+  {
+    double local_position[3];
+
+    NativeNavigator::getLocalPosition( d_path[i],
+                                       this->getRawPosition(),
+                                       local_position );
+
+    if( d_path[i].lattice_index != NativeModel::s_invalid_index )
+    {
+      min_distance = std::min( min_distance,
+                               d_native_model->d_lattices[d_path[i].lattice_index].getDistanceToClosestElementBoundary( local_position ) );
+    }
+
+    min_distance = std::min( min_distance,
+                             d_native_model->getDistanceToClosestCellBoundary(
+                                                          d_path[i].cell_index,
+                                                          local_position ) );
+  }
+
+  return Length::from_value( min_distance );
+}
+
+// Fire the internal ray through the geometry
+/*! \details The intersection data is cached whenever the ray state changes
+ * so firing the ray is a constant time operation. If the ray will cross a
+ * lattice element boundary first the invalid surface id will be returned.
+ */
+auto NativeNavigator::fireRay( EntityId* surface_hit ) -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  if( surface_hit != NULL )
+  {
+    if( d_intersection_surface_index != NativeModel::s_invalid_index )
+    {
+      *surface_hit =
+        d_native_model->d_surfaces[d_intersection_surface_index].getId();
+    }
+    else
+      *surface_hit = Navigator::invalidSurfaceId();
+  }
+
+  return Length::from_value( d_intersection_distance );
+}
+
+// Advance the internal ray to the cell boundary
+/*! \details Only the path levels below the level that owns the boundary need
+ * to be found again. A lattice element boundary crossing only requires the
+ * lattice element indices to be shifted.
+ */
+bool NativeNavigator::advanceToCellBoundaryImpl( double* surface_normal,
+                                                 Length& distance_traveled )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  TEST_FOR_EXCEPTION( d_intersection_distance ==
+                      std::numeric_limits<double>::infinity(),
+                      GeometryError,
+                      "The ray in cell " << this->getCurrentCell() <<
+                      " does not intersect the cell boundary!" );
+
+  distance_traveled = Length::from_value( d_intersection_distance );
+
+  // Advance the ray to the cell boundary
+  d_position[0] += d_direction[0]*distance_traveled;
+  d_position[1] += d_direction[1]*distance_traveled;
+  d_position[2] += d_direction[2]*distance_traveled;
+
+  PathLevel& level = d_path[d_intersection_level];
+
+  double local_position[3];
+
+  NativeNavigator::getLocalPosition( level,
+                                     this->getRawPosition(),
+                                     local_position );
+
+  double local_surface_normal[3];
+
+  bool reflecting_boundary = false;
+
+  // Move into the neighboring lattice element
+  if( d_intersection_surface_index == NativeModel::s_invalid_index )
+  {
+    const NativeLattice& lattice =
+      d_native_model->d_lattices[level.lattice_index];
+
+    lattice.getElementBoundaryNormal( d_intersection_element_shift,
+                                      local_surface_normal );
+
+    level.lattice_element[0] += d_intersection_element_shift[0];
+    level.lattice_element[1] += d_intersection_element_shift[1];
+    level.lattice_element[2] += d_intersection_element_shift[2];
+
+    // The lattice level always has a parent level
+    const PathLevel& parent_level = d_path[d_intersection_level-1];
+
+    const double* fill_translation =
+      d_native_model->d_cells[parent_level.cell_index].getFillTranslation();
+
+    const double lattice_translation[3] =
+      {parent_level.translation[0] + fill_translation[0],
+       parent_level.translation[1] + fill_translation[1],
+       parent_level.translation[2] + fill_translation[2]};
+
+    d_path_length = d_intersection_level + 1;
+
+    TEST_FOR_EXCEPTION( !this->initializeLatticeElementPathLevel(
+                                                lattice_translation, level ) ||
+                        !this->completePath( this->getRawPosition(),
+                                             d_direction,
+                                             d_path,
+                                             d_path_length ),
+                        GeometryError,
+                        "Could not find the cell on the other side of the "
+                        "lattice " << lattice.getId() << " element boundary "
+                        "at point (" << d_position[0] << ","
+                        << d_position[1] << "," << d_position[2] << ")!" );
+  }
+  else
+  {
+    const QuadricSurface& intersection_surface =
+      d_native_model->d_surfaces[d_intersection_surface_index];
+
+    intersection_surface.getUnitNormal( local_position, local_surface_normal );
+
+    // The dot product of the direction and normal must be positive
+    if( Utility::calculateCosineOfAngleBetweenUnitVectors( d_direction, local_surface_normal ) < 0.0 )
+    {
+      local_surface_normal[0] = -local_surface_normal[0];
+      local_surface_normal[1] = -local_surface_normal[1];
+      local_surface_normal[2] = -local_surface_normal[2];
+    }
+
+    // Reflect the ray if a reflecting surface is encountered
+    if( intersection_surface.isReflecting() )
+    {
+      double reflected_direction[3];
+
+      Utility::reflectUnitVector( d_direction,
+                                  local_surface_normal,
+                                  reflected_direction );
+
+      d_direction[0] = reflected_direction[0];
+      d_direction[1] = reflected_direction[1];
+      d_direction[2] = reflected_direction[2];
+
+      reflecting_boundary = true;
+    }
+    // Pass into the next cell if a normal surface is encountered
+    else
+    {
+      level.cell_index = d_native_model->findBoundaryCellIndex(
+                                                 level.cell_index,
+                                                 d_intersection_surface_index,
+                                                 local_position,
+                                                 d_direction );
+
+      d_path_length = d_intersection_level + 1;
+
+      TEST_FOR_EXCEPTION( level.cell_index == NativeModel::s_invalid_index ||
+                          !this->completePath( this->getRawPosition(),
+                                               d_direction,
+                                               d_path,
+                                               d_path_length ),
+                          GeometryError,
+                          "Could not find the cell on the other side of "
+                          "surface " << intersection_surface.getId() <<
+                          " at point (" << d_position[0] << ","
+                          << d_position[1] << "," << d_position[2] << ")!" );
+    }
+  }
+
+  // Translations do not change the surface normal
+  if( surface_normal != NULL )
+  {
+    surface_normal[0] = local_surface_normal[0];
+    surface_normal[1] = local_surface_normal[1];
+    surface_normal[2] = local_surface_normal[2];
+  }
+
+  this->updateIntersection();
+
+  return reflecting_boundary;
+}
+
+// Advance the internal ray by a substep (less than distance to boundary)
+/*! \details The intersection surface does not change when the ray is
+ * advanced by a substep so the cached intersection distance can simply be
+ * reduced.
+ */
+void NativeNavigator::advanceBySubstepImpl( const Length step_size )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the substep distance is valid
+  testPrecondition( step_size.value() >= 0.0 );
+  testPrecondition( step_size.value() < d_intersection_distance );
+
+  d_position[0] += d_direction[0]*step_size;
+  d_position[1] += d_direction[1]*step_size;
+  d_position[2] += d_direction[2]*step_size;
+
+  d_intersection_distance -= step_size.value();
+}
+
+// Change the internal ray direction
+void NativeNavigator::changeDirection( const double x_direction,
+                                       const double y_direction,
+                                       const double z_direction )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  if( this->isStateSet() )
+    this->updateIntersection();
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone(
+               const AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  NativeNavigator* cloned_navigator =
+    new NativeNavigator( d_native_model, advance_complete_callback );
+
+  cloned_navigator->copyState( *this );
+
+  return cloned_navigator;
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone() const
+{
+  return new NativeNavigator( *this );
+}
+
+// Copy the internal ray state of another navigator
+void NativeNavigator::copyState( const NativeNavigator& other )
+{
+  d_position[0] = other.d_position[0];
+  d_position[1] = other.d_position[1];
+  d_position[2] = other.d_position[2];
+
+  d_direction[0] = other.d_direction[0];
+  d_direction[1] = other.d_direction[1];
+  d_direction[2] = other.d_direction[2];
+
+  for( unsigned i = 0; i < other.d_path_length; ++i )
+    d_path[i] = other.d_path[i];
+
+  d_path_length = other.d_path_length;
+
+  d_intersection_distance = other.d_intersection_distance;
+  d_intersection_surface_index = other.d_intersection_surface_index;
+  d_intersection_level = other.d_intersection_level;
+
+  d_intersection_element_shift[0] = other.d_intersection_element_shift[0];
+  d_intersection_element_shift[1] = other.d_intersection_element_shift[1];
+  d_intersection_element_shift[2] = other.d_intersection_element_shift[2];
+}
+
+// Get the raw position of the internal ray
+const double* NativeNavigator::getRawPosition() const
+{
+  return Utility::reinterpretAsRaw( d_position );
+}
+
+// Get the position in the coordinate system of a path level
+void NativeNavigator::getLocalPosition( const PathLevel& level,
+                                        const double position[3],
+                                        double local_position[3] )
+{
+  local_position[0] = position[0] - level.translation[0];
+  local_position[1] = position[1] - level.translation[1];
+  local_position[2] = position[2] - level.translation[2];
+}
+
+// Initialize the path level of the universe that fills a cell
+/*! \details The cell index of the new level will not be set. If the cell
+ * is filled with a lattice the lattice element that contains the point will
+ * be found arithmetically. False will be returned if the point is outside of
+ * the lattice element range and the lattice has no outer universe.
+ */
+bool NativeNavigator::initializeFillPathLevel(
+                                            const PathLevel& parent_level,
+                                            const double position[3],
+                                            const double direction[3],
+                                            PathLevel& level ) const
+{
+  // Make sure that the parent cell is filled
+  testPrecondition( d_native_model->d_cells[parent_level.cell_index].isFilled() );
+
+  const double* fill_translation =
+    d_native_model->d_cells[parent_level.cell_index].getFillTranslation();
+
+  const double translation[3] =
+    {parent_level.translation[0] + fill_translation[0],
+     parent_level.translation[1] + fill_translation[1],
+     parent_level.translation[2] + fill_translation[2]};
+
+  level.lattice_index =
+    d_native_model->d_cell_fill_lattice_indices[parent_level.cell_index];
+
+  if( level.lattice_index == NativeModel::s_invalid_index )
+  {
+    level.universe_index =
+      d_native_model->d_cell_fill_universe_indices[parent_level.cell_index];
+    level.cell_index = NativeModel::s_invalid_index;
+    level.lattice_element_index = NativeModel::s_invalid_index;
+    level.translation[0] = translation[0];
+    level.translation[1] = translation[1];
+    level.translation[2] = translation[2];
+
+    return true;
+  }
+  else
+  {
+    const double lattice_position[3] = {position[0] - translation[0],
+                                        position[1] - translation[1],
+                                        position[2] - translation[2]};
+
+    d_native_model->d_lattices[level.lattice_index].findElement(
+                                                       lattice_position,
+                                                       direction,
+                                                       level.lattice_element );
+
+    return this->initializeLatticeElementPathLevel( translation, level );
+  }
+}
+
+// Initialize the path level of a lattice element
+/*! \details The lattice index and the lattice element must already be set.
+ * The cell index will not be set. False will be returned if the element is
+ * in the outer universe and the lattice has no outer universe.
+ */
+bool NativeNavigator::initializeLatticeElementPathLevel(
+                                          const double lattice_translation[3],
+                                          PathLevel& level ) const
+{
+  const NativeLattice& lattice =
+    d_native_model->d_lattices[level.lattice_index];
+
+  const std::vector<size_t>& element_universe_indices =
+    d_native_model->d_lattice_element_universe_indices[level.lattice_index];
+
+  // The outer universe is always last
+  level.lattice_element_index = element_universe_indices.size() - 1;
+
+  if( lattice.isElementInRange( level.lattice_element ) )
+  {
+    const size_t element_index =
+      lattice.getElementIndex( level.lattice_element );
+
+    if( element_universe_indices[element_index] !=
+        NativeModel::s_invalid_index )
+      level.lattice_element_index = element_index;
+  }
+
+  level.universe_index = element_universe_indices[level.lattice_element_index];
+  level.cell_index = NativeModel::s_invalid_index;
+
+  double element_center[3];
+
+  lattice.getElementCenter( level.lattice_element, element_center );
+
+  level.translation[0] = lattice_translation[0] + element_center[0];
+  level.translation[1] = lattice_translation[1] + element_center[1];
+  level.translation[2] = lattice_translation[2] + element_center[2];
+
+  return level.universe_index != NativeModel::s_invalid_index;
+}
+
+// Complete a path from its last level
+/*! \details If the cell index of the last level has not been set it will be
+ * found. Levels will be added until a cell that is not filled is found.
+ */
+bool NativeNavigator::completePath( const double position[3],
+                                    const double direction[3],
+                                    PathLevel path[],
+                                    unsigned& path_length ) const
+{
+  // Make sure that the path has a last level
+  testPrecondition( path_length > 0 );
+
+  while( true )
+  {
+    PathLevel& level = path[path_length-1];
+
+    if( level.cell_index == NativeModel::s_invalid_index )
+    {
+      double local_position[3];
+
+      NativeNavigator::getLocalPosition( level, position, local_position );
+
+      level.cell_index = d_native_model->findCellIndexContainingPoint(
+                                                          level.universe_index,
+                                                          local_position,
+                                                          direction );
+
+      if( level.cell_index == NativeModel::s_invalid_index )
+        return false;
+    }
+
+    if( !d_native_model->d_cells[level.cell_index].isFilled() )
+      return true;
+
+    // The model guarantees that the max path length will not be exceeded
+    if( !this->initializeFillPathLevel( level,
+                                        position,
+                                        direction,
+                                        path[path_length] ) )
+      return false;
+
+    ++path_length;
+  }
+}
+
+// Find the path to the cell that contains a point
+bool NativeNavigator::findPath( const double position[3],
+                                const double direction[3],
+                                PathLevel path[],
+                                unsigned& path_length ) const
+{
+  PathLevel& root_level = path[0];
+
+  root_level.universe_index = NativeModel::s_root_universe_index;
+  root_level.cell_index = NativeModel::s_invalid_index;
+  root_level.lattice_index = NativeModel::s_invalid_index;
+  root_level.lattice_element_index = NativeModel::s_invalid_index;
+  root_level.translation[0] = 0.0;
+  root_level.translation[1] = 0.0;
+  root_level.translation[2] = 0.0;
+
+  path_length = 1;
+
+  return this->completePath( position, direction, path, path_length );
+}
+
+// Fire the internal ray and cache the intersection data
+/*! \details The boundaries of every level of the path are checked. When
+ * boundaries coincide the boundary of the higher level is used (a lattice
+ * element boundary is above the boundaries of the cells in the element) so
+ * that the lower levels will be found again after the crossing.
+ */
+void NativeNavigator::updateIntersection()
+{
+  d_intersection_distance = std::numeric_limits<double>::infinity();
+  d_intersection_surface_index = NativeModel::s_invalid_index;
+  d_intersection_level = 0;
+
+  for( unsigned i = 0; i < d_path_length; ++i )
+  {
+    const PathLevel& level = d_path[i];
+
+    double local_position[3];
+
+    NativeNavigator::getLocalPosition( level,
+                                       this->getRawPosition(),
+                                       local_position );
+
+    if( level.lattice_index != NativeModel::s_invalid_index )
+    {
+      int element_shift[3];
+
+      const double distance =
+        d_native_model->d_lattices[level.lattice_index].getDistanceToElementBoundary(
+                                                                local_position,
+                                                                d_direction,
+                                                                element_shift );
+
+      if( distance < d_intersection_distance )
+      {
+        d_intersection_distance = distance;
+        d_intersection_surface_index = NativeModel::s_invalid_index;
+        d_intersection_level = i;
+
+        d_intersection_element_shift[0] = element_shift[0];
+        d_intersection_element_shift[1] = element_shift[1];
+        d_intersection_element_shift[2] = element_shift[2];
+      }
+    }
+
+    size_t surface_index;
+
+    const double distance =
+      d_native_model->getDistanceToCellBoundary( level.cell_index,
+                                                 local_position,
+                                                 d_direction,
+                                                 surface_index );
+
+    if( distance < d_intersection_distance )
+    {
+      d_intersection_distance = distance;
+      d_intersection_surface_index = surface_index;
+      d_intersection_level = i;
+    }
+  }
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,237 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.hpp
+//! \author Alex Robinson
+//! \brief  The native model navigator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_NAVIGATOR_HPP
+#define GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+
+namespace Geometry{
+
+// Forward declare the native model
+class NativeModel;
+
+/*! The native model navigator
+ * \details The navigator only stores the state of the internal ray (and the
+ * cached intersection data). All of the geometry data is owned by the
+ * Geometry::NativeModel, which is never modified by the navigator. The
+ * location of the internal ray is stored as a path through the nested
+ * universes (one level per universe, starting from the root universe). Each
+ * level stores the cell that contains the ray, the lattice element (if the
+ * universe fills a lattice element) and the translation from the global
+ * coordinate system to the coordinate system of the universe. Crossing a
+ * boundary only changes the levels below the level that owns the boundary.
+ */
+class NativeNavigator : public Navigator
+{
+
+public:
+
+  //! The max number of nested universe levels
+  static const unsigned s_max_path_length = 8;
+
+  //! Constructor
+  NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback =
+          Navigator::AdvanceCompleteCallback() );
+
+  //! Destructor
+  ~NativeNavigator()
+  { /* ... */ }
+
+  //! Get the location of a point w.r.t. a given cell
+  PointLocation getPointLocation(
+                                const Length position[3],
+                                const double direction[3],
+                                const EntityId cell ) const override;
+
+  //! Get the surface normal at a point on the surface
+  void getSurfaceNormal( const EntityId surface_id,
+                         const Length position[3],
+                         const double direction[3],
+                         double normal[3] ) const override;
+
+  //! Find the cell that contains a given ray
+  EntityId findCellContainingRay(
+                                  const Length position[3],
+                                  const double direction[3],
+                                  CellIdSet& found_cell_cache ) const override;
+
+  //! Find the cell that contains a given ray
+  EntityId findCellContainingRay(
+                                    const Length position[3],
+                                    const double direction[3] ) const override;
+
+  //! Check if an internal ray has been set
+  bool isStateSet() const override;
+
+  //! Set the internal ray with unknown starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction ) override;
+
+  //! Set the internal ray with known starting cell
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction,
+                 const EntityId start_cell ) override;
+
+  //! Set the internal ray state (base class overloads)
+  using Navigator::setState;
+
+  //! Get the internal ray position
+  const Length* getPosition() const override;
+
+  //! Get the internal ray direction
+  const double* getDirection() const override;
+
+  //! Get the cell that contains the internal ray
+  EntityId getCurrentCell() const override;
+
+  //! Get the index of the cell that contains the internal ray
+  size_t getCurrentCellIndex() const override;
+
+  //! Get the instance of the cell that contains the internal ray
+  size_t getCurrentCellInstance() const override;
+
+  //! Get the distance from the internal ray pos. to the nearest boundary in all directions
+  Length getDistanceToClosestBoundary() override;
+
+  //! Fire the internal ray through the geometry
+  Length fireRay( EntityId* surface_hit ) override;
+
+  //! Change the internal ray direction
+  void changeDirection( const double x_direction,
+                        const double y_direction,
+                        const double z_direction ) override;
+
+  //! Clone the navigator
+  NativeNavigator* clone( const AdvanceCompleteCallback& advance_complete_callback ) const override;
+
+  //! Clone the navigator
+  NativeNavigator* clone() const override;
+
+protected:
+
+  //! Copy constructor
+  NativeNavigator( const NativeNavigator& other );
+
+  //! Advance the internal ray to the cell boundary
+  bool advanceToCellBoundaryImpl( double* surface_normal,
+                                  Length& distance_traveled ) override;
+
+  //! Advance the internal ray by a substep (less than distance to boundary)
+  void advanceBySubstepImpl( const Length step_size ) override;
+
+private:
+
+  // A level of the universe path
+  struct PathLevel
+  {
+    // The index of the universe
+    size_t universe_index;
+
+    // The index of the cell in the universe that contains the point
+    size_t cell_index;
+
+    // The index of the lattice that the universe fills (if any)
+    size_t lattice_index;
+
+    // The lattice element that the universe fills (if any)
+    int lattice_element[3];
+
+    // The flat lattice element index (outer universe last)
+    size_t lattice_element_index;
+
+    // The global to universe coordinate system translation
+    double translation[3];
+  };
+
+  // Copy the internal ray state of another navigator
+  void copyState( const NativeNavigator& other );
+
+  // Get the raw position of the internal ray
+  const double* getRawPosition() const;
+
+  // Get the position in the coordinate system of a path level
+  static void getLocalPosition( const PathLevel& level,
+                                const double position[3],
+                                double local_position[3] );
+
+  // Initialize the path level of the universe that fills a cell
+  bool initializeFillPathLevel( const PathLevel& parent_level,
+                                const double position[3],
+                                const double direction[3],
+                                PathLevel& level ) const;
+
+  // Initialize the path level of a lattice element
+  bool initializeLatticeElementPathLevel( const double lattice_translation[3],
+                                          PathLevel& level ) const;
+
+  // Complete a path from its last level
+  bool completePath( const double position[3],
+                     const double direction[3],
+                     PathLevel path[],
+                     unsigned& path_length ) const;
+
+  // Find the path to the cell that contains a point
+  bool findPath( const double position[3],
+                 const double direction[3],
+                 PathLevel path[],
+                 unsigned& path_length ) const;
+
+  // Fire the internal ray and cache the intersection data
+  void updateIntersection();
+
+  // The native model
+  std::shared_ptr<const NativeModel> d_native_model;
+
+  // The position
+  Length d_position[3];
+
+  // The direction
+  double d_direction[3];
+
+  // The universe path of the internal ray (the cell that contains the
+  // internal ray is in the last level)
+  PathLevel d_path[s_max_path_length];
+
+  // The universe path length (zero if the internal ray has not been set)
+  unsigned d_path_length;
+
+  // The distance to the intersection surface (cm)
+  double d_intersection_distance;
+
+  // The index of the intersection surface (invalid for lattice boundaries)
+  size_t d_intersection_surface_index;
+
+  // The path level that owns the intersection boundary
+  unsigned d_intersection_level;
+
+  // The lattice element shift at the intersection boundary (if any)
+  int d_intersection_element_shift[3];
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_NAVIGATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.hpp
+//---------------------------------------------------------------------------//
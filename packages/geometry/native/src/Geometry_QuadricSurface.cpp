@@ -0,0 +1,608 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_QuadricSurface.cpp
+//! \author Alex Robinson
+//! \brief  The quadric surface class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_QuadricSurface.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const double QuadricSurface::s_tol = 1e-9;
+
+// Default constructor
+QuadricSurface::QuadricSurface()
+  : QuadricSurface( Navigator::invalidSurfaceId(),
+                    0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0 )
+{ /* ... */ }
+
+// General quadric surface constructor
+/*! \details The surface function is
+ * f(x,y,z) = ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k. The surface area
+ * defaults to 1.0 cm^2 and must be set explicitly if it is needed (e.g. by
+ * a surface estimator).
+ */
+QuadricSurface::QuadricSurface( const EntityId id,
+                                const double a,
+                                const double b,
+                                const double c,
+                                const double d,
+                                const double e,
+                                const double f,
+                                const double g,
+                                const double h,
+                                const double j,
+                                const double k )
+  : d_id( id ),
+    d_reflecting( false ),
+    d_area( 1.0 ),
+    d_type( GENERAL_QUADRIC_SURFACE )
+{
+  d_coefficients[0] = a;
+  d_coefficients[1] = b;
+  d_coefficients[2] = c;
+  d_coefficients[3] = d;
+  d_coefficients[4] = e;
+  d_coefficients[5] = f;
+  d_coefficients[6] = g;
+  d_coefficients[7] = h;
+  d_coefficients[8] = j;
+  d_coefficients[9] = k;
+
+  this->classify();
+}
+
+// Create a general plane (nx*x + ny*y + nz*z - distance = 0)
+QuadricSurface QuadricSurface::createPlane( const EntityId id,
+                                            const double x_normal,
+                                            const double y_normal,
+                                            const double z_normal,
+                                            const double distance )
+{
+  // Make sure the normal is valid
+  testPrecondition( x_normal != 0.0 || y_normal != 0.0 || z_normal != 0.0 );
+
+  return QuadricSurface( id, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                         x_normal, y_normal, z_normal, -distance );
+}
+
+// Create an x-plane (x - x0 = 0)
+QuadricSurface QuadricSurface::createXPlane( const EntityId id,
+                                             const double x0 )
+{
+  return QuadricSurface::createPlane( id, 1.0, 0.0, 0.0, x0 );
+}
+
+// Create a y-plane (y - y0 = 0)
+QuadricSurface QuadricSurface::createYPlane( const EntityId id,
+                                             const double y0 )
+{
+  return QuadricSurface::createPlane( id, 0.0, 1.0, 0.0, y0 );
+}
+
+// Create a z-plane (z - z0 = 0)
+QuadricSurface QuadricSurface::createZPlane( const EntityId id,
+                                             const double z0 )
+{
+  return QuadricSurface::createPlane( id, 0.0, 0.0, 1.0, z0 );
+}
+
+// Create a sphere
+/*! \details The negative sense of the surface is the inside of the sphere.
+ * The surface area will be set to the sphere area.
+ */
+QuadricSurface QuadricSurface::createSphere( const EntityId id,
+                                             const double x0,
+                                             const double y0,
+                                             const double z0,
+                                             const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  QuadricSurface sphere( id, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                         -2*x0, -2*y0, -2*z0,
+                         x0*x0 + y0*y0 + z0*z0 - radius*radius );
+
+  sphere.setArea( 4*Utility::PhysicalConstants::pi*radius*radius );
+
+  return sphere;
+}
+
+// Create a cylinder parallel to the x-axis
+/*! \details The negative sense of the surface is the inside of the cylinder.
+ */
+QuadricSurface QuadricSurface::createXCylinder( const EntityId id,
+                                                const double y0,
+                                                const double z0,
+                                                const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( id, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                         0.0, -2*y0, -2*z0,
+                         y0*y0 + z0*z0 - radius*radius );
+}
+
+// Create a cylinder parallel to the y-axis
+/*! \details The negative sense of the surface is the inside of the cylinder.
+ */
+QuadricSurface QuadricSurface::createYCylinder( const EntityId id,
+                                                const double x0,
+                                                const double z0,
+                                                const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( id, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0,
+                         -2*x0, 0.0, -2*z0,
+                         x0*x0 + z0*z0 - radius*radius );
+}
+
+// Create a cylinder parallel to the z-axis
+/*! \details The negative sense of the surface is the inside of the cylinder.
+ */
+QuadricSurface QuadricSurface::createZCylinder( const EntityId id,
+                                                const double x0,
+                                                const double y0,
+                                                const double radius )
+{
+  // Make sure the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( id, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+                         -2*x0, -2*y0, 0.0,
+                         x0*x0 + y0*y0 - radius*radius );
+}
+
+// Classify the surface type
+/*! \details Planes, spheres and axis-aligned cylinders are identified so
+ * that exact closest point distances and bounding boxes can be calculated.
+ */
+void QuadricSurface::classify()
+{
+  const double& a = d_coefficients[0];
+  const double& b = d_coefficients[1];
+  const double& c = d_coefficients[2];
+  const double& d = d_coefficients[3];
+  const double& e = d_coefficients[4];
+  const double& f = d_coefficients[5];
+  const double& g = d_coefficients[6];
+  const double& h = d_coefficients[7];
+  const double& j = d_coefficients[8];
+
+  d_type = GENERAL_QUADRIC_SURFACE;
+
+  if( d != 0.0 || e != 0.0 || f != 0.0 )
+    return;
+
+  if( a == 0.0 && b == 0.0 && c == 0.0 )
+    d_type = PLANE_SURFACE;
+  else if( a != 0.0 && a == b && a == c )
+    d_type = SPHERE_SURFACE;
+  else if( a == 0.0 && g == 0.0 && b != 0.0 && b == c )
+    d_type = X_CYLINDER_SURFACE;
+  else if( b == 0.0 && h == 0.0 && a != 0.0 && a == c )
+    d_type = Y_CYLINDER_SURFACE;
+  else if( c == 0.0 && j == 0.0 && a != 0.0 && a == b )
+    d_type = Z_CYLINDER_SURFACE;
+}
+
+// Get the surface id
+auto QuadricSurface::getId() const -> EntityId
+{
+  return d_id;
+}
+
+// Check if the surface is a reflecting surface
+bool QuadricSurface::isReflecting() const
+{
+  return d_reflecting;
+}
+
+// Set the reflecting surface flag
+void QuadricSurface::setReflecting( const bool reflecting )
+{
+  d_reflecting = reflecting;
+}
+
+// Get the surface area (cm^2)
+double QuadricSurface::getArea() const
+{
+  return d_area;
+}
+
+// Set the surface area (cm^2)
+void QuadricSurface::setArea( const double area )
+{
+  // Make sure the area is valid
+  testPrecondition( area > 0.0 );
+
+  d_area = area;
+}
+
+// Check if the surface is a plane
+bool QuadricSurface::isPlanar() const
+{
+  return d_type == PLANE_SURFACE;
+}
+
+// Evaluate the surface function gradient
+void QuadricSurface::evaluateGradient( const double position[3],
+                                       double gradient[3] ) const
+{
+  const double& x = position[0];
+  const double& y = position[1];
+  const double& z = position[2];
+
+  gradient[0] = 2*d_coefficients[0]*x + d_coefficients[3]*y +
+    d_coefficients[5]*z + d_coefficients[6];
+
+  gradient[1] = 2*d_coefficients[1]*y + d_coefficients[3]*x +
+    d_coefficients[4]*z + d_coefficients[7];
+
+  gradient[2] = 2*d_coefficients[2]*z + d_coefficients[4]*y +
+    d_coefficients[5]*x + d_coefficients[8];
+}
+
+// Check if a point is on the surface
+/*! \details The first order distance to the surface (|f|/|grad f|) is
+ * compared to the surface tolerance.
+ */
+bool QuadricSurface::isOn( const double position[3] ) const
+{
+  const double value = this->evaluate( position );
+
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  const double gradient_magnitude =
+    std::sqrt( gradient[0]*gradient[0] +
+               gradient[1]*gradient[1] +
+               gradient[2]*gradient[2] );
+
+  if( gradient_magnitude > 0.0 )
+    return std::fabs( value ) <= s_tol*gradient_magnitude;
+  else
+    return std::fabs( value ) <= s_tol;
+}
+
+// Get the sense of a point (+1 or -1) w.r.t. the surface
+/*! \details If the point is on the surface the sense of the region that the
+ * direction points into will be returned.
+ */
+int QuadricSurface::getSense( const double position[3],
+                              const double direction[3] ) const
+{
+  if( this->isOn( position ) )
+  {
+    double gradient[3];
+
+    this->evaluateGradient( position, gradient );
+
+    const double projection = gradient[0]*direction[0] +
+      gradient[1]*direction[1] + gradient[2]*direction[2];
+
+    if( projection != 0.0 )
+      return (projection > 0.0 ? 1 : -1);
+  }
+
+  return (this->evaluate( position ) >= 0.0 ? 1 : -1);
+}
+
+// Get the unit normal at a point on the surface (positive sense side)
+void QuadricSurface::getUnitNormal( const double position[3],
+                                    double normal[3] ) const
+{
+  this->evaluateGradient( position, normal );
+
+  const double magnitude = std::sqrt( normal[0]*normal[0] +
+                                      normal[1]*normal[1] +
+                                      normal[2]*normal[2] );
+
+  // Make sure the gradient is defined at this point
+  testInvariant( magnitude > 0.0 );
+
+  normal[0] /= magnitude;
+  normal[1] /= magnitude;
+  normal[2] /= magnitude;
+}
+
+// Get the distance to the surface along a ray
+/*! \details The ray-surface intersection is the positive root of
+ * f(p+tu) = At^2 + Bt + C = 0. If the starting point is on the surface the
+ * root at t = 0 is ignored, which prevents a ray from hitting the surface
+ * that it is currently crossing. If the ray does not intersect the surface
+ * infinity will be returned.
+ */
+double QuadricSurface::getDistance( const double position[3],
+                                    const double direction[3] ) const
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  const double& ux = direction[0];
+  const double& uy = direction[1];
+  const double& uz = direction[2];
+
+  const double A = d_coefficients[0]*ux*ux + d_coefficients[1]*uy*uy +
+    d_coefficients[2]*uz*uz + d_coefficients[3]*ux*uy +
+    d_coefficients[4]*uy*uz + d_coefficients[5]*ux*uz;
+
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  const double B = gradient[0]*ux + gradient[1]*uy + gradient[2]*uz;
+
+  // Ignore the root at the current point
+  if( this->isOn( position ) )
+  {
+    if( A != 0.0 )
+    {
+      const double distance = -B/A;
+
+      return (distance > s_tol ? distance : inf);
+    }
+    else
+      return inf;
+  }
+
+  const double C = this->evaluate( position );
+
+  // Linear equation
+  if( A == 0.0 )
+  {
+    if( B != 0.0 )
+    {
+      const double distance = -C/B;
+
+      return (distance > 0.0 ? distance : inf);
+    }
+    else
+      return inf;
+  }
+
+  const double discriminant = B*B - 4*A*C;
+
+  if( discriminant < 0.0 )
+    return inf;
+
+  // Use the numerically stable form of the quadratic formula
+  const double q = -0.5*(B + std::copysign( std::sqrt( discriminant ), B ));
+
+  double root_a = q/A;
+  double root_b = (q != 0.0 ? C/q : root_a);
+
+  if( root_a > root_b )
+    std::swap( root_a, root_b );
+
+  if( root_a > 0.0 )
+    return root_a;
+  else if( root_b > 0.0 )
+    return root_b;
+  else
+    return inf;
+}
+
+// Get the distance to the closest point on the surface
+/*! \details The distance is exact for planes, spheres and axis-aligned
+ * cylinders. For all other surfaces the first order estimate |f|/|grad f|
+ * will be returned.
+ */
+double QuadricSurface::getDistanceToClosestPoint(
+                                          const double position[3] ) const
+{
+  switch( d_type )
+  {
+    case SPHERE_SURFACE:
+    {
+      const double& a = d_coefficients[0];
+
+      double square_distance = 0.0;
+      double square_radius = -d_coefficients[9]/a;
+
+      for( unsigned i = 0; i < 3; ++i )
+      {
+        const double center = -d_coefficients[6+i]/(2*a);
+
+        square_distance += (position[i] - center)*(position[i] - center);
+        square_radius += center*center;
+      }
+
+      return std::fabs( std::sqrt( square_distance ) -
+                        std::sqrt( square_radius ) );
+    }
+    case X_CYLINDER_SURFACE:
+    case Y_CYLINDER_SURFACE:
+    case Z_CYLINDER_SURFACE:
+    {
+      const unsigned axis = (unsigned)d_type - (unsigned)X_CYLINDER_SURFACE;
+      const double a = d_coefficients[(axis+1)%3];
+
+      double square_distance = 0.0;
+      double square_radius = -d_coefficients[9]/a;
+
+      for( unsigned i = 0; i < 3; ++i )
+      {
+        if( i == axis )
+          continue;
+
+        const double center = -d_coefficients[6+i]/(2*a);
+
+        square_distance += (position[i] - center)*(position[i] - center);
+        square_radius += center*center;
+      }
+
+      return std::fabs( std::sqrt( square_distance ) -
+                        std::sqrt( square_radius ) );
+    }
+    default:
+    {
+      double gradient[3];
+
+      this->evaluateGradient( position, gradient );
+
+      const double gradient_magnitude =
+        std::sqrt( gradient[0]*gradient[0] +
+                   gradient[1]*gradient[1] +
+                   gradient[2]*gradient[2] );
+
+      if( gradient_magnitude > 0.0 )
+        return std::fabs( this->evaluate( position ) )/gradient_magnitude;
+      else
+        return 0.0;
+    }
+  }
+}
+
+// Get the bounding box of the region with the requested sense
+/*! \details An infinite bounding box will be returned if the region is
+ * not bounded or if the surface type is not recognized (the box is
+ * conservative).
+ */
+AxisAlignedBoundingBox QuadricSurface::getHalfSpaceBoundingBox(
+                                                      const int sense ) const
+{
+  // Make sure the sense is valid
+  testPrecondition( sense == 1 || sense == -1 );
+
+  AxisAlignedBoundingBox box;
+
+  switch( d_type )
+  {
+    case PLANE_SURFACE:
+    {
+      // Only axis-aligned planes bound a half space in a single dimension
+      unsigned number_of_nonzero_components = 0;
+      unsigned dimension = 0;
+
+      for( unsigned i = 0; i < 3; ++i )
+      {
+        if( d_coefficients[6+i] != 0.0 )
+        {
+          ++number_of_nonzero_components;
+          dimension = i;
+        }
+      }
+
+      if( number_of_nonzero_components == 1 )
+      {
+        const double coefficient = d_coefficients[6+dimension];
+        const double bound = -d_coefficients[9]/coefficient;
+
+        if( sense*coefficient > 0.0 )
+          box.setLowerBound( dimension, bound );
+        else
+          box.setUpperBound( dimension, bound );
+      }
+
+      break;
+    }
+    case SPHERE_SURFACE:
+    {
+      const double& a = d_coefficients[0];
+
+      // The inside of the sphere is the region where sign(f) = -sign(a)
+      if( sense*a < 0.0 )
+      {
+        double square_radius = -d_coefficients[9]/a;
+
+        double center[3];
+
+        for( unsigned i = 0; i < 3; ++i )
+        {
+          center[i] = -d_coefficients[6+i]/(2*a);
+          square_radius += center[i]*center[i];
+        }
+
+        const double radius = std::sqrt( std::max( square_radius, 0.0 ) );
+
+        for( unsigned i = 0; i < 3; ++i )
+        {
+          box.setLowerBound( i, center[i] - radius );
+          box.setUpperBound( i, center[i] + radius );
+        }
+      }
+
+      break;
+    }
+    case X_CYLINDER_SURFACE:
+    case Y_CYLINDER_SURFACE:
+    case Z_CYLINDER_SURFACE:
+    {
+      const unsigned axis = (unsigned)d_type - (unsigned)X_CYLINDER_SURFACE;
+      const double a = d_coefficients[(axis+1)%3];
+
+      // The inside of the cylinder is the region where sign(f) = -sign(a)
+      if( sense*a < 0.0 )
+      {
+        double square_radius = -d_coefficients[9]/a;
+
+        double center[3] = {0.0, 0.0, 0.0};
+
+        for( unsigned i = 0; i < 3; ++i )
+        {
+          if( i == axis )
+            continue;
+
+          center[i] = -d_coefficients[6+i]/(2*a);
+          square_radius += center[i]*center[i];
+        }
+
+        const double radius = std::sqrt( std::max( square_radius, 0.0 ) );
+
+        for( unsigned i = 0; i < 3; ++i )
+        {
+          if( i == axis )
+            continue;
+
+          box.setLowerBound( i, center[i] - radius );
+          box.setUpperBound( i, center[i] + radius );
+        }
+      }
+
+      break;
+    }
+    default:
+      break;
+  }
+
+  return box;
+}
+
+// Print the surface
+void QuadricSurface::toStream( std::ostream& os ) const
+{
+  os << "Surface " << d_id << ": ";
+
+  for( unsigned i = 0; i < 10; ++i )
+  {
+    os << d_coefficients[i];
+
+    if( i < 9 )
+      os << " ";
+  }
+
+  if( d_reflecting )
+    os << " (reflecting)";
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_QuadricSurface.cpp
+//---------------------------------------------------------------------------//
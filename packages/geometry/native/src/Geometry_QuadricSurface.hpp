@@ -0,0 +1,224 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_QuadricSurface.hpp
+//! \author Alex Robinson
+//! \brief  The quadric surface class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_QUADRIC_SURFACE_HPP
+#define GEOMETRY_QUADRIC_SURFACE_HPP
+
+// Std Lib Includes
+#include <iostream>
+
+// Boost Includes
+#include <boost/serialization/array_wrapper.hpp>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+#include "Geometry_AxisAlignedBoundingBox.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace Geometry{
+
+/*! The quadric surface
+ * \details A quadric surface is defined by the zeros of the second order
+ * function f(x,y,z) = ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k. The positive
+ * sense of the surface is the region where f(x,y,z) > 0 and the negative
+ * sense is the region where f(x,y,z) < 0. Points that are on the surface
+ * (within a small tolerance) are assigned the sense of the region that the
+ * direction points into, which is what makes surface crossings robust. This
+ * class replaces the Teuchos based Geometry::Surface class.
+ */
+class QuadricSurface
+{
+
+public:
+
+  //! The surface id type
+  typedef Navigator::EntityId EntityId;
+
+  //! General quadric surface constructor
+  QuadricSurface( const EntityId id,
+                  const double a,
+                  const double b,
+                  const double c,
+                  const double d,
+                  const double e,
+                  const double f,
+                  const double g,
+                  const double h,
+                  const double j,
+                  const double k );
+
+  //! Create a general plane (nx*x + ny*y + nz*z - distance = 0)
+  static QuadricSurface createPlane( const EntityId id,
+                                     const double x_normal,
+                                     const double y_normal,
+                                     const double z_normal,
+                                     const double distance );
+
+  //! Create an x-plane (x - x0 = 0)
+  static QuadricSurface createXPlane( const EntityId id, const double x0 );
+
+  //! Create a y-plane (y - y0 = 0)
+  static QuadricSurface createYPlane( const EntityId id, const double y0 );
+
+  //! Create a z-plane (z - z0 = 0)
+  static QuadricSurface createZPlane( const EntityId id, const double z0 );
+
+  //! Create a sphere
+  static QuadricSurface createSphere( const EntityId id,
+                                      const double x0,
+                                      const double y0,
+                                      const double z0,
+                                      const double radius );
+
+  //! Create a cylinder parallel to the x-axis
+  static QuadricSurface createXCylinder( const EntityId id,
+                                         const double y0,
+                                         const double z0,
+                                         const double radius );
+
+  //! Create a cylinder parallel to the y-axis
+  static QuadricSurface createYCylinder( const EntityId id,
+                                         const double x0,
+                                         const double z0,
+                                         const double radius );
+
+  //! Create a cylinder parallel to the z-axis
+  static QuadricSurface createZCylinder( const EntityId id,
+                                         const double x0,
+                                         const double y0,
+                                         const double radius );
+
+  //! Destructor
+  ~QuadricSurface()
+  { /* ... */ }
+
+  //! Get the surface id
+  EntityId getId() const;
+
+  //! Check if the surface is a reflecting surface
+  bool isReflecting() const;
+
+  //! Set the reflecting surface flag
+  void setReflecting( const bool reflecting = true );
+
+  //! Get the surface area (cm^2)
+  double getArea() const;
+
+  //! Set the surface area (cm^2)
+  void setArea( const double area );
+
+  //! Check if the surface is a plane
+  bool isPlanar() const;
+
+  //! Evaluate the surface function
+  double evaluate( const double position[3] ) const;
+
+  //! Evaluate the surface function gradient
+  void evaluateGradient( const double position[3], double gradient[3] ) const;
+
+  //! Check if a point is on the surface
+  bool isOn( const double position[3] ) const;
+
+  //! Get the sense of a point (+1 or -1) w.r.t. the surface
+  int getSense( const double position[3], const double direction[3] ) const;
+
+  //! Get the unit normal at a point on the surface (positive sense side)
+  void getUnitNormal( const double position[3], double normal[3] ) const;
+
+  //! Get the distance to the surface along a ray
+  double getDistance( const double position[3],
+                      const double direction[3] ) const;
+
+  //! Get the distance to the closest point on the surface
+  double getDistanceToClosestPoint( const double position[3] ) const;
+
+  //! Get the bounding box of the region with the requested sense
+  AxisAlignedBoundingBox getHalfSpaceBoundingBox( const int sense ) const;
+
+  //! Print the surface
+  void toStream( std::ostream& os ) const;
+
+private:
+
+  // Default constructor
+  QuadricSurface();
+
+  // Classify the surface type
+  void classify();
+
+  // Serialize the surface
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The surface type classification
+  enum Type{
+    GENERAL_QUADRIC_SURFACE = 0,
+    PLANE_SURFACE,
+    SPHERE_SURFACE,
+    X_CYLINDER_SURFACE,
+    Y_CYLINDER_SURFACE,
+    Z_CYLINDER_SURFACE
+  };
+
+  // The on surface tolerance (cm)
+  static const double s_tol;
+
+  // The surface id
+  EntityId d_id;
+
+  // The surface coefficients (a,b,c,d,e,f,g,h,j,k)
+  double d_coefficients[10];
+
+  // The reflecting surface flag
+  bool d_reflecting;
+
+  // The surface area
+  double d_area;
+
+  // The surface type
+  Type d_type;
+};
+
+// Evaluate the surface function
+inline double QuadricSurface::evaluate( const double position[3] ) const
+{
+  const double& x = position[0];
+  const double& y = position[1];
+  const double& z = position[2];
+
+  return x*(d_coefficients[0]*x + d_coefficients[3]*y +
+            d_coefficients[5]*z + d_coefficients[6]) +
+    y*(d_coefficients[1]*y + d_coefficients[4]*z + d_coefficients[7]) +
+    z*(d_coefficients[2]*z + d_coefficients[8]) + d_coefficients[9];
+}
+
+// Serialize the surface
+template<typename Archive>
+void QuadricSurface::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_id );
+  ar & boost::serialization::make_nvp( "d_coefficients", boost::serialization::make_array( d_coefficients, 10 ) );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting );
+  ar & BOOST_SERIALIZATION_NVP( d_area );
+
+  if( Archive::is_loading::value )
+    this->classify();
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( QuadricSurface, Geometry, 0 );
+
+#endif // end GEOMETRY_QUADRIC_SURFACE_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_QuadricSurface.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeCell.cpp
+//! \author Alex Robinson
+//! \brief  Native cell class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <map>
+#include <functional>
+
+// FRENSIE Includes
+#include "Geometry_NativeCell.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a surface sense functor from a surface id sense map
+std::function<int(uint32_t)> createSenseFunctor(
+                                        const Geometry::NativeCell& cell,
+                                        std::map<uint64_t,int> surface_senses )
+{
+  const std::vector<Geometry::NativeCell::EntityId> surface_ids =
+    cell.getSurfaceIds();
+
+  return [surface_ids, surface_senses]( const uint32_t local_index ){
+    return surface_senses.find( surface_ids[local_index] )->second;
+  };
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the cell properties can be returned
+FRENSIE_UNIT_TEST( NativeCell, properties )
+{
+  Geometry::NativeCell void_cell( 1, "-1 2" );
+
+  FRENSIE_CHECK_EQUAL( void_cell.getId(), 1 );
+  FRENSIE_CHECK_EQUAL( void_cell.getDefinition(), "-1 2" );
+  FRENSIE_CHECK( void_cell.isVoid() );
+  FRENSIE_CHECK( !void_cell.isTermination() );
+  FRENSIE_CHECK_EQUAL( void_cell.getVolume(), 1.0 );
+
+  Geometry::NativeCell cell( 2, "-1 2", 3, -1.0*Geometry::Model::DensityUnit() );
+
+  FRENSIE_CHECK_EQUAL( cell.getMaterialId(), 3 );
+  FRENSIE_CHECK_EQUAL( cell.getDensity(), -1.0*Geometry::Model::DensityUnit() );
+  FRENSIE_CHECK( !cell.isVoid() );
+
+  cell.setTermination();
+  cell.setVolume( 2.0 );
+
+  FRENSIE_CHECK( cell.isTermination() );
+  FRENSIE_CHECK_EQUAL( cell.getVolume(), 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a cell can be placed in a universe and filled with a universe
+FRENSIE_UNIT_TEST( NativeCell, universe_fill )
+{
+  Geometry::NativeCell cell( 1, "-1 2" );
+
+  FRENSIE_CHECK_EQUAL( cell.getUniverseId(),
+                       Geometry::NativeCell::rootUniverseId() );
+  FRENSIE_CHECK( !cell.isFilled() );
+
+  cell.setUniverseId( 3 );
+
+  FRENSIE_CHECK_EQUAL( cell.getUniverseId(), 3 );
+
+  cell.setFill( 4, 1.0, -2.0, 3.0 );
+
+  FRENSIE_CHECK( cell.isFilled() );
+  FRENSIE_CHECK_EQUAL( cell.getFillUniverseId(), 4 );
+  FRENSIE_CHECK_EQUAL( cell.getFillTranslation()[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( cell.getFillTranslation()[1], -2.0 );
+  FRENSIE_CHECK_EQUAL( cell.getFillTranslation()[2], 3.0 );
+
+  // Material cells and the root universe cannot be used as fills
+  Geometry::NativeCell material_cell( 2, "-1", 1, -1.0*Geometry::Model::DensityUnit() );
+
+  FRENSIE_CHECK_THROW( material_cell.setFill( 4 ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( cell.setFill( Geometry::NativeCell::rootUniverseId() ),
+                       Geometry::InvalidNativeCellDefinition );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface ids are stored in order of first appearance
+FRENSIE_UNIT_TEST( NativeCell, getSurfaceIds )
+{
+  Geometry::NativeCell cell( 1, "-10 3 (-4 : 10) #(5 -3)" );
+
+  std::vector<Geometry::NativeCell::EntityId> expected_surface_ids( {10, 3, 4, 5} );
+
+  FRENSIE_CHECK_EQUAL( cell.getSurfaceIds(), expected_surface_ids );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid definitions are rejected
+FRENSIE_UNIT_TEST( NativeCell, constructor_invalid )
+{
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "-1 (2" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "-1 2)" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, ": 2" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "-1 :" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "-1 & 2" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "- 2" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 1, "-0" ),
+                       Geometry::InvalidNativeCellDefinition );
+  FRENSIE_CHECK_THROW( Geometry::NativeCell( 0, "-1" ),
+                       Geometry::InvalidNativeCellDefinition );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an intersection can be evaluated
+FRENSIE_UNIT_TEST( NativeCell, isInside_intersection )
+{
+  Geometry::NativeCell cell( 1, "-1 2" );
+
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, 1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, 1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, -1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, -1}} ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a union can be evaluated
+FRENSIE_UNIT_TEST( NativeCell, isInside_union )
+{
+  Geometry::NativeCell cell( 1, "-1 : 2" );
+
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, 1}} ) ) );
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, 1}} ) ) );
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, -1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, -1}} ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the operator precedence is respected
+FRENSIE_UNIT_TEST( NativeCell, isInside_precedence )
+{
+  // Equivalent to "-1 : (2 -3)"
+  Geometry::NativeCell cell( 1, "-1 : 2 -3" );
+
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, -1}, {3, 1}} ) ) );
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, 1}, {3, -1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, 1}, {3, 1}} ) ) );
+
+  // Parentheses override the precedence
+  Geometry::NativeCell grouped_cell( 2, "(-1 : 2) -3" );
+
+  FRENSIE_CHECK( !grouped_cell.isInside( createSenseFunctor( grouped_cell, {{1, -1}, {2, -1}, {3, 1}} ) ) );
+  FRENSIE_CHECK( grouped_cell.isInside( createSenseFunctor( grouped_cell, {{1, -1}, {2, -1}, {3, -1}} ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a complement can be evaluated
+FRENSIE_UNIT_TEST( NativeCell, isInside_complement )
+{
+  Geometry::NativeCell cell( 1, "-1 #(2 -3)" );
+
+  FRENSIE_CHECK( cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, -1}, {3, -1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, -1}, {2, 1}, {3, -1}} ) ) );
+  FRENSIE_CHECK( !cell.isInside( createSenseFunctor( cell, {{1, 1}, {2, -1}, {3, -1}} ) ) );
+
+  Geometry::NativeCell half_space_complement( 2, "#-1 2" );
+
+  FRENSIE_CHECK( half_space_complement.isInside( createSenseFunctor( half_space_complement, {{1, 1}, {2, 1}} ) ) );
+  FRENSIE_CHECK( !half_space_complement.isInside( createSenseFunctor( half_space_complement, {{1, -1}, {2, 1}} ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell bounding box can be calculated
+FRENSIE_UNIT_TEST( NativeCell, calculateBoundingBox )
+{
+  Geometry::NativeCell cell( 1, "1 -2 (-3 : -4)" );
+
+  // Surfaces 1 and 2 are x-planes at 0 and 2, surfaces 3 and 4 are boxes
+  std::map<uint64_t,Geometry::AxisAlignedBoundingBox> half_space_boxes;
+  half_space_boxes[1] = Geometry::AxisAlignedBoundingBox();
+  half_space_boxes[1].setLowerBound( 0, 0.0 );
+  half_space_boxes[2] = Geometry::AxisAlignedBoundingBox();
+  half_space_boxes[2].setUpperBound( 0, 2.0 );
+  half_space_boxes[3] =
+    Geometry::AxisAlignedBoundingBox( -1.0, 1.0, -1.0, 1.0, -1.0, 1.0 );
+  half_space_boxes[4] =
+    Geometry::AxisAlignedBoundingBox( 1.0, 3.0, 0.0, 2.0, 0.0, 2.0 );
+
+  const std::vector<Geometry::NativeCell::EntityId>& surface_ids =
+    cell.getSurfaceIds();
+
+  Geometry::AxisAlignedBoundingBox box = cell.calculateBoundingBox(
+           [&surface_ids, &half_space_boxes]( const uint32_t local_index,
+                                              const int ){
+             return half_space_boxes[surface_ids[local_index]];
+           } );
+
+  FRENSIE_CHECK( box.isFinite() );
+  FRENSIE_CHECK_EQUAL( box.getLowerBound( 0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( box.getUpperBound( 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( box.getLowerBound( 1 ), -1.0 );
+  FRENSIE_CHECK_EQUAL( box.getUpperBound( 1 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( box.getLowerBound( 2 ), -1.0 );
+  FRENSIE_CHECK_EQUAL( box.getUpperBound( 2 ), 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeCell.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,351 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeLattice.cpp
+//! \author Alex Robinson
+//! \brief  Native lattice class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeLattice.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a 3x2 rectangular lattice with unit pitch and an infinite z pitch
+Geometry::NativeLattice createRectangularLattice()
+{
+  const double lower_left_corner[3] = {-1.5, -1.0, 0.0};
+  const double pitch[3] = {1.0, 1.0, std::numeric_limits<double>::infinity()};
+  const unsigned dimensions[3] = {3, 2, 1};
+
+  std::vector<Geometry::NativeLattice::EntityId> universe_ids( {1, 2, 1,
+                                                                2, 1, 2} );
+
+  return Geometry::NativeLattice::createRectangularLattice( 10,
+                                                            lower_left_corner,
+                                                            pitch,
+                                                            dimensions,
+                                                            universe_ids,
+                                                            3 );
+}
+
+// Create a 3x3 hexagonal lattice with unit pitch and an infinite z pitch
+Geometry::NativeLattice createHexagonalLattice()
+{
+  const double center[3] = {0.0, 0.0, 0.0};
+  const unsigned dimensions[3] = {3, 3, 1};
+
+  std::vector<Geometry::NativeLattice::EntityId> universe_ids( 9, 1 );
+
+  return Geometry::NativeLattice::createHexagonalLattice(
+                                   11,
+                                   center,
+                                   1.0,
+                                   std::numeric_limits<double>::infinity(),
+                                   dimensions,
+                                   universe_ids );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the lattice data can be returned
+FRENSIE_UNIT_TEST( NativeLattice, basic_data )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  FRENSIE_CHECK_EQUAL( lattice.getId(), 10 );
+  FRENSIE_CHECK_EQUAL( lattice.getType(), Geometry::NativeLattice::RECTANGULAR );
+  FRENSIE_CHECK_EQUAL( lattice.getDimensions()[0], 3 );
+  FRENSIE_CHECK_EQUAL( lattice.getDimensions()[1], 2 );
+  FRENSIE_CHECK_EQUAL( lattice.getDimensions()[2], 1 );
+  FRENSIE_CHECK_EQUAL( lattice.getNumberOfElements(), 6 );
+  FRENSIE_CHECK_EQUAL( lattice.getOuterUniverseId(), 3 );
+
+  lattice = createHexagonalLattice();
+
+  FRENSIE_CHECK_EQUAL( lattice.getId(), 11 );
+  FRENSIE_CHECK_EQUAL( lattice.getType(), Geometry::NativeLattice::HEXAGONAL );
+  FRENSIE_CHECK_EQUAL( lattice.getNumberOfElements(), 9 );
+  FRENSIE_CHECK_EQUAL( lattice.getOuterUniverseId(),
+                       Geometry::Model::invalidCellId() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid lattices are rejected
+FRENSIE_UNIT_TEST( NativeLattice, constructor_invalid )
+{
+  const double lower_left_corner[3] = {0.0, 0.0, 0.0};
+  const double pitch[3] = {1.0, 1.0, std::numeric_limits<double>::infinity()};
+  const unsigned dimensions[3] = {2, 2, 1};
+
+  // Wrong number of element universes
+  std::vector<Geometry::NativeLattice::EntityId> universe_ids( 3, 1 );
+
+  FRENSIE_CHECK_THROW( Geometry::NativeLattice::createRectangularLattice(
+                                                           1,
+                                                           lower_left_corner,
+                                                           pitch,
+                                                           dimensions,
+                                                           universe_ids ),
+                       Geometry::InvalidNativeLatticeDefinition );
+
+  // Undivided axis with more than one element
+  universe_ids.resize( 8, 1 );
+
+  const unsigned bad_dimensions[3] = {2, 2, 2};
+
+  FRENSIE_CHECK_THROW( Geometry::NativeLattice::createRectangularLattice(
+                                                           1,
+                                                           lower_left_corner,
+                                                           pitch,
+                                                           bad_dimensions,
+                                                           universe_ids ),
+                       Geometry::InvalidNativeLatticeDefinition );
+
+  // Invalid pitch
+  const double bad_pitch[3] = {1.0, 0.0, 1.0};
+
+  FRENSIE_CHECK_THROW( Geometry::NativeLattice::createRectangularLattice(
+                                                           1,
+                                                           lower_left_corner,
+                                                           bad_pitch,
+                                                           bad_dimensions,
+                                                           universe_ids ),
+                       Geometry::InvalidNativeLatticeDefinition );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the flat element index can be returned
+FRENSIE_UNIT_TEST( NativeLattice, getElementIndex )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  int element[3] = {0, 0, 0};
+
+  FRENSIE_CHECK( lattice.isElementInRange( element ) );
+  FRENSIE_CHECK_EQUAL( lattice.getElementIndex( element ), 0 );
+
+  element[0] = 2;
+  element[1] = 1;
+
+  FRENSIE_CHECK( lattice.isElementInRange( element ) );
+  FRENSIE_CHECK_EQUAL( lattice.getElementIndex( element ), 5 );
+
+  element[0] = 3;
+
+  FRENSIE_CHECK( !lattice.isElementInRange( element ) );
+
+  element[0] = -1;
+
+  FRENSIE_CHECK( !lattice.isElementInRange( element ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the rectangular element that contains a point can be found
+FRENSIE_UNIT_TEST( NativeLattice, findElement_rectangular )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  const double direction[3] = {1.0, 0.0, 0.0};
+  int element[3];
+
+  double position[3] = {0.2, 0.5, 100.0};
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 1 );
+  FRENSIE_CHECK_EQUAL( element[1], 1 );
+  FRENSIE_CHECK_EQUAL( element[2], 0 );
+
+  // Points outside of the element range
+  position[0] = -2.0;
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], -1 );
+  FRENSIE_CHECK_EQUAL( element[1], 1 );
+
+  // Points on an element boundary are in the element that is being entered
+  position[0] = -0.5;
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 1 );
+
+  const double reverse_direction[3] = {-1.0, 0.0, 0.0};
+
+  lattice.findElement( position, reverse_direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hexagonal element that contains a point can be found
+FRENSIE_UNIT_TEST( NativeLattice, findElement_hexagonal )
+{
+  Geometry::NativeLattice lattice = createHexagonalLattice();
+
+  const double direction[3] = {1.0, 0.0, 0.0};
+  int element[3];
+
+  double position[3] = {0.1, 0.1, 0.0};
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 0 );
+  FRENSIE_CHECK_EQUAL( element[1], 0 );
+
+  // Element (0,1) is centered at (0.5,sqrt(3)/2)
+  position[0] = 0.5;
+  position[1] = 0.8;
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 0 );
+  FRENSIE_CHECK_EQUAL( element[1], 1 );
+
+  // Element (1,1) is centered at (1.5,sqrt(3)/2)
+  position[0] = 1.4;
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 1 );
+  FRENSIE_CHECK_EQUAL( element[1], 1 );
+
+  // Points on a side are in the element that is being entered
+  position[0] = 0.5;
+  position[1] = 0.0;
+
+  lattice.findElement( position, direction, element );
+
+  FRENSIE_CHECK_EQUAL( element[0], 1 );
+  FRENSIE_CHECK_EQUAL( element[1], 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the element centers can be returned
+FRENSIE_UNIT_TEST( NativeLattice, getElementCenter )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  int element[3] = {2, 1, 0};
+  double center[3];
+
+  lattice.getElementCenter( element, center );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( center[0], 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( center[1], 0.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( center[2], 0.0 );
+
+  lattice = createHexagonalLattice();
+
+  element[0] = 1;
+  element[1] = 2;
+
+  lattice.getElementCenter( element, center );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( center[0], 2.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( center[1], std::sqrt( 3.0 ), 1e-15 );
+  FRENSIE_CHECK_EQUAL( center[2], 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the element boundary can be returned
+FRENSIE_UNIT_TEST( NativeLattice, getDistanceToElementBoundary )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  double position[3] = {0.25, 0.0, 3.0};
+  double direction[3] = {0.0, -1.0, 0.0};
+  int element_shift[3];
+
+  double distance = lattice.getDistanceToElementBoundary( position,
+                                                          direction,
+                                                          element_shift );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( element_shift[0], 0 );
+  FRENSIE_CHECK_EQUAL( element_shift[1], -1 );
+  FRENSIE_CHECK_EQUAL( element_shift[2], 0 );
+
+  direction[0] = 1.0;
+  direction[1] = 0.0;
+
+  distance = lattice.getDistanceToElementBoundary( position,
+                                                   direction,
+                                                   element_shift );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.25, 1e-15 );
+  FRENSIE_CHECK_EQUAL( element_shift[0], 1 );
+  FRENSIE_CHECK_EQUAL( element_shift[1], 0 );
+
+  // The undivided axis has no boundaries
+  direction[0] = 0.0;
+  direction[2] = 1.0;
+
+  distance = lattice.getDistanceToElementBoundary( position,
+                                                   direction,
+                                                   element_shift );
+
+  FRENSIE_CHECK_EQUAL( distance, std::numeric_limits<double>::infinity() );
+
+  lattice = createHexagonalLattice();
+
+  position[0] = 0.0;
+  position[1] = 0.0;
+  direction[0] = 0.5;
+  direction[1] = std::sqrt( 3.0 )/2;
+  direction[2] = 0.0;
+
+  distance = lattice.getDistanceToElementBoundary( position,
+                                                   direction,
+                                                   element_shift );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( element_shift[0], 0 );
+  FRENSIE_CHECK_EQUAL( element_shift[1], 1 );
+
+  double normal[3];
+
+  lattice.getElementBoundaryNormal( element_shift, normal );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], std::sqrt( 3.0 )/2, 1e-15 );
+  FRENSIE_CHECK_EQUAL( normal[2], 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest element boundary can be returned
+FRENSIE_UNIT_TEST( NativeLattice, getDistanceToClosestElementBoundary )
+{
+  Geometry::NativeLattice lattice = createRectangularLattice();
+
+  double position[3] = {0.25, -0.1, 3.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   lattice.getDistanceToClosestElementBoundary( position ),
+                   0.25,
+                   1e-15 );
+
+  lattice = createHexagonalLattice();
+
+  position[0] = 0.0;
+  position[1] = 0.1;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   lattice.getDistanceToClosestElementBoundary( position ),
+                   0.5 - 0.1*std::sqrt( 3.0 )/2,
+                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeLattice.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,417 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeModel.cpp
+//! \author Alex Robinson
+//! \brief  Native model class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::NativeModel> model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test model surfaces
+/*! \details Surface 1 is a sphere of radius 10 cm, surface 2 is the x = 0
+ * plane and surface 3 is a sphere of radius 20 cm.
+ */
+std::vector<Geometry::QuadricSurface> createSurfaces()
+{
+  std::vector<Geometry::QuadricSurface> surfaces;
+
+  surfaces.push_back( Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 10.0 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createXPlane( 2, 0.0 ) );
+  surfaces.back().setArea( 100*M_PI );
+  surfaces.push_back( Geometry::QuadricSurface::createSphere( 3, 0.0, 0.0, 0.0, 20.0 ) );
+
+  return surfaces;
+}
+
+// Create the test model cells
+/*! \details Cell 1 is the left half of the inner sphere, cell 2 is the right
+ * half of the inner sphere, cell 3 is the spherical shell and cell 4 is the
+ * termination cell.
+ */
+std::vector<Geometry::NativeCell> createCells()
+{
+  std::vector<Geometry::NativeCell> cells;
+
+  cells.push_back( Geometry::NativeCell( 1, "-1 -2", 1, -1.0*Geometry::Model::DensityUnit() ) );
+  cells.back().setVolume( 2000*M_PI/3 );
+  cells.push_back( Geometry::NativeCell( 2, "-1 2", 2, 0.5*Geometry::Model::DensityUnit() ) );
+  cells.push_back( Geometry::NativeCell( 3, "1 -3" ) );
+  cells.push_back( Geometry::NativeCell( 4, "3" ) );
+  cells.back().setTermination();
+
+  return cells;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check if the model name can be returned
+FRENSIE_UNIT_TEST( NativeModel, getName )
+{
+  FRENSIE_CHECK_EQUAL( model->getName(), "Native" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid models are rejected
+FRENSIE_UNIT_TEST( NativeModel, constructor_invalid )
+{
+  std::vector<Geometry::QuadricSurface> surfaces = createSurfaces();
+  std::vector<Geometry::NativeCell> cells = createCells();
+
+  // No termination cell
+  {
+    std::vector<Geometry::NativeCell> bad_cells( cells.begin(), cells.end()-1 );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( surfaces, bad_cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+
+  // Missing surface
+  {
+    std::vector<Geometry::QuadricSurface> bad_surfaces( surfaces.begin(), surfaces.end()-1 );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( bad_surfaces, cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+
+  // Duplicate cell
+  {
+    std::vector<Geometry::NativeCell> bad_cells( cells );
+    bad_cells.push_back( cells.front() );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( surfaces, bad_cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+
+  // Duplicate surface
+  {
+    std::vector<Geometry::QuadricSurface> bad_surfaces( surfaces );
+    bad_surfaces.push_back( surfaces.front() );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( bad_surfaces, cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that models with invalid universes are rejected
+FRENSIE_UNIT_TEST( NativeModel, constructor_invalid_universes )
+{
+  std::vector<Geometry::QuadricSurface> surfaces = createSurfaces();
+  std::vector<Geometry::NativeCell> cells = createCells();
+
+  // Missing fill universe
+  {
+    std::vector<Geometry::NativeCell> bad_cells( cells );
+    bad_cells[2].setFill( 5 );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( surfaces, bad_cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+
+  // Universe that contains itself
+  {
+    std::vector<Geometry::NativeCell> bad_cells( cells );
+    bad_cells[2].setFill( 5 );
+    bad_cells.push_back( Geometry::NativeCell( 5, "-1" ) );
+    bad_cells.back().setUniverseId( 5 );
+    bad_cells.back().setFill( 5 );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( surfaces, bad_cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+
+  // Filled termination cell
+  {
+    std::vector<Geometry::NativeCell> bad_cells( cells );
+    bad_cells[3].setFill( 5 );
+    bad_cells.push_back( Geometry::NativeCell( 5, "-1" ) );
+    bad_cells.back().setUniverseId( 5 );
+
+    FRENSIE_CHECK_THROW( Geometry::NativeModel( surfaces, bad_cells ),
+                         Geometry::InvalidNativeGeometry );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that filled cells are not returned and that cell instances are
+// counted
+FRENSIE_UNIT_TEST( NativeModel, universes )
+{
+  std::vector<Geometry::QuadricSurface> surfaces = createSurfaces();
+  std::vector<Geometry::NativeCell> cells = createCells();
+
+  // Fill the spherical shell with a universe that contains cell 5
+  cells[2].setFill( 5, 1.0, 0.0, 0.0 );
+  cells.push_back( Geometry::NativeCell( 5, "-3", 3, -1.0*Geometry::Model::DensityUnit() ) );
+  cells.back().setUniverseId( 5 );
+
+  Geometry::NativeModel universe_model( surfaces, cells );
+
+  Geometry::Model::CellIdSet cell_set;
+
+  universe_model.getCells( cell_set, true, true );
+
+  FRENSIE_CHECK_EQUAL( cell_set, Geometry::Model::CellIdSet( {1, 2, 4, 5} ) );
+  FRENSIE_CHECK( universe_model.doesCellExist( 3 ) );
+  FRENSIE_CHECK_EQUAL( universe_model.getNumberOfCellInstances( 1 ), 1 );
+  FRENSIE_CHECK_EQUAL( universe_model.getNumberOfCellInstances( 5 ), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model cells can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCells )
+{
+  Geometry::Model::CellIdSet cells;
+
+  // Get all cells except for the termination cells
+  model->getCells( cells, true, false );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3} ) );
+
+  cells.clear();
+
+  // Get all cells except the void cells
+  model->getCells( cells, false, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 4} ) );
+
+  cells.clear();
+
+  // Get all cells
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3, 4} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model material ids can be returned
+FRENSIE_UNIT_TEST( NativeModel, getMaterialIds )
+{
+  Geometry::Model::MaterialIdSet material_ids;
+
+  model->getMaterialIds( material_ids );
+
+  FRENSIE_CHECK_EQUAL( material_ids, Geometry::Model::MaterialIdSet( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell material ids can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellMaterialIds )
+{
+  Geometry::Model::CellIdMatIdMap cell_id_mat_id_map;
+
+  model->getCellMaterialIds( cell_id_mat_id_map );
+
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[1], 1 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[2], 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell densities can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellDensities )
+{
+  Geometry::Model::CellIdDensityMap cell_id_density_map;
+
+  model->getCellDensities( cell_id_density_map );
+
+  FRENSIE_CHECK_EQUAL( cell_id_density_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[1],
+                       -1.0*Geometry::Model::DensityUnit() );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[2],
+                       0.5*Geometry::Model::DensityUnit() );
+}
+
+//---------------------------------------------------------------------------//
+// Check if cells exist
+FRENSIE_UNIT_TEST( NativeModel, doesCellExist )
+{
+  FRENSIE_CHECK( !model->doesCellExist( 0 ) );
+  FRENSIE_CHECK( model->doesCellExist( 1 ) );
+  FRENSIE_CHECK( model->doesCellExist( 4 ) );
+  FRENSIE_CHECK( !model->doesCellExist( 5 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dense cell indices can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellIndex )
+{
+  FRENSIE_CHECK_EQUAL( model->getNumberOfCells(), 4 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 2 ), 1 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 3 ), 2 );
+  FRENSIE_CHECK_EQUAL( model->getCellIndex( 4 ), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a cell is a termination cell or a void cell
+FRENSIE_UNIT_TEST( NativeModel, isTerminationCell_isVoidCell )
+{
+  FRENSIE_CHECK( !model->isTerminationCell( 1 ) );
+  FRENSIE_CHECK( !model->isTerminationCell( 3 ) );
+  FRENSIE_CHECK( model->isTerminationCell( 4 ) );
+
+  FRENSIE_CHECK( !model->isVoidCell( 1 ) );
+  FRENSIE_CHECK( !model->isVoidCell( 2 ) );
+  FRENSIE_CHECK( model->isVoidCell( 3 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell volume can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellVolume )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 1 ).value(),
+                                   2000*M_PI/3,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( model->getCellVolume( 2 ).value(), 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell bounding boxes can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellBoundingBox )
+{
+  Geometry::Model::Length lower_bounds[3], upper_bounds[3];
+
+  FRENSIE_REQUIRE( model->getCellBoundingBox( 1, lower_bounds, upper_bounds ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[0].value(), -10.0, 1e-12 );
+  FRENSIE_CHECK_SMALL( upper_bounds[0].value(), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[1].value(), -10.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_bounds[1].value(), 10.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[2].value(), -10.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_bounds[2].value(), 10.0, 1e-12 );
+
+  FRENSIE_REQUIRE( model->getCellBoundingBox( 3, lower_bounds, upper_bounds ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bounds[0].value(), -20.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( upper_bounds[0].value(), 20.0, 1e-12 );
+
+  // The termination cell is not bounded
+  FRENSIE_CHECK( !model->getCellBoundingBox( 4, lower_bounds, upper_bounds ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface data can be returned
+FRENSIE_UNIT_TEST( NativeModel, surfaces )
+{
+  Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+  model->getSurfaces( surfaces );
+
+  FRENSIE_CHECK_EQUAL( surfaces,
+                       Geometry::AdvancedModel::SurfaceIdSet( {1, 2, 3} ) );
+  FRENSIE_CHECK( model->doesSurfaceExist( 2 ) );
+  FRENSIE_CHECK( !model->doesSurfaceExist( 4 ) );
+  FRENSIE_CHECK( !model->isReflectingSurface( 1 ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 1 ).value(),
+                                   400*M_PI,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 2 ).value(),
+                                   100*M_PI,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a navigator can be created
+FRENSIE_UNIT_TEST( NativeModel, createNavigator )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  FRENSIE_REQUIRE( navigator.get() != NULL );
+
+  navigator->setState( -5.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( NativeModel, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_native_model" );
+  std::ostringstream archive_ostream;
+
+  // Create and archive the model
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<const Geometry::AdvancedModel> shared_model( model );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( shared_model ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived model
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<const Geometry::AdvancedModel> shared_model;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( shared_model ) );
+  FRENSIE_CHECK_EQUAL( shared_model->getName(), "Native" );
+  FRENSIE_CHECK( shared_model->doesCellExist( 3 ) );
+  FRENSIE_CHECK( shared_model->isTerminationCell( 4 ) );
+  FRENSIE_CHECK( shared_model->doesSurfaceExist( 3 ) );
+
+  std::shared_ptr<Geometry::Navigator>
+    navigator( shared_model->createNavigator() );
+
+  navigator->setState( 5.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  model.reset( new Geometry::NativeModel( createSurfaces(), createCells() ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,609 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  Native navigator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+namespace cgs = boost::units::cgs;
+
+typedef Geometry::Navigator::Length Length;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::NativeModel> model;
+
+std::shared_ptr<const Geometry::NativeModel> reflecting_model;
+
+std::shared_ptr<const Geometry::NativeModel> lattice_model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a test model
+/*! \details Surface 1 is a sphere of radius 10 cm, surface 2 is the x = 0
+ * plane and surface 3 is a sphere of radius 20 cm. Cell 1 is the left half
+ * of the inner sphere, cell 2 is the right half of the inner sphere, cell 3
+ * is the spherical shell and cell 4 is the termination cell.
+ */
+std::shared_ptr<const Geometry::NativeModel> createModel(
+                                        const bool reflecting_outer_surface )
+{
+  std::vector<Geometry::QuadricSurface> surfaces;
+
+  surfaces.push_back( Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 10.0 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createXPlane( 2, 0.0 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createSphere( 3, 0.0, 0.0, 0.0, 20.0 ) );
+  surfaces.back().setReflecting( reflecting_outer_surface );
+
+  std::vector<Geometry::NativeCell> cells;
+
+  cells.push_back( Geometry::NativeCell( 1, "-1 -2", 1, -1.0*Geometry::Model::DensityUnit() ) );
+  cells.push_back( Geometry::NativeCell( 2, "-1 2" ) );
+  cells.push_back( Geometry::NativeCell( 3, "1 -3" ) );
+  cells.push_back( Geometry::NativeCell( 4, "3" ) );
+  cells.back().setTermination();
+
+  return std::shared_ptr<const Geometry::NativeModel>(
+                                   new Geometry::NativeModel( surfaces, cells ) );
+}
+
+// Create a test lattice model
+/*! \details Universe 1 is a pin cell: cell 11 is the inside of a z-cylinder
+ * (surface 10) with a radius of 0.4 cm and cell 12 is the outside. Lattice 2
+ * is a 3x3 rectangular lattice of pin cells with a pitch of 1.26 cm that is
+ * centered on the origin. Root cell 1 (bounded by planes 1-4) is filled with
+ * the lattice and cell 2 is the termination cell.
+ */
+std::shared_ptr<const Geometry::NativeModel> createLatticeModel()
+{
+  std::vector<Geometry::QuadricSurface> surfaces;
+
+  surfaces.push_back( Geometry::QuadricSurface::createXPlane( 1, -1.89 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createXPlane( 2, 1.89 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createYPlane( 3, -1.89 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createYPlane( 4, 1.89 ) );
+  surfaces.push_back( Geometry::QuadricSurface::createZCylinder( 10, 0.0, 0.0, 0.4 ) );
+
+  std::vector<Geometry::NativeCell> cells;
+
+  cells.push_back( Geometry::NativeCell( 1, "1 -2 3 -4" ) );
+  cells.back().setFill( 2 );
+  cells.push_back( Geometry::NativeCell( 2, "-1 : 2 : -3 : 4" ) );
+  cells.back().setTermination();
+  cells.push_back( Geometry::NativeCell( 11, "-10", 1, -10.0*Geometry::Model::DensityUnit() ) );
+  cells.back().setUniverseId( 1 );
+  cells.push_back( Geometry::NativeCell( 12, "10", 2, -1.0*Geometry::Model::DensityUnit() ) );
+  cells.back().setUniverseId( 1 );
+
+  const double lower_left_corner[3] = {-1.89, -1.89, 0.0};
+  const double pitch[3] =
+    {1.26, 1.26, std::numeric_limits<double>::infinity()};
+  const unsigned dimensions[3] = {3, 3, 1};
+
+  std::vector<Geometry::NativeLattice> lattices;
+
+  lattices.push_back( Geometry::NativeLattice::createRectangularLattice(
+                                  2,
+                                  lower_left_corner,
+                                  pitch,
+                                  dimensions,
+                                  std::vector<Geometry::NativeLattice::EntityId>( 9, 1 ) ) );
+
+  return std::shared_ptr<const Geometry::NativeModel>(
+                         new Geometry::NativeModel( surfaces, cells, lattices ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the location of a point w.r.t. a cell can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getPointLocation )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  Geometry::Navigator::Ray ray( -5.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 1 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 2 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 3 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  ray.advanceHead( 5.0*cgs::centimeter );
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 1 ),
+                       Geometry::POINT_ON_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 2 ),
+                       Geometry::POINT_ON_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( ray, 3 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface normal can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getSurfaceNormal )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  Geometry::Navigator::Ray ray( 0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                -10.0*cgs::centimeter,
+                                0.0, 0.0, -1.0 );
+
+  double normal[3];
+
+  navigator->getSurfaceNormal( 1, ray, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[1], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[2], -1.0, 1e-15 );
+
+  // The normal must point in the direction of travel
+  ray.changeDirection( 0.0, 0.0, 1.0 );
+
+  navigator->getSurfaceNormal( 1, ray, normal );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[2], 1.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell containing a ray can be found
+FRENSIE_UNIT_TEST( NativeNavigator, findCellContainingRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  Geometry::Navigator::Ray ray( -5.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                0.0*cgs::centimeter,
+                                1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), 1 );
+
+  // On the boundary the direction determines the cell
+  ray.advanceHead( 5.0*cgs::centimeter );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), 2 );
+
+  ray.changeDirection( -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), 1 );
+
+  ray.advanceHead( -15.0*cgs::centimeter );
+
+  Geometry::Navigator::CellIdSet found_cell_cache;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray, found_cell_cache ), 3 );
+  FRENSIE_CHECK( found_cell_cache.count( 3 ) );
+
+  ray.advanceHead( -10.0*cgs::centimeter );
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray, found_cell_cache ), 4 );
+  FRENSIE_CHECK_EQUAL( found_cell_cache.size(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be set
+FRENSIE_UNIT_TEST( NativeNavigator, setState )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  FRENSIE_CHECK( !navigator->isStateSet() );
+
+  navigator->setState( 15.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 1.0, 0.0 );
+
+  FRENSIE_CHECK( navigator->isStateSet() );
+  FRENSIE_CHECK_EQUAL( navigator->getPosition()[0], 15.0*cgs::centimeter );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 1.0 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(),
+                       model->getCellIndex( 3 ) );
+
+  navigator->setState( 15.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 1.0, 0.0,
+                       3 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(),
+                       model->getCellIndex( 3 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest boundary can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getDistanceToClosestBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  navigator->setState( -2.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   2.0*cgs::centimeter,
+                                   1e-15 );
+
+  navigator->setState( 16.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   4.0*cgs::centimeter,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be fired
+FRENSIE_UNIT_TEST( NativeNavigator, fireRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  navigator->setState( -5.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  Length distance = navigator->fireRay( surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 5.0*cgs::centimeter, 1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+
+  navigator->changeDirection( -1.0, 0.0, 0.0 );
+
+  distance = navigator->fireRay( surface_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 5.0*cgs::centimeter, 1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be advanced through the model
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  navigator->setState( -5.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  double normal[3];
+
+  bool reflection = navigator->advanceToCellBoundary( normal );
+
+  FRENSIE_CHECK( !reflection );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_SMALL( navigator->getPosition()[0].value(), 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], 1.0, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   10.0*cgs::centimeter,
+                                   1e-15 );
+
+  reflection = navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK( !reflection );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  reflection = navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK( !reflection );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 4 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   20.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( navigator->fireRay(),
+                       Utility::QuantityTraits<Length>::inf() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be reflected
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary_reflecting )
+{
+  std::shared_ptr<Geometry::Navigator>
+    navigator( reflecting_model->createNavigator() );
+
+  navigator->setState( 15.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  double normal[3];
+
+  bool reflection = navigator->advanceToCellBoundary( normal );
+
+  FRENSIE_CHECK( reflection );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   20.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDirection()[0], -1.0, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   10.0*cgs::centimeter,
+                                   1e-12 );
+
+  reflection = navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK( !reflection );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be advanced by a substep
+FRENSIE_UNIT_TEST( NativeNavigator, advanceBySubstep )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  navigator->setState( -5.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  navigator->advanceBySubstep( 2.0*cgs::centimeter );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   -3.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   3.0*cgs::centimeter,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the navigator can be cloned
+FRENSIE_UNIT_TEST( NativeNavigator, clone )
+{
+  std::shared_ptr<Geometry::Navigator> navigator( model->createNavigator() );
+
+  navigator->setState( 15.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       -1.0, 0.0, 0.0 );
+
+  std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 3 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getPosition()[0],
+                       15.0*cgs::centimeter );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getDirection()[0], -1.0 );
+
+  // The clone must be independent of the original navigator
+  navigator_clone->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell that contains a point in a lattice can be found
+FRENSIE_UNIT_TEST( NativeNavigator, findCellContainingRay_lattice )
+{
+  std::shared_ptr<Geometry::Navigator> navigator(
+                                         lattice_model->createNavigator() );
+
+  const double direction[3] = {1.0, 0.0, 0.0};
+
+  Length position[3] = {0.0*cgs::centimeter,
+                        0.0*cgs::centimeter,
+                        0.0*cgs::centimeter};
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ),
+                       11 );
+
+  position[0] = 0.6*cgs::centimeter;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ),
+                       12 );
+
+  position[0] = 2.0*cgs::centimeter;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ),
+                       2 );
+
+  position[0] = 1.26*cgs::centimeter;
+  position[1] = -1.26*cgs::centimeter;
+  position[2] = 5.0*cgs::centimeter;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ),
+                       11 );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 11 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 12 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell instance can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getCurrentCellInstance )
+{
+  FRENSIE_CHECK_EQUAL( lattice_model->getNumberOfCellInstances( 11 ), 9 );
+  FRENSIE_CHECK_EQUAL( lattice_model->getNumberOfCellInstances( 12 ), 9 );
+  FRENSIE_CHECK_EQUAL( lattice_model->getNumberOfCellInstances( 2 ), 1 );
+
+  std::shared_ptr<Geometry::Navigator> navigator(
+                                         lattice_model->createNavigator() );
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 11 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 4 );
+
+  navigator->setState( 1.26*cgs::centimeter,
+                       1.26*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 11 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 8 );
+
+  navigator->setState( 2.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a ray can be traced through a lattice
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary_lattice )
+{
+  std::shared_ptr<Geometry::Navigator> navigator(
+                                         lattice_model->createNavigator() );
+
+  navigator->setState( -1.7*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 12 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 3 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( surface_hit ),
+                                   0.04*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 10 );
+
+  double normal[3];
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary( normal ) );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 11 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], 1.0, 1e-12 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( surface_hit ),
+                                   0.8*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 10 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 12 );
+
+  // The next boundary is a lattice element boundary
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( surface_hit ),
+                                   0.23*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, Geometry::Navigator::invalidSurfaceId() );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary( normal ) );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 12 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 4 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   -0.63*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( normal[0], 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( surface_hit ),
+                                   0.23*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 10 );
+
+  // Cross the remaining elements
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 11 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 4 );
+
+  navigator->advanceToCellBoundary();
+  navigator->advanceToCellBoundary();
+  navigator->advanceToCellBoundary();
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 12 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellInstance(), 5 );
+
+  // The lattice boundary coincides with the filled cell boundary
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( surface_hit ),
+                                   0.23*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 2 );
+
+  navigator->advanceToCellBoundary();
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0],
+                                   1.89*cgs::centimeter,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a navigator in a lattice can be cloned
+FRENSIE_UNIT_TEST( NativeNavigator, clone_lattice )
+{
+  std::shared_ptr<Geometry::Navigator> navigator(
+                                         lattice_model->createNavigator() );
+
+  navigator->setState( 1.26*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 1.0, 0.0 );
+
+  std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 11 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCellInstance(), 5 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator_clone->fireRay(),
+                                   0.4*cgs::centimeter,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                              navigator_clone->getDistanceToClosestBoundary(),
+                              0.4*cgs::centimeter,
+                              1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  model = createModel( false );
+  reflecting_model = createModel( true );
+  lattice_model = createLatticeModel();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeNavigator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,261 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstQuadricSurface.cpp
+//! \author Alex Robinson
+//! \brief  Quadric surface class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_QuadricSurface.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the surface id can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getId )
+{
+  Geometry::QuadricSurface surface =
+    Geometry::QuadricSurface::createXPlane( 3, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( surface.getId(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the reflecting surface flag can be set
+FRENSIE_UNIT_TEST( QuadricSurface, setReflecting )
+{
+  Geometry::QuadricSurface surface =
+    Geometry::QuadricSurface::createXPlane( 1, 1.0 );
+
+  FRENSIE_CHECK( !surface.isReflecting() );
+
+  surface.setReflecting();
+
+  FRENSIE_CHECK( surface.isReflecting() );
+
+  surface.setReflecting( false );
+
+  FRENSIE_CHECK( !surface.isReflecting() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface area can be set
+FRENSIE_UNIT_TEST( QuadricSurface, setArea )
+{
+  Geometry::QuadricSurface surface =
+    Geometry::QuadricSurface::createXPlane( 1, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( surface.getArea(), 1.0 );
+
+  surface.setArea( 2.0 );
+
+  FRENSIE_CHECK_EQUAL( surface.getArea(), 2.0 );
+
+  surface = Geometry::QuadricSurface::createSphere( 2, 0.0, 0.0, 0.0, 2.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( surface.getArea(), 16*M_PI, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the surface is planar
+FRENSIE_UNIT_TEST( QuadricSurface, isPlanar )
+{
+  FRENSIE_CHECK( Geometry::QuadricSurface::createPlane( 1, 1.0, 1.0, 0.0, 1.0 ).isPlanar() );
+  FRENSIE_CHECK( Geometry::QuadricSurface::createZPlane( 1, 1.0 ).isPlanar() );
+  FRENSIE_CHECK( !Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 1.0 ).isPlanar() );
+  FRENSIE_CHECK( !Geometry::QuadricSurface::createZCylinder( 1, 0.0, 0.0, 1.0 ).isPlanar() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface function can be evaluated
+FRENSIE_UNIT_TEST( QuadricSurface, evaluate )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1, 1.0, 0.0, 0.0, 2.0 );
+
+  double position[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( sphere.evaluate( position ), -4.0 );
+
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_SMALL( sphere.evaluate( position ), 1e-15 );
+
+  position[0] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.evaluate( position ), 5.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sense of a point can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getSense )
+{
+  Geometry::QuadricSurface cylinder =
+    Geometry::QuadricSurface::createZCylinder( 1, 0.0, 0.0, 1.0 );
+
+  double position[3] = {0.5, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( cylinder.getSense( position, direction ), -1 );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( cylinder.getSense( position, direction ), 1 );
+
+  // On the surface the direction determines the sense
+  position[0] = 1.0;
+
+  FRENSIE_CHECK( cylinder.isOn( position ) );
+  FRENSIE_CHECK_EQUAL( cylinder.getSense( position, direction ), 1 );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( cylinder.getSense( position, direction ), -1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unit normal can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getUnitNormal )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 2.0 );
+
+  double position[3] = {0.0, 2.0, 0.0};
+  double normal[3];
+
+  sphere.getUnitNormal( position, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the surface along a ray can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getDistance )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 2.0 );
+
+  // Inside of the sphere
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {0.0, 0.0, 1.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   2.0,
+                                   1e-15 );
+
+  // Outside of the sphere (pointing toward it)
+  position[2] = -5.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   3.0,
+                                   1e-15 );
+
+  // Outside of the sphere (pointing away from it)
+  direction[2] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  // On the sphere (pointing inward)
+  position[2] = 2.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction ),
+                                   4.0,
+                                   1e-15 );
+
+  // On the sphere (pointing outward)
+  direction[2] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction ),
+                       std::numeric_limits<double>::infinity() );
+
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createXPlane( 2, 1.0 );
+
+  position[2] = 0.0;
+  direction[0] = 1.0/sqrt(2.0);
+  direction[1] = 0.0;
+  direction[2] = 1.0/sqrt(2.0);
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistance( position, direction ),
+                                   sqrt(2.0),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest point on the surface can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getDistanceToClosestPoint )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1, 1.0, 0.0, 0.0, 2.0 );
+
+  double position[3] = {1.5, 0.0, 0.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistanceToClosestPoint( position ),
+                                   1.5,
+                                   1e-15 );
+
+  Geometry::QuadricSurface cylinder =
+    Geometry::QuadricSurface::createYCylinder( 2, 1.0, 0.0, 1.0 );
+
+  position[0] = 4.0;
+  position[1] = 10.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cylinder.getDistanceToClosestPoint( position ),
+                                   2.0,
+                                   1e-15 );
+
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createPlane( 3, 0.0, 2.0, 0.0, 2.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistanceToClosestPoint( position ),
+                                   9.0,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the half space bounding box can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getHalfSpaceBoundingBox )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1, 1.0, 0.0, 0.0, 2.0 );
+
+  Geometry::AxisAlignedBoundingBox box = sphere.getHalfSpaceBoundingBox( -1 );
+
+  FRENSIE_CHECK( box.isFinite() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getLowerBound( 0 ), -1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getUpperBound( 0 ), 3.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getLowerBound( 1 ), -2.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getUpperBound( 1 ), 2.0, 1e-15 );
+
+  box = sphere.getHalfSpaceBoundingBox( 1 );
+
+  FRENSIE_CHECK( !box.isFinite() );
+
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createZPlane( 2, 1.0 );
+
+  box = plane.getHalfSpaceBoundingBox( -1 );
+
+  FRENSIE_CHECK_EQUAL( box.getLowerBound( 2 ),
+                       -std::numeric_limits<double>::infinity() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getUpperBound( 2 ), 1.0, 1e-15 );
+
+  box = plane.getHalfSpaceBoundingBox( 1 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( box.getLowerBound( 2 ), 1.0, 1e-15 );
+  FRENSIE_CHECK_EQUAL( box.getUpperBound( 2 ),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstQuadricSurface.cpp
+//---------------------------------------------------------------------------//
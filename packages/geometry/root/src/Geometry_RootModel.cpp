@@ -379,6 +379,29 @@ bool RootModel::doesCellExist( const EntityId cell_id ) const
   return d_cell_id_uid_map.find( cell_id ) != d_cell_id_uid_map.end();
 }
 
+// Get the number of cells
+size_t RootModel::getNumberOfCells() const
+{
+  // Make sure that root has been initialized
+  testPrecondition( this->isInitialized() );
+
+  return d_cell_id_uid_map.size();
+}
+
+// Get the cell index
+/*! \details The cell index is the position of the volume in the Root
+ * volume list.
+ */
+size_t RootModel::getCellIndex( const EntityId cell_id ) const
+{
+  // Make sure that root has been initialized
+  testPrecondition( this->isInitialized() );
+  // Make sure the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return this->getVolumePtr( cell_id )->GetNumber();
+}
+
 // Check if the cell is a termination cell
 bool RootModel::isTerminationCell( const EntityId cell_id ) const
 {
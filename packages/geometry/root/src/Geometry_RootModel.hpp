@@ -93,6 +93,12 @@ public:
   //! Check if a cell exists
   bool doesCellExist( const EntityId cell_id ) const override;
 
+  //! Get the number of cells
+  size_t getNumberOfCells() const override;
+
+  //! Get the cell index
+  size_t getCellIndex( const EntityId cell_id ) const override;
+
   //! Check if the cell is a termination cell
   bool isTerminationCell( const EntityId cell_id ) const override;
 
@@ -305,6 +305,15 @@ auto RootNavigator::getCurrentCell() const -> EntityId
   return d_navigator->GetCurrentVolume()->GetUniqueID();
 }
 
+// Get the index of the cell containing the internal Root ray position
+size_t RootNavigator::getCurrentCellIndex() const
+{
+  // Make sure that the internal ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_navigator->GetCurrentVolume()->GetNumber();
+}
+
 // Get the distance from the internal Root ray pos. to the nearest boundary in all directions
 auto RootNavigator::getDistanceToClosestBoundary() -> Length
 {
@@ -122,6 +122,9 @@ public:
   virtual void getStartingCells( const size_t component,
                                  CellIdSet& starting_cells ) const = 0;
 
+  //! Check if every source component emits particles isotropically
+  virtual bool isDirectionallyUniform() const = 0;
+
 private:
 
   // Serialize the data
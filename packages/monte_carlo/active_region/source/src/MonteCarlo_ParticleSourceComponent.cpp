@@ -25,7 +25,8 @@ namespace MonteCarlo{
 
 // Default constructor
 ParticleSourceComponent::ParticleSourceComponent()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_rejection_cell_grid_initialized( false )
 { /* ... */ }
 
 // Constructor
@@ -43,7 +44,10 @@ ParticleSourceComponent::ParticleSourceComponent(
  * cells in the model of interest. Any sampled particle states with spatial
  * coordinates that do not fall within one of the rejection cells will be
  * discarded and a new state will be sampled. If no rejection cells are
- * specified all sampled particle states will be used.
+ * specified all sampled particle states will be used. If the model can
+ * provide a bounding box for every rejection cell, a coarse voxel grid over
+ * the rejection cells will be used to reject most invalid positions without
+ * querying the model (see MonteCarlo::SourceRejectionCellGrid).
  */
 ParticleSourceComponent::ParticleSourceComponent(
                           const Id id,
@@ -53,6 +57,8 @@ ParticleSourceComponent::ParticleSourceComponent(
   : d_id( id ),
     d_selection_weight( selection_weight ),
     d_rejection_cells( rejection_cells ),
+    d_rejection_cell_grid(),
+    d_rejection_cell_grid_initialized( false ),
     d_model( model ),
     d_navigator( 1, model->createNavigator() ),
     d_start_cell_cache( 1, rejection_cells ),
@@ -75,6 +81,8 @@ ParticleSourceComponent::ParticleSourceComponent(
                         "Rejection cell " << rejection_cell << " does "
                         "not exist!" );
   }
+
+  this->initializeRejectionCellGrid();
 }
 
 // Enable thread support
@@ -187,6 +195,13 @@ void ParticleSourceComponent::sampleParticleState(
   {
     d_navigator[Utility::OpenMPProperties::getThreadId()] =
       d_model->createNavigator();
+
+    // Just-in-time initialization of the rejection cell grid
+    #pragma omp critical( source_rejection_cell_grid_initialization )
+    {
+      if( !d_rejection_cell_grid_initialized )
+        this->initializeRejectionCellGrid();
+    }
   }
 
   // Cache some data for this thread in case they need to be
@@ -217,6 +232,8 @@ void ParticleSourceComponent::sampleParticleState(
 
     bool valid_sample = false;
 
+    Geometry::Model::EntityId rejection_cell = Geometry::Model::invalidCellId();
+
     while( true )
     {
       // Increment the trial counter
@@ -227,7 +244,9 @@ void ParticleSourceComponent::sampleParticleState(
         this->sampleParticleStateImpl( particle, history_state_id );
 
       // Check if the particle position is inside of a rejection cell
-      if( this->isSampledParticlePositionValid( *particle, navigator ) )
+      if( this->isSampledParticlePositionValid( *particle,
+                                                navigator,
+                                                rejection_cell ) )
       {
         valid_sample = true;
         break;
@@ -247,17 +266,23 @@ void ParticleSourceComponent::sampleParticleState(
     {
       Geometry::Model::EntityId start_cell_id;
 
-      try{
-        start_cell_id =
-          navigator.findCellContainingRay( Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( particle->getPosition() ),
-                                           particle->getDirection(),
-                                           start_cell_cache );
+      // The rejection cell that contains the particle is the start cell
+      if( rejection_cell != Geometry::Model::invalidCellId() )
+        start_cell_id = rejection_cell;
+      else
+      {
+        try{
+          start_cell_id =
+            navigator.findCellContainingRay( Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( particle->getPosition() ),
+                                             particle->getDirection(),
+                                             start_cell_cache );
+        }
+        EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                                 "Unable to embed the sampled particle "
+                                 << particle->getHistoryNumber() << " in "
+                                 "the correct location of model "
+                                 << d_model->getName() << "!" );
       }
-      EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                               "Unable to embed the sampled particle "
-                               << particle->getHistoryNumber() << " in "
-                               "the correct location of model "
-                               << d_model->getName() << "!" );
 
       // Embed the particle in the model
       particle->embedInModel( d_model, start_cell_id );
@@ -494,23 +519,104 @@ auto ParticleSourceComponent::reduceLocalTrialCounters() const -> Counter
                           0ull );
 }
 
+// Initialize the rejection cell grid
+/*! \details The grid will only be created if the model can provide a
+ * bounding box for every rejection cell.
+ */
+void ParticleSourceComponent::initializeRejectionCellGrid()
+{
+  d_rejection_cell_grid.reset();
+
+  if( d_rejection_cells.size() > 0 )
+  {
+    SourceRejectionCellGrid::CellIdBoundingBoxMap cell_bounding_boxes;
+
+    bool all_cells_bounded = true;
+
+    for( auto rejection_cell : d_rejection_cells )
+    {
+      Geometry::Model::Length lower_bounds[3], upper_bounds[3];
+
+      if( !d_model->getCellBoundingBox( rejection_cell,
+                                        lower_bounds,
+                                        upper_bounds ) )
+      {
+        all_cells_bounded = false;
+        break;
+      }
+
+      SourceRejectionCellGrid::BoundingBox& cell_bounding_box =
+        cell_bounding_boxes[rejection_cell];
+
+      for( size_t i = 0; i < 3; ++i )
+      {
+        cell_bounding_box[2*i] = lower_bounds[i].value();
+        cell_bounding_box[2*i+1] = upper_bounds[i].value();
+      }
+    }
+
+    if( all_cells_bounded )
+    {
+      d_rejection_cell_grid.reset(
+                          new SourceRejectionCellGrid( cell_bounding_boxes ) );
+    }
+  }
+
+  d_rejection_cell_grid_initialized = true;
+}
+
 // Check if the sampled particle position is valid
+/*! \details If the position is valid the rejection cell that contains it
+ * will be returned (the invalid cell id will be returned if there are no
+ * rejection cells).
+ */
 bool ParticleSourceComponent::isSampledParticlePositionValid(
-                                   const ParticleState& particle,
-                                   const Geometry::Navigator& navigator ) const
+                           const ParticleState& particle,
+                           const Geometry::Navigator& navigator,
+                           Geometry::Model::EntityId& rejection_cell ) const
 {
+  rejection_cell = Geometry::Model::invalidCellId();
+
   // Check if the position is acceptable
   if( d_rejection_cells.size() > 0 )
   {
-    for( auto rejection_cell : d_rejection_cells )
+    // Only the rejection cells that overlap the voxel need to be checked
+    if( d_rejection_cell_grid )
+    {
+      Utility::ArrayView<const Geometry::Model::EntityId> candidate_cells =
+        d_rejection_cell_grid->getCandidateCells( particle.getPosition() );
+
+      for( auto candidate_cell : candidate_cells )
+      {
+        Geometry::PointLocation location =
+          navigator.getPointLocation( Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( particle.getPosition() ),
+                                      particle.getDirection(),
+                                      candidate_cell );
+
+        if( location == Geometry::POINT_INSIDE_CELL )
+        {
+          rejection_cell = candidate_cell;
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    for( auto rejection_cell_id : d_rejection_cells )
     {
       Geometry::PointLocation location =
         navigator.getPointLocation( Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( particle.getPosition() ),
                                     particle.getDirection(),
-                                    rejection_cell );
+                                    rejection_cell_id );
 
       if( location == Geometry::POINT_INSIDE_CELL )
+      {
+        rejection_cell = rejection_cell_id;
+
         return true;
+      }
     }
 
     return false;
@@ -23,6 +23,7 @@
 #include "MonteCarlo_ParticleBank.hpp"
 #include "MonteCarlo_PhaseSpaceDimension.hpp"
 #include "MonteCarlo_UniqueIdManager.hpp"
+#include "MonteCarlo_SourceRejectionCellGrid.hpp"
 #include "Geometry_Model.hpp"
 #include "Geometry_Navigator.hpp"
 #include "Utility_Communicator.hpp"
@@ -107,6 +108,9 @@ public:
   virtual double getDimensionSamplingEfficiency(
                                const PhaseSpaceDimension dimension ) const = 0;
 
+  //! Check if the component emits particles isotropically
+  virtual bool isDirectionallyUniform() const = 0;
+
   //! Print a summary of the sampling statistics
   virtual void printSummary( std::ostream& os ) const = 0;
 
@@ -200,9 +204,14 @@ private:
   // Reduce the local trials counters
   Counter reduceLocalTrialCounters() const;
 
+  // Initialize the rejection cell grid
+  void initializeRejectionCellGrid();
+
   // Check if the sampled particle position is valid
-  bool isSampledParticlePositionValid( const ParticleState& particle,
-                                       const Geometry::Navigator& navigator ) const;
+  bool isSampledParticlePositionValid(
+                        const ParticleState& particle,
+                        const Geometry::Navigator& navigator,
+                        Geometry::Model::EntityId& rejection_cell ) const;
 
   // Save the data to an archive
   template<typename Archive>
@@ -226,6 +235,12 @@ private:
   // The rejection cells
   CellIdSet d_rejection_cells;
 
+  // The rejection cell grid (null if a rejection cell is not bounded)
+  std::shared_ptr<const SourceRejectionCellGrid> d_rejection_cell_grid;
+
+  // Records if the rejection cell grid has been initialized
+  bool d_rejection_cell_grid_initialized;
+
   // The model that the source is embedded in
   std::shared_ptr<const Geometry::Model> d_model;
 
@@ -278,6 +293,10 @@ void ParticleSourceComponent::load( Archive& ar, const unsigned version )
   d_navigator.resize( 1 );
   d_navigator.front().reset();
 
+  // The rejection cell grid will be initialized with the navigators
+  d_rejection_cell_grid.reset();
+  d_rejection_cell_grid_initialized = false;
+
   CellIdSet start_cell_cache;
   ar & BOOST_SERIALIZATION_NVP( start_cell_cache );
 
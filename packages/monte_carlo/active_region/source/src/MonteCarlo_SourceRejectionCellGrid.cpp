@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SourceRejectionCellGrid.cpp
+//! \author Alex Robinson
+//! \brief  The source rejection cell grid class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_SourceRejectionCellGrid.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details Each dimension of the union of the cell bounding boxes will be
+ * divided into max_voxels_per_dimension voxels (unless the dimension has
+ * zero width).
+ */
+SourceRejectionCellGrid::SourceRejectionCellGrid(
+                           const CellIdBoundingBoxMap& cell_bounding_boxes,
+                           const unsigned max_voxels_per_dimension )
+  : d_bounding_box( {std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::lowest()} ),
+    d_voxel_candidate_offsets(),
+    d_voxel_candidate_cells()
+{
+  // Make sure that there is at least one cell
+  testPrecondition( !cell_bounding_boxes.empty() );
+  // Make sure that the max number of voxels is valid
+  testPrecondition( max_voxels_per_dimension > 0 );
+
+  // Calculate the union of the cell bounding boxes
+  for( auto&& cell_bounding_box : cell_bounding_boxes )
+  {
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      // Make sure that the box is valid
+      testPrecondition( cell_bounding_box.second[2*d] <=
+                        cell_bounding_box.second[2*d+1] );
+
+      d_bounding_box[2*d] = std::min( d_bounding_box[2*d],
+                                      cell_bounding_box.second[2*d] );
+      d_bounding_box[2*d+1] = std::max( d_bounding_box[2*d+1],
+                                        cell_bounding_box.second[2*d+1] );
+    }
+  }
+
+  // Set up the voxels
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    const double width = d_bounding_box[2*d+1] - d_bounding_box[2*d];
+
+    if( width > 0.0 )
+    {
+      d_number_of_voxels[d] = max_voxels_per_dimension;
+      d_inverse_voxel_widths[d] = max_voxels_per_dimension/width;
+    }
+    else
+    {
+      d_number_of_voxels[d] = 1;
+      d_inverse_voxel_widths[d] = 0.0;
+    }
+  }
+
+  const size_t number_of_voxels =
+    d_number_of_voxels[0]*d_number_of_voxels[1]*d_number_of_voxels[2];
+
+  // Find the voxel range that each cell bounding box overlaps
+  std::vector<std::vector<EntityId> > voxel_cells( number_of_voxels );
+
+  for( auto&& cell_bounding_box : cell_bounding_boxes )
+  {
+    unsigned lower_indices[3], upper_indices[3];
+
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      // The same index calculation is used for the positions so that a
+      // position inside of a cell box is always assigned to a voxel that
+      // lists the cell
+      lower_indices[d] = std::min(
+             static_cast<unsigned>( (cell_bounding_box.second[2*d] - d_bounding_box[2*d])*d_inverse_voxel_widths[d] ),
+             d_number_of_voxels[d]-1 );
+
+      upper_indices[d] = std::min(
+             static_cast<unsigned>( (cell_bounding_box.second[2*d+1] - d_bounding_box[2*d])*d_inverse_voxel_widths[d] ),
+             d_number_of_voxels[d]-1 );
+    }
+
+    for( unsigned k = lower_indices[2]; k <= upper_indices[2]; ++k )
+    {
+      for( unsigned j = lower_indices[1]; j <= upper_indices[1]; ++j )
+      {
+        for( unsigned i = lower_indices[0]; i <= upper_indices[0]; ++i )
+        {
+          voxel_cells[i + d_number_of_voxels[0]*(j + d_number_of_voxels[1]*k)].push_back( cell_bounding_box.first );
+        }
+      }
+    }
+  }
+
+  // Pack the voxel candidate cells
+  d_voxel_candidate_offsets.resize( number_of_voxels + 1 );
+  d_voxel_candidate_offsets[0] = 0;
+
+  for( size_t i = 0; i < number_of_voxels; ++i )
+  {
+    d_voxel_candidate_offsets[i+1] =
+      d_voxel_candidate_offsets[i] + voxel_cells[i].size();
+
+    d_voxel_candidate_cells.insert( d_voxel_candidate_cells.end(),
+                                    voxel_cells[i].begin(),
+                                    voxel_cells[i].end() );
+  }
+}
+
+// Get the bounding box of the rejection cells
+auto SourceRejectionCellGrid::getBoundingBox() const -> const BoundingBox&
+{
+  return d_bounding_box;
+}
+
+// Get the number of voxels in a dimension
+unsigned SourceRejectionCellGrid::getNumberOfVoxels(
+                                          const unsigned dimension ) const
+{
+  // Make sure that the dimension is valid
+  testPrecondition( dimension < 3 );
+
+  return d_number_of_voxels[dimension];
+}
+
+// Get the rejection cells that could contain a position
+/*! \details An empty view will be returned if the position is outside of
+ * all of the rejection cell bounding boxes.
+ */
+Utility::ArrayView<const Geometry::Model::EntityId>
+SourceRejectionCellGrid::getCandidateCells( const double position[3] ) const
+{
+  unsigned indices[3];
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    if( !(position[d] >= d_bounding_box[2*d] &&
+          position[d] <= d_bounding_box[2*d+1]) )
+      return Utility::ArrayView<const EntityId>();
+
+    indices[d] = std::min(
+             static_cast<unsigned>( (position[d] - d_bounding_box[2*d])*d_inverse_voxel_widths[d] ),
+             d_number_of_voxels[d]-1 );
+  }
+
+  const size_t voxel_index =
+    indices[0] + d_number_of_voxels[0]*(indices[1] + d_number_of_voxels[1]*indices[2]);
+
+  return Utility::ArrayView<const EntityId>(
+       d_voxel_candidate_cells.data() + d_voxel_candidate_offsets[voxel_index],
+       d_voxel_candidate_cells.data() + d_voxel_candidate_offsets[voxel_index+1] );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SourceRejectionCellGrid.cpp
+//---------------------------------------------------------------------------//
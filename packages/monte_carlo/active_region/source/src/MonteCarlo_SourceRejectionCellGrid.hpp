@@ -0,0 +1,90 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SourceRejectionCellGrid.hpp
+//! \author Alex Robinson
+//! \brief  The source rejection cell grid class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SOURCE_REJECTION_CELL_GRID_HPP
+#define MONTE_CARLO_SOURCE_REJECTION_CELL_GRID_HPP
+
+// Std Lib Includes
+#include <array>
+
+// FRENSIE Includes
+#include "Geometry_Model.hpp"
+#include "Utility_ArrayView.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Map.hpp"
+
+namespace MonteCarlo{
+
+/*! The source rejection cell grid
+ * \details This class is used to accelerate the rejection of sampled source
+ * positions that are not inside of any of the source rejection cells. The
+ * union of the rejection cell bounding boxes is divided into a coarse
+ * voxel grid and the rejection cells that overlap each voxel are cached.
+ * Positions outside of the union box (or in an empty voxel) can be rejected
+ * without querying the geometry and positions inside of a voxel only need
+ * to be tested against the cells that overlap the voxel. Since the bounding
+ * boxes enclose the cells, no valid positions are ever rejected by the grid.
+ */
+class SourceRejectionCellGrid
+{
+
+public:
+
+  //! The cell id type
+  typedef Geometry::Model::EntityId EntityId;
+
+  //! The bounding box type (x_min, x_max, y_min, y_max, z_min, z_max)
+  typedef std::array<double,6> BoundingBox;
+
+  //! The cell id bounding box map type
+  typedef std::map<EntityId,BoundingBox> CellIdBoundingBoxMap;
+
+  //! Constructor
+  SourceRejectionCellGrid(
+                  const CellIdBoundingBoxMap& cell_bounding_boxes,
+                  const unsigned max_voxels_per_dimension = 16 );
+
+  //! Destructor
+  ~SourceRejectionCellGrid()
+  { /* ... */ }
+
+  //! Get the bounding box of the rejection cells
+  const BoundingBox& getBoundingBox() const;
+
+  //! Get the number of voxels in a dimension
+  unsigned getNumberOfVoxels( const unsigned dimension ) const;
+
+  //! Get the rejection cells that could contain a position
+  Utility::ArrayView<const EntityId>
+  getCandidateCells( const double position[3] ) const;
+
+private:
+
+  // The union of the rejection cell bounding boxes
+  BoundingBox d_bounding_box;
+
+  // The number of voxels in each dimension
+  unsigned d_number_of_voxels[3];
+
+  // The inverse voxel widths
+  double d_inverse_voxel_widths[3];
+
+  // The offset of the first candidate cell of each voxel (x-fastest)
+  std::vector<size_t> d_voxel_candidate_offsets;
+
+  // The candidate cells of every voxel
+  std::vector<EntityId> d_voxel_candidate_cells;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SOURCE_REJECTION_CELL_GRID_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SourceRejectionCellGrid.hpp
+//---------------------------------------------------------------------------//
@@ -295,6 +295,18 @@ void StandardParticleSource::getStartingCells( const size_t component,
   d_components[component]->getStartingCells( starting_cells );
 }
 
+// Check if every source component emits particles isotropically
+bool StandardParticleSource::isDirectionallyUniform() const
+{
+  for( size_t i = 0; i < d_components.size(); ++i )
+  {
+    if( !d_components[i]->isDirectionallyUniform() )
+      return false;
+  }
+
+  return true;
+}
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::StandardParticleSource );
@@ -111,6 +111,9 @@ public:
   void getStartingCells( const size_t component,
                          CellIdSet& starting_cells ) const final override;
 
+  //! Check if every source component emits particles isotropically
+  bool isDirectionallyUniform() const final override;
+
 private:
 
   // Default Constructor
@@ -132,6 +132,13 @@ double StandardParticleSourceComponent<ParticleStateType>::getDimensionSamplingE
     return 1.0;
 }
 
+// Check if the component emits particles isotropically
+template<typename ParticleStateType>
+bool StandardParticleSourceComponent<ParticleStateType>::isDirectionallyUniform() const
+{
+  return d_particle_distribution->isDirectionallyUniform();
+}
+
 // Print a summary of the sampling statistics
 /*! \details Only the master thread should call this method.
  */
@@ -0,0 +1,440 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceParticleSourceComponent.cpp
+//! \author Alex Robinson
+//! \brief  The surface source particle source component class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_SurfaceSourceParticleSourceComponent.hpp"
+#include "MonteCarlo_ParticleStateFactory.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default Constructor
+SurfaceSourceParticleSourceComponent::SurfaceSourceParticleSourceComponent()
+  : d_min_energy( 0.0 ),
+    d_max_energy( std::numeric_limits<double>::infinity() ),
+    d_lower_bounds( {-std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity()} ),
+    d_upper_bounds( {std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity()} ),
+    d_weight_multiplier( 1.0 ),
+    d_history_cache( 1 )
+{
+  d_history_cache.front().loaded = false;
+}
+
+// Constructor
+SurfaceSourceParticleSourceComponent::SurfaceSourceParticleSourceComponent(
+                          const Id id,
+                          const double selection_weight,
+                          const std::shared_ptr<const Geometry::Model>& model,
+                          const boost::filesystem::path& surface_source_file )
+  : SurfaceSourceParticleSourceComponent( id,
+                                          selection_weight,
+                                          CellIdSet(),
+                                          model,
+                                          surface_source_file )
+{ /* ... */ }
+
+// Constructor (with rejection cells)
+SurfaceSourceParticleSourceComponent::SurfaceSourceParticleSourceComponent(
+                          const Id id,
+                          const double selection_weight,
+                          const CellIdSet& rejection_cells,
+                          const std::shared_ptr<const Geometry::Model>& model,
+                          const boost::filesystem::path& surface_source_file )
+  : ParticleSourceComponent( id, selection_weight, rejection_cells, model ),
+    d_surface_source_file_name( surface_source_file ),
+    d_surface_source_file(),
+    d_min_energy( 0.0 ),
+    d_max_energy( std::numeric_limits<double>::infinity() ),
+    d_lower_bounds( {-std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity(),
+                     -std::numeric_limits<double>::infinity()} ),
+    d_upper_bounds( {std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity(),
+                     std::numeric_limits<double>::infinity()} ),
+    d_surfaces(),
+    d_particle_types(),
+    d_weight_multiplier( 1.0 ),
+    d_history_cache( 1 )
+{
+  d_history_cache.front().loaded = false;
+
+  this->openSurfaceSourceFile();
+}
+
+// Open the surface source file
+void SurfaceSourceParticleSourceComponent::openSurfaceSourceFile()
+{
+  try{
+    d_surface_source_file.reset(
+                 new SurfaceSourceFileReader( d_surface_source_file_name ) );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Could not open the surface source file for "
+                           "source component " << this->getId() << "!" );
+}
+
+// Return the surface source file name
+const boost::filesystem::path&
+SurfaceSourceParticleSourceComponent::getSurfaceSourceFileName() const
+{
+  return d_surface_source_file_name;
+}
+
+// Return the number of source histories in the surface source file
+uint64_t SurfaceSourceParticleSourceComponent::getNumberOfSourceHistories() const
+{
+  return d_surface_source_file->getNumberOfSourceHistories();
+}
+
+// Only replay particles in the energy range [min_energy,max_energy]
+void SurfaceSourceParticleSourceComponent::setEnergyRange(
+                                                      const double min_energy,
+                                                      const double max_energy )
+{
+  // Make sure the energy range is valid
+  testPrecondition( min_energy >= 0.0 );
+  testPrecondition( min_energy < max_energy );
+
+  d_min_energy = min_energy;
+  d_max_energy = max_energy;
+
+  this->clearHistoryCache();
+}
+
+// Only replay particles inside of the box [lower_bounds,upper_bounds]
+void SurfaceSourceParticleSourceComponent::setSpatialBounds(
+                                   const std::array<double,3>& lower_bounds,
+                                   const std::array<double,3>& upper_bounds )
+{
+  // Make sure the bounds are valid
+  testPrecondition( lower_bounds[0] < upper_bounds[0] );
+  testPrecondition( lower_bounds[1] < upper_bounds[1] );
+  testPrecondition( lower_bounds[2] < upper_bounds[2] );
+
+  d_lower_bounds = lower_bounds;
+  d_upper_bounds = upper_bounds;
+
+  this->clearHistoryCache();
+}
+
+// Only replay particles that crossed one of the surfaces
+void SurfaceSourceParticleSourceComponent::setSurfaces(
+                                                 const SurfaceIdSet& surfaces )
+{
+  d_surfaces = surfaces;
+
+  this->clearHistoryCache();
+}
+
+// Only replay particles of the particle types
+void SurfaceSourceParticleSourceComponent::setParticleTypes(
+                                 const std::set<ParticleType>& particle_types )
+{
+  d_particle_types = particle_types;
+
+  this->clearHistoryCache();
+}
+
+// Set the weight multiplier that will be applied to replayed particles
+void SurfaceSourceParticleSourceComponent::setWeightMultiplier(
+                                                const double weight_multiplier )
+{
+  // Make sure the weight multiplier is valid
+  testPrecondition( weight_multiplier > 0.0 );
+
+  d_weight_multiplier = weight_multiplier;
+}
+
+// Return the weight multiplier
+double SurfaceSourceParticleSourceComponent::getWeightMultiplier() const
+{
+  return d_weight_multiplier;
+}
+
+// Return the number of sampling trials in the phase space dimension
+/*! \details The phase space dimensions are not sampled so zero will always
+ * be returned.
+ */
+auto SurfaceSourceParticleSourceComponent::getNumberOfDimensionTrials(
+                       const PhaseSpaceDimension dimension ) const -> Counter
+{
+  return 0;
+}
+
+// Return the number of samples in the phase space dimension
+/*! \details The phase space dimensions are not sampled so zero will always
+ * be returned.
+ */
+auto SurfaceSourceParticleSourceComponent::getNumberOfDimensionSamples(
+                       const PhaseSpaceDimension dimension ) const -> Counter
+{
+  return 0;
+}
+
+// Return the sampling efficiency in the phase space dimension
+double SurfaceSourceParticleSourceComponent::getDimensionSamplingEfficiency(
+                                   const PhaseSpaceDimension dimension ) const
+{
+  return 1.0;
+}
+
+// Check if the component emits particles isotropically
+/*! \details The replayed particle directions come from the recorded
+ * surface crossings, which are generally not isotropic.
+ */
+bool SurfaceSourceParticleSourceComponent::isDirectionallyUniform() const
+{
+  return false;
+}
+
+// Print a summary of the sampling statistics
+void SurfaceSourceParticleSourceComponent::printSummary( std::ostream& os ) const
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  std::string particle_types_generated;
+
+  if( d_particle_types.empty() )
+    particle_types_generated = "Recorded";
+  else
+  {
+    std::set<ParticleType>::const_iterator particle_type_it =
+      d_particle_types.begin();
+
+    while( particle_type_it != d_particle_types.end() )
+    {
+      particle_types_generated += Utility::toString( *particle_type_it );
+
+      ++particle_type_it;
+
+      if( particle_type_it != d_particle_types.end() )
+        particle_types_generated += ", ";
+    }
+  }
+
+  // Print the source sampling statistics
+  this->printStandardSummary( "Surface Source Component",
+                              particle_types_generated,
+                              this->getNumberOfTrials(),
+                              this->getNumberOfSamples(),
+                              this->getSamplingEfficiency(),
+                              os );
+
+  os << "  Surface Source File: " << d_surface_source_file_name.string()
+     << " (" << d_surface_source_file->getNumberOfSourceHistories()
+     << " source histories)" << std::endl;
+
+  // Print the starting cell summary
+  CellIdSet starting_cells;
+  this->getStartingCells( starting_cells );
+
+  this->printStandardStartingCellSummary( starting_cells, os );
+}
+
+// Enable thread support
+/*! \details Only the master thread should call this method.
+ */
+void SurfaceSourceParticleSourceComponent::enableThreadSupportImpl(
+                                                          const size_t threads )
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure a valid number of threads has been requested
+  testPrecondition( threads > 0 );
+
+  if( threads > d_history_cache.size() )
+  {
+    const size_t old_size = d_history_cache.size();
+
+    d_history_cache.resize( threads );
+
+    for( size_t i = old_size; i < d_history_cache.size(); ++i )
+      d_history_cache[i].loaded = false;
+  }
+}
+
+// Reset the sampling statistics
+void SurfaceSourceParticleSourceComponent::resetDataImpl()
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->clearHistoryCache();
+}
+
+// Clear the history particle cache of every thread
+/*! \details The cached particles must be cleared whenever the replayed
+ * particle subset changes.
+ */
+void SurfaceSourceParticleSourceComponent::clearHistoryCache()
+{
+  for( auto&& thread_history_cache : d_history_cache )
+  {
+    thread_history_cache.loaded = false;
+    thread_history_cache.particles.clear();
+  }
+}
+
+// Reduce the sampling statistics on the root process
+/*! \details The phase space dimensions are not sampled so there are no
+ * statistics to reduce.
+ */
+void SurfaceSourceParticleSourceComponent::reduceDataImpl(
+                                             const Utility::Communicator& comm,
+                                             const int root_process )
+{ /* ... */ }
+
+// Return the number of particle states that will be sampled for the given
+// history number
+unsigned long long
+SurfaceSourceParticleSourceComponent::getNumberOfParticleStateSamples(
+                                     const unsigned long long history ) const
+{
+  return this->loadHistory( history ).size();
+}
+
+// Load the particles of a history into the cache of the calling thread
+/*! \details The recorded particles of a history will only be read from the
+ * file once, regardless of the number of times that this method is called
+ * for that history.
+ */
+const std::vector<SurfaceSourceParticleRecord>&
+SurfaceSourceParticleSourceComponent::loadHistory(
+                                     const unsigned long long history ) const
+{
+  // Make sure thread support has been set up correctly
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_history_cache.size() );
+
+  ThreadHistoryCache& thread_history_cache =
+    d_history_cache[Utility::OpenMPProperties::getThreadId()];
+
+  if( !thread_history_cache.loaded || thread_history_cache.history != history )
+  {
+    thread_history_cache.particles.clear();
+
+    const uint64_t number_of_source_histories =
+      d_surface_source_file->getNumberOfSourceHistories();
+
+    if( number_of_source_histories > 0 )
+    {
+      // Only the source histories with surface crossings are stored - the
+      // source history ordinals that are not in the file are empty histories
+      const uint64_t source_history_ordinal =
+        history % number_of_source_histories;
+
+      if( d_surface_source_file->isHistoryOrdinalInFile( source_history_ordinal ) )
+      {
+        d_surface_source_file->readHistoryWithOrdinal(
+                                              source_history_ordinal,
+                                              thread_history_cache.particles );
+
+        thread_history_cache.particles.erase(
+               std::remove_if( thread_history_cache.particles.begin(),
+                               thread_history_cache.particles.end(),
+                               [this]( const SurfaceSourceParticleRecord& particle ){
+                                 return !this->isParticleReplayed( particle );
+                               } ),
+               thread_history_cache.particles.end() );
+      }
+    }
+
+    thread_history_cache.history = history;
+    thread_history_cache.loaded = true;
+  }
+
+  return thread_history_cache.particles;
+}
+
+// Check if a recorded particle should be replayed
+bool SurfaceSourceParticleSourceComponent::isParticleReplayed(
+                           const SurfaceSourceParticleRecord& particle ) const
+{
+  if( particle.energy < d_min_energy || particle.energy > d_max_energy )
+    return false;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    if( particle.position[i] < d_lower_bounds[i] ||
+        particle.position[i] > d_upper_bounds[i] )
+      return false;
+  }
+
+  if( !d_surfaces.empty() &&
+      d_surfaces.find( particle.surface_id ) == d_surfaces.end() )
+    return false;
+
+  if( !d_particle_types.empty() &&
+      d_particle_types.find( particle.particle_type ) ==
+      d_particle_types.end() )
+    return false;
+
+  return true;
+}
+
+// Initialize a particle state
+std::shared_ptr<ParticleState>
+SurfaceSourceParticleSourceComponent::initializeParticleState(
+                                    const unsigned long long history,
+                                    const unsigned long long history_state_id )
+{
+  // Make sure that the history state id is valid
+  testPrecondition( history_state_id <
+                    this->getNumberOfParticleStateSamples( history ) );
+
+  std::shared_ptr<ParticleState> particle;
+
+  ParticleStateFactory::createState(
+                            particle,
+                            this->loadHistory( history )[history_state_id].particle_type,
+                            history );
+
+  return particle;
+}
+
+// Sample a particle state from the source
+/*! \details The recorded particle state is copied to the particle. The
+ * particle state can only be sampled once.
+ */
+bool SurfaceSourceParticleSourceComponent::sampleParticleStateImpl(
+                                const std::shared_ptr<ParticleState>& particle,
+                                const unsigned long long history_state_id )
+{
+  const SurfaceSourceParticleRecord& recorded_particle =
+    this->loadHistory( particle->getHistoryNumber() )[history_state_id];
+
+  particle->setPosition( recorded_particle.position );
+  particle->setDirection( recorded_particle.direction );
+  particle->setEnergy( recorded_particle.energy );
+  particle->setTime( recorded_particle.time );
+  particle->setWeight( recorded_particle.weight*d_weight_multiplier );
+
+  return false;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::SurfaceSourceParticleSourceComponent );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::SurfaceSourceParticleSourceComponent );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceParticleSourceComponent.cpp
+//---------------------------------------------------------------------------//
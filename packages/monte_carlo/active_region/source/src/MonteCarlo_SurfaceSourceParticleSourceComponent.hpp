@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceParticleSourceComponent.hpp
+//! \author Alex Robinson
+//! \brief  The surface source particle source component class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_PARTICLE_SOURCE_COMPONENT_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_PARTICLE_SOURCE_COMPONENT_HPP
+
+// Std Lib Includes
+#include <array>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSourceComponent.hpp"
+#include "MonteCarlo_SurfaceSourceFileReader.hpp"
+#include "Utility_Array.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source particle source component class
+ * \details The particles of a surface source file (see
+ * MonteCarlo::SurfaceSourceRecorder) are replayed. History h replays
+ * the surface crossings of the source history with ordinal h mod N, where N
+ * is the number of source histories that were used to create the file (the
+ * ordinal of a source history is its position in the file, not its history
+ * number in the run that created the file). Source histories without any
+ * surface crossings produce empty histories, which preserves the
+ * normalization of the run that created the file. This also holds for the
+ * files of a single process of a distributed run and for the files of
+ * restarted runs, which only contain a subset of the history numbers of the
+ * run. Histories greater than N will reuse the recorded histories. The
+ * files of a distributed run can be replayed together with one component
+ * per file and selection weights that are proportional to the number of
+ * source histories in each file. Only the history index of the
+ * file is loaded - the particles of a history are read from the file when
+ * the history is sampled, so each process only reads the histories that it
+ * simulates. The replayed particles can be restricted to an energy range, a
+ * spatial box, a set of surfaces and a set of particle types, and their
+ * weights can be scaled.
+ */
+class SurfaceSourceParticleSourceComponent : public ParticleSourceComponent
+{
+
+public:
+
+  //! The id type
+  typedef ParticleSourceComponent::Id Id;
+
+  //! The trial counter type
+  typedef ParticleSourceComponent::Counter Counter;
+
+  //! The cell id set
+  typedef ParticleSourceComponent::CellIdSet CellIdSet;
+
+  //! The surface id set
+  typedef std::set<Geometry::Model::EntityId> SurfaceIdSet;
+
+  //! Constructor
+  SurfaceSourceParticleSourceComponent(
+                          const Id id,
+                          const double selection_weight,
+                          const std::shared_ptr<const Geometry::Model>& model,
+                          const boost::filesystem::path& surface_source_file );
+
+  //! Constructor (with rejection cells)
+  SurfaceSourceParticleSourceComponent(
+                          const Id id,
+                          const double selection_weight,
+                          const CellIdSet& rejection_cells,
+                          const std::shared_ptr<const Geometry::Model>& model,
+                          const boost::filesystem::path& surface_source_file );
+
+  //! Destructor
+  ~SurfaceSourceParticleSourceComponent()
+  { /* ... */ }
+
+  //! Return the surface source file name
+  const boost::filesystem::path& getSurfaceSourceFileName() const;
+
+  //! Return the number of source histories in the surface source file
+  uint64_t getNumberOfSourceHistories() const;
+
+  //! Only replay particles in the energy range [min_energy,max_energy]
+  void setEnergyRange( const double min_energy, const double max_energy );
+
+  //! Only replay particles inside of the box [lower_bounds,upper_bounds]
+  void setSpatialBounds( const std::array<double,3>& lower_bounds,
+                         const std::array<double,3>& upper_bounds );
+
+  //! Only replay particles that crossed one of the surfaces
+  void setSurfaces( const SurfaceIdSet& surfaces );
+
+  //! Only replay particles of the particle types
+  void setParticleTypes( const std::set<ParticleType>& particle_types );
+
+  //! Set the weight multiplier that will be applied to replayed particles
+  void setWeightMultiplier( const double weight_multiplier );
+
+  //! Return the weight multiplier
+  double getWeightMultiplier() const;
+
+  //! Return the number of sampling trials in the phase space dimension
+  Counter getNumberOfDimensionTrials(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Return the number of samples in the phase space dimension
+  Counter getNumberOfDimensionSamples(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Return the sampling efficiency in the phase space dimension
+  double getDimensionSamplingEfficiency(
+                    const PhaseSpaceDimension dimension ) const final override;
+
+  //! Check if the component emits particles isotropically
+  bool isDirectionallyUniform() const final override;
+
+  //! Print a summary of the sampling statistics
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Default Constructor
+  SurfaceSourceParticleSourceComponent();
+
+  //! Enable thread support
+  void enableThreadSupportImpl( const size_t threads ) final override;
+
+  //! Reset the sampling statistics
+  void resetDataImpl() final override;
+
+  //! Reduce the sampling statistics on the root process
+  void reduceDataImpl( const Utility::Communicator& comm,
+                       const int root_process ) final override;
+
+  /*! \brief Return the number of particle states that will be sampled for the
+   * given history number
+   */
+  unsigned long long getNumberOfParticleStateSamples(
+                       const unsigned long long history ) const final override;
+
+  //! Initialize a particle state
+  std::shared_ptr<ParticleState> initializeParticleState(
+                    const unsigned long long history,
+                    const unsigned long long history_state_id ) final override;
+
+  //! Sample a particle state from the source
+  bool sampleParticleStateImpl(
+                    const std::shared_ptr<ParticleState>& particle,
+                    const unsigned long long history_state_id ) final override;
+
+private:
+
+  // The history particle cache of a thread
+  struct ThreadHistoryCache
+  {
+    // The history number
+    unsigned long long history;
+
+    // Records if the cache has been loaded
+    bool loaded;
+
+    // The particles that will be replayed
+    std::vector<SurfaceSourceParticleRecord> particles;
+  };
+
+  // Open the surface source file
+  void openSurfaceSourceFile();
+
+  // Clear the history particle cache of every thread
+  void clearHistoryCache();
+
+  // Load the particles of a history into the cache of the calling thread
+  const std::vector<SurfaceSourceParticleRecord>& loadHistory(
+                                       const unsigned long long history ) const;
+
+  // Check if a recorded particle should be replayed
+  bool isParticleReplayed( const SurfaceSourceParticleRecord& particle ) const;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The surface source file name
+  boost::filesystem::path d_surface_source_file_name;
+
+  // The surface source file reader
+  std::shared_ptr<const SurfaceSourceFileReader> d_surface_source_file;
+
+  // The min energy
+  double d_min_energy;
+
+  // The max energy
+  double d_max_energy;
+
+  // The spatial lower bounds
+  std::array<double,3> d_lower_bounds;
+
+  // The spatial upper bounds
+  std::array<double,3> d_upper_bounds;
+
+  // The replayed surfaces (empty if all surfaces are replayed)
+  SurfaceIdSet d_surfaces;
+
+  // The replayed particle types (empty if all types are replayed)
+  std::set<ParticleType> d_particle_types;
+
+  // The weight multiplier
+  double d_weight_multiplier;
+
+  // The history particle cache of each thread
+  mutable std::vector<ThreadHistoryCache> d_history_cache;
+};
+
+// Save the data to an archive
+template<typename Archive>
+void SurfaceSourceParticleSourceComponent::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceComponent );
+
+  // Save the local data
+  std::string surface_source_file_name =
+    d_surface_source_file_name.string();
+
+  ar & BOOST_SERIALIZATION_NVP( surface_source_file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_min_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_max_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_lower_bounds );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_bounds );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+  ar & BOOST_SERIALIZATION_NVP( d_weight_multiplier );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void SurfaceSourceParticleSourceComponent::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceComponent );
+
+  // Load the local data
+  std::string surface_source_file_name;
+
+  ar & BOOST_SERIALIZATION_NVP( surface_source_file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_min_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_max_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_lower_bounds );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_bounds );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+  ar & BOOST_SERIALIZATION_NVP( d_weight_multiplier );
+
+  // The file must still exist at the archived location
+  d_surface_source_file_name = surface_source_file_name;
+
+  this->openSurfaceSourceFile();
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( SurfaceSourceParticleSourceComponent, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( SurfaceSourceParticleSourceComponent, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, SurfaceSourceParticleSourceComponent );
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_PARTICLE_SOURCE_COMPONENT_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceParticleSourceComponent.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,180 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSourceRejectionCellGrid.cpp
+//! \author Alex Robinson
+//! \brief  The source rejection cell grid unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_SourceRejectionCellGrid.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::SourceRejectionCellGrid> grid;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the union of the cell bounding boxes can be returned
+FRENSIE_UNIT_TEST( SourceRejectionCellGrid, getBoundingBox )
+{
+  const MonteCarlo::SourceRejectionCellGrid::BoundingBox& bounding_box =
+    grid->getBoundingBox();
+
+  FRENSIE_CHECK_EQUAL( bounding_box[0], -2.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[1], 8.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[2], -1.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[3], 1.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[4], -1.0 );
+  FRENSIE_CHECK_EQUAL( bounding_box[5], 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of voxels in each dimension can be returned
+FRENSIE_UNIT_TEST( SourceRejectionCellGrid, getNumberOfVoxels )
+{
+  FRENSIE_CHECK_EQUAL( grid->getNumberOfVoxels( 0 ), 10 );
+  FRENSIE_CHECK_EQUAL( grid->getNumberOfVoxels( 1 ), 10 );
+  FRENSIE_CHECK_EQUAL( grid->getNumberOfVoxels( 2 ), 10 );
+
+  // Dimensions with zero width are not divided
+  MonteCarlo::SourceRejectionCellGrid::CellIdBoundingBoxMap
+    cell_bounding_boxes;
+
+  cell_bounding_boxes[1] = {0.0, 1.0, 0.0, 1.0, 2.0, 2.0};
+
+  MonteCarlo::SourceRejectionCellGrid flat_grid( cell_bounding_boxes, 4 );
+
+  FRENSIE_CHECK_EQUAL( flat_grid.getNumberOfVoxels( 0 ), 4 );
+  FRENSIE_CHECK_EQUAL( flat_grid.getNumberOfVoxels( 1 ), 4 );
+  FRENSIE_CHECK_EQUAL( flat_grid.getNumberOfVoxels( 2 ), 1 );
+  FRENSIE_CHECK_EQUAL( flat_grid.getCandidateCells( std::vector<double>( {0.5, 0.5, 2.0} ).data() ).size(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the candidate cells of a position can be returned
+FRENSIE_UNIT_TEST( SourceRejectionCellGrid, getCandidateCells )
+{
+  // Outside of the grid
+  double position[3] = {-3.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( grid->getCandidateCells( position ).size(), 0 );
+
+  position[0] = 0.0;
+  position[1] = 1.5;
+
+  FRENSIE_CHECK_EQUAL( grid->getCandidateCells( position ).size(), 0 );
+
+  // Only inside of cell 1's box
+  position[1] = 0.0;
+
+  Utility::ArrayView<const Geometry::Model::EntityId> candidate_cells =
+    grid->getCandidateCells( position );
+
+  FRENSIE_REQUIRE_EQUAL( candidate_cells.size(), 1 );
+  FRENSIE_CHECK_EQUAL( candidate_cells[0], 1 );
+
+  // Inside of the gap between the boxes
+  position[0] = 4.5;
+
+  FRENSIE_CHECK_EQUAL( grid->getCandidateCells( position ).size(), 0 );
+
+  // Only inside of cell 2's box
+  position[0] = 7.0;
+
+  candidate_cells = grid->getCandidateCells( position );
+
+  FRENSIE_REQUIRE_EQUAL( candidate_cells.size(), 1 );
+  FRENSIE_CHECK_EQUAL( candidate_cells[0], 2 );
+
+  // On the box boundaries
+  position[0] = 2.0;
+
+  candidate_cells = grid->getCandidateCells( position );
+
+  FRENSIE_REQUIRE_EQUAL( candidate_cells.size(), 1 );
+  FRENSIE_CHECK_EQUAL( candidate_cells[0], 1 );
+
+  position[0] = 8.0;
+  position[1] = 1.0;
+  position[2] = -1.0;
+
+  candidate_cells = grid->getCandidateCells( position );
+
+  FRENSIE_REQUIRE_EQUAL( candidate_cells.size(), 1 );
+  FRENSIE_CHECK_EQUAL( candidate_cells[0], 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every position inside of a cell box lists the cell
+FRENSIE_UNIT_TEST( SourceRejectionCellGrid, getCandidateCells_overlapping )
+{
+  MonteCarlo::SourceRejectionCellGrid::CellIdBoundingBoxMap
+    cell_bounding_boxes;
+
+  cell_bounding_boxes[1] = {0.0, 0.3, 0.0, 0.3, 0.0, 0.3};
+  cell_bounding_boxes[2] = {0.1, 1.0, 0.1, 1.0, 0.1, 1.0};
+
+  MonteCarlo::SourceRejectionCellGrid overlapping_grid( cell_bounding_boxes, 7 );
+
+  for( size_t i = 0; i <= 100; ++i )
+  {
+    const double x = i/100.0;
+    const double position[3] = {x, x, x};
+
+    Utility::ArrayView<const Geometry::Model::EntityId> candidate_cells =
+      overlapping_grid.getCandidateCells( position );
+
+    bool cell_1_found = false, cell_2_found = false;
+
+    for( auto candidate_cell : candidate_cells )
+    {
+      if( candidate_cell == 1 )
+        cell_1_found = true;
+      else if( candidate_cell == 2 )
+        cell_2_found = true;
+    }
+
+    if( x <= 0.3 )
+    {
+      FRENSIE_CHECK( cell_1_found );
+    }
+
+    if( x >= 0.1 )
+    {
+      FRENSIE_CHECK( cell_2_found );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Cell 1 is inside of [-2,2]x[-1,1]x[-1,1] and cell 2 is inside of
+  // [6,8]x[-1,1]x[-1,1]
+  MonteCarlo::SourceRejectionCellGrid::CellIdBoundingBoxMap
+    cell_bounding_boxes;
+
+  cell_bounding_boxes[1] = {-2.0, 2.0, -1.0, 1.0, -1.0, 1.0};
+  cell_bounding_boxes[2] = {6.0, 8.0, -1.0, 1.0, -1.0, 1.0};
+
+  grid.reset( new MonteCarlo::SourceRejectionCellGrid( cell_bounding_boxes, 10 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSourceRejectionCellGrid.cpp
+//---------------------------------------------------------------------------//
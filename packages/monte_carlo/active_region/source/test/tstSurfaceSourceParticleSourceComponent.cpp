@@ -0,0 +1,391 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSurfaceSourceParticleSourceComponent.cpp
+//! \author Alex Robinson
+//! \brief  Surface source particle source component unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceParticleSourceComponent.hpp"
+#include "MonteCarlo_SurfaceSourceFileWriter.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Geometry::Model> model;
+
+const std::string surface_source_file_name( "test_surface_source_component.ssrc" );
+
+const std::string offset_surface_source_file_name( "test_surface_source_component_offset.ssrc" );
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a surface source particle record
+MonteCarlo::SurfaceSourceParticleRecord createRecord(
+                                   const MonteCarlo::ParticleType particle_type,
+                                   const Geometry::Model::EntityId surface_id,
+                                   const double x_position,
+                                   const double energy,
+                                   const double weight )
+{
+  MonteCarlo::SurfaceSourceParticleRecord record;
+
+  record.particle_type = particle_type;
+  record.surface_id = surface_id;
+  record.position[0] = x_position;
+  record.position[1] = 0.0;
+  record.position[2] = 0.0;
+  record.direction[0] = 1.0;
+  record.direction[1] = 0.0;
+  record.direction[2] = 0.0;
+  record.energy = energy;
+  record.time = 1e-9;
+  record.weight = weight;
+
+  return record;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the source component can be constructed
+FRENSIE_UNIT_TEST( SurfaceSourceParticleSourceComponent, constructor )
+{
+  MonteCarlo::SurfaceSourceParticleSourceComponent
+    source_component( 0, 1.0, model, surface_source_file_name );
+
+  FRENSIE_CHECK_EQUAL( source_component.getId(), 0 );
+  FRENSIE_CHECK_EQUAL( source_component.getSelectionWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( source_component.getSurfaceSourceFileName().string(),
+                       surface_source_file_name );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfSourceHistories(), 4 );
+  FRENSIE_CHECK_EQUAL( source_component.getWeightMultiplier(), 1.0 );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfTrials(), 0 );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfSamples(), 0 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SurfaceSourceParticleSourceComponent( 1, 1.0, model, "dummy.ssrc" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the recorded particles can be replayed
+FRENSIE_UNIT_TEST( SurfaceSourceParticleSourceComponent, sampleParticleState )
+{
+  MonteCarlo::SurfaceSourceParticleSourceComponent
+    source_component( 0, 1.0, model, surface_source_file_name );
+
+  MonteCarlo::ParticleBank bank;
+
+  source_component.sampleParticleState( bank, 0 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getXPosition(), 0.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getXDirection(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getTime(), 1e-9 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 0.5 );
+  FRENSIE_CHECK_EQUAL( bank.top().getSourceId(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getCell(), 1 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getXPosition(), 10.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 5.0 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 1.0 );
+
+  bank.pop();
+
+  // Source histories 1 and 2 did not have any crossings
+  source_component.sampleParticleState( bank, 1 );
+  source_component.sampleParticleState( bank, 2 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  // Source history 3
+  source_component.sampleParticleState( bank, 3 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 3 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 0.5 );
+
+  bank.pop();
+
+  // The source histories are reused
+  source_component.sampleParticleState( bank, 4 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 4 );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 1.0 );
+
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfTrials(), 5 );
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfSamples(), 5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that replaying fewer histories than the number of source histories
+// only replays the crossings of the corresponding source histories
+FRENSIE_UNIT_TEST( SurfaceSourceParticleSourceComponent,
+                   sampleParticleState_fewer_histories )
+{
+  MonteCarlo::SurfaceSourceParticleSourceComponent
+    source_component( 0, 1.0, model, surface_source_file_name );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Replay 3 of the 4 source histories
+  for( unsigned long long history = 0; history < 3; ++history )
+    source_component.sampleParticleState( bank, history );
+
+  // Only the crossings of source history 0 are replayed - the crossing of
+  // source history 3 must not be replayed
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 2 );
+
+  while( !bank.isEmpty() )
+  {
+    FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+    FRENSIE_CHECK( bank.top().getParticleType() != MonteCarlo::ELECTRON );
+
+    bank.pop();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a file that only contains a subset of the history numbers of a
+// run (e.g. one process of a distributed run) replays every stored history
+FRENSIE_UNIT_TEST( SurfaceSourceParticleSourceComponent,
+                   sampleParticleState_history_subset_file )
+{
+  MonteCarlo::SurfaceSourceParticleSourceComponent
+    source_component( 0, 1.0, model, offset_surface_source_file_name );
+
+  FRENSIE_CHECK_EQUAL( source_component.getNumberOfSourceHistories(), 4 );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Source history 100 (ordinal 0)
+  source_component.sampleParticleState( bank, 0 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+
+  bank.pop();
+
+  // Source histories 101 and 102 did not have any crossings
+  source_component.sampleParticleState( bank, 1 );
+  source_component.sampleParticleState( bank, 2 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  // Source history 103 (ordinal 3)
+  source_component.sampleParticleState( bank, 3 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 3 );
+
+  bank.pop();
+
+  // The source histories are reused
+  source_component.sampleParticleState( bank, 7 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a subset of the recorded particles can be replayed
+FRENSIE_UNIT_TEST( SurfaceSourceParticleSourceComponent,
+                   sampleParticleState_subset )
+{
+  MonteCarlo::SurfaceSourceParticleSourceComponent
+    source_component( 0, 1.0, model, surface_source_file_name );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Energy range
+  source_component.setEnergyRange( 2.0, 10.0 );
+
+  source_component.sampleParticleState( bank, 0 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  // Spatial bounds
+  source_component.setEnergyRange( 0.0, 10.0 );
+  source_component.setSpatialBounds( {-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0} );
+
+  source_component.sampleParticleState( bank, 4 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+
+  bank.pop();
+
+  // Surfaces and particle types
+  source_component.setSpatialBounds( {-20.0, -20.0, -20.0}, {20.0, 20.0, 20.0} );
+  source_component.setSurfaces( {2} );
+
+  source_component.sampleParticleState( bank, 8 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  source_component.setSurfaces( {} );
+  source_component.setParticleTypes( {MonteCarlo::ELECTRON} );
+
+  source_component.sampleParticleState( bank, 12 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  source_component.sampleParticleState( bank, 13 );
+  source_component.sampleParticleState( bank, 14 );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  source_component.sampleParticleState( bank, 15 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+
+  bank.pop();
+
+  // Weight multiplier
+  source_component.setParticleTypes( {} );
+  source_component.setWeightMultiplier( 2.0 );
+
+  source_component.sampleParticleState( bank, 16 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 1.0 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 2.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the source component can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceSourceParticleSourceComponent,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_surface_source_component" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceParticleSourceComponent>
+      concrete_source_component( new MonteCarlo::SurfaceSourceParticleSourceComponent( 0, 1.0, model, surface_source_file_name ) );
+
+    concrete_source_component->setWeightMultiplier( 3.0 );
+    concrete_source_component->setParticleTypes( {MonteCarlo::PHOTON} );
+
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component = concrete_source_component;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( source_component ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived source component
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent> source_component;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( source_component ) );
+
+  iarchive.reset();
+
+  const MonteCarlo::SurfaceSourceParticleSourceComponent& concrete_source_component =
+    dynamic_cast<const MonteCarlo::SurfaceSourceParticleSourceComponent&>( *source_component );
+
+  FRENSIE_CHECK_EQUAL( concrete_source_component.getNumberOfSourceHistories(), 4 );
+  FRENSIE_CHECK_EQUAL( concrete_source_component.getWeightMultiplier(), 3.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  source_component->sampleParticleState( bank, 0 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( bank.top().getWeight(), 1.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create the model
+  model.reset( new Geometry::InfiniteMediumModel( 1 ) );
+
+  // Create the surface source file - only source histories 0 and 3 (of 4)
+  // have surface crossings
+  MonteCarlo::SurfaceSourceFileWriter writer( surface_source_file_name );
+
+  writer.addHistory( 0, {createRecord( MonteCarlo::PHOTON, 1, 0.0, 1.0, 0.5 ),
+                         createRecord( MonteCarlo::NEUTRON, 2, 10.0, 5.0, 1.0 )} );
+  writer.addHistory( 1, {} );
+  writer.addHistory( 2, {} );
+  writer.addHistory( 3, {createRecord( MonteCarlo::ELECTRON, 1, 0.0, 0.5, 1.0 )} );
+
+  writer.close();
+
+  // Create a surface source file that only received the history numbers
+  // 100-103 - only source histories 100 and 103 have surface crossings
+  MonteCarlo::SurfaceSourceFileWriter
+    offset_writer( offset_surface_source_file_name );
+
+  offset_writer.addHistory( 102, {} );
+  offset_writer.addHistory( 103, {createRecord( MonteCarlo::ELECTRON, 1, 0.0, 0.5, 1.0 )} );
+  offset_writer.addHistory( 100, {createRecord( MonteCarlo::PHOTON, 1, 0.0, 1.0, 0.5 )} );
+  offset_writer.addHistory( 101, {} );
+
+  offset_writer.close();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSurfaceSourceParticleSourceComponent.cpp
+//---------------------------------------------------------------------------//
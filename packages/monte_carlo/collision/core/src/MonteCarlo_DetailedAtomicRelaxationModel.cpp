@@ -8,6 +8,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_DetailedAtomicRelaxationModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -26,6 +27,7 @@ DetailedAtomicRelaxationModel::DetailedAtomicRelaxationModel(
             const double min_photon_energy,
             const double min_electron_energy)
   : d_subshell_relaxation_models(),
+    d_emitting_subshell_cascades(),
     d_min_photon_energy( min_photon_energy ),
     d_min_electron_energy( min_electron_energy )
 {
@@ -41,43 +43,167 @@ DetailedAtomicRelaxationModel::DetailedAtomicRelaxationModel(
     const std::shared_ptr<const SubshellRelaxationModel>& model =
       subshell_relaxation_models[i];
 
+    const size_t subshell_index = model->getVacancySubshell();
+
+    if( subshell_index >= d_subshell_relaxation_models.size() )
+      d_subshell_relaxation_models.resize( subshell_index+1 );
+
     // Neglect duplicate models
-    if( d_subshell_relaxation_models.find( model->getVacancySubshell() ) ==
-	d_subshell_relaxation_models.end() )
-      d_subshell_relaxation_models[model->getVacancySubshell()] = model;
+    if( !d_subshell_relaxation_models[subshell_index] )
+      d_subshell_relaxation_models[subshell_index] = model;
+  }
+
+  this->determineEmittingSubshellCascades();
+}
+
+// Determine which subshell cascades can emit particles
+void DetailedAtomicRelaxationModel::determineEmittingSubshellCascades()
+{
+  d_emitting_subshell_cascades.assign( d_subshell_relaxation_models.size(),
+                                       false );
+
+  std::vector<SubshellCascadeState> cascade_states(
+                                           d_subshell_relaxation_models.size(),
+                                           UNVISITED_SUBSHELL_CASCADE );
+
+  for( size_t i = 0; i < d_subshell_relaxation_models.size(); ++i )
+  {
+    if( d_subshell_relaxation_models[i] )
+    {
+      this->determineIfSubshellCascadeEmitsParticles(
+                         d_subshell_relaxation_models[i]->getVacancySubshell(),
+                         cascade_states );
+    }
   }
 }
 
+// Determine if a subshell cascade can emit particles
+/*! \details A subshell cascade can emit particles if a transition of the
+ * subshell can emit a particle above the min energies or if the cascade of
+ * one of the vacancy shells created by the transitions can emit particles.
+ * Vacancies always move to less tightly bound subshells, which means that
+ * the subshell cascade graph can't contain cycles. The results are
+ * memoized so that each subshell is only visited once.
+ */
+bool DetailedAtomicRelaxationModel::determineIfSubshellCascadeEmitsParticles(
+                           const Data::SubshellType vacancy_shell,
+                           std::vector<SubshellCascadeState>& cascade_states )
+{
+  // Subshells without relaxation data can't emit particles
+  if( vacancy_shell <= Data::UNKNOWN_SUBSHELL ||
+      static_cast<size_t>( vacancy_shell ) >=
+      d_subshell_relaxation_models.size() ||
+      !d_subshell_relaxation_models[vacancy_shell] )
+    return false;
+
+  TEST_FOR_EXCEPTION( cascade_states[vacancy_shell] ==
+                      VISITING_SUBSHELL_CASCADE,
+                      std::runtime_error,
+                      "The relaxation cascade of the " << vacancy_shell <<
+                      " subshell leads back to the " << vacancy_shell <<
+                      " subshell!" );
+
+  if( cascade_states[vacancy_shell] == VISITED_SUBSHELL_CASCADE )
+    return d_emitting_subshell_cascades[vacancy_shell];
+
+  cascade_states[vacancy_shell] = VISITING_SUBSHELL_CASCADE;
+
+  const SubshellRelaxationModel& model =
+    *d_subshell_relaxation_models[vacancy_shell];
+
+  bool emits_particles =
+    model.canEmitParticle( d_min_photon_energy, d_min_electron_energy );
+
+  // All of the transition vacancy shells must be visited so that cycles
+  // are always detected
+  std::set<Data::SubshellType> transition_vacancy_shells;
+
+  model.getTransitionVacancyShells( transition_vacancy_shells );
+
+  for( auto transition_vacancy_shell : transition_vacancy_shells )
+  {
+    if( this->determineIfSubshellCascadeEmitsParticles(
+                                                    transition_vacancy_shell,
+                                                    cascade_states ) )
+      emits_particles = true;
+  }
+
+  cascade_states[vacancy_shell] = VISITED_SUBSHELL_CASCADE;
+  d_emitting_subshell_cascades[vacancy_shell] = emits_particles;
+
+  return emits_particles;
+}
+
 // Relax the atom
+/*! \details The vacancies are relaxed in the same order as a recursive
+ * relaxation (the primary vacancy cascade is relaxed before the secondary
+ * vacancy cascade). Vacancy cascades that can't emit particles are not
+ * sampled, which means that the random number stream will differ from a
+ * recursive relaxation whenever one of these cascades occurs. Since the
+ * vacancy cascade graph can't contain cycles, the stack will only store one
+ * pending secondary vacancy for each subshell on the current cascade path,
+ * which means that it can never hold more vacancies than there are
+ * subshells. An exception will be thrown if the stack overflows. The
+ * relaxation particles are banked together once the atom has relaxed.
+ */
 void
 DetailedAtomicRelaxationModel::relaxAtom(
                                         const Data::SubshellType vacancy_shell,
                                         const ParticleState& particle,
                                         ParticleBank& bank ) const
 {
-  // Check if the vacancy shell has relaxation data
-  if( d_subshell_relaxation_models.find( vacancy_shell ) !=
-      d_subshell_relaxation_models.end() )
+  // Check if the vacancy shell cascade can emit particles (the energy
+  // of cascades that can't emit particles is deposited locally)
+  if( !this->canSubshellCascadeEmitParticles( vacancy_shell ) )
+    return;
+
+  VacancyStack vacancy_stack;
+  size_t vacancy_stack_size = 0;
+
+  vacancy_stack[vacancy_stack_size++] = vacancy_shell;
+
+  ParticleBank relaxation_particle_bank;
+
+  while( vacancy_stack_size > 0 )
   {
-    // Recursively relax subshells
+    const Data::SubshellType current_vacancy_shell =
+      vacancy_stack[--vacancy_stack_size];
+
     Data::SubshellType primary_vacancy_shell, secondary_vacancy_shell;
 
-    const std::shared_ptr<const SubshellRelaxationModel>& model =
-      d_subshell_relaxation_models.find( vacancy_shell )->second;
+    d_subshell_relaxation_models[current_vacancy_shell]->relaxSubshell(
+                                                     particle,
+                                                     d_min_photon_energy,
+                                                     d_min_electron_energy,
+                                                     relaxation_particle_bank,
+                                                     primary_vacancy_shell,
+                                                     secondary_vacancy_shell );
 
-    model->relaxSubshell( particle,
-                          d_min_photon_energy,
-                          d_min_electron_energy,
-			  bank,
-			  primary_vacancy_shell,
-			  secondary_vacancy_shell );
+    // The secondary vacancy must be pushed first so that the primary
+    // vacancy cascade is relaxed first
+    if( this->canSubshellCascadeEmitParticles( secondary_vacancy_shell ) )
+    {
+      TEST_FOR_EXCEPTION( vacancy_stack_size >= s_max_vacancy_stack_size,
+                          std::runtime_error,
+                          "The vacancy stack overflowed while relaxing the "
+                          << vacancy_shell << " subshell!" );
 
-    // Relax the new vacancy
-    this->relaxAtom( primary_vacancy_shell, particle, bank );
+      vacancy_stack[vacancy_stack_size++] = secondary_vacancy_shell;
+    }
 
-    // Relax the secondary vacancy
-    this->relaxAtom( secondary_vacancy_shell, particle, bank );
+    if( this->canSubshellCascadeEmitParticles( primary_vacancy_shell ) )
+    {
+      TEST_FOR_EXCEPTION( vacancy_stack_size >= s_max_vacancy_stack_size,
+                          std::runtime_error,
+                          "The vacancy stack overflowed while relaxing the "
+                          << vacancy_shell << " subshell!" );
+
+      vacancy_stack[vacancy_stack_size++] = primary_vacancy_shell;
+    }
   }
+
+  // Bank all of the relaxation particles
+  bank.splice( relaxation_particle_bank );
 }
 
 } // end MonteCarlo namespace
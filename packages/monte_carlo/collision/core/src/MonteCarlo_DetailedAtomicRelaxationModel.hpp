@@ -11,7 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
-#include <unordered_map>
+#include <array>
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
@@ -23,7 +23,12 @@ namespace MonteCarlo{
 /*! The detailed atomic relaxation model
  * \details This model accounts for all possible transitions to fill an
  * initial vacancy. It will also follow subsequent vacancies until the atom
- * has relaxed back to its ground state.
+ * has relaxed back to its ground state. The vacancies are relaxed with an
+ * explicit stack instead of recursively and the relaxation particles are
+ * banked together once the atom has relaxed. Vacancy cascades that cannot
+ * emit a photon above the min photon energy or an electron above the min
+ * electron energy are not followed - the energy of these cascades is
+ * deposited locally.
  */
 class DetailedAtomicRelaxationModel : public AtomicRelaxationModel
 {
@@ -49,12 +54,41 @@ public:
 		  const ParticleState& particle,
 		  ParticleBank& bank ) const;
 
+  //! Check if the vacancy cascade of a subshell can emit particles
+  bool canSubshellCascadeEmitParticles(
+                                const Data::SubshellType vacancy_shell ) const;
+
 private:
 
-  // The map of subshells and their relaxation data
-  std::unordered_map<Data::SubshellType,std::shared_ptr<const SubshellRelaxationModel> >
+  // The max number of subshell vacancies that can be waiting for relaxation
+  static const size_t s_max_vacancy_stack_size = Data::Q3_SUBSHELL+1;
+
+  // The vacancy stack type
+  typedef std::array<Data::SubshellType,s_max_vacancy_stack_size>
+  VacancyStack;
+
+  // The subshell cascade search states
+  enum SubshellCascadeState{
+    UNVISITED_SUBSHELL_CASCADE = 0,
+    VISITING_SUBSHELL_CASCADE,
+    VISITED_SUBSHELL_CASCADE
+  };
+
+  // Determine which subshell cascades can emit particles
+  void determineEmittingSubshellCascades();
+
+  // Determine if a subshell cascade can emit particles
+  bool determineIfSubshellCascadeEmitsParticles(
+                                        const Data::SubshellType vacancy_shell,
+                                        std::vector<SubshellCascadeState>& cascade_states );
+
+  // The subshell relaxation models (indexed by subshell)
+  std::vector<std::shared_ptr<const SubshellRelaxationModel> >
   d_subshell_relaxation_models;
 
+  // The subshell cascade emission flags (indexed by subshell)
+  std::vector<bool> d_emitting_subshell_cascades;
+
   // The min photon energy
   double d_min_photon_energy;
 
@@ -62,6 +96,18 @@ private:
   double d_min_electron_energy;
 };
 
+// Check if the vacancy cascade of a subshell can emit particles
+inline bool DetailedAtomicRelaxationModel::canSubshellCascadeEmitParticles(
+                                 const Data::SubshellType vacancy_shell ) const
+{
+  if( vacancy_shell > Data::UNKNOWN_SUBSHELL &&
+      static_cast<size_t>( vacancy_shell ) <
+      d_emitting_subshell_cascades.size() )
+    return d_emitting_subshell_cascades[vacancy_shell];
+  else
+    return false;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_DETAILED_ATOMIC_RELAXATION_MODEL_HPP
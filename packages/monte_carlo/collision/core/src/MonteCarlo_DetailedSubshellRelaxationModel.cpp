@@ -12,10 +12,11 @@
 #include "MonteCarlo_SimulationPhotonProperties.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
-#include "Utility_DiscreteDistribution.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -29,7 +30,7 @@ DetailedSubshellRelaxationModel::DetailedSubshellRelaxationModel(
        const std::vector<double>& transition_pdf_or_cdf,
        const bool interpret_as_cdf )
   : SubshellRelaxationModel( vacancy_subshell ),
-    d_transition_distribution(),
+    d_transition_cdf( transition_pdf_or_cdf ),
     d_outgoing_particle_energies( outgoing_particle_energies ),
     d_transition_vacancy_shells( primary_transition_vacancy_shells.size() )
 {
@@ -45,13 +46,25 @@ DetailedSubshellRelaxationModel::DetailedSubshellRelaxationModel(
   testPrecondition( transition_pdf_or_cdf.size() ==
 		    primary_transition_vacancy_shells.size() );
 
-  // Create the transition distribution
-  std::vector<double> dummy_indep_values( transition_pdf_or_cdf.size() );
+  // Create the normalized transition cdf
+  if( !interpret_as_cdf )
+  {
+    for( size_t i = 1; i < d_transition_cdf.size(); ++i )
+      d_transition_cdf[i] += d_transition_cdf[i-1];
+  }
 
-  d_transition_distribution.reset( new Utility::DiscreteDistribution(
-						         dummy_indep_values,
-						         transition_pdf_or_cdf,
-							 interpret_as_cdf ) );
+  TEST_FOR_EXCEPTION( d_transition_cdf.back() <= 0.0,
+                      std::runtime_error,
+                      "The transition probabilities of the "
+                      << vacancy_subshell << " subshell are not valid!" );
+
+  if( d_transition_cdf.back() != 1.0 )
+  {
+    const double norm_constant = d_transition_cdf.back();
+
+    for( size_t i = 0; i < d_transition_cdf.size(); ++i )
+      d_transition_cdf[i] /= norm_constant;
+  }
 
   // Store the transition vacancy shells
   for( unsigned i = 0; i < primary_transition_vacancy_shells.size(); ++i )
@@ -85,9 +98,7 @@ void DetailedSubshellRelaxationModel::relaxSubshell(
 		        Data::SubshellType& new_secondary_vacancy_shell ) const
 {
   // Sample the transition that occurs
-  size_t transition_index;
-
-  d_transition_distribution->sampleAndRecordBinIndex( transition_index );
+  const size_t transition_index = this->sampleTransition();
 
   double new_particle_energy = d_outgoing_particle_energies[transition_index];
 
@@ -112,6 +123,67 @@ void DetailedSubshellRelaxationModel::relaxSubshell(
   }
 }
 
+// Check if a transition can emit a particle above the min energies
+bool DetailedSubshellRelaxationModel::canEmitParticle(
+                                       const double min_photon_energy,
+                                       const double min_electron_energy ) const
+{
+  for( size_t i = 0; i < d_transition_vacancy_shells.size(); ++i )
+  {
+    const Data::SubshellType secondary_vacancy_shell =
+      Utility::get<1>( d_transition_vacancy_shells[i] );
+
+    if( secondary_vacancy_shell == Data::INVALID_SUBSHELL ||
+        secondary_vacancy_shell == Data::UNKNOWN_SUBSHELL )
+    {
+      if( d_outgoing_particle_energies[i] >= min_photon_energy )
+        return true;
+    }
+    else
+    {
+      if( d_outgoing_particle_energies[i] >= min_electron_energy )
+        return true;
+    }
+  }
+
+  return false;
+}
+
+// Return the vacancy shells that can be created by the transitions
+/*! \details The invalid and unknown subshells will not be added to the set.
+ */
+void DetailedSubshellRelaxationModel::getTransitionVacancyShells(
+                         std::set<Data::SubshellType>& vacancy_shells ) const
+{
+  for( size_t i = 0; i < d_transition_vacancy_shells.size(); ++i )
+  {
+    const Data::SubshellType primary_vacancy_shell =
+      Utility::get<0>( d_transition_vacancy_shells[i] );
+
+    const Data::SubshellType secondary_vacancy_shell =
+      Utility::get<1>( d_transition_vacancy_shells[i] );
+
+    if( primary_vacancy_shell != Data::INVALID_SUBSHELL &&
+        primary_vacancy_shell != Data::UNKNOWN_SUBSHELL )
+      vacancy_shells.insert( primary_vacancy_shell );
+
+    if( secondary_vacancy_shell != Data::INVALID_SUBSHELL &&
+        secondary_vacancy_shell != Data::UNKNOWN_SUBSHELL )
+      vacancy_shells.insert( secondary_vacancy_shell );
+  }
+}
+
+// Sample a transition
+size_t DetailedSubshellRelaxationModel::sampleTransition() const
+{
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  return Utility::Search::binaryUpperBoundIndex( d_transition_cdf.begin(),
+                                                 d_transition_cdf.end(),
+                                                 random_number );
+}
+
 // Generate a fluorescence photon
 void DetailedSubshellRelaxationModel::generateFluorescencePhoton(
 						const ParticleState& particle,
@@ -121,8 +193,8 @@ void DetailedSubshellRelaxationModel::generateFluorescencePhoton(
   // Make sure the new energy is valid
   testPrecondition( new_photon_energy > 0.0 );
 
-  std::shared_ptr<ParticleState> fluorescence_photon(
-				     new PhotonState( particle, true, true ) );
+  std::shared_ptr<PhotonState> fluorescence_photon =
+    std::make_shared<PhotonState>( particle, true, true );
 
   // Set the new energy
   fluorescence_photon->setEnergy( new_photon_energy );
@@ -148,8 +220,8 @@ void DetailedSubshellRelaxationModel::generateAugerElectron(
   // table
   testPrecondition( new_electron_energy >= 0.0 );
 
-  std::shared_ptr<ParticleState> auger_electron(
-				   new ElectronState( particle, true, true ) );
+  std::shared_ptr<ElectronState> auger_electron =
+    std::make_shared<ElectronState>( particle, true, true );
 
   // Set the new energy
   auger_electron->setEnergy( new_electron_energy );
@@ -11,10 +11,10 @@
 
 // Std Lib Includes
 #include <memory>
+#include <set>
 
 // FRENSIE Includes
 #include "MonteCarlo_SubshellRelaxationModel.hpp"
-#include "Utility_DiscreteDistribution.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_Vector.hpp"
 
@@ -22,7 +22,9 @@ namespace MonteCarlo{
 
 /*! Detailed subshell relaxation model class
  * \details This model accounts for all possible transitions to fill a
- * vacancy in the initial shell.
+ * vacancy in the initial shell. The normalized cumulative transition table
+ * is calculated once during construction so that sampling a transition only
+ * requires a single random number and a binary search.
  */
 class DetailedSubshellRelaxationModel : public SubshellRelaxationModel
 {
@@ -48,10 +50,21 @@ public:
                       const double min_electron_energy,
 		      ParticleBank& bank,
 		      Data::SubshellType& new_primary_vacancy_shell,
-		      Data::SubshellType& new_secondary_vacancy_shell ) const;
+		      Data::SubshellType& new_secondary_vacancy_shell ) const override;
+
+  //! Check if a transition can emit a particle above the min energies
+  bool canEmitParticle( const double min_photon_energy,
+                        const double min_electron_energy ) const override;
+
+  //! Return the vacancy shells that can be created by the transitions
+  void getTransitionVacancyShells(
+                 std::set<Data::SubshellType>& vacancy_shells ) const override;
 
 private:
 
+  // Sample a transition
+  size_t sampleTransition() const;
+
   // Generate a fluorescence photon
   void generateFluorescencePhoton( const ParticleState& particle,
                                    const double new_photon_energy,
@@ -66,10 +79,10 @@ private:
   void sampleEmissionDirection( double& angle_cosine,
 				double& azimuthal_angle ) const;
 
-  // The transition distribution (also stores the outgoing particle energies )
-  std::unique_ptr<Utility::DiscreteDistribution> d_transition_distribution;
+  // The normalized transition cdf
+  std::vector<double> d_transition_cdf;
 
-  // The outgoing partial energies
+  // The outgoing particle energies
   std::vector<double> d_outgoing_particle_energies;
 
   // The transition vacancy shells (first = primary, second = secondary)
@@ -141,6 +141,9 @@ protected:
   //! Return the scattering center at the desired index
   const ScatteringCenter& getScatteringCenter( const size_t index ) const;
 
+  //! Return the scattering center number density at the desired index
+  double getScatteringCenterNumberDensity( const size_t index ) const;
+
 private:
 
   // Get the atomic weight from an atom pointer
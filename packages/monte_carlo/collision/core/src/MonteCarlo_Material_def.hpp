@@ -356,6 +356,15 @@ const ScatteringCenter& Material<ScatteringCenter>::getScatteringCenter( const s
   return *Utility::get<1>( d_scattering_centers[index] );
 }
 
+// Return the scattering center number density at the desired index
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const size_t index ) const
+{
+  testPrecondition( index < d_scattering_centers.size() );
+
+  return Utility::get<0>( d_scattering_centers[index] );
+}
+
 // Get the atomic weight from an atom pointer
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getAtomicWeightFromPair(
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_SUBSHELL_RELAXATION_MODEL_HPP
 #define MONTE_CARLO_SUBSHELL_RELAXATION_MODEL_HPP
 
+// Std Lib Includes
+#include <set>
+
 // FRENSIE Includes
 #include "Data_SubshellType.hpp"
 #include "MonteCarlo_ParticleState.hpp"
@@ -25,7 +28,7 @@ public:
   SubshellRelaxationModel( const Data::SubshellType vacancy_subshell );
 
   //! Destructor
-  ~SubshellRelaxationModel()
+  virtual ~SubshellRelaxationModel()
   { /* ... */ }
 
   //! Relax the shell
@@ -37,6 +40,14 @@ public:
                    Data::SubshellType& new_primary_vacancy_shell,
 		   Data::SubshellType& new_secondary_vacancy_shell ) const = 0;
 
+  //! Check if a transition can emit a particle above the min energies
+  virtual bool canEmitParticle( const double min_photon_energy,
+                                const double min_electron_energy ) const = 0;
+
+  //! Return the vacancy shells that can be created by the transitions
+  virtual void getTransitionVacancyShells(
+                  std::set<Data::SubshellType>& vacancy_shells ) const = 0;
+
   //! Return the subshell that contains the vacancy
   Data::SubshellType getVacancySubshell() const;
 
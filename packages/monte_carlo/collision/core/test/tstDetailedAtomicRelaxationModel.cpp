@@ -23,9 +23,15 @@
 // Testing Variables.
 //---------------------------------------------------------------------------//
 
-std::unique_ptr<const MonteCarlo::AtomicRelaxationModel>
+std::unique_ptr<const MonteCarlo::DetailedAtomicRelaxationModel>
 detailed_atomic_relaxation_model;
 
+std::unique_ptr<const MonteCarlo::DetailedAtomicRelaxationModel>
+k_cutoff_detailed_atomic_relaxation_model;
+
+std::unique_ptr<const MonteCarlo::DetailedAtomicRelaxationModel>
+high_cutoff_detailed_atomic_relaxation_model;
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -92,6 +98,120 @@ FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel, relaxAtom )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the random numbers consumed by an emitting cascade are pinned
+FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel,
+                   relaxAtom_random_number_consumption )
+{
+  MonteCarlo::PhotonState photon( 1 );
+  photon.setEnergy( 1.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setPosition( 1.0, 1.0, 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  // All vacancy cascades emit particles: each transition consumes one random
+  // number and each emitted particle consumes two
+  std::vector<double> fake_stream( 10 );
+  fake_stream[0] = 0.966; // Choose the non-radiative L1-L2 transition
+  fake_stream[1] = 0.5; // direction
+  fake_stream[2] = 0.5; // direction
+  fake_stream[3] = 0.09809; // Chose the radiative P3 transition
+  fake_stream[4] = 0.5; // direction
+  fake_stream[5] = 0.5; // direction
+  fake_stream[6] = 0.40361; // Chose the radiative P1 transition
+  fake_stream[7] = 0.5; // direction
+  fake_stream[8] = 0.5; // direction
+  fake_stream[9] = 0.25; // next random number after the relaxation
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  detailed_atomic_relaxation_model->relaxAtom( Data::K_SUBSHELL,
+                                               photon,
+                                               bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(), 0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The L1 and L2 vacancy cascades can't emit particles above the min
+  // energies so they are not followed and don't consume random numbers
+  // (a recursive relaxation would sample the L1 and L2 transitions)
+  fake_stream.resize( 4 );
+  fake_stream[3] = 0.25; // next random number after the relaxation
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::ParticleBank k_cutoff_bank;
+
+  k_cutoff_detailed_atomic_relaxation_model->relaxAtom( Data::K_SUBSHELL,
+                                                        photon,
+                                                        k_cutoff_bank );
+
+  FRENSIE_CHECK_EQUAL( k_cutoff_bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( k_cutoff_bank.top().getEnergy(), 5.71919999999999998e-02 );
+  FRENSIE_CHECK_EQUAL( k_cutoff_bank.top().getParticleType(), MonteCarlo::ELECTRON );
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(), 0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // A cascade that can't emit particles doesn't consume random numbers
+  fake_stream.resize( 1 );
+  fake_stream[0] = 0.25;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::ParticleBank high_cutoff_bank;
+
+  high_cutoff_detailed_atomic_relaxation_model->relaxAtom( Data::K_SUBSHELL,
+                                                            photon,
+                                                            high_cutoff_bank );
+
+  FRENSIE_CHECK_EQUAL( high_cutoff_bank.size(), 0 );
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(), 0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check if the vacancy cascade of a subshell can emit particles
+FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel,
+                   canSubshellCascadeEmitParticles )
+{
+  FRENSIE_CHECK( detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::K_SUBSHELL ) );
+  FRENSIE_CHECK( detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::L1_SUBSHELL ) );
+  FRENSIE_CHECK( !detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::INVALID_SUBSHELL ) );
+  FRENSIE_CHECK( !detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::UNKNOWN_SUBSHELL ) );
+  FRENSIE_CHECK( !detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::Q3_SUBSHELL ) );
+
+  FRENSIE_CHECK( k_cutoff_detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::K_SUBSHELL ) );
+  FRENSIE_CHECK( !k_cutoff_detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::L1_SUBSHELL ) );
+  FRENSIE_CHECK( !k_cutoff_detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::L2_SUBSHELL ) );
+
+  FRENSIE_CHECK( !high_cutoff_detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::K_SUBSHELL ) );
+  FRENSIE_CHECK( !high_cutoff_detailed_atomic_relaxation_model->canSubshellCascadeEmitParticles( Data::L1_SUBSHELL ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the energy of a cascade that can't emit particles is deposited
+// locally
+FRENSIE_UNIT_TEST( DetailedAtomicRelaxationModel, relaxAtom_high_cutoff )
+{
+  MonteCarlo::PhotonState photon( 1 );
+  photon.setEnergy( 1.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setPosition( 1.0, 1.0, 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  high_cutoff_detailed_atomic_relaxation_model->relaxAtom( Data::K_SUBSHELL,
+                                                            photon,
+                                                            bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -195,6 +315,17 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
 			      new MonteCarlo::DetailedAtomicRelaxationModel(
                                     subshell_relaxation_models, 1e-3, 1e-5 ) );
 
+  // Only the K subshell relaxation particles will be above these min
+  // energies
+  k_cutoff_detailed_atomic_relaxation_model.reset(
+			      new MonteCarlo::DetailedAtomicRelaxationModel(
+                                    subshell_relaxation_models, 0.02, 0.02 ) );
+
+  // No relaxation particle will be above these min energies
+  high_cutoff_detailed_atomic_relaxation_model.reset(
+			      new MonteCarlo::DetailedAtomicRelaxationModel(
+                                    subshell_relaxation_models, 1.0, 1.0 ) );
+
   // Clear setup data
   ace_file_handler.reset();
   xss_data_extractor.reset();
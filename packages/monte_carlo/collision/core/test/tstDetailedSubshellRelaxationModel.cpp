@@ -66,6 +66,34 @@ FRENSIE_UNIT_TEST( DetailedSubshellRelaxationModel, relaxSubshell )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check if a transition can emit a particle above the min energies
+FRENSIE_UNIT_TEST( DetailedSubshellRelaxationModel, canEmitParticle )
+{
+  FRENSIE_CHECK( detailed_subshell_relaxation_model->canEmitParticle( 1e-3, 1e-5 ) );
+  FRENSIE_CHECK( detailed_subshell_relaxation_model->canEmitParticle( 1.0, 1e-5 ) );
+  FRENSIE_CHECK( detailed_subshell_relaxation_model->canEmitParticle( 1e-3, 1.0 ) );
+  FRENSIE_CHECK( !detailed_subshell_relaxation_model->canEmitParticle( 1.0, 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the transition vacancy shells can be returned
+FRENSIE_UNIT_TEST( DetailedSubshellRelaxationModel,
+                   getTransitionVacancyShells )
+{
+  std::set<Data::SubshellType> vacancy_shells;
+
+  detailed_subshell_relaxation_model->getTransitionVacancyShells(
+                                                              vacancy_shells );
+
+  FRENSIE_CHECK( vacancy_shells.count( Data::L1_SUBSHELL ) );
+  FRENSIE_CHECK( vacancy_shells.count( Data::L2_SUBSHELL ) );
+  FRENSIE_CHECK( vacancy_shells.count( Data::P3_SUBSHELL ) );
+  FRENSIE_CHECK( !vacancy_shells.count( Data::K_SUBSHELL ) );
+  FRENSIE_CHECK( !vacancy_shells.count( Data::INVALID_SUBSHELL ) );
+  FRENSIE_CHECK( !vacancy_shells.count( Data::UNKNOWN_SUBSHELL ) );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -0,0 +1,428 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DeltaTrackingRegion.cpp
+//! \author Alex Robinson
+//! \brief  Delta tracking region class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <random>
+#include <limits>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_DeltaTrackingRegion.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_AdjointPhotonState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_AdjointElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+DeltaTrackingRegion::DeltaTrackingRegion()
+  : d_cells(),
+    d_cell_flags( ParticleType_END ),
+    d_min_energies( ParticleType_END, 0.0 ),
+    d_max_energies( ParticleType_END, 0.0 ),
+    d_majorant_cell_indices( ParticleType_END )
+{ /* ... */ }
+
+// Set the cells that will be delta tracked for the particle type
+void DeltaTrackingRegion::setCells(
+                         const FilledGeometryModel& model,
+                         const ParticleType particle_type,
+                         const std::vector<CellIdType>& cells,
+                         const double min_energy,
+                         const double max_energy,
+                         const size_t convexity_test_chords )
+{
+  this->setCells( model,
+                  particle_type,
+                  std::set<CellIdType>( cells.begin(), cells.end() ),
+                  min_energy,
+                  max_energy,
+                  convexity_test_chords );
+}
+
+// Set the cells that will be delta tracked for the particle type
+/*! \details Any cells that were previously set for the particle type will
+ * be replaced. Particles with energies outside of [min_energy,max_energy]
+ * will be tracked surface to surface. The cells must form a convex volume.
+ * The requested number of random chords between points in the region are
+ * walked to detect regions that are not convex - an exception will be
+ * thrown if a chord leaves the region. Passing this test does not prove
+ * that the region is convex. The test needs the bounding boxes of the
+ * cells, so an exception will also be thrown if the model cannot provide
+ * them. Setting the number of chords to zero skips the test, which should
+ * only be done when the region is known to be convex.
+ */
+void DeltaTrackingRegion::setCells(
+                         const FilledGeometryModel& model,
+                         const ParticleType particle_type,
+                         const std::set<CellIdType>& cells,
+                         const double min_energy,
+                         const double max_energy,
+                         const size_t convexity_test_chords )
+{
+  TEST_FOR_EXCEPTION( cells.empty(),
+                      std::runtime_error,
+                      "A delta tracking region must have at least one "
+                      "cell!" );
+
+  TEST_FOR_EXCEPTION( min_energy < 0.0,
+                      std::runtime_error,
+                      "The delta tracking region min energy must not be "
+                      "negative!" );
+
+  TEST_FOR_EXCEPTION( min_energy >= max_energy,
+                      std::runtime_error,
+                      "The delta tracking region min energy must be less "
+                      "than the max energy!" );
+
+  // Make sure that the requested cells are in the model
+  for( auto cell : cells )
+  {
+    TEST_FOR_EXCEPTION( !model.getUnfilledModel().doesCellExist( cell ),
+                        std::runtime_error,
+                        "Delta tracking cell " << cell << " does not exist!" );
+
+    TEST_FOR_EXCEPTION( model.isTerminationCell( cell ),
+                        std::runtime_error,
+                        "A delta tracking cell cannot be a termination cell "
+                        "(cell " << cell << ")!" );
+  }
+
+  std::vector<size_t> majorant_cell_indices;
+
+  switch( particle_type )
+  {
+    case NEUTRON:
+    {
+      this->findMajorantCellIndices<NeutronState>( model,
+                                                   cells,
+                                                   majorant_cell_indices );
+      break;
+    }
+    case PHOTON:
+    {
+      this->findMajorantCellIndices<PhotonState>( model,
+                                                  cells,
+                                                  majorant_cell_indices );
+      break;
+    }
+    case ELECTRON:
+    {
+      this->findMajorantCellIndices<ElectronState>( model,
+                                                    cells,
+                                                    majorant_cell_indices );
+      break;
+    }
+    case POSITRON:
+    {
+      this->findMajorantCellIndices<PositronState>( model,
+                                                    cells,
+                                                    majorant_cell_indices );
+      break;
+    }
+    case ADJOINT_PHOTON:
+    {
+      this->findMajorantCellIndices<AdjointPhotonState>(
+                                                       model,
+                                                       cells,
+                                                       majorant_cell_indices );
+      break;
+    }
+    case ADJOINT_ELECTRON:
+    {
+      this->findMajorantCellIndices<AdjointElectronState>(
+                                                       model,
+                                                       cells,
+                                                       majorant_cell_indices );
+      break;
+    }
+    default:
+    {
+      THROW_EXCEPTION( std::runtime_error,
+                       "Particle type " << particle_type << " cannot be "
+                       "delta tracked!" );
+    }
+  }
+
+  // Cache the cell flags
+  std::vector<bool> particle_cell_flags(
+                              model.getUnfilledModel().getNumberOfCells(),
+                              false );
+
+  for( auto cell : cells )
+    particle_cell_flags[model.getCellIndex( cell )] = true;
+
+  this->checkConvexity( model.getUnfilledModel(),
+                        cells,
+                        particle_cell_flags,
+                        convexity_test_chords );
+
+  d_cells[particle_type] = cells;
+  d_cell_flags[particle_type].swap( particle_cell_flags );
+  d_min_energies[particle_type] = min_energy;
+  d_max_energies[particle_type] = max_energy;
+  d_majorant_cell_indices[particle_type].swap( majorant_cell_indices );
+}
+
+// Check for cells that do not form a convex volume
+/*! \details The chord end points are sampled uniformly in the bounding box
+ * of the region and rejected until they are inside of the region. A private
+ * random number engine with a fixed seed is used so that the check is
+ * reproducible and the simulation random number streams are not consumed.
+ */
+void DeltaTrackingRegion::checkConvexity(
+                                     const Geometry::Model& model,
+                                     const std::set<CellIdType>& cells,
+                                     const std::vector<bool>& cell_flags,
+                                     const size_t convexity_test_chords )
+{
+  if( convexity_test_chords == 0 )
+    return;
+
+  // Find the bounding box of the region
+  Geometry::Model::Length region_lower_bounds[3];
+  Geometry::Model::Length region_upper_bounds[3];
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    region_lower_bounds[i] = Geometry::Model::Length::from_value(
+                                    std::numeric_limits<double>::infinity() );
+    region_upper_bounds[i] = Geometry::Model::Length::from_value(
+                                   -std::numeric_limits<double>::infinity() );
+  }
+
+  for( auto cell : cells )
+  {
+    Geometry::Model::Length cell_lower_bounds[3];
+    Geometry::Model::Length cell_upper_bounds[3];
+
+    TEST_FOR_EXCEPTION( !model.getCellBoundingBox( cell,
+                                                   cell_lower_bounds,
+                                                   cell_upper_bounds ),
+                        std::runtime_error,
+                        "The delta tracking region can't be tested for "
+                        "convexity because the bounding box of cell "
+                        << cell << " is not available - set the number of "
+                        "convexity test chords to zero if the region is "
+                        "known to be convex!" );
+
+    for( size_t i = 0; i < 3; ++i )
+    {
+      if( cell_lower_bounds[i] < region_lower_bounds[i] )
+        region_lower_bounds[i] = cell_lower_bounds[i];
+
+      if( cell_upper_bounds[i] > region_upper_bounds[i] )
+        region_upper_bounds[i] = cell_upper_bounds[i];
+    }
+  }
+
+  std::shared_ptr<Geometry::Navigator> navigator = model.createNavigator();
+
+  std::mt19937_64 engine;
+  std::uniform_real_distribution<double> distribution( 0.0, 1.0 );
+
+  const double direction[3] = {0.0, 0.0, 1.0};
+
+  // Sample a point inside of the region (a region that fills a tiny
+  // fraction of its bounding box will only be partially tested)
+  auto sample_region_point = [&]( Geometry::Model::Length point[3] ) -> bool
+  {
+    for( size_t trial = 0; trial < 1000; ++trial )
+    {
+      for( size_t i = 0; i < 3; ++i )
+      {
+        point[i] = region_lower_bounds[i] + distribution( engine )*
+          (region_upper_bounds[i] - region_lower_bounds[i]);
+      }
+
+      try{
+        const Geometry::Model::EntityId cell =
+          navigator->findCellContainingRay( point, direction );
+
+        if( cell_flags[model.getCellIndex( cell )] )
+          return true;
+      }
+      catch( const std::exception& )
+      { /* ... */ }
+    }
+
+    return false;
+  };
+
+  for( size_t i = 0; i < convexity_test_chords; ++i )
+  {
+    Geometry::Model::Length start_point[3];
+    Geometry::Model::Length end_point[3];
+
+    if( !sample_region_point( start_point ) ||
+        !sample_region_point( end_point ) )
+      break;
+
+    TEST_FOR_EXCEPTION( !DeltaTrackingRegion::isChordInsideRegion(
+                                                            *navigator,
+                                                            cell_flags,
+                                                            start_point,
+                                                            end_point ),
+                        std::runtime_error,
+                        "The delta tracking region is not convex (the chord "
+                        "from (" << start_point[0].value() << ","
+                        << start_point[1].value() << ","
+                        << start_point[2].value() << ") to ("
+                        << end_point[0].value() << ","
+                        << end_point[1].value() << ","
+                        << end_point[2].value() << ") leaves the "
+                        "region)!" );
+  }
+}
+
+// Check if a chord of the region stays inside of the region
+/*! \details Chords that hit a reflecting surface or that cannot be walked
+ * because of a ray tracing error are not used to reject the region.
+ */
+bool DeltaTrackingRegion::isChordInsideRegion(
+                                  Geometry::Navigator& navigator,
+                                  const std::vector<bool>& cell_flags,
+                                  const Geometry::Model::Length start_point[3],
+                                  const Geometry::Model::Length end_point[3] )
+{
+  double direction[3] = {(end_point[0] - start_point[0]).value(),
+                         (end_point[1] - start_point[1]).value(),
+                         (end_point[2] - start_point[2]).value()};
+
+  double chord_length = std::sqrt( direction[0]*direction[0] +
+                                   direction[1]*direction[1] +
+                                   direction[2]*direction[2] );
+
+  if( chord_length == 0.0 )
+    return true;
+
+  for( size_t i = 0; i < 3; ++i )
+    direction[i] /= chord_length;
+
+  try{
+    navigator.setState( start_point, direction );
+
+    while( true )
+    {
+      const double distance_to_boundary = navigator.fireRay().value();
+
+      if( distance_to_boundary >= chord_length )
+        return true;
+
+      if( navigator.advanceToCellBoundary() )
+        return true;
+
+      chord_length -= distance_to_boundary;
+
+      if( !cell_flags[navigator.getCurrentCellIndex()] )
+        return false;
+    }
+  }
+  catch( const std::exception& )
+  {
+    return true;
+  }
+}
+
+// Check if delta tracking cells have been specified for the particle type
+bool DeltaTrackingRegion::hasDeltaTrackingCells(
+                                       const ParticleType particle_type ) const
+{
+  return d_cells.find( particle_type ) != d_cells.end();
+}
+
+// Check if a cell is a delta tracking cell
+bool DeltaTrackingRegion::isDeltaTrackingCell(
+                                              const ParticleType particle_type,
+                                              const CellIdType cell_id ) const
+{
+  ParticleTypeCellMap::const_iterator particle_type_cells_it =
+    d_cells.find( particle_type );
+
+  if( particle_type_cells_it != d_cells.end() )
+  {
+    return particle_type_cells_it->second.find( cell_id ) !=
+      particle_type_cells_it->second.end();
+  }
+  else
+    return false;
+}
+
+// Check if the particle can be delta tracked from its current state
+/*! \details The particle can be delta tracked if it is in a delta tracking
+ * cell and its energy is inside of the delta tracking energy range.
+ */
+bool DeltaTrackingRegion::isParticleDeltaTracked(
+                                          const ParticleState& particle ) const
+{
+  if( this->isDeltaTrackingCellAtIndex( particle.getParticleType(),
+                                        particle.getCellIndex() ) )
+  {
+    return particle.getEnergy() >= d_min_energies[particle.getParticleType()] &&
+      particle.getEnergy() <= d_max_energies[particle.getParticleType()];
+  }
+  else
+    return false;
+}
+
+// Return the cells that will be delta tracked
+void DeltaTrackingRegion::getCells( const ParticleType particle_type,
+                                    std::set<CellIdType>& cells ) const
+{
+  ParticleTypeCellMap::const_iterator particle_type_cells_it =
+    d_cells.find( particle_type );
+
+  if( particle_type_cells_it != d_cells.end() )
+  {
+    cells.insert( particle_type_cells_it->second.begin(),
+                  particle_type_cells_it->second.end() );
+  }
+}
+
+// Return the particle types that will be delta tracked
+void DeltaTrackingRegion::getParticleTypes(
+                                 std::set<ParticleType>& particle_types ) const
+{
+  ParticleTypeCellMap::const_iterator particle_type_cells_it =
+    d_cells.begin();
+
+  while( particle_type_cells_it != d_cells.end() )
+  {
+    particle_types.insert( particle_type_cells_it->first );
+
+    ++particle_type_cells_it;
+  }
+}
+
+// Return the min energy of the particle type that will be delta tracked
+double DeltaTrackingRegion::getMinEnergy(
+                                      const ParticleType particle_type ) const
+{
+  return d_min_energies[particle_type];
+}
+
+// Return the max energy of the particle type that will be delta tracked
+double DeltaTrackingRegion::getMaxEnergy(
+                                      const ParticleType particle_type ) const
+{
+  return d_max_energies[particle_type];
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::DeltaTrackingRegion );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DeltaTrackingRegion.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DeltaTrackingRegion.hpp
+//! \author Alex Robinson
+//! \brief  Delta tracking region class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DELTA_TRACKING_REGION_HPP
+#define MONTE_CARLO_DELTA_TRACKING_REGION_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_ParticleType.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The delta tracking (Woodcock tracking) region class
+ * \details The cells of a delta tracking region are not tracked surface to
+ * surface. Instead, flight distances are sampled using a majorant cross
+ * section and the cell is only located at the sampled collision sites. A
+ * collision site is a real collision site with probability
+ * \f$\Sigma_t(E)/\Sigma_{maj}(E)\f$ (otherwise it is a virtual collision
+ * site and the particle continues with its current state). The majorant
+ * cross section is the maximum total macroscopic cross section of the
+ * distinct materials in the region evaluated at the particle energy, so it
+ * is a true bound at every energy. Only one cell of each distinct material
+ * is stored, which keeps the majorant evaluation cheap even for regions with
+ * many cells (e.g. the voxels of a phantom). The cells of each particle type
+ * are also stored as flags indexed by the cell index (see
+ * Geometry::Model::getCellIndex) so that the cell containing a particle can
+ * be checked without any map lookups. The cells of a region must form a
+ * convex volume - a particle that leaves the region and then reenters it
+ * during a single flight would skip the cells between. Random chords of the
+ * region are walked when the cells are set to detect regions that are not
+ * convex. This is a statistical test - a region that passes it is not
+ * guaranteed to be convex.
+ */
+class DeltaTrackingRegion
+{
+
+public:
+
+  //! The cell id type
+  typedef Geometry::Model::EntityId CellIdType;
+
+  //! Constructor
+  DeltaTrackingRegion();
+
+  //! Destructor
+  ~DeltaTrackingRegion()
+  { /* ... */ }
+
+  //! Set the cells that will be delta tracked for the particle type
+  void setCells( const FilledGeometryModel& model,
+                 const ParticleType particle_type,
+                 const std::set<CellIdType>& cells,
+                 const double min_energy,
+                 const double max_energy,
+                 const size_t convexity_test_chords = 1000 );
+
+  //! Set the cells that will be delta tracked for the particle type
+  void setCells( const FilledGeometryModel& model,
+                 const ParticleType particle_type,
+                 const std::vector<CellIdType>& cells,
+                 const double min_energy,
+                 const double max_energy,
+                 const size_t convexity_test_chords = 1000 );
+
+  //! Check if delta tracking cells have been specified for the particle type
+  bool hasDeltaTrackingCells( const ParticleType particle_type ) const;
+
+  //! Check if a cell is a delta tracking cell
+  bool isDeltaTrackingCell( const ParticleType particle_type,
+                            const CellIdType cell_id ) const;
+
+  //! Check if the cell with the given index is a delta tracking cell
+  bool isDeltaTrackingCellAtIndex( const ParticleType particle_type,
+                                   const size_t cell_index ) const;
+
+  //! Check if the particle can be delta tracked from its current state
+  bool isParticleDeltaTracked( const ParticleState& particle ) const;
+
+  //! Return the cells that will be delta tracked
+  void getCells( const ParticleType particle_type,
+                 std::set<CellIdType>& cells ) const;
+
+  //! Return the particle types that will be delta tracked
+  void getParticleTypes( std::set<ParticleType>& particle_types ) const;
+
+  //! Return the min energy of the particle type that will be delta tracked
+  double getMinEnergy( const ParticleType particle_type ) const;
+
+  //! Return the max energy of the particle type that will be delta tracked
+  double getMaxEnergy( const ParticleType particle_type ) const;
+
+  //! Return the majorant cross section
+  template<typename State>
+  double getMajorantCrossSection( const FilledGeometryModel& model,
+                                  const State& particle ) const;
+
+private:
+
+  // Find one cell index of each distinct material in the cells
+  template<typename State>
+  static void findMajorantCellIndices(
+                                  const FilledGeometryModel& model,
+                                  const std::set<CellIdType>& cells,
+                                  std::vector<size_t>& majorant_cell_indices );
+
+  // Check for cells that do not form a convex volume
+  static void checkConvexity( const Geometry::Model& model,
+                              const std::set<CellIdType>& cells,
+                              const std::vector<bool>& cell_flags,
+                              const size_t convexity_test_chords );
+
+  // Check if a chord of the region stays inside of the region
+  static bool isChordInsideRegion( Geometry::Navigator& navigator,
+                                   const std::vector<bool>& cell_flags,
+                                   const Geometry::Model::Length start_point[3],
+                                   const Geometry::Model::Length end_point[3] );
+
+  // Serialize the delta tracking region data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The delta tracking cells
+  typedef std::map<ParticleType,std::set<CellIdType> > ParticleTypeCellMap;
+  ParticleTypeCellMap d_cells;
+
+  // The delta tracking cell flags of each particle type (indexed by
+  // particle type and then by cell index)
+  std::vector<std::vector<bool> > d_cell_flags;
+
+  // The min energy of each particle type (indexed by particle type)
+  std::vector<double> d_min_energies;
+
+  // The max energy of each particle type (indexed by particle type)
+  std::vector<double> d_max_energies;
+
+  // One cell index of each distinct material in the region (indexed by
+  // particle type)
+  std::vector<std::vector<size_t> > d_majorant_cell_indices;
+};
+
+// Check if the cell with the given index is a delta tracking cell
+inline bool DeltaTrackingRegion::isDeltaTrackingCellAtIndex(
+                                              const ParticleType particle_type,
+                                              const size_t cell_index ) const
+{
+  const std::vector<bool>& particle_cell_flags = d_cell_flags[particle_type];
+
+  return cell_index < particle_cell_flags.size() &&
+    particle_cell_flags[cell_index];
+}
+
+// Serialize the delta tracking region data
+template<typename Archive>
+void DeltaTrackingRegion::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_flags );
+  ar & BOOST_SERIALIZATION_NVP( d_min_energies );
+  ar & BOOST_SERIALIZATION_NVP( d_max_energies );
+  ar & BOOST_SERIALIZATION_NVP( d_majorant_cell_indices );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( DeltaTrackingRegion, MonteCarlo, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, DeltaTrackingRegion );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_DeltaTrackingRegion_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_DELTA_TRACKING_REGION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DeltaTrackingRegion.hpp
+//---------------------------------------------------------------------------//
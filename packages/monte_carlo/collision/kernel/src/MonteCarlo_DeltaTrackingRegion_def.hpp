@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DeltaTrackingRegion_def.hpp
+//! \author Alex Robinson
+//! \brief  Delta tracking region class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DELTA_TRACKING_REGION_DEF_HPP
+#define MONTE_CARLO_DELTA_TRACKING_REGION_DEF_HPP
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Find one cell index of each distinct material in the cells
+/*! \details Cells that contain the same material have the same total
+ * macroscopic cross section so only one of them is needed to evaluate the
+ * majorant cross section. Void cells are skipped.
+ */
+template<typename State>
+void DeltaTrackingRegion::findMajorantCellIndices(
+                                  const FilledGeometryModel& model,
+                                  const std::set<CellIdType>& cells,
+                                  std::vector<size_t>& majorant_cell_indices )
+{
+  typedef typename Details::FilledGeometryModelUpcastHelper<State>::UpcastType
+    FilledParticleGeometryModel;
+
+  const FilledParticleGeometryModel& particle_model = model;
+
+  std::set<const void*> region_materials;
+
+  majorant_cell_indices.clear();
+
+  for( auto cell : cells )
+  {
+    const size_t cell_index = model.getCellIndex( cell );
+
+    const void* material = particle_model.getCellData( cell_index ).material;
+
+    if( material != NULL && region_materials.insert( material ).second )
+      majorant_cell_indices.push_back( cell_index );
+  }
+}
+
+// Return the majorant cross section
+/*! \details The majorant cross section is the maximum total macroscopic
+ * cross section of the region materials at the particle energy. Because the
+ * energy of a particle does not change during a flight the majorant cross
+ * section only needs to be evaluated once per flight. It is never less than
+ * the total macroscopic cross section of a region cell at the same energy.
+ */
+template<typename State>
+double DeltaTrackingRegion::getMajorantCrossSection(
+                                         const FilledGeometryModel& model,
+                                         const State& particle ) const
+{
+  // Make sure that the particle type is delta tracked
+  testPrecondition( this->hasDeltaTrackingCells( particle.getParticleType() ) );
+
+  const std::vector<size_t>& particle_majorant_cell_indices =
+    d_majorant_cell_indices[particle.getParticleType()];
+
+  double majorant_cross_section = 0.0;
+
+  for( auto cell_index : particle_majorant_cell_indices )
+  {
+    // Archived regions may contain void cells
+    if( model.isCellVoidAtIndex<State>( cell_index ) )
+      continue;
+
+    const double cross_section =
+      model.getMacroscopicTotalForwardCrossSectionQuickAtIndex<State>(
+                                                       cell_index,
+                                                       particle.getEnergy() );
+
+    if( cross_section > majorant_cross_section )
+      majorant_cross_section = cross_section;
+  }
+
+  return majorant_cross_section;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DELTA_TRACKING_REGION_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DeltaTrackingRegion_def.hpp
+//---------------------------------------------------------------------------//
@@ -73,9 +73,19 @@ public:
   template<typename ParticleStateType>
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell with the given index is void (as experienced by the given particle type)
+  template<typename ParticleStateType>
+  bool isCellVoidAtIndex( const size_t cell_index ) const;
+
   //! Check if a cell is a termination cell
   using FilledNeutronGeometryModel::isTerminationCell;
 
+  //! Check if the cell with the given index is a termination cell
+  using FilledNeutronGeometryModel::isTerminationCellAtIndex;
+
+  //! Get the cell index
+  using FilledNeutronGeometryModel::getCellIndex;
+
   //! Get the total macroscopic cross section of a material for the given particle type
   template<typename ParticleStateType>
   double getMacroscopicTotalCrossSection(
@@ -136,6 +146,12 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of the material in the cell with the given index for the given particle type
+  template<typename ParticleStateType>
+  double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const;
+
   //! Get the total forward macroscopic cs of a material for neutrons
   using FilledNeutronGeometryModel::getMacroscopicTotalForwardCrossSection;
 
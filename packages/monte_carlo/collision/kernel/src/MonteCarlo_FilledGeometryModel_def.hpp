@@ -126,6 +126,13 @@ bool FilledGeometryModel::isCellVoid(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::isCellVoid( cell );
 }
 
+// Check if the cell with the given index is void (as experienced by the given particle type)
+template<typename ParticleStateType>
+bool FilledGeometryModel::isCellVoidAtIndex( const size_t cell_index ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::isCellVoidAtIndex( cell_index );
+}
+
 // Get the total macroscopic cross section of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getMacroscopicTotalCrossSection(
@@ -162,6 +169,15 @@ double FilledGeometryModel::getMacroscopicTotalForwardCrossSectionQuick(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicTotalForwardCrossSectionQuick( cell, energy );
 }
 
+// Get the total forward macroscopic cross section of the material in the cell with the given index for the given particle type
+template<typename ParticleStateType>
+double FilledGeometryModel::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicTotalForwardCrossSectionQuickAtIndex( cell_index, energy );
+}
+
 // Get the adjoint weight factor of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getAdjointWeightFactor(
@@ -47,11 +47,21 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const final override;
 
+  //! Get the total forward macroscopic cross section of the material in the cell with the given index
+  double getMacroscopicTotalForwardCrossSectionAtIndex(
+                                   const size_t cell_index,
+                                   const double energy ) const final override;
+
   //! Get the total forward macroscopic cross section of a material
   double getMacroscopicTotalForwardCrossSectionQuick(
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const final override;
 
+  //! Get the total forward macroscopic cross section of the material in the cell with the given index
+  double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                   const size_t cell_index,
+                                   const double energy ) const final override;
+
   //! Get the total forward macroscopic cross section of a material
   using BaseType::getMacroscopicTotalForwardCrossSection;
 
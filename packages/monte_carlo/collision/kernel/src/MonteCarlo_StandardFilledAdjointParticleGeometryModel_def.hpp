@@ -29,6 +29,21 @@ double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotal
     return this->getMaterial( cell )->getMacroscopicTotalForwardCrossSection( energy );
 }
 
+// Get the total forward macroscopic cross section of the material in the cell with the given index
+template<typename Material>
+double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  const typename BaseType::CellData& cell_data =
+    this->getCellData( cell_index );
+
+  if( cell_data.material == NULL )
+    return 0.0;
+  else
+    return cell_data.material->getMacroscopicTotalForwardCrossSection( energy );
+}
+
 // Get the total forward macroscopic cross section of a material
 /*! \details Before calling this method you must first check if the cell
  * is void. Calling this method with a void cell is not allowed.
@@ -44,6 +59,21 @@ double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotal
   return this->getMaterial( cell )->getMacroscopicTotalForwardCrossSection( energy );
 }
 
+// Get the total forward macroscopic cross section of the material in the cell with the given index
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  // Make sure that the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return this->getCellData( cell_index ).material->getMacroscopicTotalForwardCrossSection( energy );
+}
+
 // Get the adjoint weight factor
 template<typename Material>
 double StandardFilledAdjointParticleGeometryModel<Material>::getAdjointWeightFactor( const ParticleStateType& particle ) const
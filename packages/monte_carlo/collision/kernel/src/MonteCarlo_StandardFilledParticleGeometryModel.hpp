@@ -48,19 +48,41 @@ public:
   //! Typedef for the particle type
   typedef typename Material::ParticleStateType ParticleStateType;
 
+  //! The packed cell data (a void cell has a null material)
+  struct CellData
+  {
+    //! The material contained in the cell
+    const MaterialType* material;
+
+    //! Records if the cell is a termination cell
+    bool termination_cell;
+  };
+
   //! Check if the entire model is void
   bool isVoid() const;
 
   //! Check if a cell is void
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell with the given index is void
+  bool isCellVoidAtIndex( const size_t cell_index ) const;
+
   //! Check if a cell is a termination cell
   bool isTerminationCell( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell with the given index is a termination cell
+  bool isTerminationCellAtIndex( const size_t cell_index ) const;
+
   //! Get the material contained in a cell
   const std::shared_ptr<const MaterialType>&
   getMaterial( const Geometry::Model::EntityId cell ) const;
 
+  //! Get the cell index
+  size_t getCellIndex( const Geometry::Model::EntityId cell ) const;
+
+  //! Get the packed data of the cell with the given index
+  const CellData& getCellData( const size_t cell_index ) const;
+
   //! Destructor
   virtual ~StandardFilledParticleGeometryModel()
   { /* ... */ }
@@ -92,6 +114,11 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of the material in the cell with the given index
+  virtual double getMacroscopicTotalForwardCrossSectionAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const;
+
   //! Get the total forward macroscopic cross section of a material
   double getMacroscopicTotalForwardCrossSectionQuick(
                                      const ParticleStateType& particle ) const;
@@ -101,6 +128,11 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of the material in the cell with the given index
+  virtual double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const;
+
   //! Get the macroscopic reaction cross section for a specific reaction
   double getMacroscopicReactionCrossSection(
                                        const ParticleStateType& particle,
@@ -170,6 +202,9 @@ protected:
 
 private:
 
+  // Initialize the cell tables
+  void initializeCellTables();
+
   // Add a material to the collision kernel
   void addMaterial( const std::shared_ptr<const MaterialType>& material,
                     const std::vector<Geometry::Model::EntityId>&
@@ -187,11 +222,14 @@ private:
   
   MaterialNameMap d_material_name_map;
 
-  // The cell id material map
-  typedef std::unordered_map<Geometry::Model::EntityId,std::shared_ptr<const MaterialType> >
-  CellIdMaterialMap;
+  // The material contained in each cell (indexed by cell index)
+  std::vector<std::shared_ptr<const MaterialType> > d_cell_materials;
+
+  // The packed cell data (indexed by cell index)
+  std::vector<CellData> d_cell_data;
 
-  CellIdMaterialMap d_cell_id_material_map;  
+  // The number of cells that contain a material
+  size_t d_number_of_filled_cells;
 };
   
 } // end MonteCarlo namespace
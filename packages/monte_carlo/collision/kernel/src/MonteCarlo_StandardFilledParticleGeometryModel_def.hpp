@@ -20,6 +20,7 @@ namespace MonteCarlo{
 // Default constructor
 template<typename Material>
 StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryModel()
+  : d_number_of_filled_cells( 0 )
 { /* ... */ }
 
 // Constructor
@@ -29,10 +30,14 @@ StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryMod
   : d_unfilled_model( unfilled_model ),
     d_scattering_center_name_map(),
     d_material_name_map(),
-    d_cell_id_material_map()
+    d_cell_materials(),
+    d_cell_data(),
+    d_number_of_filled_cells( 0 )
 {
   // Make sure that the unfilled model is valid
   testPrecondition( unfilled_model.get() );
+
+  this->initializeCellTables();
 }
 
 // Set the unfilled model
@@ -44,6 +49,43 @@ void StandardFilledParticleGeometryModel<Material>::setUnfilledModel(
   testPrecondition( unfilled_model.get() );
   
   d_unfilled_model = unfilled_model;
+
+  this->initializeCellTables();
+}
+
+// Initialize the cell tables
+/*! \details Every cell starts out void. The termination cell flags are
+ * cached so that the unfilled model does not need to be queried during
+ * transport.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::initializeCellTables()
+{
+  const size_t number_of_cells = d_unfilled_model->getNumberOfCells();
+
+  d_cell_materials.clear();
+  d_cell_materials.resize( number_of_cells );
+
+  CellData void_cell_data;
+  void_cell_data.material = NULL;
+  void_cell_data.termination_cell = false;
+  
+  d_cell_data.assign( number_of_cells, void_cell_data );
+
+  d_number_of_filled_cells = 0;
+
+  Geometry::Model::CellIdSet cells;
+
+  d_unfilled_model->getCells( cells, true, true );
+
+  for( auto&& cell : cells )
+  {
+    if( d_unfilled_model->isTerminationCell( cell ) )
+    {
+      d_cell_data[d_unfilled_model->getCellIndex( cell )].termination_cell =
+        true;
+    }
+  }
 }
 
 // Load the materials and fill the model
@@ -164,14 +206,18 @@ void StandardFilledParticleGeometryModel<Material>::addMaterial(
 
   for( size_t i = 0; i < cells_containing_material.size(); ++i )
   {
-    TEST_FOR_EXCEPTION(
-                 d_cell_id_material_map.find( cells_containing_material[i] ) !=
-                 d_cell_id_material_map.end(),
-                 std::logic_error,
-                 "cell " << cells_containing_material[i] <<
-                 " already has a material assigned!" );
-
-    d_cell_id_material_map[cells_containing_material[i]] = material;
+    const size_t cell_index =
+      d_unfilled_model->getCellIndex( cells_containing_material[i] );
+    
+    TEST_FOR_EXCEPTION( d_cell_materials[cell_index].get() != NULL,
+                        std::logic_error,
+                        "cell " << cells_containing_material[i] <<
+                        " already has a material assigned!" );
+
+    d_cell_materials[cell_index] = material;
+    d_cell_data[cell_index].material = material.get();
+
+    ++d_number_of_filled_cells;
   }
 }
 
@@ -188,7 +234,30 @@ auto StandardFilledParticleGeometryModel<Material>::getMaterial(
                       std::runtime_error,
                       "Cell " << cell << " is void!" );
   
-  return d_cell_id_material_map.find( cell )->second;
+  return d_cell_materials[this->getCellIndex( cell )];
+}
+
+// Get the cell index
+/*! \details The cell index is the dense index assigned to the cell by the
+ * unfilled model (see Geometry::Model::getCellIndex).
+ */
+template<typename Material>
+inline size_t StandardFilledParticleGeometryModel<Material>::getCellIndex(
+                         const Geometry::Model::EntityId cell ) const
+{
+  return d_unfilled_model->getCellIndex( cell );
+}
+
+// Get the packed data of the cell with the given index
+template<typename Material>
+inline auto StandardFilledParticleGeometryModel<Material>::getCellData(
+                                  const size_t cell_index ) const
+  -> const CellData&
+{
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cell_data.size() );
+  
+  return d_cell_data[cell_index];
 }
 
 // Process loaded scattering centers
@@ -201,7 +270,7 @@ void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCente
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isVoid() const
 {
-  return d_cell_id_material_map.empty();
+  return d_number_of_filled_cells == 0;
 }
 
 // Check if a cell is void
@@ -209,7 +278,15 @@ template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isCellVoid(
                          const Geometry::Model::EntityId cell ) const
 {
-  return d_cell_id_material_map.find( cell ) == d_cell_id_material_map.end();
+  return this->isCellVoidAtIndex( this->getCellIndex( cell ) );
+}
+
+// Check if the cell with the given index is void
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isCellVoidAtIndex(
+                                                const size_t cell_index ) const
+{
+  return this->getCellData( cell_index ).material == NULL;
 }
 
 // Check if a cell is a termination cell
@@ -217,7 +294,15 @@ template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isTerminationCell(
                          const Geometry::Model::EntityId cell ) const
 {
-  return d_unfilled_model->isTerminationCell( cell );
+  return this->isTerminationCellAtIndex( this->getCellIndex( cell ) );
+}
+
+// Check if the cell with the given index is a termination cell
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isTerminationCellAtIndex(
+                                                const size_t cell_index ) const
+{
+  return this->getCellData( cell_index ).termination_cell;
 }
 
 // Get the total macroscopic cross section of a material
@@ -225,8 +310,15 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSection(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSection( particle.getCell(),
-                                                particle.getEnergy() );
+  const CellData& cell_data = this->getCellData( particle.getCellIndex() );
+
+  if( cell_data.material == NULL )
+    return 0.0;
+  else
+  {
+    return cell_data.material->getMacroscopicTotalCrossSection(
+                                                        particle.getEnergy() );
+  }
 }
 
 // Get the total macroscopic cross section of a material
@@ -249,8 +341,10 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSectionQuick(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSectionQuick( particle.getCell(),
-                                                     particle.getEnergy() );
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( particle.getCellIndex() ) );
+  
+  return this->getCellData( particle.getCellIndex() ).material->getMacroscopicTotalCrossSection( particle.getEnergy() );
 }
 
 // Get the total macroscopic cross section of a material
@@ -276,8 +370,9 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSection(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalForwardCrossSection( particle.getCell(),
-                                                       particle.getEnergy() );
+  return this->getMacroscopicTotalForwardCrossSectionAtIndex(
+                                                        particle.getCellIndex(),
+                                                        particle.getEnergy() );
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -292,6 +387,20 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
     return this->getMaterial(cell)->getMacroscopicTotalCrossSection( energy );
 }
 
+// Get the total forward macroscopic cross section of the material in the cell with the given index
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  const CellData& cell_data = this->getCellData( cell_index );
+
+  if( cell_data.material == NULL )
+    return 0.0;
+  else
+    return cell_data.material->getMacroscopicTotalCrossSection( energy );
+}
+
 // Get the total forward macroscopic cross section of a material
 /*! \details When a distance must be converted to an optical path length only
  * use the macroscopic cross section returned from this method. Before calling 
@@ -302,8 +411,9 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuick(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalForwardCrossSectionQuick( particle.getCell(),
-                                                            particle.getEnergy() );
+  return this->getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                        particle.getCellIndex(),
+                                                        particle.getEnergy() );
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -321,15 +431,36 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
   return this->getMaterial( cell )->getMacroscopicTotalCrossSection( energy );
 }
 
+// Get the total forward macroscopic cross section of the material in the cell with the given index
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return this->getCellData( cell_index ).material->getMacroscopicTotalCrossSection( energy );
+}
+
 // Get the macroscopic reaction cross section for a specific reaction
 template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCrossSection(
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSection( particle.getCell(),
-                                                   particle.getEnergy(),
-                                                   reaction );
+  const CellData& cell_data = this->getCellData( particle.getCellIndex() );
+
+  if( cell_data.material == NULL )
+    return 0.0;
+  else
+  {
+    return cell_data.material->getMacroscopicReactionCrossSection(
+                                              particle.getEnergy(), reaction );
+  }
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
@@ -357,9 +488,10 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSectionQuick( particle.getCell(),
-                                                        particle.getEnergy(),
-                                                        reaction );
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( particle.getCellIndex() ) );
+  
+  return this->getCellData( particle.getCellIndex() ).material->getMacroscopicReactionCrossSection( particle.getEnergy(), reaction );
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
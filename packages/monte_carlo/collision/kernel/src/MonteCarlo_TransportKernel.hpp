@@ -76,11 +76,10 @@ double TransportKernel::sampleSimpleDistanceToNextCollisionSite(
   // to collision)
   double distance_to_collision = std::numeric_limits<double>::infinity();
 
-  if( !d_model->isCellVoid<ParticleStateType>( particle.getCell() ) )
+  if( !d_model->isCellVoidAtIndex<ParticleStateType>( particle.getCellIndex() ) )
   {
     macroscopic_total_cross_section =
-      d_model->getMacroscopicTotalForwardCrossSectionQuick<ParticleStateType>(
-                                    particle.getCell(), particle.getEnergy() );
+      d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
 
     distance_to_collision = this->sampleOpticalPathLengthToNextCollisionSite()/
       macroscopic_total_cross_section;
@@ -124,10 +123,10 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
 
     double cell_total_macro_cross_section = 0.0;
 
-    if( !d_model->isCellVoid<ParticleStateType>(navigator->getCurrentCell()) )
+    if( !d_model->isCellVoidAtIndex<ParticleStateType>(navigator->getCurrentCellIndex()) )
     {
       cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick<ParticleStateType>( navigator->getCurrentCell(), particle.getEnergy() );
+        d_model->getMacroscopicTotalForwardCrossSectionQuickAtIndex<ParticleStateType>( navigator->getCurrentCellIndex(), particle.getEnergy() );
     }
     // The particle is inside of an empty infinite medium
     else if( distance_to_cell_boundary == Utility::QuantityTraits<double>::inf() )
@@ -147,7 +146,7 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
       // If the geometry is exited before the entire optical path has
       // been converted the distance traveled is infinite from the kernels
       // perspective.
-      if( d_model->isTerminationCell( navigator->getCurrentCell() ) )
+      if( d_model->isTerminationCellAtIndex( navigator->getCurrentCellIndex() ) )
       {
         distance_to_collision_site = std::numeric_limits<double>::infinity();
         break;
@@ -0,0 +1,507 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDeltaTrackingRegion.cpp
+//! \author Alex Robinson
+//! \brief  Delta tracking region class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_DeltaTrackingRegion.hpp"
+#include "MonteCarlo_FilledGeometryModel.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::si::kelvin;
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> filled_model;
+
+std::shared_ptr<const MonteCarlo::FilledGeometryModel> native_filled_model;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a default delta tracking region has no cells
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, default_constructor )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  FRENSIE_CHECK( !delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !delta_tracking_region.isDeltaTrackingCell( MonteCarlo::NEUTRON, 1 ) );
+  FRENSIE_CHECK( !delta_tracking_region.isDeltaTrackingCellAtIndex( MonteCarlo::NEUTRON, 0 ) );
+
+  std::set<MonteCarlo::ParticleType> particle_types;
+
+  delta_tracking_region.getParticleTypes( particle_types );
+
+  FRENSIE_CHECK( particle_types.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid delta tracking cells cannot be set
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, setCells_invalid )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  // No cells
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells( *filled_model,
+                                                       MonteCarlo::NEUTRON,
+                                                       std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>(),
+                                                       1e-11, 20.0 ),
+                       std::runtime_error );
+
+  // Negative min energy
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells( *filled_model,
+                                                       MonteCarlo::NEUTRON,
+                                                       std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                                       -1.0, 20.0 ),
+                       std::runtime_error );
+
+  // Invalid energy range
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells( *filled_model,
+                                                       MonteCarlo::NEUTRON,
+                                                       std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                                       20.0, 20.0 ),
+                       std::runtime_error );
+
+  // Cell does not exist
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells( *filled_model,
+                                                       MonteCarlo::NEUTRON,
+                                                       std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {2} ),
+                                                       1e-11, 20.0 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK( !delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::NEUTRON ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the delta tracking cells can be set
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, setCells )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  // The infinite medium model can't provide cell bounding boxes so the
+  // convexity test must be skipped
+  FRENSIE_REQUIRE_NO_THROW( delta_tracking_region.setCells(
+                                   *filled_model,
+                                   MonteCarlo::NEUTRON,
+                                   std::vector<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                   1e-11, 20.0,
+                                   0 ) );
+
+  FRENSIE_CHECK( delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( !delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( delta_tracking_region.isDeltaTrackingCell( MonteCarlo::NEUTRON, 1 ) );
+  FRENSIE_CHECK( !delta_tracking_region.isDeltaTrackingCell( MonteCarlo::PHOTON, 1 ) );
+  FRENSIE_CHECK( delta_tracking_region.isDeltaTrackingCellAtIndex( MonteCarlo::NEUTRON, filled_model->getCellIndex( 1 ) ) );
+  FRENSIE_CHECK( !delta_tracking_region.isDeltaTrackingCellAtIndex( MonteCarlo::PHOTON, filled_model->getCellIndex( 1 ) ) );
+
+  std::set<MonteCarlo::DeltaTrackingRegion::CellIdType> cells;
+
+  delta_tracking_region.getCells( MonteCarlo::NEUTRON, cells );
+
+  FRENSIE_CHECK_EQUAL( cells, std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ) );
+
+  std::set<MonteCarlo::ParticleType> particle_types;
+
+  delta_tracking_region.getParticleTypes( particle_types );
+
+  FRENSIE_CHECK_EQUAL( particle_types, std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMinEnergy( MonteCarlo::NEUTRON ), 1e-11 );
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMaxEnergy( MonteCarlo::NEUTRON ), 20.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that non-convex delta tracking cells cannot be set
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, setCells_non_convex )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  // The inner sphere is convex
+  FRENSIE_CHECK_NO_THROW( delta_tracking_region.setCells(
+                         *native_filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1, 2} ),
+                         1e-11, 20.0 ) );
+
+  // The half of the inner sphere is convex
+  FRENSIE_CHECK_NO_THROW( delta_tracking_region.setCells(
+                         *native_filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                         1e-11, 20.0 ) );
+
+  // The spherical shell is not convex
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells(
+                         *native_filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {3} ),
+                         1e-11, 20.0 ),
+                       std::runtime_error );
+
+  // The spherical shell and the left half of the inner sphere are not convex
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells(
+                         *native_filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1, 3} ),
+                         1e-11, 20.0 ),
+                       std::runtime_error );
+
+  // The previously set cells are kept
+  std::set<MonteCarlo::DeltaTrackingRegion::CellIdType> cells;
+
+  delta_tracking_region.getCells( MonteCarlo::NEUTRON, cells );
+
+  FRENSIE_CHECK_EQUAL( cells, std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ) );
+
+  // The convexity check can be turned off
+  FRENSIE_CHECK_NO_THROW( delta_tracking_region.setCells(
+                         *native_filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {3} ),
+                         1e-11, 20.0,
+                         0 ) );
+
+  // The convexity can't be checked without the cell bounding boxes
+  FRENSIE_CHECK_THROW( delta_tracking_region.setCells(
+                         *filled_model,
+                         MonteCarlo::NEUTRON,
+                         std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                         1e-11, 20.0 ),
+                       std::runtime_error );
+
+  cells.clear();
+
+  delta_tracking_region.getCells( MonteCarlo::NEUTRON, cells );
+
+  FRENSIE_CHECK_EQUAL( cells, std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {3} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the majorant cross section bounds the cell cross sections
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, getMajorantCrossSection )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  delta_tracking_region.setCells( *native_filled_model,
+                                  MonteCarlo::NEUTRON,
+                                  std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1, 2} ),
+                                  1e-11, 20.0 );
+
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.setPosition( -1.0, 0.0, 0.0 );
+  neutron.setDirection( 1.0, 0.0, 0.0 );
+  neutron.embedInModel( *native_filled_model );
+
+  // The majorant cross section is the max cross section of the two
+  // materials at every energy
+  std::vector<double> energies( {1e-11, 1e-8, 2.53010E-08, 1e-6, 1e-3, 1.0, 2.0, 10.0, 20.0} );
+
+  for( auto energy : energies )
+  {
+    neutron.setEnergy( energy );
+
+    const double cell_1_cross_section =
+      native_filled_model->getMacroscopicTotalForwardCrossSectionQuick<MonteCarlo::NeutronState>( 1, energy );
+
+    const double cell_2_cross_section =
+      native_filled_model->getMacroscopicTotalForwardCrossSectionQuick<MonteCarlo::NeutronState>( 2, energy );
+
+    FRENSIE_CHECK_EQUAL( delta_tracking_region.getMajorantCrossSection( *native_filled_model, neutron ),
+                         std::max( cell_1_cross_section, cell_2_cross_section ) );
+  }
+
+  // A single material region has a majorant equal to the cell cross section
+  delta_tracking_region.setCells( *filled_model,
+                                  MonteCarlo::NEUTRON,
+                                  std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                  1e-11, 20.0,
+                                  0 );
+
+  MonteCarlo::NeutronState infinite_medium_neutron( 1ull );
+  infinite_medium_neutron.embedInModel( *filled_model );
+  infinite_medium_neutron.setEnergy( 1e-6 );
+
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMajorantCrossSection( *filled_model, infinite_medium_neutron ),
+                       filled_model->getMacroscopicTotalForwardCrossSectionQuick( infinite_medium_neutron ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a particle will be delta tracked
+FRENSIE_UNIT_TEST( DeltaTrackingRegion, isParticleDeltaTracked )
+{
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  delta_tracking_region.setCells( *filled_model,
+                                  MonteCarlo::NEUTRON,
+                                  std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                  1e-6, 1.0,
+                                  0 );
+
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.embedInModel( *filled_model );
+
+  neutron.setEnergy( 1e-3 );
+
+  FRENSIE_CHECK( delta_tracking_region.isParticleDeltaTracked( neutron ) );
+
+  neutron.setEnergy( 1.0 );
+
+  FRENSIE_CHECK( delta_tracking_region.isParticleDeltaTracked( neutron ) );
+
+  neutron.setEnergy( 2.0 );
+
+  FRENSIE_CHECK( !delta_tracking_region.isParticleDeltaTracked( neutron ) );
+
+  neutron.setEnergy( 1e-7 );
+
+  FRENSIE_CHECK( !delta_tracking_region.isParticleDeltaTracked( neutron ) );
+
+  MonteCarlo::PhotonState photon( 1ull );
+  photon.embedInModel( *filled_model );
+  photon.setEnergy( 1e-3 );
+
+  FRENSIE_CHECK( !delta_tracking_region.isParticleDeltaTracked( photon ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a delta tracking region can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DeltaTrackingRegion,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_delta_tracking_region" );
+  std::ostringstream archive_ostream;
+
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.embedInModel( *filled_model );
+  neutron.setEnergy( 1e-6 );
+
+  double majorant_cross_section;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+    delta_tracking_region.setCells( *filled_model,
+                                    MonteCarlo::NEUTRON,
+                                    std::set<MonteCarlo::DeltaTrackingRegion::CellIdType>( {1} ),
+                                    1e-11, 20.0,
+                                    0 );
+
+    majorant_cross_section =
+      delta_tracking_region.getMajorantCrossSection( *filled_model, neutron );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( delta_tracking_region ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived delta tracking region
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::DeltaTrackingRegion delta_tracking_region;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( delta_tracking_region ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK( delta_tracking_region.hasDeltaTrackingCells( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK( delta_tracking_region.isDeltaTrackingCell( MonteCarlo::NEUTRON, 1 ) );
+  FRENSIE_CHECK( delta_tracking_region.isDeltaTrackingCellAtIndex( MonteCarlo::NEUTRON, filled_model->getCellIndex( 1 ) ) );
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMinEnergy( MonteCarlo::NEUTRON ), 1e-11 );
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMaxEnergy( MonteCarlo::NEUTRON ), 20.0 );
+  FRENSIE_CHECK_EQUAL( delta_tracking_region.getMajorantCrossSection( *filled_model, neutron ),
+                       majorant_cross_section );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& h_properties =
+      database.getAtomProperties( 1001 );
+
+    const Data::NuclideProperties& h1_properties =
+      database.getNuclideProperties( 1001 );
+
+    const Data::AtomProperties& o_properties =
+      database.getAtomProperties( 8016 );
+
+    const Data::NuclideProperties& o16_properties =
+      database.getNuclideProperties( 8016 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& h_definition =
+      scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+    h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointPhotoatomicDataProperties(
+          h_properties.getSharedAdjointPhotoatomicDataProperties(
+                Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setElectroatomicDataProperties(
+          h_properties.getSharedElectroatomicDataProperties(
+                     Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointElectroatomicDataProperties(
+          h_properties.getSharedAdjointElectroatomicDataProperties(
+              Data::AdjointElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setNuclearDataProperties(
+          h1_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    MonteCarlo::ScatteringCenterDefinition& o_definition =
+      scattering_center_definition_database->createDefinition( "O16 @ 293.6K", 8016 );
+
+    o_definition.setPhotoatomicDataProperties(
+          o_properties.getSharedPhotoatomicDataProperties(
+                         Data::PhotoatomicDataProperties::ACE_EPR_FILE, 12 ) );
+
+    o_definition.setElectroatomicDataProperties(
+          o_properties.getSharedElectroatomicDataProperties(
+                       Data::ElectroatomicDataProperties::ACE_EPR_FILE, 12 ) );
+
+    o_definition.setNuclearDataProperties(
+          o16_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    // Set the material definitions
+    material_definition_database->addDefinition(
+                                               "Water @ 293.6K", 1,
+                                               {"H1 @ 293.6K", "O16 @ 293.6K"},
+                                               {2.0,           1.0});
+
+    material_definition_database->addDefinition( "H1 @ 293.6K", 2,
+                                                 {"H1 @ 293.6K"}, {1.0} );
+
+    // Create the filled geometry model
+    std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+    filled_model.reset( new MonteCarlo::FilledGeometryModel(
+                                         test_scattering_center_database_name,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         unfilled_model,
+                                         true ) );
+
+    // Create the native filled geometry model - cell 1 (water) is the left
+    // half of the inner sphere, cell 2 (hydrogen) is the right half of the
+    // inner sphere, cell 3 (water) is the spherical shell and cell 4 is the
+    // termination cell
+    std::vector<Geometry::QuadricSurface> surfaces;
+
+    surfaces.push_back( Geometry::QuadricSurface::createSphere( 1, 0.0, 0.0, 0.0, 10.0 ) );
+    surfaces.push_back( Geometry::QuadricSurface::createXPlane( 2, 0.0 ) );
+    surfaces.push_back( Geometry::QuadricSurface::createSphere( 3, 0.0, 0.0, 0.0, 20.0 ) );
+
+    std::vector<Geometry::NativeCell> cells;
+
+    cells.push_back( Geometry::NativeCell( 1, "-1 -2", 1, -1.0/cubic_centimeter ) );
+    cells.push_back( Geometry::NativeCell( 2, "-1 2", 2, -0.5/cubic_centimeter ) );
+    cells.push_back( Geometry::NativeCell( 3, "1 -3", 1, -1.0/cubic_centimeter ) );
+    cells.push_back( Geometry::NativeCell( 4, "3" ) );
+    cells.back().setTermination();
+
+    std::shared_ptr<const Geometry::Model> native_model(
+                               new Geometry::NativeModel( surfaces, cells ) );
+
+    native_filled_model.reset( new MonteCarlo::FilledGeometryModel(
+                                         test_scattering_center_database_name,
+                                         scattering_center_definition_database,
+                                         material_definition_database,
+                                         properties,
+                                         native_model,
+                                         true ) );
+  }
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDeltaTrackingRegion.cpp
+//---------------------------------------------------------------------------//
@@ -975,6 +975,12 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_photon_mode )
       7.063503858378371303e-02,
       1e-15 );
 
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      filled_model.getMacroscopicTotalForwardCrossSectionQuickAtIndex<MonteCarlo::PhotonState>(
+                                 photon.getCellIndex(), photon.getEnergy() ),
+      7.063503858378371303e-02,
+      1e-15 );
+
     photon.setEnergy( 10.0 );
 
     FRENSIE_CHECK_FLOATING_EQUALITY(
@@ -1020,6 +1026,12 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_photon_mode )
                                       photon.getCell(), photon.getEnergy() ),
       2.213467312742279508e-02,
       1e-15 );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      filled_model.getMacroscopicTotalForwardCrossSectionQuickAtIndex<MonteCarlo::PhotonState>(
+                                 photon.getCellIndex(), photon.getEnergy() ),
+      2.213467312742279508e-02,
+      1e-15 );
   }
 
   // Check the electron cross sections
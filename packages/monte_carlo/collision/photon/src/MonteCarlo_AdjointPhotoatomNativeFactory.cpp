@@ -72,7 +72,8 @@ void AdjointPhotoatomNativeFactory::createAdjointPhotoatomCore(
                                incoherent_reactions,
                                properties.getIncoherentAdjointModelType(),
                                properties.getAdjointKleinNishinaSamplingType(),
-                               critical_line_energies );
+                               critical_line_energies,
+                               properties.getAdjointIntegratedCrossSectionTableTolerance() );
 
     for( size_t i = 0; i < incoherent_reactions.size(); ++i )
     {
@@ -90,7 +91,8 @@ void AdjointPhotoatomNativeFactory::createAdjointPhotoatomCore(
                                                     raw_adjoint_photoatom_data,
                                                     energy_grid,
                                                     grid_searcher,
-                                                    reaction_pointer );
+                                                    reaction_pointer,
+                   properties.getAdjointIntegratedCrossSectionTableTolerance() );
   }
 
   // Create the line energy reactions
@@ -70,7 +70,8 @@ void AdjointPhotoatomicReactionNativeFactory::createIncoherentReactions(
     incoherent_adjoint_reactions,
     const IncoherentAdjointModelType incoherent_adjoint_model,
     const AdjointKleinNishinaSamplingType adjoint_kn_sampling,
-    const std::shared_ptr<const std::vector<double> >& critical_line_energies )
+    const std::shared_ptr<const std::vector<double> >& critical_line_energies,
+    const double integrated_cs_table_tolerance )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_adjoint_photoatom_data.getAdjointPhotonEnergyGrid().size() >=
@@ -111,6 +112,13 @@ void AdjointPhotoatomicReactionNativeFactory::createIncoherentReactions(
                                                     adjoint_kn_sampling,
                                                     energy_grid->back() );
 
+    if( integrated_cs_table_tolerance > 0.0 )
+    {
+      distribution->tabulateIntegratedCrossSection(
+                                               energy_grid->front(),
+                                               integrated_cs_table_tolerance );
+    }
+
     // Create the incoherent adjoint reaction
     std::shared_ptr<IncoherentAdjointPhotoatomicReaction<Utility::LinLin,false> >
       incoherent_adjoint_reaction(
@@ -281,7 +289,8 @@ void AdjointPhotoatomicReactionNativeFactory::createCoherentReaction(
       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
       grid_searcher,
       std::shared_ptr<const AdjointPhotoatomicReaction>&
-      coherent_adjoint_reaction )
+      coherent_adjoint_reaction,
+      const double integrated_cs_table_tolerance )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_adjoint_photoatom_data.getAdjointPhotonEnergyGrid().size() >=
@@ -304,8 +313,11 @@ void AdjointPhotoatomicReactionNativeFactory::createCoherentReaction(
   std::shared_ptr<const CoherentScatteringDistribution> coherent_distribution;
 
   CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
-                                                    raw_adjoint_photoatom_data,
-                                                    coherent_distribution );
+                                               raw_adjoint_photoatom_data,
+                                               coherent_distribution,
+                                               energy_grid->front(),
+                                               energy_grid->back(),
+                                               integrated_cs_table_tolerance );
 
   // Create the coherent adjoint reaction
   coherent_adjoint_reaction.reset(
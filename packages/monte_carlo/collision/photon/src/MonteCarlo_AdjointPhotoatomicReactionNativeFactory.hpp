@@ -55,7 +55,8 @@ public:
          const IncoherentAdjointModelType incoherent_adjoint_model,
          const AdjointKleinNishinaSamplingType adjoint_kn_sampling,
          const std::shared_ptr<const std::vector<double> >&
-         critical_line_energies );
+         critical_line_energies,
+         const double integrated_cs_table_tolerance = 0.0 );
 
   //! Create the coherent adjoint photoatomic reaction
   static void createCoherentReaction(
@@ -65,7 +66,8 @@ public:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher,
           std::shared_ptr<const AdjointPhotoatomicReaction>&
-          coherent_adjoint_reaction );
+          coherent_adjoint_reaction,
+          const double integrated_cs_table_tolerance = 0.0 );
 
   //! Create the pair production adjoint photoatomic reaction
   static void createPairProductionReaction(
@@ -64,6 +64,12 @@ public:
 	      ParticleBank& bank,
 	      Data::SubshellType& shell_of_interaction ) const override;
 
+  //! Evaluate the pdf of the scattering angle cosine of the outgoing photon
+  double evaluateScatteringAngleCosinePDF(
+                           const double incoming_energy,
+                           const double scattering_angle_cosine,
+                           double& outgoing_energy ) const override;
+
 private:
 
   // The coherent scattering distribution
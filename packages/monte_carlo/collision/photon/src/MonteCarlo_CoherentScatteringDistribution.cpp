@@ -68,7 +68,7 @@ double CoherentScatteringDistribution::evaluatePDF(
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
   return this->evaluate( incoming_energy, scattering_angle_cosine )/
-    this->evaluateIntegratedCrossSection( incoming_energy, 1e-3 );
+    this->evaluatePDFNormalizationConstant( incoming_energy );
 }
 
 // Evaluate the integrated cross section (b)
@@ -38,6 +38,16 @@ public:
                                 SmartPtr<const CoherentScatteringDistribution>&
                                 coherent_distribution );
 
+  //! Create an efficient coherent distribution with an integrated cs table
+  template<typename NativeContainer, template<typename> class SmartPtr>
+  static void createEfficientCoherentDistribution(
+                                const NativeContainer& raw_photoatom_data,
+                                SmartPtr<const CoherentScatteringDistribution>&
+                                coherent_distribution,
+                                const double min_table_energy,
+                                const double max_table_energy,
+                                const double integrated_cs_table_tolerance );
+
 protected:
 
   //! Create the form factor squared distribution
@@ -55,6 +55,49 @@ void CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistrib
 	  new EfficientCoherentScatteringDistribution( form_factor_squared ) );
 }
 
+// Create an efficient coherent distribution with an integrated cs table
+/*! \details The integrated cross section table will be used to normalize
+ * the PDF at incoming energies in [min_table_energy,max_table_energy]. A
+ * tolerance of zero indicates that no table should be constructed.
+ */
+template<typename NativeContainer, template<typename> class SmartPtr>
+void CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
+                                const NativeContainer& raw_photoatom_data,
+	                        SmartPtr<const CoherentScatteringDistribution>&
+                                coherent_distribution,
+                                const double min_table_energy,
+                                const double max_table_energy,
+                                const double integrated_cs_table_tolerance )
+{
+  // Make sure the table energies are valid
+  testPrecondition( min_table_energy > 0.0 );
+  testPrecondition( min_table_energy < max_table_energy );
+  // Make sure the tolerance is valid
+  testPrecondition( integrated_cs_table_tolerance >= 0.0 );
+  testPrecondition( integrated_cs_table_tolerance < 1.0 );
+
+  // Create the form factor squared
+  std::shared_ptr<const FormFactorSquared> form_factor_squared;
+
+  CoherentScatteringDistributionNativeFactory::createFormFactorSquared(
+							 raw_photoatom_data,
+							 form_factor_squared );
+
+  std::shared_ptr<EfficientCoherentScatteringDistribution>
+    efficient_distribution(
+	  new EfficientCoherentScatteringDistribution( form_factor_squared ) );
+
+  if( integrated_cs_table_tolerance > 0.0 )
+  {
+    efficient_distribution->tabulateIntegratedCrossSection(
+                                               min_table_energy,
+                                               max_table_energy,
+                                               integrated_cs_table_tolerance );
+  }
+
+  coherent_distribution = efficient_distribution;
+}
+
 // Create the form factor distribution
 template<typename NativeContainer, template<typename> class SmartPtr>
 void CoherentScatteringDistributionNativeFactory::createFormFactorSquared(
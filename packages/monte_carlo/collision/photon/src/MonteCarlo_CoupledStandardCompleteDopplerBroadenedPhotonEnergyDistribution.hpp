@@ -15,6 +15,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_StandardCompleteDopplerBroadenedPhotonEnergyDistribution.hpp"
 #include "MonteCarlo_ComptonProfileSubshellConverter.hpp"
+#include "MonteCarlo_SubshellInteractionSamplingTable.hpp"
 #include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
@@ -45,8 +46,9 @@ protected:
   //! Return the binding energy of a subshell
   double getSubshellBindingEnergy( const Data::SubshellType subshell ) const;
 
-  //! Sample an interaction subshell
-  void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell that is accessible at the energy
+  bool sampleInteractionSubshell( const double incoming_energy,
+                                  size_t& old_subshell_index,
                                   double& subshell_binding_energy,
                                   Data::SubshellType& subshell ) const override;
 
@@ -54,6 +56,10 @@ private:
 
   // The endf subshell binding energies
   std::vector<double> d_subshell_binding_energies;
+
+  // The endf subshell interaction sampling table
+  std::unique_ptr<const SubshellInteractionSamplingTable>
+  d_subshell_sampling_table;
 };
 
 } // end MonteCarlo namespace
@@ -33,7 +33,8 @@ CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePo
                                                 subshell_order,
                                                 subshell_converter,
                                                 compton_profile_array ),
-    d_subshell_binding_energies( subshell_binding_energies )
+    d_subshell_binding_energies( subshell_binding_energies ),
+    d_subshell_sampling_table()
 {
   // Make sure the shell interaction data is valid
   testPrecondition( subshell_occupancies.size() > 0 );
@@ -41,6 +42,11 @@ CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePo
 		    subshell_occupancies.size() );
   testPrecondition( subshell_binding_energies.size() ==
 		    subshell_occupancies.size() );
+
+  // Create the subshell interaction sampling table
+  d_subshell_sampling_table.reset(
+                 new SubshellInteractionSamplingTable( subshell_binding_energies,
+                                                       subshell_occupancies ) );
 }
 
 // Return the binding energy of a subshell
@@ -56,21 +62,31 @@ double CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonPr
   return d_subshell_binding_energies[endf_subshell_index];
 }
 
-// Sample an interaction subshell
+// Sample an interaction subshell that is accessible at the energy
 /*! \details The old subshell index used to select the Compton profile and
  * and the binding energy is the same as the subshell (i.e. they are coupled).
+ * False will be returned if no subshell is accessible at the energy.
  */
 template<typename ComptonProfilePolicy>
-void CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+bool CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+                                               const double incoming_energy,
                                                size_t& old_subshell_index,
                                                double& subshell_binding_energy,
                                                Data::SubshellType& subshell ) const
 {
-  subshell = this->sampleENDFInteractionSubshell();
+  size_t endf_subshell_index;
+
+  if( !d_subshell_sampling_table->sample( incoming_energy,
+                                          endf_subshell_index ) )
+    return false;
+
+  subshell = this->getSubshell( endf_subshell_index );
 
   subshell_binding_energy = this->getSubshellBindingEnergy( subshell );
 
   old_subshell_index = this->getOldSubshellIndex( subshell );
+
+  return true;
 }
 
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( CoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<FullComptonProfilePolicy> );
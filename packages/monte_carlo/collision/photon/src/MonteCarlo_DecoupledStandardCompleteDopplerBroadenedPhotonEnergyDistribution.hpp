@@ -16,7 +16,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_StandardCompleteDopplerBroadenedPhotonEnergyDistribution.hpp"
 #include "MonteCarlo_ComptonProfileSubshellConverter.hpp"
-#include "Utility_TabularUnivariateDistribution.hpp"
+#include "MonteCarlo_SubshellInteractionSamplingTable.hpp"
 #include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
@@ -73,19 +73,21 @@ public:
 
 protected:
 
-  //! Sample an interaction subshell
-  void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell that is accessible at the energy
+  bool sampleInteractionSubshell( const double incoming_energy,
+                                  size_t& old_subshell_index,
                                   double& subshell_binding_energy,
                                   Data::SubshellType& subshell ) const override;
 
 private:
 
   // Sample the old subshell that is interacted with
-  size_t sampleOldInteractionSubshell() const;
+  bool sampleOldInteractionSubshell( const double incoming_energy,
+                                     size_t& old_subshell_index ) const;
 
-  // The old subshell interaction probabilities
-  std::unique_ptr<const Utility::TabularUnivariateDistribution>
-  d_old_subshell_occupancy_distribution;
+  // The old subshell interaction sampling table
+  std::unique_ptr<const SubshellInteractionSamplingTable>
+  d_old_subshell_sampling_table;
 
   // The old subshell binding energies
   std::vector<double> d_old_subshell_binding_energy;
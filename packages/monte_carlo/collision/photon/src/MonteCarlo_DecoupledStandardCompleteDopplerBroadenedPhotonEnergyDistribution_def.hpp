@@ -46,7 +46,7 @@ DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfile
                                                      endf_subshell_order,
                                                      subshell_converter,
                                                      compton_profile_array ),
-  d_old_subshell_occupancy_distribution(),
+  d_old_subshell_sampling_table(),
   d_old_subshell_binding_energy( old_subshell_binding_energies ),
   d_old_subshell_occupancies( old_subshell_occupancies ),
   d_min_binding_energy_index( 0 )
@@ -59,12 +59,10 @@ DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfile
   testPrecondition( compton_profile_array.size() ==
 		    old_subshell_binding_energies.size() );
 
-  // Create the old subshell interaction distribution
-  std::vector<double> dummy_indep_vals( old_subshell_occupancies.size() );
-
-  d_old_subshell_occupancy_distribution.reset(
-	       new Utility::DiscreteDistribution( dummy_indep_vals,
-					          old_subshell_occupancies ) );
+  // Create the old subshell interaction sampling table
+  d_old_subshell_sampling_table.reset(
+        new SubshellInteractionSamplingTable( old_subshell_binding_energies,
+                                              old_subshell_occupancies ) );
 
   // Calculate the min binding energy index
   std::vector<double>::iterator min_binding_energy_it =
@@ -363,34 +361,39 @@ double DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<Compton
   return diff_cs;
 }
 
-// Sample an interaction subshell
+// Sample an interaction subshell that is accessible at the energy
 /*! \details The old subshell index used to select the Compton profile and
  * and the binding energy is not the same as the subshell (each are sampled
- * separately - i.e. they are decoupled).
+ * separately - i.e. they are decoupled). Only the old subshell is restricted
+ * to the subshells that are accessible at the incoming energy. False will be
+ * returned if no old subshell is accessible at the energy.
  */
 template<typename ComptonProfilePolicy>
-void DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+bool DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleInteractionSubshell(
+                                           const double incoming_energy,
                                            size_t& old_subshell_index,
                                            double& subshell_binding_energy,
                                            Data::SubshellType& subshell ) const
 {
-  old_subshell_index = this->sampleOldInteractionSubshell();
+  if( !this->sampleOldInteractionSubshell( incoming_energy,
+                                           old_subshell_index ) )
+    return false;
 
   subshell_binding_energy = d_old_subshell_binding_energy[old_subshell_index];
 
   subshell = this->sampleENDFInteractionSubshell();
+
+  return true;
 }
 
 // Sample the old subshell that is interacted with
 template<typename ComptonProfilePolicy>
-size_t DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleOldInteractionSubshell() const
+bool DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleOldInteractionSubshell(
+                                          const double incoming_energy,
+                                          size_t& old_subshell_index ) const
 {
-  size_t old_subshell_of_interaction;
-
-  d_old_subshell_occupancy_distribution->sampleAndRecordBinIndex(
-                                                 old_subshell_of_interaction );
-
-  return old_subshell_of_interaction;
+  return d_old_subshell_sampling_table->sample( incoming_energy,
+                                                old_subshell_index );
 }
 
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( DecoupledStandardCompleteDopplerBroadenedPhotonEnergyDistribution<FullComptonProfilePolicy> );
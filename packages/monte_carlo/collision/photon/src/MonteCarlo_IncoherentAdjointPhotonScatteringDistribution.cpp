@@ -34,6 +34,7 @@ IncoherentAdjointPhotonScatteringDistribution::IncoherentAdjointPhotonScattering
                                                   std::placeholders::_1,
                                                   std::placeholders::_2,
                                                   std::placeholders::_3 ) ),
+    d_integrated_cs_table(),
     d_klein_nishina_sampling_method()
 {
   // Make sure the max energy is valid
@@ -105,6 +106,9 @@ void IncoherentAdjointPhotonScatteringDistribution::setMaxEnergy(
   testPrecondition( max_energy > 0.0 );
 
   d_max_energy = max_energy;
+
+  // The table is only valid at the previous max energy
+  d_integrated_cs_table.reset();
 }
 
 // Return the max energy
@@ -152,7 +156,8 @@ double IncoherentAdjointPhotonScatteringDistribution::evaluatePDF(
 
   if( diff_cs > 0.0 )
   {
-    return diff_cs/this->evaluateIntegratedCrossSection( incoming_energy, max_energy, 1e-3 );
+    return diff_cs/this->evaluatePDFNormalizationConstant( incoming_energy,
+                                                           max_energy );
   }
   else
     return 0.0;
@@ -187,6 +192,9 @@ void IncoherentAdjointPhotonScatteringDistribution::setExternalIntegratedCrossSe
                                     integrated_cs_evaluator )
 {
   d_integrated_cs_evaluator = integrated_cs_evaluator;
+
+  // The table was generated with the previous evaluator
+  d_integrated_cs_table.reset();
 }
 
 // Unset the integrated cross section evaluator
@@ -197,6 +205,47 @@ void IncoherentAdjointPhotonScatteringDistribution::unsetExternalIntegratedCross
                                                  std::placeholders::_1,
                                                  std::placeholders::_2,
                                                  std::placeholders::_3 );
+
+  // The table was generated with the previous evaluator
+  d_integrated_cs_table.reset();
+}
+
+// Tabulate the integrated cross section (at the max energy)
+/*! \details Once the integrated cross section has been tabulated, the
+ * integrated cross section at the max energy will be interpolated from the
+ * table instead of being calculated with the integrated cross section
+ * evaluator for every incoming energy in [min_energy,max_energy]. The table
+ * will be discarded if the max energy or the evaluator is changed.
+ */
+void IncoherentAdjointPhotonScatteringDistribution::tabulateIntegratedCrossSection(
+                                                 const double min_energy,
+                                                 const double convergence_tol )
+{
+  // Make sure the min energy is valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < d_max_energy );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol < 1.0 );
+
+  const double max_energy = d_max_energy;
+  const double precision = 0.1*convergence_tol;
+
+  d_integrated_cs_table.reset( new IntegratedCrossSectionTable(
+             [this, max_energy, precision]( const double incoming_energy ){
+               return d_integrated_cs_evaluator( incoming_energy,
+                                                 max_energy,
+                                                 precision );
+             },
+             min_energy,
+             max_energy,
+             convergence_tol ) );
+}
+
+// Check if the integrated cross section has been tabulated
+bool IncoherentAdjointPhotonScatteringDistribution::isIntegratedCrossSectionTabulated() const
+{
+  return d_integrated_cs_table.get() != NULL;
 }
 
 // Evaluate the integrated cross section (b)
@@ -208,6 +257,27 @@ double IncoherentAdjointPhotonScatteringDistribution::evaluateIntegratedCrossSec
   return d_integrated_cs_evaluator( incoming_energy, max_energy, precision );
 }
 
+// Evaluate the integrated cross section used to normalize the pdf (b)
+/*! \details The integrated cross section evaluator will only be used if the
+ * integrated cross section has not been tabulated, if the max energy is not
+ * the max energy of the table or if the incoming energy is outside of the
+ * table.
+ */
+double IncoherentAdjointPhotonScatteringDistribution::evaluatePDFNormalizationConstant(
+                                         const double incoming_energy,
+                                         const double max_energy ) const
+{
+  if( d_integrated_cs_table && max_energy == d_max_energy )
+  {
+    if( d_integrated_cs_table->isEnergyInTable( incoming_energy ) )
+      return d_integrated_cs_table->evaluate( incoming_energy );
+  }
+  
+  return this->evaluateIntegratedCrossSection( incoming_energy,
+                                               max_energy,
+                                               1e-3 );
+}
+
 // Evaluate the integrated cross section (b)
 double IncoherentAdjointPhotonScatteringDistribution::evaluateIntegratedCrossSection(
 					         const double incoming_energy,
@@ -15,6 +15,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_AdjointPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_AdjointKleinNishinaSamplingType.hpp"
+#include "MonteCarlo_IntegratedCrossSectionTable.hpp"
 #include "Utility_TabularUnivariateDistribution.hpp"
 #include "Utility_Vector.hpp"
 
@@ -84,6 +85,13 @@ public:
   //! Unset the integrated cross section evaluator
   void unsetExternalIntegratedCrossSectionEvaluator();
 
+  //! Tabulate the integrated cross section (at the max energy)
+  void tabulateIntegratedCrossSection( const double min_energy,
+                                       const double convergence_tol = 1e-3 );
+
+  //! Check if the integrated cross section has been tabulated
+  bool isIntegratedCrossSectionTabulated() const;
+
   //! Evaluate the integrated cross section (b)
   double evaluateIntegratedCrossSection( const double incoming_energy,
                                          const double max_energy,
@@ -145,6 +153,10 @@ protected:
 
 private:
 
+  // Evaluate the integrated cross section used to normalize the pdf (b)
+  double evaluatePDFNormalizationConstant( const double incoming_energy,
+                                           const double max_energy ) const;
+
   // Basic sampling implementation
   void sampleAndRecordTrialsAdjointKleinNishinaTwoBranch(
 					       const double incoming_energy,
@@ -175,6 +187,9 @@ private:
   // The integrated cross section evaluator
   std::function<double(double,double,double)> d_integrated_cs_evaluator;
 
+  // The integrated cross section table (at the max energy)
+  std::shared_ptr<const IntegratedCrossSectionTable> d_integrated_cs_table;
+
   // The klein-nishina sampling method
   std::function<void(const double,double&,double&,Counter&)> d_klein_nishina_sampling_method;
 };
@@ -10,6 +10,7 @@
 #define MONTE_CARLO_INCOHERENT_PHOTOATOMIC_REACTION_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_PhotonKinematicsHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -103,6 +104,23 @@ void IncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::react(
   photon.incrementCollisionNumber();
 }
 
+// Evaluate the pdf of the scattering angle cosine of the outgoing photon
+/*! \details The outgoing energy will be set to the Compton line energy
+ * (Doppler broadening is ignored).
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double IncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateScatteringAngleCosinePDF(
+                                     const double incoming_energy,
+                                     const double scattering_angle_cosine,
+                                     double& outgoing_energy ) const
+{
+  outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+                                                scattering_angle_cosine );
+
+  return d_scattering_distribution->evaluatePDF( incoming_energy,
+                                                 scattering_angle_cosine );
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( IncoherentPhotoatomicReaction<Utility::LinLin,false> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( IncoherentPhotoatomicReaction<Utility::LinLin,true> );
 
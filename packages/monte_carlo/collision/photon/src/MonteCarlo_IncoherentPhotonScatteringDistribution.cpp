@@ -47,7 +47,7 @@ double IncoherentPhotonScatteringDistribution::evaluatePDF(
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
   return this->evaluate( incoming_energy, scattering_angle_cosine )/
-    this->evaluateIntegratedCrossSection( incoming_energy, 1e-3 );
+    this->evaluatePDFNormalizationConstant( incoming_energy );
 }
 
 // Evaluate the Klein-Nishina distribution
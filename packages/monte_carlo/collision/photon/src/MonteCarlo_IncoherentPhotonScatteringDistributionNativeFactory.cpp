@@ -26,13 +26,23 @@
 namespace MonteCarlo{
 
 // Create an incoherent distribution
+/*! \details The tabular sampling flag is only used by the Waller-Hartree
+ * and Doppler broadened hybrid models. The incoming energy range of the
+ * sampling table is bounded above by the Kahn sampling cutoff energy (above
+ * it Koblinger's method is used and the scattering function rejection
+ * efficiency is close to one). The integrated cross section table tolerance
+ * is also only used by these two models - a value of zero indicates that
+ * the PDF normalization constants will be calculated with quadrature.
+ */
 void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
 	 const IncoherentModelType incoherent_model,
 	 const double kahn_sampling_cutoff_energy,
-	 const unsigned endf_subshell )
+	 const unsigned endf_subshell,
+	 const bool use_tabular_sampling,
+	 const double integrated_cs_table_tolerance )
 {
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
@@ -52,7 +62,9 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
       IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDistribution(
 						 raw_photoatom_data,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 use_tabular_sampling,
+						 integrated_cs_table_tolerance );
       break;
     }
     case COUPLED_FULL_PROFILE_DB_HYBRID_INCOHERENT_MODEL:
@@ -68,7 +80,9 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDistribution(
 						 raw_photoatom_data,
 						 doppler_broadened_dist,
 						 incoherent_distribution,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 use_tabular_sampling,
+						 integrated_cs_table_tolerance );
       break;
     }
     case IMPULSE_INCOHERENT_MODEL:
@@ -112,7 +126,9 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDis
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
-	 const double kahn_sampling_cutoff_energy )
+	 const double kahn_sampling_cutoff_energy,
+	 const bool use_tabular_sampling,
+	 const double integrated_cs_table_tolerance )
 {
   // Make sure the cutoff energy is valid
   testPrecondition( kahn_sampling_cutoff_energy >=
@@ -145,12 +161,30 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createWallerHartreeDis
     ++subshell_it;
   }
 
-  incoherent_distribution.reset(
+  std::shared_ptr<DetailedWHIncoherentPhotonScatteringDistribution>
+    detailed_wh_distribution(
 			 new DetailedWHIncoherentPhotonScatteringDistribution(
 					       scattering_function,
 					       occupancy_numbers,
 					       subshell_order,
 					       kahn_sampling_cutoff_energy ) );
+
+  if( use_tabular_sampling )
+  {
+    detailed_wh_distribution->constructSamplingTable(
+                        raw_photoatom_data.getPhotonEnergyGrid().front(),
+                        kahn_sampling_cutoff_energy );
+  }
+
+  if( integrated_cs_table_tolerance > 0.0 )
+  {
+    detailed_wh_distribution->tabulateIntegratedCrossSection(
+                        raw_photoatom_data.getPhotonEnergyGrid().front(),
+                        raw_photoatom_data.getPhotonEnergyGrid().back(),
+                        integrated_cs_table_tolerance );
+  }
+
+  incoherent_distribution = detailed_wh_distribution;
 }
 
 // Create a Doppler broadened hybrid incoherent distribution
@@ -160,7 +194,9 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDopplerBroadened
     doppler_broadened_dist,
     std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
     incoherent_distribution,
-    const double kahn_sampling_cutoff_energy )
+    const double kahn_sampling_cutoff_energy,
+    const bool use_tabular_sampling,
+    const double integrated_cs_table_tolerance )
 {
   // Make sure the Doppler broadened distribution is valid
   testPrecondition( doppler_broadened_dist.get() );
@@ -175,11 +211,29 @@ void IncoherentPhotonScatteringDistributionNativeFactory::createDopplerBroadened
 							 raw_photoatom_data,
 							 scattering_function );
 
-  incoherent_distribution.reset(
+  std::shared_ptr<DopplerBroadenedHybridIncoherentPhotonScatteringDistribution>
+    hybrid_distribution(
 	      new DopplerBroadenedHybridIncoherentPhotonScatteringDistribution(
 					       scattering_function,
 					       doppler_broadened_dist,
 					       kahn_sampling_cutoff_energy ) );
+
+  if( use_tabular_sampling )
+  {
+    hybrid_distribution->constructSamplingTable(
+                        raw_photoatom_data.getPhotonEnergyGrid().front(),
+                        kahn_sampling_cutoff_energy );
+  }
+
+  if( integrated_cs_table_tolerance > 0.0 )
+  {
+    hybrid_distribution->tabulateIntegratedCrossSection(
+                        raw_photoatom_data.getPhotonEnergyGrid().front(),
+                        raw_photoatom_data.getPhotonEnergyGrid().back(),
+                        integrated_cs_table_tolerance );
+  }
+
+  incoherent_distribution = hybrid_distribution;
 }
 
 
@@ -38,7 +38,9 @@ public:
 	 incoherent_distribution,
 	 const IncoherentModelType incoherent_model,
 	 const double kahn_sampling_cutoff_energy,
-	 const unsigned endf_subshell = 0u );
+	 const unsigned endf_subshell = 0u,
+	 const bool use_tabular_sampling = false,
+	 const double integrated_cs_table_tolerance = 0.0 );
 
 protected:
 
@@ -47,7 +49,9 @@ protected:
 	 const Data::ElectronPhotonRelaxationDataContainer& raw_photoatom_data,
 	 std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
 	 incoherent_distribution,
-	 const double kahn_sampling_cutoff_energy );
+	 const double kahn_sampling_cutoff_energy,
+	 const bool use_tabular_sampling = false,
+	 const double integrated_cs_table_tolerance = 0.0 );
 
   //! Create a Doppler broadened hybrid incoherent distribution
   static void createDopplerBroadenedHybridDistribution(
@@ -56,7 +60,9 @@ protected:
     doppler_broadened_dist,
     std::shared_ptr<const IncoherentPhotonScatteringDistribution>&
     incoherent_distribution,
-    const double kahn_sampling_cutoff_energy );
+    const double kahn_sampling_cutoff_energy,
+    const bool use_tabular_sampling = false,
+    const double integrated_cs_table_tolerance = 0.0 );
 
   //! Create a subshell incoherent distribution
   static void createSubshellDistribution(
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_IntegratedCrossSectionTable.cpp
+//! \author Alex Robinson
+//! \brief  The integrated cross section table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_IntegratedCrossSectionTable.hpp"
+#include "Utility_GridGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The initial grid has energies_per_decade log spaced energies
+ * per decade. Each interval is then refined until the lin-lin interpolated
+ * integrated cross section at the interval midpoint is within the
+ * convergence tolerance of the evaluated integrated cross section.
+ */
+IntegratedCrossSectionTable::IntegratedCrossSectionTable(
+             const IntegratedCrossSectionEvaluator& integrated_cs_evaluator,
+             const double min_energy,
+             const double max_energy,
+             const double convergence_tol,
+             const unsigned energies_per_decade )
+  : d_energy_grid(),
+    d_integrated_cross_section()
+{
+  // Make sure the evaluator is valid
+  testPrecondition( integrated_cs_evaluator );
+  // Make sure the energy range is valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( max_energy > min_energy );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol < 1.0 );
+  // Make sure the number of energies per decade is valid
+  testPrecondition( energies_per_decade > 0 );
+
+  // Create the initial log spaced energy grid
+  const unsigned number_of_energies = 1u +
+    std::max( (unsigned)std::ceil( energies_per_decade*
+                                   std::log10( max_energy/min_energy ) ),
+              1u );
+
+  d_energy_grid.resize( number_of_energies );
+
+  const double log_energy_step =
+    std::log( max_energy/min_energy )/(number_of_energies - 1);
+
+  for( unsigned i = 0; i < number_of_energies; ++i )
+    d_energy_grid[i] = min_energy*std::exp( i*log_energy_step );
+
+  d_energy_grid.front() = min_energy;
+  d_energy_grid.back() = max_energy;
+
+  // Refine the grid
+  Utility::GridGenerator<Utility::LinLin>
+    grid_generator( convergence_tol, 1e-12, 1e-14 );
+
+  grid_generator.generateAndEvaluateInPlace( d_energy_grid,
+                                             d_integrated_cross_section,
+                                             integrated_cs_evaluator );
+
+  // Make sure the table was generated
+  testPostcondition( d_energy_grid.size() ==
+                     d_integrated_cross_section.size() );
+}
+
+// Return the min energy of the table
+double IntegratedCrossSectionTable::getMinEnergy() const
+{
+  return d_energy_grid.front();
+}
+
+// Return the max energy of the table
+double IntegratedCrossSectionTable::getMaxEnergy() const
+{
+  return d_energy_grid.back();
+}
+
+// Return the number of energies in the table
+size_t IntegratedCrossSectionTable::getNumberOfEnergies() const
+{
+  return d_energy_grid.size();
+}
+
+// Check if an energy is in the table
+bool IntegratedCrossSectionTable::isEnergyInTable(
+                                          const double incoming_energy ) const
+{
+  return incoming_energy >= d_energy_grid.front() &&
+    incoming_energy <= d_energy_grid.back();
+}
+
+// Evaluate the integrated cross section (b)
+double IntegratedCrossSectionTable::evaluate(
+                                          const double incoming_energy ) const
+{
+  // Make sure the energy is in the table
+  testPrecondition( this->isEnergyInTable( incoming_energy ) );
+
+  if( incoming_energy == d_energy_grid.back() )
+    return d_integrated_cross_section.back();
+
+  const size_t lower_index =
+    Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+                                            d_energy_grid.end(),
+                                            incoming_energy );
+
+  return Utility::LinLin::interpolate( d_energy_grid[lower_index],
+                                       d_energy_grid[lower_index+1],
+                                       incoming_energy,
+                                       d_integrated_cross_section[lower_index],
+                                       d_integrated_cross_section[lower_index+1] );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_IntegratedCrossSectionTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_IntegratedCrossSectionTable.hpp
+//! \author Alex Robinson
+//! \brief  The integrated cross section table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_INTEGRATED_CROSS_SECTION_TABLE_HPP
+#define MONTE_CARLO_INTEGRATED_CROSS_SECTION_TABLE_HPP
+
+// Std Lib Includes
+#include <functional>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The integrated cross section table
+ * \details The scattering distributions normalize their differential cross
+ * sections with an integrated cross section that is calculated by
+ * adaptive quadrature. This table stores the integrated cross section on an
+ * incoming energy grid that is generated with the grid generator (starting
+ * from a log spaced grid) so that the integrated cross section can be
+ * evaluated with a single lin-lin interpolation.
+ */
+class IntegratedCrossSectionTable
+{
+
+public:
+
+  //! The integrated cross section evaluator type
+  typedef std::function<double(double)> IntegratedCrossSectionEvaluator;
+
+  //! Constructor
+  IntegratedCrossSectionTable(
+             const IntegratedCrossSectionEvaluator& integrated_cs_evaluator,
+             const double min_energy,
+             const double max_energy,
+             const double convergence_tol = 1e-3,
+             const unsigned energies_per_decade = 10 );
+
+  //! Destructor
+  ~IntegratedCrossSectionTable()
+  { /* ... */ }
+
+  //! Return the min energy of the table
+  double getMinEnergy() const;
+
+  //! Return the max energy of the table
+  double getMaxEnergy() const;
+
+  //! Return the number of energies in the table
+  size_t getNumberOfEnergies() const;
+
+  //! Check if an energy is in the table
+  bool isEnergyInTable( const double incoming_energy ) const;
+
+  //! Evaluate the integrated cross section (b)
+  double evaluate( const double incoming_energy ) const;
+
+private:
+
+  // The incoming energy grid
+  std::vector<double> d_energy_grid;
+
+  // The integrated cross section (b) at each incoming energy
+  std::vector<double> d_integrated_cross_section;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_INTEGRATED_CROSS_SECTION_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_IntegratedCrossSectionTable.hpp
+//---------------------------------------------------------------------------//
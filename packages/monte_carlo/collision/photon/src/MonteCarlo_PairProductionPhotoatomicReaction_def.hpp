@@ -130,6 +130,27 @@ void PairProductionPhotoatomicReaction<InterpPolicy,processed_cross_section>::re
   shell_of_interaction = Data::UNKNOWN_SUBSHELL;
 }
 
+// Evaluate the pdf of the scattering angle cosine of the outgoing photon
+/*! \details With the basic model the incoming photon becomes one of the two
+ * annihilation photons, which are emitted isotropically with the electron
+ * rest mass energy (the second annihilation photon is banked). With the
+ * detailed model the positron is banked (the annihilation photons are not
+ * emitted by this reaction) and zero will be returned.
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double PairProductionPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateScatteringAngleCosinePDF(
+                                     const double incoming_energy,
+                                     const double scattering_angle_cosine,
+                                     double& outgoing_energy ) const
+{
+  if( d_detailed_electron_emission_model )
+    return 0.0;
+
+  outgoing_energy = Utility::PhysicalConstants::electron_rest_mass_energy;
+
+  return 0.5;
+}
+
 // The basic pair production model
 /*! \details Simplified Model: Assume that the outgoing electron is emitted at
  * the mean emission angle (theta_mean = m_e*c^2/E_mean), w.r.t the original
@@ -6,9 +6,11 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_Photoatom.hpp"
-#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -46,6 +48,65 @@ double Photoatom::getReactionCrossSection(
   }
 }
 
+// Evaluate the scattering angle cosine pdfs of the scattering reactions
+/*! \details The pdf of the outgoing photon scattering angle cosine of each
+ * scattering reaction will be multiplied by the probability that a collision
+ * with the atom is that reaction (sigma_r/sigma_t) and appended to the pdf
+ * array along with the outgoing energy of the reaction. The sum of the
+ * appended pdfs is the pdf of a photon leaving a collision with the atom at
+ * the scattering angle cosine. No random numbers are used. This is used by
+ * next-event estimators to score collision contributions.
+ */
+void Photoatom::evaluateScatteringAngleCosinePDF(
+                                  const double energy,
+                                  const double scattering_angle_cosine,
+                                  ScatteringAngleCosinePDFArray& pdfs ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  const double total_cross_section = this->getTotalCrossSection( energy );
+
+  if( total_cross_section <= 0.0 )
+    return;
+
+  const ConstReactionMap& scattering_reactions =
+    this->getCore().getScatteringReactions();
+
+  ConstReactionMap::const_iterator photoatomic_reaction =
+    scattering_reactions.begin();
+
+  while( photoatomic_reaction != scattering_reactions.end() )
+  {
+    const double reaction_cross_section =
+      photoatomic_reaction->second->getCrossSection( energy );
+
+    if( reaction_cross_section > 0.0 )
+    {
+      double outgoing_energy = energy;
+
+      const double pdf =
+        photoatomic_reaction->second->evaluateScatteringAngleCosinePDF(
+                                                       energy,
+                                                       scattering_angle_cosine,
+                                                       outgoing_energy );
+
+      if( pdf > 0.0 && outgoing_energy > 0.0 )
+      {
+        pdfs.push_back( std::make_pair(
+                          std::min( reaction_cross_section/total_cross_section,
+                                    1.0 )*pdf,
+                          outgoing_energy ) );
+      }
+    }
+
+    ++photoatomic_reaction;
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,8 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
+#include <utility>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomicReactionType.hpp"
@@ -54,6 +56,10 @@ public:
   //! Typedef for the const reaction map
   typedef BaseType::ConstReactionMap ConstReactionMap;
 
+  //! Typedef for the scattering angle cosine pdf array (pdf, outgoing energy)
+  typedef std::vector<std::pair<double,double> >
+  ScatteringAngleCosinePDFArray;
+
   //! Constructor
   template<typename InterpPolicy>
   Photoatom(
@@ -97,6 +103,12 @@ public:
 			       const double energy,
 			       const PhotonuclearReactionType reaction ) const;
 
+  //! Evaluate the scattering angle cosine pdfs of the scattering reactions
+  void evaluateScatteringAngleCosinePDF(
+                                 const double energy,
+                                 const double scattering_angle_cosine,
+                                 ScatteringAngleCosinePDFArray& pdfs ) const;
+
   //! Get the absorption reaction types
   using BaseType::getAbsorptionReactionTypes;
 
@@ -50,7 +50,9 @@ void PhotoatomNativeFactory::createPhotoatomCore(
                                     grid_searcher,
                                     reaction_pointers,
                                     properties.getIncoherentModelType(),
-                                    properties.getKahnSamplingCutoffEnergy() );
+                                    properties.getKahnSamplingCutoffEnergy(),
+                                    properties.isTabularIncoherentSamplingModeOn(),
+                                    properties.getIntegratedCrossSectionTableTolerance() );
     
 
     for( unsigned i = 0; i < reaction_pointers.size(); ++i )
@@ -69,7 +71,8 @@ void PhotoatomNativeFactory::createPhotoatomCore(
 							    raw_photoatom_data,
 							    energy_grid,
 							    grid_searcher,
-							    reaction_pointer );
+							    reaction_pointer,
+                          properties.getIntegratedCrossSectionTableTolerance() );
   }
 
   // Create the pair production reaction
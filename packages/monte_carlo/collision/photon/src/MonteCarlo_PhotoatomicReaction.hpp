@@ -52,6 +52,11 @@ public:
 		      Data::SubshellType& shell_of_interaction,
 		      Counter& trials ) const;
 
+  //! Evaluate the pdf of the scattering angle cosine of the outgoing photon
+  virtual double evaluateScatteringAngleCosinePDF(
+                                    const double incoming_energy,
+                                    const double scattering_angle_cosine,
+                                    double& outgoing_energy ) const;
 };
 
 // Simulate the reaction and track the number of sampling trials
@@ -66,6 +71,24 @@ inline void PhotoatomicReaction::react(
   this->react( photon, bank, shell_of_interaction );
 }
 
+// Evaluate the pdf of the scattering angle cosine of the outgoing photon
+/*! \details This is used by next-event estimators to score the collision
+ * contribution of a reaction. The outgoing energy will be set to the energy
+ * of a photon that leaves the collision with the scattering angle cosine.
+ * By default a reaction does not leave a scattered photon (e.g. absorption)
+ * and zero will be returned. Only the incoming photon is accounted for -
+ * photons that a reaction banks (e.g. fluorescence photons, the second
+ * annihilation photon) are scored by next-event estimators when they are
+ * emitted.
+ */
+inline double PhotoatomicReaction::evaluateScatteringAngleCosinePDF(
+                                          const double,
+                                          const double,
+                                          double& ) const
+{
+  return 0.0;
+}
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<PhotoatomicReaction,Utility::LinLin,false> );
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<PhotoatomicReaction,Utility::LinLin,true> );
 
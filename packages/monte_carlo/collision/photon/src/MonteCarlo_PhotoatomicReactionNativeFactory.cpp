@@ -37,7 +37,9 @@ void PhotoatomicReactionNativeFactory::createIncoherentReactions(
        std::vector<std::shared_ptr<const PhotoatomicReaction> >&
        incoherent_reactions,
        const IncoherentModelType incoherent_model,
-       const double kahn_sampling_cutoff_energy )
+       const double kahn_sampling_cutoff_energy,
+       const bool use_tabular_sampling,
+       const double integrated_cs_table_tolerance )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.getPhotonEnergyGrid().size() ==
@@ -67,7 +69,10 @@ void PhotoatomicReactionNativeFactory::createIncoherentReactions(
 						 raw_photoatom_data,
 						 distribution,
 						 incoherent_model,
-						 kahn_sampling_cutoff_energy );
+						 kahn_sampling_cutoff_energy,
+						 0u,
+						 use_tabular_sampling,
+						 integrated_cs_table_tolerance );
 
     // Create the incoherent reaction
     incoherent_reactions[0].reset(
@@ -133,7 +138,8 @@ void PhotoatomicReactionNativeFactory::createCoherentReaction(
        const std::shared_ptr<const std::vector<double> >& energy_grid,
        const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
        grid_searcher,
-       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction )
+       std::shared_ptr<const PhotoatomicReaction>& coherent_reaction,
+       const double integrated_cs_table_tolerance )
 {
   // Make sure the energy grid is valid
   testPrecondition( raw_photoatom_data.getPhotonEnergyGrid().size() ==
@@ -152,8 +158,11 @@ void PhotoatomicReactionNativeFactory::createCoherentReaction(
   std::shared_ptr<const CoherentScatteringDistribution> distribution;
 
   CoherentScatteringDistributionNativeFactory::createEfficientCoherentDistribution(
-					                    raw_photoatom_data,
-							    distribution );
+			        raw_photoatom_data,
+			        distribution,
+			        raw_photoatom_data.getPhotonEnergyGrid().front(),
+			        raw_photoatom_data.getPhotonEnergyGrid().back(),
+			        integrated_cs_table_tolerance );
 
   // Create the coherent reaction
   coherent_reaction.reset(
@@ -8,6 +8,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotonMaterial.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
@@ -38,6 +39,52 @@ double PhotonMaterial::getMacroscopicReactionCrossSection(
                                                  reaction ) );
 }
 
+// Evaluate the scattering angle cosine pdfs of the scattering collisions
+/*! \details The scattering angle cosine pdfs of each photoatom (see
+ * Photoatom::evaluateScatteringAngleCosinePDF) will be multiplied by the
+ * probability that a collision in the material is with that photoatom and
+ * appended to the pdf array. The sum of the appended pdfs is the pdf of a
+ * photon leaving a collision in the material at the scattering angle cosine,
+ * including the probability that the collision is not an absorption. No
+ * random numbers are used.
+ */
+void PhotonMaterial::evaluateScatteringAngleCosinePDF(
+                                  const double energy,
+                                  const double scattering_angle_cosine,
+                                  ScatteringAngleCosinePDFArray& pdfs ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  const double macroscopic_total_cross_section =
+    this->getMacroscopicTotalCrossSection( energy );
+
+  if( macroscopic_total_cross_section <= 0.0 )
+    return;
+
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    const Photoatom& photoatom = this->getScatteringCenter( i );
+
+    const double photoatom_probability =
+      this->getScatteringCenterNumberDensity( i )*
+      photoatom.getTotalCrossSection( energy )/
+      macroscopic_total_cross_section;
+
+    if( photoatom_probability <= 0.0 )
+      continue;
+
+    const size_t start_index = pdfs.size();
+
+    photoatom.evaluateScatteringAngleCosinePDF( energy,
+                                                scattering_angle_cosine,
+                                                pdfs );
+
+    for( size_t j = start_index; j < pdfs.size(); ++j )
+      pdfs[j].first *= photoatom_probability;
+  }
+}
+
 // Get the photonuclear absorption reaction types
 void PhotonMaterial::getAbsorptionReactionTypes(
                         PhotonuclearReactionEnumTypeSet& reaction_types ) const
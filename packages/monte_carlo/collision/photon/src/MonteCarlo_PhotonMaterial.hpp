@@ -48,6 +48,10 @@ public:
   //! The photoatom name map type
   typedef BaseType::ScatteringCenterNameMap PhotoatomNameMap;
 
+  //! The scattering angle cosine pdf array type (pdf, outgoing energy)
+  typedef ScatteringCenterType::ScatteringAngleCosinePDFArray
+  ScatteringAngleCosinePDFArray;
+
   //! Constructor
   PhotonMaterial( const MaterialId id,
 		  const double density,
@@ -67,6 +71,12 @@ public:
   //! Return the macroscopic cross section (1/cm) for a specific reaction
   using BaseType::getMacroscopicReactionCrossSection;
 
+  //! Evaluate the scattering angle cosine pdfs of the scattering collisions
+  void evaluateScatteringAngleCosinePDF(
+                                 const double energy,
+                                 const double scattering_angle_cosine,
+                                 ScatteringAngleCosinePDFArray& pdfs ) const;
+
     //! Get the absorption reaction types
   using BaseType::getAbsorptionReactionTypes;
 
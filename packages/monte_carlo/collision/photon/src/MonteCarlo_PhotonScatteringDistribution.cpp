@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PhotonScatteringDistribution.cpp
+//! \author Alex Robinson
+//! \brief  The photon scattering distribution base class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_PhotonScatteringDistribution.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Tabulate the integrated cross section
+/*! \details Once the integrated cross section has been tabulated, the PDF
+ * will be normalized using the table instead of an adaptive quadrature for
+ * every incoming energy in [min_energy,max_energy]. The quadrature that
+ * is used to generate the table is ten times more precise than the
+ * convergence tolerance.
+ */
+void PhotonScatteringDistribution::tabulateIntegratedCrossSection(
+                                                 const double min_energy,
+                                                 const double max_energy,
+                                                 const double convergence_tol )
+{
+  // Make sure the energy range is valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( max_energy > min_energy );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol < 1.0 );
+
+  const double precision = 0.1*convergence_tol;
+
+  d_integrated_cs_table.reset( new IntegratedCrossSectionTable(
+             [this, precision]( const double incoming_energy ){
+               return this->evaluateIntegratedCrossSection( incoming_energy,
+                                                            precision );
+             },
+             min_energy,
+             max_energy,
+             convergence_tol ) );
+}
+
+// Check if the integrated cross section has been tabulated
+bool PhotonScatteringDistribution::isIntegratedCrossSectionTabulated() const
+{
+  return d_integrated_cs_table.get() != NULL;
+}
+
+// Evaluate the integrated cross section used to normalize the PDF (b)
+/*! \details The adaptive quadrature will only be used if the integrated
+ * cross section has not been tabulated or if the incoming energy is outside
+ * of the table.
+ */
+double PhotonScatteringDistribution::evaluatePDFNormalizationConstant(
+                                          const double incoming_energy ) const
+{
+  if( d_integrated_cs_table )
+  {
+    if( d_integrated_cs_table->isEnergyInTable( incoming_energy ) )
+      return d_integrated_cs_table->evaluate( incoming_energy );
+  }
+
+  return this->evaluateIntegratedCrossSection( incoming_energy, 1e-3 );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PhotonScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -9,7 +9,11 @@
 #ifndef MONTE_CARLO_PHOTON_SCATTERING_DISTRIBUTION_HPP
 #define MONTE_CARLO_PHOTON_SCATTERING_DISTRIBUTION_HPP
 
+// Std Lib Includes
+#include <memory>
+
 // FRENSIE Includes
+#include "MonteCarlo_IntegratedCrossSectionTable.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ParticleBank.hpp"
 #include "MonteCarlo_ScatteringDistribution.hpp"
@@ -63,6 +67,24 @@ public:
   virtual void scatterPhoton( PhotonState& photon,
 			      ParticleBank& bank,
 			      Data::SubshellType& shell_of_interaction ) const = 0;
+
+  //! Tabulate the integrated cross section
+  void tabulateIntegratedCrossSection( const double min_energy,
+                                       const double max_energy,
+                                       const double convergence_tol = 1e-3 );
+
+  //! Check if the integrated cross section has been tabulated
+  bool isIntegratedCrossSectionTabulated() const;
+
+protected:
+
+  //! Evaluate the integrated cross section used to normalize the PDF (b)
+  double evaluatePDFNormalizationConstant( const double incoming_energy ) const;
+
+private:
+
+  // The integrated cross section table
+  std::shared_ptr<const IntegratedCrossSectionTable> d_integrated_cs_table;
 };
 
 } // end MonteCarlo namespace
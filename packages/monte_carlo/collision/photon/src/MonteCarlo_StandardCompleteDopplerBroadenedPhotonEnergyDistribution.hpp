@@ -177,8 +177,9 @@ protected:
   //! Sample an ENDF subshell
   Data::SubshellType sampleENDFInteractionSubshell() const;
 
-  //! Sample an interaction subshell
-  virtual void sampleInteractionSubshell( size_t& old_subshell_index,
+  //! Sample an interaction subshell that is accessible at the energy
+  virtual bool sampleInteractionSubshell( const double incoming_energy,
+                                          size_t& old_subshell_index,
                                           double& subshell_binding_energy,
                                           Data::SubshellType& subshell ) const = 0;
 
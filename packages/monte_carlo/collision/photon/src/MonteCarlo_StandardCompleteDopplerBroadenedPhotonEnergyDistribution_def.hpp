@@ -19,6 +19,7 @@
 #include "Utility_GaussKronrodIntegrator.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -718,7 +719,12 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
 
 // Sample an electron momentum from the distribution
 /*! \details The sampling of the Compton profile and the interaction subshell
- * are decoupled in this procedure.
+ * are decoupled in this procedure. Only subshells where an incoherent
+ * interaction is energetically possible can be selected (see
+ * MonteCarlo::SubshellInteractionSamplingTable) so exactly one trial is
+ * required. If the incoming energy is below every subshell binding energy
+ * no subshell can be selected (the rejection loop that was used previously
+ * would never terminate) and an exception will be thrown.
  */
 template<typename ComptonProfilePolicy>
 void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePolicy>::sampleMomentumAndRecordTrials(
@@ -734,30 +740,22 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
   testPrecondition( scattering_angle_cosine >= -1.0 );
   testPrecondition( scattering_angle_cosine <= 1.0 );
 
-  // Record the number of iterations
-  Counter iterations = 0;
-
   // Sample the shell that is interacted with
   size_t compton_subshell_index;
   double subshell_binding_energy;
 
-  // Only allow the selection of subshells where an incoherent interaction is
-  // energetically possible - there is definitely a more efficient way to do
-  // this!
-  while( true )
-  {
-    ++iterations;
-
-    this->sampleInteractionSubshell( compton_subshell_index,
+  const bool subshell_accessible =
+    this->sampleInteractionSubshell( incoming_energy,
+                                     compton_subshell_index,
                                      subshell_binding_energy,
                                      shell_of_interaction );
 
-    // Calculate the maximum outgoing photon energy
-    double energy_max = incoming_energy - subshell_binding_energy;
-
-    if( energy_max >= 0.0 )
-      break;
-  }
+  TEST_FOR_EXCEPTION( !subshell_accessible,
+                      std::runtime_error,
+                      "An incoherent interaction is not energetically "
+                      "possible at " << incoming_energy << " MeV (the "
+                      "incoming energy is below every subshell binding "
+                      "energy)!" );
 
   // Get the Compton profile for the sampled subshell
   const ComptonProfile& compton_profile =
@@ -769,7 +767,7 @@ void StandardCompleteDopplerBroadenedPhotonEnergyDistribution<ComptonProfilePoli
                                                     compton_profile );
 
   // Increment the number of trials
-  trials += iterations;
+  ++trials;
 }
 
 // Sample an electron momentum from the subshell distribution
@@ -10,6 +10,7 @@
 #define MONTE_CARLO_SUBSHELL_INCOHERENT_PHOTOATOMIC_REACTION_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_PhotonKinematicsHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -110,6 +111,23 @@ void SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>
   photon.incrementCollisionNumber();
 }
 
+// Evaluate the pdf of the scattering angle cosine of the outgoing photon
+/*! \details The outgoing energy will be set to the Compton line energy
+ * (Doppler broadening and the subshell binding energy is ignored).
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateScatteringAngleCosinePDF(
+                                     const double incoming_energy,
+                                     const double scattering_angle_cosine,
+                                     double& outgoing_energy ) const
+{
+  outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+                                                scattering_angle_cosine );
+
+  return d_scattering_distribution->evaluatePDF( incoming_energy,
+                                                 scattering_angle_cosine );
+}
+
 // Get the interaction subshell (non-standard interface)
 template<typename InterpPolicy, bool processed_cross_section>
 inline Data::SubshellType SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::getSubshell() const
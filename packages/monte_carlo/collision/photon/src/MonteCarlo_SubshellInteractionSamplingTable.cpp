@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SubshellInteractionSamplingTable.cpp
+//! \author Alex Robinson
+//! \brief  The subshell interaction sampling table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_SubshellInteractionSamplingTable.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details Subshells with a weight of zero will never be sampled and do
+ * not generate a threshold interval.
+ */
+SubshellInteractionSamplingTable::SubshellInteractionSamplingTable(
+                          const std::vector<double>& subshell_binding_energies,
+                          const std::vector<double>& subshell_weights )
+  : d_number_of_subshells( subshell_binding_energies.size() ),
+    d_threshold_energies(),
+    d_accessible_subshell_distributions()
+{
+  // Make sure the subshell data is valid
+  testPrecondition( subshell_binding_energies.size() > 0 );
+  testPrecondition( subshell_weights.size() ==
+                    subshell_binding_energies.size() );
+
+  // Only subshells that can be sampled create a threshold
+  for( size_t i = 0; i < subshell_binding_energies.size(); ++i )
+  {
+    if( subshell_weights[i] > 0.0 )
+      d_threshold_energies.push_back( subshell_binding_energies[i] );
+  }
+
+  TEST_FOR_EXCEPTION( d_threshold_energies.empty(),
+                      std::runtime_error,
+                      "At least one subshell must have a non-zero weight!" );
+
+  std::sort( d_threshold_energies.begin(), d_threshold_energies.end() );
+
+  d_threshold_energies.erase( std::unique( d_threshold_energies.begin(),
+                                           d_threshold_energies.end() ),
+                              d_threshold_energies.end() );
+
+  // Create the accessible subshell distribution for each interval - the
+  // independent values of each distribution are the subshell indices (the
+  // original subshell order is preserved so that the inverse CDF of the
+  // last interval is identical to the inverse CDF of the full distribution)
+  d_accessible_subshell_distributions.resize( d_threshold_energies.size() );
+
+  for( size_t j = 0; j < d_threshold_energies.size(); ++j )
+  {
+    std::vector<double> subshell_indices, accessible_subshell_weights;
+
+    for( size_t i = 0; i < subshell_binding_energies.size(); ++i )
+    {
+      if( subshell_weights[i] > 0.0 &&
+          subshell_binding_energies[i] <= d_threshold_energies[j] )
+      {
+        subshell_indices.push_back( i );
+        accessible_subshell_weights.push_back( subshell_weights[i] );
+      }
+    }
+
+    d_accessible_subshell_distributions[j].reset(
+                   new Utility::DiscreteDistribution( subshell_indices,
+                                                accessible_subshell_weights ) );
+  }
+}
+
+// Return the number of subshells
+size_t SubshellInteractionSamplingTable::getNumberOfSubshells() const
+{
+  return d_number_of_subshells;
+}
+
+// Return the number of binding energy threshold intervals
+size_t SubshellInteractionSamplingTable::getNumberOfThresholdIntervals() const
+{
+  return d_threshold_energies.size();
+}
+
+// Return the threshold energy of an interval
+double SubshellInteractionSamplingTable::getThresholdEnergy(
+                                           const size_t interval_index ) const
+{
+  // Make sure the interval index is valid
+  testPrecondition( interval_index < d_threshold_energies.size() );
+
+  return d_threshold_energies[interval_index];
+}
+
+// Sample the index of a subshell that is accessible at the energy
+/*! \details Only one random number is used. If the incoming energy is below
+ * every binding energy no subshell is accessible, false will be returned and
+ * no random number will be used.
+ */
+bool SubshellInteractionSamplingTable::sample( const double incoming_energy,
+                                               size_t& subshell_index ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+
+  size_t interval_index;
+
+  if( !this->getThresholdIntervalIndex( incoming_energy, interval_index ) )
+    return false;
+
+  subshell_index =
+    (size_t)d_accessible_subshell_distributions[interval_index]->sample();
+
+  return true;
+}
+
+// Return the threshold interval index that contains the energy
+/*! \details False will be returned if the energy is below every threshold.
+ */
+bool SubshellInteractionSamplingTable::getThresholdIntervalIndex(
+                                                const double incoming_energy,
+                                                size_t& interval_index ) const
+{
+  std::vector<double>::const_iterator threshold_it =
+    std::upper_bound( d_threshold_energies.begin(),
+                      d_threshold_energies.end(),
+                      incoming_energy );
+
+  // Below every threshold - no subshell is accessible
+  if( threshold_it == d_threshold_energies.begin() )
+    return false;
+
+  interval_index =
+    std::distance( d_threshold_energies.begin(), threshold_it ) - 1;
+
+  return true;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SubshellInteractionSamplingTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,80 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SubshellInteractionSamplingTable.hpp
+//! \author Alex Robinson
+//! \brief  The subshell interaction sampling table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SUBSHELL_INTERACTION_SAMPLING_TABLE_HPP
+#define MONTE_CARLO_SUBSHELL_INTERACTION_SAMPLING_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_DiscreteDistribution.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The subshell interaction sampling table
+ * \details An incoherent interaction with a subshell is only possible when
+ * the incoming energy is greater than the subshell binding energy. Instead
+ * of sampling from all subshells and rejecting the ones that are not
+ * energetically accessible, this table stores an inverse CDF over the
+ * accessible subshells for every binding energy threshold interval. A single
+ * random number is therefore always sufficient to select a valid subshell.
+ * When the incoming energy is below every binding energy no subshell is
+ * accessible and nothing will be sampled.
+ */
+class SubshellInteractionSamplingTable
+{
+
+public:
+
+  //! Constructor
+  SubshellInteractionSamplingTable(
+                          const std::vector<double>& subshell_binding_energies,
+                          const std::vector<double>& subshell_weights );
+
+  //! Destructor
+  ~SubshellInteractionSamplingTable()
+  { /* ... */ }
+
+  //! Return the number of subshells
+  size_t getNumberOfSubshells() const;
+
+  //! Return the number of binding energy threshold intervals
+  size_t getNumberOfThresholdIntervals() const;
+
+  //! Return the threshold energy of an interval
+  double getThresholdEnergy( const size_t interval_index ) const;
+
+  //! Sample the index of a subshell that is accessible at the energy
+  bool sample( const double incoming_energy, size_t& subshell_index ) const;
+
+private:
+
+  // Return the threshold interval index that contains the energy
+  bool getThresholdIntervalIndex( const double incoming_energy,
+                                  size_t& interval_index ) const;
+
+  // The number of subshells
+  size_t d_number_of_subshells;
+
+  // The sorted (unique) subshell binding energies
+  std::vector<double> d_threshold_energies;
+
+  // The accessible subshell distribution for each threshold interval
+  std::vector<std::shared_ptr<const Utility::DiscreteDistribution> >
+  d_accessible_subshell_distributions;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SUBSHELL_INTERACTION_SAMPLING_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SubshellInteractionSamplingTable.hpp
+//---------------------------------------------------------------------------//
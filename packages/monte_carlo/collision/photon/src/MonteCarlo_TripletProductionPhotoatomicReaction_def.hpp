@@ -120,6 +120,22 @@ void TripletProductionPhotoatomicReaction<InterpPolicy,processed_cross_section>:
   shell_of_interaction = Data::UNKNOWN_SUBSHELL;
 }
 
+// Evaluate the pdf of the scattering angle cosine of the outgoing photon
+/*! \details The incoming photon becomes one of the two annihilation
+ * photons, which are emitted isotropically with the electron rest mass
+ * energy (the second annihilation photon is banked).
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double TripletProductionPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateScatteringAngleCosinePDF(
+                                     const double incoming_energy,
+                                     const double scattering_angle_cosine,
+                                     double& outgoing_energy ) const
+{
+  outgoing_energy = Utility::PhysicalConstants::electron_rest_mass_energy;
+
+  return 0.5;
+}
+
 // The basic triplet production model
 /*! \details Simplified Model: Assume that both outgoing electrons and the
  * positron are emitted with the mean emission energy (E_mean = E_kinetic/3). 
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <cmath>
+
 // Boost Includes
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
@@ -13,6 +16,9 @@
 // FRENSIE Includes
 #include "MonteCarlo_WHIncoherentPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_PhotonKinematicsHelpers.hpp"
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_GridGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_GaussKronrodIntegrator.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -24,7 +30,8 @@ WHIncoherentPhotonScatteringDistribution::WHIncoherentPhotonScatteringDistributi
 	  const std::shared_ptr<const ScatteringFunction>& scattering_function,
 	  const double kahn_sampling_cutoff_energy )
   : IncoherentPhotonScatteringDistribution( kahn_sampling_cutoff_energy ),
-    d_scattering_function( scattering_function )
+    d_scattering_function( scattering_function ),
+    d_sampling_table()
 {
   // Make sure the scattering function is valid
   testPrecondition( scattering_function.get() );
@@ -105,7 +112,11 @@ void WHIncoherentPhotonScatteringDistribution::sample(
 
 // Sample an outgoing energy and direction and record the number of trials
 /*! \details This function will only sample a Compton line energy (no
- * Doppler broadening).
+ * Doppler broadening). If the sampling table has been constructed and it
+ * covers the incoming energy the scattering angle cosine will be sampled
+ * directly from the table (one trial). Otherwise the Klein-Nishina
+ * distribution will be sampled and the scattering function will be used
+ * as a rejection function.
  */
 void WHIncoherentPhotonScatteringDistribution::sampleAndRecordTrials(
 					    const double incoming_energy,
@@ -116,6 +127,22 @@ void WHIncoherentPhotonScatteringDistribution::sampleAndRecordTrials(
   // Make sure the incoming energy is valid
   testPrecondition( incoming_energy > 0.0 );
 
+  if( this->isEnergyInSamplingTable( incoming_energy ) )
+  {
+    scattering_angle_cosine =
+      d_sampling_table->sampleSecondaryConditionalAndRecordTrials(
+                                                 incoming_energy, trials );
+
+    // Check for roundoff error
+    if( fabs( scattering_angle_cosine ) > 1.0 )
+      scattering_angle_cosine = copysign( 1.0, scattering_angle_cosine );
+
+    outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+                                                  scattering_angle_cosine );
+
+    return;
+  }
+
   // Evaluate the maximum scattering function value
   const double max_scattering_function_value =
     this->evaluateScatteringFunction( incoming_energy, -1.0 );
@@ -145,6 +172,119 @@ void WHIncoherentPhotonScatteringDistribution::sampleAndRecordTrials(
   testPostcondition( outgoing_energy <= incoming_energy );
 }
 
+// Construct the tabular (inverse CDF) scattering angle sampling table
+/*! \details The scattering angle cosine distribution (Klein-Nishina
+ * distribution times the scattering function) will be tabulated on a log
+ * spaced incoming energy grid. The cosine grid at each incoming energy will be
+ * refined with a Utility::GridGenerator until lin-lin interpolation of the
+ * distribution meets the convergence tolerance. Sampling between incoming
+ * energy grid points is done with the direct statistical method, which is
+ * appropriate since the cosine range does not change with the energy.
+ * Sampling from the table has a fixed cost, unlike the nested Kahn and
+ * scattering function rejection loops that it replaces. Outside of the table
+ * energy range the rejection scheme will still be used.
+ */
+void WHIncoherentPhotonScatteringDistribution::constructSamplingTable(
+                                           const double min_energy,
+                                           const double max_energy,
+                                           const unsigned energies_per_decade,
+                                           const double convergence_tol )
+{
+  // Make sure the energy range is valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( max_energy > min_energy );
+  // Make sure the number of energies per decade is valid
+  testPrecondition( energies_per_decade > 0 );
+  // Make sure the convergence tolerance is valid
+  testPrecondition( convergence_tol > 0.0 );
+  testPrecondition( convergence_tol < 1.0 );
+
+  // Create the log spaced incoming energy grid
+  const unsigned number_of_energies = 1u +
+    std::max( (unsigned)std::ceil( energies_per_decade*
+                                   std::log10( max_energy/min_energy ) ),
+              1u );
+
+  std::vector<double> energy_grid( number_of_energies );
+
+  const double log_energy_step =
+    std::log( max_energy/min_energy )/(number_of_energies - 1);
+
+  for( unsigned i = 0; i < number_of_energies; ++i )
+    energy_grid[i] = min_energy*std::exp( i*log_energy_step );
+
+  energy_grid.front() = min_energy;
+  energy_grid.back() = max_energy;
+
+  // Create the scattering angle cosine distribution at each energy
+  Utility::GridGenerator<Utility::LinLin>
+    grid_generator( convergence_tol, 1e-12, 1e-14 );
+
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+    cosine_distributions( number_of_energies );
+
+  for( unsigned i = 0; i < number_of_energies; ++i )
+  {
+    const double energy = energy_grid[i];
+
+    auto pdf_evaluator = [this, energy]( const double cosine ){
+      return this->evaluate( energy, cosine );
+    };
+
+    std::vector<double> cosine_grid( {-1.0, 0.0, 1.0} ), evaluated_pdf;
+
+    grid_generator.generateAndEvaluateInPlace( cosine_grid,
+                                               evaluated_pdf,
+                                               pdf_evaluator );
+
+    cosine_distributions[i].reset(
+         new Utility::TabularDistribution<Utility::LinLin>( cosine_grid,
+                                                            evaluated_pdf ) );
+  }
+
+  d_sampling_table.reset(
+     new Utility::InterpolatedFullyTabularBasicBivariateDistribution<Utility::Direct<Utility::LinLinLin> >(
+                                                      energy_grid,
+                                                      cosine_distributions ) );
+}
+
+// Check if the tabular sampling table has been constructed
+bool WHIncoherentPhotonScatteringDistribution::hasSamplingTable() const
+{
+  return d_sampling_table.get() != NULL;
+}
+
+// Return the min energy of the tabular sampling table
+double WHIncoherentPhotonScatteringDistribution::getSamplingTableMinEnergy() const
+{
+  // Make sure the sampling table has been constructed
+  testPrecondition( this->hasSamplingTable() );
+
+  return d_sampling_table->getLowerBoundOfPrimaryIndepVar();
+}
+
+// Return the max energy of the tabular sampling table
+double WHIncoherentPhotonScatteringDistribution::getSamplingTableMaxEnergy() const
+{
+  // Make sure the sampling table has been constructed
+  testPrecondition( this->hasSamplingTable() );
+
+  return d_sampling_table->getUpperBoundOfPrimaryIndepVar();
+}
+
+// Check if the tabular sampling table covers the incoming energy
+bool WHIncoherentPhotonScatteringDistribution::isEnergyInSamplingTable(
+                                           const double incoming_energy ) const
+{
+  if( d_sampling_table )
+  {
+    return incoming_energy >= d_sampling_table->getLowerBoundOfPrimaryIndepVar() &&
+      incoming_energy <= d_sampling_table->getUpperBoundOfPrimaryIndepVar();
+  }
+  else
+    return false;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
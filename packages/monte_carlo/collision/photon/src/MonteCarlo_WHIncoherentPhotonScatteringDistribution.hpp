@@ -15,6 +15,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_IncoherentPhotonScatteringDistribution.hpp"
 #include "MonteCarlo_ScatteringFunction.hpp"
+#include "Utility_FullyTabularBasicBivariateDistribution.hpp"
 
 namespace MonteCarlo{
 
@@ -55,8 +56,26 @@ public:
 			      double& scattering_angle_cosine,
 			      Counter& trials ) const;
 
+  //! Construct the tabular (inverse CDF) scattering angle sampling table
+  void constructSamplingTable( const double min_energy,
+                               const double max_energy,
+                               const unsigned energies_per_decade = 10u,
+                               const double convergence_tol = 1e-3 );
+
+  //! Check if the tabular sampling table has been constructed
+  bool hasSamplingTable() const;
+
+  //! Return the min energy of the tabular sampling table
+  double getSamplingTableMinEnergy() const;
+
+  //! Return the max energy of the tabular sampling table
+  double getSamplingTableMaxEnergy() const;
+
 private:
 
+  // Check if the tabular sampling table covers the incoming energy
+  bool isEnergyInSamplingTable( const double incoming_energy ) const;
+
   // Evaluate the scattering function
   double evaluateScatteringFunction(
 				  const double incoming_energy,
@@ -64,6 +83,10 @@ private:
 
   // The scattering function
   std::shared_ptr<const ScatteringFunction> d_scattering_function;
+
+  // The tabular scattering angle cosine sampling table
+  std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
+  d_sampling_table;
 };
 
 // Evaluate the scattering function
@@ -100,6 +100,30 @@ FRENSIE_UNIT_TEST( CoherentPhotoatomicReaction, getCrossSection_ace )
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, exp( -2.309498238246E+01 ), 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdf can be evaluated
+FRENSIE_UNIT_TEST( CoherentPhotoatomicReaction,
+                   evaluateScatteringAngleCosinePDF_ace )
+{
+  double outgoing_energy = 0.0;
+
+  double forward_pdf =
+    ace_coherent_reaction->evaluateScatteringAngleCosinePDF(
+                                                  20.0, 1.0, outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 20.0 );
+  FRENSIE_CHECK( forward_pdf > 0.0 );
+
+  outgoing_energy = 0.0;
+
+  double backward_pdf =
+    ace_coherent_reaction->evaluateScatteringAngleCosinePDF(
+                                                 20.0, -1.0, outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( outgoing_energy, 20.0 );
+  FRENSIE_CHECK( backward_pdf < forward_pdf );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the coherent reaction can be simulated
 FRENSIE_UNIT_TEST( CoherentPhotoatomicReaction, react_ace )
@@ -94,6 +94,52 @@ FRENSIE_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
   FRENSIE_CHECK_EQUAL( shell_of_interaction, Data::K_SUBSHELL );
 }
 
+//---------------------------------------------------------------------------//
+// Check that only energetically accessible subshells are sampled
+FRENSIE_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
+		   sample_full_below_k_edge )
+{
+  // The Pb K subshell binding energy is ~0.088 MeV
+  double incoming_energy = 0.05, scattering_angle_cosine = 0.0;
+  double outgoing_energy;
+  Data::SubshellType shell_of_interaction;
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.005; // select first accessible shell for collision
+  fake_stream[1] = 0.5; // select pz = 0.0
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  full_distribution->sample( incoming_energy,
+			scattering_angle_cosine,
+			outgoing_energy,
+			shell_of_interaction );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK( shell_of_interaction != Data::K_SUBSHELL );
+  FRENSIE_CHECK( outgoing_energy > 0.0 );
+  FRENSIE_CHECK( outgoing_energy < incoming_energy );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an exception is thrown when no subshell is accessible
+FRENSIE_UNIT_TEST( CoupledCompleteDopplerBroadenedPhotonEnergyDistribution,
+		   sample_full_below_all_edges )
+{
+  // Every Pb subshell binding energy is above 1 eV
+  double incoming_energy = 1e-7, scattering_angle_cosine = 0.0;
+  double outgoing_energy;
+  Data::SubshellType shell_of_interaction;
+
+  FRENSIE_CHECK_THROW( full_distribution->sample( incoming_energy,
+                                                  scattering_angle_cosine,
+                                                  outgoing_energy,
+                                                  shell_of_interaction ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
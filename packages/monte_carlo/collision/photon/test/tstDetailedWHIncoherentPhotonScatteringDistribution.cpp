@@ -29,6 +29,9 @@
 std::shared_ptr<MonteCarlo::PhotonScatteringDistribution>
   distribution;
 
+std::shared_ptr<MonteCarlo::DetailedWHIncoherentPhotonScatteringDistribution>
+  tabular_distribution;
+
 std::shared_ptr<Utility::UnivariateDistribution> incoherent_cs;
 
 //---------------------------------------------------------------------------//
@@ -237,6 +240,64 @@ FRENSIE_UNIT_TEST( WHIncoherentPhotonScatteringDistribution,
   FRENSIE_CHECK_EQUAL( 1.0/trials, 0.5 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tabular sampling table can be constructed
+FRENSIE_UNIT_TEST( WHIncoherentPhotonScatteringDistribution,
+                   constructSamplingTable )
+{
+  FRENSIE_CHECK( !std::dynamic_pointer_cast<MonteCarlo::WHIncoherentPhotonScatteringDistribution>( distribution )->hasSamplingTable() );
+  FRENSIE_REQUIRE( tabular_distribution->hasSamplingTable() );
+  FRENSIE_CHECK_EQUAL( tabular_distribution->getSamplingTableMinEnergy(),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( tabular_distribution->getSamplingTableMaxEnergy(),
+                       3.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an outgoing energy and direction can be sampled from the table
+FRENSIE_UNIT_TEST( WHIncoherentPhotonScatteringDistribution,
+                   sampleAndRecordTrials_tabular )
+{
+  double outgoing_energy, scattering_angle_cosine;
+  MonteCarlo::IncoherentPhotonScatteringDistribution::Counter trials = 0;
+
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.0; // select the energy bin boundary
+  fake_stream[1] = 0.0; // mu = -1.0
+  fake_stream[2] = 0.0; // select the energy bin boundary
+  fake_stream[3] = 1.0-1e-15; // mu = 1.0
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  tabular_distribution->sampleAndRecordTrials(
+			 Utility::PhysicalConstants::electron_rest_mass_energy,
+			 outgoing_energy,
+			 scattering_angle_cosine,
+			 trials );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, -1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+		       outgoing_energy,
+		       Utility::PhysicalConstants::electron_rest_mass_energy/3,
+		       1e-12 );
+  FRENSIE_CHECK_EQUAL( trials, 1 );
+
+  tabular_distribution->sampleAndRecordTrials(
+			 Utility::PhysicalConstants::electron_rest_mass_energy,
+			 outgoing_energy,
+			 scattering_angle_cosine,
+			 trials );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( scattering_angle_cosine, 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+		       outgoing_energy,
+		       Utility::PhysicalConstants::electron_rest_mass_energy,
+		       1e-12 );
+  FRENSIE_CHECK_EQUAL( trials, 2 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a photon can be scattered incoherently without Doppler broadening
 FRENSIE_UNIT_TEST( WHIncoherentPhotonScatteringDistribution, scatterPhoton )
@@ -354,6 +415,13 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
 			  xss_data_extractor->extractSubshellOccupancies(),
 			  subshell_order ) );
 
+  tabular_distribution.reset( new MonteCarlo::DetailedWHIncoherentPhotonScatteringDistribution(
+			  scattering_function,
+			  xss_data_extractor->extractSubshellOccupancies(),
+			  subshell_order ) );
+
+  tabular_distribution->constructSamplingTable( 1e-3, 3.0 );
+
   // Extract the incoherent cross section
   {
     // Extract the incoherent cross section
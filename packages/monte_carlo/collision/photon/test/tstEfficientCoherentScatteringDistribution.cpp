@@ -107,6 +107,42 @@ FRENSIE_UNIT_TEST( EfficientCoherentScatteringDistribution,
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 9.13346080019725521e-1, 1e-15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the integrated cross section can be tabulated
+FRENSIE_UNIT_TEST( EfficientCoherentScatteringDistribution,
+                   tabulateIntegratedCrossSection )
+{
+  FRENSIE_CHECK( !distribution->isIntegratedCrossSectionTabulated() );
+
+  distribution->tabulateIntegratedCrossSection( 1e-3, 20.0, 1e-4 );
+
+  FRENSIE_CHECK( distribution->isIntegratedCrossSectionTabulated() );
+
+  // The pdf values must be close to the pdf values calculated with
+  // quadrature
+  double pdf_value = distribution->evaluatePDF( 0.1, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( pdf_value, 49.4688663359142353, 1e-3 );
+
+  pdf_value = distribution->evaluatePDF( 0.1, -1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( pdf_value, 0.0529725087124166966, 1e-3 );
+
+  pdf_value = distribution->evaluatePDF( 1.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( pdf_value, 3673.12567843006855, 1e-3 );
+
+  pdf_value = distribution->evaluatePDF( 1.0, -1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( pdf_value, 0.00125698671726446362, 1e-3 );
+
+  // The integrated cross section is still calculated with quadrature
+  double cross_section =
+    distribution->evaluateIntegratedCrossSection( 1.0, 1e-3 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 9.13346080019725521e-1, 1e-15 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the distribution can be sampled from
 FRENSIE_UNIT_TEST( EfficientCoherentScatteringDistribution, sample )
@@ -163,6 +163,31 @@ FRENSIE_UNIT_TEST( IncoherentPhotoatomicReaction, getCrossSection_ace )
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, exp( -6.573285045032E+00 ), 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdf can be evaluated
+FRENSIE_UNIT_TEST( IncoherentPhotoatomicReaction,
+                   evaluateScatteringAngleCosinePDF_ace_basic )
+{
+  double outgoing_energy = 0.0;
+
+  double pdf =
+    ace_basic_incoherent_reaction->evaluateScatteringAngleCosinePDF(
+                                                  20.0, 0.0, outgoing_energy );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy,
+                                   20.0/(1.0+20.0/Utility::PhysicalConstants::electron_rest_mass_energy ),
+                                   1e-15 );
+  FRENSIE_CHECK( pdf > 0.0 );
+
+  pdf = ace_basic_incoherent_reaction->evaluateScatteringAngleCosinePDF(
+                                                 20.0, -1.0, outgoing_energy );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( outgoing_energy,
+                                   20.0/(1.0+2.0*20.0/Utility::PhysicalConstants::electron_rest_mass_energy ),
+                                   1e-15 );
+  FRENSIE_CHECK( pdf > 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the basic incoherent reaction can be simulated
 FRENSIE_UNIT_TEST( IncoherentPhotoatomicReaction, react_ace_basic )
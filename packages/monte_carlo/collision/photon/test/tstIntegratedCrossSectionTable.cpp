@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstIntegratedCrossSectionTable.cpp
+//! \author Alex Robinson
+//! \brief  The integrated cross section table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_IntegratedCrossSectionTable.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::IntegratedCrossSectionTable> table;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// A smooth integrated cross section that saturates at high energies
+double integratedCrossSection( const double energy )
+{
+  return 1.0 - std::exp( -energy );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the table energy range can be returned
+FRENSIE_UNIT_TEST( IntegratedCrossSectionTable, getMinMaxEnergy )
+{
+  FRENSIE_CHECK_EQUAL( table->getMinEnergy(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( table->getMaxEnergy(), 20.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the initial grid is refined
+FRENSIE_UNIT_TEST( IntegratedCrossSectionTable, getNumberOfEnergies )
+{
+  // 44 log spaced energies are needed to cover [1e-3,20] with 10 energies
+  // per decade
+  FRENSIE_CHECK( table->getNumberOfEnergies() > 44 );
+
+  // A linear function does not need to be refined
+  MonteCarlo::IntegratedCrossSectionTable
+    linear_table( [](const double energy){ return 2.0*energy; },
+                  1.0, 10.0, 1e-3, 1 );
+
+  FRENSIE_CHECK_EQUAL( linear_table.getNumberOfEnergies(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if an energy is in the table
+FRENSIE_UNIT_TEST( IntegratedCrossSectionTable, isEnergyInTable )
+{
+  FRENSIE_CHECK( !table->isEnergyInTable( 9e-4 ) );
+  FRENSIE_CHECK( table->isEnergyInTable( 1e-3 ) );
+  FRENSIE_CHECK( table->isEnergyInTable( 1.0 ) );
+  FRENSIE_CHECK( table->isEnergyInTable( 20.0 ) );
+  FRENSIE_CHECK( !table->isEnergyInTable( 20.1 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the integrated cross section can be evaluated
+FRENSIE_UNIT_TEST( IntegratedCrossSectionTable, evaluate )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->evaluate( 1e-3 ),
+                                   integratedCrossSection( 1e-3 ),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->evaluate( 20.0 ),
+                                   integratedCrossSection( 20.0 ),
+                                   1e-12 );
+
+  // The interpolated values must be within the convergence tolerance
+  for( double energy = 1e-3; energy < 20.0; energy *= 1.17 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->evaluate( energy ),
+                                     integratedCrossSection( energy ),
+                                     1e-3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  table.reset( new MonteCarlo::IntegratedCrossSectionTable(
+                                      integratedCrossSection, 1e-3, 20.0 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstIntegratedCrossSectionTable.cpp
+//---------------------------------------------------------------------------//
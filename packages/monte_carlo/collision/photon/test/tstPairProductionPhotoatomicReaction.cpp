@@ -165,6 +165,30 @@ FRENSIE_UNIT_TEST( PairProductionPhotoatomicReaction, getCrossSection_ace )
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, exp( 3.71803283438E+00 ), 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdf can be evaluated
+FRENSIE_UNIT_TEST( PairProductionPhotoatomicReaction,
+                   evaluateScatteringAngleCosinePDF_ace )
+{
+  double outgoing_energy = 2.0;
+
+  // The incoming photon becomes an isotropic annihilation photon
+  double pdf = ace_basic_pp_reaction->evaluateScatteringAngleCosinePDF(
+                                                  2.0, -0.5, outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( pdf, 0.5 );
+  FRENSIE_CHECK_EQUAL( outgoing_energy,
+                       Utility::PhysicalConstants::electron_rest_mass_energy );
+
+  // The detailed model banks the positron
+  outgoing_energy = 2.0;
+
+  pdf = ace_detailed_pp_reaction->evaluateScatteringAngleCosinePDF(
+                                                  2.0, -0.5, outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( pdf, 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the pair production reaction can be simulated
 FRENSIE_UNIT_TEST( PairProductionPhotoatomicReaction, react_ace_basic )
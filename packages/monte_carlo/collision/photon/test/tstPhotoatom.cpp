@@ -483,6 +483,47 @@ FRENSIE_UNIT_TEST( Photoatom, getReactionTypes )
   FRENSIE_CHECK_EQUAL( nuclear_reaction_types.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdfs can be evaluated
+FRENSIE_UNIT_TEST( Photoatom, evaluateScatteringAngleCosinePDF_ace )
+{
+  // The pdfs must not consume random numbers
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.25;
+  fake_stream[1] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::Photoatom::ScatteringAngleCosinePDFArray pdfs;
+
+  // Below the pair production threshold no photon can be scattered
+  ace_photoatom->evaluateScatteringAngleCosinePDF( exp( -1.214969212306E+01 ),
+                                                   0.0,
+                                                   pdfs );
+
+  FRENSIE_CHECK_EQUAL( pdfs.size(), 0 );
+
+  // Pair production is the only scattering reaction - the incoming photon
+  // becomes an isotropic annihilation photon
+  const double energy = exp( 1.151292546497E+01 );
+
+  ace_photoatom->evaluateScatteringAngleCosinePDF( energy, 0.0, pdfs );
+
+  FRENSIE_REQUIRE_EQUAL( pdfs.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+     pdfs[0].first,
+     0.5*ace_photoatom->getReactionCrossSection(
+                      energy, MonteCarlo::PAIR_PRODUCTION_PHOTOATOMIC_REACTION )/
+     ace_photoatom->getTotalCrossSection( energy ),
+     1e-12 );
+  FRENSIE_CHECK_EQUAL( pdfs[0].second,
+                       Utility::PhysicalConstants::electron_rest_mass_energy );
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
 //---------------------------------------------------------------------------//
 // Check that an analogue collision with the atom can be modeled
 FRENSIE_UNIT_TEST( Photoatom, collideAnalogue )
@@ -416,6 +416,39 @@ FRENSIE_UNIT_TEST( PhotonMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdfs can be evaluated
+FRENSIE_UNIT_TEST( PhotonMaterial, evaluateScatteringAngleCosinePDF )
+{
+  // The pdfs must not consume random numbers
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.25;
+  fake_stream[1] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhotonMaterial::ScatteringAngleCosinePDFArray pdfs;
+
+  const double energy = exp( -1.381551055796E+01 );
+
+  material->evaluateScatteringAngleCosinePDF( energy, 0.5, pdfs );
+
+  // Coherent and incoherent scattering
+  FRENSIE_CHECK( pdfs.size() >= 2 );
+
+  for( size_t i = 0; i < pdfs.size(); ++i )
+  {
+    FRENSIE_CHECK( pdfs[i].first > 0.0 );
+    FRENSIE_CHECK( pdfs[i].second > 0.0 );
+    FRENSIE_CHECK( pdfs[i].second <= energy );
+  }
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
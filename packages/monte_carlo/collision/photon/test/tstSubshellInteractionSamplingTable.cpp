@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSubshellInteractionSamplingTable.cpp
+//! \author Alex Robinson
+//! \brief  Subshell interaction sampling table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_SubshellInteractionSamplingTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::SubshellInteractionSamplingTable> table;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the table cannot be constructed without a non-zero weight
+FRENSIE_UNIT_TEST( SubshellInteractionSamplingTable, constructor_zero_weights )
+{
+  std::vector<double> binding_energies( {0.1, 0.01, 0.001} );
+  std::vector<double> weights( 3, 0.0 );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SubshellInteractionSamplingTable
+                       bad_table( binding_energies, weights ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of subshells can be returned
+FRENSIE_UNIT_TEST( SubshellInteractionSamplingTable, getNumberOfSubshells )
+{
+  FRENSIE_CHECK_EQUAL( table->getNumberOfSubshells(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the threshold intervals can be returned
+FRENSIE_UNIT_TEST( SubshellInteractionSamplingTable, getThresholdEnergy )
+{
+  // The subshell with a zero weight does not create a threshold
+  FRENSIE_CHECK_EQUAL( table->getNumberOfThresholdIntervals(), 3 );
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergy( 0 ), 0.001 );
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergy( 1 ), 0.01 );
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergy( 2 ), 0.1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an accessible subshell can be sampled
+FRENSIE_UNIT_TEST( SubshellInteractionSamplingTable, sample )
+{
+  std::vector<double> fake_stream( 10 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 1.0-1e-15;
+  fake_stream[3] = 0.0;
+  fake_stream[4] = 0.5;
+  fake_stream[5] = 1.0-1e-15;
+  fake_stream[6] = 0.0;
+  fake_stream[7] = 0.3;
+  fake_stream[8] = 0.6;
+  fake_stream[9] = 1.0-1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  size_t subshell_index;
+
+  // Only the subshell with the lowest binding energy is accessible
+  FRENSIE_CHECK( table->sample( 0.005, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+  FRENSIE_CHECK( table->sample( 0.005, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+  FRENSIE_CHECK( table->sample( 0.005, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+
+  // The two subshells with the lowest binding energies are accessible
+  FRENSIE_CHECK( table->sample( 0.05, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 1 );
+  FRENSIE_CHECK( table->sample( 0.05, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+  FRENSIE_CHECK( table->sample( 0.05, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+
+  // All subshells with a non-zero weight are accessible
+  FRENSIE_CHECK( table->sample( 1.0, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 0 );
+  FRENSIE_CHECK( table->sample( 1.0, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 1 );
+  FRENSIE_CHECK( table->sample( 1.0, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+  FRENSIE_CHECK( table->sample( 1.0, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 3 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that nothing is sampled when no subshell is accessible
+FRENSIE_UNIT_TEST( SubshellInteractionSamplingTable, sample_below_thresholds )
+{
+  std::vector<double> fake_stream( 1 );
+  fake_stream[0] = 0.3;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  size_t subshell_index = 10;
+
+  FRENSIE_CHECK( !table->sample( 0.0001, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 10 );
+
+  // No random numbers are used
+  FRENSIE_CHECK( table->sample( 1.0, subshell_index ) );
+  FRENSIE_CHECK_EQUAL( subshell_index, 1 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> binding_energies( {0.1, 0.01, 0.05, 0.001} );
+  std::vector<double> weights( {1.0, 1.0, 0.0, 2.0} );
+
+  table.reset( new MonteCarlo::SubshellInteractionSamplingTable(
+                                                           binding_energies,
+                                                           weights ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSubshellInteractionSamplingTable.cpp
+//---------------------------------------------------------------------------//
@@ -105,6 +105,22 @@ FRENSIE_UNIT_TEST( TripletProductionPhotoatomicReaction, getCrossSection )
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 0.186299999999999993, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering angle cosine pdf can be evaluated
+FRENSIE_UNIT_TEST( TripletProductionPhotoatomicReaction,
+                   evaluateScatteringAngleCosinePDF )
+{
+  double outgoing_energy = 3.0;
+
+  // The incoming photon becomes an isotropic annihilation photon
+  double pdf = basic_tp_reaction->evaluateScatteringAngleCosinePDF(
+                                                   3.0, 0.5, outgoing_energy );
+
+  FRENSIE_CHECK_EQUAL( pdf, 0.5 );
+  FRENSIE_CHECK_EQUAL( outgoing_energy,
+                       Utility::PhysicalConstants::electron_rest_mass_energy );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the triplet production reaction can be returned
 FRENSIE_UNIT_TEST( TripletProductionPhotoatomicReaction, react )
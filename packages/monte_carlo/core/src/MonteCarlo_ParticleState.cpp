@@ -168,6 +168,15 @@ Geometry::Model::EntityId ParticleState::getCell() const
   return d_navigator->getCurrentCell();
 }
 
+// Return the dense index of the cell containing the particle
+/*! \details The cell index can be used to access the cell tables of the
+ * filled geometry models without a cell id lookup.
+ */
+size_t ParticleState::getCellIndex() const
+{
+  return d_navigator->getCurrentCellIndex();
+}
+
 // Return the x position of the particle
 double ParticleState::getXPosition() const
 {
@@ -347,6 +356,39 @@ void ParticleState::advance( double raw_distance )
   }
 }
 
+// Advance the particle along its direction to a point in a known cell
+/*! \details The cells between the current position and the point will not
+ * be tracked (e.g. delta tracking), which means that no boundary crossing
+ * info will be available. The cell must contain the point - providing the
+ * wrong cell will result in undefined behavior (see
+ * Geometry::Navigator::setState).
+ */
+void ParticleState::advanceToPointInCell( const double raw_distance,
+                                          const Geometry::Model::EntityId cell )
+{
+  // Make sure the distance is valid
+  testPrecondition( !QT::isnaninf( raw_distance ) );
+  testPrecondition( raw_distance >= 0.0 );
+  testPrecondition( !this->isLost() );
+  testPrecondition( !this->isGone() );
+
+  const Geometry::Navigator::Length distance =
+    Geometry::Navigator::Length::from_value( raw_distance );
+
+  const Geometry::Navigator::Length* position = d_navigator->getPosition();
+  const double* direction = d_navigator->getDirection();
+
+  d_navigator->setState( position[0] + direction[0]*distance,
+                         position[1] + direction[1]*distance,
+                         position[2] + direction[2]*distance,
+                         direction[0],
+                         direction[1],
+                         direction[2],
+                         cell );
+
+  this->increaseParticleTime( distance );
+}
+
 // Increase the particle time due to a traversal
 void ParticleState::increaseParticleTime( const Geometry::Navigator::Length distance_traversed )
 {
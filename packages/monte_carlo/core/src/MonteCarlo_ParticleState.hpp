@@ -121,6 +121,9 @@ public:
   //! Return the cell handle for the cell containing the particle
   Geometry::Model::EntityId getCell() const;
 
+  //! Return the dense index of the cell containing the particle
+  size_t getCellIndex() const;
+
   //! Return the x position of the particle
   double getXPosition() const;
 
@@ -168,6 +171,10 @@ public:
   //! Advance the particle along its direction by the requested distance
   void advance( double distance );
 
+  //! Advance the particle along its direction to a point in a known cell
+  void advanceToPointInCell( const double distance,
+                             const Geometry::Model::EntityId cell );
+
   //! Return the source (starting) energy of the particle (history) (MeV)
   energyType getSourceEnergy() const;
 
@@ -17,6 +17,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_NeutronState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
 #include "MonteCarlo_AdjointPhotonState.hpp"
 #include "MonteCarlo_AdjointPhotonProbeState.hpp"
 #include "MonteCarlo_AdjointElectronState.hpp"
@@ -64,6 +65,15 @@ void ParticleStateFactory::createState(
     else
       particle.reset( new ElectronState( history ) );
     break;
+  case POSITRON:
+    if( probe )
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Error: There is no positron probe state currently!" );
+    }
+    else
+      particle.reset( new PositronState( history ) );
+    break;
   case ADJOINT_PHOTON:
     if( probe )
       particle.reset( new AdjointPhotonProbeState( history ) );
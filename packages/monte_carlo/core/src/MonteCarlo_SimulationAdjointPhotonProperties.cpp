@@ -29,6 +29,7 @@ SimulationAdjointPhotonProperties::SimulationAdjointPhotonProperties()
     d_incoherent_adjoint_model_type( DB_IMPULSE_INCOHERENT_ADJOINT_MODEL ),
     d_adjoint_kn_sampling_type( TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING ),
     d_critical_line_energies(),
+    d_integrated_cs_table_tolerance( 0.0 ),
     d_threshold_weight( 0.0 ),
     d_survival_weight()
 { /* ... */ }
@@ -180,6 +181,31 @@ SimulationAdjointPhotonProperties::getCriticalAdjointPhotonLineEnergies() const
   return d_critical_line_energies;
 }
 
+// Set the adjoint integrated cross section table tolerance (0.0 by default)
+/*! \details When the tolerance is greater than zero, the Waller-Hartree
+ * incoherent adjoint distribution will tabulate its integrated cross
+ * section (at the max adjoint photon energy) when it is loaded. The table is
+ * used to normalize the distribution PDF instead of an adaptive quadrature.
+ * A tolerance of zero turns off the table.
+ */
+void SimulationAdjointPhotonProperties::setAdjointIntegratedCrossSectionTableTolerance(
+                                                      const double tolerance )
+{
+  // Make sure the tolerance is valid
+  TEST_FOR_EXCEPTION( tolerance < 0.0 || tolerance >= 1.0,
+                      std::runtime_error,
+                      "The adjoint integrated cross section table tolerance "
+                      "must be in [0.0,1.0)!" );
+
+  d_integrated_cs_table_tolerance = tolerance;
+}
+
+// Return the adjoint integrated cross section table tolerance
+double SimulationAdjointPhotonProperties::getAdjointIntegratedCrossSectionTableTolerance() const
+{
+  return d_integrated_cs_table_tolerance;
+}
+
 // Set the cutoff roulette threshold weight
 void SimulationAdjointPhotonProperties::setAdjointPhotonRouletteThresholdWeight(
       const double threshold_weight )
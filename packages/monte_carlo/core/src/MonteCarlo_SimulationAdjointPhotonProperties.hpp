@@ -80,6 +80,12 @@ public:
   //! Get the critical line energies
   const std::vector<double>& getCriticalAdjointPhotonLineEnergies() const;
 
+  //! Set the adjoint integrated cross section table tolerance (0.0 by default)
+  void setAdjointIntegratedCrossSectionTableTolerance( const double tolerance );
+
+  //! Return the adjoint integrated cross section table tolerance
+  double getAdjointIntegratedCrossSectionTableTolerance() const;
+
   //! Set the cutoff roulette threshold weight
   void setAdjointPhotonRouletteThresholdWeight( const double threshold_weight );
 
@@ -125,6 +131,9 @@ private:
   // The critical line energies
   std::vector<double> d_critical_line_energies;
 
+  // The integrated cross section table tolerance (0.0 = off - default)
+  double d_integrated_cs_table_tolerance;
+
   // The roulette threshold weight
   double d_threshold_weight;
 
@@ -143,6 +152,14 @@ void SimulationAdjointPhotonProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_incoherent_adjoint_model_type );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_kn_sampling_type );
   ar & BOOST_SERIALIZATION_NVP( d_critical_line_energies );
+
+  // Archives created before the integrated cross section table tolerance was
+  // added do not have the tolerance - the tables will be turned off
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_integrated_cs_table_tolerance );
+  else
+    d_integrated_cs_table_tolerance = 0.0;
+
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
 }
@@ -151,7 +168,7 @@ void SimulationAdjointPhotonProperties::serialize( Archive& ar,
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationAdjointPhotonProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationAdjointPhotonProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationAdjointPhotonProperties, "SimulationAdjointPhotonProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationAdjointPhotonProperties );
 
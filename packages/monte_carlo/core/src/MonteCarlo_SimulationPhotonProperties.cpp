@@ -35,6 +35,8 @@ SimulationPhotonProperties::SimulationPhotonProperties()
     d_atomic_relaxation_mode_on( true ),
     d_detailed_pair_production_mode_on( false ),
     d_photonuclear_interaction_mode_on( false ),
+    d_tabular_incoherent_sampling_mode_on( false ),
+    d_integrated_cs_table_tolerance( 0.0 ),
     d_threshold_weight( 0.0 ),
     d_survival_weight()
 { /* ... */ }
@@ -210,6 +212,53 @@ bool SimulationPhotonProperties::isPhotonuclearInteractionModeOn() const
   return d_photonuclear_interaction_mode_on;
 }
 
+// Set tabular incoherent sampling mode to off (off by default)
+void SimulationPhotonProperties::setTabularIncoherentSamplingModeOff()
+{
+  d_tabular_incoherent_sampling_mode_on = false;
+}
+
+// Set tabular incoherent sampling mode to on (off by default)
+/*! \details When this mode is on, the Waller-Hartree based incoherent
+ * distributions will construct a scattering angle sampling table when they
+ * are loaded, which replaces the rejection sampling loops.
+ */
+void SimulationPhotonProperties::setTabularIncoherentSamplingModeOn()
+{
+  d_tabular_incoherent_sampling_mode_on = true;
+}
+
+// Return if tabular incoherent sampling mode is on
+bool SimulationPhotonProperties::isTabularIncoherentSamplingModeOn() const
+{
+  return d_tabular_incoherent_sampling_mode_on;
+}
+
+// Set the integrated cross section table tolerance (0.0 by default)
+/*! \details When the tolerance is greater than zero, the coherent and
+ * Waller-Hartree incoherent distributions will tabulate their integrated
+ * cross sections when they are loaded. The tables are used to normalize the
+ * distribution PDFs instead of an adaptive quadrature. A tolerance of
+ * zero turns off the tables.
+ */
+void SimulationPhotonProperties::setIntegratedCrossSectionTableTolerance(
+                                                      const double tolerance )
+{
+  // Make sure the tolerance is valid
+  TEST_FOR_EXCEPTION( tolerance < 0.0 || tolerance >= 1.0,
+                      std::runtime_error,
+                      "The integrated cross section table tolerance must be "
+                      "in [0.0,1.0)!" );
+
+  d_integrated_cs_table_tolerance = tolerance;
+}
+
+// Return the integrated cross section table tolerance
+double SimulationPhotonProperties::getIntegratedCrossSectionTableTolerance() const
+{
+  return d_integrated_cs_table_tolerance;
+}
+
 // Set the cutoff roulette threshold weight
 void SimulationPhotonProperties::setPhotonRouletteThresholdWeight(
       const double threshold_weight )
@@ -104,6 +104,21 @@ public:
   //! Return if photonuclear interaction mode is on
   bool isPhotonuclearInteractionModeOn() const;
 
+  //! Set tabular incoherent sampling mode to off (off by default)
+  void setTabularIncoherentSamplingModeOff();
+
+  //! Set tabular incoherent sampling mode to on (off by default)
+  void setTabularIncoherentSamplingModeOn();
+
+  //! Return if tabular incoherent sampling mode is on
+  bool isTabularIncoherentSamplingModeOn() const;
+
+  //! Set the integrated cross section table tolerance (0.0 by default)
+  void setIntegratedCrossSectionTableTolerance( const double tolerance );
+
+  //! Return the integrated cross section table tolerance
+  double getIntegratedCrossSectionTableTolerance() const;
+
   //! Set the cutoff roulette threshold weight
   void setPhotonRouletteThresholdWeight( const double threshold_weight );
 
@@ -158,6 +173,12 @@ private:
   // The photonuclear interaction mode (true = on, false = off - default)
   bool d_photonuclear_interaction_mode_on;
 
+  // The tabular incoherent sampling mode (true = on, false = off - default)
+  bool d_tabular_incoherent_sampling_mode_on;
+
+  // The integrated cross section table tolerance (0.0 = off - default)
+  double d_integrated_cs_table_tolerance;
+
   // The roulette threshold weight
   double d_threshold_weight;
 
@@ -178,6 +199,21 @@ void SimulationPhotonProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_relaxation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_detailed_pair_production_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_interaction_mode_on );
+
+  // Archives created before the tabular incoherent sampling mode and the
+  // integrated cross section table tolerance were added do not have them -
+  // the tabular sampling and the tables will be turned off
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_tabular_incoherent_sampling_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_integrated_cs_table_tolerance );
+  }
+  else
+  {
+    d_tabular_incoherent_sampling_mode_on = false;
+    d_integrated_cs_table_tolerance = 0.0;
+  }
+
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
 }
@@ -186,7 +222,7 @@ void SimulationPhotonProperties::serialize( Archive& ar,
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationPhotonProperties, "SimulationPhotonProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationPhotonProperties );
 
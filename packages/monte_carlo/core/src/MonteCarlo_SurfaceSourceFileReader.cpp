@@ -0,0 +1,373 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFileReader.cpp
+//! \author Alex Robinson
+//! \brief  Surface source file reader class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+// System Includes
+#include <fcntl.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceFileReader.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+SurfaceSourceFileReader::SurfaceSourceFileReader(
+                                    const boost::filesystem::path& file_name )
+  : d_file_name( file_name ),
+    d_file_descriptor( -1 ),
+    d_number_of_source_histories( 0 ),
+    d_index()
+{
+  d_file_descriptor = ::open( d_file_name.string().c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( d_file_descriptor < 0,
+                      std::runtime_error,
+                      "The surface source file " << d_file_name <<
+                      " could not be opened (" << std::strerror( errno ) <<
+                      ")!" );
+
+  // The file must be closed if the index cannot be loaded since the
+  // destructor will not be called
+  try{
+    this->loadIndex();
+  }
+  catch( ... )
+  {
+    ::close( d_file_descriptor );
+
+    throw;
+  }
+}
+
+// Load the history index
+void SurfaceSourceFileReader::loadIndex()
+{
+  const off_t file_size = ::lseek( d_file_descriptor, 0, SEEK_END );
+
+  TEST_FOR_EXCEPTION( file_size < (off_t)(SurfaceSourceFileWriter::s_header_size +
+                                          SurfaceSourceFileWriter::s_footer_size),
+                      std::runtime_error,
+                      "The file " << d_file_name << " is not a surface "
+                      "source file!" );
+
+  // Check the header
+  std::vector<char> header( SurfaceSourceFileWriter::s_header_size );
+
+  this->readAtOffset( header.data(), header.size(), 0 );
+
+  size_t position = sizeof(SurfaceSourceFileWriter::s_magic_string);
+
+  TEST_FOR_EXCEPTION( std::memcmp( header.data(),
+                                   SurfaceSourceFileWriter::s_magic_string,
+                                   position ) != 0,
+                      std::runtime_error,
+                      "The file " << d_file_name << " is not a surface "
+                      "source file!" );
+
+  const uint32_t version = this->readFromRecord<uint32_t>( header, position );
+
+  TEST_FOR_EXCEPTION( version != SurfaceSourceFileWriter::s_version,
+                      std::runtime_error,
+                      "The surface source file " << d_file_name <<
+                      " has an unsupported version (" << version << ")!" );
+
+  // Read the footer
+  std::vector<char> footer( SurfaceSourceFileWriter::s_footer_size );
+
+  this->readAtOffset( footer.data(),
+                      footer.size(),
+                      file_size - footer.size() );
+
+  TEST_FOR_EXCEPTION( std::memcmp( footer.data() + 3*sizeof(uint64_t),
+                                   SurfaceSourceFileWriter::s_magic_string,
+                                   sizeof(SurfaceSourceFileWriter::s_magic_string) ) != 0,
+                      std::runtime_error,
+                      "The surface source file " << d_file_name <<
+                      " does not have an index (was the file closed?)!" );
+
+  position = 0;
+
+  const uint64_t index_offset =
+    this->readFromRecord<uint64_t>( footer, position );
+
+  const uint64_t index_size =
+    this->readFromRecord<uint64_t>( footer, position );
+
+  d_number_of_source_histories =
+    this->readFromRecord<uint64_t>( footer, position );
+
+  // Read the index
+  std::vector<char> index( index_size*4*sizeof(uint64_t) );
+
+  this->readAtOffset( index.data(), index.size(), index_offset );
+
+  d_index.resize( index_size );
+  position = 0;
+
+  for( size_t i = 0; i < index_size; ++i )
+  {
+    Utility::get<0>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+    Utility::get<1>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+    Utility::get<2>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+    Utility::get<3>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+  }
+}
+
+// Destructor
+SurfaceSourceFileReader::~SurfaceSourceFileReader()
+{
+  if( d_file_descriptor >= 0 )
+    ::close( d_file_descriptor );
+}
+
+// Return the surface source file name
+const boost::filesystem::path& SurfaceSourceFileReader::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the number of source histories used to create the file
+uint64_t SurfaceSourceFileReader::getNumberOfSourceHistories() const
+{
+  return d_number_of_source_histories;
+}
+
+// Return the number of stored histories (histories with crossings)
+size_t SurfaceSourceFileReader::getNumberOfStoredHistories() const
+{
+  return d_index.size();
+}
+
+// Return the history number of a stored history
+uint64_t SurfaceSourceFileReader::getStoredHistoryNumber(
+                                   const size_t stored_history_index ) const
+{
+  // Make sure the stored history index is valid
+  testPrecondition( stored_history_index < d_index.size() );
+
+  return Utility::get<0>( d_index[stored_history_index] );
+}
+
+// Return the history ordinal of a stored history
+/*! \details The history ordinal is the number of source histories in the
+ * file with a lower history number.
+ */
+uint64_t SurfaceSourceFileReader::getStoredHistoryOrdinal(
+                                   const size_t stored_history_index ) const
+{
+  // Make sure the stored history index is valid
+  testPrecondition( stored_history_index < d_index.size() );
+
+  return Utility::get<1>( d_index[stored_history_index] );
+}
+
+// Check if a history is in the file
+bool SurfaceSourceFileReader::isHistoryInFile(
+                                        const uint64_t history_number ) const
+{
+  return this->findIndexEntry( history_number ) != d_index.end();
+}
+
+// Check if the history with the ordinal is in the file
+bool SurfaceSourceFileReader::isHistoryOrdinalInFile(
+                                       const uint64_t history_ordinal ) const
+{
+  return this->findIndexEntryWithOrdinal( history_ordinal ) != d_index.end();
+}
+
+// Find the index entry of a history
+auto SurfaceSourceFileReader::findIndexEntry(
+           const uint64_t history_number ) const -> std::vector<IndexEntry>::const_iterator
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    std::lower_bound( d_index.begin(), d_index.end(), history_number,
+                      []( const IndexEntry& entry, const uint64_t value ){
+                        return Utility::get<0>( entry ) < value;
+                      } );
+
+  if( index_entry != d_index.end() &&
+      Utility::get<0>( *index_entry ) != history_number )
+    return d_index.end();
+  else
+    return index_entry;
+}
+
+// Find the index entry of the history with the ordinal
+/*! \details The history ordinals increase with the history numbers so the
+ * index is also sorted by history ordinal.
+ */
+auto SurfaceSourceFileReader::findIndexEntryWithOrdinal(
+          const uint64_t history_ordinal ) const -> std::vector<IndexEntry>::const_iterator
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    std::lower_bound( d_index.begin(), d_index.end(), history_ordinal,
+                      []( const IndexEntry& entry, const uint64_t value ){
+                        return Utility::get<1>( entry ) < value;
+                      } );
+
+  if( index_entry != d_index.end() &&
+      Utility::get<1>( *index_entry ) != history_ordinal )
+    return d_index.end();
+  else
+    return index_entry;
+}
+
+// Read the particles of a stored history
+/*! \details This method is thread-safe.
+ */
+void SurfaceSourceFileReader::readStoredHistory(
+                  const size_t stored_history_index,
+                  std::vector<SurfaceSourceParticleRecord>& particles ) const
+{
+  // Make sure the stored history index is valid
+  testPrecondition( stored_history_index < d_index.size() );
+
+  const IndexEntry& index_entry = d_index[stored_history_index];
+
+  std::vector<char> record( Utility::get<3>( index_entry ) );
+
+  this->readAtOffset( record.data(),
+                      record.size(),
+                      Utility::get<2>( index_entry ) );
+
+  size_t position = 0;
+
+  const uint64_t record_history_number =
+    this->readFromRecord<uint64_t>( record, position );
+
+  TEST_FOR_EXCEPTION( record_history_number != Utility::get<0>( index_entry ),
+                      std::runtime_error,
+                      "The surface source file " << d_file_name <<
+                      " is corrupt (history " << Utility::get<0>( index_entry )
+                      << " has an invalid record)!" );
+
+  const uint32_t number_of_particles =
+    this->readFromRecord<uint32_t>( record, position );
+
+  particles.resize( number_of_particles );
+
+  for( auto&& particle : particles )
+  {
+    particle.particle_type =
+      (ParticleType)this->readFromRecord<uint32_t>( record, position );
+    particle.surface_id = this->readFromRecord<uint64_t>( record, position );
+
+    for( size_t i = 0; i < 3; ++i )
+      particle.position[i] = this->readFromRecord<double>( record, position );
+
+    for( size_t i = 0; i < 3; ++i )
+      particle.direction[i] = this->readFromRecord<double>( record, position );
+
+    particle.energy = this->readFromRecord<double>( record, position );
+    particle.time = this->readFromRecord<double>( record, position );
+    particle.weight = this->readFromRecord<double>( record, position );
+  }
+}
+
+// Read the particles of a history
+/*! \details This method is thread-safe.
+ */
+void SurfaceSourceFileReader::readHistory(
+                  const uint64_t history_number,
+                  std::vector<SurfaceSourceParticleRecord>& particles ) const
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    this->findIndexEntry( history_number );
+
+  TEST_FOR_EXCEPTION( index_entry == d_index.end(),
+                      std::runtime_error,
+                      "History " << history_number << " is not in the "
+                      "surface source file " << d_file_name << "!" );
+
+  this->readStoredHistory( std::distance( d_index.begin(), index_entry ),
+                           particles );
+}
+
+// Read the particles of the history with the ordinal
+/*! \details This method is thread-safe.
+ */
+void SurfaceSourceFileReader::readHistoryWithOrdinal(
+                  const uint64_t history_ordinal,
+                  std::vector<SurfaceSourceParticleRecord>& particles ) const
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    this->findIndexEntryWithOrdinal( history_ordinal );
+
+  TEST_FOR_EXCEPTION( index_entry == d_index.end(),
+                      std::runtime_error,
+                      "The history with ordinal " << history_ordinal <<
+                      " is not in the surface source file " << d_file_name <<
+                      "!" );
+
+  this->readStoredHistory( std::distance( d_index.begin(), index_entry ),
+                           particles );
+}
+
+// Read a value from a record
+template<typename T>
+T SurfaceSourceFileReader::readFromRecord( const std::vector<char>& record,
+                                           size_t& position )
+{
+  TEST_FOR_EXCEPTION( position + sizeof(T) > record.size(),
+                      std::runtime_error,
+                      "Attempted to read past the end of a surface source "
+                      "file record!" );
+
+  T value;
+
+  std::memcpy( &value, record.data() + position, sizeof(T) );
+
+  position += sizeof(T);
+
+  return value;
+}
+
+// Read data at the requested file offset
+void SurfaceSourceFileReader::readAtOffset( char* data,
+                                            const size_t size,
+                                            const uint64_t offset ) const
+{
+  size_t bytes_read = 0;
+
+  while( bytes_read < size )
+  {
+    const ssize_t result = ::pread( d_file_descriptor,
+                                    data + bytes_read,
+                                    size - bytes_read,
+                                    offset + bytes_read );
+
+    if( result < 0 && errno == EINTR )
+      continue;
+
+    TEST_FOR_EXCEPTION( result <= 0,
+                        std::runtime_error,
+                        "Could not read from the surface source file "
+                        << d_file_name << " ("
+                        << (result == 0 ? "unexpected end of file" :
+                            std::strerror( errno )) << ")!" );
+
+    bytes_read += result;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFileReader.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFileReader.hpp
+//! \author Alex Robinson
+//! \brief  Surface source file reader class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_FILE_READER_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_FILE_READER_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceFileWriter.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source file reader class
+ * \details Only the history index of the surface source file is loaded when
+ * the reader is constructed. The particles of a stored history are read on
+ * demand with positional reads, so any number of threads can read from the
+ * same reader without acquiring a lock (see
+ * MonteCarlo::SurfaceSourceFileWriter for the layout). A stored history can
+ * be found with its history number or with its history ordinal.
+ */
+class SurfaceSourceFileReader : private boost::noncopyable
+{
+
+public:
+
+  //! Constructor
+  SurfaceSourceFileReader( const boost::filesystem::path& file_name );
+
+  //! Destructor
+  ~SurfaceSourceFileReader();
+
+  //! Return the surface source file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the number of source histories used to create the file
+  uint64_t getNumberOfSourceHistories() const;
+
+  //! Return the number of stored histories (histories with crossings)
+  size_t getNumberOfStoredHistories() const;
+
+  //! Return the history number of a stored history
+  uint64_t getStoredHistoryNumber( const size_t stored_history_index ) const;
+
+  //! Return the history ordinal of a stored history
+  uint64_t getStoredHistoryOrdinal( const size_t stored_history_index ) const;
+
+  //! Check if a history is in the file
+  bool isHistoryInFile( const uint64_t history_number ) const;
+
+  //! Check if the history with the ordinal is in the file
+  bool isHistoryOrdinalInFile( const uint64_t history_ordinal ) const;
+
+  //! Read the particles of a stored history
+  void readStoredHistory(
+               const size_t stored_history_index,
+               std::vector<SurfaceSourceParticleRecord>& particles ) const;
+
+  //! Read the particles of a history
+  void readHistory( const uint64_t history_number,
+                    std::vector<SurfaceSourceParticleRecord>& particles ) const;
+
+  //! Read the particles of the history with the ordinal
+  void readHistoryWithOrdinal(
+                    const uint64_t history_ordinal,
+                    std::vector<SurfaceSourceParticleRecord>& particles ) const;
+
+private:
+
+  // Load the history index
+  void loadIndex();
+
+  // Read a value from a record
+  template<typename T>
+  static T readFromRecord( const std::vector<char>& record, size_t& position );
+
+  // Read data at the requested file offset
+  void readAtOffset( char* data,
+                     const size_t size,
+                     const uint64_t offset ) const;
+
+  // The history index entry (history number, history ordinal, record
+  // offset, record size)
+  typedef std::tuple<uint64_t,uint64_t,uint64_t,uint64_t> IndexEntry;
+
+  // Find the index entry of a history
+  std::vector<IndexEntry>::const_iterator findIndexEntry(
+                                       const uint64_t history_number ) const;
+
+  // Find the index entry of the history with the ordinal
+  std::vector<IndexEntry>::const_iterator findIndexEntryWithOrdinal(
+                                      const uint64_t history_ordinal ) const;
+
+  // The surface source file name
+  boost::filesystem::path d_file_name;
+
+  // The surface source file descriptor
+  int d_file_descriptor;
+
+  // The number of source histories
+  uint64_t d_number_of_source_histories;
+
+  // The history index
+  std::vector<IndexEntry> d_index;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_FILE_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFileReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,418 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Surface source file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+// System Includes
+#include <fcntl.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceFileWriter.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+// Append a value to a surface source record buffer
+template<typename T>
+inline void appendToSurfaceSourceRecord( std::vector<char>& record,
+                                         const T& value )
+{
+  const size_t start = record.size();
+
+  record.resize( start + sizeof(T) );
+
+  std::memcpy( record.data() + start, &value, sizeof(T) );
+}
+
+} // end Details namespace
+
+// Initialize static member data
+const char SurfaceSourceFileWriter::s_magic_string[8] =
+  {'F', 'R', 'N', 'S', 'S', 'R', 'C', '\0'};
+
+const uint32_t SurfaceSourceFileWriter::s_version = 2u;
+
+const size_t SurfaceSourceFileWriter::s_header_size =
+  sizeof(s_magic_string) + 2*sizeof(uint32_t);
+
+const size_t SurfaceSourceFileWriter::s_footer_size =
+  3*sizeof(uint64_t) + sizeof(s_magic_string);
+
+const size_t SurfaceSourceFileWriter::s_history_header_size =
+  sizeof(uint64_t) + sizeof(uint32_t);
+
+const size_t SurfaceSourceFileWriter::s_particle_record_size =
+  sizeof(uint32_t) + sizeof(uint64_t) + 9*sizeof(double);
+
+// Constructor
+SurfaceSourceFileWriter::SurfaceSourceFileWriter(
+                                   const boost::filesystem::path& file_name,
+                                   const unsigned number_of_threads,
+                                   const size_t chunk_size )
+  : d_file_name( file_name ),
+    d_file_descriptor( -1 ),
+    d_chunk_size( chunk_size ),
+    d_file_offset( s_header_size ),
+    d_thread_buffers( number_of_threads )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  for( auto&& thread_buffer : d_thread_buffers )
+    thread_buffer.number_of_source_histories = 0;
+
+  d_file_descriptor = ::open( d_file_name.string().c_str(),
+                              O_WRONLY | O_CREAT | O_TRUNC,
+                              0644 );
+
+  TEST_FOR_EXCEPTION( d_file_descriptor < 0,
+                      std::runtime_error,
+                      "The surface source file " << d_file_name <<
+                      " could not be opened (" << std::strerror( errno ) <<
+                      ")!" );
+
+  // Write the header
+  std::vector<char> header;
+  header.reserve( s_header_size );
+
+  for( size_t i = 0; i < sizeof(s_magic_string); ++i )
+    Details::appendToSurfaceSourceRecord( header, s_magic_string[i] );
+
+  Details::appendToSurfaceSourceRecord( header, s_version );
+  Details::appendToSurfaceSourceRecord( header, (uint32_t)0 );
+
+  this->writeAtOffset( header.data(), header.size(), 0 );
+}
+
+// Destructor
+SurfaceSourceFileWriter::~SurfaceSourceFileWriter()
+{
+  try{
+    this->close();
+  }
+  catch( ... )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Surface Source File",
+                                "The surface source file "
+                                << d_file_name <<
+                                " could not be closed properly!" );
+  }
+}
+
+// Return the surface source file name
+const boost::filesystem::path& SurfaceSourceFileWriter::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the chunk size (bytes)
+size_t SurfaceSourceFileWriter::getChunkSize() const
+{
+  return d_chunk_size;
+}
+
+// Enable support for multiple threads
+/*! \details This must only be called from the root thread before any
+ * histories have been added from a parallel region.
+ */
+void SurfaceSourceFileWriter::enableThreadSupport(
+                                            const unsigned number_of_threads )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+
+  if( number_of_threads > d_thread_buffers.size() )
+  {
+    const size_t old_size = d_thread_buffers.size();
+
+    d_thread_buffers.resize( number_of_threads );
+
+    for( size_t i = old_size; i < d_thread_buffers.size(); ++i )
+      d_thread_buffers[i].number_of_source_histories = 0;
+  }
+}
+
+// Add the surface crossings of a completed history
+/*! \details Every completed history must be added (even if there were no
+ * surface crossings) so that the number of source histories and the history
+ * ordinals are correct. A history number must only be added once. The added
+ * history numbers are stored as ranges of consecutive numbers, so a thread
+ * that adds ascending consecutive history numbers only stores one range.
+ * Histories without surface crossings are not stored in the file. The
+ * history will be appended to the buffer of the calling thread. If the
+ * buffer exceeds the chunk size it will be written to the file. No locks are
+ * acquired.
+ */
+void SurfaceSourceFileWriter::addHistory(
+                 const ParticleState::historyNumberType history_number,
+                 const std::vector<SurfaceSourceParticleRecord>& particles )
+{
+  // Make sure the file is open
+  testPrecondition( this->isOpen() );
+  // Make sure thread support has been enabled
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_buffers.size() );
+
+  ThreadBuffer& thread_buffer =
+    d_thread_buffers[Utility::OpenMPProperties::getThreadId()];
+
+  ++thread_buffer.number_of_source_histories;
+
+  if( !thread_buffer.history_ranges.empty() &&
+      thread_buffer.history_ranges.back().second == history_number )
+    ++thread_buffer.history_ranges.back().second;
+  else
+  {
+    thread_buffer.history_ranges.push_back(
+                          HistoryRange( history_number, history_number+1 ) );
+  }
+
+  if( particles.empty() )
+    return;
+
+  std::vector<char>& records = thread_buffer.records;
+
+  const size_t record_start = records.size();
+
+  records.reserve( record_start + s_history_header_size +
+                   particles.size()*s_particle_record_size );
+
+  Details::appendToSurfaceSourceRecord( records, (uint64_t)history_number );
+  Details::appendToSurfaceSourceRecord( records, (uint32_t)particles.size() );
+
+  for( auto&& particle : particles )
+  {
+    Details::appendToSurfaceSourceRecord( records,
+                                          (uint32_t)particle.particle_type );
+    Details::appendToSurfaceSourceRecord( records,
+                                          (uint64_t)particle.surface_id );
+
+    for( size_t i = 0; i < 3; ++i )
+      Details::appendToSurfaceSourceRecord( records, particle.position[i] );
+
+    for( size_t i = 0; i < 3; ++i )
+      Details::appendToSurfaceSourceRecord( records, particle.direction[i] );
+
+    Details::appendToSurfaceSourceRecord( records, particle.energy );
+    Details::appendToSurfaceSourceRecord( records, particle.time );
+    Details::appendToSurfaceSourceRecord( records, particle.weight );
+  }
+
+  thread_buffer.record_index.push_back(
+                        std::make_tuple( (uint64_t)history_number,
+                                         (uint64_t)record_start,
+                                         (uint64_t)(records.size() - record_start) ) );
+
+  if( records.size() >= d_chunk_size )
+    this->flushThreadBuffer( thread_buffer );
+}
+
+// Flush the buffer of a thread
+void SurfaceSourceFileWriter::flushThreadBuffer( ThreadBuffer& thread_buffer )
+{
+  if( thread_buffer.records.empty() )
+    return;
+
+  // Reserve the file region that this chunk will occupy
+  const uint64_t chunk_offset =
+    d_file_offset.fetch_add( thread_buffer.records.size() );
+
+  this->writeAtOffset( thread_buffer.records.data(),
+                       thread_buffer.records.size(),
+                       chunk_offset );
+
+  for( auto&& index_entry : thread_buffer.record_index )
+  {
+    Utility::get<1>( index_entry ) += chunk_offset;
+
+    thread_buffer.index.push_back( index_entry );
+  }
+
+  thread_buffer.records.clear();
+  thread_buffer.record_index.clear();
+}
+
+// Flush the buffers of every thread
+/*! \details This must only be called from the root thread outside of a
+ * parallel region.
+ */
+void SurfaceSourceFileWriter::flush()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->isOpen() )
+  {
+    for( auto&& thread_buffer : d_thread_buffers )
+      this->flushThreadBuffer( thread_buffer );
+  }
+}
+
+// Write the index and close the file
+void SurfaceSourceFileWriter::close()
+{
+  if( !this->isOpen() )
+    return;
+
+  this->flush();
+
+  // Merge the thread indices
+  std::vector<IndexEntry> index;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+  {
+    index.insert( index.end(),
+                  thread_buffer.index.begin(),
+                  thread_buffer.index.end() );
+
+    thread_buffer.index.clear();
+  }
+
+  std::sort( index.begin(), index.end() );
+
+  // Merge the added history number ranges
+  std::vector<HistoryRange> history_ranges;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+  {
+    history_ranges.insert( history_ranges.end(),
+                           thread_buffer.history_ranges.begin(),
+                           thread_buffer.history_ranges.end() );
+
+    thread_buffer.history_ranges.clear();
+  }
+
+  std::sort( history_ranges.begin(), history_ranges.end() );
+
+  // Write the index and the footer
+  std::vector<char> index_and_footer;
+  index_and_footer.reserve( index.size()*4*sizeof(uint64_t) + s_footer_size );
+
+  std::vector<HistoryRange>::const_iterator history_range =
+    history_ranges.begin();
+
+  uint64_t history_ordinal_offset = 0;
+
+  for( auto&& index_entry : index )
+  {
+    // Find the range that contains the history (every stored history
+    // number is in one of the ranges)
+    while( history_range->second <= Utility::get<0>( index_entry ) )
+    {
+      history_ordinal_offset += history_range->second - history_range->first;
+
+      ++history_range;
+    }
+
+    const uint64_t history_ordinal = history_ordinal_offset +
+      (Utility::get<0>( index_entry ) - history_range->first);
+
+    Details::appendToSurfaceSourceRecord( index_and_footer,
+                                          Utility::get<0>( index_entry ) );
+    Details::appendToSurfaceSourceRecord( index_and_footer, history_ordinal );
+    Details::appendToSurfaceSourceRecord( index_and_footer,
+                                          Utility::get<1>( index_entry ) );
+    Details::appendToSurfaceSourceRecord( index_and_footer,
+                                          Utility::get<2>( index_entry ) );
+  }
+
+  const uint64_t index_offset = d_file_offset.load();
+
+  Details::appendToSurfaceSourceRecord( index_and_footer, index_offset );
+  Details::appendToSurfaceSourceRecord( index_and_footer,
+                                        (uint64_t)index.size() );
+  Details::appendToSurfaceSourceRecord( index_and_footer,
+                                        this->getNumberOfSourceHistories() );
+
+  for( size_t i = 0; i < sizeof(s_magic_string); ++i )
+    Details::appendToSurfaceSourceRecord( index_and_footer, s_magic_string[i] );
+
+  this->writeAtOffset( index_and_footer.data(),
+                       index_and_footer.size(),
+                       index_offset );
+
+  ::close( d_file_descriptor );
+
+  d_file_descriptor = -1;
+}
+
+// Check if the file is open
+bool SurfaceSourceFileWriter::isOpen() const
+{
+  return d_file_descriptor >= 0;
+}
+
+// Return the number of source histories that have been added
+uint64_t SurfaceSourceFileWriter::getNumberOfSourceHistories() const
+{
+  uint64_t number_of_source_histories = 0;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+    number_of_source_histories += thread_buffer.number_of_source_histories;
+
+  return number_of_source_histories;
+}
+
+// Return the number of stored histories that have been written
+/*! \details Only histories that have been flushed to the file are counted.
+ */
+size_t SurfaceSourceFileWriter::getNumberOfStoredHistories() const
+{
+  size_t number_of_histories = 0;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+    number_of_histories += thread_buffer.index.size();
+
+  return number_of_histories;
+}
+
+// Write data at the requested file offset
+void SurfaceSourceFileWriter::writeAtOffset( const char* data,
+                                             const size_t size,
+                                             const uint64_t offset ) const
+{
+  size_t bytes_written = 0;
+
+  while( bytes_written < size )
+  {
+    const ssize_t result = ::pwrite( d_file_descriptor,
+                                     data + bytes_written,
+                                     size - bytes_written,
+                                     offset + bytes_written );
+
+    if( result < 0 && errno == EINTR )
+      continue;
+
+    TEST_FOR_EXCEPTION( result <= 0,
+                        std::runtime_error,
+                        "Could not write to the surface source file "
+                        << d_file_name << " ("
+                        << std::strerror( errno ) << ")!" );
+
+    bytes_written += result;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFileWriter.cpp
+//---------------------------------------------------------------------------//
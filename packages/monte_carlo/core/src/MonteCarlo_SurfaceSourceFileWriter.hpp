@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  Surface source file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_FILE_WRITER_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <atomic>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_ParticleType.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_Tuple.hpp"
+
+namespace MonteCarlo{
+
+//! The surface source particle record
+struct SurfaceSourceParticleRecord
+{
+  //! The particle type
+  ParticleType particle_type;
+
+  //! The surface that was crossed
+  Geometry::Model::EntityId surface_id;
+
+  //! The position of the particle on the surface
+  double position[3];
+
+  //! The direction of the particle
+  double direction[3];
+
+  //! The energy of the particle (MeV)
+  double energy;
+
+  //! The time of the particle (s)
+  double time;
+
+  //! The weight of the particle
+  double weight;
+};
+
+/*! The surface source file writer class
+ * \details Each thread appends the surface crossings of its completed
+ * histories to its own buffer. When a buffer exceeds the chunk size it is
+ * written to the file by the owning thread at a file region that has been
+ * reserved with an atomic offset, so threads never wait for each other (see
+ * MonteCarlo::ParticleTrackFileWriter). Histories without any surface
+ * crossings are counted but not stored, which allows a reader to reproduce
+ * the normalization of the run that created the file. Each stored history
+ * also records its ordinal, which is the number of added histories with a
+ * lower history number. The ordinals of a file always lie in [0,N), where N
+ * is the number of source histories, even if the file only received a
+ * subset of the history numbers of a run (e.g. one process of a distributed
+ * run or a restarted run). The surface source file layout is:
+ * <ul>
+ *  <li>header: magic string (8 bytes), version (uint32), padding (uint32)</li>
+ *  <li>history records: history number (uint64), number of particles
+ *      (uint32), and for each particle the particle type (uint32), surface
+ *      id (uint64) and the position (x, y, z), direction (u, v, w), energy,
+ *      time and weight as doubles</li>
+ *  <li>index: history number (uint64), history ordinal (uint64), record
+ *      offset (uint64) and record size (uint64) of every stored history
+ *      sorted by history number</li>
+ *  <li>footer: index offset (uint64), number of stored histories (uint64),
+ *      number of source histories (uint64), magic string (8 bytes)</li>
+ * </ul>
+ * All values are stored in the native byte order of the machine.
+ */
+class SurfaceSourceFileWriter : private boost::noncopyable
+{
+
+public:
+
+  //! The surface source file magic string
+  static const char s_magic_string[8];
+
+  //! The surface source file version
+  static const uint32_t s_version;
+
+  //! The size of the surface source file header (bytes)
+  static const size_t s_header_size;
+
+  //! The size of the surface source file footer (bytes)
+  static const size_t s_footer_size;
+
+  //! The size of a history record header (bytes)
+  static const size_t s_history_header_size;
+
+  //! The size of a particle record (bytes)
+  static const size_t s_particle_record_size;
+
+  //! Constructor
+  SurfaceSourceFileWriter( const boost::filesystem::path& file_name,
+                           const unsigned number_of_threads = 1u,
+                           const size_t chunk_size = 1048576 );
+
+  //! Destructor
+  ~SurfaceSourceFileWriter();
+
+  //! Return the surface source file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the chunk size (bytes)
+  size_t getChunkSize() const;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned number_of_threads );
+
+  //! Add the surface crossings of a completed history
+  void addHistory( const ParticleState::historyNumberType history_number,
+                   const std::vector<SurfaceSourceParticleRecord>& particles );
+
+  //! Flush the buffers of every thread
+  void flush();
+
+  //! Write the index and close the file
+  void close();
+
+  //! Check if the file is open
+  bool isOpen() const;
+
+  //! Return the number of source histories that have been added
+  uint64_t getNumberOfSourceHistories() const;
+
+  //! Return the number of stored histories that have been written
+  size_t getNumberOfStoredHistories() const;
+
+private:
+
+  // The history index entry (history number, record offset, record size)
+  typedef std::tuple<uint64_t,uint64_t,uint64_t> IndexEntry;
+
+  // The history number range [first,last)
+  typedef std::pair<uint64_t,uint64_t> HistoryRange;
+
+  // The thread buffer
+  struct ThreadBuffer
+  {
+    // The unwritten records
+    std::vector<char> records;
+
+    // The unwritten record index entries (offsets relative to the buffer)
+    std::vector<IndexEntry> record_index;
+
+    // The written record index entries
+    std::vector<IndexEntry> index;
+
+    // The number of source histories
+    uint64_t number_of_source_histories;
+
+    // The ranges of the added history numbers
+    std::vector<HistoryRange> history_ranges;
+  };
+
+  // Flush the buffer of a thread
+  void flushThreadBuffer( ThreadBuffer& thread_buffer );
+
+  // Write data at the requested file offset
+  void writeAtOffset( const char* data,
+                      const size_t size,
+                      const uint64_t offset ) const;
+
+  // The surface source file name
+  boost::filesystem::path d_file_name;
+
+  // The surface source file descriptor
+  int d_file_descriptor;
+
+  // The chunk size
+  size_t d_chunk_size;
+
+  // The next free file offset
+  std::atomic<uint64_t> d_file_offset;
+
+  // The thread buffers
+  std::vector<ThreadBuffer> d_thread_buffers;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceFileWriter.hpp
+//---------------------------------------------------------------------------//
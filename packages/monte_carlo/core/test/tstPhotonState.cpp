@@ -74,6 +74,32 @@ FRENSIE_UNIT_TEST( PhotonState, advance )
   FRENSIE_CHECK_FLOATING_EQUALITY( particle.getTime(), 5.7774996046392e-11, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Advance the particle along its direction to a point in a known cell
+FRENSIE_UNIT_TEST( PhotonState, advanceToPointInCell )
+{
+  const double position[3] = {1.0, 1.0, 1.0};
+  const double direction[3] = {0.5773502691896258,
+			       0.5773502691896258,
+			       0.5773502691896258};
+
+  MonteCarlo::PhotonState particle( 1ull );
+  particle.setPosition( position );
+  particle.setDirection( direction );
+  particle.setEnergy( 1.0 );
+  particle.setTime( 0.0 );
+
+  const Geometry::Model::EntityId cell = particle.getCell();
+
+  particle.advanceToPointInCell( 1.7320508075688772, cell );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( particle.getXPosition(), 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( particle.getYPosition(), 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( particle.getZPosition(), 2.0, 1e-12 );
+  FRENSIE_CHECK_EQUAL( particle.getCell(), cell );
+  FRENSIE_CHECK_FLOATING_EQUALITY( particle.getTime(), 5.7774996046392e-11, 1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the photon state can be cloned
 FRENSIE_UNIT_TEST( PhotonState, clone )
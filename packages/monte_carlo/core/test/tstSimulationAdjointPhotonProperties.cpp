@@ -39,6 +39,7 @@ FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getAdjointKleinNishinaSamplingType(),
                        MonteCarlo::TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING );
   FRENSIE_CHECK_EQUAL( properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
+  FRENSIE_CHECK_EQUAL( properties.getAdjointIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-30 );
 }
@@ -154,6 +155,27 @@ FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the integrated cross section table tolerance can be set
+FRENSIE_UNIT_TEST( SimulationAdjointPhotonProperties,
+                   setAdjointIntegratedCrossSectionTableTolerance )
+{
+  MonteCarlo::SimulationAdjointPhotonProperties properties;
+
+  properties.setAdjointIntegratedCrossSectionTableTolerance( 1e-4 );
+
+  FRENSIE_CHECK_EQUAL( properties.getAdjointIntegratedCrossSectionTableTolerance(),
+                       1e-4 );
+
+  FRENSIE_CHECK_THROW( properties.setAdjointIntegratedCrossSectionTableTolerance( -1e-4 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setAdjointIntegratedCrossSectionTableTolerance( 1.0 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( properties.getAdjointIntegratedCrossSectionTableTolerance(),
+                       1e-4 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
@@ -185,6 +207,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
     custom_properties.setAdjointKleinNishinaSamplingType(
                   MonteCarlo::THREE_BRANCH_INVERSE_MIXED_ADJOINT_KN_SAMPLING );
     custom_properties.setCriticalAdjointPhotonLineEnergies( std::vector<double>({1.0, 10.0}) );
+    custom_properties.setAdjointIntegratedCrossSectionTableTolerance( 1e-4 );
     custom_properties.setAdjointPhotonRouletteThresholdWeight( 1e-15 );
     custom_properties.setAdjointPhotonRouletteSurvivalWeight( 1e-13 );
 
@@ -215,6 +238,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getAdjointKleinNishinaSamplingType(),
                        MonteCarlo::TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING );
   FRENSIE_CHECK_EQUAL( default_properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
+  FRENSIE_CHECK_EQUAL( default_properties.getAdjointIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( default_properties.getAdjointPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-30  );
 
@@ -234,6 +258,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationAdjointPhotonProperties,
                        MonteCarlo::THREE_BRANCH_INVERSE_MIXED_ADJOINT_KN_SAMPLING );
   FRENSIE_CHECK_EQUAL( custom_properties.getCriticalAdjointPhotonLineEnergies(),
                        std::vector<double>({1.0, 10.0}) );
+  FRENSIE_CHECK_EQUAL( custom_properties.getAdjointIntegratedCrossSectionTableTolerance(), 1e-4 );
   FRENSIE_CHECK_EQUAL( custom_properties.getAdjointPhotonRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-13 );
 }
@@ -39,6 +39,8 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, defaults )
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !properties.isTabularIncoherentSamplingModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteSurvivalWeight(), 1e-30 );
 }
@@ -144,6 +146,48 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, setPhotonuclearInteractionModeOnO
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the tabular incoherent sampling mode can be turned on
+FRENSIE_UNIT_TEST( SimulationPhotonProperties,
+                   setTabularIncoherentSamplingModeOnOff )
+{
+  MonteCarlo::SimulationPhotonProperties properties;
+
+  properties.setTabularIncoherentSamplingModeOn();
+
+  FRENSIE_CHECK( properties.isTabularIncoherentSamplingModeOn() );
+
+  properties.setTabularIncoherentSamplingModeOff();
+
+  FRENSIE_CHECK( !properties.isTabularIncoherentSamplingModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the integrated cross section table tolerance can be set
+FRENSIE_UNIT_TEST( SimulationPhotonProperties,
+                   setIntegratedCrossSectionTableTolerance )
+{
+  MonteCarlo::SimulationPhotonProperties properties;
+
+  properties.setIntegratedCrossSectionTableTolerance( 1e-4 );
+
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(),
+                       1e-4 );
+
+  FRENSIE_CHECK_THROW( properties.setIntegratedCrossSectionTableTolerance( -1e-4 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setIntegratedCrossSectionTableTolerance( 1.0 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(),
+                       1e-4 );
+
+  properties.setIntegratedCrossSectionTableTolerance( 0.0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(),
+                       0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the critical line energies can be set
 FRENSIE_UNIT_TEST( SimulationPhotonProperties,
@@ -205,6 +249,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
     custom_properties.setAtomicRelaxationModeOff();
     custom_properties.setDetailedPairProductionModeOn();
     custom_properties.setPhotonuclearInteractionModeOn();
+    custom_properties.setTabularIncoherentSamplingModeOn();
+    custom_properties.setIntegratedCrossSectionTableTolerance( 1e-4 );
     custom_properties.setPhotonRouletteThresholdWeight( 1e-15 );
     custom_properties.setPhotonRouletteSurvivalWeight( 1e-13 );
 
@@ -235,6 +281,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK( default_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !default_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !default_properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !default_properties.isTabularIncoherentSamplingModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteSurvivalWeight(), 1e-30  );
 
@@ -253,6 +301,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK( !custom_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( custom_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( custom_properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( custom_properties.isTabularIncoherentSamplingModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getIntegratedCrossSectionTableTolerance(), 1e-4 );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteSurvivalWeight(), 1e-13 );
 }
@@ -56,6 +56,8 @@ FRENSIE_UNIT_TEST( SimulationProperties, defaults )
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn( MonteCarlo::PHOTON ) );
   FRENSIE_CHECK( !properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !properties.isTabularIncoherentSamplingModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteSurvivalWeight(), 1e-30 );
 
@@ -71,6 +73,7 @@ FRENSIE_UNIT_TEST( SimulationProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getAdjointKleinNishinaSamplingType(),
                        MonteCarlo::TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING );
   FRENSIE_CHECK_EQUAL( properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
+  FRENSIE_CHECK_EQUAL( properties.getAdjointIntegratedCrossSectionTableTolerance(), 0.0 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getAdjointPhotonRouletteSurvivalWeight(), 1e-30 );
 
@@ -275,6 +278,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationProperties,
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn( MonteCarlo::PHOTON ) );
   FRENSIE_CHECK( !properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !properties.isTabularIncoherentSamplingModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getIntegratedCrossSectionTableTolerance(), 0.0 );
 
   FRENSIE_CHECK_EQUAL( properties.getAbsoluteMinAdjointPhotonEnergy(), 1e-3 );
   FRENSIE_CHECK_EQUAL( properties.getMinAdjointPhotonEnergy(), 1e-3 );
@@ -287,6 +292,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationProperties,
   FRENSIE_CHECK_EQUAL( properties.getAdjointKleinNishinaSamplingType(),
                        MonteCarlo::TWO_BRANCH_REJECTION_ADJOINT_KN_SAMPLING );
   FRENSIE_CHECK_EQUAL( properties.getCriticalAdjointPhotonLineEnergies().size(), 0 );
+  FRENSIE_CHECK_EQUAL( properties.getAdjointIntegratedCrossSectionTableTolerance(), 0.0 );
 
   FRENSIE_CHECK_EQUAL( properties.getAbsoluteMinElectronEnergy(), 1.5e-5 );
   FRENSIE_CHECK_EQUAL( properties.getMinElectronEnergy(), 1e-4 );
@@ -0,0 +1,18 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventObserver.cpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event observer base class template
+//!         instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventObserver.hpp"
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleCollidingGlobalEventObserver );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalEventObserver.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventObserver.hpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event observer base class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+#define MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/assume_abstract.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventTags.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle colliding global event observer
+ * \ingroup particle_colliding_global_event
+ */
+class ParticleCollidingGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for the observer event tag
+  typedef ParticleCollidingGlobalEvent EventTag;
+
+  //! Constructor
+  ParticleCollidingGlobalEventObserver()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~ParticleCollidingGlobalEventObserver()
+  { /* ... */ }
+
+  /*! Update the observer
+   * \details The particle state will be the state of the particle just
+   * before the collision with the material in the cell occurs.
+   */
+  virtual void updateFromGlobalParticleCollidingEvent(
+                                           const ParticleState& particle ) = 0;
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  { /* ... */ }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+  
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleCollidingGlobalEventObserver, 0 );
+BOOST_SERIALIZATION_ASSUME_ABSTRACT( MonteCarlo::ParticleCollidingGlobalEventObserver );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleCollidingGlobalEventObserver );
+
+#endif // end MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalObserver.hpp
+//---------------------------------------------------------------------------//
@@ -51,6 +51,18 @@
  * Infrastructure used to handle particle colliding global events.
  */
 
+/*! \defgroup particle_source_emission_global_event Particle Source Emission Global Event
+ * \ingroup global_events
+ *
+ * Infrastructure used to handle particle source emission global events.
+ */
+
+/*! \defgroup particle_secondary_emission_global_event Particle Secondary Emission Global Event
+ * \ingroup global_events
+ *
+ * Infrastructure used to handle particle secondary emission global events.
+ */
+
 /*! \defgroup particle_subtrack_ending_global_event Particle Subtrack Ending Global Event
  * \ingroup global_events
  *
@@ -94,6 +106,16 @@ struct ParticleGoneGlobalEvent{};
  */
 struct ParticleCollidingGlobalEvent{};
   
+/*! The particle source emission global event
+ * \ingroup particle_source_emission_global_event
+ */
+struct ParticleSourceEmissionGlobalEvent{};
+  
+/*! The particle secondary emission global event
+ * \ingroup particle_secondary_emission_global_event
+ */
+struct ParticleSecondaryEmissionGlobalEvent{};
+  
 /*! The particle subrack ending global event
  * \ingroup particle_subtrack_ending_global_event
  */
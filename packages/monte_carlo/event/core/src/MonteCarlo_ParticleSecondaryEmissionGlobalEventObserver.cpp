@@ -0,0 +1,18 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSecondaryEmissionGlobalEventObserver.cpp
+//! \author Alex Robinson
+//! \brief  Particle secondary emission global event observer base class template
+//!         instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventObserver.hpp"
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSecondaryEmissionGlobalEventObserver );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSecondaryEmissionGlobalEventObserver.cpp
+//---------------------------------------------------------------------------//
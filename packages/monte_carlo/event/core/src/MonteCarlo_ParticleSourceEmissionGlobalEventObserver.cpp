@@ -0,0 +1,18 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSourceEmissionGlobalEventObserver.cpp
+//! \author Alex Robinson
+//! \brief  Particle source emission global event observer base class template
+//!         instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventObserver.hpp"
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSourceEmissionGlobalEventObserver );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSourceEmissionGlobalEventObserver.cpp
+//---------------------------------------------------------------------------//
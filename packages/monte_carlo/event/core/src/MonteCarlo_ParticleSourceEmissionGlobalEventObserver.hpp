@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSourceEmissionGlobalEventObserver.hpp
+//! \author Alex Robinson
+//! \brief  Particle source emission global event observer base class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_OBSERVER_HPP
+#define MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_OBSERVER_HPP
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/assume_abstract.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventTags.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle source emission global event observer
+ * \ingroup particle_source_emission_global_event
+ */
+class ParticleSourceEmissionGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for the observer event tag
+  typedef ParticleSourceEmissionGlobalEvent EventTag;
+
+  //! Constructor
+  ParticleSourceEmissionGlobalEventObserver()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~ParticleSourceEmissionGlobalEventObserver()
+  { /* ... */ }
+
+  /*! Update the observer
+   * \details The particle state will be the state of the particle just
+   * after it has been sampled from the source (before any transport).
+   */
+  virtual void updateFromGlobalParticleSourceEmissionEvent(
+                                           const ParticleState& particle ) = 0;
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  { /* ... */ }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+  
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleSourceEmissionGlobalEventObserver, 0 );
+BOOST_SERIALIZATION_ASSUME_ABSTRACT( MonteCarlo::ParticleSourceEmissionGlobalEventObserver );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSourceEmissionGlobalEventObserver );
+
+#endif // end MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_OBSERVER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSourceEmissionGlobalObserver.hpp
+//---------------------------------------------------------------------------//
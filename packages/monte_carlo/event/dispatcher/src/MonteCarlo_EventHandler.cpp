@@ -19,6 +19,7 @@
 #include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
 #include "MonteCarlo_CellCollisionFluxEstimator.hpp"
 #include "Utility_QuantityTraits.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -52,7 +53,9 @@ EventHandler::EventHandler(
            const MonteCarlo::SimulationGeneralProperties& properties )
   : EventHandler( (std::shared_ptr<const Geometry::Model>)(*model),
                   properties )
-{ /* ... */ }
+{
+  d_filled_model = model;
+}
 
 // Constructor (model)
 /*! \details The model will be stored and used to check the validity of
@@ -398,8 +401,20 @@ void EventHandler::updateSimulationCompletionCriterionObserver( const std::share
 }
 
 // Check if the simulation is complete
+/*! \details The number of committed histories and the elapsed time will be
+ * passed to the particle history observers before the criterion is checked
+ * so that criteria based on the estimator statistics (e.g.
+ * MonteCarlo::StatisticalPrecisionParticleHistorySimulationCompletionCriterion)
+ * can process the current estimator moments.
+ */
 bool EventHandler::isSimulationComplete() const
 {
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  ParticleHistoryObserver::setNumberOfHistories( this->getNumberOfCommittedHistories() );
+  ParticleHistoryObserver::setElapsedTime( this->getElapsedTime() );
+
   return d_simulation_completion_criterion->isSimulationComplete();
 }
 
@@ -427,6 +442,36 @@ void EventHandler::addParticleTracker(
   }
 }
 
+// Add a surface source recorder to the handler
+/*! \details The recorder must be added before the simulation is started.
+ */
+void EventHandler::addSurfaceSourceRecorder(
+                     const std::shared_ptr<SurfaceSourceRecorder>& recorder )
+{
+  // Make sure the recorder is valid
+  testPrecondition( recorder.get() );
+
+  ParticleHistoryObservers::iterator observer_it =
+    std::find( d_particle_history_observers.begin(),
+               d_particle_history_observers.end(),
+               recorder );
+
+  if( observer_it == d_particle_history_observers.end() )
+  {
+    if( recorder->getParticleTypes().empty() )
+      this->registerObserver( recorder, recorder->getSurfaces() );
+    else
+    {
+      this->registerObserver( recorder,
+                              recorder->getSurfaces(),
+                              recorder->getParticleTypes() );
+    }
+
+    // Add the observer to the set
+    d_particle_history_observers.push_back( recorder );
+  }
+}
+
 // Return the number of estimators that have been added
 size_t EventHandler::getNumberOfEstimators() const
 {
@@ -467,6 +512,89 @@ const Estimator& EventHandler::getEstimator( const uint32_t estimator_id ) const
   return *d_estimators.find( estimator_id )->second;
 }
 
+// Get the next-event estimators that assume isotropic source emission
+/*! \details These are the next-event estimators that did not have a source
+ * emission pdf evaluator when they were added. They can only be used with
+ * directionally uniform sources.
+ */
+void EventHandler::getIsotropicSourceNextEventEstimatorIds(
+                             std::set<Estimator::Id>& estimator_ids ) const
+{
+  estimator_ids.insert( d_isotropic_source_next_event_estimator_ids.begin(),
+                        d_isotropic_source_next_event_estimator_ids.end() );
+}
+
+// Get the next-event estimators that assume isotropic secondary emission
+/*! \details These are the next-event estimators that did not have a
+ * secondary emission pdf evaluator when they were added. They can only be
+ * used when every secondary particle that they observe is emitted
+ * isotropically.
+ */
+void EventHandler::getIsotropicSecondaryNextEventEstimatorIds(
+                             std::set<Estimator::Id>& estimator_ids ) const
+{
+  estimator_ids.insert( d_isotropic_secondary_next_event_estimator_ids.begin(),
+                        d_isotropic_secondary_next_event_estimator_ids.end() );
+}
+
+// Get the estimators that score track lengths in any of the cells
+/*! \details Only the estimators that observe the particle subtrack ending
+ * in cell event and that are assigned the particle type will be returned.
+ */
+void EventHandler::getCellTrackLengthEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& cells,
+                         std::set<Estimator::Id>& estimator_ids ) const
+{
+  this->getObserverEstimatorIds<ParticleSubtrackEndingInCellEventObserver>(
+                                                             particle_type,
+                                                             cells,
+                                                             estimator_ids );
+}
+
+// Get the estimators that observe particles entering or leaving the cells
+/*! \details Only the estimators that observe the particle entering cell
+ * event or the particle leaving cell event (e.g. cell pulse-height
+ * estimators) and that are assigned the particle type will be returned.
+ */
+void EventHandler::getCellEnteringOrLeavingEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& cells,
+                         std::set<Estimator::Id>& estimator_ids ) const
+{
+  this->getObserverEstimatorIds<ParticleEnteringCellEventObserver>(
+                                                             particle_type,
+                                                             cells,
+                                                             estimator_ids );
+
+  this->getObserverEstimatorIds<ParticleLeavingCellEventObserver>(
+                                                             particle_type,
+                                                             cells,
+                                                             estimator_ids );
+}
+
+// Get the estimators that observe particles crossing surfaces
+/*! \details Only the estimators that observe the particle crossing surface
+ * event and that are assigned the particle type will be returned.
+ */
+void EventHandler::getSurfaceEstimatorIds(
+                               const ParticleType particle_type,
+                               std::set<Estimator::Id>& estimator_ids ) const
+{
+  EstimatorIdMap::const_iterator estimator_it = d_estimators.begin();
+
+  while( estimator_it != d_estimators.end() )
+  {
+    const Estimator& estimator = *estimator_it->second;
+
+    if( dynamic_cast<const ParticleCrossingSurfaceEventObserver*>( &estimator ) &&
+        estimator.isParticleTypeAssigned( particle_type ) )
+      estimator_ids.insert( estimator_it->first );
+
+    ++estimator_it;
+  }
+}
+
 // Check if a particle tracker with the given id exists
 bool EventHandler::doesParticleTrackerExist( const uint32_t particle_tracker_id ) const
 {
@@ -522,6 +650,14 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
 // Update observers from particle simulation started event
 void EventHandler::updateObserversFromParticleSimulationStartedEvent()
 {
+  // Compile the entity event dispatch tables - no observers can be attached
+  // or detached during the simulation
+  this->getParticleCollidingInCellEventDispatcher().compileDispatchTable();
+  this->getParticleCrossingSurfaceEventDispatcher().compileDispatchTable();
+  this->getParticleEnteringCellEventDispatcher().compileDispatchTable();
+  this->getParticleLeavingCellEventDispatcher().compileDispatchTable();
+  this->getParticleSubtrackEndingInCellEventDispatcher().compileDispatchTable();
+
   d_simulation_completion_criterion->start();
   d_simulation_timer->start();
   d_snapshot_timer->start();
@@ -757,6 +893,103 @@ double EventHandler::getElapsedTime() const
   return d_simulation_timer->elapsed().count() + d_elapsed_simulation_time;
 }
 
+// Create the next-event estimator total cross section evaluator
+/*! \details Termination cells are opaque (infinite cross section) since
+ * particles cannot travel through them.
+ */
+std::function<double(const ParticleType,const Geometry::Model::EntityId,const double)>
+EventHandler::createNextEventTotalCrossSectionEvaluator() const
+{
+  // Make sure that the filled model has been set
+  testPrecondition( d_filled_model.get() );
+
+  std::shared_ptr<const FilledGeometryModel> model = d_filled_model;
+
+  return [model]( const ParticleType particle_type,
+                  const Geometry::Model::EntityId cell,
+                  const double energy ) -> double
+    {
+      if( model->isTerminationCell( cell ) )
+        return Utility::QuantityTraits<double>::inf();
+
+      if( model->isCellVoid( cell, particle_type ) )
+        return 0.0;
+
+      switch( particle_type )
+      {
+      case NEUTRON:
+        return model->getMacroscopicTotalForwardCrossSection<NeutronState>( cell, energy );
+      case PHOTON:
+        return model->getMacroscopicTotalForwardCrossSection<PhotonState>( cell, energy );
+      case ADJOINT_PHOTON:
+        return model->getMacroscopicTotalForwardCrossSection<AdjointPhotonState>( cell, energy );
+      case ELECTRON:
+        return model->getMacroscopicTotalForwardCrossSection<ElectronState>( cell, energy );
+      case ADJOINT_ELECTRON:
+        return model->getMacroscopicTotalForwardCrossSection<AdjointElectronState>( cell, energy );
+      case POSITRON:
+        return model->getMacroscopicTotalForwardCrossSection<PositronState>( cell, energy );
+      default:
+      {
+        THROW_EXCEPTION( std::runtime_error,
+                         "Next-event estimators cannot be used with "
+                         << particle_type << "s!" );
+      }
+      }
+    };
+}
+
+// Create the next-event estimator photon collision emission pdf evaluator
+/*! \details The scattering distribution of each scattering reaction in the
+ * collision cell material will be evaluated (see
+ * PhotonMaterial::evaluateScatteringAngleCosinePDF). Each pdf includes the
+ * probability that the collision is that reaction and is paired with the
+ * energy of the photon scattered by the reaction heading to the detector. No
+ * random numbers are used.
+ */
+std::function<void(const ParticleState&,const double[3],std::vector<std::pair<double,double> >&)>
+EventHandler::createNextEventPhotonCollisionEmissionPDFEvaluator() const
+{
+  // Make sure that the filled model has been set
+  testPrecondition( d_filled_model.get() );
+
+  std::shared_ptr<const FilledGeometryModel> model = d_filled_model;
+
+  return [model]( const ParticleState& particle,
+                  const double direction[3],
+                  std::vector<std::pair<double,double> >& emission_pdfs )
+    {
+      // Collisions cannot occur in void cells
+      if( model->isCellVoid<PhotonState>( particle.getCell() ) )
+        return;
+
+      const double* particle_direction = particle.getDirection();
+
+      double angle_cosine = particle_direction[0]*direction[0] +
+        particle_direction[1]*direction[1] +
+        particle_direction[2]*direction[2];
+
+      // Remove round-off errors
+      if( angle_cosine > 1.0 )
+        angle_cosine = 1.0;
+      else if( angle_cosine < -1.0 )
+        angle_cosine = -1.0;
+
+      const FilledPhotonGeometryModel& photon_model = *model;
+
+      const size_t start_index = emission_pdfs.size();
+
+      photon_model.getMaterial( particle.getCell() )->evaluateScatteringAngleCosinePDF(
+                                                         particle.getEnergy(),
+                                                         angle_cosine,
+                                                         emission_pdfs );
+
+      // Convert the scattering angle cosine pdfs to pdfs per steradian
+      for( size_t i = start_index; i < emission_pdfs.size(); ++i )
+        emission_pdfs[i].first /= 2*Utility::PhysicalConstants::pi;
+    };
+}
+
 // Verify that the estimator cell ids are valid
 void EventHandler::verifyValidEstimatorCellIds(
                           const Estimator::Id estimator_id,
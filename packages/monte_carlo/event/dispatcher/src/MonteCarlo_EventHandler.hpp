@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <functional>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
@@ -22,8 +23,14 @@
 #include "MonteCarlo_ParticleSubtrackEndingInCellEventHandler.hpp"
 #include "MonteCarlo_ParticleSubtrackEndingGlobalEventHandler.hpp"
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventHandler.hpp"
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventHandler.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_RingDetectorFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_ParticleState.hpp"
@@ -45,7 +52,10 @@ class EventHandler : public ParticleCollidingInCellEventHandler,
                      public ParticleLeavingCellEventHandler,
                      public ParticleSubtrackEndingInCellEventHandler,
                      public ParticleSubtrackEndingGlobalEventHandler,
-                     public ParticleGoneGlobalEventHandler
+                     public ParticleGoneGlobalEventHandler,
+                     public ParticleCollidingGlobalEventHandler,
+                     public ParticleSourceEmissionGlobalEventHandler,
+                     public ParticleSecondaryEmissionGlobalEventHandler
 {
 
 public:
@@ -94,6 +104,9 @@ public:
   //! Add a particle tracker to the handler
   void addParticleTracker( const std::shared_ptr<ParticleTracker>& particle_tracker );
 
+  //! Add a surface source recorder to the handler
+  void addSurfaceSourceRecorder( const std::shared_ptr<SurfaceSourceRecorder>& recorder );
+
   //! Return the number of estimators that have been added
   size_t getNumberOfEstimators() const;
 
@@ -109,6 +122,30 @@ public:
   //! Return the estimator
   const Estimator& getEstimator( const Estimator::Id estimator_id ) const;
 
+  //! Get the next-event estimators that assume isotropic source emission
+  void getIsotropicSourceNextEventEstimatorIds(
+                            std::set<Estimator::Id>& estimator_ids ) const;
+
+  //! Get the next-event estimators that assume isotropic secondary emission
+  void getIsotropicSecondaryNextEventEstimatorIds(
+                            std::set<Estimator::Id>& estimator_ids ) const;
+
+  //! Get the estimators that score track lengths in any of the cells
+  void getCellTrackLengthEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& cells,
+                         std::set<Estimator::Id>& estimator_ids ) const;
+
+  //! Get the estimators that observe particles entering or leaving the cells
+  void getCellEnteringOrLeavingEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& cells,
+                         std::set<Estimator::Id>& estimator_ids ) const;
+
+  //! Get the estimators that observe particles crossing surfaces
+  void getSurfaceEstimatorIds( const ParticleType particle_type,
+                               std::set<Estimator::Id>& estimator_ids ) const;
+
   //! Check if a particle tracker with the given id exists
   bool doesParticleTrackerExist( const ParticleTracker::Id particle_tracker_id ) const;
 
@@ -190,6 +227,24 @@ private:
           const std::shared_ptr<MeshTrackLengthFluxEstimator<T> >& estimator );
   };
 
+  // Struct for registering estimator
+  template<typename T>
+  struct EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >
+  {
+    static void registerEstimator(
+            EventHandler& event_handler,
+            const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator );
+  };
+
+  // Struct for registering estimator
+  template<typename T>
+  struct EstimatorRegistrationHelper<RingDetectorFluxEstimator<T> >
+  {
+    static void registerEstimator(
+             EventHandler& event_handler,
+             const std::shared_ptr<RingDetectorFluxEstimator<T> >& estimator );
+  };
+
   // Add the estimator registration helper as a friend class
   template<typename T>
   friend class EstimatorRegistrationHelper;
@@ -288,6 +343,27 @@ private:
   void registerGlobalObserver( const std::shared_ptr<Observer>& observer,
                                const std::set<ParticleType>& particle_types );
 
+  // Get the estimators of an observer type that are assigned the particle
+  // type and any of the entities
+  template<typename Observer>
+  void getObserverEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& entities,
+                         std::set<Estimator::Id>& estimator_ids ) const;
+
+  // Register a next-event estimator with the appropriate dispatchers
+  template<typename NextEventEstimatorType>
+  void registerNextEventEstimator(
+                 const std::shared_ptr<NextEventEstimatorType>& estimator );
+
+  // Create the next-event estimator total cross section evaluator
+  std::function<double(const ParticleType,const Geometry::Model::EntityId,const double)>
+  createNextEventTotalCrossSectionEvaluator() const;
+
+  // Create the next-event estimator photon collision emission pdf evaluator
+  std::function<void(const ParticleState&,const double[3],std::vector<std::pair<double,double> >&)>
+  createNextEventPhotonCollisionEmissionPDFEvaluator() const;
+
   // Add the register observer with tag methods from the base classes
   // Unfortunately, base class methods with the same name will not be
   // seen by the compiler unless there is a using declaration
@@ -298,6 +374,9 @@ private:
   using ParticleSubtrackEndingInCellEventHandler::registerObserverWithTag;
   using ParticleSubtrackEndingGlobalEventHandler::registerGlobalObserverWithTag;
   using ParticleGoneGlobalEventHandler::registerGlobalObserverWithTag;
+  using ParticleCollidingGlobalEventHandler::registerGlobalObserverWithTag;
+  using ParticleSourceEmissionGlobalEventHandler::registerGlobalObserverWithTag;
+  using ParticleSecondaryEmissionGlobalEventHandler::registerGlobalObserverWithTag;
 
   // Create and register cell estimator
   void createAndRegisterCellEstimator(
@@ -352,6 +431,9 @@ private:
   // The geometry model
   std::shared_ptr<const Geometry::Model> d_model;
 
+  // The filled geometry model (used by next-event estimators)
+  std::shared_ptr<const FilledGeometryModel> d_filled_model;
+
   // The simulation completion criterion
   std::shared_ptr<ParticleHistorySimulationCompletionCriterion> d_simulation_completion_criterion;
 
@@ -378,11 +460,17 @@ private:
 
   // The observers
   ParticleHistoryObservers d_particle_history_observers;
+
+  // The next-event estimators that assume isotropic source emission
+  std::set<Estimator::Id> d_isotropic_source_next_event_estimator_ids;
+
+  // The next-event estimators that assume isotropic secondary emission
+  std::set<Estimator::Id> d_isotropic_secondary_next_event_estimator_ids;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes
@@ -91,6 +91,100 @@ void EventHandler::EstimatorRegistrationHelper<MeshTrackLengthFluxEstimator<T> >
   event_handler.registerGlobalObserver( estimator, particle_types );
 }
 
+template<typename T>
+void EventHandler::EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >::registerEstimator(
+             EventHandler& event_handler,
+             const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator )
+{
+  event_handler.registerNextEventEstimator( estimator );
+}
+
+template<typename T>
+void EventHandler::EstimatorRegistrationHelper<RingDetectorFluxEstimator<T> >::registerEstimator(
+              EventHandler& event_handler,
+              const std::shared_ptr<RingDetectorFluxEstimator<T> >& estimator )
+{
+  event_handler.registerNextEventEstimator( estimator );
+}
+
+// Get the estimators of an observer type that are assigned the particle type
+// and any of the entities
+template<typename Observer>
+void EventHandler::getObserverEstimatorIds(
+                         const ParticleType particle_type,
+                         const std::set<Geometry::Model::EntityId>& entities,
+                         std::set<Estimator::Id>& estimator_ids ) const
+{
+  EstimatorIdMap::const_iterator estimator_it = d_estimators.begin();
+
+  while( estimator_it != d_estimators.end() )
+  {
+    const Estimator& estimator = *estimator_it->second;
+
+    if( dynamic_cast<const Observer*>( &estimator ) &&
+        estimator.isParticleTypeAssigned( particle_type ) )
+    {
+      for( auto entity : entities )
+      {
+        if( estimator.isEntityAssigned( entity ) )
+        {
+          estimator_ids.insert( estimator_it->first );
+
+          break;
+        }
+      }
+    }
+
+    ++estimator_it;
+  }
+}
+
+// Register a next-event estimator with the appropriate dispatchers
+/*! \details If the event handler was constructed with a filled geometry
+ * model the estimator will attenuate its contributions with the
+ * macroscopic total cross sections of the cell materials and photon
+ * estimators that do not have a collision emission pdf evaluator will be
+ * given one that evaluates the scattering distributions of the cell
+ * materials. An estimator without a collision emission pdf evaluator cannot
+ * be registered since there is no emission pdf that would be correct for
+ * every collision. The emission pdf evaluators must be set before the
+ * estimator is added.
+ */
+template<typename NextEventEstimatorType>
+void EventHandler::registerNextEventEstimator(
+                     const std::shared_ptr<NextEventEstimatorType>& estimator )
+{
+  std::set<ParticleType> particle_types = estimator->getParticleTypes();
+
+  if( d_filled_model )
+  {
+    estimator->setTotalCrossSectionEvaluator(
+                         this->createNextEventTotalCrossSectionEvaluator() );
+
+    if( !estimator->hasCollisionEmissionPDFEvaluator() &&
+        particle_types.size() == 1 &&
+        particle_types.count( PHOTON ) )
+    {
+      estimator->setCollisionEmissionPDFEvaluator(
+                this->createNextEventPhotonCollisionEmissionPDFEvaluator() );
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !estimator->hasCollisionEmissionPDFEvaluator(),
+                      std::runtime_error,
+                      "Next-event estimator " << estimator->getId() <<
+                      " cannot be registered because its collision emission "
+                      "pdf evaluator has not been set!" );
+
+  if( !estimator->hasSourceEmissionPDFEvaluator() )
+    d_isotropic_source_next_event_estimator_ids.insert( estimator->getId() );
+
+  if( !estimator->hasSecondaryEmissionPDFEvaluator() )
+    d_isotropic_secondary_next_event_estimator_ids.insert( estimator->getId() );
+
+  this->registerGlobalObserver( estimator, particle_types );
+}
+
 // Register an observer with the appropriate dispatcher
 template<typename Observer, typename InputEntityId>
 void EventHandler::registerObserver( const std::shared_ptr<Observer>& observer,
@@ -282,6 +376,9 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingInCellEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleGoneGlobalEventHandler );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventHandler );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceEmissionGlobalEventHandler );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSecondaryEmissionGlobalEventHandler );
 
   // Save the local data (ignore the model, snapshot counters)
   ar & BOOST_SERIALIZATION_NVP( d_simulation_completion_criterion );
@@ -312,6 +409,15 @@ void EventHandler::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleGoneGlobalEventHandler );
 
+  // The colliding, source emission and secondary emission global events were
+  // added in version 1
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventHandler );
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceEmissionGlobalEventHandler );
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSecondaryEmissionGlobalEventHandler );
+  }
+
   // Load the local data (ignore the model)
   ar & BOOST_SERIALIZATION_NVP( d_simulation_completion_criterion );
 
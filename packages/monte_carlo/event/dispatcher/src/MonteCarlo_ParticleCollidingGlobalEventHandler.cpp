@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventHandler.cpp
+//! \author Alex Robinson
+//! \brief  The particle colliding global event handler definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventHandler.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleCollidingGlobalEventHandler::ParticleCollidingGlobalEventHandler()
+  : d_particle_colliding_global_event_dispatcher()
+{ /* ... */ }
+
+// Return the particle colliding global event dispatcher
+ParticleCollidingGlobalEventDispatcher&
+ParticleCollidingGlobalEventHandler::getParticleCollidingGlobalEventDispatcher()
+{
+  return d_particle_colliding_global_event_dispatcher;
+}
+
+// Return the particle colliding global event dispatcher
+const ParticleCollidingGlobalEventDispatcher&
+ParticleCollidingGlobalEventHandler::getParticleCollidingGlobalEventDispatcher() const
+{
+  return d_particle_colliding_global_event_dispatcher;
+}
+
+// Update the global estimators from a colliding event
+void ParticleCollidingGlobalEventHandler::updateObserversFromParticleCollidingGlobalEvent(
+                                                const ParticleState& particle )
+{
+  d_particle_colliding_global_event_dispatcher.dispatchParticleCollidingGlobalEvent( particle );
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleCollidingGlobalEventHandler );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalEventHandler.cpp
+//---------------------------------------------------------------------------//
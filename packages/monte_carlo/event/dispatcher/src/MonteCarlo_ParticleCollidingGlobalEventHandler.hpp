@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventHandler.hpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event handler declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_HANDLER_HPP
+#define MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_HANDLER_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/mpl/contains.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleCollidingGlobalEventDispatcher.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle colliding global event handler class
+ * \ingroup particle_colliding_global_event
+ */
+class ParticleCollidingGlobalEventHandler
+{
+
+public:
+
+  //! Constructor
+  ParticleCollidingGlobalEventHandler();
+
+  //! Destructor
+  virtual ~ParticleCollidingGlobalEventHandler()
+  { /* ... */ }
+
+  //! Return the particle colliding global event dispatcher
+  ParticleCollidingGlobalEventDispatcher&
+  getParticleCollidingGlobalEventDispatcher();
+
+  //! Return the particle colliding global event dispatcher
+  const ParticleCollidingGlobalEventDispatcher&
+  getParticleCollidingGlobalEventDispatcher() const;
+
+  //! Update the global estimators from a colliding event
+  void updateObserversFromParticleCollidingGlobalEvent( const ParticleState& particle );
+
+protected:
+
+  // Register a global observer with the appropraite particle colliding
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+                         const std::set<ParticleType>& particle_types,
+			 ParticleCollidingGlobalEventObserver::EventTag );
+
+  // Register a global observer with the appropraite particle colliding
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+			 ParticleCollidingGlobalEventObserver::EventTag );
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+  
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The particle colliding global event dispatcher
+  ParticleCollidingGlobalEventDispatcher
+  d_particle_colliding_global_event_dispatcher;
+};
+
+// Register a global observer with the appropraite particle colliding
+// global event dispatcher
+template<typename Observer>
+void ParticleCollidingGlobalEventHandler::registerGlobalObserverWithTag(
+			          const std::shared_ptr<Observer>& observer,
+                                  const std::set<ParticleType>& particle_types,
+                                  ParticleCollidingGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleCollidingGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleCollidingGlobalEventObserver> observer_base = observer;
+
+  d_particle_colliding_global_event_dispatcher.attachObserver( particle_types,
+                                                          observer_base );
+}
+
+// Register a global observer with the appropraite particle colliding
+// global event dispatcher
+template<typename Observer>
+void ParticleCollidingGlobalEventHandler::registerGlobalObserverWithTag(
+                                    const std::shared_ptr<Observer>& observer,
+			            ParticleCollidingGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleCollidingGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleCollidingGlobalEventObserver> observer_base = observer;
+
+  d_particle_colliding_global_event_dispatcher.attachObserver( observer_base );
+}
+
+// Serialize the observer
+template<typename Archive>
+void ParticleCollidingGlobalEventHandler::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_particle_colliding_global_event_dispatcher );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleCollidingGlobalEventHandler, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleCollidingGlobalEventHandler );
+
+#endif // end MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_HANDLER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalEventHandler.hpp
+//---------------------------------------------------------------------------//
@@ -19,15 +19,28 @@ void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEven
                              const Geometry::Model::EntityId cell_of_collision,
                              const double inverse_total_cross_section )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_collision );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObservers observers =
+      this->getCompiledObservers( cell_of_collision, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
+    for( auto&& observer : observers )
+      observer->updateFromParticleCollidingInCellEvent( particle,
+                                                        cell_of_collision,
+                                                        inverse_total_cross_section );
+  }
+  else
   {
-    it->second->dispatchParticleCollidingInCellEvent(
-						 particle,
-						 cell_of_collision,
-						 inverse_total_cross_section );
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_collision );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCollidingInCellEvent(
+                                                   particle,
+                                                   cell_of_collision,
+                                                   inverse_total_cross_section );
+    }
   }
 }
 
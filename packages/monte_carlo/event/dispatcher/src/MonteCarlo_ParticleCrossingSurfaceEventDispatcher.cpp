@@ -19,13 +19,26 @@ void ParticleCrossingSurfaceEventDispatcher::dispatchParticleCrossingSurfaceEven
                               const Geometry::Model::EntityId surface_crossing,
                               const double angle_cosine )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObservers observers =
+      this->getCompiledObservers( surface_crossing, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
+    for( auto&& observer : observers )
+      observer->updateFromParticleCrossingSurfaceEvent( particle,
+                                                        surface_crossing,
+                                                        angle_cosine );
+  }
+  else
   {
-    it->second->dispatchParticleCrossingSurfaceEvent( particle,
-						      surface_crossing,
-						      angle_cosine );
+    DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCrossingSurfaceEvent( particle,
+                                                        surface_crossing,
+                                                        angle_cosine );
+    }
   }
 }
 
@@ -18,10 +18,21 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_entering )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObservers observers =
+      this->getCompiledObservers( cell_entering, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+    for( auto&& observer : observers )
+      observer->updateFromParticleEnteringCellEvent( particle, cell_entering );
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+  }
 }
   
 } // end MonteCarlo namespace
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -23,10 +24,20 @@
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_ArrayView.hpp"
 
 namespace MonteCarlo{
 
-//! The particle event dispatcher database base class
+/*! The particle event dispatcher database base class
+ * \details Before transport begins the local dispatchers can be compiled into
+ * a flat dispatch table. Each row of the table corresponds to an entity
+ * (cell or surface) with at least one attached observer and stores a
+ * contiguous span of raw observer pointers for every particle type. Events
+ * in entities without observers can then be skipped with a single lookup.
+ * Attaching or detaching observers (or accessing a local dispatcher) will
+ * invalidate the table, which must then be recompiled. The table is not
+ * archived.
+ */
 template<typename Dispatcher>
 class ParticleEventDispatcher
 {
@@ -64,8 +75,18 @@ public:
   //! Detach all observers
   void detachAllObservers();
 
+  //! Compile the dispatch table
+  void compileDispatchTable();
+
+  //! Check if the dispatch table has been compiled
+  bool isDispatchTableCompiled() const;
+
 protected:
 
+  //! The compiled observer span type
+  typedef Utility::ArrayView<typename Dispatcher::ObserverType* const>
+  CompiledObservers;
+
   // Typedef for the dispatcher map
   typedef typename std::unordered_map<uint64_t,std::unique_ptr<Dispatcher> >
   DispatcherMap;
@@ -73,8 +94,26 @@ protected:
   //! Get the dispatcher map
   DispatcherMap& getDispatcherMap();
 
+  //! Get the compiled observers for the entity and particle type
+  CompiledObservers getCompiledObservers(
+                                  const uint64_t entity_id,
+                                  const ParticleType particle_type ) const;
+
 private:
 
+  // Invalidate the dispatch table
+  void invalidateDispatchTable();
+
+  // Get the dispatch table row of an entity
+  size_t getDispatchTableRow( const uint64_t entity_id ) const;
+
+  // The invalid dispatch table row
+  static const size_t s_invalid_row;
+
+  // The max entity id that will be used in a dense row index (relative to
+  // the number of rows)
+  static const uint64_t s_max_dense_entity_id_factor;
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -82,7 +121,23 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The local dispatchers
   DispatcherMap d_dispatcher_map;
+
+  // Records if the dispatch table has been compiled
+  bool d_dispatch_table_compiled;
+
+  // The dense dispatch table row of each entity (indexed by entity id)
+  std::vector<size_t> d_dense_entity_rows;
+
+  // The dispatch table row of each entity (used with sparse entity ids)
+  std::unordered_map<uint64_t,size_t> d_sparse_entity_rows;
+
+  // The observer offsets of each dispatch table row and particle type
+  std::vector<size_t> d_observer_offsets;
+
+  // The compiled observers
+  std::vector<typename Dispatcher::ObserverType*> d_compiled_observers;
 };
 
 } // end MonteCarlo namespace
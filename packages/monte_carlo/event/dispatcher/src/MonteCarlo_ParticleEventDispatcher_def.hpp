@@ -9,12 +9,33 @@
 #ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 #define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
 namespace MonteCarlo{
 
+// The invalid dispatch table row
+template<typename Dispatcher>
+const size_t ParticleEventDispatcher<Dispatcher>::s_invalid_row =
+  std::numeric_limits<size_t>::max();
+
+// The max entity id that will be used in a dense row index
+template<typename Dispatcher>
+const uint64_t ParticleEventDispatcher<Dispatcher>::s_max_dense_entity_id_factor = 64;
+
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_dispatch_table_compiled( false ),
+    d_dense_entity_rows(),
+    d_sparse_entity_rows(),
+    d_observer_offsets(),
+    d_compiled_observers()
 { /* ... */ }
 
 // Get the appropriate local dispatcher for the given entity id
@@ -22,6 +43,9 @@ template<typename Dispatcher>
 inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
                                                      const uint64_t entity_id )
 {
+  // The observers of the local dispatcher may be modified
+  this->invalidateDispatchTable();
+
   typename DispatcherMap::iterator it = d_dispatcher_map.find( entity_id );
 
   if( it != d_dispatcher_map.end() )
@@ -71,6 +95,8 @@ template<typename Dispatcher>
 inline void ParticleEventDispatcher<Dispatcher>::detachObserver(
            const std::shared_ptr<typename Dispatcher::ObserverType>& observer )
 {
+  this->invalidateDispatchTable();
+
   typename DispatcherMap::iterator it = d_dispatcher_map.begin();
 
   while( it != d_dispatcher_map.end() )
@@ -85,9 +111,168 @@ inline void ParticleEventDispatcher<Dispatcher>::detachObserver(
 template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
+  this->invalidateDispatchTable();
+
   d_dispatcher_map.clear();
 }
 
+// Compile the dispatch table
+/*! \details Only entities with at least one attached observer will be given
+ * a row in the table. If the entity ids are dense enough the row of an
+ * entity will be found by indexing a vector with the entity id. Otherwise a
+ * hash table will be used to find the row of an entity.
+ */
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::compileDispatchTable()
+{
+  this->invalidateDispatchTable();
+
+  const size_t number_of_particle_types =
+    ParticleType_END - ParticleType_START;
+
+  // Find the entities with at least one observer
+  std::vector<uint64_t> entity_ids;
+  entity_ids.reserve( d_dispatcher_map.size() );
+
+  for( auto&& dispatcher_data : d_dispatcher_map )
+  {
+    for( int i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      if( dispatcher_data.second->getNumberOfObservers( (ParticleType)i ) > 0 )
+      {
+        entity_ids.push_back( dispatcher_data.first );
+
+        break;
+      }
+    }
+  }
+
+  std::sort( entity_ids.begin(), entity_ids.end() );
+
+  // Fill the table rows
+  d_observer_offsets.reserve( entity_ids.size()*number_of_particle_types+1 );
+  d_observer_offsets.push_back( 0 );
+
+  std::vector<typename Dispatcher::ObserverType*> observers;
+
+  for( auto&& entity_id : entity_ids )
+  {
+    const Dispatcher& local_dispatcher = *d_dispatcher_map.find( entity_id )->second;
+
+    for( int i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      local_dispatcher.getObservers( (ParticleType)i, observers );
+
+      d_compiled_observers.insert( d_compiled_observers.end(),
+                                   observers.begin(),
+                                   observers.end() );
+
+      d_observer_offsets.push_back( d_compiled_observers.size() );
+    }
+  }
+
+  // Create the row index
+  if( !entity_ids.empty() )
+  {
+    const uint64_t max_dense_entity_id =
+      s_max_dense_entity_id_factor*entity_ids.size();
+
+    if( entity_ids.back() <= max_dense_entity_id )
+    {
+      d_dense_entity_rows.resize( entity_ids.back()+1, s_invalid_row );
+
+      for( size_t i = 0; i < entity_ids.size(); ++i )
+        d_dense_entity_rows[entity_ids[i]] = i;
+    }
+    else
+    {
+      d_sparse_entity_rows.reserve( entity_ids.size() );
+
+      for( size_t i = 0; i < entity_ids.size(); ++i )
+        d_sparse_entity_rows[entity_ids[i]] = i;
+    }
+  }
+
+  d_dispatch_table_compiled = true;
+}
+
+// Check if the dispatch table has been compiled
+template<typename Dispatcher>
+inline bool ParticleEventDispatcher<Dispatcher>::isDispatchTableCompiled() const
+{
+  return d_dispatch_table_compiled;
+}
+
+// Invalidate the dispatch table
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::invalidateDispatchTable()
+{
+  if( d_dispatch_table_compiled )
+  {
+    d_dense_entity_rows.clear();
+    d_sparse_entity_rows.clear();
+    d_observer_offsets.clear();
+    d_compiled_observers.clear();
+
+    d_dispatch_table_compiled = false;
+  }
+}
+
+// Get the dispatch table row of an entity
+template<typename Dispatcher>
+inline size_t ParticleEventDispatcher<Dispatcher>::getDispatchTableRow(
+                                               const uint64_t entity_id ) const
+{
+  if( d_sparse_entity_rows.empty() )
+  {
+    if( entity_id < d_dense_entity_rows.size() )
+      return d_dense_entity_rows[entity_id];
+    else
+      return s_invalid_row;
+  }
+  else
+  {
+    std::unordered_map<uint64_t,size_t>::const_iterator it =
+      d_sparse_entity_rows.find( entity_id );
+
+    if( it != d_sparse_entity_rows.end() )
+      return it->second;
+    else
+      return s_invalid_row;
+  }
+}
+
+// Get the compiled observers for the entity and particle type
+/*! \details An empty span will be returned if there are no observers for the
+ * entity and particle type.
+ */
+template<typename Dispatcher>
+inline auto ParticleEventDispatcher<Dispatcher>::getCompiledObservers(
+                                     const uint64_t entity_id,
+                                     const ParticleType particle_type ) const
+  -> CompiledObservers
+{
+  // Make sure the dispatch table has been compiled
+  testPrecondition( d_dispatch_table_compiled );
+
+  const size_t row = this->getDispatchTableRow( entity_id );
+
+  if( row != s_invalid_row )
+  {
+    const size_t offset_index =
+      row*(ParticleType_END - ParticleType_START) +
+      (particle_type - ParticleType_START);
+
+    typename Dispatcher::ObserverType* const* observers =
+      d_compiled_observers.data();
+
+    return CompiledObservers( observers + d_observer_offsets[offset_index],
+                              observers + d_observer_offsets[offset_index+1] );
+  }
+  else
+    return CompiledObservers();
+}
+
 // Get the dispatcher map
 template<typename Dispatcher>
 inline auto ParticleEventDispatcher<Dispatcher>::getDispatcherMap() -> DispatcherMap&
@@ -100,6 +285,10 @@ template<typename Dispatcher>
 template<typename Archive>
 void ParticleEventDispatcher<Dispatcher>::serialize( Archive& ar, const unsigned version )
 {
+  // The dispatch table of a loaded dispatcher must be recompiled
+  if( Archive::is_loading::value )
+    this->invalidateDispatchTable();
+
   ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
 }
 
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -63,6 +64,10 @@ public:
   //! Get the number of attached observers
   size_t getNumberOfObservers( const ParticleType particle_type ) const;
 
+  //! Get the (raw) attached observers
+  void getObservers( const ParticleType particle_type,
+                     std::vector<Observer*>& observers ) const;
+
 protected:
 
   // The observers set
@@ -90,6 +90,29 @@ size_t ParticleEventLocalDispatcher<Observer>::getNumberOfObservers(
     return 0;
 }
 
+// Get the (raw) attached observers
+/*! \details The observers will be returned in the observer set order. The
+ * observer pointers are only valid while the observers remain attached.
+ */
+template<typename Observer>
+void ParticleEventLocalDispatcher<Observer>::getObservers(
+                                      const ParticleType particle_type,
+                                      std::vector<Observer*>& observers ) const
+{
+  observers.clear();
+
+  typename std::map<int,ObserverSet>::const_iterator
+    particle_observer_sets_it = d_observer_sets.find( particle_type );
+
+  if( particle_observer_sets_it != d_observer_sets.end() )
+  {
+    observers.reserve( particle_observer_sets_it->second.size() );
+
+    for( auto&& observer : particle_observer_sets_it->second )
+      observers.push_back( observer.get() );
+  }
+}
+
 // Check if there is an observer set for the particle type
 template<typename Observer>
 inline bool ParticleEventLocalDispatcher<Observer>::hasObserverSet(
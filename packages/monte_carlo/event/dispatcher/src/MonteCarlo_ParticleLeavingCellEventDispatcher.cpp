@@ -18,10 +18,21 @@ void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
                                  const ParticleState& particle,
 	                         const Geometry::Model::EntityId cell_leaving )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObservers observers =
+      this->getCompiledObservers( cell_leaving, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+    for( auto&& observer : observers )
+      observer->updateFromParticleLeavingCellEvent( particle, cell_leaving );
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+  }
 }
   
 } // end MonteCarlo namespace
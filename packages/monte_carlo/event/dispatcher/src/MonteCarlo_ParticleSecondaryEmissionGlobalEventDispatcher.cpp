@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.cpp
+//! \author Alex Robinson
+//! \brief  Particle secondary emission global event dispatcher declaration
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Dispatch the new event to the observers
+void ParticleSecondaryEmissionGlobalEventDispatcher::dispatchParticleSecondaryEmissionGlobalEvent(
+                                                const ParticleState& particle )
+{
+  if( this->hasObserverSet( particle.getParticleType() ) )
+  {
+    ObserverSet& observer_set =
+      this->getObserverSet( particle.getParticleType() );
+    
+    ObserverSet::iterator it = observer_set.begin();
+    
+    while( it != observer_set.end() )
+    {
+      (*it)->updateFromGlobalParticleSecondaryEmissionEvent( particle );
+      
+      ++it;
+    }
+  }
+}
+  
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSecondaryEmissionGlobalEventDispatcher );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,59 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.hpp
+//! \author Alex Robinson
+//! \brief  Particle secondary emission global event dispatcher declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+#define MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleGlobalEventDispatcher.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventObserver.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle secondary emission global event dispatcher class
+ * \ingroup particle_secondary_emission_global_event
+ */
+class ParticleSecondaryEmissionGlobalEventDispatcher : public ParticleGlobalEventDispatcher<ParticleSecondaryEmissionGlobalEventObserver>
+{
+  typedef ParticleGlobalEventDispatcher<ParticleSecondaryEmissionGlobalEventObserver> BaseType;
+
+public:
+
+  //! Constructor
+  ParticleSecondaryEmissionGlobalEventDispatcher()
+  { /* ... */ }
+
+  //! Destructor
+  ~ParticleSecondaryEmissionGlobalEventDispatcher()
+  { /* ... */ }
+
+  //! Dispatch the new event to the observers
+  void dispatchParticleSecondaryEmissionGlobalEvent( const ParticleState& particle );
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  { ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType ); }
+  
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+  
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleSecondaryEmissionGlobalEventDispatcher, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSecondaryEmissionGlobalEventDispatcher );
+
+#endif // end MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.cpp
+//! \author Alex Robinson
+//! \brief  The particle secondary emission global event handler definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleSecondaryEmissionGlobalEventHandler::ParticleSecondaryEmissionGlobalEventHandler()
+  : d_particle_secondary_emission_global_event_dispatcher()
+{ /* ... */ }
+
+// Return the particle secondary emission global event dispatcher
+ParticleSecondaryEmissionGlobalEventDispatcher&
+ParticleSecondaryEmissionGlobalEventHandler::getParticleSecondaryEmissionGlobalEventDispatcher()
+{
+  return d_particle_secondary_emission_global_event_dispatcher;
+}
+
+// Return the particle secondary emission global event dispatcher
+const ParticleSecondaryEmissionGlobalEventDispatcher&
+ParticleSecondaryEmissionGlobalEventHandler::getParticleSecondaryEmissionGlobalEventDispatcher() const
+{
+  return d_particle_secondary_emission_global_event_dispatcher;
+}
+
+// Update the global estimators from a secondary emission event
+void ParticleSecondaryEmissionGlobalEventHandler::updateObserversFromParticleSecondaryEmissionGlobalEvent(
+                                                const ParticleState& particle )
+{
+  d_particle_secondary_emission_global_event_dispatcher.dispatchParticleSecondaryEmissionGlobalEvent( particle );
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSecondaryEmissionGlobalEventHandler );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.hpp
+//! \author Alex Robinson
+//! \brief  Particle secondary emission global event handler declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+#define MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/mpl/contains.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventDispatcher.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle secondary emission global event handler class
+ * \ingroup particle_secondary_emission_global_event
+ */
+class ParticleSecondaryEmissionGlobalEventHandler
+{
+
+public:
+
+  //! Constructor
+  ParticleSecondaryEmissionGlobalEventHandler();
+
+  //! Destructor
+  virtual ~ParticleSecondaryEmissionGlobalEventHandler()
+  { /* ... */ }
+
+  //! Return the particle secondary emission global event dispatcher
+  ParticleSecondaryEmissionGlobalEventDispatcher&
+  getParticleSecondaryEmissionGlobalEventDispatcher();
+
+  //! Return the particle secondary emission global event dispatcher
+  const ParticleSecondaryEmissionGlobalEventDispatcher&
+  getParticleSecondaryEmissionGlobalEventDispatcher() const;
+
+  //! Update the global estimators from a secondary emission event
+  void updateObserversFromParticleSecondaryEmissionGlobalEvent( const ParticleState& particle );
+
+protected:
+
+  // Register a global observer with the appropraite particle secondary emission
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+                         const std::set<ParticleType>& particle_types,
+			 ParticleSecondaryEmissionGlobalEventObserver::EventTag );
+
+  // Register a global observer with the appropraite particle secondary emission
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+			 ParticleSecondaryEmissionGlobalEventObserver::EventTag );
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+  
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The particle secondary emission global event dispatcher
+  ParticleSecondaryEmissionGlobalEventDispatcher
+  d_particle_secondary_emission_global_event_dispatcher;
+};
+
+// Register a global observer with the appropraite particle secondary emission
+// global event dispatcher
+template<typename Observer>
+void ParticleSecondaryEmissionGlobalEventHandler::registerGlobalObserverWithTag(
+			          const std::shared_ptr<Observer>& observer,
+                                  const std::set<ParticleType>& particle_types,
+                                  ParticleSecondaryEmissionGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleSecondaryEmissionGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleSecondaryEmissionGlobalEventObserver> observer_base = observer;
+
+  d_particle_secondary_emission_global_event_dispatcher.attachObserver( particle_types,
+                                                          observer_base );
+}
+
+// Register a global observer with the appropraite particle secondary emission
+// global event dispatcher
+template<typename Observer>
+void ParticleSecondaryEmissionGlobalEventHandler::registerGlobalObserverWithTag(
+                                    const std::shared_ptr<Observer>& observer,
+			            ParticleSecondaryEmissionGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleSecondaryEmissionGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleSecondaryEmissionGlobalEventObserver> observer_base = observer;
+
+  d_particle_secondary_emission_global_event_dispatcher.attachObserver( observer_base );
+}
+
+// Serialize the observer
+template<typename Archive>
+void ParticleSecondaryEmissionGlobalEventHandler::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_particle_secondary_emission_global_event_dispatcher );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleSecondaryEmissionGlobalEventHandler, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSecondaryEmissionGlobalEventHandler );
+
+#endif // end MONTE_CARLO_PARTICLE_SECONDARY_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSecondaryEmissionGlobalEventHandler.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,59 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSourceEmissionGlobalEventDispatcher.hpp
+//! \author Alex Robinson
+//! \brief  Particle source emission global event dispatcher declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+#define MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleGlobalEventDispatcher.hpp"
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventObserver.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle source emission global event dispatcher class
+ * \ingroup particle_source_emission_global_event
+ */
+class ParticleSourceEmissionGlobalEventDispatcher : public ParticleGlobalEventDispatcher<ParticleSourceEmissionGlobalEventObserver>
+{
+  typedef ParticleGlobalEventDispatcher<ParticleSourceEmissionGlobalEventObserver> BaseType;
+
+public:
+
+  //! Constructor
+  ParticleSourceEmissionGlobalEventDispatcher()
+  { /* ... */ }
+
+  //! Destructor
+  ~ParticleSourceEmissionGlobalEventDispatcher()
+  { /* ... */ }
+
+  //! Dispatch the new event to the observers
+  void dispatchParticleSourceEmissionGlobalEvent( const ParticleState& particle );
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  { ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType ); }
+  
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+  
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleSourceEmissionGlobalEventDispatcher, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSourceEmissionGlobalEventDispatcher );
+
+#endif // end MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_DISPATCHER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSourceEmissionGlobalEventDispatcher.hpp
+//---------------------------------------------------------------------------//
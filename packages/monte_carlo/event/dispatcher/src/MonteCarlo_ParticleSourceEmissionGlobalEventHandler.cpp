@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSourceEmissionGlobalEventHandler.cpp
+//! \author Alex Robinson
+//! \brief  The particle source emission global event handler definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventHandler.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleSourceEmissionGlobalEventHandler::ParticleSourceEmissionGlobalEventHandler()
+  : d_particle_source_emission_global_event_dispatcher()
+{ /* ... */ }
+
+// Return the particle source emission global event dispatcher
+ParticleSourceEmissionGlobalEventDispatcher&
+ParticleSourceEmissionGlobalEventHandler::getParticleSourceEmissionGlobalEventDispatcher()
+{
+  return d_particle_source_emission_global_event_dispatcher;
+}
+
+// Return the particle source emission global event dispatcher
+const ParticleSourceEmissionGlobalEventDispatcher&
+ParticleSourceEmissionGlobalEventHandler::getParticleSourceEmissionGlobalEventDispatcher() const
+{
+  return d_particle_source_emission_global_event_dispatcher;
+}
+
+// Update the global estimators from a source emission event
+void ParticleSourceEmissionGlobalEventHandler::updateObserversFromParticleSourceEmissionGlobalEvent(
+                                                const ParticleState& particle )
+{
+  d_particle_source_emission_global_event_dispatcher.dispatchParticleSourceEmissionGlobalEvent( particle );
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSourceEmissionGlobalEventHandler );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSourceEmissionGlobalEventHandler.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleSourceEmissionGlobalEventHandler.hpp
+//! \author Alex Robinson
+//! \brief  Particle source emission global event handler declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+#define MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/mpl/contains.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventDispatcher.hpp"
+#include "Utility_DesignByContract.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle source emission global event handler class
+ * \ingroup particle_source_emission_global_event
+ */
+class ParticleSourceEmissionGlobalEventHandler
+{
+
+public:
+
+  //! Constructor
+  ParticleSourceEmissionGlobalEventHandler();
+
+  //! Destructor
+  virtual ~ParticleSourceEmissionGlobalEventHandler()
+  { /* ... */ }
+
+  //! Return the particle source emission global event dispatcher
+  ParticleSourceEmissionGlobalEventDispatcher&
+  getParticleSourceEmissionGlobalEventDispatcher();
+
+  //! Return the particle source emission global event dispatcher
+  const ParticleSourceEmissionGlobalEventDispatcher&
+  getParticleSourceEmissionGlobalEventDispatcher() const;
+
+  //! Update the global estimators from a source emission event
+  void updateObserversFromParticleSourceEmissionGlobalEvent( const ParticleState& particle );
+
+protected:
+
+  // Register a global observer with the appropraite particle source emission
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+                         const std::set<ParticleType>& particle_types,
+			 ParticleSourceEmissionGlobalEventObserver::EventTag );
+
+  // Register a global observer with the appropraite particle source emission
+  // global event dispatcher
+  template<typename Observer>
+  void registerGlobalObserverWithTag(
+			 const std::shared_ptr<Observer>& observer,
+			 ParticleSourceEmissionGlobalEventObserver::EventTag );
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+  
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The particle source emission global event dispatcher
+  ParticleSourceEmissionGlobalEventDispatcher
+  d_particle_source_emission_global_event_dispatcher;
+};
+
+// Register a global observer with the appropraite particle source emission
+// global event dispatcher
+template<typename Observer>
+void ParticleSourceEmissionGlobalEventHandler::registerGlobalObserverWithTag(
+			          const std::shared_ptr<Observer>& observer,
+                                  const std::set<ParticleType>& particle_types,
+                                  ParticleSourceEmissionGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleSourceEmissionGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleSourceEmissionGlobalEventObserver> observer_base = observer;
+
+  d_particle_source_emission_global_event_dispatcher.attachObserver( particle_types,
+                                                          observer_base );
+}
+
+// Register a global observer with the appropraite particle source emission
+// global event dispatcher
+template<typename Observer>
+void ParticleSourceEmissionGlobalEventHandler::registerGlobalObserverWithTag(
+                                    const std::shared_ptr<Observer>& observer,
+			            ParticleSourceEmissionGlobalEventObserver::EventTag )
+{
+  // Make sure the Observer class has the expected event tag
+  testStaticPrecondition((boost::mpl::contains<typename Observer::EventTags,ParticleSourceEmissionGlobalEventObserver::EventTag>::value));
+
+  std::shared_ptr<ParticleSourceEmissionGlobalEventObserver> observer_base = observer;
+
+  d_particle_source_emission_global_event_dispatcher.attachObserver( observer_base );
+}
+
+// Serialize the observer
+template<typename Archive>
+void ParticleSourceEmissionGlobalEventHandler::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_particle_source_emission_global_event_dispatcher );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleSourceEmissionGlobalEventHandler, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSourceEmissionGlobalEventHandler );
+
+#endif // end MONTE_CARLO_PARTICLE_SOURCE_EMISSION_GLOBAL_EVENT_HANDLER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleSourceEmissionGlobalEventHandler.hpp
+//---------------------------------------------------------------------------//
@@ -19,14 +19,27 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double track_length )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_subtrack );
+  if( this->isDispatchTableCompiled() )
+  {
+    CompiledObservers observers =
+      this->getCompiledObservers( cell_of_subtrack, particle.getParticleType() );
 
-  if( it != this->getDispatcherMap().end() )
+    for( auto&& observer : observers )
+      observer->updateFromParticleSubtrackEndingInCellEvent( particle,
+                                                             cell_of_subtrack,
+                                                             track_length );
+  }
+  else
   {
-    it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
-							   cell_of_subtrack,
-							   track_length );
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_subtrack );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
+                                                             cell_of_subtrack,
+                                                             track_length );
+    }
   }
 }
 
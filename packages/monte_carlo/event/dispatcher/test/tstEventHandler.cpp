@@ -9,6 +9,9 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <set>
+#include <vector>
+#include <array>
 
 // FRENSIE Includes
 #include "MonteCarlo_EventHandler.hpp"
@@ -18,6 +21,7 @@
 #include "MonteCarlo_SurfaceCurrentEstimator.hpp"
 #include "MonteCarlo_SurfaceFluxEstimator.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
@@ -427,6 +431,231 @@ FRENSIE_UNIT_TEST( EventHandler, addEstimator_model_set )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that next-event estimators can only be added when they have a
+// collision emission pdf evaluator
+FRENSIE_UNIT_TEST( EventHandler, addEstimator_next_event )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  std::vector<std::array<double,3> > detector_points( 1 );
+  detector_points[0] = {1.0, 0.0, 0.0};
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    local_estimator_1( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                  100, 1.0, detector_points ) );
+
+  local_estimator_1->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  FRENSIE_CHECK_THROW( event_handler.addEstimator( local_estimator_1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK( !event_handler.doesEstimatorExist( 100 ) );
+
+  local_estimator_1->setCollisionEmissionPDFEvaluator(
+     MonteCarlo::WeightMultipliedPointDetectorFluxEstimator::createAzimuthallySymmetricEmissionPDFEvaluator(
+                      []( const double, const double ){ return 0.5; } ) );
+
+  FRENSIE_CHECK_NO_THROW( event_handler.addEstimator( local_estimator_1 ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    local_estimator_2( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                  101, 1.0, detector_points ) );
+
+  local_estimator_2->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+  local_estimator_2->setCollisionEmissionPDFEvaluator(
+     MonteCarlo::WeightMultipliedPointDetectorFluxEstimator::createAzimuthallySymmetricEmissionPDFEvaluator(
+                      []( const double, const double ){ return 0.5; } ) );
+  local_estimator_2->setSourceEmissionPDFEvaluator(
+     MonteCarlo::WeightMultipliedPointDetectorFluxEstimator::createAzimuthallySymmetricEmissionPDFEvaluator(
+                      []( const double, const double ){ return 0.5; } ) );
+  local_estimator_2->setSecondaryEmissionPDFEvaluator(
+     MonteCarlo::WeightMultipliedPointDetectorFluxEstimator::createAzimuthallySymmetricEmissionPDFEvaluator(
+                      []( const double, const double ){ return 0.5; } ) );
+
+  FRENSIE_CHECK_NO_THROW( event_handler.addEstimator( local_estimator_2 ) );
+
+  // Only the first estimator assumes that the source is isotropic
+  std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+  event_handler.getIsotropicSourceNextEventEstimatorIds( estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {100} ) );
+
+  // Only the first estimator assumes that secondary emission is isotropic
+  estimator_ids.clear();
+
+  event_handler.getIsotropicSecondaryNextEventEstimatorIds( estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {100} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell track-length estimators in a set of cells can be found
+FRENSIE_UNIT_TEST( EventHandler, getCellTrackLengthEstimatorIds )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    local_estimator_1( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                                 100, 1.0, {1, 2}, {1.0, 1.0} ) );
+
+  local_estimator_1->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+  event_handler.addEstimator( local_estimator_1 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    local_estimator_2( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                                      101, 1.0, {3}, {1.0} ) );
+
+  local_estimator_2->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator_2 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator_3( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      102, 1.0, {1}, {1.0} ) );
+
+  local_estimator_3->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+  event_handler.addEstimator( local_estimator_3 );
+
+  std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+  event_handler.getCellTrackLengthEstimatorIds(
+                          MonteCarlo::NEUTRON,
+                          std::set<Geometry::Model::EntityId>( {2, 3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {100} ) );
+
+  estimator_ids.clear();
+
+  event_handler.getCellTrackLengthEstimatorIds(
+                          MonteCarlo::PHOTON,
+                          std::set<Geometry::Model::EntityId>( {1, 2, 3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {101} ) );
+
+  estimator_ids.clear();
+
+  event_handler.getCellTrackLengthEstimatorIds(
+                          MonteCarlo::NEUTRON,
+                          std::set<Geometry::Model::EntityId>( {3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK( estimator_ids.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell entering or leaving estimators in a set of cells can be
+// found
+FRENSIE_UNIT_TEST( EventHandler, getCellEnteringOrLeavingEstimatorIds )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+    local_estimator_1( new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                                         100, 1.0, {1, 2} ) );
+
+  local_estimator_1->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator_1 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+    local_estimator_2( new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                                            101, 1.0, {3} ) );
+
+  local_estimator_2->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+  event_handler.addEstimator( local_estimator_2 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator_3( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      102, 1.0, {1}, {1.0} ) );
+
+  local_estimator_3->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator_3 );
+
+  std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+  event_handler.getCellEnteringOrLeavingEstimatorIds(
+                          MonteCarlo::PHOTON,
+                          std::set<Geometry::Model::EntityId>( {1, 3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {100} ) );
+
+  estimator_ids.clear();
+
+  event_handler.getCellEnteringOrLeavingEstimatorIds(
+                          MonteCarlo::ELECTRON,
+                          std::set<Geometry::Model::EntityId>( {1, 2, 3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {101} ) );
+
+  estimator_ids.clear();
+
+  event_handler.getCellEnteringOrLeavingEstimatorIds(
+                          MonteCarlo::PHOTON,
+                          std::set<Geometry::Model::EntityId>( {3} ),
+                          estimator_ids );
+
+  FRENSIE_CHECK( estimator_ids.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface estimators can be found
+FRENSIE_UNIT_TEST( EventHandler, getSurfaceEstimatorIds )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedSurfaceFluxEstimator>
+    local_estimator_1( new MonteCarlo::WeightMultipliedSurfaceFluxEstimator(
+                                                      100, 1.0, {1}, {1.0} ) );
+
+  local_estimator_1->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator_1 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedSurfaceCurrentEstimator>
+    local_estimator_2( new MonteCarlo::WeightMultipliedSurfaceCurrentEstimator(
+                                                            101, 1.0, {2} ) );
+
+  local_estimator_2->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+  event_handler.addEstimator( local_estimator_2 );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator_3( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      102, 1.0, {1}, {1.0} ) );
+
+  local_estimator_3->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator_3 );
+
+  std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+  event_handler.getSurfaceEstimatorIds( MonteCarlo::PHOTON, estimator_ids );
+
+  FRENSIE_CHECK_EQUAL( estimator_ids,
+                       std::set<MonteCarlo::Estimator::Id>( {100} ) );
+
+  estimator_ids.clear();
+
+  event_handler.getSurfaceEstimatorIds( MonteCarlo::NEUTRON, estimator_ids );
+
+  FRENSIE_CHECK( estimator_ids.empty() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that stored estimators can be returned
 FRENSIE_UNIT_TEST( EventHandler, getEstimator )
@@ -318,6 +318,92 @@ FRENSIE_UNIT_TEST( ParticleEnteringCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dispatch table can be compiled
+FRENSIE_UNIT_TEST( ParticleEnteringCellEventDispatcher, compileDispatchTable )
+{
+  std::shared_ptr<MonteCarlo::ParticleEnteringCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleEnteringCellEventDispatcher );
+
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->attachObserver( 0, {MonteCarlo::PHOTON}, estimator_1 );
+  dispatcher->attachObserver( 1, estimator_2->getParticleTypes(), estimator_2 );
+
+  dispatcher->compileDispatchTable();
+
+  FRENSIE_CHECK( dispatcher->isDispatchTableCompiled() );
+
+  {
+    const double initial_first_moment_1 =
+      estimator_1->getEntityBinDataFirstMoments( 0 ).front();
+
+    const double initial_first_moment_2 =
+      estimator_2->getEntityBinDataFirstMoments( 1 ).front();
+
+    MonteCarlo::PhotonState photon( 0ull );
+    photon.setWeight( 1.0 );
+    photon.setEnergy( 2.0 );
+
+    MonteCarlo::ElectronState electron( 0ull );
+    electron.setWeight( 1.0 );
+    electron.setEnergy( 2.0 );
+
+    // Events in cells without observers are skipped
+    dispatcher->dispatchParticleEnteringCellEvent( photon, 2 );
+
+    FRENSIE_CHECK( !estimator_1->hasUncommittedHistoryContribution() );
+    FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+
+    // Events of particles without observers are skipped
+    dispatcher->dispatchParticleEnteringCellEvent( electron, 0 );
+
+    FRENSIE_CHECK( !estimator_1->hasUncommittedHistoryContribution() );
+    FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+
+    dispatcher->dispatchParticleEnteringCellEvent( photon, 0 );
+
+    FRENSIE_CHECK( estimator_1->hasUncommittedHistoryContribution() );
+    FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+
+    dispatcher->dispatchParticleEnteringCellEvent( electron, 1 );
+
+    FRENSIE_CHECK( estimator_2->hasUncommittedHistoryContribution() );
+
+    photon.setEnergy( 1.0 );
+    electron.setEnergy( 1.0 );
+
+    estimator_1->updateFromParticleLeavingCellEvent( photon, 0 );
+    estimator_2->updateFromParticleLeavingCellEvent( electron, 1 );
+
+    estimator_1->commitHistoryContribution();
+    estimator_2->commitHistoryContribution();
+
+    FRENSIE_CHECK_EQUAL( estimator_1->getEntityBinDataFirstMoments( 0 ).front(),
+                         initial_first_moment_1 + 1.0 );
+    FRENSIE_CHECK_EQUAL( estimator_2->getEntityBinDataFirstMoments( 1 ).front(),
+                         initial_first_moment_2 + 1.0 );
+  }
+
+  // Attaching or detaching observers invalidates the table
+  dispatcher->attachObserver( 1, estimator_1 );
+
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->compileDispatchTable();
+
+  FRENSIE_CHECK( dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->detachObserver( estimator_1 );
+
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+
+  dispatcher->compileDispatchTable();
+  dispatcher->detachAllObservers();
+
+  FRENSIE_CHECK( !dispatcher->isDispatchTableCompiled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an event dispatcher can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleEnteringCellEventDispatcher,
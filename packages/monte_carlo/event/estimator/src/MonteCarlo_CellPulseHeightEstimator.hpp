@@ -33,16 +33,34 @@ namespace MonteCarlo{
  * should only appear within an omp critical block. Use the enable thread
  * support member function to set up an instance of this class for the
  * requested number of threads. The classes default initialization is for
- * a single thread.
+ * a single thread. Each thread tracks the energy and charge deposited in the
+ * cells during the current history in dense arrays indexed by the local cell
+ * index, along with the list of cells that have been updated, so that
+ * committing and resetting a history only visits the updated cells.
  */
 template<typename ContributionMultiplierPolicy = WeightMultiplier>
 class CellPulseHeightEstimator : public EntityEstimator,
                                  public ParticleEnteringCellEventObserver,
                                  public ParticleLeavingCellEventObserver
 {
-  // Typedef for the serial update tracker
-  typedef std::pair<double,std::unordered_map<Geometry::Model::EntityId,std::tuple<double,double> > >
-  SerialUpdateTracker;
+  // The serial update tracker
+  struct SerialUpdateTracker
+  {
+    // The source weight of the current history
+    double source_weight;
+
+    // The energy deposited in each cell (indexed by the local cell index)
+    std::vector<double> energy_deposition;
+
+    // The charge deposited in each cell (indexed by the local cell index)
+    std::vector<double> charge_deposition;
+
+    // Records if a cell has been updated by the current history
+    std::vector<unsigned char> cell_updated;
+
+    // The local indices of the cells updated by the current history
+    std::vector<size_t> updated_cells;
+  };
 
   // Typedef for the parallel update tracker
   typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
@@ -135,6 +153,22 @@ private:
                                               const double source_weight,
                                               WeightAndChargeMultiplier );
 
+  // Initialize the local cell indices
+  void initializeLocalCellIndices();
+
+  // Cache the energy bin boundaries
+  void cacheEnergyBinBoundaries();
+
+  // Return the local index of a cell
+  size_t getLocalCellIndex( const CellIdType cell_id ) const;
+
+  // Calculate the energy bin index of a pulse
+  bool calculateEnergyBinIndexOfPulse( const double pulse_energy,
+                                       size_t& bin_index ) const;
+
+  // Initialize the update tracker
+  void initializeUpdateTracker( const unsigned thread_id );
+
   // Add info to update tracker
   void addInfoToUpdateTracker( const unsigned thread_id,
                                const CellIdType cell_id,
@@ -142,12 +176,6 @@ private:
                                const double energy_contribution,
                                const double charge_contribution );
 
-  // Get the entity iterators from the update tracker
-  void getCellIteratorFromUpdateTracker(
-                const unsigned thread_id,
-                typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
-                typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const;
-
   // Reset the update tracker
   void resetUpdateTracker( const unsigned thread_id );
 
@@ -164,11 +192,14 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // The entities that have been updated
-  ParallelUpdateTracker d_update_tracker;
+  // The cell ids (sorted - the position of a cell id is its local index)
+  std::vector<CellIdType> d_cell_ids;
+
+  // The energy bin boundaries (empty if there is no energy discretization)
+  std::vector<double> d_energy_bin_boundaries;
 
-  // The generic particle state map (avoids having to make a new map for cont.)
-  std::vector<Estimator::DimensionValueMap> d_dimension_values;
+  // The cells that have been updated
+  ParallelUpdateTracker d_update_tracker;
 };
 
 //! The weight multiplied cell pulse height estimator
@@ -11,9 +11,11 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "Utility_PhysicalConstants.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -35,13 +37,17 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::CellPulseHeightEstimator
   : EntityEstimator( id, multiplier, entity_ids ),
     ParticleEnteringCellEventObserver(),
     ParticleLeavingCellEventObserver(),
-    d_update_tracker( 1 ),
-    d_dimension_values( 1 )
+    d_cell_ids(),
+    d_energy_bin_boundaries(),
+    d_update_tracker( 1 )
 {
   // Set the particle types to photon, electron, positron
   Estimator::assignParticleType( PHOTON );
   Estimator::assignParticleType( ELECTRON );
   Estimator::assignParticleType( POSITRON );
+
+  this->initializeLocalCellIndices();
+  this->initializeUpdateTracker( 0 );
 }
 
 // Check if the estimator is a cell estimator
@@ -156,88 +162,73 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 }
 
 // Add estimator contribution from a portion of the current history
+/*! \details Only the cells that have been updated by the current history
+ * will be visited. The energy bin of each pulse is found directly from the
+ * cached energy bin boundaries (pulse height estimators can only be
+ * discretized in energy and they have a single response function).
+ */
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContribution()
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator
-    cell_data, end_cell_data;
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_update_tracker.size() );
 
-  this->getCellIteratorFromUpdateTracker( thread_id, cell_data, end_cell_data );
+  const SerialUpdateTracker& thread_update_tracker =
+    d_update_tracker[thread_id];
 
   double energy_deposition_in_all_cells = 0.0;
   double charge_deposition_in_all_cells = 0.0;
-  double source_weight = d_update_tracker[thread_id].first;
+  double source_weight = thread_update_tracker.source_weight;
 
   size_t bin_index;
   double bin_contribution;
 
-  Estimator::DimensionValueMap& thread_dimension_values =
-    d_dimension_values[thread_id];
-
-  while( cell_data != end_cell_data )
+  for( size_t i = 0; i < thread_update_tracker.updated_cells.size(); ++i )
   {
-    // The energy deposited in the cell by this history must be multiplied by
-    // the source weight
-    thread_dimension_values[OBSERVER_ENERGY_DIMENSION] =
-      boost::any( Utility::get<0>(cell_data->second)*source_weight );
+    const size_t cell_index = thread_update_tracker.updated_cells[i];
 
-    if( this->isPointInEstimatorPhaseSpace( thread_dimension_values ) )
-    {
-      ObserverPhaseSpaceDimensionDiscretization::BinIndexArray bin_indices;
+    const double cell_energy_deposition =
+      thread_update_tracker.energy_deposition[cell_index];
 
-      this->calculateBinIndicesOfPoint( thread_dimension_values,
-                                        0u,
-                                        bin_indices );
+    const double cell_charge_deposition =
+      thread_update_tracker.charge_deposition[cell_index];
 
+    // The energy deposited in the cell by this history must be multiplied by
+    // the source weight
+    if( this->calculateEnergyBinIndexOfPulse( cell_energy_deposition*source_weight,
+                                              bin_index ) )
+    {
       bin_contribution = this->calculateHistoryContribution(
-                                            Utility::get<0>(cell_data->second),
-                                            Utility::get<1>(cell_data->second),
+                                            cell_energy_deposition,
+                                            cell_charge_deposition,
                                             source_weight,
                                             ContributionMultiplierPolicy() );
 
-      for( size_t i = 0; i < bin_indices.size(); ++i )
-      {
-        this->commitHistoryContributionToBinOfEntity( cell_data->first,
-                                                      bin_indices[i],
-                                                      bin_contribution );
-      }
+      this->commitHistoryContributionToBinOfEntity( d_cell_ids[cell_index],
+                                                    bin_index,
+                                                    bin_contribution );
 
       // Add the energy deposition in this cell to the total energy deposition
-      energy_deposition_in_all_cells += Utility::get<0>(cell_data->second);
-      charge_deposition_in_all_cells += Utility::get<1>(cell_data->second);
+      energy_deposition_in_all_cells += cell_energy_deposition;
+      charge_deposition_in_all_cells += cell_charge_deposition;
     }
-
-    ++cell_data;
   }
 
-  // Store the total energy deposition in the dimension values map
+  // Determine the pulse bin for the combination of all cells
   // The total energy deposited in all cells by this history must be multiplied
   // by the source weight
-  thread_dimension_values[OBSERVER_ENERGY_DIMENSION] =
-    boost::any( energy_deposition_in_all_cells*source_weight );
-
-  // Determine the pulse bin for the combination of all cells
-  if( this->isPointInEstimatorPhaseSpace( thread_dimension_values ) )
+  if( this->calculateEnergyBinIndexOfPulse( energy_deposition_in_all_cells*source_weight,
+                                            bin_index ) )
   {
-    ObserverPhaseSpaceDimensionDiscretization::BinIndexArray bin_indices;
-
-    this->calculateBinIndicesOfPoint( thread_dimension_values,
-                                      0u,
-                                      bin_indices );
-
     bin_contribution = this->calculateHistoryContribution(
                                             energy_deposition_in_all_cells,
                                             charge_deposition_in_all_cells,
                                             source_weight,
                                             ContributionMultiplierPolicy() );
 
-    for( size_t i = 0; i < bin_indices.size(); ++i )
-    {
-      this->commitHistoryContributionToBinOfTotal( bin_indices[i],
-                                                   bin_contribution );
-    }
+    this->commitHistoryContributionToBinOfTotal( bin_index, bin_contribution );
   }
 
   // Reset the update tracker
@@ -271,8 +262,8 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
   // Add thread support to update tracker
   d_update_tracker.resize( num_threads );
 
-  // Add thread support to the dimension values
-  d_dimension_values.resize( num_threads );
+  for( size_t i = 0; i < d_update_tracker.size(); ++i )
+    this->initializeUpdateTracker( i );
 }
 
 // Reset the estimator data
@@ -287,8 +278,7 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetData()
   // Reset the update tracker
   for( size_t i = 0; i < d_update_tracker.size(); ++i )
   {
-    d_update_tracker[i].first = 0.0;
-    d_update_tracker[i].second.clear();
+    this->resetUpdateTracker( i );
 
     this->unsetHasUncommittedHistoryContribution( i );
   }
@@ -301,7 +291,11 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::assignDiscretizatio
   const bool range_dimension )
 {
   if( bins->getDimension() == OBSERVER_ENERGY_DIMENSION )
+  {
     EntityEstimator::assignDiscretization( bins, false );
+
+    this->cacheEnergyBinBoundaries();
+  }
   else
   {
     FRENSIE_LOG_TAGGED_WARNING( "Estimator",
@@ -393,6 +387,96 @@ inline double CellPulseHeightEstimator<ContributionMultiplierPolicy>::calculateH
     return 0.0;
 }
 
+// Initialize the local cell indices
+template<typename ContributionMultiplierPolicy>
+void CellPulseHeightEstimator<ContributionMultiplierPolicy>::initializeLocalCellIndices()
+{
+  std::set<EntityId> cell_ids;
+
+  this->getEntityIds( cell_ids );
+
+  // The set is sorted, which allows the local index of a cell to be found
+  // with a binary search
+  d_cell_ids.assign( cell_ids.begin(), cell_ids.end() );
+}
+
+// Cache the energy bin boundaries
+template<typename ContributionMultiplierPolicy>
+void CellPulseHeightEstimator<ContributionMultiplierPolicy>::cacheEnergyBinBoundaries()
+{
+  if( this->doesDimensionHaveDiscretization( OBSERVER_ENERGY_DIMENSION ) )
+  {
+    this->template getDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+  }
+  else
+    d_energy_bin_boundaries.clear();
+}
+
+// Return the local index of a cell
+template<typename ContributionMultiplierPolicy>
+inline size_t CellPulseHeightEstimator<ContributionMultiplierPolicy>::getLocalCellIndex(
+                                            const CellIdType cell_id ) const
+{
+  // Make sure the cell is assigned to this estimator
+  testPrecondition( this->isEntityAssigned( cell_id ) );
+
+  return std::lower_bound( d_cell_ids.begin(), d_cell_ids.end(), cell_id ) -
+    d_cell_ids.begin();
+}
+
+// Calculate the energy bin index of a pulse
+/*! \details This will return false if the pulse is not in the estimator
+ * phase space. The bin index that is found will be identical to the one
+ * calculated by the energy dimension discretization.
+ */
+template<typename ContributionMultiplierPolicy>
+inline bool CellPulseHeightEstimator<ContributionMultiplierPolicy>::calculateEnergyBinIndexOfPulse(
+                                                   const double pulse_energy,
+                                                   size_t& bin_index ) const
+{
+  // The entire phase space is a single bin when there is no discretization
+  if( d_energy_bin_boundaries.empty() )
+  {
+    bin_index = 0;
+
+    return true;
+  }
+  else if( pulse_energy >= d_energy_bin_boundaries.front() &&
+           pulse_energy <= d_energy_bin_boundaries.back() )
+  {
+    bin_index =
+      Utility::Search::binaryUpperBoundIndex( d_energy_bin_boundaries.begin(),
+                                              d_energy_bin_boundaries.end(),
+                                              pulse_energy );
+
+    if( bin_index != 0 )
+      --bin_index;
+
+    return true;
+  }
+  else
+    return false;
+}
+
+// Initialize the update tracker
+template<typename ContributionMultiplierPolicy>
+void CellPulseHeightEstimator<ContributionMultiplierPolicy>::initializeUpdateTracker(
+                                                     const unsigned thread_id )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_update_tracker.size() );
+
+  SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
+
+  thread_update_tracker.source_weight = 0.0;
+  thread_update_tracker.energy_deposition.assign( d_cell_ids.size(), 0.0 );
+  thread_update_tracker.charge_deposition.assign( d_cell_ids.size(), 0.0 );
+  thread_update_tracker.cell_updated.assign( d_cell_ids.size(), 0 );
+  thread_update_tracker.updated_cells.clear();
+  thread_update_tracker.updated_cells.reserve( d_cell_ids.size() );
+}
+
 // Add info to update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTracker(
@@ -407,38 +491,25 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTrac
 
   SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
 
-  auto cell_it = thread_update_tracker.second.find( cell_id );
+  const size_t cell_index = this->getLocalCellIndex( cell_id );
 
-  if( thread_update_tracker.first == 0.0 )
-    thread_update_tracker.first = source_weight;
+  if( thread_update_tracker.source_weight == 0.0 )
+    thread_update_tracker.source_weight = source_weight;
 
-  if( cell_it != thread_update_tracker.second.end() )
-  {
-    Utility::get<0>( cell_it->second ) += energy_contribution;
-    Utility::get<1>( cell_it->second ) += charge_contribution;
-  }
-  else
+  if( !thread_update_tracker.cell_updated[cell_index] )
   {
-    thread_update_tracker.second[cell_id] =
-      std::make_pair( energy_contribution, charge_contribution );
+    thread_update_tracker.cell_updated[cell_index] = 1;
+    thread_update_tracker.updated_cells.push_back( cell_index );
   }
-}
-
-// Get the entity iterators from the update tracker
-template<typename ContributionMultiplierPolicy>
-void CellPulseHeightEstimator<ContributionMultiplierPolicy>::getCellIteratorFromUpdateTracker(
-                 const unsigned thread_id,
-                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
-                typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const
-{
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
 
-  start_cell = d_update_tracker[thread_id].second.begin();
-  end_cell = d_update_tracker[thread_id].second.end();
+  thread_update_tracker.energy_deposition[cell_index] += energy_contribution;
+  thread_update_tracker.charge_deposition[cell_index] += charge_contribution;
 }
 
 // Reset the update tracker
+/*! \details Only the cells that have been updated by the current history
+ * will be reset.
+ */
 template<typename ContributionMultiplierPolicy>
 void
 CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetUpdateTracker(
@@ -447,8 +518,19 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetUpdateTracker(
   // Make sure the thread id is valid
   testPrecondition( thread_id < d_update_tracker.size() );
 
-  d_update_tracker[thread_id].first = 0.0;
-  d_update_tracker[thread_id].second.clear();
+  SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
+
+  for( size_t i = 0; i < thread_update_tracker.updated_cells.size(); ++i )
+  {
+    const size_t cell_index = thread_update_tracker.updated_cells[i];
+
+    thread_update_tracker.energy_deposition[cell_index] = 0.0;
+    thread_update_tracker.charge_deposition[cell_index] = 0.0;
+    thread_update_tracker.cell_updated[cell_index] = 0;
+  }
+
+  thread_update_tracker.source_weight = 0.0;
+  thread_update_tracker.updated_cells.clear();
 }
 
 // Save the data to an archive
@@ -474,9 +556,14 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::load( Archive& ar,
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleEnteringCellEventObserver );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleLeavingCellEventObserver );
 
+  // Initialize the cached data
+  this->initializeLocalCellIndices();
+  this->cacheEnergyBinBoundaries();
+
   // Initialize the thread data
   d_update_tracker.resize( 1 );
-  d_dimension_values.resize( 1 );
+
+  this->initializeUpdateTracker( 0 );
 }
 
 } // end MonteCarlo namespace
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -574,26 +577,25 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
-    // Reduce the entity bin data
+    // Reduce the entity bin data and the bin data of total with a single
+    // flat reduction
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_estimator_moments_map );
+      MomentReductionLayout layout;
+
+      this->addEntityCollectionMapToReductionLayout(
+                                    d_entity_estimator_moments_map, layout );
+      this->addCollectionToReductionLayout( d_estimator_total_bin_data,
+                                            layout );
+
+      this->reduceMoments( comm, root_process, layout );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in entity bin "
                              "estimator " << this->getId() << " for entity "
-                             "bin data!" );
+                             "and total bin data!" );
 
     comm.barrier();
 
-    // Reduce bin data of total
-    try{
-      this->reduceCollection( comm, root_process, d_estimator_total_bin_data );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in entity "
-                             "estimator " << this->getId() << " for total bin "
-                             "data!" );
-
     if( d_entity_bin_snapshots_enabled )
     {
       // Reduce the entity bin snapshot data
@@ -640,77 +642,37 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   Estimator::reduceData( comm, root_process );
 }
 
-// Reduce the entity collection maps
-void EntityEstimator::reduceEntityCollectionMaps(
-                    const Utility::Communicator& comm,
-                    const int root_process,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
+// Add the entity collections to a flat moment reduction layout
+/*! \details The entities are added in order of increasing entity id so that
+ * the layout is identical on every process.
+ */
+void EntityEstimator::addEntityCollectionMapToReductionLayout(
+                    EntityEstimatorMomentsCollectionMap& collection_map,
+                    MomentReductionLayout& layout ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<EntityEstimatorMomentsCollectionMap>
-      gathered_entity_data( comm.size() );
+  std::vector<EntityId> entity_ids;
+  entity_ids.reserve( collection_map.size() );
 
-    std::vector<Utility::Communicator::Request> gathered_requests;
+  for( auto&& entity_data : collection_map )
+    entity_ids.push_back( entity_data.first );
 
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
+  std::sort( entity_ids.begin(), entity_ids.end() );
 
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-    
-    Utility::wait( gathered_requests, gathered_statuses );
-    
-    this->reduceEntityCollections( gathered_entity_data,
-                                   root_process,
-                                   collection_map );
-  }
-  else
-    Utility::send( comm, root_process, 0, collection_map );
+  for( auto&& entity_id : entity_ids )
+    this->addCollectionToReductionLayout( collection_map[entity_id], layout );
 }
 
-// Reduce the entity moments
-void EntityEstimator::reduceEntityCollections(
-                    const std::vector<EntityEstimatorMomentsCollectionMap>&
-                    other_entity_estimator_moments_maps,
-                    const size_t root_index,
+// Reduce the entity collection maps
+void EntityEstimator::reduceEntityCollectionMaps(
+                    const Utility::Communicator& comm,
+                    const int root_process,
                     EntityEstimatorMomentsCollectionMap& collection_map ) const
 {
-  // Reduce the data that was on each process
-  for( auto&& entity_data : collection_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_moments_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionMap::value_type&
-          other_entity_data = *other_entity_estimator_moments_maps[j].find( entity_data.first );
+  MomentReductionLayout layout;
 
-        for( size_t i = 0; i < entity_data.second.size(); ++i )
-        {
-          Utility::getCurrentScore<1>( entity_data.second, i ) +=
-            Utility::getCurrentScore<1>( other_entity_data.second, i );
+  this->addEntityCollectionMapToReductionLayout( collection_map, layout );
 
-          Utility::getCurrentScore<2>( entity_data.second, i ) +=
-            Utility::getCurrentScore<2>( other_entity_data.second, i );
-
-          Utility::getCurrentScore<3>( entity_data.second, i ) +=
-            Utility::getCurrentScore<3>( other_entity_data.second, i );
-
-          Utility::getCurrentScore<4>( entity_data.second, i ) +=
-            Utility::getCurrentScore<4>( other_entity_data.second, i );
-        }
-      }
-    }
-  }
+  this->reduceMoments( comm, root_process, layout );
 }
 
 // Reduce the entity snapshot maps
@@ -232,6 +232,11 @@ protected:
   //! Get the bin data for an entity
   const Estimator::FourEstimatorMomentsCollection& getEntityBinData( const EntityId entity_id ) const;
 
+  //! Add the entity collections to a flat moment reduction layout
+  void addEntityCollectionMapToReductionLayout(
+                    EntityEstimatorMomentsCollectionMap& collection_map,
+                    MomentReductionLayout& layout ) const;
+
   //! Reduce the entity collection maps
   void reduceEntityCollectionMaps(
                    const Utility::Communicator& comm,
@@ -311,13 +316,6 @@ private:
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
 
-  // Reduce the entity collections
-  void reduceEntityCollections(
-                   const std::vector<EntityEstimatorMomentsCollectionMap>&
-                   other_entity_estimator_moments_maps,
-                   const size_t root_index,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
-
   // Reduce the entity snapshots
   void reduceEntitySnapshots(
            const std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>&
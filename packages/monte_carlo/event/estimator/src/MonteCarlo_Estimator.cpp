@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <limits>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -17,8 +18,57 @@
 
 namespace MonteCarlo{
 
+namespace Details{
+
+// Copy values between a flat moment reduction layout and a buffer
+/*! \details The segment and offset will be advanced past the copied values.
+ */
+void copyMomentReductionLayoutValues(
+                    const std::vector<std::pair<double*,size_t> >& layout,
+                    size_t& segment,
+                    size_t& offset,
+                    double* buffer,
+                    size_t number_of_values,
+                    const bool pack )
+{
+  while( number_of_values > 0 )
+  {
+    const size_t number_of_values_to_copy =
+      std::min( number_of_values, layout[segment].second - offset );
+
+    double* segment_values = layout[segment].first + offset;
+
+    if( pack )
+    {
+      std::copy( segment_values,
+                 segment_values + number_of_values_to_copy,
+                 buffer );
+    }
+    else
+    {
+      std::copy( buffer,
+                 buffer + number_of_values_to_copy,
+                 segment_values );
+    }
+
+    buffer += number_of_values_to_copy;
+    number_of_values -= number_of_values_to_copy;
+    offset += number_of_values_to_copy;
+
+    if( offset == layout[segment].second )
+    {
+      ++segment;
+      offset = 0;
+    }
+  }
+}
+
+} // end Details namespace
+
 // Initialize static member data
 std::shared_ptr<const std::vector<double> > Estimator::s_default_sample_moment_histogram_bins;
+
+const size_t Estimator::s_max_reduction_chunk_size = 16777216;
   
 // Default constructor
 Estimator::Estimator()
@@ -294,36 +344,43 @@ void Estimator::getTotalBinProcessedData(
                                    std::vector<double>& variance_of_variance,
                                    std::vector<double>& figure_of_merit ) const
 {
-  Utility::ArrayView<const double> first_moments =
-    this->getTotalBinDataFirstMoments();
-
-  Utility::ArrayView<const double> second_moments =
-    this->getTotalBinDataSecondMoments();
-
-  Utility::ArrayView<const double> third_moments =
-    this->getTotalBinDataThirdMoments();
-
-  Utility::ArrayView<const double> fourth_moments =
-    this->getTotalBinDataFourthMoments();
+  const size_t number_of_values =
+    this->getTotalBinDataFirstMoments().size();
 
   // Resize the output arrays
-  mean.resize( first_moments.size() );
-  relative_error.resize( first_moments.size() );
-  variance_of_variance.resize( first_moments.size() );
-  figure_of_merit.resize( first_moments.size() );
+  mean.resize( number_of_values );
+  relative_error.resize( number_of_values );
+  variance_of_variance.resize( number_of_values );
+  figure_of_merit.resize( number_of_values );
 
-  for( size_t i = 0; i < first_moments.size(); ++i )
-  {
-    this->processMoments( Utility::SampleMoment<1,double>(first_moments[i]),
-                          Utility::SampleMoment<2,double>(second_moments[i]),
-                          Utility::SampleMoment<3,double>(third_moments[i]),
-                          Utility::SampleMoment<4,double>(fourth_moments[i]),
-                          this->getTotalNormConstant(),
-                          mean[i],
-                          relative_error[i],
-                          variance_of_variance[i],
-                          figure_of_merit[i] );
-  }
+  this->getTotalBinProcessedData( Utility::arrayView( mean ),
+                                  Utility::arrayView( relative_error ),
+                                  Utility::arrayView( variance_of_variance ),
+                                  Utility::arrayView( figure_of_merit ) );
+}
+
+// Get the total estimator bin mean, relative error, vov and fom
+/*! \details The output arrays must have the same size as the moment arrays.
+ * Make sure that the number of histories have been set
+ * (MonteCarlo::ParticleHistoryObserver::setNumberOfHistories) and that the
+ * elapsed time has been set
+ * (MonteCarlo::ParticleHistoryObserver::setElapsedTime).
+ */
+void Estimator::getTotalBinProcessedData(
+                       const Utility::ArrayView<double>& mean,
+                       const Utility::ArrayView<double>& relative_error,
+                       const Utility::ArrayView<double>& variance_of_variance,
+                       const Utility::ArrayView<double>& figure_of_merit ) const
+{
+  this->processMoments( this->getTotalBinDataFirstMoments(),
+                        this->getTotalBinDataSecondMoments(),
+                        this->getTotalBinDataThirdMoments(),
+                        this->getTotalBinDataFourthMoments(),
+                        this->getTotalNormConstant(),
+                        mean,
+                        relative_error,
+                        variance_of_variance,
+                        figure_of_merit );
 }
 
 // Get the total estimator bin mean and relative error
@@ -362,37 +419,52 @@ void Estimator::getEntityBinProcessedData(
                       std::runtime_error,
                       "Entity " << entity_id << " is not assigned to "
                       "estimator " << this->getId() << "!" );
-  
-  Utility::ArrayView<const double> first_moments =
-    this->getEntityBinDataFirstMoments( entity_id );
 
-  Utility::ArrayView<const double> second_moments =
-    this->getEntityBinDataSecondMoments( entity_id );
+  const size_t number_of_values =
+    this->getEntityBinDataFirstMoments( entity_id ).size();
 
-  Utility::ArrayView<const double> third_moments =
-    this->getEntityBinDataThirdMoments( entity_id );
+  // Resize the output arrays
+  mean.resize( number_of_values );
+  relative_error.resize( number_of_values );
+  variance_of_variance.resize( number_of_values );
+  figure_of_merit.resize( number_of_values );
 
-  Utility::ArrayView<const double> fourth_moments =
-    this->getEntityBinDataFourthMoments( entity_id );
+  this->getEntityBinProcessedData( entity_id,
+                                   Utility::arrayView( mean ),
+                                   Utility::arrayView( relative_error ),
+                                   Utility::arrayView( variance_of_variance ),
+                                   Utility::arrayView( figure_of_merit ) );
+}
 
-  // Resize the output arrays
-  mean.resize( first_moments.size() );
-  relative_error.resize( first_moments.size() );
-  variance_of_variance.resize( first_moments.size() );
-  figure_of_merit.resize( first_moments.size() );
+// Get the bin data mean, relative error, vov and fom for an entity
+/*! \details The output arrays must have the same size as the moment arrays.
+ * Make sure that the number of histories have been set
+ * (MonteCarlo::ParticleHistoryObserver::setNumberOfHistories) and that the
+ * elapsed time has been set
+ * (MonteCarlo::ParticleHistoryObserver::setElapsedTime).
+ */
+void Estimator::getEntityBinProcessedData(
+                       const EntityId entity_id,
+                       const Utility::ArrayView<double>& mean,
+                       const Utility::ArrayView<double>& relative_error,
+                       const Utility::ArrayView<double>& variance_of_variance,
+                       const Utility::ArrayView<double>& figure_of_merit ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
 
-  for( size_t i = 0; i < first_moments.size(); ++i )
-  {
-    this->processMoments( Utility::SampleMoment<1,double>(first_moments[i]),
-                          Utility::SampleMoment<2,double>(second_moments[i]),
-                          Utility::SampleMoment<3,double>(third_moments[i]),
-                          Utility::SampleMoment<4,double>(fourth_moments[i]),
-                          this->getEntityNormConstant( entity_id ),
-                          mean[i],
-                          relative_error[i],
-                          variance_of_variance[i],
-                          figure_of_merit[i] );
-  }
+  this->processMoments( this->getEntityBinDataFirstMoments( entity_id ),
+                        this->getEntityBinDataSecondMoments( entity_id ),
+                        this->getEntityBinDataThirdMoments( entity_id ),
+                        this->getEntityBinDataFourthMoments( entity_id ),
+                        this->getEntityNormConstant( entity_id ),
+                        mean,
+                        relative_error,
+                        variance_of_variance,
+                        figure_of_merit );
 }
 
 // Get the bin data mean, relative error, and fom for an entity
@@ -457,36 +529,43 @@ void Estimator::getTotalProcessedData(
                                    std::vector<double>& variance_of_variance,
                                    std::vector<double>& figure_of_merit ) const
 {
-  Utility::ArrayView<const double> first_moments =
-    this->getTotalDataFirstMoments();
-
-  Utility::ArrayView<const double> second_moments =
-    this->getTotalDataSecondMoments();
-
-  Utility::ArrayView<const double> third_moments =
-    this->getTotalDataThirdMoments();
-
-  Utility::ArrayView<const double> fourth_moments =
-    this->getTotalDataFourthMoments();
+  const size_t number_of_values =
+    this->getTotalDataFirstMoments().size();
 
   // Resize the output arrays
-  mean.resize( first_moments.size() );
-  relative_error.resize( first_moments.size() );
-  variance_of_variance.resize( first_moments.size() );
-  figure_of_merit.resize( first_moments.size() );
+  mean.resize( number_of_values );
+  relative_error.resize( number_of_values );
+  variance_of_variance.resize( number_of_values );
+  figure_of_merit.resize( number_of_values );
 
-  for( size_t i = 0; i < first_moments.size(); ++i )
-  {
-    this->processMoments( Utility::SampleMoment<1,double>(first_moments[i]),
-                          Utility::SampleMoment<2,double>(second_moments[i]),
-                          Utility::SampleMoment<3,double>(third_moments[i]),
-                          Utility::SampleMoment<4,double>(fourth_moments[i]),
-                          this->getTotalNormConstant(),
-                          mean[i],
-                          relative_error[i],
-                          variance_of_variance[i],
-                          figure_of_merit[i] );
-  }
+  this->getTotalProcessedData( Utility::arrayView( mean ),
+                               Utility::arrayView( relative_error ),
+                               Utility::arrayView( variance_of_variance ),
+                               Utility::arrayView( figure_of_merit ) );
+}
+
+// Get the total data mean, relative error, vov and fom
+/*! \details The output arrays must have the same size as the moment arrays.
+ * Make sure that the number of histories have been set
+ * (MonteCarlo::ParticleHistoryObserver::setNumberOfHistories) and that the
+ * elapsed time has been set
+ * (MonteCarlo::ParticleHistoryObserver::setElapsedTime).
+ */
+void Estimator::getTotalProcessedData(
+                       const Utility::ArrayView<double>& mean,
+                       const Utility::ArrayView<double>& relative_error,
+                       const Utility::ArrayView<double>& variance_of_variance,
+                       const Utility::ArrayView<double>& figure_of_merit ) const
+{
+  this->processMoments( this->getTotalDataFirstMoments(),
+                        this->getTotalDataSecondMoments(),
+                        this->getTotalDataThirdMoments(),
+                        this->getTotalDataFourthMoments(),
+                        this->getTotalNormConstant(),
+                        mean,
+                        relative_error,
+                        variance_of_variance,
+                        figure_of_merit );
 }
 
 // Get the total data mean, relative error, vov and fom
@@ -544,36 +623,45 @@ void Estimator::getEntityTotalProcessedData(
                                    std::vector<double>& variance_of_variance,
                                    std::vector<double>& figure_of_merit ) const
 {
-  Utility::ArrayView<const double> first_moments =
-    this->getEntityTotalDataFirstMoments( entity_id );
-
-  Utility::ArrayView<const double> second_moments =
-    this->getEntityTotalDataSecondMoments( entity_id );
-
-  Utility::ArrayView<const double> third_moments =
-    this->getEntityTotalDataThirdMoments( entity_id );
-
-  Utility::ArrayView<const double> fourth_moments =
-    this->getEntityTotalDataFourthMoments( entity_id );
+  const size_t number_of_values =
+    this->getEntityTotalDataFirstMoments( entity_id ).size();
 
   // Resize the output arrays
-  mean.resize( first_moments.size() );
-  relative_error.resize( first_moments.size() );
-  variance_of_variance.resize( first_moments.size() );
-  figure_of_merit.resize( first_moments.size() );
+  mean.resize( number_of_values );
+  relative_error.resize( number_of_values );
+  variance_of_variance.resize( number_of_values );
+  figure_of_merit.resize( number_of_values );
 
-  for( size_t i = 0; i < first_moments.size(); ++i )
-  {
-    this->processMoments( Utility::SampleMoment<1,double>(first_moments[i]),
-                          Utility::SampleMoment<2,double>(second_moments[i]),
-                          Utility::SampleMoment<3,double>(third_moments[i]),
-                          Utility::SampleMoment<4,double>(fourth_moments[i]),
-                          this->getEntityNormConstant( entity_id ),
-                          mean[i],
-                          relative_error[i],
-                          variance_of_variance[i],
-                          figure_of_merit[i] );
-  }
+  this->getEntityTotalProcessedData( entity_id,
+                                     Utility::arrayView( mean ),
+                                     Utility::arrayView( relative_error ),
+                                     Utility::arrayView( variance_of_variance ),
+                                     Utility::arrayView( figure_of_merit ) );
+}
+
+// Get the total data mean, relative error, vov and fom for an entity
+/*! \details The output arrays must have the same size as the moment arrays.
+ * Make sure that the number of histories have been set
+ * (MonteCarlo::ParticleHistoryObserver::setNumberOfHistories) and that the
+ * elapsed time has been set
+ * (MonteCarlo::ParticleHistoryObserver::setElapsedTime).
+ */
+void Estimator::getEntityTotalProcessedData(
+                       const EntityId entity_id,
+                       const Utility::ArrayView<double>& mean,
+                       const Utility::ArrayView<double>& relative_error,
+                       const Utility::ArrayView<double>& variance_of_variance,
+                       const Utility::ArrayView<double>& figure_of_merit ) const
+{
+  this->processMoments( this->getEntityTotalDataFirstMoments( entity_id ),
+                        this->getEntityTotalDataSecondMoments( entity_id ),
+                        this->getEntityTotalDataThirdMoments( entity_id ),
+                        this->getEntityTotalDataFourthMoments( entity_id ),
+                        this->getEntityNormConstant( entity_id ),
+                        mean,
+                        relative_error,
+                        variance_of_variance,
+                        figure_of_merit );
 }
 
 // Get the total data mean, relative error, vov and fom for an entity
@@ -1073,103 +1161,108 @@ void Estimator::unsetHasUncommittedHistoryContribution(
   d_has_uncommitted_history_contribution[thread_id] = false;
 }
 
-// Reduce a single collection
-void Estimator::reduceCollection(
-                              const Utility::Communicator& comm,
-                              const int root_process,
-                              TwoEstimatorMomentsCollection& collection ) const
+// Reduce the moments in a flat moment reduction layout
+/*! \details The moments in the layout are packed into a single contiguous
+ * buffer, which is reduced with a single native sum reduction (instead of
+ * serializing and merging the collections on the root process). Very large
+ * layouts are reduced in chunks to bound the size of the buffers. The
+ * layout must be identical on every process. Only the root process will
+ * store the reduced moments.
+ */
+void Estimator::reduceMoments( const Utility::Communicator& comm,
+                               const int root_process,
+                               const MomentReductionLayout& layout ) const
 {
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
+  size_t number_of_values = 0;
 
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
+  for( auto&& segment : layout )
+    number_of_values += segment.second;
+
+  const size_t chunk_size =
+    std::min( number_of_values, s_max_reduction_chunk_size );
+
+  std::vector<double> packed_moments( chunk_size );
+  std::vector<double> reduced_moments;
 
-  // The root process will store the reduced moments
   if( comm.rank() == root_process )
+    reduced_moments.resize( chunk_size );
+
+  size_t pack_segment = 0, pack_offset = 0;
+  size_t unpack_segment = 0, unpack_offset = 0;
+
+  for( size_t chunk_start = 0;
+       chunk_start < number_of_values;
+       chunk_start += chunk_size )
   {
-    for( size_t i = 0; i < collection.size(); ++i )
+    const size_t number_of_chunk_values =
+      std::min( chunk_size, number_of_values - chunk_start );
+
+    Details::copyMomentReductionLayoutValues( layout,
+                                              pack_segment,
+                                              pack_offset,
+                                              packed_moments.data(),
+                                              number_of_chunk_values,
+                                              true );
+
+    try{
+      Utility::reduce( comm,
+                       Utility::ArrayView<const double>( packed_moments.data(), number_of_chunk_values ),
+                       Utility::arrayView( reduced_moments ),
+                       std::plus<double>(),
+                       root_process );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction over the "
+                             "moments of estimator " << d_id << "!" );
+
+    // The root process will store the reduced moments
+    if( comm.rank() == root_process )
     {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
+      Details::copyMomentReductionLayoutValues( layout,
+                                                unpack_segment,
+                                                unpack_offset,
+                                                reduced_moments.data(),
+                                                number_of_chunk_values,
+                                                false );
     }
   }
-
-  comm.barrier();
 }
 
 // Reduce a single collection
 void Estimator::reduceCollection(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             FourEstimatorMomentsCollection& collection ) const
+                              const Utility::Communicator& comm,
+                              const int root_process,
+                              TwoEstimatorMomentsCollection& collection ) const
 {
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
-
-  comm.barrier();
+  MomentReductionLayout layout;
 
-  // Reduce the third moments
-  std::vector<double> reduced_third_moments;
+  this->addCollectionToReductionLayout( collection, layout );
 
-  this->reduceCollectionAndReturnReducedMoments<3>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_third_moments );
+  this->reduceMoments( comm, root_process, layout );
 
   comm.barrier();
+}
+
+// Reduce a single collection
+void Estimator::reduceCollection(
+                             const Utility::Communicator& comm,
+                             const int root_process,
+                             FourEstimatorMomentsCollection& collection ) const
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
 
-  // Reduce the fourth moments
-  std::vector<double> reduced_fourth_moments;
+  MomentReductionLayout layout;
 
-  this->reduceCollectionAndReturnReducedMoments<4>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_fourth_moments );
+  this->addCollectionToReductionLayout( collection, layout );
 
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-      Utility::getCurrentScore<3>( collection, i ) = reduced_third_moments[i];
-      Utility::getCurrentScore<4>( collection, i ) = reduced_fourth_moments[i];
-    }
-  }
+  this->reduceMoments( comm, root_process, layout );
 
   comm.barrier();
 }
@@ -1453,6 +1546,57 @@ void Estimator::processMoments( const Utility::SampleMoment<1,double>& first_mom
                                                         num_histories );
 }
 
+// Convert arrays of moments to arrays of mean, rel. er., vov, fom
+/*! \details The number of histories and the elapsed time are only retrieved
+ * once for the entire array.
+ */
+void Estimator::processMoments(
+                  const Utility::ArrayView<const double>& first_moments,
+                  const Utility::ArrayView<const double>& second_moments,
+                  const Utility::ArrayView<const double>& third_moments,
+                  const Utility::ArrayView<const double>& fourth_moments,
+                  const double norm_constant,
+                  const Utility::ArrayView<double>& mean,
+                  const Utility::ArrayView<double>& relative_error,
+                  const Utility::ArrayView<double>& variance_of_variance,
+                  const Utility::ArrayView<double>& figure_of_merit ) const
+{
+  // Make sure that the moment arrays are valid
+  testPrecondition( second_moments.size() == first_moments.size() );
+  testPrecondition( third_moments.size() == first_moments.size() );
+  testPrecondition( fourth_moments.size() == first_moments.size() );
+
+  TEST_FOR_EXCEPTION( mean.size() != first_moments.size() ||
+                      relative_error.size() != first_moments.size() ||
+                      variance_of_variance.size() != first_moments.size() ||
+                      figure_of_merit.size() != first_moments.size(),
+                      std::runtime_error,
+                      "The processed data arrays must have the same size "
+                      "as the moment arrays (" << first_moments.size() <<
+                      ")!" );
+
+  if( first_moments.size() > 0 )
+  {
+    const uint64_t num_histories = this->getNumberOfHistories();
+    const double sampling_time = this->getElapsedTime();
+
+    for( size_t i = 0; i < first_moments.size(); ++i )
+    {
+      this->processMoments( Utility::SampleMoment<1,double>(first_moments[i]),
+                            Utility::SampleMoment<2,double>(second_moments[i]),
+                            Utility::SampleMoment<3,double>(third_moments[i]),
+                            Utility::SampleMoment<4,double>(fourth_moments[i]),
+                            norm_constant,
+                            num_histories,
+                            sampling_time,
+                            mean[i],
+                            relative_error[i],
+                            variance_of_variance[i],
+                            figure_of_merit[i] );
+    }
+  }
+}
+
 // Print the estimator response function names
 void Estimator::printEstimatorResponseFunctionNames( std::ostream& os ) const
 {
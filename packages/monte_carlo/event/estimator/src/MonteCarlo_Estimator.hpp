@@ -187,6 +187,13 @@ public:
   void getTotalBinProcessedData(
             std::map<std::string,std::vector<double> >& processed_data ) const;
 
+  //! Get the total estimator bin mean, relative error, vov and fom
+  void getTotalBinProcessedData(
+                const Utility::ArrayView<double>& mean,
+                const Utility::ArrayView<double>& relative_error,
+                const Utility::ArrayView<double>& variance_of_variance,
+                const Utility::ArrayView<double>& figure_of_merit ) const;
+
   //! Get the bin data first moments for an entity
   virtual Utility::ArrayView<const double> getEntityBinDataFirstMoments( const EntityId entity_id ) const = 0;
 
@@ -211,6 +218,14 @@ public:
             const EntityId entity_id,
             std::map<std::string,std::vector<double> >& processed_data ) const;
 
+  //! Get the bin data mean, relative error, vov and fom for an entity
+  void getEntityBinProcessedData(
+                const EntityId entity_id,
+                const Utility::ArrayView<double>& mean,
+                const Utility::ArrayView<double>& relative_error,
+                const Utility::ArrayView<double>& variance_of_variance,
+                const Utility::ArrayView<double>& figure_of_merit ) const;
+
   //! Check if total data is available
   virtual bool isTotalDataAvailable() const;
 
@@ -236,6 +251,13 @@ public:
   void getTotalProcessedData(
             std::map<std::string,std::vector<double> >& processed_data ) const;
 
+  //! Get the total data mean, relative error, vov and fom
+  void getTotalProcessedData(
+                const Utility::ArrayView<double>& mean,
+                const Utility::ArrayView<double>& relative_error,
+                const Utility::ArrayView<double>& variance_of_variance,
+                const Utility::ArrayView<double>& figure_of_merit ) const;
+
   //! Get the total data first moments for an entity
   virtual Utility::ArrayView<const double> getEntityTotalDataFirstMoments( const EntityId entity_id ) const;
 
@@ -260,6 +282,14 @@ public:
             const EntityId entity_id,
             std::map<std::string,std::vector<double> >& processed_data ) const;
 
+  //! Get the total data mean, relative error, vov and fom for an entity
+  void getEntityTotalProcessedData(
+                const EntityId entity_id,
+                const Utility::ArrayView<double>& mean,
+                const Utility::ArrayView<double>& relative_error,
+                const Utility::ArrayView<double>& variance_of_variance,
+                const Utility::ArrayView<double>& figure_of_merit ) const;
+
   //! Get the entity bin moment snapshot history values
   virtual void getEntityBinMomentSnapshotHistoryValues(
                                  const EntityId entity_id,
@@ -514,6 +544,20 @@ protected:
   //! Unset the has uncommitted history contribution flag
   void unsetHasUncommittedHistoryContribution( const unsigned thread_id );
 
+  //! The flat moment reduction layout (moment array, number of values)
+  typedef std::vector<std::pair<double*,size_t> > MomentReductionLayout;
+
+  //! Add the moments of a collection to a flat moment reduction layout
+  template<size_t... Ns>
+  static void addCollectionToReductionLayout(
+                       Utility::SampleMomentCollection<double,Ns...>& collection,
+                       MomentReductionLayout& layout );
+
+  //! Reduce the moments in a flat moment reduction layout
+  void reduceMoments( const Utility::Communicator& comm,
+                      const int root_process,
+                      const MomentReductionLayout& layout ) const;
+
   //! Reduce a single collection
   void reduceCollection(
                       const Utility::Communicator& comm,
@@ -651,13 +695,19 @@ private:
                        double& variance_of_variance,
                        double& figure_of_merit ) const;
 
-  // Reduce a single collection and return the reduced moments
-  template<size_t N, typename Collection>
-  void reduceCollectionAndReturnReducedMoments(
-                                  const Utility::Communicator& comm,
-                                  const int root_process,
-                                  const Collection& collection,
-                                  std::vector<double>& reduced_moments ) const;
+  // Convert arrays of moments to arrays of mean, rel. er., vov, fom
+  void processMoments( const Utility::ArrayView<const double>& first_moments,
+                       const Utility::ArrayView<const double>& second_moments,
+                       const Utility::ArrayView<const double>& third_moments,
+                       const Utility::ArrayView<const double>& fourth_moments,
+                       const double norm_constant,
+                       const Utility::ArrayView<double>& mean,
+                       const Utility::ArrayView<double>& relative_error,
+                       const Utility::ArrayView<double>& variance_of_variance,
+                       const Utility::ArrayView<double>& figure_of_merit ) const;
+
+  // The max number of values that will be reduced at once
+  static const size_t s_max_reduction_chunk_size;
 
   // Save the data to an archive
   template<typename Archive>
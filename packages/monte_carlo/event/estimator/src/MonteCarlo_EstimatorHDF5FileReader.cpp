@@ -0,0 +1,383 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorHDF5FileReader.cpp
+//! \author Alex Robinson
+//! \brief  Estimator HDF5 file reader class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_EstimatorHDF5FileReader.hpp"
+#include "MonteCarlo_EstimatorHDF5FileWriter.hpp"
+#include "Utility_FromStringTraits.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+EstimatorHDF5FileReader::EstimatorHDF5FileReader(
+                                     const boost::filesystem::path& file_name )
+  : d_file_name( file_name ),
+    d_hdf5_file( new Utility::HDF5File( file_name.string(),
+                                        Utility::HDF5File::READ_ONLY ) ),
+    d_entity_ids_cache()
+{
+  TEST_FOR_EXCEPTION( !d_hdf5_file->doesGroupExist( EstimatorHDF5FileWriter::getEstimatorsGroupPath() ),
+                      std::runtime_error,
+                      "The file " << d_file_name << " is not an estimator "
+                      "file!" );
+}
+
+// Return the file name
+const boost::filesystem::path& EstimatorHDF5FileReader::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the estimator ids in the file
+void EstimatorHDF5FileReader::getEstimatorIds(
+                                 std::set<Estimator::Id>& estimator_ids ) const
+{
+  std::vector<std::string> estimator_group_names;
+
+  d_hdf5_file->getGroupObjectNames(
+                                EstimatorHDF5FileWriter::getEstimatorsGroupPath(),
+                                estimator_group_names );
+
+  estimator_ids.clear();
+
+  for( auto&& estimator_group_name : estimator_group_names )
+  {
+    estimator_ids.insert(
+               Utility::fromString<Estimator::Id>( estimator_group_name ) );
+  }
+}
+
+// Check if an estimator is in the file
+bool EstimatorHDF5FileReader::doesEstimatorExist(
+                                      const Estimator::Id estimator_id ) const
+{
+  return d_hdf5_file->doesGroupExist(
+                EstimatorHDF5FileWriter::getEstimatorGroupPath( estimator_id ) );
+}
+
+// Return the path to an estimator group
+std::string EstimatorHDF5FileReader::getEstimatorGroupPath(
+                                      const Estimator::Id estimator_id ) const
+{
+  TEST_FOR_EXCEPTION( !this->doesEstimatorExist( estimator_id ),
+                      std::runtime_error,
+                      "Estimator " << estimator_id << " is not in the "
+                      "estimator file " << d_file_name << "!" );
+
+  return EstimatorHDF5FileWriter::getEstimatorGroupPath( estimator_id );
+}
+
+// Read a group attribute value
+template<typename T>
+T EstimatorHDF5FileReader::readGroupAttribute(
+                                   const std::string& path_to_group,
+                                   const std::string& attribute_name ) const
+{
+  T value;
+
+  d_hdf5_file->readFromGroupAttribute( path_to_group,
+                                       attribute_name,
+                                       &value,
+                                       1 );
+
+  return value;
+}
+
+// Return the estimator constant multiplier
+double EstimatorHDF5FileReader::getMultiplier(
+                                      const Estimator::Id estimator_id ) const
+{
+  return this->readGroupAttribute<double>(
+                                  this->getEstimatorGroupPath( estimator_id ),
+                                  "multiplier" );
+}
+
+// Return the estimator entity type (cell, surface or mesh)
+std::string EstimatorHDF5FileReader::getEntityType(
+                                      const Estimator::Id estimator_id ) const
+{
+  return this->readGroupAttribute<std::string>(
+                                  this->getEstimatorGroupPath( estimator_id ),
+                                  "entity_type" );
+}
+
+// Return the number of response functions
+size_t EstimatorHDF5FileReader::getNumberOfResponseFunctions(
+                                      const Estimator::Id estimator_id ) const
+{
+  return this->readGroupAttribute<unsigned long>(
+                                  this->getEstimatorGroupPath( estimator_id ),
+                                  "number_of_response_functions" );
+}
+
+// Return the total number of bins (per response function)
+size_t EstimatorHDF5FileReader::getNumberOfBins(
+                                      const Estimator::Id estimator_id ) const
+{
+  return this->readGroupAttribute<unsigned long>(
+                                  this->getEstimatorGroupPath( estimator_id ),
+                                  "number_of_bins" );
+}
+
+// Return the dimensions that have been discretized
+void EstimatorHDF5FileReader::getDiscretizedDimensions(
+        const Estimator::Id estimator_id,
+        std::vector<ObserverPhaseSpaceDimension>& discretized_dimensions ) const
+{
+  const std::string estimator_path =
+    this->getEstimatorGroupPath( estimator_id );
+
+  discretized_dimensions.clear();
+
+  // Estimators without a discretization do not have this attribute
+  if( d_hdf5_file->doesGroupAttributeExist( estimator_path,
+                                            "discretized_dimensions" ) )
+  {
+    std::vector<unsigned> dimension_values;
+
+    Utility::readFromGroupAttribute( *d_hdf5_file,
+                                     estimator_path,
+                                     "discretized_dimensions",
+                                     dimension_values );
+
+    for( auto&& dimension_value : dimension_values )
+    {
+      discretized_dimensions.push_back(
+                              (ObserverPhaseSpaceDimension)dimension_value );
+    }
+  }
+}
+
+// Return the number of bins in each discretized dimension
+void EstimatorHDF5FileReader::getDimensionNumberOfBins(
+                                   const Estimator::Id estimator_id,
+                                   std::vector<size_t>& dimension_bins ) const
+{
+  const std::string estimator_path =
+    this->getEstimatorGroupPath( estimator_id );
+
+  dimension_bins.clear();
+
+  // Estimators without a discretization do not have this attribute
+  if( d_hdf5_file->doesGroupAttributeExist( estimator_path,
+                                            "dimension_bins" ) )
+  {
+    std::vector<unsigned long> raw_dimension_bins;
+
+    Utility::readFromGroupAttribute( *d_hdf5_file,
+                                     estimator_path,
+                                     "dimension_bins",
+                                     raw_dimension_bins );
+
+    dimension_bins.assign( raw_dimension_bins.begin(),
+                           raw_dimension_bins.end() );
+  }
+}
+
+// Return the total normalization constant
+double EstimatorHDF5FileReader::getTotalNormConstant(
+                                      const Estimator::Id estimator_id ) const
+{
+  return this->readGroupAttribute<double>(
+                                  this->getEstimatorGroupPath( estimator_id ),
+                                  "total_norm_constant" );
+}
+
+// Return the sorted entity ids of an estimator
+const std::vector<Estimator::EntityId>&
+EstimatorHDF5FileReader::getCachedEntityIds(
+                                      const Estimator::Id estimator_id ) const
+{
+  std::map<Estimator::Id,std::vector<Estimator::EntityId> >::iterator
+    cached_entity_ids = d_entity_ids_cache.find( estimator_id );
+
+  if( cached_entity_ids == d_entity_ids_cache.end() )
+  {
+    const std::string entity_ids_path =
+      this->getEstimatorGroupPath( estimator_id ) + "entity_ids";
+
+    std::vector<Estimator::EntityId> entity_ids;
+
+    // Empty data sets cannot be read
+    if( d_hdf5_file->getDataSetSize( entity_ids_path ) > 0 )
+      Utility::readFromDataSet( *d_hdf5_file, entity_ids_path, entity_ids );
+
+    cached_entity_ids =
+      d_entity_ids_cache.emplace( estimator_id, entity_ids ).first;
+  }
+
+  return cached_entity_ids->second;
+}
+
+// Return the entity ids (sorted)
+void EstimatorHDF5FileReader::getEntityIds(
+                         const Estimator::Id estimator_id,
+                         std::vector<Estimator::EntityId>& entity_ids ) const
+{
+  entity_ids = this->getCachedEntityIds( estimator_id );
+}
+
+// Return the index of an entity
+size_t EstimatorHDF5FileReader::getEntityIndex(
+                                   const Estimator::Id estimator_id,
+                                   const Estimator::EntityId entity_id ) const
+{
+  const std::vector<Estimator::EntityId>& entity_ids =
+    this->getCachedEntityIds( estimator_id );
+
+  std::vector<Estimator::EntityId>::const_iterator entity_it =
+    std::lower_bound( entity_ids.begin(), entity_ids.end(), entity_id );
+
+  TEST_FOR_EXCEPTION( entity_it == entity_ids.end() ||
+                      *entity_it != entity_id,
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << estimator_id << " in the estimator "
+                      "file " << d_file_name << "!" );
+
+  return std::distance( entity_ids.begin(), entity_it );
+}
+
+// Return the normalization constant for an entity
+double EstimatorHDF5FileReader::getEntityNormConstant(
+                                    const Estimator::Id estimator_id,
+                                    const Estimator::EntityId entity_id ) const
+{
+  double norm_constant;
+
+  d_hdf5_file->readBlockFromDataSet(
+                          this->getEstimatorGroupPath( estimator_id ) +
+                          "entity_norm_constants",
+                          &norm_constant,
+                          this->getEntityIndex( estimator_id, entity_id ),
+                          1 );
+
+  return norm_constant;
+}
+
+// Check if total data is available
+bool EstimatorHDF5FileReader::isTotalDataAvailable(
+                                      const Estimator::Id estimator_id ) const
+{
+  return d_hdf5_file->doesGroupExist(
+                      this->getEstimatorGroupPath( estimator_id ) + "total/" );
+}
+
+// Return the total bin data moments of the requested order
+void EstimatorHDF5FileReader::getTotalBinDataMoments(
+                                          const Estimator::Id estimator_id,
+                                          const size_t moment,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure the moment is valid
+  testPrecondition( moment >= 1 );
+  testPrecondition( moment <= 4 );
+
+  Utility::readFromDataSet( *d_hdf5_file,
+                            this->getEstimatorGroupPath( estimator_id ) +
+                            "total_bin/" +
+                            EstimatorHDF5FileWriter::getMomentDataSetName( moment ),
+                            moments );
+}
+
+// Return the bin data moments of the requested order for an entity
+/*! \details Only the moments of the requested entity will be read from the
+ * file.
+ */
+void EstimatorHDF5FileReader::getEntityBinDataMoments(
+                                          const Estimator::Id estimator_id,
+                                          const Estimator::EntityId entity_id,
+                                          const size_t moment,
+                                          std::vector<double>& moments ) const
+{
+  this->readEntityMoments( estimator_id,
+                           entity_id,
+                           "entity_bin/",
+                           moment,
+                           this->getNumberOfBins( estimator_id )*
+                           this->getNumberOfResponseFunctions( estimator_id ),
+                           moments );
+}
+
+// Return the total data moments of the requested order
+void EstimatorHDF5FileReader::getTotalDataMoments(
+                                          const Estimator::Id estimator_id,
+                                          const size_t moment,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure the moment is valid
+  testPrecondition( moment >= 1 );
+  testPrecondition( moment <= 4 );
+
+  TEST_FOR_EXCEPTION( !this->isTotalDataAvailable( estimator_id ),
+                      std::runtime_error,
+                      "Estimator " << estimator_id << " does not have total "
+                      "data!" );
+
+  Utility::readFromDataSet( *d_hdf5_file,
+                            this->getEstimatorGroupPath( estimator_id ) +
+                            "total/" +
+                            EstimatorHDF5FileWriter::getMomentDataSetName( moment ),
+                            moments );
+}
+
+// Return the total data moments of the requested order for an entity
+void EstimatorHDF5FileReader::getEntityTotalDataMoments(
+                                          const Estimator::Id estimator_id,
+                                          const Estimator::EntityId entity_id,
+                                          const size_t moment,
+                                          std::vector<double>& moments ) const
+{
+  TEST_FOR_EXCEPTION( !this->isTotalDataAvailable( estimator_id ),
+                      std::runtime_error,
+                      "Estimator " << estimator_id << " does not have total "
+                      "data!" );
+
+  this->readEntityMoments( estimator_id,
+                           entity_id,
+                           "entity_total/",
+                           moment,
+                           this->getNumberOfResponseFunctions( estimator_id ),
+                           moments );
+}
+
+// Read the moments of an entity
+void EstimatorHDF5FileReader::readEntityMoments(
+                                   const Estimator::Id estimator_id,
+                                   const Estimator::EntityId entity_id,
+                                   const std::string& moments_group_name,
+                                   const size_t moment,
+                                   const size_t moments_per_entity,
+                                   std::vector<double>& moments ) const
+{
+  // Make sure the moment is valid
+  testPrecondition( moment >= 1 );
+  testPrecondition( moment <= 4 );
+
+  moments.resize( moments_per_entity );
+
+  d_hdf5_file->readBlockFromDataSet(
+                   this->getEstimatorGroupPath( estimator_id ) +
+                   moments_group_name +
+                   EstimatorHDF5FileWriter::getMomentDataSetName( moment ),
+                   moments.data(),
+                   this->getEntityIndex( estimator_id, entity_id )*
+                   moments_per_entity,
+                   moments_per_entity );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorHDF5FileReader.cpp
+//---------------------------------------------------------------------------//
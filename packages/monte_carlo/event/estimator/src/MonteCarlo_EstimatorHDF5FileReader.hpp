@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorHDF5FileReader.hpp
+//! \author Alex Robinson
+//! \brief  Estimator HDF5 file reader class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ESTIMATOR_HDF5_FILE_READER_HPP
+#define MONTE_CARLO_ESTIMATOR_HDF5_FILE_READER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <vector>
+#include <set>
+#include <map>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_HDF5File.hpp"
+
+namespace MonteCarlo{
+
+/*! The estimator HDF5 file reader class
+ * \details Nothing is loaded when the reader is constructed. The data of
+ * an estimator (or of a single entity of an estimator) is read on demand,
+ * which allows post-processing tools to access estimator files that are too
+ * large to fit in memory (see MonteCarlo::EstimatorHDF5FileWriter for the
+ * layout).
+ */
+class EstimatorHDF5FileReader : private boost::noncopyable
+{
+
+public:
+
+  //! Constructor
+  EstimatorHDF5FileReader( const boost::filesystem::path& file_name );
+
+  //! Destructor
+  ~EstimatorHDF5FileReader()
+  { /* ... */ }
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the estimator ids in the file
+  void getEstimatorIds( std::set<Estimator::Id>& estimator_ids ) const;
+
+  //! Check if an estimator is in the file
+  bool doesEstimatorExist( const Estimator::Id estimator_id ) const;
+
+  //! Return the estimator constant multiplier
+  double getMultiplier( const Estimator::Id estimator_id ) const;
+
+  //! Return the estimator entity type (cell, surface or mesh)
+  std::string getEntityType( const Estimator::Id estimator_id ) const;
+
+  //! Return the number of response functions
+  size_t getNumberOfResponseFunctions( const Estimator::Id estimator_id ) const;
+
+  //! Return the total number of bins (per response function)
+  size_t getNumberOfBins( const Estimator::Id estimator_id ) const;
+
+  //! Return the dimensions that have been discretized
+  void getDiscretizedDimensions(
+       const Estimator::Id estimator_id,
+       std::vector<ObserverPhaseSpaceDimension>& discretized_dimensions ) const;
+
+  //! Return the number of bins in each discretized dimension
+  void getDimensionNumberOfBins( const Estimator::Id estimator_id,
+                                 std::vector<size_t>& dimension_bins ) const;
+
+  //! Return the total normalization constant
+  double getTotalNormConstant( const Estimator::Id estimator_id ) const;
+
+  //! Return the entity ids (sorted)
+  void getEntityIds( const Estimator::Id estimator_id,
+                     std::vector<Estimator::EntityId>& entity_ids ) const;
+
+  //! Return the normalization constant for an entity
+  double getEntityNormConstant( const Estimator::Id estimator_id,
+                                const Estimator::EntityId entity_id ) const;
+
+  //! Check if total data is available
+  bool isTotalDataAvailable( const Estimator::Id estimator_id ) const;
+
+  //! Return the total bin data moments of the requested order
+  void getTotalBinDataMoments( const Estimator::Id estimator_id,
+                               const size_t moment,
+                               std::vector<double>& moments ) const;
+
+  //! Return the bin data moments of the requested order for an entity
+  void getEntityBinDataMoments( const Estimator::Id estimator_id,
+                                const Estimator::EntityId entity_id,
+                                const size_t moment,
+                                std::vector<double>& moments ) const;
+
+  //! Return the total data moments of the requested order
+  void getTotalDataMoments( const Estimator::Id estimator_id,
+                            const size_t moment,
+                            std::vector<double>& moments ) const;
+
+  //! Return the total data moments of the requested order for an entity
+  void getEntityTotalDataMoments( const Estimator::Id estimator_id,
+                                  const Estimator::EntityId entity_id,
+                                  const size_t moment,
+                                  std::vector<double>& moments ) const;
+
+private:
+
+  // Return the path to an estimator group
+  std::string getEstimatorGroupPath( const Estimator::Id estimator_id ) const;
+
+  // Return the sorted entity ids of an estimator
+  const std::vector<Estimator::EntityId>& getCachedEntityIds(
+                                      const Estimator::Id estimator_id ) const;
+
+  // Return the index of an entity
+  size_t getEntityIndex( const Estimator::Id estimator_id,
+                         const Estimator::EntityId entity_id ) const;
+
+  // Read a group attribute value
+  template<typename T>
+  T readGroupAttribute( const std::string& path_to_group,
+                        const std::string& attribute_name ) const;
+
+  // Read the moments of an entity
+  void readEntityMoments( const Estimator::Id estimator_id,
+                          const Estimator::EntityId entity_id,
+                          const std::string& moments_group_name,
+                          const size_t moment,
+                          const size_t moments_per_entity,
+                          std::vector<double>& moments ) const;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The hdf5 file
+  std::unique_ptr<const Utility::HDF5File> d_hdf5_file;
+
+  // The cached entity ids of each estimator that has been accessed
+  mutable std::map<Estimator::Id,std::vector<Estimator::EntityId> >
+  d_entity_ids_cache;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ESTIMATOR_HDF5_FILE_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorHDF5FileReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,391 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorHDF5FileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Estimator HDF5 file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_EstimatorHDF5FileWriter.hpp"
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+const size_t EstimatorHDF5FileWriter::s_default_chunk_size = 65536;
+
+// Constructor
+/*! \details If the file is not overwritten the estimators will be added to
+ * the existing file.
+ */
+EstimatorHDF5FileWriter::EstimatorHDF5FileWriter(
+                           const boost::filesystem::path& file_name,
+                           const bool overwrite,
+                           const size_t chunk_size,
+                           const Utility::HDF5File::CompressionFilter filter,
+                           const bool shuffle )
+  : d_file_name( file_name ),
+    d_chunk_size( chunk_size ),
+    d_filter( filter ),
+    d_shuffle( shuffle ),
+    d_hdf5_file()
+{
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  TEST_FOR_EXCEPTION( !Utility::HDF5File::isCompressionFilterAvailable( filter ),
+                      std::runtime_error,
+                      "The requested compression filter is not available "
+                      "in this build of HDF5!" );
+
+  d_hdf5_file.reset( new Utility::HDF5File( d_file_name.string(),
+                                            overwrite ?
+                                            Utility::HDF5File::OVERWRITE :
+                                            Utility::HDF5File::READ_WRITE ) );
+
+  if( !d_hdf5_file->doesGroupExist( this->getEstimatorsGroupPath() ) )
+    d_hdf5_file->createGroup( this->getEstimatorsGroupPath() );
+}
+
+// Return the file name
+const boost::filesystem::path& EstimatorHDF5FileWriter::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the chunk size (number of moments per chunk)
+size_t EstimatorHDF5FileWriter::getChunkSize() const
+{
+  return d_chunk_size;
+}
+
+// Return the compression filter
+Utility::HDF5File::CompressionFilter
+EstimatorHDF5FileWriter::getCompressionFilter() const
+{
+  return d_filter;
+}
+
+// Check if the shuffle filter is used
+bool EstimatorHDF5FileWriter::isShuffleFilterUsed() const
+{
+  return d_shuffle;
+}
+
+// Return the path to the estimators group
+std::string EstimatorHDF5FileWriter::getEstimatorsGroupPath()
+{
+  return "/estimators/";
+}
+
+// Return the path to an estimator group
+std::string EstimatorHDF5FileWriter::getEstimatorGroupPath(
+                                           const Estimator::Id estimator_id )
+{
+  return EstimatorHDF5FileWriter::getEstimatorsGroupPath() +
+    Utility::toString( estimator_id ) + "/";
+}
+
+// Return the name of a moment data set
+std::string EstimatorHDF5FileWriter::getMomentDataSetName( const size_t moment )
+{
+  // Make sure the moment is valid
+  testPrecondition( moment >= 1 );
+  testPrecondition( moment <= 4 );
+
+  return std::string( "moment_" ) + Utility::toString( moment );
+}
+
+// Write an estimator
+/*! \details The estimator data should be reduced before it is written (see
+ * MonteCarlo::Estimator::reduceData). An estimator can only be written to a
+ * file once.
+ */
+void EstimatorHDF5FileWriter::writeEstimator( const Estimator& estimator )
+{
+  const std::string estimator_path =
+    this->getEstimatorGroupPath( estimator.getId() );
+
+  TEST_FOR_EXCEPTION( d_hdf5_file->doesGroupExist( estimator_path ),
+                      std::runtime_error,
+                      "Estimator " << estimator.getId() << " has already "
+                      "been written to the estimator file " << d_file_name <<
+                      "!" );
+
+  d_hdf5_file->createGroup( estimator_path );
+
+  this->writeEstimatorBinLayout( estimator, estimator_path );
+
+  // Write the entity data
+  std::vector<Estimator::EntityId> entity_ids;
+
+  {
+    std::set<Estimator::EntityId> entity_id_set;
+
+    estimator.getEntityIds( entity_id_set );
+
+    entity_ids.assign( entity_id_set.begin(), entity_id_set.end() );
+  }
+
+  std::vector<double> entity_norm_constants( entity_ids.size() );
+
+  for( size_t i = 0; i < entity_ids.size(); ++i )
+  {
+    entity_norm_constants[i] =
+      estimator.getEntityNormConstant( entity_ids[i] );
+  }
+
+  d_hdf5_file->writeToDataSet( estimator_path + "entity_ids",
+                               entity_ids.data(),
+                               entity_ids.size() );
+
+  d_hdf5_file->writeToDataSet( estimator_path + "entity_norm_constants",
+                               entity_norm_constants.data(),
+                               entity_norm_constants.size() );
+
+  // Write the bin moments
+  {
+    const TotalMomentsGetter total_bin_getters[4] =
+      {&Estimator::getTotalBinDataFirstMoments,
+       &Estimator::getTotalBinDataSecondMoments,
+       &Estimator::getTotalBinDataThirdMoments,
+       &Estimator::getTotalBinDataFourthMoments};
+
+    this->writeTotalMoments( estimator,
+                             estimator_path + "total_bin/",
+                             total_bin_getters );
+
+    const EntityMomentsGetter entity_bin_getters[4] =
+      {&Estimator::getEntityBinDataFirstMoments,
+       &Estimator::getEntityBinDataSecondMoments,
+       &Estimator::getEntityBinDataThirdMoments,
+       &Estimator::getEntityBinDataFourthMoments};
+
+    this->writeEntityMoments( estimator,
+                              entity_ids,
+                              estimator_path + "entity_bin/",
+                              entity_bin_getters );
+  }
+
+  // Write the total moments
+  if( estimator.isTotalDataAvailable() )
+  {
+    const TotalMomentsGetter total_getters[4] =
+      {&Estimator::getTotalDataFirstMoments,
+       &Estimator::getTotalDataSecondMoments,
+       &Estimator::getTotalDataThirdMoments,
+       &Estimator::getTotalDataFourthMoments};
+
+    this->writeTotalMoments( estimator,
+                             estimator_path + "total/",
+                             total_getters );
+
+    const EntityMomentsGetter entity_total_getters[4] =
+      {&Estimator::getEntityTotalDataFirstMoments,
+       &Estimator::getEntityTotalDataSecondMoments,
+       &Estimator::getEntityTotalDataThirdMoments,
+       &Estimator::getEntityTotalDataFourthMoments};
+
+    this->writeEntityMoments( estimator,
+                              entity_ids,
+                              estimator_path + "entity_total/",
+                              entity_total_getters );
+  }
+}
+
+// Write the estimator bin layout
+void EstimatorHDF5FileWriter::writeEstimatorBinLayout(
+                                          const Estimator& estimator,
+                                          const std::string& estimator_path )
+{
+  d_hdf5_file->writeToGroupAttribute( estimator_path,
+                                      "multiplier",
+                                      estimator.getMultiplier() );
+
+  std::string entity_type;
+
+  if( estimator.isCellEstimator() )
+    entity_type = "cell";
+  else if( estimator.isSurfaceEstimator() )
+    entity_type = "surface";
+  else
+    entity_type = "mesh";
+
+  d_hdf5_file->writeToGroupAttribute( estimator_path,
+                                      "entity_type",
+                                      entity_type );
+
+  d_hdf5_file->writeToGroupAttribute(
+                         estimator_path,
+                         "number_of_response_functions",
+                         (unsigned long)estimator.getNumberOfResponseFunctions() );
+
+  d_hdf5_file->writeToGroupAttribute(
+                                    estimator_path,
+                                    "number_of_bins",
+                                    (unsigned long)estimator.getNumberOfBins() );
+
+  d_hdf5_file->writeToGroupAttribute( estimator_path,
+                                      "total_norm_constant",
+                                      estimator.getTotalNormConstant() );
+
+  std::vector<ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  estimator.getDiscretizedDimensions( discretized_dimensions );
+
+  // HDF5 does not allow empty attributes
+  if( !discretized_dimensions.empty() )
+  {
+    std::vector<unsigned> dimension_values( discretized_dimensions.size() );
+    std::vector<unsigned long> dimension_bins( discretized_dimensions.size() );
+
+    for( size_t i = 0; i < discretized_dimensions.size(); ++i )
+    {
+      dimension_values[i] = (unsigned)discretized_dimensions[i];
+      dimension_bins[i] =
+        estimator.getNumberOfBins( discretized_dimensions[i] );
+    }
+
+    d_hdf5_file->writeToGroupAttribute( estimator_path,
+                                        "discretized_dimensions",
+                                        dimension_values.data(),
+                                        dimension_values.size() );
+
+    d_hdf5_file->writeToGroupAttribute( estimator_path,
+                                        "dimension_bins",
+                                        dimension_bins.data(),
+                                        dimension_bins.size() );
+  }
+}
+
+// Write the total moments
+void EstimatorHDF5FileWriter::writeTotalMoments(
+                                       const Estimator& estimator,
+                                       const std::string& moments_path,
+                                       const TotalMomentsGetter getters[4] )
+{
+  for( size_t i = 0; i < 4; ++i )
+  {
+    Utility::ArrayView<const double> moments = (estimator.*getters[i])();
+
+    this->writeMoments( moments_path + this->getMomentDataSetName( i+1 ),
+                        moments.data(),
+                        moments.size() );
+  }
+}
+
+// Write the entity moments
+/*! \details The moments of every entity are combined into a single data set
+ * to avoid creating a flood of small data sets for estimators with many
+ * entities (e.g. mesh estimators).
+ */
+void EstimatorHDF5FileWriter::writeEntityMoments(
+                           const Estimator& estimator,
+                           const std::vector<Estimator::EntityId>& entity_ids,
+                           const std::string& moments_path,
+                           const EntityMomentsGetter getters[4] )
+{
+  std::vector<double> combined_moments;
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    combined_moments.clear();
+
+    for( auto&& entity_id : entity_ids )
+    {
+      Utility::ArrayView<const double> moments =
+        (estimator.*getters[i])( entity_id );
+
+      combined_moments.insert( combined_moments.end(),
+                               moments.begin(),
+                               moments.end() );
+    }
+
+    this->writeMoments( moments_path + this->getMomentDataSetName( i+1 ),
+                        combined_moments.data(),
+                        combined_moments.size() );
+  }
+}
+
+// Write a moment array
+void EstimatorHDF5FileWriter::writeMoments( const std::string& path_to_data_set,
+                                            const double* moments,
+                                            const size_t size )
+{
+  d_hdf5_file->writeToChunkedDataSet( path_to_data_set,
+                                      moments,
+                                      size,
+                                      d_chunk_size,
+                                      d_filter,
+                                      d_shuffle );
+}
+
+// Write the estimators owned by every process to a single file
+/*! \details The FRENSIE HDF5 interface does not support parallel (MPI-IO)
+ * file access. Instead, the processes take turns writing their estimators
+ * to the file, starting with the root process (which creates the file).
+ * Each estimator must only be owned by a single process. This method must
+ * be called by every process in the communicator. If any process fails to
+ * write its estimators every process will throw an exception.
+ */
+void EstimatorHDF5FileWriter::writeEstimators(
+           const Utility::Communicator& comm,
+           const boost::filesystem::path& file_name,
+           const std::vector<std::shared_ptr<const Estimator> >& estimators,
+           const size_t chunk_size,
+           const Utility::HDF5File::CompressionFilter filter,
+           const bool shuffle )
+{
+  // Make sure the communicator is valid
+  testPrecondition( comm.isValid() );
+
+  // The write token (false if a previous process failed)
+  bool write_token = true;
+
+  if( comm.rank() > 0 )
+    Utility::receive( comm, comm.rank()-1, 0, write_token );
+
+  std::string error_message;
+
+  if( write_token )
+  {
+    try{
+      EstimatorHDF5FileWriter writer( file_name,
+                                      comm.rank() == 0,
+                                      chunk_size,
+                                      filter,
+                                      shuffle );
+
+      for( auto&& estimator : estimators )
+        writer.writeEstimator( *estimator );
+    }
+    catch( const std::exception& exception )
+    {
+      write_token = false;
+      error_message = exception.what();
+    }
+  }
+
+  if( comm.rank() < comm.size()-1 )
+    Utility::send( comm, comm.rank()+1, 0, write_token );
+
+  // The last process knows if every process succeeded
+  Utility::broadcast( comm, write_token, comm.size()-1 );
+
+  TEST_FOR_EXCEPTION( !write_token,
+                      std::runtime_error,
+                      "The estimators could not be written to the estimator "
+                      "file " << file_name << "! "
+                      << (error_message.empty() ?
+                          std::string( "Another process failed." ) :
+                          error_message) );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorHDF5FileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorHDF5FileWriter.hpp
+//! \author Alex Robinson
+//! \brief  Estimator HDF5 file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ESTIMATOR_HDF5_FILE_WRITER_HPP
+#define MONTE_CARLO_ESTIMATOR_HDF5_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <vector>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_HDF5File.hpp"
+#include "Utility_Communicator.hpp"
+
+namespace MonteCarlo{
+
+/*! The estimator HDF5 file writer class
+ * \details Unlike the HDF5 archives, which store every primitive of an
+ * estimator in its own data set, this writer stores each estimator moment
+ * array in a single chunked data set that can be compressed with the gzip or
+ * szip filters (optionally preceded by the shuffle filter). The file layout
+ * is:
+ * <ul>
+ *  <li>/estimators/<id>: group attributes multiplier, entity_type,
+ *      number_of_response_functions, number_of_bins (per response function),
+ *      total_norm_constant and, if the estimator has been discretized,
+ *      discretized_dimensions (the ObserverPhaseSpaceDimension values in
+ *      the order that the dimensions were discretized) and dimension_bins
+ *      (the number of bins in each discretized dimension)</li>
+ *  <li>/estimators/<id>/entity_ids: the entity ids (sorted)</li>
+ *  <li>/estimators/<id>/entity_norm_constants: the entity norm constants</li>
+ *  <li>/estimators/<id>/total_bin/moment_[1-4]: the total bin moments</li>
+ *  <li>/estimators/<id>/entity_bin/moment_[1-4]: the entity bin moments of
+ *      every entity (entity-major, following the entity id order)</li>
+ *  <li>/estimators/<id>/total/moment_[1-4]: the total moments (only if
+ *      total data is available)</li>
+ *  <li>/estimators/<id>/entity_total/moment_[1-4]: the entity total moments
+ *      of every entity (only if total data is available)</li>
+ * </ul>
+ * The bin moments use the estimator bin layout (the first discretized
+ * dimension varies fastest and the response function slowest). Use the
+ * MonteCarlo::EstimatorHDF5FileReader to load the data of single estimators
+ * or entities without loading the entire file.
+ */
+class EstimatorHDF5FileWriter : private boost::noncopyable
+{
+
+public:
+
+  //! The default chunk size (number of moments per chunk)
+  static const size_t s_default_chunk_size;
+
+  //! Constructor
+  EstimatorHDF5FileWriter( const boost::filesystem::path& file_name,
+                           const bool overwrite = true,
+                           const size_t chunk_size = s_default_chunk_size,
+                           const Utility::HDF5File::CompressionFilter filter =
+                           Utility::HDF5File::NO_COMPRESSION,
+                           const bool shuffle = false );
+
+  //! Destructor
+  ~EstimatorHDF5FileWriter()
+  { /* ... */ }
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the chunk size (number of moments per chunk)
+  size_t getChunkSize() const;
+
+  //! Return the compression filter
+  Utility::HDF5File::CompressionFilter getCompressionFilter() const;
+
+  //! Check if the shuffle filter is used
+  bool isShuffleFilterUsed() const;
+
+  //! Write an estimator
+  void writeEstimator( const Estimator& estimator );
+
+  //! Write the estimators owned by every process to a single file
+  static void writeEstimators(
+           const Utility::Communicator& comm,
+           const boost::filesystem::path& file_name,
+           const std::vector<std::shared_ptr<const Estimator> >& estimators,
+           const size_t chunk_size = s_default_chunk_size,
+           const Utility::HDF5File::CompressionFilter filter =
+           Utility::HDF5File::NO_COMPRESSION,
+           const bool shuffle = false );
+
+  //! Return the path to the estimators group
+  static std::string getEstimatorsGroupPath();
+
+  //! Return the path to an estimator group
+  static std::string getEstimatorGroupPath( const Estimator::Id estimator_id );
+
+  //! Return the name of a moment data set
+  static std::string getMomentDataSetName( const size_t moment );
+
+private:
+
+  // The entity moments getter type
+  typedef Utility::ArrayView<const double> (Estimator::*EntityMomentsGetter)( const Estimator::EntityId ) const;
+
+  // The total moments getter type
+  typedef Utility::ArrayView<const double> (Estimator::*TotalMomentsGetter)() const;
+
+  // Write the estimator bin layout
+  void writeEstimatorBinLayout( const Estimator& estimator,
+                                const std::string& estimator_path );
+
+  // Write the total moments
+  void writeTotalMoments( const Estimator& estimator,
+                          const std::string& moments_path,
+                          const TotalMomentsGetter getters[4] );
+
+  // Write the entity moments
+  void writeEntityMoments( const Estimator& estimator,
+                           const std::vector<Estimator::EntityId>& entity_ids,
+                           const std::string& moments_path,
+                           const EntityMomentsGetter getters[4] );
+
+  // Write a moment array
+  void writeMoments( const std::string& path_to_data_set,
+                     const double* moments,
+                     const size_t size );
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The chunk size
+  size_t d_chunk_size;
+
+  // The compression filter
+  Utility::HDF5File::CompressionFilter d_filter;
+
+  // Use the shuffle filter
+  bool d_shuffle;
+
+  // The hdf5 file
+  std::unique_ptr<Utility::HDF5File> d_hdf5_file;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ESTIMATOR_HDF5_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorHDF5FileWriter.hpp
+//---------------------------------------------------------------------------//
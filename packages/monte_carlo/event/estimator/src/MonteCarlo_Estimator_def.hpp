@@ -89,30 +89,18 @@ void Estimator::calculateBinIndicesOfPoint(
     bin_indices[i] += response_function_index*this->getNumberOfBins();
 }
 
-// Reduce a single collection and return the reduced moments
-template<size_t N, typename Collection>
-void Estimator::reduceCollectionAndReturnReducedMoments(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             const Collection& collection,
-                             std::vector<double>& reduced_moments ) const
+// Add the moments of a collection to a flat moment reduction layout
+/*! \details The moments of each order are stored contiguously in the
+ * collection so each order only adds a single segment to the layout.
+ */
+template<size_t... Ns>
+void Estimator::addCollectionToReductionLayout(
+                       Utility::SampleMomentCollection<double,Ns...>& collection,
+                       MomentReductionLayout& layout )
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Resize the reduced moments array
-  reduced_moments.resize( collection.size() );
-
-  try{
-    Utility::reduce( comm,
-                     Utility::ArrayView<const double>( Utility::getCurrentScores<N>( collection ), collection.size() ),
-                     Utility::arrayView( reduced_moments ),
-                     std::plus<double>(),
-                     root_process );
-  }
-  EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                           "Unable to perform mpi reduction over moments of "
-                           "order " << N << " for estimator " << d_id << "!" );
+  int expander[] = { (layout.push_back( std::make_pair( Utility::getCurrentScores<Ns>( collection ), collection.size() ) ), 0)... };
+
+  (void)expander;
 }
 
 // Save the data to an archive
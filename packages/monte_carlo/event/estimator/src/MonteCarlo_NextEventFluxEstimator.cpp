@@ -0,0 +1,24 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_NextEventFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  The next-event flux estimator instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_NextEventFluxEstimator.hpp"
+
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_NextEventFluxEstimator.cpp
+//---------------------------------------------------------------------------//
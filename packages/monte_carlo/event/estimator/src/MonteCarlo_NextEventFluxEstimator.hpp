@@ -0,0 +1,354 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_NextEventFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  The next-event flux estimator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Boost Includes
+#include <boost/mpl/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardEntityEstimator.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventObserver.hpp"
+#include "MonteCarlo_ParticleSourceEmissionGlobalEventObserver.hpp"
+#include "MonteCarlo_ParticleSecondaryEmissionGlobalEventObserver.hpp"
+#include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_Navigator.hpp"
+#include "Geometry_Model.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The next-event flux estimator base class
+ * \details Next-event (point detector) estimators score the expected
+ * uncollided flux at a detector point from every source emission,
+ * collision and secondary emission event:
+ * \f$\phi = w p(\Omega \rightarrow \Omega_d) e^{-\tau}/R^2\f$, where
+ * \f$p\f$ is the emission pdf per steradian in the direction of the detector,
+ * \f$\tau\f$ is the optical depth between the event and the detector and
+ * \f$R\f$ is the distance to the detector. The optical depth is calculated
+ * by ray tracing through the geometry with a clone of the particle's
+ * navigator. The cells and path lengths of the last ray traced by each
+ * thread are cached so that repeated events from the same location (e.g.
+ * a point source) do not need to be ray traced again. Inside of the
+ * exclusion radius the distance used in the \f$1/R^2\f$ term is fixed at the
+ * exclusion radius, which bounds the variance of the estimator. Contributions
+ * smaller than the Russian roulette threshold are rouletted before the ray
+ * trace is done. The random numbers used for Russian roulette and for
+ * sampling points on the detectors are generated by hashing the estimator
+ * id, the history number and the number of random numbers already used in
+ * the history, which means that the transport random number stream is
+ * never advanced (adding a detector does not change the histories that are
+ * simulated) and that the contributions of a history are reproducible. The
+ * emission pdf evaluators and the total macroscopic cross
+ * section evaluator must be set by the client (the event handler will set the
+ * cross section evaluator and the photon collision emission pdf evaluator if
+ * it has access to a filled geometry model). The collision emission pdf must
+ * include the probability that the collision emits a particle (e.g. the
+ * scattering probability \f$\sigma_r/\sigma_t\f$ of each reaction). There is no default
+ * collision emission pdf - collision events cannot be scored until it has
+ * been set. The collision emission pdf only accounts for the colliding
+ * particle - the secondary particles that a collision banks are scored
+ * from their birth points with the secondary emission pdf. By default all
+ * cells are treated as void and source and secondary emission are
+ * isotropic.
+ * \ingroup particle_colliding_global_event
+ * \ingroup particle_source_emission_global_event
+ * \ingroup particle_secondary_emission_global_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class NextEventFluxEstimator : public StandardEntityEstimator,
+                               public ParticleCollidingGlobalEventObserver,
+                               public ParticleSourceEmissionGlobalEventObserver,
+                               public ParticleSecondaryEmissionGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleCollidingGlobalEventObserver::EventTag,ParticleSourceEmissionGlobalEventObserver::EventTag,ParticleSecondaryEmissionGlobalEventObserver::EventTag>
+  EventTags;
+
+  //! Typedef for the emission pdf array (pdf, energy)
+  typedef std::vector<std::pair<double,double> > EmissionPDFArray;
+
+  /*! Typedef for the emission pdf evaluator
+   *
+   * The first argument is the state of the particle before the event and the
+   * second argument is the direction from the event location to the detector.
+   * The evaluator must append the pdf per steradian and the energy of the
+   * particle heading to the detector for each way that the event can emit a
+   * particle (e.g. each reaction) to the pdf array (the third argument).
+   * The expected value must be calculated without using random numbers.
+   */
+  typedef std::function<void(const ParticleState&,const double[3],EmissionPDFArray&)> EmissionPDFEvaluator;
+
+  /*! Typedef for the macroscopic total cross section evaluator
+   *
+   * The evaluator must return infinity for cells that terminate particles.
+   */
+  typedef std::function<double(const ParticleType,const Geometry::Model::EntityId,const double)> TotalCrossSectionEvaluator;
+
+  //! Constructor
+  NextEventFluxEstimator( const Id id,
+                          const double multiplier,
+                          const size_t number_of_detectors );
+
+  //! Destructor
+  virtual ~NextEventFluxEstimator()
+  { /* ... */ }
+
+  //! Check if the estimator is a cell estimator
+  bool isCellEstimator() const final override;
+
+  //! Check if the estimator is a surface estimator
+  bool isSurfaceEstimator() const final override;
+
+  //! Check if the estimator is a mesh estimator
+  bool isMeshEstimator() const final override;
+
+  //! Return the number of detectors
+  size_t getNumberOfDetectors() const;
+
+  //! Set the exclusion radius
+  void setExclusionRadius( const double exclusion_radius );
+
+  //! Return the exclusion radius
+  double getExclusionRadius() const;
+
+  //! Set the Russian roulette threshold
+  void setRussianRouletteThreshold( const double threshold );
+
+  //! Return the Russian roulette threshold
+  double getRussianRouletteThreshold() const;
+
+  //! Set the collision emission pdf evaluator
+  void setCollisionEmissionPDFEvaluator( const EmissionPDFEvaluator& evaluator );
+
+  //! Check if the collision emission pdf evaluator has been set
+  bool hasCollisionEmissionPDFEvaluator() const;
+
+  //! Set the source emission pdf evaluator
+  void setSourceEmissionPDFEvaluator( const EmissionPDFEvaluator& evaluator );
+
+  //! Check if the source emission pdf evaluator has been set
+  bool hasSourceEmissionPDFEvaluator() const;
+
+  //! Set the secondary emission pdf evaluator
+  void setSecondaryEmissionPDFEvaluator( const EmissionPDFEvaluator& evaluator );
+
+  //! Check if the secondary emission pdf evaluator has been set
+  bool hasSecondaryEmissionPDFEvaluator() const;
+
+  //! Set the macroscopic total cross section evaluator
+  void setTotalCrossSectionEvaluator( const TotalCrossSectionEvaluator& evaluator );
+
+  //! Create an emission pdf evaluator from an azimuthally symmetric angular pdf
+  static EmissionPDFEvaluator createAzimuthallySymmetricEmissionPDFEvaluator(
+      const std::function<double(const double,const double)>& angular_pdf );
+
+  //! Add current history estimator contribution
+  void updateFromGlobalParticleCollidingEvent(
+                              const ParticleState& particle ) final override;
+
+  //! Add current history estimator contribution
+  void updateFromGlobalParticleSourceEmissionEvent(
+                              const ParticleState& particle ) final override;
+
+  //! Add current history estimator contribution
+  void updateFromGlobalParticleSecondaryEmissionEvent(
+                              const ParticleState& particle ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+protected:
+
+  //! Default constructor
+  NextEventFluxEstimator();
+
+  //! Sample a point on the detector
+  virtual void sampleDetectorPoint( const size_t detector_index,
+                                    const double random_number,
+                                    double detector_point[3] ) const = 0;
+
+  //! Assign discretization to an estimator dimension
+  void assignDiscretization( const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+                             const bool range_dimension ) final override;
+
+private:
+
+  // The ray segment array (cell, path length)
+  typedef std::vector<std::pair<Geometry::Model::EntityId,double> >
+  RaySegmentArray;
+
+  // The optical depth cache (one per thread)
+  struct OpticalDepthCache
+  {
+    // Constructor
+    OpticalDepthCache();
+
+    // Check if the cached ray matches the requested ray
+    bool isRayCached( const double start_point[3],
+                      const double end_point[3],
+                      const Geometry::Model::EntityId start_cell ) const;
+
+    // The start point of the cached ray
+    double start_point[3];
+
+    // The end point of the cached ray
+    double end_point[3];
+
+    // The start cell of the cached ray
+    Geometry::Model::EntityId start_cell;
+
+    // The ray segments
+    RaySegmentArray segments;
+
+    // Records if the ray can't reach the end point (e.g. it is reflected)
+    bool blocked;
+
+    // Records if the cache has been initialized
+    bool ray_cached;
+
+    // The particle type associated with the cached optical depth
+    ParticleType particle_type;
+
+    // The energy associated with the cached optical depth
+    double energy;
+
+    // The cached optical depth
+    double optical_depth;
+  };
+
+  // The counter-based random number stream (one per thread)
+  struct RandomNumberStream
+  {
+    // Constructor
+    RandomNumberStream();
+
+    // Return a random number in [0,1) for the history
+    double getRandomNumber(
+                     const Id estimator_id,
+                     const ParticleState::historyNumberType requested_history );
+
+    // The history number of the last random number
+    ParticleState::historyNumberType history_number;
+
+    // The number of random numbers that have been used by the history
+    uint64_t counter;
+
+    // Records if a random number has been generated
+    bool initialized;
+  };
+
+  // Add the contribution from an event at the particle location
+  void updateFromEvent( const ParticleState& particle,
+                        const EmissionPDFEvaluator& pdf_evaluator );
+
+  // Calculate the optical depth from the particle to a detector point
+  double calculateOpticalDepth( const ParticleState& particle,
+                                const double detector_point[3],
+                                const double direction[3],
+                                const double distance,
+                                const double energy );
+
+  // Ray trace from the particle to a detector point
+  void traceRay( const ParticleState& particle,
+                 const double direction[3],
+                 const double distance,
+                 OpticalDepthCache& cache );
+
+  // Calculate the isotropic emission pdf
+  static void evaluateIsotropicEmissionPDF( const ParticleState& particle,
+                                            const double direction[3],
+                                            EmissionPDFArray& emission_pdfs );
+
+  // Calculate the void total cross section
+  static double evaluateVoidTotalCrossSection( const ParticleType particle_type,
+                                               const Geometry::Model::EntityId cell,
+                                               const double energy );
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The number of detectors
+  size_t d_number_of_detectors;
+
+  // The exclusion radius
+  double d_exclusion_radius;
+
+  // The Russian roulette threshold
+  double d_russian_roulette_threshold;
+
+  // The collision emission pdf evaluator
+  EmissionPDFEvaluator d_collision_emission_pdf_evaluator;
+
+  // The source emission pdf evaluator
+  EmissionPDFEvaluator d_source_emission_pdf_evaluator;
+
+  // Records if the source emission pdf evaluator has been set
+  bool d_source_emission_pdf_evaluator_set;
+
+  // The secondary emission pdf evaluator
+  EmissionPDFEvaluator d_secondary_emission_pdf_evaluator;
+
+  // Records if the secondary emission pdf evaluator has been set
+  bool d_secondary_emission_pdf_evaluator_set;
+
+  // The total cross section evaluator
+  TotalCrossSectionEvaluator d_total_cross_section_evaluator;
+
+  // The navigators used for ray tracing (one per thread)
+  std::vector<std::unique_ptr<Geometry::Navigator> > d_navigators;
+
+  // The optical depth caches (one per thread)
+  std::vector<OpticalDepthCache> d_optical_depth_caches;
+
+  // The random number streams (one per thread)
+  std::vector<RandomNumberStream> d_random_number_streams;
+
+  // The emission pdf arrays (one per thread)
+  std::vector<EmissionPDFArray> d_emission_pdf_arrays;
+};
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( NextEventFluxEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS1( NextEventFluxEstimator, MonteCarlo );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_NextEventFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_NextEventFluxEstimator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,765 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_NextEventFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  The next-event flux estimator class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+NextEventFluxEstimator<ContributionMultiplierPolicy>::NextEventFluxEstimator()
+  : d_number_of_detectors( 0 ),
+    d_exclusion_radius( 0.0 ),
+    d_russian_roulette_threshold( 0.0 ),
+    d_collision_emission_pdf_evaluator(),
+    d_source_emission_pdf_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateIsotropicEmissionPDF ),
+    d_source_emission_pdf_evaluator_set( false ),
+    d_secondary_emission_pdf_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateIsotropicEmissionPDF ),
+    d_secondary_emission_pdf_evaluator_set( false ),
+    d_total_cross_section_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateVoidTotalCrossSection ),
+    d_navigators( 1 ),
+    d_optical_depth_caches( 1 ),
+    d_random_number_streams( 1 ),
+    d_emission_pdf_arrays( 1 )
+{ /* ... */ }
+
+// Constructor
+/*! \details The detectors will be assigned entity ids in [0,n) where n is
+ * the number of detectors. The norm constant of each detector is one.
+ */
+template<typename ContributionMultiplierPolicy>
+NextEventFluxEstimator<ContributionMultiplierPolicy>::NextEventFluxEstimator(
+                                           const Id id,
+                                           const double multiplier,
+                                           const size_t number_of_detectors )
+  : StandardEntityEstimator( id, multiplier ),
+    ParticleCollidingGlobalEventObserver(),
+    ParticleSourceEmissionGlobalEventObserver(),
+    ParticleSecondaryEmissionGlobalEventObserver(),
+    d_number_of_detectors( number_of_detectors ),
+    d_exclusion_radius( 0.0 ),
+    d_russian_roulette_threshold( 0.0 ),
+    d_collision_emission_pdf_evaluator(),
+    d_source_emission_pdf_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateIsotropicEmissionPDF ),
+    d_source_emission_pdf_evaluator_set( false ),
+    d_secondary_emission_pdf_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateIsotropicEmissionPDF ),
+    d_secondary_emission_pdf_evaluator_set( false ),
+    d_total_cross_section_evaluator( &NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateVoidTotalCrossSection ),
+    d_navigators( 1 ),
+    d_optical_depth_caches( 1 ),
+    d_random_number_streams( 1 ),
+    d_emission_pdf_arrays( 1 )
+{
+  // Make sure that there is at least one detector
+  testPrecondition( number_of_detectors > 0 );
+
+  EntityNormConstMap detector_norm_constants;
+
+  for( size_t i = 0; i < number_of_detectors; ++i )
+    detector_norm_constants[i] = 1.0;
+
+  this->assignEntities( detector_norm_constants );
+}
+
+// Check if the estimator is a cell estimator
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::isCellEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a surface estimator
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::isSurfaceEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a mesh estimator
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::isMeshEstimator() const
+{
+  return false;
+}
+
+// Return the number of detectors
+template<typename ContributionMultiplierPolicy>
+size_t NextEventFluxEstimator<ContributionMultiplierPolicy>::getNumberOfDetectors() const
+{
+  return d_number_of_detectors;
+}
+
+// Set the exclusion radius
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setExclusionRadius(
+                                                const double exclusion_radius )
+{
+  TEST_FOR_EXCEPTION( exclusion_radius < 0.0,
+                      std::runtime_error,
+                      "The exclusion radius of next-event estimator "
+                      << this->getId() << " cannot be negative!" );
+
+  d_exclusion_radius = exclusion_radius;
+}
+
+// Return the exclusion radius
+template<typename ContributionMultiplierPolicy>
+double NextEventFluxEstimator<ContributionMultiplierPolicy>::getExclusionRadius() const
+{
+  return d_exclusion_radius;
+}
+
+// Set the Russian roulette threshold
+/*! \details A contribution c that is below the threshold t will survive
+ * with probability c/t. Surviving contributions will be set to t. A
+ * threshold of zero disables Russian roulette. The transport random number
+ * stream is not used by the roulette.
+ */
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setRussianRouletteThreshold(
+                                                       const double threshold )
+{
+  TEST_FOR_EXCEPTION( threshold < 0.0,
+                      std::runtime_error,
+                      "The Russian roulette threshold of next-event "
+                      "estimator " << this->getId() << " cannot be "
+                      "negative!" );
+
+  d_russian_roulette_threshold = threshold;
+}
+
+// Return the Russian roulette threshold
+template<typename ContributionMultiplierPolicy>
+double NextEventFluxEstimator<ContributionMultiplierPolicy>::getRussianRouletteThreshold() const
+{
+  return d_russian_roulette_threshold;
+}
+
+// Set the collision emission pdf evaluator
+/*! \details The evaluator must append the pdfs of a particle leaving the
+ * collision in the direction of the detector, which include the
+ * probability of each emitting reaction (the event handler creates a photon
+ * evaluator from PhotonMaterial::evaluateScatteringAngleCosinePDF).
+ */
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setCollisionEmissionPDFEvaluator(
+                                       const EmissionPDFEvaluator& evaluator )
+{
+  // Make sure that the evaluator is valid
+  testPrecondition( evaluator );
+
+  d_collision_emission_pdf_evaluator = evaluator;
+}
+
+// Check if the collision emission pdf evaluator has been set
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::hasCollisionEmissionPDFEvaluator() const
+{
+  return (bool)d_collision_emission_pdf_evaluator;
+}
+
+// Set the source emission pdf evaluator
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setSourceEmissionPDFEvaluator(
+                                       const EmissionPDFEvaluator& evaluator )
+{
+  // Make sure that the evaluator is valid
+  testPrecondition( evaluator );
+
+  d_source_emission_pdf_evaluator = evaluator;
+  d_source_emission_pdf_evaluator_set = true;
+}
+
+// Check if the source emission pdf evaluator has been set
+/*! \details If the source emission pdf evaluator has not been set the
+ * source emission is assumed to be isotropic.
+ */
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::hasSourceEmissionPDFEvaluator() const
+{
+  return d_source_emission_pdf_evaluator_set;
+}
+
+// Set the secondary emission pdf evaluator
+/*! \details The evaluator will be called with the state of each secondary
+ * particle just after it has been banked by a collision (the direction of
+ * the state is the sampled emission direction, which must not be used).
+ */
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setSecondaryEmissionPDFEvaluator(
+                                       const EmissionPDFEvaluator& evaluator )
+{
+  // Make sure that the evaluator is valid
+  testPrecondition( evaluator );
+
+  d_secondary_emission_pdf_evaluator = evaluator;
+  d_secondary_emission_pdf_evaluator_set = true;
+}
+
+// Check if the secondary emission pdf evaluator has been set
+/*! \details If the secondary emission pdf evaluator has not been set the
+ * secondary emission is assumed to be isotropic (e.g. fluorescence and
+ * annihilation photons).
+ */
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::hasSecondaryEmissionPDFEvaluator() const
+{
+  return d_secondary_emission_pdf_evaluator_set;
+}
+
+// Set the macroscopic total cross section evaluator
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::setTotalCrossSectionEvaluator(
+                                 const TotalCrossSectionEvaluator& evaluator )
+{
+  // Make sure that the evaluator is valid
+  testPrecondition( evaluator );
+
+  d_total_cross_section_evaluator = evaluator;
+
+  // The cached optical depths are no longer valid
+  for( size_t i = 0; i < d_optical_depth_caches.size(); ++i )
+    d_optical_depth_caches[i].energy = -1.0;
+}
+
+// Create an emission pdf evaluator from an azimuthally symmetric angular pdf
+/*! \details The angular pdf will be called with the incoming energy and the
+ * cosine of the angle between the particle direction and the direction to
+ * the detector (e.g. a bound ScatteringDistribution::evaluatePDF method).
+ * The energy of the particle heading to the detector is not changed.
+ */
+template<typename ContributionMultiplierPolicy>
+auto NextEventFluxEstimator<ContributionMultiplierPolicy>::createAzimuthallySymmetricEmissionPDFEvaluator(
+       const std::function<double(const double,const double)>& angular_pdf )
+  -> EmissionPDFEvaluator
+{
+  // Make sure that the angular pdf is valid
+  testPrecondition( angular_pdf );
+
+  return [angular_pdf]( const ParticleState& particle,
+                        const double direction[3],
+                        EmissionPDFArray& emission_pdfs )
+    {
+      const double* particle_direction = particle.getDirection();
+
+      double angle_cosine = particle_direction[0]*direction[0] +
+        particle_direction[1]*direction[1] +
+        particle_direction[2]*direction[2];
+
+      // Remove round-off errors
+      if( angle_cosine > 1.0 )
+        angle_cosine = 1.0;
+      else if( angle_cosine < -1.0 )
+        angle_cosine = -1.0;
+
+      emission_pdfs.push_back( std::make_pair(
+                            angular_pdf( particle.getEnergy(), angle_cosine )/
+                            (2*Utility::PhysicalConstants::pi),
+                            particle.getEnergy() ) );
+    };
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleCollidingEvent(
+                                                const ParticleState& particle )
+{
+  // Make sure that the particle type is assigned
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+  // Make sure that the collision emission pdf evaluator has been set
+  testPrecondition( this->hasCollisionEmissionPDFEvaluator() );
+
+  this->updateFromEvent( particle, d_collision_emission_pdf_evaluator );
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSourceEmissionEvent(
+                                                const ParticleState& particle )
+{
+  // Make sure that the particle type is assigned
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+
+  this->updateFromEvent( particle, d_source_emission_pdf_evaluator );
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSecondaryEmissionEvent(
+                                                const ParticleState& particle )
+{
+  // Make sure that the particle type is assigned
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+
+  this->updateFromEvent( particle, d_secondary_emission_pdf_evaluator );
+}
+
+// Add the contribution from an event at the particle location
+/*! \details Each emission pdf returned by the pdf evaluator is scored
+ * separately (with the optical depth at its energy).
+ */
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::updateFromEvent(
+                                    const ParticleState& particle,
+                                    const EmissionPDFEvaluator& pdf_evaluator )
+{
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_random_number_streams.size() );
+
+  RandomNumberStream& random_number_stream =
+    d_random_number_streams[Utility::OpenMPProperties::getThreadId()];
+
+  EmissionPDFArray& emission_pdfs =
+    d_emission_pdf_arrays[Utility::OpenMPProperties::getThreadId()];
+
+  // The detector state will only be created if a contribution is made
+  std::unique_ptr<ParticleState> detector_particle;
+
+  for( size_t i = 0; i < d_number_of_detectors; ++i )
+  {
+    double detector_point[3];
+
+    this->sampleDetectorPoint(
+                  i,
+                  random_number_stream.getRandomNumber(
+                                                 this->getId(),
+                                                 particle.getHistoryNumber() ),
+                  detector_point );
+
+    double direction[3] = {detector_point[0] - particle.getXPosition(),
+                           detector_point[1] - particle.getYPosition(),
+                           detector_point[2] - particle.getZPosition()};
+
+    const double distance = std::sqrt( direction[0]*direction[0] +
+                                       direction[1]*direction[1] +
+                                       direction[2]*direction[2] );
+
+    if( distance > 0.0 )
+    {
+      direction[0] /= distance;
+      direction[1] /= distance;
+      direction[2] /= distance;
+    }
+    else
+    {
+      direction[0] = particle.getXDirection();
+      direction[1] = particle.getYDirection();
+      direction[2] = particle.getZDirection();
+    }
+
+    // The distance is bounded below by the exclusion radius
+    const double effective_distance = std::max( distance, d_exclusion_radius );
+
+    if( effective_distance == 0.0 )
+      continue;
+
+    emission_pdfs.clear();
+
+    pdf_evaluator( particle, direction, emission_pdfs );
+
+    for( size_t j = 0; j < emission_pdfs.size(); ++j )
+    {
+      const double emission_pdf = emission_pdfs[j].first;
+      const double energy = emission_pdfs[j].second;
+
+      if( emission_pdf <= 0.0 || energy <= 0.0 )
+        continue;
+
+      double contribution =
+        emission_pdf/(effective_distance*effective_distance);
+
+      // Roulette tiny contributions before doing the ray trace
+      if( d_russian_roulette_threshold > 0.0 )
+      {
+        const double estimated_contribution =
+          contribution*particle.getWeight();
+
+        if( estimated_contribution < d_russian_roulette_threshold )
+        {
+          if( random_number_stream.getRandomNumber(
+                                             this->getId(),
+                                             particle.getHistoryNumber() )*
+              d_russian_roulette_threshold < estimated_contribution )
+          {
+            contribution *= d_russian_roulette_threshold/estimated_contribution;
+          }
+          else
+            continue;
+        }
+      }
+
+      const double optical_depth =
+        this->calculateOpticalDepth( particle,
+                                     detector_point,
+                                     direction,
+                                     distance,
+                                     energy );
+
+      if( optical_depth == std::numeric_limits<double>::infinity() )
+        continue;
+
+      contribution *= std::exp( -optical_depth );
+
+      if( contribution <= 0.0 )
+        continue;
+
+      if( !detector_particle )
+        detector_particle.reset( particle.clone() );
+
+      detector_particle->setEnergy( energy );
+      detector_particle->setTime( particle.getTime() +
+                                  distance/detector_particle->getSpeed() );
+
+      ObserverParticleStateWrapper particle_state_wrapper( *detector_particle );
+
+      this->addPartialHistoryPointContribution(
+        i,
+        particle_state_wrapper,
+        contribution*ContributionMultiplierPolicy::multiplier( *detector_particle ) );
+    }
+  }
+}
+
+// Calculate the optical depth from the particle to a detector point
+template<typename ContributionMultiplierPolicy>
+double NextEventFluxEstimator<ContributionMultiplierPolicy>::calculateOpticalDepth(
+                                              const ParticleState& particle,
+                                              const double detector_point[3],
+                                              const double direction[3],
+                                              const double distance,
+                                              const double energy )
+{
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_optical_depth_caches.size() );
+
+  OpticalDepthCache& cache =
+    d_optical_depth_caches[Utility::OpenMPProperties::getThreadId()];
+
+  if( !cache.isRayCached( particle.getPosition(),
+                          detector_point,
+                          particle.getCell() ) )
+  {
+    this->traceRay( particle, direction, distance, cache );
+
+    cache.start_point[0] = particle.getXPosition();
+    cache.start_point[1] = particle.getYPosition();
+    cache.start_point[2] = particle.getZPosition();
+
+    cache.end_point[0] = detector_point[0];
+    cache.end_point[1] = detector_point[1];
+    cache.end_point[2] = detector_point[2];
+
+    cache.start_cell = particle.getCell();
+    cache.ray_cached = true;
+    cache.energy = -1.0;
+  }
+
+  if( cache.blocked )
+    return std::numeric_limits<double>::infinity();
+
+  // Reuse the optical depth if the particle type and energy are unchanged
+  if( cache.particle_type == particle.getParticleType() &&
+      cache.energy == energy )
+    return cache.optical_depth;
+
+  double optical_depth = 0.0;
+
+  for( size_t i = 0; i < cache.segments.size(); ++i )
+  {
+    optical_depth +=
+      d_total_cross_section_evaluator( particle.getParticleType(),
+                                       cache.segments[i].first,
+                                       energy )*cache.segments[i].second;
+
+    if( optical_depth == std::numeric_limits<double>::infinity() )
+      break;
+  }
+
+  cache.particle_type = particle.getParticleType();
+  cache.energy = energy;
+  cache.optical_depth = optical_depth;
+
+  return optical_depth;
+}
+
+// Ray trace from the particle to a detector point
+/*! \details If a reflecting surface is hit or if the ray gets lost the ray
+ * will be marked as blocked (no contribution will be made).
+ */
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::traceRay(
+                                                const ParticleState& particle,
+                                                const double direction[3],
+                                                const double distance,
+                                                OpticalDepthCache& cache )
+{
+  std::unique_ptr<Geometry::Navigator>& navigator =
+    d_navigators[Utility::OpenMPProperties::getThreadId()];
+
+  // Each thread reuses the navigator that it clones from the first particle
+  if( !navigator )
+    navigator.reset( particle.navigator().clone() );
+
+  cache.segments.clear();
+  cache.blocked = false;
+
+  try{
+    navigator->setState(
+                 Geometry::Navigator::Length::from_value( particle.getXPosition() ),
+                 Geometry::Navigator::Length::from_value( particle.getYPosition() ),
+                 Geometry::Navigator::Length::from_value( particle.getZPosition() ),
+                 direction[0], direction[1], direction[2],
+                 particle.getCell() );
+
+    double remaining_distance = distance;
+
+    while( remaining_distance > 0.0 )
+    {
+      const double distance_to_surface = navigator->fireRay().value();
+
+      if( distance_to_surface >= remaining_distance )
+      {
+        cache.segments.push_back( std::make_pair( navigator->getCurrentCell(),
+                                                  remaining_distance ) );
+        break;
+      }
+
+      cache.segments.push_back( std::make_pair( navigator->getCurrentCell(),
+                                                distance_to_surface ) );
+
+      remaining_distance -= distance_to_surface;
+
+      if( navigator->advanceToCellBoundary() )
+      {
+        cache.blocked = true;
+        break;
+      }
+    }
+  }
+  catch( const std::exception& exception )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "A next-event ray of estimator "
+                                << this->getId() << " was lost: "
+                                << exception.what() );
+
+    cache.blocked = true;
+  }
+}
+
+// Calculate the isotropic emission pdf
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateIsotropicEmissionPDF(
+                                             const ParticleState& particle,
+                                             const double direction[3],
+                                             EmissionPDFArray& emission_pdfs )
+{
+  emission_pdfs.push_back( std::make_pair(
+                                        1.0/(4*Utility::PhysicalConstants::pi),
+                                        particle.getEnergy() ) );
+}
+
+// Calculate the void total cross section
+template<typename ContributionMultiplierPolicy>
+double NextEventFluxEstimator<ContributionMultiplierPolicy>::evaluateVoidTotalCrossSection(
+                                        const ParticleType particle_type,
+                                        const Geometry::Model::EntityId cell,
+                                        const double energy )
+{
+  return 0.0;
+}
+
+// Enable support for multiple threads
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  StandardEntityEstimator::enableThreadSupport( num_threads );
+
+  d_navigators.resize( num_threads );
+  d_optical_depth_caches.resize( num_threads );
+  d_random_number_streams.resize( num_threads );
+  d_emission_pdf_arrays.resize( num_threads );
+}
+
+// Assign discretization to an estimator dimension
+template<typename ContributionMultiplierPolicy>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::assignDiscretization(
+  const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+  const bool range_dimension )
+{
+  if( bins->getDimension() == OBSERVER_COSINE_DIMENSION )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                bins->getDimensionName() <<
+                                " bins cannot be set for next-event "
+                                "estimators. The bins requested for "
+                                "next-event estimator " << this->getId() <<
+                                " will be ignored!" );
+  }
+  else
+    StandardEntityEstimator::assignDiscretization( bins, false );
+}
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+NextEventFluxEstimator<ContributionMultiplierPolicy>::OpticalDepthCache::OpticalDepthCache()
+  : start_point{0.0, 0.0, 0.0},
+    end_point{0.0, 0.0, 0.0},
+    start_cell( 0 ),
+    segments(),
+    blocked( false ),
+    ray_cached( false ),
+    particle_type( PHOTON ),
+    energy( -1.0 ),
+    optical_depth( 0.0 )
+{ /* ... */ }
+
+// Check if the cached ray matches the requested ray
+template<typename ContributionMultiplierPolicy>
+bool NextEventFluxEstimator<ContributionMultiplierPolicy>::OpticalDepthCache::isRayCached(
+                        const double requested_start_point[3],
+                        const double requested_end_point[3],
+                        const Geometry::Model::EntityId requested_start_cell ) const
+{
+  return ray_cached &&
+    start_cell == requested_start_cell &&
+    start_point[0] == requested_start_point[0] &&
+    start_point[1] == requested_start_point[1] &&
+    start_point[2] == requested_start_point[2] &&
+    end_point[0] == requested_end_point[0] &&
+    end_point[1] == requested_end_point[1] &&
+    end_point[2] == requested_end_point[2];
+}
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+NextEventFluxEstimator<ContributionMultiplierPolicy>::RandomNumberStream::RandomNumberStream()
+  : history_number( 0 ),
+    counter( 0 ),
+    initialized( false )
+{ /* ... */ }
+
+// Return a random number in [0,1) for the history
+/*! \details The estimator id, the history number and the number of random
+ * numbers that have already been used by the history are combined with the
+ * SplitMix64 mixing function. The 53 most significant bits of the result are
+ * used to create the random number.
+ */
+template<typename ContributionMultiplierPolicy>
+double NextEventFluxEstimator<ContributionMultiplierPolicy>::RandomNumberStream::getRandomNumber(
+                      const Id estimator_id,
+                      const ParticleState::historyNumberType requested_history )
+{
+  if( !initialized || history_number != requested_history )
+  {
+    history_number = requested_history;
+    counter = 0;
+    initialized = true;
+  }
+
+  auto mix = []( uint64_t value ) -> uint64_t
+    {
+      value += 0x9e3779b97f4a7c15ULL;
+      value = (value ^ (value >> 30))*0xbf58476d1ce4e5b9ULL;
+      value = (value ^ (value >> 27))*0x94d049bb133111ebULL;
+
+      return value ^ (value >> 31);
+    };
+
+  uint64_t key = mix( estimator_id );
+  key = mix( key ^ history_number );
+  key = mix( key ^ counter );
+
+  ++counter;
+
+  return (key >> 11)*(1.0/9007199254740992.0);
+}
+
+// Save the data to an archive
+// Note: The emission pdf evaluators and the total cross section evaluator
+//       will not be saved. They must be reset after loading.
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( StandardEntityEstimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceEmissionGlobalEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSecondaryEmissionGlobalEventObserver );
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_detectors );
+  ar & BOOST_SERIALIZATION_NVP( d_exclusion_radius );
+  ar & BOOST_SERIALIZATION_NVP( d_russian_roulette_threshold );
+}
+
+// Load the data from an archive
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void NextEventFluxEstimator<ContributionMultiplierPolicy>::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( StandardEntityEstimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSourceEmissionGlobalEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSecondaryEmissionGlobalEventObserver );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_number_of_detectors );
+  ar & BOOST_SERIALIZATION_NVP( d_exclusion_radius );
+  ar & BOOST_SERIALIZATION_NVP( d_russian_roulette_threshold );
+
+  // Initialize the thread data
+  d_navigators.clear();
+  d_navigators.resize( 1 );
+  d_optical_depth_caches.clear();
+  d_optical_depth_caches.resize( 1 );
+  d_random_number_streams.clear();
+  d_random_number_streams.resize( 1 );
+  d_emission_pdf_arrays.clear();
+  d_emission_pdf_arrays.resize( 1 );
+}
+
+} // end MonteCarlo namespace
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, NextEventFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, NextEventFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::NextEventFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, NextEventFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+#endif // end MONTE_CARLO_NEXT_EVENT_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_NextEventFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
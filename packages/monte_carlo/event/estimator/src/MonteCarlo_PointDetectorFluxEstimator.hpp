@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  The point detector flux estimator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+// Std Lib Includes
+#include <array>
+
+// FRENSIE Includes
+#include "MonteCarlo_NextEventFluxEstimator.hpp"
+#include "Utility_Array.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The point detector flux estimator class
+ * \details Each detector point is an estimator entity. The entity id of a
+ * detector point is its index in the detector point array.
+ * \ingroup particle_colliding_global_event
+ * \ingroup particle_source_emission_global_event
+ * \ingroup particle_secondary_emission_global_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class PointDetectorFluxEstimator : public NextEventFluxEstimator<ContributionMultiplierPolicy>
+{
+  // Typedef for the base type
+  typedef NextEventFluxEstimator<ContributionMultiplierPolicy> BaseType;
+
+public:
+
+  //! Typedef for the detector point type
+  typedef std::array<double,3> DetectorPoint;
+
+  //! Constructor
+  PointDetectorFluxEstimator(
+                      const Estimator::Id id,
+                      const double multiplier,
+                      const std::vector<DetectorPoint>& detector_points );
+
+  //! Destructor
+  ~PointDetectorFluxEstimator()
+  { /* ... */ }
+
+  //! Return the detector point
+  const DetectorPoint& getDetectorPoint( const size_t detector_index ) const;
+
+  //! Print the estimator data summary
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Default constructor
+  PointDetectorFluxEstimator();
+
+  //! Sample a point on the detector
+  void sampleDetectorPoint( const size_t detector_index,
+                            const double random_number,
+                            double detector_point[3] ) const final override;
+
+private:
+
+  // Serialize the estimator data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The detector points
+  std::vector<DetectorPoint> d_detector_points;
+};
+
+//! The weight multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightMultiplier> WeightMultipliedPointDetectorFluxEstimator;
+
+//! The weight and energy multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightAndEnergyMultiplier> WeightAndEnergyMultipliedPointDetectorFluxEstimator;
+
+//! The weight and charge multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightAndChargeMultiplier> WeightAndChargeMultipliedPointDetectorFluxEstimator;
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( PointDetectorFluxEstimator, MonteCarlo, 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_PointDetectorFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator.hpp
+//---------------------------------------------------------------------------//
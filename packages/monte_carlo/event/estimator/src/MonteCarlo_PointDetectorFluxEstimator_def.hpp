@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  The point detector flux estimator class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+// FRENSIE Includes
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator()
+{ /* ... */ }
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator(
+                      const Estimator::Id id,
+                      const double multiplier,
+                      const std::vector<DetectorPoint>& detector_points )
+  : BaseType( id, multiplier, detector_points.size() ),
+    d_detector_points( detector_points )
+{ /* ... */ }
+
+// Return the detector point
+template<typename ContributionMultiplierPolicy>
+auto PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getDetectorPoint(
+                     const size_t detector_index ) const -> const DetectorPoint&
+{
+  // Make sure that the detector index is valid
+  testPrecondition( detector_index < d_detector_points.size() );
+
+  return d_detector_points[detector_index];
+}
+
+// Sample a point on the detector
+/*! \details The random number is not needed to sample a point detector.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::sampleDetectorPoint(
+                                             const size_t detector_index,
+                                             const double random_number,
+                                             double detector_point[3] ) const
+{
+  // Make sure that the detector index is valid
+  testPrecondition( detector_index < d_detector_points.size() );
+
+  detector_point[0] = d_detector_points[detector_index][0];
+  detector_point[1] = d_detector_points[detector_index][1];
+  detector_point[2] = d_detector_points[detector_index][2];
+}
+
+// Print the estimator data summary
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::printSummary(
+                                                       std::ostream& os ) const
+{
+  os << "Point Detector Flux Estimator: " << this->getId() << "\n";
+
+  for( size_t i = 0; i < d_detector_points.size(); ++i )
+  {
+    os << "  Detector " << i << ": "
+       << Utility::toString( d_detector_points[i] ) << "\n";
+  }
+
+  this->printImplementation( os, "Detector" );
+
+  os << std::flush;
+}
+
+// Serialize the estimator data
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::serialize( Archive& ar, const unsigned version )
+{
+  // Serialize the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType );
+
+  // Serialize the local data
+  ar & BOOST_SERIALIZATION_NVP( d_detector_points );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndEnergyMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndChargeMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,27 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RingDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  The ring detector flux estimator instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_RingDetectorFluxEstimator.hpp"
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightMultipliedRingDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndEnergyMultipliedRingDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndChargeMultipliedRingDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RingDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
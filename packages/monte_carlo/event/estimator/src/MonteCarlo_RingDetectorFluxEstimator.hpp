@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RingDetectorFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  The ring detector flux estimator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_HPP
+
+// Std Lib Includes
+#include <utility>
+
+// Boost Includes
+#include <boost/serialization/utility.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NextEventFluxEstimator.hpp"
+#include "Utility_Axis.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The ring detector flux estimator class
+ * \details The rings are centered on one of the coordinate axes. At each
+ * event a point on each ring is sampled uniformly in the azimuthal angle
+ * (with the estimator's own random number stream, see
+ * NextEventFluxEstimator), which makes the point detector estimate at the sampled point an unbiased
+ * estimate of the ring averaged flux. The entity id of a ring is its index
+ * in the ring array.
+ * \ingroup particle_colliding_global_event
+ * \ingroup particle_source_emission_global_event
+ * \ingroup particle_secondary_emission_global_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class RingDetectorFluxEstimator : public NextEventFluxEstimator<ContributionMultiplierPolicy>
+{
+  // Typedef for the base type
+  typedef NextEventFluxEstimator<ContributionMultiplierPolicy> BaseType;
+
+public:
+
+  //! Typedef for the detector ring type (axial position, radius)
+  typedef std::pair<double,double> DetectorRing;
+
+  //! Constructor
+  RingDetectorFluxEstimator( const Estimator::Id id,
+                             const double multiplier,
+                             const Utility::Axis axis,
+                             const std::vector<DetectorRing>& detector_rings );
+
+  //! Destructor
+  ~RingDetectorFluxEstimator()
+  { /* ... */ }
+
+  //! Return the ring axis
+  Utility::Axis getAxis() const;
+
+  //! Return the detector ring
+  const DetectorRing& getDetectorRing( const size_t detector_index ) const;
+
+  //! Print the estimator data summary
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Default constructor
+  RingDetectorFluxEstimator();
+
+  //! Sample a point on the detector
+  void sampleDetectorPoint( const size_t detector_index,
+                            const double random_number,
+                            double detector_point[3] ) const final override;
+
+private:
+
+  // Serialize the estimator data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The ring axis
+  Utility::Axis d_axis;
+
+  // The detector rings
+  std::vector<DetectorRing> d_detector_rings;
+};
+
+//! The weight multiplied ring detector flux estimator
+typedef RingDetectorFluxEstimator<WeightMultiplier> WeightMultipliedRingDetectorFluxEstimator;
+
+//! The weight and energy multiplied ring detector flux estimator
+typedef RingDetectorFluxEstimator<WeightAndEnergyMultiplier> WeightAndEnergyMultipliedRingDetectorFluxEstimator;
+
+//! The weight and charge multiplied ring detector flux estimator
+typedef RingDetectorFluxEstimator<WeightAndChargeMultiplier> WeightAndChargeMultipliedRingDetectorFluxEstimator;
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( RingDetectorFluxEstimator, MonteCarlo, 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_RingDetectorFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RingDetectorFluxEstimator.hpp
+//---------------------------------------------------------------------------//
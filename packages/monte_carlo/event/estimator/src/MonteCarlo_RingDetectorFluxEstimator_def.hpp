@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_RingDetectorFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  The ring detector flux estimator class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+RingDetectorFluxEstimator<ContributionMultiplierPolicy>::RingDetectorFluxEstimator()
+{ /* ... */ }
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+RingDetectorFluxEstimator<ContributionMultiplierPolicy>::RingDetectorFluxEstimator(
+                             const Estimator::Id id,
+                             const double multiplier,
+                             const Utility::Axis axis,
+                             const std::vector<DetectorRing>& detector_rings )
+  : BaseType( id, multiplier, detector_rings.size() ),
+    d_axis( axis ),
+    d_detector_rings( detector_rings )
+{
+  TEST_FOR_EXCEPTION( axis == Utility::UNDEFINED_AXIS,
+                      std::runtime_error,
+                      "The axis of ring detector estimator " << id <<
+                      " must be defined!" );
+
+  for( size_t i = 0; i < detector_rings.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( detector_rings[i].second <= 0.0,
+                        std::runtime_error,
+                        "The radius of ring " << i << " of ring detector "
+                        "estimator " << id << " must be positive!" );
+  }
+}
+
+// Return the ring axis
+template<typename ContributionMultiplierPolicy>
+Utility::Axis RingDetectorFluxEstimator<ContributionMultiplierPolicy>::getAxis() const
+{
+  return d_axis;
+}
+
+// Return the detector ring
+template<typename ContributionMultiplierPolicy>
+auto RingDetectorFluxEstimator<ContributionMultiplierPolicy>::getDetectorRing(
+                      const size_t detector_index ) const -> const DetectorRing&
+{
+  // Make sure that the detector index is valid
+  testPrecondition( detector_index < d_detector_rings.size() );
+
+  return d_detector_rings[detector_index];
+}
+
+// Sample a point on the detector
+template<typename ContributionMultiplierPolicy>
+void RingDetectorFluxEstimator<ContributionMultiplierPolicy>::sampleDetectorPoint(
+                                             const size_t detector_index,
+                                             const double random_number,
+                                             double detector_point[3] ) const
+{
+  // Make sure that the detector index is valid
+  testPrecondition( detector_index < d_detector_rings.size() );
+  // Make sure that the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number < 1.0 );
+
+  const double azimuthal_angle =
+    2*Utility::PhysicalConstants::pi*random_number;
+
+  const double axial_position = d_detector_rings[detector_index].first;
+  const double radius = d_detector_rings[detector_index].second;
+
+  const double u = radius*std::cos( azimuthal_angle );
+  const double v = radius*std::sin( azimuthal_angle );
+
+  switch( d_axis )
+  {
+  case Utility::X_AXIS:
+  {
+    detector_point[0] = axial_position;
+    detector_point[1] = u;
+    detector_point[2] = v;
+    break;
+  }
+  case Utility::Y_AXIS:
+  {
+    detector_point[0] = v;
+    detector_point[1] = axial_position;
+    detector_point[2] = u;
+    break;
+  }
+  default:
+  {
+    detector_point[0] = u;
+    detector_point[1] = v;
+    detector_point[2] = axial_position;
+  }
+  }
+}
+
+// Print the estimator data summary
+template<typename ContributionMultiplierPolicy>
+void RingDetectorFluxEstimator<ContributionMultiplierPolicy>::printSummary(
+                                                       std::ostream& os ) const
+{
+  os << "Ring Detector Flux Estimator: " << this->getId() << "\n";
+
+  for( size_t i = 0; i < d_detector_rings.size(); ++i )
+  {
+    os << "  Ring " << i << ": axial position = "
+       << d_detector_rings[i].first << ", radius = "
+       << d_detector_rings[i].second << "\n";
+  }
+
+  this->printImplementation( os, "Ring" );
+
+  os << std::flush;
+}
+
+// Serialize the estimator data
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void RingDetectorFluxEstimator<ContributionMultiplierPolicy>::serialize( Archive& ar, const unsigned version )
+{
+  // Serialize the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType );
+
+  // Serialize the local data
+  ar & BOOST_SERIALIZATION_NVP( d_axis );
+  ar & BOOST_SERIALIZATION_NVP( d_detector_rings );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightMultipliedRingDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, RingDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndEnergyMultipliedRingDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, RingDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndChargeMultipliedRingDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::RingDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, RingDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+#endif // end MONTE_CARLO_RING_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_RingDetectorFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
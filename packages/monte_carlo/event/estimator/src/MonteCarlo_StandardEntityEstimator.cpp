@@ -584,25 +584,24 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
-    // Reduce the entity data
+    // Reduce the entity total data and the total data with a single flat
+    // reduction
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_total_estimator_moments_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for entity total data!" );
+      MomentReductionLayout layout;
 
-    comm.barrier();
+      this->addEntityCollectionMapToReductionLayout(
+                             d_entity_total_estimator_moments_map, layout );
+      this->addCollectionToReductionLayout( d_total_estimator_moments,
+                                            layout );
 
-    // Reduce the total data
-    try{
-      this->reduceCollection( comm, root_process, d_total_estimator_moments );
+      this->reduceMoments( comm, root_process, layout );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in "
                              "standard entity estimator " << this->getId() <<
-                             " for total data!" );
+                             " for entity total and total data!" );
+
+    comm.barrier();
 
     // Reduce the entity snapshot data
     try{
@@ -180,7 +180,7 @@ public:
   void commitHistoryContribution() final override;
 
   //! Enable support for multiple threads
-  void enableThreadSupport( const unsigned num_threads ) final override;
+  void enableThreadSupport( const unsigned num_threads ) override;
 
   //! Reset estimator data
   void resetData() final override;
@@ -0,0 +1,441 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  The statistical precision particle history simulation completion
+//!         criterion class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <sstream>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.hpp"
+#include "Utility_SampleMoment.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+StatisticalPrecisionParticleHistorySimulationCompletionCriterion::StatisticalPrecisionParticleHistorySimulationCompletionCriterion()
+  : d_min_number_of_histories( 0 ),
+    d_targets(),
+    d_number_of_checked_histories( 0 ),
+    d_targets_met( false ),
+    d_previous_figures_of_merit()
+{ /* ... */ }
+
+// Constructor
+/*! \details The targets will not be checked until the min number of
+ * histories have been completed, which prevents the simulation from being
+ * stopped early by bins that have only been scored in a few histories.
+ */
+StatisticalPrecisionParticleHistorySimulationCompletionCriterion::StatisticalPrecisionParticleHistorySimulationCompletionCriterion(
+                                      const uint64_t min_number_of_histories )
+  : d_min_number_of_histories( min_number_of_histories ),
+    d_targets(),
+    d_number_of_checked_histories( 0 ),
+    d_targets_met( false ),
+    d_previous_figures_of_merit()
+{ /* ... */ }
+
+// Add a precision target for the bins of an estimator entity
+/*! \details If the bin indices array is empty all of the entity bins will be
+ * checked. The bin indices follow the estimator bin layout (the response
+ * function index varies slowest). For the figure of merit stability metric
+ * the tolerance is the max relative change in the figure of merit of each
+ * bin between consecutive checks.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::addEntityBinTarget(
+                             const std::shared_ptr<const Estimator>& estimator,
+                             const Estimator::EntityId entity_id,
+                             const std::vector<size_t>& bin_indices,
+                             const PrecisionMetric metric,
+                             const double tolerance )
+{
+  TEST_FOR_EXCEPTION( !estimator.get(),
+                      std::runtime_error,
+                      "A precision target cannot be added for a null "
+                      "estimator!" );
+
+  TEST_FOR_EXCEPTION( !estimator->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << estimator->getId() << "!" );
+
+  this->addTarget( estimator, false, entity_id, bin_indices, metric, tolerance );
+}
+
+// Add a precision target for the total bins of an estimator
+/*! \details If the bin indices array is empty all of the total bins will be
+ * checked.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::addTotalBinTarget(
+                             const std::shared_ptr<const Estimator>& estimator,
+                             const std::vector<size_t>& bin_indices,
+                             const PrecisionMetric metric,
+                             const double tolerance )
+{
+  TEST_FOR_EXCEPTION( !estimator.get(),
+                      std::runtime_error,
+                      "A precision target cannot be added for a null "
+                      "estimator!" );
+
+  this->addTarget( estimator, true, 0, bin_indices, metric, tolerance );
+}
+
+// Add a precision target
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::addTarget(
+                             const std::shared_ptr<const Estimator>& estimator,
+                             const bool total,
+                             const Estimator::EntityId entity_id,
+                             const std::vector<size_t>& bin_indices,
+                             const PrecisionMetric metric,
+                             const double tolerance )
+{
+  // Make sure that the estimator is valid
+  testPrecondition( estimator.get() );
+
+  TEST_FOR_EXCEPTION( tolerance <= 0.0,
+                      std::runtime_error,
+                      "The precision target tolerance must be greater than "
+                      "0.0!" );
+
+  const size_t number_of_bins = estimator->getNumberOfBins()*
+    estimator->getNumberOfResponseFunctions();
+
+  for( auto&& bin_index : bin_indices )
+  {
+    TEST_FOR_EXCEPTION( bin_index >= number_of_bins,
+                        std::runtime_error,
+                        "Bin " << bin_index << " is not a valid bin of "
+                        "estimator " << estimator->getId() << " (there are "
+                        "only " << number_of_bins << " bins)!" );
+  }
+
+  PrecisionTarget target;
+  target.estimator = estimator;
+  target.total = total;
+  target.entity_id = entity_id;
+  target.bin_indices = bin_indices;
+  target.metric = metric;
+  target.tolerance = tolerance;
+
+  d_targets.push_back( target );
+  d_previous_figures_of_merit.resize( d_targets.size() );
+
+  this->clearCache();
+}
+
+// Return the number of precision targets
+size_t StatisticalPrecisionParticleHistorySimulationCompletionCriterion::getNumberOfTargets() const
+{
+  return d_targets.size();
+}
+
+// Return the min number of histories
+uint64_t StatisticalPrecisionParticleHistorySimulationCompletionCriterion::getMinNumberOfHistories() const
+{
+  return d_min_number_of_histories;
+}
+
+// Check if the simulation is complete
+/*! \details The targets are only checked when the number of histories has
+ * changed since the last check. The figure of merit stability targets can
+ * only be met once the figures of merit from a previous check are
+ * available.
+ */
+bool StatisticalPrecisionParticleHistorySimulationCompletionCriterion::isSimulationComplete() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  const uint64_t num_histories = this->getNumberOfHistories();
+
+  if( num_histories != d_number_of_checked_histories )
+  {
+    d_number_of_checked_histories = num_histories;
+
+    const double elapsed_time = this->getElapsedTime();
+
+    if( d_targets.empty() ||
+        num_histories < d_min_number_of_histories ||
+        num_histories < 2 ||
+        elapsed_time <= 0.0 )
+    {
+      d_targets_met = false;
+    }
+    else
+    {
+      d_targets_met = true;
+
+      // Every target must be checked so that the figures of merit of each
+      // target bin are cached
+      for( size_t i = 0; i < d_targets.size(); ++i )
+      {
+        if( !this->isTargetMet( i, num_histories, elapsed_time ) )
+          d_targets_met = false;
+      }
+    }
+  }
+
+  return d_targets_met;
+}
+
+// Check if a precision target has been met
+bool StatisticalPrecisionParticleHistorySimulationCompletionCriterion::isTargetMet(
+                                           const size_t target_index,
+                                           const uint64_t num_histories,
+                                           const double elapsed_time ) const
+{
+  // Make sure that the target index is valid
+  testPrecondition( target_index < d_targets.size() );
+
+  const PrecisionTarget& target = d_targets[target_index];
+
+  Utility::ArrayView<const double> first_moments, second_moments,
+    third_moments, fourth_moments;
+
+  if( target.total )
+  {
+    first_moments = target.estimator->getTotalBinDataFirstMoments();
+    second_moments = target.estimator->getTotalBinDataSecondMoments();
+
+    if( target.metric == VARIANCE_OF_VARIANCE_METRIC )
+    {
+      third_moments = target.estimator->getTotalBinDataThirdMoments();
+      fourth_moments = target.estimator->getTotalBinDataFourthMoments();
+    }
+  }
+  else
+  {
+    first_moments =
+      target.estimator->getEntityBinDataFirstMoments( target.entity_id );
+    second_moments =
+      target.estimator->getEntityBinDataSecondMoments( target.entity_id );
+
+    if( target.metric == VARIANCE_OF_VARIANCE_METRIC )
+    {
+      third_moments =
+        target.estimator->getEntityBinDataThirdMoments( target.entity_id );
+      fourth_moments =
+        target.estimator->getEntityBinDataFourthMoments( target.entity_id );
+    }
+  }
+
+  const size_t number_of_bins = target.bin_indices.empty() ?
+    first_moments.size() : target.bin_indices.size();
+
+  std::vector<double>& previous_figures_of_merit =
+    d_previous_figures_of_merit[target_index];
+
+  if( target.metric == FIGURE_OF_MERIT_STABILITY_METRIC &&
+      previous_figures_of_merit.size() != number_of_bins )
+    previous_figures_of_merit.assign( number_of_bins, 0.0 );
+
+  bool target_met = true;
+
+  for( size_t i = 0; i < number_of_bins; ++i )
+  {
+    const size_t bin_index =
+      target.bin_indices.empty() ? i : target.bin_indices[i];
+
+    const Utility::SampleMoment<1,double> first_moment( first_moments[bin_index] );
+    const Utility::SampleMoment<2,double> second_moment( second_moments[bin_index] );
+
+    bool bin_target_met;
+
+    // A bin without any score can never meet its target
+    if( first_moment.getCurrentScore() <= 0.0 )
+    {
+      bin_target_met = false;
+
+      if( target.metric == FIGURE_OF_MERIT_STABILITY_METRIC )
+        previous_figures_of_merit[i] = 0.0;
+    }
+    else
+    {
+      const double relative_error =
+        Utility::calculateRelativeError( first_moment,
+                                         second_moment,
+                                         num_histories );
+
+      switch( target.metric )
+      {
+        case RELATIVE_ERROR_METRIC:
+        {
+          bin_target_met = relative_error <= target.tolerance;
+
+          break;
+        }
+
+        case VARIANCE_OF_VARIANCE_METRIC:
+        {
+          const double variance_of_variance =
+            Utility::calculateRelativeVOV(
+                    first_moment,
+                    second_moment,
+                    Utility::SampleMoment<3,double>( third_moments[bin_index] ),
+                    Utility::SampleMoment<4,double>( fourth_moments[bin_index] ),
+                    num_histories );
+
+          bin_target_met = variance_of_variance <= target.tolerance;
+
+          break;
+        }
+
+        case FIGURE_OF_MERIT_STABILITY_METRIC:
+        {
+          const double figure_of_merit =
+            Utility::calculateFOM( relative_error, elapsed_time );
+
+          const double previous_figure_of_merit =
+            previous_figures_of_merit[i];
+
+          bin_target_met = previous_figure_of_merit > 0.0 &&
+            figure_of_merit > 0.0 &&
+            std::fabs( figure_of_merit - previous_figure_of_merit )/
+            previous_figure_of_merit <= target.tolerance;
+
+          previous_figures_of_merit[i] = figure_of_merit;
+
+          break;
+        }
+
+        default:
+        {
+          THROW_EXCEPTION( std::logic_error,
+                           "Unknown precision metric (" << target.metric <<
+                           ") encountered!" );
+        }
+      }
+    }
+
+    if( !bin_target_met )
+    {
+      target_met = false;
+
+      // The figures of merit of the remaining bins must still be cached
+      if( target.metric != FIGURE_OF_MERIT_STABILITY_METRIC )
+        break;
+    }
+  }
+
+  return target_met;
+}
+
+// Start the criterion
+/*! \details The targets are checked on demand - there is nothing to start.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::start()
+{ /* ... */ }
+
+// Stop the criterion
+/*! \details The targets are checked on demand - there is nothing to stop.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::stop()
+{ /* ... */ }
+
+// Clear cached criterion data
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::clearCache()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_number_of_checked_histories = 0;
+  d_targets_met = false;
+
+  for( size_t i = 0; i < d_previous_figures_of_merit.size(); ++i )
+    d_previous_figures_of_merit[i].clear();
+}
+
+// Enable support for multiple threads
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::enableThreadSupport( const unsigned num_threads )
+{ /* ... */ }
+
+// Check if the observer has uncommitted history contributions
+bool StatisticalPrecisionParticleHistorySimulationCompletionCriterion::hasUncommittedHistoryContribution() const
+{
+  return false;
+}
+
+// Commit the contribution from the current history to the observer
+/*! \details The estimators collect the data that is used by this criterion.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::commitHistoryContribution()
+{ /* ... */ }
+
+// Reset the observer data
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::resetData()
+{
+  this->clearCache();
+}
+
+// Reduce the object data on all processes in comm and collect on root
+/*! \details The estimators reduce the data that is used by this criterion.
+ * Only the criterion on the root process (which holds the reduced estimator
+ * data) should be checked.
+ */
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::reduceData(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  // The estimator data on the root process will change
+  if( comm.rank() == root_process )
+    d_number_of_checked_histories = 0;
+}
+
+// Get a description of the criterion
+std::string StatisticalPrecisionParticleHistorySimulationCompletionCriterion::description() const
+{
+  std::ostringstream oss;
+
+  oss << "statistical precision targets met (";
+
+  for( size_t i = 0; i < d_targets.size(); ++i )
+  {
+    if( i != 0 )
+      oss << ", ";
+
+    oss << "estimator " << d_targets[i].estimator->getId();
+
+    if( d_targets[i].total )
+      oss << " total";
+    else
+      oss << " entity " << d_targets[i].entity_id;
+
+    oss << " " << this->getMetricName( d_targets[i].metric ) << " <= "
+        << d_targets[i].tolerance;
+  }
+
+  oss << ") && histories >= " << d_min_number_of_histories;
+
+  return oss.str();
+}
+
+// Return the precision metric name
+std::string StatisticalPrecisionParticleHistorySimulationCompletionCriterion::getMetricName(
+                                                 const PrecisionMetric metric )
+{
+  switch( metric )
+  {
+    case RELATIVE_ERROR_METRIC: return "re";
+    case VARIANCE_OF_VARIANCE_METRIC: return "vov";
+    case FIGURE_OF_MERIT_STABILITY_METRIC: return "fom change";
+    default: return "unknown";
+  }
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( StatisticalPrecisionParticleHistorySimulationCompletionCriterion, MonteCarlo );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::StatisticalPrecisionParticleHistorySimulationCompletionCriterion );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
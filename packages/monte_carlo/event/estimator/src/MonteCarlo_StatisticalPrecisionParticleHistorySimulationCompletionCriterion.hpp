@@ -0,0 +1,244 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.hpp
+//! \author Alex Robinson
+//! \brief  The statistical precision particle history simulation completion
+//!         criterion class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_STATISTICAL_PRECISION_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+#define MONTE_CARLO_STATISTICAL_PRECISION_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <string>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The statistical precision particle history simulation completion criterion
+ * \details The simulation will be complete once every precision target has
+ * been met. A precision target is a set of bins of an estimator entity (or
+ * of the estimator total) and a tolerance on the relative error, the relative
+ * variance of the variance or the relative change in the figure of merit
+ * between consecutive checks. A bin without any score will never meet its
+ * target. The number of histories and the elapsed time used to process the
+ * estimator moments are retrieved from the particle history observer (the
+ * MonteCarlo::EventHandler updates them before every check). The bin data is
+ * only processed when the number of histories has changed since the last
+ * check, which happens at batch boundaries in the standard particle
+ * simulation manager and at rendezvous boundaries in the distributed
+ * particle simulation managers (only the root process, which holds the
+ * reduced estimator data, checks the criterion before stopping every
+ * worker). If no targets have been added the simulation will never be
+ * complete, which is why this criterion should usually be combined with a
+ * history count or wall time criterion (using the || operator).
+ */
+class StatisticalPrecisionParticleHistorySimulationCompletionCriterion : public ParticleHistorySimulationCompletionCriterion
+{
+
+public:
+
+  //! The precision metrics
+  enum PrecisionMetric{
+    RELATIVE_ERROR_METRIC = 0,
+    VARIANCE_OF_VARIANCE_METRIC,
+    FIGURE_OF_MERIT_STABILITY_METRIC
+  };
+
+  //! Constructor
+  StatisticalPrecisionParticleHistorySimulationCompletionCriterion(
+                                    const uint64_t min_number_of_histories );
+
+  //! Destructor
+  ~StatisticalPrecisionParticleHistorySimulationCompletionCriterion()
+  { /* ... */ }
+
+  //! Add a precision target for the bins of an estimator entity
+  void addEntityBinTarget( const std::shared_ptr<const Estimator>& estimator,
+                           const Estimator::EntityId entity_id,
+                           const std::vector<size_t>& bin_indices,
+                           const PrecisionMetric metric,
+                           const double tolerance );
+
+  //! Add a precision target for the total bins of an estimator
+  void addTotalBinTarget( const std::shared_ptr<const Estimator>& estimator,
+                          const std::vector<size_t>& bin_indices,
+                          const PrecisionMetric metric,
+                          const double tolerance );
+
+  //! Return the number of precision targets
+  size_t getNumberOfTargets() const;
+
+  //! Return the min number of histories
+  uint64_t getMinNumberOfHistories() const;
+
+  //! Check if the simulation is complete
+  bool isSimulationComplete() const final override;
+
+  //! Start the criterion
+  void start() final override;
+
+  //! Stop the criterion
+  void stop() final override;
+
+  //! Clear cached criterion data
+  void clearCache() final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit the contribution from the current history to the observer
+  void commitHistoryContribution() final override;
+
+  //! Reset the observer data
+  void resetData() final override;
+
+  //! Reduce the object data on all processes in comm and collect on root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Get a description of the criterion
+  std::string description() const final override;
+
+private:
+
+  // The precision target
+  struct PrecisionTarget
+  {
+    // The estimator
+    std::shared_ptr<const Estimator> estimator;
+
+    // Records if the target is on the total bins
+    bool total;
+
+    // The entity id (ignored if the target is on the total bins)
+    Estimator::EntityId entity_id;
+
+    // The bin indices (an empty array indicates all bins)
+    std::vector<size_t> bin_indices;
+
+    // The precision metric
+    PrecisionMetric metric;
+
+    // The tolerance
+    double tolerance;
+
+    // Serialize the target
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( estimator );
+      ar & BOOST_SERIALIZATION_NVP( total );
+      ar & BOOST_SERIALIZATION_NVP( entity_id );
+      ar & BOOST_SERIALIZATION_NVP( bin_indices );
+      ar & BOOST_SERIALIZATION_NVP( metric );
+      ar & BOOST_SERIALIZATION_NVP( tolerance );
+    }
+  };
+
+  // Default constructor
+  StatisticalPrecisionParticleHistorySimulationCompletionCriterion();
+
+  // Add a precision target
+  void addTarget( const std::shared_ptr<const Estimator>& estimator,
+                  const bool total,
+                  const Estimator::EntityId entity_id,
+                  const std::vector<size_t>& bin_indices,
+                  const PrecisionMetric metric,
+                  const double tolerance );
+
+  // Check if a precision target has been met
+  bool isTargetMet( const size_t target_index,
+                    const uint64_t num_histories,
+                    const double elapsed_time ) const;
+
+  // Return the precision metric name
+  static std::string getMetricName( const PrecisionMetric metric );
+
+  // Save the completion criterion
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the completion criterion
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The min number of histories
+  uint64_t d_min_number_of_histories;
+
+  // The precision targets
+  std::vector<PrecisionTarget> d_targets;
+
+  // The number of histories at the last check
+  mutable uint64_t d_number_of_checked_histories;
+
+  // The result of the last check
+  mutable bool d_targets_met;
+
+  // The figures of merit of the target bins at the last check
+  mutable std::vector<std::vector<double> > d_previous_figures_of_merit;
+};
+
+// Save the completion criterion
+template<typename Archive>
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Save the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_min_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_targets );
+
+  // The cached check data will not be saved - it will be recreated during
+  // the first check after the load
+}
+
+// Load the completion criterion
+template<typename Archive>
+void StatisticalPrecisionParticleHistorySimulationCompletionCriterion::load( Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_min_number_of_histories );
+  ar & BOOST_SERIALIZATION_NVP( d_targets );
+
+  d_previous_figures_of_merit.resize( d_targets.size() );
+
+  this->clearCache();
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( StatisticalPrecisionParticleHistorySimulationCompletionCriterion, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( StatisticalPrecisionParticleHistorySimulationCompletionCriterion, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, StatisticalPrecisionParticleHistorySimulationCompletionCriterion );
+
+#endif // end MONTE_CARLO_STATISTICAL_PRECISION_PARTICLE_HISTORY_SIMULATION_COMPLETION_CRITERION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.hpp
+//---------------------------------------------------------------------------//
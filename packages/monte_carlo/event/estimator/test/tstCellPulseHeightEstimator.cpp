@@ -592,6 +592,60 @@ FRENSIE_UNIT_TEST( CellPulseHeightEstimator,
                        std::vector<double>( {0.0, 1.0*threads} ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that only the cells updated by a history contribute to the estimator
+FRENSIE_UNIT_TEST( CellPulseHeightEstimator,
+                   commitHistoryContribution_updated_cells )
+{
+  // Use sparse cell ids
+  std::shared_ptr<MonteCarlo::CellPulseHeightEstimator<MonteCarlo::WeightMultiplier> >
+    estimator( new MonteCarlo::CellPulseHeightEstimator<MonteCarlo::WeightMultiplier>(
+                                                                0ull,
+                                                                1.0,
+                                                                {7, 1000} ) );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                         std::vector<double>( {0.0, 0.1, 1.0} ) );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setSourceWeight( 1.0 );
+  particle.setWeight( 1.0 );
+
+  // The first history only deposits energy in cell 1000
+  particle.setEnergy( 1.0 );
+
+  estimator->updateFromParticleEnteringCellEvent( particle, 1000 );
+
+  particle.setEnergy( 0.5 );
+
+  estimator->updateFromParticleLeavingCellEvent( particle, 1000 );
+
+  estimator->commitHistoryContribution();
+
+  // The second history only deposits energy in cell 7
+  particle.setEnergy( 0.05 );
+
+  estimator->updateFromParticleEnteringCellEvent( particle, 7 );
+
+  estimator->commitHistoryContribution();
+
+  // The third history deposits an energy outside of the energy bins
+  particle.setEnergy( 2.0 );
+
+  estimator->updateFromParticleEnteringCellEvent( particle, 7 );
+
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 7 ),
+                       std::vector<double>( {1.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1000 ),
+                       std::vector<double>( {0.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       std::vector<double>( {1.0, 1.0} ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that an estimator can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceCurrentEstimator,
@@ -1418,6 +1418,30 @@ FRENSIE_UNIT_TEST( EntityEstimator,
   FRENSIE_CHECK_EQUAL( vov, std::vector<double>( 24, 0.0 ) );
   FRENSIE_CHECK_EQUAL( fom, std::vector<double>( 24, 1.0/1.5 ) );
 
+  // Check that the processed data can be written to preallocated arrays
+  std::vector<double> mean_array( 24 ), relative_error_array( 24 ),
+    vov_array( 24 ), fom_array( 24 );
+
+  entity_estimator->getTotalBinProcessedData(
+                                  Utility::arrayView( mean_array ),
+                                  Utility::arrayView( relative_error_array ),
+                                  Utility::arrayView( vov_array ),
+                                  Utility::arrayView( fom_array ) );
+
+  FRENSIE_CHECK_EQUAL( mean_array, mean );
+  FRENSIE_CHECK_EQUAL( relative_error_array, relative_error );
+  FRENSIE_CHECK_EQUAL( vov_array, vov );
+  FRENSIE_CHECK_EQUAL( fom_array, fom );
+
+  std::vector<double> too_small_array( 23 );
+
+  FRENSIE_CHECK_THROW( entity_estimator->getTotalBinProcessedData(
+                                  Utility::arrayView( too_small_array ),
+                                  Utility::arrayView( relative_error_array ),
+                                  Utility::arrayView( vov_array ),
+                                  Utility::arrayView( fom_array ) ),
+                       std::runtime_error );
+
   // Check the entity bin histograms
   Utility::SampleMomentHistogram<double> histogram;
 
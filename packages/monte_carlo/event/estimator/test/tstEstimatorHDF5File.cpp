@@ -0,0 +1,240 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstEstimatorHDF5File.cpp
+//! \author Alex Robinson
+//! \brief  Estimator HDF5 file writer and reader unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_EstimatorHDF5FileWriter.hpp"
+#include "MonteCarlo_EstimatorHDF5FileReader.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "FRENSIE_config.hpp"
+
+#ifdef HAVE_FRENSIE_HDF5
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with committed history contributions
+std::shared_ptr<MonteCarlo::Estimator> createEstimator(
+                                      const MonteCarlo::Estimator::Id id )
+{
+  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>
+    cell_ids( {0, 1} );
+
+  std::vector<double> cell_norm_consts( {1.0, 2.0} );
+
+  std::shared_ptr<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier> >
+    estimator( new MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                          id,
+                                                          10.0,
+                                                          cell_ids,
+                                                          cell_norm_consts ) );
+
+  std::vector<double> energy_bin_boundaries( {0.0, 0.1, 1.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  std::vector<double> time_bin_boundaries( {0.0, 1.0, 2.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_TIME_DIMENSION>(
+                                                         time_bin_boundaries );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+  MonteCarlo::ElectronState particle( 0ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+  particle.setTime( 2.0 );
+
+  estimator->updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+  estimator->updateFromParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  particle.setEnergy( 0.1 );
+
+  estimator->updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+
+  estimator->commitHistoryContribution();
+
+  particle.setTime( 1.0 );
+  particle.setWeight( 2.0 );
+
+  estimator->updateFromParticleCollidingInCellEvent( particle, 1, 1.0 );
+
+  estimator->commitHistoryContribution();
+
+  return estimator;
+}
+
+// Convert an array view to a vector
+std::vector<double> toVector( const Utility::ArrayView<const double>& view )
+{
+  return std::vector<double>( view.begin(), view.end() );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that an estimator can be written to and read from a file
+FRENSIE_UNIT_TEST( EstimatorHDF5File, write_read )
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator( 3 );
+
+  // Only the root process writes in this test
+  if( Utility::Communicator::getDefault()->rank() == 0 )
+  {
+    Utility::HDF5File::CompressionFilter filter =
+      Utility::HDF5File::isCompressionFilterAvailable( Utility::HDF5File::GZIP_COMPRESSION ) ?
+      Utility::HDF5File::GZIP_COMPRESSION : Utility::HDF5File::NO_COMPRESSION;
+
+    {
+      MonteCarlo::EstimatorHDF5FileWriter writer( "test_estimator_file.h5",
+                                                  true,
+                                                  4,
+                                                  filter,
+                                                  true );
+
+      FRENSIE_CHECK_EQUAL( writer.getFileName().string(),
+                           "test_estimator_file.h5" );
+      FRENSIE_CHECK_EQUAL( writer.getChunkSize(), 4 );
+      FRENSIE_CHECK_EQUAL( writer.getCompressionFilter(), filter );
+      FRENSIE_CHECK( writer.isShuffleFilterUsed() );
+
+      FRENSIE_REQUIRE_NO_THROW( writer.writeEstimator( *estimator ) );
+
+      // An estimator can only be written once
+      FRENSIE_CHECK_THROW( writer.writeEstimator( *estimator ),
+                           std::runtime_error );
+    }
+
+    MonteCarlo::EstimatorHDF5FileReader reader( "test_estimator_file.h5" );
+
+    std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+    reader.getEstimatorIds( estimator_ids );
+
+    FRENSIE_CHECK_EQUAL( estimator_ids, std::set<MonteCarlo::Estimator::Id>( {3} ) );
+    FRENSIE_CHECK( reader.doesEstimatorExist( 3 ) );
+    FRENSIE_CHECK( !reader.doesEstimatorExist( 0 ) );
+    FRENSIE_CHECK_THROW( reader.getMultiplier( 0 ), std::runtime_error );
+
+    // Check the bin layout
+    FRENSIE_CHECK_EQUAL( reader.getMultiplier( 3 ), 10.0 );
+    FRENSIE_CHECK_EQUAL( reader.getEntityType( 3 ), "cell" );
+    FRENSIE_CHECK_EQUAL( reader.getNumberOfResponseFunctions( 3 ), 1 );
+    FRENSIE_CHECK_EQUAL( reader.getNumberOfBins( 3 ), 4 );
+
+    std::vector<MonteCarlo::ObserverPhaseSpaceDimension> discretized_dimensions;
+
+    reader.getDiscretizedDimensions( 3, discretized_dimensions );
+
+    FRENSIE_CHECK_EQUAL( discretized_dimensions,
+                         std::vector<MonteCarlo::ObserverPhaseSpaceDimension>( {MonteCarlo::OBSERVER_ENERGY_DIMENSION, MonteCarlo::OBSERVER_TIME_DIMENSION} ) );
+
+    std::vector<size_t> dimension_bins;
+
+    reader.getDimensionNumberOfBins( 3, dimension_bins );
+
+    FRENSIE_CHECK_EQUAL( dimension_bins, std::vector<size_t>( {2, 2} ) );
+
+    // Check the entity data
+    FRENSIE_CHECK_EQUAL( reader.getTotalNormConstant( 3 ),
+                         estimator->getTotalNormConstant() );
+
+    std::vector<MonteCarlo::Estimator::EntityId> entity_ids;
+
+    reader.getEntityIds( 3, entity_ids );
+
+    FRENSIE_CHECK_EQUAL( entity_ids,
+                         std::vector<MonteCarlo::Estimator::EntityId>( {0, 1} ) );
+    FRENSIE_CHECK_EQUAL( reader.getEntityNormConstant( 3, 0 ), 1.0 );
+    FRENSIE_CHECK_EQUAL( reader.getEntityNormConstant( 3, 1 ), 2.0 );
+    FRENSIE_CHECK_THROW( reader.getEntityNormConstant( 3, 2 ),
+                         std::runtime_error );
+
+    // Check the moments
+    FRENSIE_REQUIRE( reader.isTotalDataAvailable( 3 ) );
+
+    std::vector<double> moments;
+
+    reader.getTotalBinDataMoments( 3, 1, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getTotalBinDataFirstMoments() ) );
+
+    reader.getTotalBinDataMoments( 3, 4, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getTotalBinDataFourthMoments() ) );
+
+    reader.getEntityBinDataMoments( 3, 0, 2, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getEntityBinDataSecondMoments( 0 ) ) );
+
+    reader.getEntityBinDataMoments( 3, 1, 3, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getEntityBinDataThirdMoments( 1 ) ) );
+
+    reader.getTotalDataMoments( 3, 1, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getTotalDataFirstMoments() ) );
+
+    reader.getEntityTotalDataMoments( 3, 1, 2, moments );
+    FRENSIE_CHECK_EQUAL( moments, toVector( estimator->getEntityTotalDataSecondMoments( 1 ) ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimators of every process can be written to one file
+FRENSIE_UNIT_TEST( EstimatorHDF5File, writeEstimators )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Each process owns a single estimator
+  std::vector<std::shared_ptr<const MonteCarlo::Estimator> > estimators(
+                                   1, createEstimator( comm->rank() ) );
+
+  FRENSIE_REQUIRE_NO_THROW( MonteCarlo::EstimatorHDF5FileWriter::writeEstimators( *comm, "test_distributed_estimator_file.h5", estimators, 3 ) );
+
+  if( comm->rank() == 0 )
+  {
+    MonteCarlo::EstimatorHDF5FileReader reader( "test_distributed_estimator_file.h5" );
+
+    std::set<MonteCarlo::Estimator::Id> estimator_ids;
+
+    reader.getEstimatorIds( estimator_ids );
+
+    FRENSIE_CHECK_EQUAL( estimator_ids.size(), comm->size() );
+
+    for( int i = 0; i < comm->size(); ++i )
+    {
+      FRENSIE_REQUIRE( reader.doesEstimatorExist( i ) );
+
+      std::vector<double> moments;
+
+      reader.getEntityBinDataMoments( i, 1, 1, moments );
+
+      FRENSIE_CHECK_EQUAL( moments, toVector( estimators.front()->getEntityBinDataFirstMoments( 1 ) ) );
+    }
+  }
+
+  comm->barrier();
+
+  // Every process fails if an estimator is owned by more than one process
+  if( comm->size() > 1 )
+  {
+    estimators.front() = createEstimator( 0 );
+
+    FRENSIE_CHECK_THROW( MonteCarlo::EstimatorHDF5FileWriter::writeEstimators( *comm, "test_distributed_estimator_file.h5", estimators ),
+                         std::runtime_error );
+  }
+}
+
+#endif // end HAVE_FRENSIE_HDF5
+
+//---------------------------------------------------------------------------//
+// end tstEstimatorHDF5File.cpp
+//---------------------------------------------------------------------------//
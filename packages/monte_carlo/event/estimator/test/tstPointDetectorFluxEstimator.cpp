@@ -0,0 +1,419 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPointDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef std::tuple<MonteCarlo::WeightMultiplier,
+                   MonteCarlo::WeightAndEnergyMultiplier,
+                   MonteCarlo::WeightAndChargeMultiplier
+                  > MultiplierPolicies;
+
+typedef MonteCarlo::WeightMultipliedPointDetectorFluxEstimator
+EstimatorType;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with detectors at (2,0,0) and (0,0,1)
+std::shared_ptr<EstimatorType> createEstimator()
+{
+  std::vector<EstimatorType::DetectorPoint> detector_points( 2 );
+  detector_points[0] = {2.0, 0.0, 0.0};
+  detector_points[1] = {0.0, 0.0, 1.0};
+
+  std::shared_ptr<EstimatorType> estimator(
+                                new EstimatorType( 0u, 1.0, detector_points ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+  return estimator;
+}
+
+// Create a photon at the origin traveling in the +z direction
+void initializePhoton( MonteCarlo::PhotonState& photon )
+{
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setEnergy( 1.0 );
+  photon.setWeight( 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the estimator is not a cell, surface or mesh estimator
+FRENSIE_UNIT_TEST_TEMPLATE( PointDetectorFluxEstimator,
+                            check_type,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::vector<std::array<double,3> > detector_points( 1 );
+  detector_points[0] = {1.0, 1.0, 1.0};
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::PointDetectorFluxEstimator<ContributionMultiplierPolicy>(
+                                                          0u,
+                                                          1.0,
+                                                          detector_points ) );
+
+  FRENSIE_CHECK( !estimator->isCellEstimator() );
+  FRENSIE_CHECK( !estimator->isSurfaceEstimator() );
+  FRENSIE_CHECK( !estimator->isMeshEstimator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the detectors are the estimator entities
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, getDetectorPoint )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfDetectors(), 2 );
+  FRENSIE_CHECK( estimator->isEntityAssigned( 0 ) );
+  FRENSIE_CHECK( estimator->isEntityAssigned( 1 ) );
+  FRENSIE_CHECK( !estimator->isEntityAssigned( 2 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityNormConstant( 0 ), 1.0 );
+
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorPoint( 0 ),
+                       (std::array<double,3>({2.0, 0.0, 0.0})) );
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorPoint( 1 ),
+                       (std::array<double,3>({0.0, 0.0, 1.0})) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the exclusion radius and roulette threshold can be set
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, variance_reduction_parameters )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  FRENSIE_CHECK_EQUAL( estimator->getExclusionRadius(), 0.0 );
+  FRENSIE_CHECK_EQUAL( estimator->getRussianRouletteThreshold(), 0.0 );
+
+  estimator->setExclusionRadius( 0.5 );
+  estimator->setRussianRouletteThreshold( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( estimator->getExclusionRadius(), 0.5 );
+  FRENSIE_CHECK_EQUAL( estimator->getRussianRouletteThreshold(), 1e-3 );
+
+  FRENSIE_CHECK_THROW( estimator->setExclusionRadius( -1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( estimator->setRussianRouletteThreshold( -1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the emission pdf evaluators can be set
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, emission_pdf_evaluators )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  // There is no default collision emission pdf
+  FRENSIE_CHECK( !estimator->hasCollisionEmissionPDFEvaluator() );
+  FRENSIE_CHECK( !estimator->hasSourceEmissionPDFEvaluator() );
+
+  estimator->setCollisionEmissionPDFEvaluator(
+     EstimatorType::createAzimuthallySymmetricEmissionPDFEvaluator(
+         []( const double, const double ){ return 0.5; } ) );
+
+  FRENSIE_CHECK( estimator->hasCollisionEmissionPDFEvaluator() );
+  FRENSIE_CHECK( !estimator->hasSourceEmissionPDFEvaluator() );
+
+  estimator->setSourceEmissionPDFEvaluator(
+     EstimatorType::createAzimuthallySymmetricEmissionPDFEvaluator(
+         []( const double, const double ){ return 0.5; } ) );
+
+  FRENSIE_CHECK( estimator->hasSourceEmissionPDFEvaluator() );
+  FRENSIE_CHECK( !estimator->hasSecondaryEmissionPDFEvaluator() );
+
+  estimator->setSecondaryEmissionPDFEvaluator(
+     EstimatorType::createAzimuthallySymmetricEmissionPDFEvaluator(
+         []( const double, const double ){ return 0.5; } ) );
+
+  FRENSIE_CHECK( estimator->hasSecondaryEmissionPDFEvaluator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that isotropic source emission contributions are scored
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleSourceEmissionEvent )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          1.0/(four_pi*4.0),
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          1.0/four_pi,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that secondary emission contributions are scored
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleSecondaryEmissionEvent )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  // Secondary emission is isotropic by default
+  estimator->updateFromGlobalParticleSecondaryEmissionEvent( photon );
+
+  // Only the new secondary emission pdf is used
+  estimator->setSecondaryEmissionPDFEvaluator(
+        []( const MonteCarlo::ParticleState& particle, const double[3],
+            EstimatorType::EmissionPDFArray& emission_pdfs )
+        {
+          emission_pdfs.push_back( std::make_pair( 0.5, particle.getEnergy() ) );
+        } );
+
+  estimator->updateFromGlobalParticleSecondaryEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          (1.0/four_pi + 0.5)/4.0,
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          1.0/four_pi + 0.5,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the contributions are attenuated
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, attenuation )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  estimator->setTotalCrossSectionEvaluator(
+          []( const MonteCarlo::ParticleType, const Geometry::Model::EntityId,
+              const double ){ return 0.5; } );
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  // The second event reuses the cached ray segments
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          2*std::exp( -1.0 )/(four_pi*4.0),
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          2*std::exp( -0.5 )/four_pi,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that collision contributions use the collision emission pdf
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleCollidingEvent )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  // Linearly anisotropic scattering: p(mu) = (1+mu)/2
+  estimator->setCollisionEmissionPDFEvaluator(
+     EstimatorType::createAzimuthallySymmetricEmissionPDFEvaluator(
+         []( const double, const double mu ){ return (1.0+mu)/2; } ) );
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  estimator->updateFromGlobalParticleCollidingEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double two_pi = 2*Utility::PhysicalConstants::pi;
+
+  // mu = 0 for the first detector and mu = 1 for the second detector
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          0.5/(two_pi*4.0),
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          1.0/two_pi,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that each collision emission pdf is scored at its own energy
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleCollidingEvent_multiple_pdfs )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  estimator->setCollisionEmissionPDFEvaluator(
+        []( const MonteCarlo::ParticleState&, const double[3],
+            EstimatorType::EmissionPDFArray& emission_pdfs )
+        {
+          emission_pdfs.push_back( std::make_pair( 0.1, 1.0 ) );
+          emission_pdfs.push_back( std::make_pair( 0.2, 0.5 ) );
+        } );
+
+  // The total cross section is equal to the energy
+  estimator->setTotalCrossSectionEvaluator(
+          []( const MonteCarlo::ParticleType, const Geometry::Model::EntityId,
+              const double energy ){ return energy; } );
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  estimator->updateFromGlobalParticleCollidingEvent( photon );
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          (0.1*std::exp( -2.0 ) + 0.2*std::exp( -1.0 ))/4.0,
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          0.1*std::exp( -1.0 ) + 0.2*std::exp( -0.5 ),
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the exclusion radius bounds the contributions
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, exclusion_radius )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  estimator->setExclusionRadius( 1.5 );
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          1.0/(four_pi*4.0),
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          1.0/(four_pi*2.25),
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that tiny contributions are rouletted without using the transport
+// random number stream
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, russian_roulette )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  // Only the contribution to the first detector is below the threshold
+  estimator->setRussianRouletteThreshold( 0.05 );
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.25;
+  fake_stream[1] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  const size_t number_of_histories = 10000;
+
+  for( size_t i = 0; i < number_of_histories; ++i )
+  {
+    MonteCarlo::PhotonState photon( i );
+    initializePhoton( photon );
+
+    estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+    estimator->commitHistoryContribution();
+  }
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  // The rouletted contributions are unbiased
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+           estimator->getEntityBinDataFirstMoments( 0 )[0]/number_of_histories,
+           1.0/(four_pi*4.0),
+           0.05 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+           estimator->getEntityBinDataFirstMoments( 1 )[0]/number_of_histories,
+           1.0/four_pi,
+           1e-12 );
+
+  // The contributions of a history don't depend on the previous histories
+  std::shared_ptr<EstimatorType> reversed_estimator = createEstimator();
+
+  reversed_estimator->setRussianRouletteThreshold( 0.05 );
+
+  for( size_t i = number_of_histories; i > 0; --i )
+  {
+    MonteCarlo::PhotonState photon( i-1 );
+    initializePhoton( photon );
+
+    reversed_estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+    reversed_estimator->commitHistoryContribution();
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                  reversed_estimator->getEntityBinDataFirstMoments( 0 )[0],
+                  estimator->getEntityBinDataFirstMoments( 0 )[0],
+                  1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPointDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
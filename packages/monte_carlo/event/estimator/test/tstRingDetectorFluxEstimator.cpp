@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstRingDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  Ring detector flux estimator unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_RingDetectorFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef std::tuple<MonteCarlo::WeightMultiplier,
+                   MonteCarlo::WeightAndEnergyMultiplier,
+                   MonteCarlo::WeightAndChargeMultiplier
+                  > MultiplierPolicies;
+
+typedef MonteCarlo::WeightMultipliedRingDetectorFluxEstimator
+EstimatorType;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with z-axis rings at z=0 and z=1 (both with radius 1)
+std::shared_ptr<EstimatorType> createEstimator()
+{
+  std::vector<EstimatorType::DetectorRing> detector_rings( 2 );
+  detector_rings[0] = std::make_pair( 0.0, 1.0 );
+  detector_rings[1] = std::make_pair( 1.0, 1.0 );
+
+  std::shared_ptr<EstimatorType> estimator(
+                new EstimatorType( 0u, 1.0, Utility::Z_AXIS, detector_rings ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+  return estimator;
+}
+
+// Create a photon at the origin traveling in the +z direction
+void initializePhoton( MonteCarlo::PhotonState& photon )
+{
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.setEnergy( 1.0 );
+  photon.setWeight( 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the estimator is not a cell, surface or mesh estimator
+FRENSIE_UNIT_TEST_TEMPLATE( RingDetectorFluxEstimator,
+                            check_type,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::vector<std::pair<double,double> > detector_rings( 1 );
+  detector_rings[0] = std::make_pair( 1.0, 2.0 );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::RingDetectorFluxEstimator<ContributionMultiplierPolicy>(
+                                                          0u,
+                                                          1.0,
+                                                          Utility::X_AXIS,
+                                                          detector_rings ) );
+
+  FRENSIE_CHECK( !estimator->isCellEstimator() );
+  FRENSIE_CHECK( !estimator->isSurfaceEstimator() );
+  FRENSIE_CHECK( !estimator->isMeshEstimator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the detector rings can be returned
+FRENSIE_UNIT_TEST( RingDetectorFluxEstimator, getDetectorRing )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  FRENSIE_CHECK_EQUAL( estimator->getAxis(), Utility::Z_AXIS );
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfDetectors(), 2 );
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorRing( 0 ),
+                       std::make_pair( 0.0, 1.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorRing( 1 ),
+                       std::make_pair( 1.0, 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid rings are rejected
+FRENSIE_UNIT_TEST( RingDetectorFluxEstimator, constructor_invalid )
+{
+  std::vector<EstimatorType::DetectorRing> detector_rings( 1 );
+  detector_rings[0] = std::make_pair( 0.0, 0.0 );
+
+  FRENSIE_CHECK_THROW( EstimatorType( 0u, 1.0, Utility::Z_AXIS, detector_rings ),
+                       std::runtime_error );
+
+  detector_rings[0] = std::make_pair( 0.0, 1.0 );
+
+  FRENSIE_CHECK_THROW( EstimatorType( 0u, 1.0, Utility::UNDEFINED_AXIS, detector_rings ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that isotropic source emission contributions are scored
+FRENSIE_UNIT_TEST( RingDetectorFluxEstimator,
+                   updateFromGlobalParticleSourceEmissionEvent )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  // Every point on a ring is equidistant from a particle on the axis
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          2.0/four_pi,
+                          1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 1 )[0],
+                          2.0/(four_pi*2.0),
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the ring points are sampled without using the transport random
+// number stream
+FRENSIE_UNIT_TEST( RingDetectorFluxEstimator,
+                   sampleDetectorPoint_transport_stream )
+{
+  std::shared_ptr<EstimatorType> estimator = createEstimator();
+
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.25;
+  fake_stream[1] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhotonState photon( 0 );
+  initializePhoton( photon );
+
+  estimator->updateFromGlobalParticleSourceEmissionEvent( photon );
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       0.25 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  const double four_pi = 4*Utility::PhysicalConstants::pi;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          estimator->getEntityBinDataFirstMoments( 0 )[0],
+                          1.0/four_pi,
+                          1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstRingDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
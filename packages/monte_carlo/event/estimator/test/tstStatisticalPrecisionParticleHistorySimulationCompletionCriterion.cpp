@@ -0,0 +1,343 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstStatisticalPrecisionParticleHistorySimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  Statistical precision particle history simulation completion
+//!         criterion unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_StatisticalPrecisionParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+typedef MonteCarlo::StatisticalPrecisionParticleHistorySimulationCompletionCriterion
+StatisticalPrecisionCriterion;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with two committed histories in cell 0
+std::shared_ptr<MonteCarlo::Estimator> createEstimator()
+{
+  std::vector<MonteCarlo::StandardCellEstimator::CellIdType>
+    cell_ids( {0, 1} );
+
+  std::vector<double> cell_norm_consts( {1.0, 1.0} );
+
+  std::shared_ptr<MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier> >
+    estimator( new MonteCarlo::CellCollisionFluxEstimator<MonteCarlo::WeightMultiplier>(
+                                                          0,
+                                                          1.0,
+                                                          cell_ids,
+                                                          cell_norm_consts ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setWeight( 1.0 );
+  particle.setEnergy( 1.0 );
+
+  estimator->updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+  estimator->commitHistoryContribution();
+
+  particle.setWeight( 2.0 );
+
+  estimator->updateFromParticleCollidingInCellEvent( particle, 0, 1.0 );
+  estimator->commitHistoryContribution();
+
+  return estimator;
+}
+
+// Get the relative error, vov and fom of the cell 0 bin
+void getProcessedData( const MonteCarlo::Estimator& estimator,
+                       double& relative_error,
+                       double& variance_of_variance,
+                       double& figure_of_merit )
+{
+  std::vector<double> mean, re, vov, fom;
+
+  estimator.getEntityBinProcessedData( 0, mean, re, vov, fom );
+
+  relative_error = re.front();
+  variance_of_variance = vov.front();
+  figure_of_merit = fom.front();
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that precision targets can be added
+FRENSIE_UNIT_TEST( StatisticalPrecisionParticleHistorySimulationCompletionCriterion,
+                   addTarget )
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator();
+
+  StatisticalPrecisionCriterion criterion( 10 );
+
+  FRENSIE_CHECK_EQUAL( criterion.getMinNumberOfHistories(), 10 );
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 0 );
+
+  FRENSIE_CHECK_NO_THROW( criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.1 ) );
+  FRENSIE_CHECK_NO_THROW( criterion.addTotalBinTarget( estimator, {0}, StatisticalPrecisionCriterion::VARIANCE_OF_VARIANCE_METRIC, 0.1 ) );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 2 );
+
+  // A null estimator cannot be used
+  FRENSIE_CHECK_THROW( criterion.addTotalBinTarget( std::shared_ptr<MonteCarlo::Estimator>(), {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.1 ),
+                       std::runtime_error );
+
+  // The entity must be assigned to the estimator
+  FRENSIE_CHECK_THROW( criterion.addEntityBinTarget( estimator, 2, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.1 ),
+                       std::runtime_error );
+
+  // The bins must be valid
+  FRENSIE_CHECK_THROW( criterion.addEntityBinTarget( estimator, 0, {1}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.1 ),
+                       std::runtime_error );
+
+  // The tolerance must be valid
+  FRENSIE_CHECK_THROW( criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.0 ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( criterion.getNumberOfTargets(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a relative error target can be checked
+FRENSIE_UNIT_TEST( StatisticalPrecisionParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_relative_error )
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  double relative_error, variance_of_variance, figure_of_merit;
+
+  getProcessedData( *estimator,
+                    relative_error,
+                    variance_of_variance,
+                    figure_of_merit );
+
+  // The simulation will never be complete without targets
+  {
+    StatisticalPrecisionCriterion criterion( 0 );
+
+    FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  }
+
+  // The target has been met
+  {
+    StatisticalPrecisionCriterion criterion( 2 );
+
+    criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.01*relative_error );
+
+    FRENSIE_CHECK( criterion.isSimulationComplete() );
+
+    // The total bins include the cell 0 contributions
+    criterion.addTotalBinTarget( estimator, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.01*relative_error );
+
+    FRENSIE_CHECK( criterion.isSimulationComplete() );
+  }
+
+  // The target has not been met
+  {
+    StatisticalPrecisionCriterion criterion( 2 );
+
+    criterion.addEntityBinTarget( estimator, 0, {0}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 0.99*relative_error );
+
+    FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  }
+
+  // The min number of histories has not been reached
+  {
+    StatisticalPrecisionCriterion criterion( 3 );
+
+    criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.01*relative_error );
+
+    FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  }
+
+  // A bin without any score can never meet its target
+  {
+    StatisticalPrecisionCriterion criterion( 2 );
+
+    criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.01*relative_error );
+    criterion.addEntityBinTarget( estimator, 1, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.0 );
+
+    FRENSIE_CHECK( !criterion.isSimulationComplete() );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a variance of variance target can be checked
+FRENSIE_UNIT_TEST( StatisticalPrecisionParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_variance_of_variance )
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  double relative_error, variance_of_variance, figure_of_merit;
+
+  getProcessedData( *estimator,
+                    relative_error,
+                    variance_of_variance,
+                    figure_of_merit );
+
+  StatisticalPrecisionCriterion criterion( 0 );
+
+  criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::VARIANCE_OF_VARIANCE_METRIC, 0.99*variance_of_variance );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  StatisticalPrecisionCriterion loose_criterion( 0 );
+
+  loose_criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::VARIANCE_OF_VARIANCE_METRIC, 1.01*variance_of_variance );
+
+  FRENSIE_CHECK( loose_criterion.isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a figure of merit stability target can be checked
+FRENSIE_UNIT_TEST( StatisticalPrecisionParticleHistorySimulationCompletionCriterion,
+                   isSimulationComplete_figure_of_merit_stability )
+{
+  std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator();
+
+  StatisticalPrecisionCriterion criterion( 0 );
+
+  criterion.addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::FIGURE_OF_MERIT_STABILITY_METRIC, 0.01 );
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  double relative_error, variance_of_variance, figure_of_merit;
+
+  getProcessedData( *estimator,
+                    relative_error,
+                    variance_of_variance,
+                    figure_of_merit );
+
+  // There is no previous figure of merit to compare against
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  // The checked data will only be updated when the histories change
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 2.0 );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  // Choose the elapsed time so that the figure of merit doesn't change
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 3 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  double new_relative_error, new_figure_of_merit;
+
+  getProcessedData( *estimator,
+                    new_relative_error,
+                    variance_of_variance,
+                    new_figure_of_merit );
+
+  const double elapsed_time = new_figure_of_merit/figure_of_merit;
+
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( elapsed_time );
+
+  FRENSIE_CHECK( criterion.isSimulationComplete() );
+
+  // The figure of merit changes by a factor of two
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 4 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  getProcessedData( *estimator,
+                    new_relative_error,
+                    variance_of_variance,
+                    new_figure_of_merit );
+
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 0.5*new_figure_of_merit/figure_of_merit );
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+
+  // Clearing the cache removes the previous figures of merit
+  criterion.clearCache();
+
+  FRENSIE_CHECK( !criterion.isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a criterion can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StatisticalPrecisionParticleHistorySimulationCompletionCriterion,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_statistical_precision_completion_criterion" );
+  std::ostringstream archive_ostream;
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::Estimator> estimator = createEstimator();
+
+    std::shared_ptr<StatisticalPrecisionCriterion>
+      local_criterion( new StatisticalPrecisionCriterion( 2 ) );
+
+    local_criterion->addEntityBinTarget( estimator, 0, {}, StatisticalPrecisionCriterion::RELATIVE_ERROR_METRIC, 1.0 );
+
+    std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+      criterion = local_criterion;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( criterion ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived criterion
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::ParticleHistorySimulationCompletionCriterion>
+    criterion;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( criterion ) );
+
+  iarchive.reset();
+
+  std::shared_ptr<StatisticalPrecisionCriterion> local_criterion =
+    std::dynamic_pointer_cast<StatisticalPrecisionCriterion>( criterion );
+
+  FRENSIE_REQUIRE( local_criterion.get() );
+  FRENSIE_CHECK_EQUAL( local_criterion->getMinNumberOfHistories(), 2 );
+  FRENSIE_CHECK_EQUAL( local_criterion->getNumberOfTargets(), 1 );
+  FRENSIE_CHECK( criterion->isSimulationComplete() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstStatisticalPrecisionParticleHistorySimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
@@ -34,6 +34,10 @@ public:
   virtual bool isForcedCollisionCell( const ParticleType, const CellIdType ) const final override
   { return false; }
 
+  //! Check if the cell containing the particle is a forced collision cell
+  bool isForcedCollisionCell( const ParticleState& ) const final override
+  { return false; }
+
   //! Return the cells where collisions will be forced
   void getCells( const ParticleType, std::set<CellIdType>& ) const final override
   { /* ... */ }
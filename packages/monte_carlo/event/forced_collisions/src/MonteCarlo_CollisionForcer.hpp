@@ -72,6 +72,9 @@ public:
   //! Check if a cell is a forced collision cell
   virtual bool isForcedCollisionCell( const ParticleType particle_type,
                                       const CellIdType cell_id ) const = 0;
+
+  //! Check if the cell containing the particle is a forced collision cell
+  virtual bool isForcedCollisionCell( const ParticleState& particle ) const;
   
   //! Return the cells where collisions will be forced
   virtual void getCells( const ParticleType particle_type,
@@ -115,6 +118,18 @@ inline bool CollisionForcer::isForcedCollisionCell( const CellIdType cell_id ) c
 {
   return this->isForcedCollisionCell( ParticleStateType::type, cell_id );
 }
+
+// Check if the cell containing the particle is a forced collision cell
+/*! \details Derived classes can override this method to take advantage of
+ * the cell index that is cached by the particle (see
+ * MonteCarlo::ParticleState::getCellIndex).
+ */
+inline bool CollisionForcer::isForcedCollisionCell(
+                                          const ParticleState& particle ) const
+{
+  return this->isForcedCollisionCell( particle.getParticleType(),
+                                      particle.getCell() );
+}
   
 } // end MonteCarlo namespace
 
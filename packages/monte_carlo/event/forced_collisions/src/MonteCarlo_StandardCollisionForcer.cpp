@@ -17,7 +17,9 @@ namespace MonteCarlo{
 
 // Default constructor
 StandardCollisionForcer::StandardCollisionForcer()
-  : d_forced_collision_cells()
+  : d_forced_collision_cells(),
+    d_forced_collision_cell_flags( ParticleType_END ),
+    d_generation_probabilities( ParticleType_END, 0.0 )
 { /* ... */ }
 
 // Set the cells where collision will be forced for the specified particle type
@@ -42,6 +44,15 @@ void StandardCollisionForcer::setForcedCollisionCells(
 {
   ForcedCollisionCellData& particle_forced_collision_cell_data =
     d_forced_collision_cells[particle_type];
+
+  std::vector<bool>& particle_forced_collision_cell_flags =
+    d_forced_collision_cell_flags[particle_type];
+
+  const size_t number_of_cells =
+    model.getUnfilledModel().getNumberOfCells();
+
+  if( particle_forced_collision_cell_flags.size() < number_of_cells )
+    particle_forced_collision_cell_flags.resize( number_of_cells, false );
   
   // Make sure that the requested cells are not void
   for( auto cell : cells )
@@ -53,6 +64,8 @@ void StandardCollisionForcer::setForcedCollisionCells(
                         << particle_type << "!" );
 
     Utility::get<0>( particle_forced_collision_cell_data ).insert( cell );
+
+    particle_forced_collision_cell_flags[model.getCellIndex( cell )] = true;
   }
 
   TEST_FOR_EXCEPTION( generation_probability <= 0.0,
@@ -65,6 +78,8 @@ void StandardCollisionForcer::setForcedCollisionCells(
 
   Utility::get<1>( particle_forced_collision_cell_data ) =
     generation_probability;
+
+  d_generation_probabilities[particle_type] = generation_probability;
 }
 
 // Check if forced collision cells have been specified for the particle type
@@ -91,6 +106,33 @@ bool StandardCollisionForcer::isForcedCollisionCell(
   else
     return false;
 }
+
+// Check if the cell containing the particle is a forced collision cell
+/*! \details The cell index cached by the particle will be used to look up
+ * the forced collision cell flag. If the flags are not available (e.g. the
+ * collision forcer was loaded from an old archive) the cell id will be used.
+ */
+bool StandardCollisionForcer::isForcedCollisionCell(
+                                          const ParticleState& particle ) const
+{
+  const std::vector<bool>& particle_forced_collision_cell_flags =
+    d_forced_collision_cell_flags[particle.getParticleType()];
+
+  if( !particle_forced_collision_cell_flags.empty() )
+  {
+    const size_t cell_index = particle.getCellIndex();
+
+    return cell_index < particle_forced_collision_cell_flags.size() &&
+      particle_forced_collision_cell_flags[cell_index];
+  }
+  else if( d_generation_probabilities[particle.getParticleType()] > 0.0 )
+  {
+    return this->isForcedCollisionCell( particle.getParticleType(),
+                                        particle.getCell() );
+  }
+  else
+    return false;
+}
   
 // Return the cells where collisions will be forced
 void StandardCollisionForcer::getCells(
@@ -122,6 +164,23 @@ void StandardCollisionForcer::getParticleTypes(
   }
 }
 
+// Cache the generation probabilities
+void StandardCollisionForcer::cacheGenerationProbabilities()
+{
+  d_generation_probabilities.assign( ParticleType_END, 0.0 );
+
+  ParticleTypeForcedCollisionCellMap::const_iterator particle_type_data_it =
+    d_forced_collision_cells.begin();
+
+  while( particle_type_data_it != d_forced_collision_cells.end() )
+  {
+    d_generation_probabilities[particle_type_data_it->first] =
+      Utility::get<1>( particle_type_data_it->second );
+
+    ++particle_type_data_it;
+  }
+}
+
 // Return the generation probability
 double StandardCollisionForcer::getGenerationProbability(
                                        const ParticleType particle_type ) const
@@ -140,9 +199,11 @@ double StandardCollisionForcer::getGenerationProbability(
  * branch of this track. It must be tracked through the current cell before 
  * a new collision distance is sampled. If a particle for the collided branch 
  * is created (determined by the generation probability specified for this 
- * cell) that particle history will be simulated to the forced collision site
- * and the subsequent collision will be simulated before it and any of its
- * progeny are banked.
+ * cell) it will be added to the bank before its history is simulated to the
+ * forced collision site. The subsequent collision will then be simulated and
+ * any progeny will be added directly to the bank after the collided particle
+ * (assuming that no bank sorting occurs, the collided particle will be 
+ * simulated before its progeny).
  */
 void StandardCollisionForcer::forceCollision(
           const CellIdType cell_entering,
@@ -157,14 +218,14 @@ void StandardCollisionForcer::forceCollision(
   // Make sure that the optical path to the next cell is valid
   testPrecondition( optical_path_to_next_cell > 0.0 );
 
-  const ForcedCollisionCellData& particle_forced_collision_cell_data =
-    d_forced_collision_cells.find( particle.getParticleType() )->second;
+  const double generation_probability =
+    d_generation_probabilities[particle.getParticleType()];
 
   // Clone the particle before updating its weight
   std::shared_ptr<ParticleState> collided_particle;
 
   if( Utility::RandomNumberGenerator::getRandomNumber<double>() <=
-      Utility::get<1>( particle_forced_collision_cell_data ) )
+      generation_probability )
     collided_particle.reset( particle.clone() );
 
   // Calculate the probability that a collision does not occur in the
@@ -180,27 +241,23 @@ void StandardCollisionForcer::forceCollision(
   {
     // Update the collided particle weight by the probability that the
     // particle does collide
-    collided_particle->multiplyWeight( (1.0 - pass_through_probability)/Utility::get<1>( particle_forced_collision_cell_data ) );
+    collided_particle->multiplyWeight( (1.0 - pass_through_probability)/generation_probability );
     
     // Sample the optical path to the collision within the current cell
     const double optical_path_to_forced_collision =
       -std::log( 1.0 - Utility::RandomNumberGenerator::getRandomNumber<double>()*(1.0 - pass_through_probability) );
 
-    ParticleBank local_bank;
+    // The bank will take the collided particle pointer since it is unique
+    // (the particle will continue to be simulated through the raw pointer)
+    ParticleState* collided_particle_ptr = collided_particle.get();
+
+    bank.push( collided_particle );
 
     // Simulate the collided particle track to the sampled collision sight
     // and then undergo a collision
-    simulate_particle_track_method( *collided_particle,
-                                    local_bank,
+    simulate_particle_track_method( *collided_particle_ptr,
+                                    bank,
                                     optical_path_to_forced_collision );
-
-    // Add the collided particle to the bank
-    bank.push( collided_particle );
-
-    // Add the local bank to the bank (doing this last ensures that the
-    // collided particle will be simulated before its progeny, assuming
-    // that no bank sorting occurs)
-    bank.splice( local_bank );
   }
 }
   
@@ -19,7 +19,12 @@
 
 namespace MonteCarlo{
 
-//! The collision forcer class
+/*! The collision forcer class
+ * \details The forced collision cells of each particle type are also stored
+ * as flags indexed by the cell index (see Geometry::Model::getCellIndex) so
+ * that the cell containing a particle can be checked without any map
+ * lookups (see MonteCarlo::ParticleState::getCellIndex).
+ */
 class StandardCollisionForcer : public CollisionForcer
 {
 
@@ -58,6 +63,9 @@ public:
   bool isForcedCollisionCell( const ParticleType particle_type,
                               const CellIdType cell_id ) const final override;
 
+  //! Check if the cell containing the particle is a forced collision cell
+  bool isForcedCollisionCell( const ParticleState& particle ) const final override;
+
   //! Return the cells where collisions will be forced
   void getCells( const ParticleType particle_type,
                  std::set<CellIdType>& cells_set ) const final override;
@@ -78,6 +86,9 @@ public:
 
 private:
 
+  // Cache the generation probabilities
+  void cacheGenerationProbabilities();
+
   // Save the collision forcer data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -95,6 +106,14 @@ private:
   typedef std::pair<std::unordered_set<CellIdType>,double> ForcedCollisionCellData;
   typedef std::map<ParticleType,ForcedCollisionCellData> ParticleTypeForcedCollisionCellMap;
   ParticleTypeForcedCollisionCellMap d_forced_collision_cells;
+
+  // The forced collision cell flags of each particle type (indexed by
+  // particle type and then by cell index)
+  std::vector<std::vector<bool> > d_forced_collision_cell_flags;
+
+  // The generation probability of each particle type (indexed by particle
+  // type - zero if collisions are not forced for the particle type)
+  std::vector<double> d_generation_probabilities;
 };
 
 // Save the collision forcer data to an archive
@@ -103,6 +122,7 @@ void StandardCollisionForcer::save( Archive& ar, const unsigned version ) const
 {
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( CollisionForcer );
   ar & BOOST_SERIALIZATION_NVP( d_forced_collision_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_forced_collision_cell_flags );
 }
 
 // Load the collision forcer data from an archive
@@ -111,11 +131,23 @@ void StandardCollisionForcer::load( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( CollisionForcer );
   ar & BOOST_SERIALIZATION_NVP( d_forced_collision_cells );
+
+  // Archives created before the cell flags were added do not have the cell
+  // indices - the cell ids will be used instead
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_forced_collision_cell_flags );
+  else
+  {
+    d_forced_collision_cell_flags.clear();
+    d_forced_collision_cell_flags.resize( ParticleType_END );
+  }
+
+  this->cacheGenerationProbabilities();
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( StandardCollisionForcer, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( StandardCollisionForcer, MonteCarlo, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( StandardCollisionForcer, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, StandardCollisionForcer );
 
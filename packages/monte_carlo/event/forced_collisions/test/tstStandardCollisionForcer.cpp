@@ -219,6 +219,46 @@ FRENSIE_UNIT_TEST( StandardCollisionForcer,
   FRENSIE_CHECK( particle_types.count( MonteCarlo::POSITRON ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check if the cell containing a particle is a forced collision cell
+FRENSIE_UNIT_TEST( StandardCollisionForcer,
+                   isForcedCollisionCell_particle )
+{
+  std::shared_ptr<MonteCarlo::StandardCollisionForcer>
+    collision_forcer( new MonteCarlo::StandardCollisionForcer );
+
+  std::shared_ptr<const MonteCarlo::CollisionForcer> base_collision_forcer =
+    collision_forcer;
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+  photon.embedInModel( *filled_model );
+
+  MonteCarlo::NeutronState neutron( 0 );
+  neutron.setEnergy( 1.0 );
+  neutron.setPosition( 0.0, 0.0, 0.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.embedInModel( *filled_model );
+
+  FRENSIE_CHECK( !collision_forcer->isForcedCollisionCell( photon ) );
+  FRENSIE_CHECK( !base_collision_forcer->isForcedCollisionCell( photon ) );
+  FRENSIE_CHECK( !collision_forcer->isForcedCollisionCell( neutron ) );
+
+  std::vector<MonteCarlo::StandardCollisionForcer::CellIdType> cells( {1} );
+
+  collision_forcer->setForcedCollisionCells( *filled_model,
+                                             MonteCarlo::PHOTON,
+                                             cells,
+                                             0.5 );
+
+  FRENSIE_CHECK( collision_forcer->isForcedCollisionCell( photon ) );
+  FRENSIE_CHECK( base_collision_forcer->isForcedCollisionCell( photon ) );
+  FRENSIE_CHECK( !collision_forcer->isForcedCollisionCell( neutron ) );
+  FRENSIE_CHECK( !base_collision_forcer->isForcedCollisionCell( neutron ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a collision can be forced
 FRENSIE_UNIT_TEST( StandardCollisionForcer,
@@ -0,0 +1,259 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackFileReader.cpp
+//! \author Alex Robinson
+//! \brief  Particle track file reader class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstring>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackFileReader.hpp"
+#include "MonteCarlo_ParticleTrackFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleTrackFileReader::ParticleTrackFileReader(
+                          const boost::filesystem::path& track_file_name )
+  : d_track_file_name( track_file_name ),
+    d_track_file( track_file_name.string(), std::ios::binary ),
+    d_index()
+{
+  TEST_FOR_EXCEPTION( !d_track_file.good(),
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name <<
+                      " could not be opened!" );
+
+  // Check the header
+  std::vector<char> header( ParticleTrackFileWriter::s_header_size );
+
+  d_track_file.read( header.data(), header.size() );
+
+  size_t position = sizeof(ParticleTrackFileWriter::s_magic_string);
+
+  TEST_FOR_EXCEPTION( !d_track_file.good() ||
+                      std::memcmp( header.data(),
+                                   ParticleTrackFileWriter::s_magic_string,
+                                   position ) != 0,
+                      std::runtime_error,
+                      "The file " << d_track_file_name << " is not a "
+                      "particle track file!" );
+
+  const uint32_t version = this->readFromRecord<uint32_t>( header, position );
+
+  TEST_FOR_EXCEPTION( version != ParticleTrackFileWriter::s_version,
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name <<
+                      " has an unsupported version (" << version << ")!" );
+
+  // Read the footer
+  std::vector<char> footer( ParticleTrackFileWriter::s_footer_size );
+
+  d_track_file.seekg( -(std::streamoff)footer.size(), std::ios::end );
+  d_track_file.read( footer.data(), footer.size() );
+
+  TEST_FOR_EXCEPTION( !d_track_file.good() ||
+                      std::memcmp( footer.data() + 2*sizeof(uint64_t),
+                                   ParticleTrackFileWriter::s_magic_string,
+                                   sizeof(ParticleTrackFileWriter::s_magic_string) ) != 0,
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name <<
+                      " does not have an index (was the file closed?)!" );
+
+  position = 0;
+
+  const uint64_t index_offset =
+    this->readFromRecord<uint64_t>( footer, position );
+
+  const uint64_t index_size =
+    this->readFromRecord<uint64_t>( footer, position );
+
+  // Read the index
+  std::vector<char> index( index_size*3*sizeof(uint64_t) );
+
+  d_track_file.seekg( index_offset );
+  d_track_file.read( index.data(), index.size() );
+
+  TEST_FOR_EXCEPTION( !d_track_file.good(),
+                      std::runtime_error,
+                      "The index of the particle track file "
+                      << d_track_file_name << " could not be read!" );
+
+  d_index.resize( index_size );
+  position = 0;
+
+  for( size_t i = 0; i < index_size; ++i )
+  {
+    Utility::get<0>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+    Utility::get<1>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+    Utility::get<2>( d_index[i] ) =
+      this->readFromRecord<uint64_t>( index, position );
+  }
+}
+
+// Return the track file name
+const boost::filesystem::path& ParticleTrackFileReader::getTrackFileName() const
+{
+  return d_track_file_name;
+}
+
+// Return the number of histories in the file
+size_t ParticleTrackFileReader::getNumberOfHistories() const
+{
+  return d_index.size();
+}
+
+// Return the history numbers in the file (sorted)
+void ParticleTrackFileReader::getHistoryNumbers(
+                                 std::vector<uint64_t>& history_numbers ) const
+{
+  history_numbers.resize( d_index.size() );
+
+  for( size_t i = 0; i < d_index.size(); ++i )
+    history_numbers[i] = Utility::get<0>( d_index[i] );
+}
+
+// Check if a history is in the file
+bool ParticleTrackFileReader::isHistoryInFile(
+                                        const uint64_t history_number ) const
+{
+  return this->findIndexEntry( history_number ) != d_index.end();
+}
+
+// Find the index entry of a history
+auto ParticleTrackFileReader::findIndexEntry(
+           const uint64_t history_number ) const -> std::vector<IndexEntry>::const_iterator
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    std::lower_bound( d_index.begin(), d_index.end(), history_number,
+                      []( const IndexEntry& entry, const uint64_t value ){
+                        return Utility::get<0>( entry ) < value;
+                      } );
+
+  if( index_entry != d_index.end() &&
+      Utility::get<0>( *index_entry ) != history_number )
+    return d_index.end();
+  else
+    return index_entry;
+}
+
+// Read the tracks of a history
+void ParticleTrackFileReader::readHistory(
+                          const uint64_t history_number,
+                          ParticleTracker::ParticleTypeSubmap& history_data )
+{
+  std::vector<IndexEntry>::const_iterator index_entry =
+    this->findIndexEntry( history_number );
+
+  TEST_FOR_EXCEPTION( index_entry == d_index.end(),
+                      std::runtime_error,
+                      "History " << history_number << " is not in the "
+                      "particle track file " << d_track_file_name << "!" );
+
+  std::vector<char> record( Utility::get<2>( *index_entry ) );
+
+  d_track_file.seekg( Utility::get<1>( *index_entry ) );
+  d_track_file.read( record.data(), record.size() );
+
+  TEST_FOR_EXCEPTION( !d_track_file.good(),
+                      std::runtime_error,
+                      "History " << history_number << " could not be read "
+                      "from the particle track file " << d_track_file_name <<
+                      "!" );
+
+  history_data.clear();
+
+  size_t position = 0;
+
+  const uint64_t record_history_number =
+    this->readFromRecord<uint64_t>( record, position );
+
+  TEST_FOR_EXCEPTION( record_history_number != history_number,
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name <<
+                      " is corrupt (history " << history_number << " has "
+                      "an invalid record)!" );
+
+  const uint32_t number_of_tracks =
+    this->readFromRecord<uint32_t>( record, position );
+
+  for( uint32_t i = 0; i < number_of_tracks; ++i )
+  {
+    const ParticleType particle_type =
+      (ParticleType)this->readFromRecord<uint32_t>( record, position );
+
+    const uint32_t generation_number =
+      this->readFromRecord<uint32_t>( record, position );
+
+    const uint32_t particle_id =
+      this->readFromRecord<uint32_t>( record, position );
+
+    const uint32_t number_of_points =
+      this->readFromRecord<uint32_t>( record, position );
+
+    ParticleTracker::ParticleDataArray& particle_data =
+      history_data[particle_type][generation_number][particle_id];
+
+    particle_data.resize( number_of_points );
+
+    for( auto&& point : particle_data )
+    {
+      for( size_t j = 0; j < 3; ++j )
+        Utility::get<0>( point )[j] = this->readFromRecord<double>( record, position );
+
+      for( size_t j = 0; j < 3; ++j )
+        Utility::get<1>( point )[j] = this->readFromRecord<double>( record, position );
+
+      Utility::get<2>( point ) = this->readFromRecord<double>( record, position );
+      Utility::get<3>( point ) = this->readFromRecord<double>( record, position );
+      Utility::get<4>( point ) = this->readFromRecord<double>( record, position );
+      Utility::get<5>( point ) = this->readFromRecord<uint32_t>( record, position );
+    }
+  }
+}
+
+// Read the tracks of every history (only use with small files)
+void ParticleTrackFileReader::readAllHistories(
+                             ParticleTracker::OverallHistoryMap& history_map )
+{
+  history_map.clear();
+
+  for( auto&& index_entry : d_index )
+  {
+    this->readHistory( Utility::get<0>( index_entry ),
+                       history_map[Utility::get<0>( index_entry )] );
+  }
+}
+
+// Read a value from a record
+template<typename T>
+T ParticleTrackFileReader::readFromRecord( const std::vector<char>& record,
+                                           size_t& position )
+{
+  TEST_FOR_EXCEPTION( position + sizeof(T) > record.size(),
+                      std::runtime_error,
+                      "Attempted to read past the end of a particle track "
+                      "file record!" );
+
+  T value;
+
+  std::memcpy( &value, record.data() + position, sizeof(T) );
+
+  position += sizeof(T);
+
+  return value;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackFileReader.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackFileReader.hpp
+//! \author Alex Robinson
+//! \brief  Particle track file reader class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACK_FILE_READER_HPP
+#define MONTE_CARLO_PARTICLE_TRACK_FILE_READER_HPP
+
+// Std Lib Includes
+#include <fstream>
+#include <vector>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTracker.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle track file reader class
+ * \details Only the history index of the track file is loaded when the
+ * reader is constructed. The tracks of a history are read on demand, which
+ * allows visualization tools to access track files that are too large to
+ * fit in memory (see MonteCarlo::ParticleTrackFileWriter for the layout).
+ */
+class ParticleTrackFileReader : private boost::noncopyable
+{
+
+public:
+
+  //! Constructor
+  ParticleTrackFileReader( const boost::filesystem::path& track_file_name );
+
+  //! Destructor
+  ~ParticleTrackFileReader()
+  { /* ... */ }
+
+  //! Return the track file name
+  const boost::filesystem::path& getTrackFileName() const;
+
+  //! Return the number of histories in the file
+  size_t getNumberOfHistories() const;
+
+  //! Return the history numbers in the file (sorted)
+  void getHistoryNumbers( std::vector<uint64_t>& history_numbers ) const;
+
+  //! Check if a history is in the file
+  bool isHistoryInFile( const uint64_t history_number ) const;
+
+  //! Read the tracks of a history
+  void readHistory( const uint64_t history_number,
+                    ParticleTracker::ParticleTypeSubmap& history_data );
+
+  //! Read the tracks of every history (only use with small files)
+  void readAllHistories( ParticleTracker::OverallHistoryMap& history_map );
+
+private:
+
+  // Read a value from a record
+  template<typename T>
+  static T readFromRecord( const std::vector<char>& record, size_t& position );
+
+  // The history index entry (history number, record offset, record size)
+  typedef std::tuple<uint64_t,uint64_t,uint64_t> IndexEntry;
+
+  // Find the index entry of a history
+  std::vector<IndexEntry>::const_iterator findIndexEntry(
+                                       const uint64_t history_number ) const;
+
+  // The track file name
+  boost::filesystem::path d_track_file_name;
+
+  // The track file
+  std::ifstream d_track_file;
+
+  // The history index
+  std::vector<IndexEntry> d_index;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACK_FILE_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackFileReader.hpp
+//---------------------------------------------------------------------------//
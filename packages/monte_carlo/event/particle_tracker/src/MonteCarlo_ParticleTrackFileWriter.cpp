@@ -0,0 +1,352 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Particle track file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+// System Includes
+#include <fcntl.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackFileWriter.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+// Append a value to a record buffer
+template<typename T>
+inline void appendToRecord( std::vector<char>& record, const T& value )
+{
+  const size_t start = record.size();
+
+  record.resize( start + sizeof(T) );
+
+  std::memcpy( record.data() + start, &value, sizeof(T) );
+}
+
+} // end Details namespace
+
+// Initialize static member data
+const char ParticleTrackFileWriter::s_magic_string[8] =
+  {'F', 'R', 'N', 'S', 'T', 'R', 'K', '\0'};
+
+const uint32_t ParticleTrackFileWriter::s_version = 1u;
+
+const size_t ParticleTrackFileWriter::s_header_size =
+  sizeof(s_magic_string) + 2*sizeof(uint32_t);
+
+const size_t ParticleTrackFileWriter::s_footer_size =
+  2*sizeof(uint64_t) + sizeof(s_magic_string);
+
+const size_t ParticleTrackFileWriter::s_point_size =
+  9*sizeof(double) + sizeof(uint32_t);
+
+// Constructor
+ParticleTrackFileWriter::ParticleTrackFileWriter(
+                           const boost::filesystem::path& track_file_name,
+                           const unsigned number_of_threads,
+                           const size_t chunk_size )
+  : d_track_file_name( track_file_name ),
+    d_file_descriptor( -1 ),
+    d_chunk_size( chunk_size ),
+    d_file_offset( s_header_size ),
+    d_thread_buffers( number_of_threads )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  d_file_descriptor = ::open( d_track_file_name.string().c_str(),
+                              O_WRONLY | O_CREAT | O_TRUNC,
+                              0644 );
+
+  TEST_FOR_EXCEPTION( d_file_descriptor < 0,
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name <<
+                      " could not be opened (" << std::strerror( errno ) <<
+                      ")!" );
+
+  // Write the header
+  std::vector<char> header;
+  header.reserve( s_header_size );
+
+  for( size_t i = 0; i < sizeof(s_magic_string); ++i )
+    Details::appendToRecord( header, s_magic_string[i] );
+
+  Details::appendToRecord( header, s_version );
+  Details::appendToRecord( header, (uint32_t)0 );
+
+  this->writeAtOffset( header.data(), header.size(), 0 );
+}
+
+// Destructor
+ParticleTrackFileWriter::~ParticleTrackFileWriter()
+{
+  try{
+    this->close();
+  }
+  catch( ... )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Particle Track File",
+                                "The particle track file "
+                                << d_track_file_name <<
+                                " could not be closed properly!" );
+  }
+}
+
+// Return the track file name
+const boost::filesystem::path& ParticleTrackFileWriter::getTrackFileName() const
+{
+  return d_track_file_name;
+}
+
+// Return the chunk size (bytes)
+size_t ParticleTrackFileWriter::getChunkSize() const
+{
+  return d_chunk_size;
+}
+
+// Enable support for multiple threads
+/*! \details This must only be called from the root thread before any
+ * histories have been added from a parallel region.
+ */
+void ParticleTrackFileWriter::enableThreadSupport( const unsigned number_of_threads )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+
+  if( number_of_threads > d_thread_buffers.size() )
+    d_thread_buffers.resize( number_of_threads );
+}
+
+// Add the tracks of a completed history
+/*! \details The history will be appended to the buffer of the calling
+ * thread. If the buffer exceeds the chunk size it will be written to the
+ * file. No locks are acquired.
+ */
+void ParticleTrackFileWriter::addHistory(
+                   const ParticleState::historyNumberType history_number,
+                   const ParticleTracker::ParticleTypeSubmap& history_data )
+{
+  // Make sure the file is open
+  testPrecondition( this->isOpen() );
+  // Make sure thread support has been enabled
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_buffers.size() );
+
+  ThreadBuffer& thread_buffer =
+    d_thread_buffers[Utility::OpenMPProperties::getThreadId()];
+
+  std::vector<char>& records = thread_buffer.records;
+
+  const size_t record_start = records.size();
+
+  // Count the tracks in the history
+  uint32_t number_of_tracks = 0;
+
+  for( auto&& particle_type_data : history_data )
+  {
+    for( auto&& generation_data : particle_type_data.second )
+      number_of_tracks += generation_data.second.size();
+  }
+
+  Details::appendToRecord( records, (uint64_t)history_number );
+  Details::appendToRecord( records, number_of_tracks );
+
+  for( auto&& particle_type_data : history_data )
+  {
+    for( auto&& generation_data : particle_type_data.second )
+    {
+      for( auto&& particle_data : generation_data.second )
+      {
+        Details::appendToRecord( records, (uint32_t)particle_type_data.first );
+        Details::appendToRecord( records, (uint32_t)generation_data.first );
+        Details::appendToRecord( records, (uint32_t)particle_data.first );
+        Details::appendToRecord( records,
+                                 (uint32_t)particle_data.second.size() );
+
+        for( auto&& point : particle_data.second )
+        {
+          for( size_t i = 0; i < 3; ++i )
+            Details::appendToRecord( records, Utility::get<0>( point )[i] );
+
+          for( size_t i = 0; i < 3; ++i )
+            Details::appendToRecord( records, Utility::get<1>( point )[i] );
+
+          Details::appendToRecord( records, Utility::get<2>( point ) );
+          Details::appendToRecord( records, Utility::get<3>( point ) );
+          Details::appendToRecord( records, Utility::get<4>( point ) );
+          Details::appendToRecord( records,
+                                   (uint32_t)Utility::get<5>( point ) );
+        }
+      }
+    }
+  }
+
+  thread_buffer.record_index.push_back(
+                        std::make_tuple( (uint64_t)history_number,
+                                         (uint64_t)record_start,
+                                         (uint64_t)(records.size() - record_start) ) );
+
+  if( records.size() >= d_chunk_size )
+    this->flushThreadBuffer( thread_buffer );
+}
+
+// Flush the buffer of a thread
+void ParticleTrackFileWriter::flushThreadBuffer( ThreadBuffer& thread_buffer )
+{
+  if( thread_buffer.records.empty() )
+    return;
+
+  // Reserve the file region that this chunk will occupy
+  const uint64_t chunk_offset =
+    d_file_offset.fetch_add( thread_buffer.records.size() );
+
+  this->writeAtOffset( thread_buffer.records.data(),
+                       thread_buffer.records.size(),
+                       chunk_offset );
+
+  for( auto&& index_entry : thread_buffer.record_index )
+  {
+    Utility::get<1>( index_entry ) += chunk_offset;
+
+    thread_buffer.index.push_back( index_entry );
+  }
+
+  thread_buffer.records.clear();
+  thread_buffer.record_index.clear();
+}
+
+// Flush the buffers of every thread
+/*! \details This must only be called from the root thread outside of a
+ * parallel region.
+ */
+void ParticleTrackFileWriter::flush()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( this->isOpen() )
+  {
+    for( auto&& thread_buffer : d_thread_buffers )
+      this->flushThreadBuffer( thread_buffer );
+  }
+}
+
+// Write the index and close the file
+void ParticleTrackFileWriter::close()
+{
+  if( !this->isOpen() )
+    return;
+
+  this->flush();
+
+  // Merge the thread indices
+  std::vector<IndexEntry> index;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+  {
+    index.insert( index.end(),
+                  thread_buffer.index.begin(),
+                  thread_buffer.index.end() );
+
+    thread_buffer.index.clear();
+  }
+
+  std::sort( index.begin(), index.end() );
+
+  // Write the index and the footer
+  std::vector<char> index_and_footer;
+  index_and_footer.reserve( index.size()*3*sizeof(uint64_t) + s_footer_size );
+
+  for( auto&& index_entry : index )
+  {
+    Details::appendToRecord( index_and_footer, Utility::get<0>( index_entry ) );
+    Details::appendToRecord( index_and_footer, Utility::get<1>( index_entry ) );
+    Details::appendToRecord( index_and_footer, Utility::get<2>( index_entry ) );
+  }
+
+  const uint64_t index_offset = d_file_offset.load();
+
+  Details::appendToRecord( index_and_footer, index_offset );
+  Details::appendToRecord( index_and_footer, (uint64_t)index.size() );
+
+  for( size_t i = 0; i < sizeof(s_magic_string); ++i )
+    Details::appendToRecord( index_and_footer, s_magic_string[i] );
+
+  this->writeAtOffset( index_and_footer.data(),
+                       index_and_footer.size(),
+                       index_offset );
+
+  ::close( d_file_descriptor );
+
+  d_file_descriptor = -1;
+}
+
+// Check if the file is open
+bool ParticleTrackFileWriter::isOpen() const
+{
+  return d_file_descriptor >= 0;
+}
+
+// Return the number of histories that have been written
+/*! \details Only histories that have been flushed to the file are counted.
+ */
+size_t ParticleTrackFileWriter::getNumberOfHistories() const
+{
+  size_t number_of_histories = 0;
+
+  for( auto&& thread_buffer : d_thread_buffers )
+    number_of_histories += thread_buffer.index.size();
+
+  return number_of_histories;
+}
+
+// Write data at the requested file offset
+void ParticleTrackFileWriter::writeAtOffset( const char* data,
+                                             const size_t size,
+                                             const uint64_t offset ) const
+{
+  size_t bytes_written = 0;
+
+  while( bytes_written < size )
+  {
+    const ssize_t result = ::pwrite( d_file_descriptor,
+                                     data + bytes_written,
+                                     size - bytes_written,
+                                     offset + bytes_written );
+
+    if( result < 0 && errno == EINTR )
+      continue;
+
+    TEST_FOR_EXCEPTION( result <= 0,
+                        std::runtime_error,
+                        "Could not write to the particle track file "
+                        << d_track_file_name << " ("
+                        << std::strerror( errno ) << ")!" );
+
+    bytes_written += result;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackFileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,148 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  Particle track file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACK_FILE_WRITER_HPP
+#define MONTE_CARLO_PARTICLE_TRACK_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <atomic>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/core/noncopyable.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTracker.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle track file writer class
+ * \details Each thread appends the tracks of its completed histories to its
+ * own buffer. When a buffer exceeds the chunk size it is written to the file
+ * by the owning thread. The file region that a chunk will occupy is reserved
+ * with an atomic offset so that threads never have to wait for each other.
+ * All tracks of a history are always stored in a single record, which allows
+ * the history to be read without scanning the file (see
+ * MonteCarlo::ParticleTrackFileReader). The track file layout is:
+ * <ul>
+ *  <li>header: magic string (8 bytes), version (uint32), padding (uint32)</li>
+ *  <li>history records: history number (uint64), number of tracks (uint32),
+ *      and for each track the particle type (uint32), generation number
+ *      (uint32), particle id (uint32), number of points (uint32) and the
+ *      points (x, y, z, u, v, w, energy, time, weight as doubles and the
+ *      collision number as a uint32)</li>
+ *  <li>index: history number (uint64), record offset (uint64) and record
+ *      size (uint64) of every history sorted by history number</li>
+ *  <li>footer: index offset (uint64), number of indexed histories (uint64),
+ *      magic string (8 bytes)</li>
+ * </ul>
+ * All values are stored in the native byte order of the machine.
+ */
+class ParticleTrackFileWriter : private boost::noncopyable
+{
+
+public:
+
+  //! The track file magic string
+  static const char s_magic_string[8];
+
+  //! The track file version
+  static const uint32_t s_version;
+
+  //! The size of the track file header (bytes)
+  static const size_t s_header_size;
+
+  //! The size of the track file footer (bytes)
+  static const size_t s_footer_size;
+
+  //! The size of a track point (bytes)
+  static const size_t s_point_size;
+
+  //! Constructor
+  ParticleTrackFileWriter( const boost::filesystem::path& track_file_name,
+                           const unsigned number_of_threads = 1u,
+                           const size_t chunk_size = 1048576 );
+
+  //! Destructor
+  ~ParticleTrackFileWriter();
+
+  //! Return the track file name
+  const boost::filesystem::path& getTrackFileName() const;
+
+  //! Return the chunk size (bytes)
+  size_t getChunkSize() const;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned number_of_threads );
+
+  //! Add the tracks of a completed history
+  void addHistory( const ParticleState::historyNumberType history_number,
+                   const ParticleTracker::ParticleTypeSubmap& history_data );
+
+  //! Flush the buffers of every thread
+  void flush();
+
+  //! Write the index and close the file
+  void close();
+
+  //! Check if the file is open
+  bool isOpen() const;
+
+  //! Return the number of histories that have been written
+  size_t getNumberOfHistories() const;
+
+private:
+
+  // The history index entry (history number, record offset, record size)
+  typedef std::tuple<uint64_t,uint64_t,uint64_t> IndexEntry;
+
+  // The thread buffer
+  struct ThreadBuffer
+  {
+    // The unwritten records
+    std::vector<char> records;
+
+    // The unwritten record index entries (offsets relative to the buffer)
+    std::vector<IndexEntry> record_index;
+
+    // The written record index entries
+    std::vector<IndexEntry> index;
+  };
+
+  // Flush the buffer of a thread
+  void flushThreadBuffer( ThreadBuffer& thread_buffer );
+
+  // Write data at the requested file offset
+  void writeAtOffset( const char* data,
+                      const size_t size,
+                      const uint64_t offset ) const;
+
+  // The track file name
+  boost::filesystem::path d_track_file_name;
+
+  // The track file descriptor
+  int d_file_descriptor;
+
+  // The chunk size
+  size_t d_chunk_size;
+
+  // The next free file offset
+  std::atomic<uint64_t> d_file_offset;
+
+  // The thread buffers
+  std::vector<ThreadBuffer> d_thread_buffers;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACK_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackFileWriter.hpp
+//---------------------------------------------------------------------------//
@@ -9,9 +9,11 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackFileWriter.hpp"
 #include "MonteCarlo_ObserverParticleStateWrapper.hpp"
 #include "MonteCarlo_ParticleType.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -28,7 +30,8 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track(),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map( 1 ),
+    d_track_file_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( number_of_histories >= 0 );
@@ -43,7 +46,8 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track( history_numbers ),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map( 1 ),
+    d_track_file_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( history_numbers.size() > 0 )
@@ -116,31 +120,33 @@ void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
 }
 
 // Update the observer
+/*! \details A history is only ever simulated by a single thread so the
+ * completed track can be moved to the history map of the calling thread
+ * without acquiring a lock.
+ */
 void ParticleTracker::updateFromGlobalParticleGoneEvent(
                                                 const ParticleState& particle )
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  if( d_partial_history_map[thread_id].find( &particle ) !=
-      d_partial_history_map[thread_id].end() )
-  {
-    #pragma omp critical
-    {
-      IndividualParticleSubmap& particle_data = 
-        d_history_number_map[particle.getHistoryNumber()][particle.getParticleType()][particle.getGenerationNumber()];
+  PartialHistorySubmap& thread_partial_history_map =
+    d_partial_history_map[thread_id];
+
+  PartialHistorySubmap::iterator partial_history_it =
+    thread_partial_history_map.find( &particle );
 
-      // Get the unique id of this particle state
-      unsigned i = 0u;
+  if( partial_history_it != thread_partial_history_map.end() )
+  {
+    IndividualParticleSubmap& particle_data =
+      d_history_number_map[thread_id][particle.getHistoryNumber()][particle.getParticleType()][particle.getGenerationNumber()];
 
-      while( particle_data.count( i ) )
-        ++i;
+    // The unique ids of the particle states are assigned sequentially
+    const unsigned id = particle_data.size();
 
-      // Add the particle state data
-      particle_data[i] = d_partial_history_map[thread_id][&particle];
+    // Move the particle state data from the partial data map
+    particle_data[id].swap( partial_history_it->second );
 
-      // Remove the particle state data from the partial data map
-      d_partial_history_map[thread_id].erase( &particle );
-    }
+    thread_partial_history_map.erase( partial_history_it );
   }
 }
 
@@ -159,8 +165,9 @@ void ParticleTracker::resetData()
   for( size_t i = 0; i < d_partial_history_map.size(); ++i )
     d_partial_history_map[i].clear();
 
-  // Clear the history number map
-  d_history_number_map.clear();
+  // Clear the history number maps
+  for( size_t i = 0; i < d_history_number_map.size(); ++i )
+    d_history_number_map[i].clear();
 }
 
 // Enable support for multiple threads
@@ -169,17 +176,45 @@ void ParticleTracker::enableThreadSupport( const unsigned num_threads )
   testPrecondition( num_threads > 0 );
   
   d_partial_history_map.resize( num_threads );
+
+  if( num_threads > d_history_number_map.size() )
+    d_history_number_map.resize( num_threads );
+
+  if( d_track_file_writer )
+    d_track_file_writer->enableThreadSupport( num_threads );
 }
 
 // Has Uncommited History Contribution
+/*! \details Tracked histories only need to be committed when they are
+ * streamed to a track file.
+ */
 bool ParticleTracker::hasUncommittedHistoryContribution() const
 {
-  return false;
+  return d_track_file_writer &&
+    !d_history_number_map[Utility::OpenMPProperties::getThreadId()].empty();
 }
 
 // Commit History Contribution
+/*! \details When a track file has been set the tracked histories of the
+ * calling thread will be passed to the track file writer and then removed
+ * from memory.
+ */
 void ParticleTracker::commitHistoryContribution()
-{ /* ... */ }
+{
+  if( d_track_file_writer )
+  {
+    OverallHistoryMap& thread_history_number_map =
+      d_history_number_map[Utility::OpenMPProperties::getThreadId()];
+
+    for( auto&& history_data : thread_history_number_map )
+    {
+      d_track_file_writer->addHistory( history_data.first,
+                                       history_data.second );
+    }
+
+    thread_history_number_map.clear();
+  }
+}
 
 // Reduce data
 void ParticleTracker::reduceData( const Utility::Communicator& comm,
@@ -190,6 +225,10 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Every process writes its own track file
+  if( d_track_file_writer )
+    d_track_file_writer->flush();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -222,7 +261,7 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
         
         while( gathered_data_it != gathered_data[i].end() )
         {
-          d_history_number_map[gathered_data_it->first] =
+          d_history_number_map.front()[gathered_data_it->first] =
             gathered_data_it->second;
 
           ++gathered_data_it;
@@ -231,7 +270,11 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
     }
     else
     {
-      Utility::send( comm, root_process, 0, d_history_number_map );
+      OverallHistoryMap history_number_map;
+
+      this->getHistoryData( history_number_map );
+
+      Utility::send( comm, root_process, 0, history_number_map );
 
       // Reset the non-root process data
       this->resetData();
@@ -274,9 +317,71 @@ void ParticleTracker::printSummary( std::ostream& os ) const
 }
 
 // Get the data map
+/*! \details Histories that have been streamed to a track file will not be
+ * returned (see MonteCarlo::ParticleTrackFileReader).
+ */
 void ParticleTracker::getHistoryData( OverallHistoryMap& history_map ) const
 {
-  history_map = d_history_number_map;
+  history_map.clear();
+
+  // The thread history maps never share a history
+  for( size_t i = 0; i < d_history_number_map.size(); ++i )
+  {
+    history_map.insert( d_history_number_map[i].begin(),
+                        d_history_number_map[i].end() );
+  }
+}
+
+// Stream the tracked histories to a track file
+/*! \details The tracks of each history will be written to the track file
+ * when the history is committed. Histories that have already been committed
+ * will remain in memory. When there are multiple processes the process rank
+ * will be appended to the track file name so that each process writes its
+ * own file.
+ */
+void ParticleTracker::setTrackFile(
+                         const boost::filesystem::path& track_file_name,
+                         const size_t chunk_size )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  this->closeTrackFile();
+
+  boost::filesystem::path process_track_file_name = track_file_name;
+
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    process_track_file_name +=
+      "." + std::to_string( Utility::GlobalMPISession::rank() );
+  }
+
+  d_track_file_writer.reset(
+              new ParticleTrackFileWriter( process_track_file_name,
+                                           d_partial_history_map.size(),
+                                           chunk_size ) );
+}
+
+// Check if the tracked histories are streamed to a track file
+bool ParticleTracker::isTrackFileSet() const
+{
+  return d_track_file_writer.get() != NULL;
+}
+
+// Write the remaining tracked histories and close the track file
+void ParticleTracker::closeTrackFile()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_track_file_writer )
+  {
+    d_track_file_writer->close();
+
+    d_track_file_writer.reset();
+  }
 }
 
 } // end MonteCarlo namespace
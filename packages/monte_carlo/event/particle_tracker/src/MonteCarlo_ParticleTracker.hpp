@@ -16,6 +16,7 @@
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/any.hpp>
+#include <boost/filesystem/path.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSubtrackEndingGlobalEventObserver.hpp"
@@ -31,7 +32,16 @@
 
 namespace MonteCarlo{
 
+// Forward declare the particle track file writer
+class ParticleTrackFileWriter;
+
 /*! The particle tracking class, similar to the PTRAC function in MCNP
+ * \details Each thread stores the tracks of the histories that it simulates
+ * in its own history map (a history is always simulated by a single thread)
+ * so no locks are required when a particle track is completed. When a track
+ * file has been set the tracks of a history are streamed to the file when
+ * the history is committed (see MonteCarlo::ParticleTrackFileWriter), which
+ * bounds the memory required to track a large number of histories.
  */
 class ParticleTracker : public ParticleSubtrackEndingGlobalEventObserver,
                         public ParticleGoneGlobalEventObserver,
@@ -128,6 +138,16 @@ public:
   //! Get the data map
   void getHistoryData( OverallHistoryMap& history_map ) const;
 
+  //! Stream the tracked histories to a track file
+  void setTrackFile( const boost::filesystem::path& track_file_name,
+                     const size_t chunk_size = 1048576 );
+
+  //! Check if the tracked histories are streamed to a track file
+  bool isTrackFileSet() const;
+
+  //! Write the remaining tracked histories and close the track file
+  void closeTrackFile();
+
 private:
 
   // Default constructor
@@ -156,8 +176,11 @@ private:
   typedef std::map<const ParticleState*,ParticleDataArray> PartialHistorySubmap;
   std::vector<PartialHistorySubmap> d_partial_history_map;
 
-  // The tracked history info
-  OverallHistoryMap d_history_number_map;
+  // The tracked history info (one map per thread)
+  std::vector<OverallHistoryMap> d_history_number_map;
+
+  // The track file writer
+  std::shared_ptr<ParticleTrackFileWriter> d_track_file_writer;
 };
 
 // Save the estimator data
@@ -172,7 +195,13 @@ void ParticleTracker::save( Archive& ar, const unsigned version ) const
   // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
-  ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+
+  OverallHistoryMap history_number_map;
+
+  this->getHistoryData( history_number_map );
+
+  ar & boost::serialization::make_nvp( "d_history_number_map",
+                                       history_number_map );
 }
 
 // Load the estimator data
@@ -187,7 +216,11 @@ void ParticleTracker::load( Archive& ar, const unsigned version )
   // Load the local data
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
-  ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+
+  d_history_number_map.resize( 1 );
+
+  ar & boost::serialization::make_nvp( "d_history_number_map",
+                                       d_history_number_map.front() );
 
   d_partial_history_map.resize( 1 );
 }
@@ -0,0 +1,266 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceRecorder.cpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+SurfaceSourceRecorder::SurfaceSourceRecorder()
+  : d_thread_history_crossings( 1 )
+{ /* ... */ }
+
+// Constructor
+SurfaceSourceRecorder::SurfaceSourceRecorder(
+                                  const std::set<SurfaceIdType>& surfaces )
+  : d_surfaces( surfaces ),
+    d_particle_types(),
+    d_thread_history_crossings( 1 ),
+    d_file_writer()
+{
+  TEST_FOR_EXCEPTION( surfaces.empty(),
+                      std::runtime_error,
+                      "A surface source recorder must record at least one "
+                      "surface!" );
+}
+
+// Constructor (with particle types)
+SurfaceSourceRecorder::SurfaceSourceRecorder(
+                                const std::set<SurfaceIdType>& surfaces,
+                                const std::set<ParticleType>& particle_types )
+  : SurfaceSourceRecorder( surfaces )
+{
+  TEST_FOR_EXCEPTION( particle_types.empty(),
+                      std::runtime_error,
+                      "A surface source recorder must record at least one "
+                      "particle type!" );
+
+  d_particle_types = particle_types;
+}
+
+// Return the recorded surfaces
+auto SurfaceSourceRecorder::getSurfaces() const -> const std::set<SurfaceIdType>&
+{
+  return d_surfaces;
+}
+
+// Return the recorded particle types (empty if all types are recorded)
+const std::set<ParticleType>& SurfaceSourceRecorder::getParticleTypes() const
+{
+  return d_particle_types;
+}
+
+// Stream the surface crossings to a surface source file
+/*! \details The surface crossings of each history will be written to the
+ * file when the history is committed. Surface crossings will only be
+ * recorded while a file is set. When there are multiple processes the
+ * process rank will be appended to the file name so that each process
+ * writes its own file.
+ */
+void SurfaceSourceRecorder::setSurfaceSourceFile(
+                                   const boost::filesystem::path& file_name,
+                                   const size_t chunk_size )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  this->closeSurfaceSourceFile();
+
+  boost::filesystem::path process_file_name = file_name;
+
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    process_file_name +=
+      "." + std::to_string( Utility::GlobalMPISession::rank() );
+  }
+
+  d_file_writer.reset(
+              new SurfaceSourceFileWriter( process_file_name,
+                                           d_thread_history_crossings.size(),
+                                           chunk_size ) );
+}
+
+// Check if the surface crossings are streamed to a surface source file
+bool SurfaceSourceRecorder::isSurfaceSourceFileSet() const
+{
+  return d_file_writer.get() != NULL;
+}
+
+// Write the remaining surface crossings and close the file
+void SurfaceSourceRecorder::closeSurfaceSourceFile()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_file_writer )
+  {
+    d_file_writer->close();
+
+    d_file_writer.reset();
+  }
+
+  this->resetData();
+}
+
+// Update the observer
+void SurfaceSourceRecorder::updateFromParticleCrossingSurfaceEvent(
+                          const ParticleState& particle,
+                          const Geometry::Model::EntityId surface_crossing,
+                          const double angle_cosine )
+{
+  if( !d_file_writer )
+    return;
+
+  if( !d_particle_types.empty() &&
+      d_particle_types.find( particle.getParticleType() ) ==
+      d_particle_types.end() )
+    return;
+
+  ThreadHistoryCrossings& thread_history_crossings =
+    d_thread_history_crossings[Utility::OpenMPProperties::getThreadId()];
+
+  thread_history_crossings.history_number = particle.getHistoryNumber();
+
+  thread_history_crossings.particles.emplace_back();
+
+  SurfaceSourceParticleRecord& record =
+    thread_history_crossings.particles.back();
+
+  record.particle_type = particle.getParticleType();
+  record.surface_id = surface_crossing;
+  record.position[0] = particle.getXPosition();
+  record.position[1] = particle.getYPosition();
+  record.position[2] = particle.getZPosition();
+  record.direction[0] = particle.getXDirection();
+  record.direction[1] = particle.getYDirection();
+  record.direction[2] = particle.getZDirection();
+  record.energy = particle.getEnergy();
+  record.time = particle.getTime();
+  record.weight = particle.getWeight();
+}
+
+// Enable support for multiple threads
+void SurfaceSourceRecorder::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  if( num_threads > d_thread_history_crossings.size() )
+    d_thread_history_crossings.resize( num_threads );
+
+  if( d_file_writer )
+    d_file_writer->enableThreadSupport( num_threads );
+}
+
+// Check if the observer has uncommitted history contributions
+/*! \details Every history must be committed while a file is set (even if
+ * there were no surface crossings) so that the number of source histories
+ * that is stored in the file is correct.
+ */
+bool SurfaceSourceRecorder::hasUncommittedHistoryContribution() const
+{
+  return d_file_writer.get() != NULL;
+}
+
+// Commit the contribution from the current history to the observer
+void SurfaceSourceRecorder::commitHistoryContribution()
+{
+  if( d_file_writer )
+  {
+    ThreadHistoryCrossings& thread_history_crossings =
+      d_thread_history_crossings[Utility::OpenMPProperties::getThreadId()];
+
+    d_file_writer->addHistory( thread_history_crossings.history_number,
+                               thread_history_crossings.particles );
+
+    thread_history_crossings.particles.clear();
+  }
+}
+
+// Take a snapshot
+void SurfaceSourceRecorder::takeSnapshot(
+                              const uint64_t num_histories_since_last_snapshot,
+                              const double time_since_last_snapshot )
+{ /* ... */ }
+
+// Reset the observer data
+/*! \details Histories that have already been written to the file are not
+ * removed.
+ */
+void SurfaceSourceRecorder::resetData()
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( auto&& thread_history_crossings : d_thread_history_crossings )
+    thread_history_crossings.particles.clear();
+}
+
+// Reduce the object data on all processes in comm and collect on root
+/*! \details Every process writes its own surface source file so there is no
+ * data to reduce. The buffered histories will be written to the file.
+ */
+void SurfaceSourceRecorder::reduceData( const Utility::Communicator& comm,
+                                        const int root_process )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  if( d_file_writer )
+    d_file_writer->flush();
+
+  comm.barrier();
+}
+
+// Print a summary of the data
+void SurfaceSourceRecorder::printSummary( std::ostream& os ) const
+{
+  os << "Surface source recorder: surfaces ";
+
+  std::set<SurfaceIdType>::const_iterator surface_it = d_surfaces.begin();
+
+  while( surface_it != d_surfaces.end() )
+  {
+    os << *surface_it;
+
+    ++surface_it;
+
+    if( surface_it != d_surfaces.end() )
+      os << ", ";
+  }
+
+  if( d_file_writer )
+  {
+    os << " (" << d_file_writer->getFileName().string() << ": "
+       << d_file_writer->getNumberOfSourceHistories()
+       << " source histories)";
+  }
+
+  os << std::endl;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::SurfaceSourceRecorder );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::SurfaceSourceRecorder );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceRecorder.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_SurfaceSourceRecorder.hpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+#define MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleCrossingSurfaceEventObserver.hpp"
+#include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "MonteCarlo_SurfaceSourceFileWriter.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The surface source recorder class
+ * \details The phase space (type, position, direction, energy, time and
+ * weight) of every particle that crosses one of the recorded surfaces is
+ * streamed to a surface source file (see MonteCarlo::SurfaceSourceFileWriter)
+ * when the history is committed. The crossings of the current history are
+ * stored in a buffer owned by the calling thread so no locks are required.
+ * The file can be replayed as a source in a subsequent simulation (see
+ * MonteCarlo::SurfaceSourceParticleSourceComponent), which allows an
+ * expensive upstream part of a problem to be simulated once for many
+ * downstream variations. When there are multiple processes the process rank
+ * will be appended to the file name so that each process writes its own
+ * file. The file writer is not archived - the surface source file must be
+ * set again after the recorder has been loaded from an archive.
+ */
+class SurfaceSourceRecorder : public ParticleCrossingSurfaceEventObserver,
+                              public ParticleHistoryObserver
+{
+
+public:
+
+  //! Typedef for the surface id type
+  typedef Geometry::Model::EntityId SurfaceIdType;
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleCrossingSurfaceEventObserver::EventTag>
+  EventTags;
+
+  //! Constructor
+  SurfaceSourceRecorder( const std::set<SurfaceIdType>& surfaces );
+
+  //! Constructor (with particle types)
+  SurfaceSourceRecorder( const std::set<SurfaceIdType>& surfaces,
+                         const std::set<ParticleType>& particle_types );
+
+  //! Destructor
+  ~SurfaceSourceRecorder()
+  { /* ... */ }
+
+  //! Return the recorded surfaces
+  const std::set<SurfaceIdType>& getSurfaces() const;
+
+  //! Return the recorded particle types (empty if all types are recorded)
+  const std::set<ParticleType>& getParticleTypes() const;
+
+  //! Stream the surface crossings to a surface source file
+  void setSurfaceSourceFile( const boost::filesystem::path& file_name,
+                             const size_t chunk_size = 1048576 );
+
+  //! Check if the surface crossings are streamed to a surface source file
+  bool isSurfaceSourceFileSet() const;
+
+  //! Write the remaining surface crossings and close the file
+  void closeSurfaceSourceFile();
+
+  //! Update the observer
+  void updateFromParticleCrossingSurfaceEvent(
+                          const ParticleState& particle,
+                          const Geometry::Model::EntityId surface_crossing,
+                          const double angle_cosine ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit the contribution from the current history to the observer
+  void commitHistoryContribution() final override;
+
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t num_histories_since_last_snapshot,
+                     const double time_since_last_snapshot ) final override;
+
+  //! Reset the observer data
+  void resetData() final override;
+
+  //! Reduce the object data on all processes in comm and collect on root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Print a summary of the data
+  void printSummary( std::ostream& os ) const final override;
+
+private:
+
+  // Default constructor
+  SurfaceSourceRecorder();
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The history crossings of a thread
+  struct ThreadHistoryCrossings
+  {
+    // The history number
+    ParticleState::historyNumberType history_number;
+
+    // The crossings of the current history
+    std::vector<SurfaceSourceParticleRecord> particles;
+  };
+
+  // The recorded surfaces
+  std::set<SurfaceIdType> d_surfaces;
+
+  // The recorded particle types
+  std::set<ParticleType> d_particle_types;
+
+  // The crossings of the current history of each thread
+  std::vector<ThreadHistoryCrossings> d_thread_history_crossings;
+
+  // The surface source file writer
+  std::shared_ptr<SurfaceSourceFileWriter> d_file_writer;
+};
+
+// Save the data to an archive
+template<typename Archive>
+void SurfaceSourceRecorder::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCrossingSurfaceEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistoryObserver );
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void SurfaceSourceRecorder::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCrossingSurfaceEventObserver );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistoryObserver );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_particle_types );
+
+  d_thread_history_crossings.resize( 1 );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( SurfaceSourceRecorder, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( SurfaceSourceRecorder, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, SurfaceSourceRecorder );
+
+#endif // end MONTE_CARLO_SURFACE_SOURCE_RECORDER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_SurfaceSourceRecorder.hpp
+//---------------------------------------------------------------------------//
@@ -12,9 +12,11 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackFileReader.hpp"
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 
@@ -178,6 +180,138 @@ FRENSIE_UNIT_TEST( ParticleTracker, update_from_events )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tracked histories can be streamed to a track file
+FRENSIE_UNIT_TEST( ParticleTracker, setTrackFile )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 100 );
+
+  unsigned threads = Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  particle_tracker.enableThreadSupport( threads );
+
+  FRENSIE_CHECK( !particle_tracker.isTrackFileSet() );
+
+  std::string track_file_name( "test_particle_tracker_tracks.trk" );
+
+  // Use a tiny chunk size so that every history is flushed immediately
+  particle_tracker.setTrackFile( track_file_name, 1 );
+
+  FRENSIE_CHECK( particle_tracker.isTrackFileSet() );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    for( size_t i = 0; i < 4; ++i )
+    {
+      const uint64_t history =
+        Utility::OpenMPProperties::getThreadId()*4 + i;
+
+      MonteCarlo::PhotonState photon( history );
+      photon.setPosition( 2.0, 1.0, 1.0 );
+      photon.setDirection( 1.0, 0.0, 0.0 );
+      photon.setEnergy( 2.5 );
+      photon.setTime( 5e-11 );
+      photon.setWeight( 1.0 );
+
+      double start_point[3] = { 1.0, 1.0, 1.0 };
+      double end_point[3] = { 2.0, 1.0, 1.0 };
+
+      particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                    start_point,
+                                                                    end_point );
+      photon.setAsGone();
+
+      particle_tracker.updateFromGlobalParticleGoneEvent( photon );
+
+      // A second photon in the same generation gets the next id
+      MonteCarlo::PhotonState secondary_photon( history );
+      secondary_photon.setPosition( 3.0, 1.0, 1.0 );
+      secondary_photon.setDirection( 1.0, 0.0, 0.0 );
+      secondary_photon.setEnergy( 1.0 );
+      secondary_photon.setTime( 1e-10 );
+      secondary_photon.setWeight( 0.5 );
+
+      start_point[0] = 2.0;
+      end_point[0] = 3.0;
+
+      particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( secondary_photon,
+                                                                    start_point,
+                                                                    end_point );
+      secondary_photon.setAsGone();
+
+      particle_tracker.updateFromGlobalParticleGoneEvent( secondary_photon );
+
+      particle_tracker.commitHistoryContribution();
+    }
+  }
+
+  // The streamed histories are not stored in memory
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_CHECK( history_map.empty() );
+
+  particle_tracker.closeTrackFile();
+
+  FRENSIE_CHECK( !particle_tracker.isTrackFileSet() );
+
+  // Each process writes its own track file
+  if( Utility::GlobalMPISession::size() > 1 )
+    track_file_name += "." + std::to_string( Utility::GlobalMPISession::rank() );
+
+  MonteCarlo::ParticleTrackFileReader track_file_reader( track_file_name );
+
+  FRENSIE_REQUIRE_EQUAL( track_file_reader.getNumberOfHistories(), 4*threads );
+
+  std::vector<uint64_t> history_numbers;
+
+  track_file_reader.getHistoryNumbers( history_numbers );
+
+  for( size_t i = 0; i < history_numbers.size(); ++i )
+    FRENSIE_CHECK_EQUAL( history_numbers[i], i );
+
+  FRENSIE_CHECK( !track_file_reader.isHistoryInFile( 4*threads ) );
+
+  // Read a single history
+  MonteCarlo::ParticleTracker::ParticleTypeSubmap history_data;
+
+  track_file_reader.readHistory( 4*threads-1, history_data );
+
+  FRENSIE_REQUIRE_EQUAL( history_data.size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( history_data[MonteCarlo::PHOTON].size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( history_data[MonteCarlo::PHOTON][0].size(), 2 );
+
+  const MonteCarlo::ParticleTracker::ParticleDataArray& primary_data =
+    history_data[MonteCarlo::PHOTON][0][0];
+
+  FRENSIE_REQUIRE_EQUAL( primary_data.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( primary_data[0] ),
+                       (std::array<double,3>( {1.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( primary_data[1] ),
+                       (std::array<double,3>( {2.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( primary_data[1] ),
+                       (std::array<double,3>( {1.0, 0.0, 0.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( primary_data[1] ), 2.5 );
+  FRENSIE_CHECK_EQUAL( Utility::get<3>( primary_data[1] ), 5e-11 );
+  FRENSIE_CHECK_EQUAL( Utility::get<4>( primary_data[1] ), 1.0 );
+  FRENSIE_CHECK_EQUAL( Utility::get<5>( primary_data[1] ), 0 );
+
+  const MonteCarlo::ParticleTracker::ParticleDataArray& secondary_data =
+    history_data[MonteCarlo::PHOTON][0][1];
+
+  FRENSIE_REQUIRE_EQUAL( secondary_data.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( secondary_data[1] ),
+                       (std::array<double,3>( {3.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( secondary_data[1] ), 1.0 );
+  FRENSIE_CHECK_EQUAL( Utility::get<4>( secondary_data[1] ), 0.5 );
+
+  // Read every history
+  track_file_reader.readAllHistories( history_map );
+
+  FRENSIE_CHECK_EQUAL( history_map.size(), 4*threads );
+}
+
 //---------------------------------------------------------------------------//
 // Check that particle tracker data can be reset
 FRENSIE_UNIT_TEST( ParticleTracker, resetData )
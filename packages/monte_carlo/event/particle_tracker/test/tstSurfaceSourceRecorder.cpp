@@ -0,0 +1,346 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSurfaceSourceRecorder.cpp
+//! \author Alex Robinson
+//! \brief  Surface source recorder unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_SurfaceSourceRecorder.hpp"
+#include "MonteCarlo_SurfaceSourceFileReader.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Return the name of the surface source file written by this process
+std::string getProcessFileName( const std::string& file_name )
+{
+  if( Utility::GlobalMPISession::size() > 1 )
+    return file_name + "." + std::to_string( Utility::GlobalMPISession::rank() );
+  else
+    return file_name;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the recorded surfaces and particle types can be returned
+FRENSIE_UNIT_TEST( SurfaceSourceRecorder, getSurfaces_getParticleTypes )
+{
+  MonteCarlo::SurfaceSourceRecorder recorder_a( {1, 3} );
+
+  FRENSIE_CHECK_EQUAL( recorder_a.getSurfaces().size(), 2 );
+  FRENSIE_CHECK( recorder_a.getSurfaces().count( 1 ) );
+  FRENSIE_CHECK( recorder_a.getSurfaces().count( 3 ) );
+  FRENSIE_CHECK( recorder_a.getParticleTypes().empty() );
+
+  MonteCarlo::SurfaceSourceRecorder recorder_b( {2}, {MonteCarlo::PHOTON} );
+
+  FRENSIE_CHECK_EQUAL( recorder_b.getSurfaces().size(), 1 );
+  FRENSIE_CHECK( recorder_b.getSurfaces().count( 2 ) );
+  FRENSIE_CHECK_EQUAL( recorder_b.getParticleTypes().size(), 1 );
+  FRENSIE_CHECK( recorder_b.getParticleTypes().count( MonteCarlo::PHOTON ) );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::SurfaceSourceRecorder( std::set<uint64_t>() ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that surface crossings are only recorded when a file is set
+FRENSIE_UNIT_TEST( SurfaceSourceRecorder, setSurfaceSourceFile )
+{
+  MonteCarlo::SurfaceSourceRecorder recorder( {1} );
+
+  FRENSIE_CHECK( !recorder.isSurfaceSourceFileSet() );
+  FRENSIE_CHECK( !recorder.hasUncommittedHistoryContribution() );
+
+  recorder.setSurfaceSourceFile( "test_surface_source_recorder_a.ssrc" );
+
+  FRENSIE_CHECK( recorder.isSurfaceSourceFileSet() );
+
+  // Every history must be committed so that the source histories are counted
+  FRENSIE_CHECK( recorder.hasUncommittedHistoryContribution() );
+
+  recorder.closeSurfaceSourceFile();
+
+  FRENSIE_CHECK( !recorder.isSurfaceSourceFileSet() );
+  FRENSIE_CHECK( !recorder.hasUncommittedHistoryContribution() );
+
+  MonteCarlo::SurfaceSourceFileReader reader(
+               getProcessFileName( "test_surface_source_recorder_a.ssrc" ) );
+
+  FRENSIE_CHECK_EQUAL( reader.getNumberOfSourceHistories(), 0 );
+  FRENSIE_CHECK_EQUAL( reader.getNumberOfStoredHistories(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that surface crossings can be written to a surface source file
+FRENSIE_UNIT_TEST( SurfaceSourceRecorder, updateFromParticleCrossingSurfaceEvent )
+{
+  MonteCarlo::SurfaceSourceRecorder recorder( {1}, {MonteCarlo::PHOTON} );
+
+  unsigned threads = Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  recorder.enableThreadSupport( threads );
+
+  // Use a tiny chunk size so that every history is flushed immediately
+  recorder.setSurfaceSourceFile( "test_surface_source_recorder_b.ssrc", 1 );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    for( size_t i = 0; i < 4; ++i )
+    {
+      const uint64_t history =
+        Utility::OpenMPProperties::getThreadId()*4 + i;
+
+      // Only the even histories cross the surface
+      if( history % 2 == 0 )
+      {
+        MonteCarlo::PhotonState photon( history );
+        photon.setPosition( 1.0, 2.0, 3.0 );
+        photon.setDirection( 0.0, 0.0, 1.0 );
+        photon.setEnergy( 2.5 );
+        photon.setTime( 5e-11 );
+        photon.setWeight( 0.5 );
+
+        recorder.updateFromParticleCrossingSurfaceEvent( photon, 1, 1.0 );
+
+        // Electrons are not recorded
+        MonteCarlo::ElectronState electron( history );
+        electron.setPosition( 1.0, 2.0, 3.0 );
+        electron.setDirection( 0.0, 0.0, 1.0 );
+        electron.setEnergy( 1.0 );
+
+        recorder.updateFromParticleCrossingSurfaceEvent( electron, 1, 1.0 );
+      }
+
+      if( recorder.hasUncommittedHistoryContribution() )
+        recorder.commitHistoryContribution();
+    }
+  }
+
+  recorder.closeSurfaceSourceFile();
+
+  MonteCarlo::SurfaceSourceFileReader reader(
+               getProcessFileName( "test_surface_source_recorder_b.ssrc" ) );
+
+  FRENSIE_CHECK_EQUAL( reader.getNumberOfSourceHistories(), 4*threads );
+  FRENSIE_REQUIRE_EQUAL( reader.getNumberOfStoredHistories(), 2*threads );
+
+  // Every history number from 0 to 4*threads-1 was added so the history
+  // ordinals are equal to the history numbers
+  for( size_t i = 0; i < reader.getNumberOfStoredHistories(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( reader.getStoredHistoryNumber( i ), 2*i );
+    FRENSIE_CHECK_EQUAL( reader.getStoredHistoryOrdinal( i ), 2*i );
+  }
+
+  FRENSIE_CHECK( reader.isHistoryInFile( 0 ) );
+  FRENSIE_CHECK( !reader.isHistoryInFile( 1 ) );
+  FRENSIE_CHECK( reader.isHistoryOrdinalInFile( 0 ) );
+  FRENSIE_CHECK( !reader.isHistoryOrdinalInFile( 1 ) );
+
+  std::vector<MonteCarlo::SurfaceSourceParticleRecord> particles;
+
+  reader.readHistory( 2, particles );
+
+  FRENSIE_REQUIRE_EQUAL( particles.size(), 1 );
+  FRENSIE_CHECK_EQUAL( particles[0].particle_type, MonteCarlo::PHOTON );
+  FRENSIE_CHECK_EQUAL( particles[0].surface_id, 1 );
+  FRENSIE_CHECK_EQUAL( particles[0].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].position[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].position[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].direction[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].direction[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].direction[2], 1.0 );
+  FRENSIE_CHECK_EQUAL( particles[0].energy, 2.5 );
+  FRENSIE_CHECK_EQUAL( particles[0].time, 5e-11 );
+  FRENSIE_CHECK_EQUAL( particles[0].weight, 0.5 );
+
+  FRENSIE_CHECK_THROW( reader.readHistory( 1, particles ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( reader.readHistoryWithOrdinal( 1, particles ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the history ordinals only count the histories in the file
+FRENSIE_UNIT_TEST( SurfaceSourceFileReader, getStoredHistoryOrdinal )
+{
+  // Write a file that only received the history numbers 100-103 and
+  // 200-201 (e.g. one process of a distributed run)
+  {
+    MonteCarlo::SurfaceSourceFileWriter
+      writer( "test_surface_source_reader_ordinals.ssrc" );
+
+    MonteCarlo::SurfaceSourceParticleRecord record;
+    record.particle_type = MonteCarlo::PHOTON;
+    record.surface_id = 1;
+    record.position[0] = 0.0;
+    record.position[1] = 0.0;
+    record.position[2] = 0.0;
+    record.direction[0] = 0.0;
+    record.direction[1] = 0.0;
+    record.direction[2] = 1.0;
+    record.time = 0.0;
+    record.weight = 1.0;
+
+    record.energy = 1.0;
+    writer.addHistory( 200, {record} );
+
+    writer.addHistory( 100, {} );
+
+    record.energy = 2.0;
+    writer.addHistory( 101, {record} );
+
+    writer.addHistory( 102, {} );
+    writer.addHistory( 201, {} );
+
+    record.energy = 3.0;
+    writer.addHistory( 103, {record} );
+
+    writer.close();
+  }
+
+  MonteCarlo::SurfaceSourceFileReader
+    reader( "test_surface_source_reader_ordinals.ssrc" );
+
+  FRENSIE_CHECK_EQUAL( reader.getNumberOfSourceHistories(), 6 );
+  FRENSIE_REQUIRE_EQUAL( reader.getNumberOfStoredHistories(), 3 );
+
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryNumber( 0 ), 101 );
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryOrdinal( 0 ), 1 );
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryNumber( 1 ), 103 );
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryOrdinal( 1 ), 3 );
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryNumber( 2 ), 200 );
+  FRENSIE_CHECK_EQUAL( reader.getStoredHistoryOrdinal( 2 ), 4 );
+
+  FRENSIE_CHECK( !reader.isHistoryOrdinalInFile( 0 ) );
+  FRENSIE_CHECK( reader.isHistoryOrdinalInFile( 1 ) );
+  FRENSIE_CHECK( !reader.isHistoryOrdinalInFile( 2 ) );
+  FRENSIE_CHECK( reader.isHistoryOrdinalInFile( 3 ) );
+  FRENSIE_CHECK( reader.isHistoryOrdinalInFile( 4 ) );
+  FRENSIE_CHECK( !reader.isHistoryOrdinalInFile( 5 ) );
+
+  std::vector<MonteCarlo::SurfaceSourceParticleRecord> particles;
+
+  reader.readHistoryWithOrdinal( 3, particles );
+
+  FRENSIE_REQUIRE_EQUAL( particles.size(), 1 );
+  FRENSIE_CHECK_EQUAL( particles[0].energy, 3.0 );
+
+  reader.readHistoryWithOrdinal( 4, particles );
+
+  FRENSIE_REQUIRE_EQUAL( particles.size(), 1 );
+  FRENSIE_CHECK_EQUAL( particles[0].energy, 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a file that is not a surface source file is rejected
+FRENSIE_UNIT_TEST( SurfaceSourceFileReader, constructor_invalid_file )
+{
+  FRENSIE_CHECK_THROW( MonteCarlo::SurfaceSourceFileReader( "dummy.ssrc" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a recorder can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SurfaceSourceRecorder,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_surface_source_recorder" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::SurfaceSourceRecorder>
+      recorder( new MonteCarlo::SurfaceSourceRecorder( {1, 2}, {MonteCarlo::NEUTRON} ) );
+
+    std::shared_ptr<const MonteCarlo::ParticleHistoryObserver>
+      history_observer = recorder;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( recorder ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( history_observer ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived recorder
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::SurfaceSourceRecorder> recorder;
+
+  std::shared_ptr<const MonteCarlo::ParticleHistoryObserver> history_observer;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( recorder ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( history_observer ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( recorder->getSurfaces().size(), 2 );
+  FRENSIE_CHECK( recorder->getSurfaces().count( 1 ) );
+  FRENSIE_CHECK( recorder->getSurfaces().count( 2 ) );
+  FRENSIE_CHECK_EQUAL( recorder->getParticleTypes().size(), 1 );
+  FRENSIE_CHECK( recorder->getParticleTypes().count( MonteCarlo::NEUTRON ) );
+
+  // The file writer is not archived
+  FRENSIE_CHECK( !recorder->isSurfaceSourceFileSet() );
+  FRENSIE_CHECK( history_observer.get() == recorder.get() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstSurfaceSourceRecorder.cpp
+//---------------------------------------------------------------------------//
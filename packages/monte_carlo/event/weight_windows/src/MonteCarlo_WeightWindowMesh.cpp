@@ -6,55 +6,281 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
 // Constructor
+/*! \details The default upper weight bound ratio is 5, the default survival
+ * weight ratio is 3 and the default max split number is 10.
+ */
 WeightWindowMesh::WeightWindowMesh()
-  : d_meshes()
+  : d_meshes(),
+    d_lower_weight_bounds(),
+    d_upper_weight_bound_ratio( 5.0 ),
+    d_survival_weight_ratio( 3.0 ),
+    d_max_split_number( 10 )
 { /* ... */ }
 
 // Set the mesh for a particle
+/*! \details Any lower weight bounds that have already been set for the
+ * particle type will be removed.
+ */
 void WeightWindowMesh::setMesh(
                               const std::shared_ptr<const Utility::Mesh>& mesh,
                               const ParticleType particle_type )
 {
   // Make sure that the mesh pointer is valid
   testPrecondition( mesh.get() );
-  
+
   d_meshes[particle_type] = mesh;
+
+  d_lower_weight_bounds.erase( particle_type );
+}
+
+// Set the lower weight bounds for a particle
+/*! \details The mesh for the particle type must be set first. Elements that
+ * do not have a lower weight bound will not be affected by the windows.
+ */
+void WeightWindowMesh::setLowerWeightBounds(
+                const ParticleType particle_type,
+                const ElementHandleLowerWeightBoundMap& lower_weight_bounds )
+{
+  TEST_FOR_EXCEPTION( d_meshes.find( particle_type ) == d_meshes.end(),
+                      std::runtime_error,
+                      "The lower weight bounds for " << particle_type <<
+                      "s cannot be set because a mesh has not been set!" );
+
+  ElementHandleLowerWeightBoundMap::const_iterator lower_weight_bound_it =
+    lower_weight_bounds.begin();
+
+  while( lower_weight_bound_it != lower_weight_bounds.end() )
+  {
+    TEST_FOR_EXCEPTION( lower_weight_bound_it->second < 0.0,
+                        std::runtime_error,
+                        "The lower weight bound of mesh element "
+                        << lower_weight_bound_it->first << " is not valid ("
+                        << lower_weight_bound_it->second << ")!" );
+
+    ++lower_weight_bound_it;
+  }
+
+  d_lower_weight_bounds[particle_type] = lower_weight_bounds;
+}
+
+// Return the lower weight bounds for a particle
+const WeightWindowMesh::ElementHandleLowerWeightBoundMap&
+WeightWindowMesh::getLowerWeightBounds( const ParticleType particle_type ) const
+{
+  ParticleTypeLowerWeightBoundMap::const_iterator lower_weight_bounds_it =
+    d_lower_weight_bounds.find( particle_type );
+
+  TEST_FOR_EXCEPTION( lower_weight_bounds_it == d_lower_weight_bounds.end(),
+                      std::runtime_error,
+                      "Lower weight bounds have not been set for "
+                      << particle_type << "s!" );
+
+  return lower_weight_bounds_it->second;
+}
+
+// Return the lower weight bound at a point for a particle
+/*! \details If the point is not in the mesh or a lower weight bound has not
+ * been set for the element that contains the point zero will be returned.
+ */
+double WeightWindowMesh::getLowerWeightBound( const ParticleType particle_type,
+                                              const double position[3] ) const
+{
+  ParticleTypeMeshMap::const_iterator mesh_it =
+    d_meshes.find( particle_type );
+
+  if( mesh_it == d_meshes.end() )
+    return 0.0;
+
+  ParticleTypeLowerWeightBoundMap::const_iterator lower_weight_bounds_it =
+    d_lower_weight_bounds.find( particle_type );
+
+  if( lower_weight_bounds_it == d_lower_weight_bounds.end() )
+    return 0.0;
+
+  if( !mesh_it->second->isPointInMesh( position ) )
+    return 0.0;
+
+  ElementHandleLowerWeightBoundMap::const_iterator lower_weight_bound_it =
+    lower_weight_bounds_it->second.find(
+                          mesh_it->second->whichElementIsPointIn( position ) );
+
+  if( lower_weight_bound_it == lower_weight_bounds_it->second.end() )
+    return 0.0;
+  else
+    return lower_weight_bound_it->second;
+}
+
+// Set the upper weight bound ratio (upper bound/lower bound)
+void WeightWindowMesh::setUpperWeightBoundRatio(
+                                        const double upper_weight_bound_ratio )
+{
+  TEST_FOR_EXCEPTION( upper_weight_bound_ratio <= 1.0,
+                      std::runtime_error,
+                      "The upper weight bound ratio must be greater than 1!" );
+  TEST_FOR_EXCEPTION( upper_weight_bound_ratio < d_survival_weight_ratio,
+                      std::runtime_error,
+                      "The upper weight bound ratio cannot be less than the "
+                      "survival weight ratio!" );
+
+  d_upper_weight_bound_ratio = upper_weight_bound_ratio;
+}
+
+// Return the upper weight bound ratio
+double WeightWindowMesh::getUpperWeightBoundRatio() const
+{
+  return d_upper_weight_bound_ratio;
+}
+
+// Set the survival weight ratio (survival weight/lower bound)
+void WeightWindowMesh::setSurvivalWeightRatio(
+                                           const double survival_weight_ratio )
+{
+  TEST_FOR_EXCEPTION( survival_weight_ratio < 1.0,
+                      std::runtime_error,
+                      "The survival weight ratio must be at least 1!" );
+  TEST_FOR_EXCEPTION( survival_weight_ratio > d_upper_weight_bound_ratio,
+                      std::runtime_error,
+                      "The survival weight ratio cannot be greater than the "
+                      "upper weight bound ratio!" );
+
+  d_survival_weight_ratio = survival_weight_ratio;
+}
+
+// Return the survival weight ratio
+double WeightWindowMesh::getSurvivalWeightRatio() const
+{
+  return d_survival_weight_ratio;
+}
+
+// Set the max number of particles that a particle can be split into
+void WeightWindowMesh::setMaxSplitNumber( const unsigned max_split_number )
+{
+  TEST_FOR_EXCEPTION( max_split_number < 2,
+                      std::runtime_error,
+                      "The max split number must be at least 2!" );
+
+  d_max_split_number = max_split_number;
+}
+
+// Return the max number of particles that a particle can be split into
+unsigned WeightWindowMesh::getMaxSplitNumber() const
+{
+  return d_max_split_number;
+}
+
+// Export the lower weight bounds (type determined by suffix - e.g. ww.vtk)
+void WeightWindowMesh::exportData( const std::string& output_file_name,
+                                   const ParticleType particle_type ) const
+{
+  ParticleTypeMeshMap::const_iterator mesh_it =
+    d_meshes.find( particle_type );
+
+  TEST_FOR_EXCEPTION( mesh_it == d_meshes.end(),
+                      std::runtime_error,
+                      "A mesh has not been set for " << particle_type <<
+                      "s!" );
+
+  const ElementHandleLowerWeightBoundMap& lower_weight_bounds =
+    this->getLowerWeightBounds( particle_type );
+
+  Utility::Mesh::TagNameSet tag_name_set( {"lower_weight_bound: "} );
+
+  Utility::Mesh::MeshElementHandleDataMap element_data_map;
+
+  Utility::Mesh::ElementHandleIterator element_it =
+    mesh_it->second->getStartElementHandleIterator();
+
+  Utility::Mesh::ElementHandleIterator end_element_it =
+    mesh_it->second->getEndElementHandleIterator();
+
+  while( element_it != end_element_it )
+  {
+    ElementHandleLowerWeightBoundMap::const_iterator lower_weight_bound_it =
+      lower_weight_bounds.find( *element_it );
+
+    const double lower_weight_bound =
+      (lower_weight_bound_it != lower_weight_bounds.end() ?
+       lower_weight_bound_it->second : 0.0);
+
+    element_data_map[*element_it]["lower_weight_bound: "].push_back(
+                         std::make_pair( std::string(), lower_weight_bound ) );
+
+    ++element_it;
+  }
+
+  mesh_it->second->exportData( output_file_name,
+                               tag_name_set,
+                               element_data_map );
 }
 
 // Update the particle state and bank
+/*! \details If the particle weight is above the upper weight bound the
+ * particle will be split into n = ceil(weight/upper bound) particles (n will
+ * not exceed the max split number). The split particles will be added to the
+ * bank. If the particle weight is below the lower weight bound the particle
+ * will be rouletted. The survival probabilty of the particle is
+ * 'particle weight'/'survival weight'. If the particle survives its new weight
+ * is set to the 'survival weight'.
+ */
 void WeightWindowMesh::updateParticleState( ParticleState& particle,
                                             ParticleBank& bank ) const
 {
-  ParticleTypeMeshMap::const_iterator mesh_it =
-    d_meshes.find( particle.getParticleType() );
-  
-  if( mesh_it != d_meshes.end() )
+  const double lower_weight_bound =
+    this->getLowerWeightBound( particle.getParticleType(),
+                               particle.getPosition() );
+
+  // The particle is not in a window
+  if( lower_weight_bound <= 0.0 )
+    return;
+
+  const double weight = particle.getWeight();
+
+  const double upper_weight_bound =
+    lower_weight_bound*d_upper_weight_bound_ratio;
+
+  // Split
+  if( weight > upper_weight_bound )
   {
-    // Determine if the particle needs to be killed, split or left alone
-    std::shared_ptr<ParticleState> split_particle;
-  
-    // Killed
-    // particle.setAsGone();
-
-    // Split
-    // particle.setWeight( x );
-    // split_particle.reset( particle.clone() );
-
-    // Add the split particle to the bank
-    if( split_particle )
-      bank.push( split_particle );
+    unsigned split_number =
+      (unsigned)std::min( std::ceil( weight/upper_weight_bound ),
+                          (double)d_max_split_number );
+
+    particle.multiplyWeight( 1.0/split_number );
+
+    // Add the split particles to the bank
+    for( unsigned i = 1; i < split_number; ++i )
+      bank.push( particle );
+  }
+  // Roulette
+  else if( weight < lower_weight_bound )
+  {
+    const double survival_weight =
+      lower_weight_bound*d_survival_weight_ratio;
+
+    const double random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    if( random_number > weight/survival_weight )
+      particle.setAsGone();
+    else
+      particle.setWeight( survival_weight );
   }
 }
-  
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( WeightWindowMesh, MonteCarlo );
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <string>
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
@@ -19,12 +20,23 @@
 
 namespace MonteCarlo{
 
-//! The weight window mesh class
+/*! The weight window mesh class
+ * \details A lower weight bound is assigned to every element of a particle's
+ * mesh. The upper weight bound and the survival weight of an element are
+ * calculated from the lower weight bound using the upper weight bound ratio
+ * and the survival weight ratio. Particles with a weight above the upper
+ * weight bound will be split and particles with a weight below the lower
+ * weight bound will be rouletted. Elements with a lower weight bound of zero
+ * (or particles outside of the mesh) will not be affected by the windows.
+ */
 class WeightWindowMesh : public WeightWindow
 {
 
 public:
 
+  //! The element handle lower weight bound map
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,double> ElementHandleLowerWeightBoundMap;
+
   //! Constructor
   WeightWindowMesh();
 
@@ -36,17 +48,51 @@ public:
   void setMesh( const std::shared_ptr<const Utility::Mesh>& mesh,
                 const ParticleType particle_type );
 
+  //! Set the lower weight bounds for a particle
+  void setLowerWeightBounds( const ParticleType particle_type,
+                             const ElementHandleLowerWeightBoundMap& lower_weight_bounds );
+
+  //! Return the lower weight bounds for a particle
+  const ElementHandleLowerWeightBoundMap& getLowerWeightBounds(
+                                    const ParticleType particle_type ) const;
+
+  //! Return the lower weight bound at a point for a particle
+  double getLowerWeightBound( const ParticleType particle_type,
+                              const double position[3] ) const;
+
+  //! Set the upper weight bound ratio (upper bound/lower bound)
+  void setUpperWeightBoundRatio( const double upper_weight_bound_ratio );
+
+  //! Return the upper weight bound ratio
+  double getUpperWeightBoundRatio() const;
+
+  //! Set the survival weight ratio (survival weight/lower bound)
+  void setSurvivalWeightRatio( const double survival_weight_ratio );
+
+  //! Return the survival weight ratio
+  double getSurvivalWeightRatio() const;
+
+  //! Set the max number of particles that a particle can be split into
+  void setMaxSplitNumber( const unsigned max_split_number );
+
+  //! Return the max number of particles that a particle can be split into
+  unsigned getMaxSplitNumber() const;
+
+  //! Export the lower weight bounds (type determined by suffix - e.g. ww.vtk)
+  void exportData( const std::string& output_file_name,
+                   const ParticleType particle_type ) const;
+
   //! Update the particle state and bank
   void updateParticleState( ParticleState& particle,
                             ParticleBank& bank ) const final override;
 
 private:
 
-  // Save the collision forcer data to an archive
+  // Save the weight window data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
 
-  // Load the collision forcer data from an archive
+  // Load the weight window data from an archive
   template<typename Archive>
   void load( Archive& ar, const unsigned version );
 
@@ -58,25 +104,56 @@ private:
   // The weight window meshes
   typedef std::map<ParticleType,std::shared_ptr<const Utility::Mesh> > ParticleTypeMeshMap;
   ParticleTypeMeshMap d_meshes;
+
+  // The lower weight bounds
+  typedef std::map<ParticleType,ElementHandleLowerWeightBoundMap> ParticleTypeLowerWeightBoundMap;
+  ParticleTypeLowerWeightBoundMap d_lower_weight_bounds;
+
+  // The upper weight bound ratio
+  double d_upper_weight_bound_ratio;
+
+  // The survival weight ratio
+  double d_survival_weight_ratio;
+
+  // The max split number
+  unsigned d_max_split_number;
 };
 
-// Save the collision forcer data to an archive
+// Save the weight window data to an archive
 template<typename Archive>
 void WeightWindowMesh::save( Archive& ar, const unsigned version ) const
 {
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindow );
   ar & BOOST_SERIALIZATION_NVP( d_meshes );
+  ar & BOOST_SERIALIZATION_NVP( d_lower_weight_bounds );
+  ar & BOOST_SERIALIZATION_NVP( d_upper_weight_bound_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_survival_weight_ratio );
+  ar & BOOST_SERIALIZATION_NVP( d_max_split_number );
 }
 
-// Load the collision forcer data from an archive
+// Load the weight window data from an archive
 template<typename Archive>
 void WeightWindowMesh::load( Archive& ar, const unsigned version )
 {
-  ar & BOOST_SERIALIZATION_NVP( d_meshes );
+  // Archives created before the lower weight bounds were added only have
+  // the meshes - the windows will have no effect and the default ratios
+  // will be used
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindow );
+    ar & BOOST_SERIALIZATION_NVP( d_meshes );
+    ar & BOOST_SERIALIZATION_NVP( d_lower_weight_bounds );
+    ar & BOOST_SERIALIZATION_NVP( d_upper_weight_bound_ratio );
+    ar & BOOST_SERIALIZATION_NVP( d_survival_weight_ratio );
+    ar & BOOST_SERIALIZATION_NVP( d_max_split_number );
+  }
+  else
+    ar & BOOST_SERIALIZATION_NVP( d_meshes );
 }
   
 } // end MonteCarlo namespace
 
-BOOST_CLASS_VERSION( MonteCarlo::WeightWindowMesh, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::WeightWindowMesh, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightWindowMesh, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, WeightWindowMesh );
 
@@ -0,0 +1,300 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <set>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details By default all fluxes with a relative error less than 1 will be
+ * used.
+ */
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                             const std::shared_ptr<const Utility::Mesh>& mesh )
+  : d_mesh( mesh ),
+    d_window_centers(),
+    d_max_relative_error( 1.0 ),
+    d_weight_window_mesh( new WeightWindowMesh )
+{
+  // Make sure that the mesh pointer is valid
+  testPrecondition( mesh.get() );
+}
+
+// Set the upper weight bound ratio (upper bound/lower bound)
+/*! \details The lower weight bounds of any weight windows that have already
+ * been generated will be recalculated.
+ */
+void WeightWindowMeshGenerator::setUpperWeightBoundRatio(
+                                        const double upper_weight_bound_ratio )
+{
+  d_weight_window_mesh->setUpperWeightBoundRatio( upper_weight_bound_ratio );
+
+  for( auto&& window_centers : d_window_centers )
+    this->setLowerWeightBounds( window_centers.first );
+}
+
+// Return the upper weight bound ratio
+double WeightWindowMeshGenerator::getUpperWeightBoundRatio() const
+{
+  return d_weight_window_mesh->getUpperWeightBoundRatio();
+}
+
+// Set the survival weight ratio (survival weight/lower bound)
+void WeightWindowMeshGenerator::setSurvivalWeightRatio(
+                                           const double survival_weight_ratio )
+{
+  d_weight_window_mesh->setSurvivalWeightRatio( survival_weight_ratio );
+}
+
+// Return the survival weight ratio
+double WeightWindowMeshGenerator::getSurvivalWeightRatio() const
+{
+  return d_weight_window_mesh->getSurvivalWeightRatio();
+}
+
+// Set the max relative error of a flux that will be used
+void WeightWindowMeshGenerator::setMaxRelativeError(
+                                              const double max_relative_error )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than 0!" );
+
+  d_max_relative_error = max_relative_error;
+}
+
+// Return the max relative error of a flux that will be used
+double WeightWindowMeshGenerator::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Generate the weight windows from forward fluxes (mean, relative error)
+/*! \details The window center of the element with the max flux will be the
+ * reference weight (usually the source particle weight).
+ */
+void WeightWindowMeshGenerator::generateFromForwardFlux(
+                                    const ParticleType particle_type,
+                                    const ElementHandleFluxMap& element_fluxes,
+                                    const double reference_weight )
+{
+  TEST_FOR_EXCEPTION( reference_weight <= 0.0,
+                      std::runtime_error,
+                      "The reference weight must be greater than 0!" );
+
+  // Find the max usable flux
+  double max_flux = 0.0;
+
+  for( auto&& element_flux : element_fluxes )
+  {
+    if( this->isElementFluxUsable( element_flux.second ) )
+    {
+      if( element_flux.second.first > max_flux )
+        max_flux = element_flux.second.first;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( max_flux == 0.0,
+                      std::runtime_error,
+                      "The weight windows cannot be generated because there "
+                      "are no usable forward fluxes!" );
+
+  WeightWindowMesh::ElementHandleLowerWeightBoundMap centers;
+
+  for( auto&& element_flux : element_fluxes )
+  {
+    if( this->isElementFluxUsable( element_flux.second ) )
+    {
+      centers[element_flux.first] =
+        reference_weight*element_flux.second.first/max_flux;
+    }
+  }
+
+  this->setWindowCenters( particle_type, centers );
+}
+
+// Generate the weight windows from a forward mesh estimator
+/*! \details The total (bin integrated) flux of the first response function
+ * will be used.
+ */
+void WeightWindowMeshGenerator::generateFromForwardFlux(
+                                        const ParticleType particle_type,
+                                        const Estimator& mesh_estimator,
+                                        const double reference_weight )
+{
+  ElementHandleFluxMap element_fluxes;
+
+  this->extractElementFluxes( mesh_estimator, element_fluxes );
+
+  this->generateFromForwardFlux( particle_type,
+                                 element_fluxes,
+                                 reference_weight );
+}
+
+// Generate the weight windows from adjoint fluxes (mean, relative error)
+/*! \details The window center of the element that contains the source point
+ * will be the source weight.
+ */
+void WeightWindowMeshGenerator::generateFromAdjointFlux(
+                                    const ParticleType particle_type,
+                                    const ElementHandleFluxMap& element_fluxes,
+                                    const double source_point[3],
+                                    const double source_weight )
+{
+  TEST_FOR_EXCEPTION( source_weight <= 0.0,
+                      std::runtime_error,
+                      "The source weight must be greater than 0!" );
+
+  TEST_FOR_EXCEPTION( !d_mesh->isPointInMesh( source_point ),
+                      std::runtime_error,
+                      "The weight windows cannot be generated because the "
+                      "source point is not in the mesh!" );
+
+  ElementHandleFluxMap::const_iterator source_element_flux_it =
+    element_fluxes.find( d_mesh->whichElementIsPointIn( source_point ) );
+
+  TEST_FOR_EXCEPTION( source_element_flux_it == element_fluxes.end() ||
+                      !this->isElementFluxUsable( source_element_flux_it->second ),
+                      std::runtime_error,
+                      "The weight windows cannot be generated because the "
+                      "adjoint flux at the source point is not usable!" );
+
+  const double source_adjoint_flux = source_element_flux_it->second.first;
+
+  WeightWindowMesh::ElementHandleLowerWeightBoundMap centers;
+
+  for( auto&& element_flux : element_fluxes )
+  {
+    if( this->isElementFluxUsable( element_flux.second ) )
+    {
+      centers[element_flux.first] =
+        source_weight*source_adjoint_flux/element_flux.second.first;
+    }
+  }
+
+  this->setWindowCenters( particle_type, centers );
+}
+
+// Generate the weight windows from an adjoint mesh estimator
+/*! \details The total (bin integrated) flux of the first response function
+ * will be used.
+ */
+void WeightWindowMeshGenerator::generateFromAdjointFlux(
+                                        const ParticleType particle_type,
+                                        const Estimator& mesh_estimator,
+                                        const double source_point[3],
+                                        const double source_weight )
+{
+  ElementHandleFluxMap element_fluxes;
+
+  this->extractElementFluxes( mesh_estimator, element_fluxes );
+
+  this->generateFromAdjointFlux( particle_type,
+                                 element_fluxes,
+                                 source_point,
+                                 source_weight );
+}
+
+// Return the weight window mesh
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshGenerator::getWeightWindowMesh() const
+{
+  return d_weight_window_mesh;
+}
+
+// Extract the element fluxes from a mesh estimator
+void WeightWindowMeshGenerator::extractElementFluxes(
+                                   const Estimator& mesh_estimator,
+                                   ElementHandleFluxMap& element_fluxes ) const
+{
+  TEST_FOR_EXCEPTION( !mesh_estimator.isMeshEstimator(),
+                      std::runtime_error,
+                      "Estimator " << mesh_estimator.getId() << " cannot be "
+                      "used to generate weight windows because it is not a "
+                      "mesh estimator!" );
+
+  std::set<Estimator::EntityId> entity_ids;
+
+  mesh_estimator.getEntityIds( entity_ids );
+
+  element_fluxes.clear();
+
+  for( auto&& entity_id : entity_ids )
+  {
+    std::vector<double> mean, relative_error, variance_of_variance,
+      figure_of_merit;
+
+    mesh_estimator.getEntityTotalProcessedData( entity_id,
+                                                mean,
+                                                relative_error,
+                                                variance_of_variance,
+                                                figure_of_merit );
+
+    if( !mean.empty() )
+    {
+      element_fluxes[entity_id] =
+        std::make_pair( mean.front(), relative_error.front() );
+    }
+  }
+}
+
+// Check if an element flux can be used
+/*! \details Fluxes that have not been scored will have a relative error of
+ * zero and a mean of zero - they will not be used.
+ */
+bool WeightWindowMeshGenerator::isElementFluxUsable(
+                               const std::pair<double,double>& flux ) const
+{
+  return flux.first > 0.0 && flux.second <= d_max_relative_error;
+}
+
+// Set the window centers
+void WeightWindowMeshGenerator::setWindowCenters(
+        const ParticleType particle_type,
+        const WeightWindowMesh::ElementHandleLowerWeightBoundMap& centers )
+{
+  d_window_centers[particle_type] = centers;
+
+  d_weight_window_mesh->setMesh( d_mesh, particle_type );
+
+  this->setLowerWeightBounds( particle_type );
+}
+
+// Set the lower weight bounds from the window centers
+/*! \details The current upper weight bound ratio will be used.
+ */
+void WeightWindowMeshGenerator::setLowerWeightBounds(
+                                             const ParticleType particle_type )
+{
+  // Make sure that the window centers have been set
+  testPrecondition( d_window_centers.find( particle_type ) !=
+                    d_window_centers.end() );
+
+  const double center_to_lower_bound =
+    2.0/(1.0 + d_weight_window_mesh->getUpperWeightBoundRatio());
+
+  WeightWindowMesh::ElementHandleLowerWeightBoundMap lower_weight_bounds;
+
+  for( auto&& center : d_window_centers.find( particle_type )->second )
+    lower_weight_bounds[center.first] = center.second*center_to_lower_bound;
+
+  d_weight_window_mesh->setLowerWeightBounds( particle_type,
+                                              lower_weight_bounds );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_Mesh.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ * \details The generator creates the lower weight bounds of a
+ * MonteCarlo::WeightWindowMesh from the mesh element fluxes of a completed
+ * simulation (e.g. from a MonteCarlo::MeshTrackLengthFluxEstimator). Two
+ * methods are supported. The forward method (MAGIC) makes the window center
+ * in each element proportional to the element's forward flux:
+ * \f$w_{c,i} = w_{ref}\phi_i/\phi_{max}\f$. Repeating the forward simulation
+ * with the generated windows and regenerating the windows from the new flux
+ * will spread the particles further into the problem with each iteration.
+ * The adjoint method (CADIS) makes the window center in each element
+ * inversely proportional to the element's adjoint flux (importance):
+ * \f$w_{c,i} = w_{src}\phi^{\dagger}_{src}/\phi^{\dagger}_i\f$, where
+ * \f$\phi^{\dagger}_{src}\f$ is the adjoint flux in the element that contains
+ * the source point. The lower weight bound of each element is calculated from
+ * the window center using \f$w_{l,i} = 2w_{c,i}/(1+r)\f$ where \f$r\f$ is the
+ * upper weight bound ratio. The window centers are stored so that the lower
+ * weight bounds can be recalculated when the upper weight bound ratio is
+ * changed after the windows have been generated (the ratio must be changed
+ * with the generator and not with the generated weight window mesh). Elements
+ * with a flux of zero or a flux with a relative error above the max relative
+ * error will not be assigned a window.
+ * The generated weight window mesh can be assigned to a
+ * MonteCarlo::ParticleSimulationManagerFactory (and will be saved with the
+ * factory when it is archived).
+ */
+class WeightWindowMeshGenerator
+{
+
+public:
+
+  //! The element handle flux map
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::pair<double,double> > ElementHandleFluxMap;
+
+  //! Constructor
+  WeightWindowMeshGenerator( const std::shared_ptr<const Utility::Mesh>& mesh );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Set the upper weight bound ratio (upper bound/lower bound)
+  void setUpperWeightBoundRatio( const double upper_weight_bound_ratio );
+
+  //! Return the upper weight bound ratio
+  double getUpperWeightBoundRatio() const;
+
+  //! Set the survival weight ratio (survival weight/lower bound)
+  void setSurvivalWeightRatio( const double survival_weight_ratio );
+
+  //! Return the survival weight ratio
+  double getSurvivalWeightRatio() const;
+
+  //! Set the max relative error of a flux that will be used
+  void setMaxRelativeError( const double max_relative_error );
+
+  //! Return the max relative error of a flux that will be used
+  double getMaxRelativeError() const;
+
+  //! Generate the weight windows from forward fluxes (mean, relative error)
+  void generateFromForwardFlux( const ParticleType particle_type,
+                                const ElementHandleFluxMap& element_fluxes,
+                                const double reference_weight = 1.0 );
+
+  //! Generate the weight windows from a forward mesh estimator
+  void generateFromForwardFlux( const ParticleType particle_type,
+                                const Estimator& mesh_estimator,
+                                const double reference_weight = 1.0 );
+
+  //! Generate the weight windows from adjoint fluxes (mean, relative error)
+  void generateFromAdjointFlux( const ParticleType particle_type,
+                                const ElementHandleFluxMap& element_fluxes,
+                                const double source_point[3],
+                                const double source_weight = 1.0 );
+
+  //! Generate the weight windows from an adjoint mesh estimator
+  void generateFromAdjointFlux( const ParticleType particle_type,
+                                const Estimator& mesh_estimator,
+                                const double source_point[3],
+                                const double source_weight = 1.0 );
+
+  //! Return the weight window mesh
+  std::shared_ptr<WeightWindowMesh> getWeightWindowMesh() const;
+
+private:
+
+  // Extract the element fluxes from a mesh estimator
+  void extractElementFluxes( const Estimator& mesh_estimator,
+                             ElementHandleFluxMap& element_fluxes ) const;
+
+  // Check if an element flux can be used
+  bool isElementFluxUsable( const std::pair<double,double>& flux ) const;
+
+  // Set the window centers
+  void setWindowCenters(
+       const ParticleType particle_type,
+       const WeightWindowMesh::ElementHandleLowerWeightBoundMap& centers );
+
+  // Set the lower weight bounds from the window centers
+  void setLowerWeightBounds( const ParticleType particle_type );
+
+  // The mesh
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The window centers
+  typedef std::map<ParticleType,WeightWindowMesh::ElementHandleLowerWeightBoundMap> ParticleTypeWindowCenterMap;
+  ParticleTypeWindowCenterMap d_window_centers;
+
+  // The max relative error
+  double d_max_relative_error;
+
+  // The weight window mesh
+  std::shared_ptr<WeightWindowMesh> d_weight_window_mesh;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,255 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMesh.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> mesh;
+
+Utility::Mesh::ElementHandle first_element, second_element;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a weight window mesh with a lower bound of 1.0 in the first element
+// and 0.1 in the second element
+std::shared_ptr<MonteCarlo::WeightWindowMesh> createWeightWindowMesh()
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    weight_window_mesh( new MonteCarlo::WeightWindowMesh );
+
+  weight_window_mesh->setMesh( mesh, MonteCarlo::PHOTON );
+
+  MonteCarlo::WeightWindowMesh::ElementHandleLowerWeightBoundMap
+    lower_weight_bounds;
+
+  lower_weight_bounds[first_element] = 1.0;
+  lower_weight_bounds[second_element] = 0.1;
+
+  weight_window_mesh->setLowerWeightBounds( MonteCarlo::PHOTON,
+                                            lower_weight_bounds );
+
+  return weight_window_mesh;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the window parameters can be set
+FRENSIE_UNIT_TEST( WeightWindowMesh, window_parameters )
+{
+  MonteCarlo::WeightWindowMesh weight_window_mesh;
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getUpperWeightBoundRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getSurvivalWeightRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getMaxSplitNumber(), 10 );
+
+  weight_window_mesh.setUpperWeightBoundRatio( 4.0 );
+  weight_window_mesh.setSurvivalWeightRatio( 2.0 );
+  weight_window_mesh.setMaxSplitNumber( 5 );
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getUpperWeightBoundRatio(), 4.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getSurvivalWeightRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getMaxSplitNumber(), 5 );
+
+  FRENSIE_CHECK_THROW( weight_window_mesh.setUpperWeightBoundRatio( 1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( weight_window_mesh.setUpperWeightBoundRatio( 1.5 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( weight_window_mesh.setSurvivalWeightRatio( 0.5 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( weight_window_mesh.setSurvivalWeightRatio( 4.5 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( weight_window_mesh.setMaxSplitNumber( 1 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower weight bounds can be set
+FRENSIE_UNIT_TEST( WeightWindowMesh, setLowerWeightBounds )
+{
+  MonteCarlo::WeightWindowMesh weight_window_mesh;
+
+  MonteCarlo::WeightWindowMesh::ElementHandleLowerWeightBoundMap
+    lower_weight_bounds;
+
+  lower_weight_bounds[first_element] = 1.0;
+
+  // The mesh must be set first
+  FRENSIE_CHECK_THROW( weight_window_mesh.setLowerWeightBounds(
+                                                        MonteCarlo::PHOTON,
+                                                        lower_weight_bounds ),
+                       std::runtime_error );
+
+  weight_window_mesh.setMesh( mesh, MonteCarlo::PHOTON );
+  weight_window_mesh.setLowerWeightBounds( MonteCarlo::PHOTON,
+                                           lower_weight_bounds );
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh.getLowerWeightBounds( MonteCarlo::PHOTON ).size(), 1 );
+  FRENSIE_CHECK_THROW( weight_window_mesh.getLowerWeightBounds( MonteCarlo::NEUTRON ),
+                       std::runtime_error );
+
+  // Negative bounds are not allowed
+  lower_weight_bounds[second_element] = -1.0;
+
+  FRENSIE_CHECK_THROW( weight_window_mesh.setLowerWeightBounds(
+                                                        MonteCarlo::PHOTON,
+                                                        lower_weight_bounds ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower weight bound at a point can be returned
+FRENSIE_UNIT_TEST( WeightWindowMesh, getLowerWeightBound )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    createWeightWindowMesh();
+
+  double position[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getLowerWeightBound( MonteCarlo::PHOTON, position ),
+                       1.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getLowerWeightBound( MonteCarlo::NEUTRON, position ),
+                       0.0 );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getLowerWeightBound( MonteCarlo::PHOTON, position ),
+                       0.1 );
+
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getLowerWeightBound( MonteCarlo::PHOTON, position ),
+                       0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles above the window will be split
+FRENSIE_UNIT_TEST( WeightWindowMesh, updateParticleState_split )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    createWeightWindowMesh();
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+  photon.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  weight_window_mesh->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getWeight(), 0.5, 1e-15 );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( bank.top().getWeight(), 0.5, 1e-15 );
+
+  // The split number is limited by the max split number
+  weight_window_mesh->setMaxSplitNumber( 3 );
+
+  bank.pop();
+  photon.setWeight( 10.0 );
+
+  weight_window_mesh->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getWeight(), 10.0/3, 1e-15 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles in the window will not be changed
+FRENSIE_UNIT_TEST( WeightWindowMesh, updateParticleState_in_window )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    createWeightWindowMesh();
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 0.5, 0.5, 0.5 );
+  photon.setWeight( 2.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  weight_window_mesh->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 2.0 );
+  FRENSIE_CHECK( !photon.isGone() );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles below the window will be rouletted
+FRENSIE_UNIT_TEST( WeightWindowMesh, updateParticleState_roulette )
+{
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    createWeightWindowMesh();
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 0.5, 0.5, 0.5 );
+  photon.setWeight( 0.3 );
+
+  MonteCarlo::ParticleBank bank;
+
+  // The survival probability is 0.3/3.0 = 0.1
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.05; // survive
+  fake_stream[1] = 0.15; // killed
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  weight_window_mesh->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK( !photon.isGone() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getWeight(), 3.0, 1e-15 );
+
+  photon.setWeight( 0.3 );
+
+  weight_window_mesh->updateParticleState( photon, bank );
+
+  FRENSIE_CHECK( photon.isGone() );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  mesh.reset( new Utility::StructuredHexMesh( {0.0, 1.0, 2.0},
+                                              {0.0, 1.0},
+                                              {0.0, 1.0} ) );
+
+  const double first_point[3] = {0.5, 0.5, 0.5};
+  const double second_point[3] = {1.5, 0.5, 0.5};
+
+  first_element = mesh->whichElementIsPointIn( first_point );
+  second_element = mesh->whichElementIsPointIn( second_point );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMesh.cpp
+//---------------------------------------------------------------------------//
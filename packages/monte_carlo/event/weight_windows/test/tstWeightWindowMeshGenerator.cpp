@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> mesh;
+
+Utility::Mesh::ElementHandle elements[3];
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator parameters can be set
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, parameters )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh );
+
+  FRENSIE_CHECK_EQUAL( generator.getUpperWeightBoundRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalWeightRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 1.0 );
+
+  generator.setUpperWeightBoundRatio( 3.0 );
+  generator.setSurvivalWeightRatio( 2.0 );
+  generator.setMaxRelativeError( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( generator.getUpperWeightBoundRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalWeightRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 0.5 );
+
+  FRENSIE_CHECK_THROW( generator.setMaxRelativeError( 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that weight windows can be generated from forward fluxes
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateFromForwardFlux )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh );
+  generator.setUpperWeightBoundRatio( 3.0 );
+  generator.setMaxRelativeError( 0.5 );
+
+  MonteCarlo::WeightWindowMeshGenerator::ElementHandleFluxMap element_fluxes;
+  element_fluxes[elements[0]] = std::make_pair( 4.0, 0.01 );
+  element_fluxes[elements[1]] = std::make_pair( 1.0, 0.1 );
+  element_fluxes[elements[2]] = std::make_pair( 0.01, 0.9 );
+
+  generator.generateFromForwardFlux( MonteCarlo::NEUTRON, element_fluxes );
+
+  std::shared_ptr<const MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.getWeightWindowMesh();
+
+  const MonteCarlo::WeightWindowMesh::ElementHandleLowerWeightBoundMap&
+    lower_weight_bounds =
+    weight_window_mesh->getLowerWeightBounds( MonteCarlo::NEUTRON );
+
+  // The flux in the last element is not reliable
+  FRENSIE_REQUIRE_EQUAL( lower_weight_bounds.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[0] )->second,
+                                   0.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[1] )->second,
+                                   0.125,
+                                   1e-15 );
+
+  // Without a usable flux the windows cannot be generated
+  element_fluxes.erase( elements[0] );
+  element_fluxes.erase( elements[1] );
+
+  FRENSIE_CHECK_THROW( generator.generateFromForwardFlux( MonteCarlo::NEUTRON,
+                                                          element_fluxes ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that weight windows can be generated from adjoint fluxes
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateFromAdjointFlux )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh );
+  generator.setUpperWeightBoundRatio( 3.0 );
+
+  MonteCarlo::WeightWindowMeshGenerator::ElementHandleFluxMap element_fluxes;
+  element_fluxes[elements[0]] = std::make_pair( 1.0, 0.01 );
+  element_fluxes[elements[1]] = std::make_pair( 2.0, 0.01 );
+  element_fluxes[elements[2]] = std::make_pair( 8.0, 0.01 );
+
+  const double source_point[3] = {0.5, 0.5, 0.5};
+
+  generator.generateFromAdjointFlux( MonteCarlo::NEUTRON,
+                                     element_fluxes,
+                                     source_point,
+                                     2.0 );
+
+  const MonteCarlo::WeightWindowMesh::ElementHandleLowerWeightBoundMap&
+    lower_weight_bounds =
+    generator.getWeightWindowMesh()->getLowerWeightBounds( MonteCarlo::NEUTRON );
+
+  // The window center is inversely proportional to the importance
+  FRENSIE_REQUIRE_EQUAL( lower_weight_bounds.size(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[0] )->second,
+                                   1.0,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[1] )->second,
+                                   0.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[2] )->second,
+                                   0.125,
+                                   1e-15 );
+
+  // The source point must be in the mesh
+  const double bad_source_point[3] = {-1.0, 0.5, 0.5};
+
+  FRENSIE_CHECK_THROW( generator.generateFromAdjointFlux( MonteCarlo::NEUTRON,
+                                                          element_fluxes,
+                                                          bad_source_point ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower weight bounds are updated when the upper weight bound
+// ratio is changed
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator,
+                   setUpperWeightBoundRatio_after_generation )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh );
+
+  MonteCarlo::WeightWindowMeshGenerator::ElementHandleFluxMap element_fluxes;
+  element_fluxes[elements[0]] = std::make_pair( 4.0, 0.01 );
+  element_fluxes[elements[1]] = std::make_pair( 1.0, 0.1 );
+
+  generator.generateFromForwardFlux( MonteCarlo::NEUTRON, element_fluxes );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getWeightWindowMesh()->getLowerWeightBounds( MonteCarlo::NEUTRON ).find( elements[0] )->second,
+                                   1.0/3,
+                                   1e-15 );
+
+  generator.setUpperWeightBoundRatio( 3.0 );
+
+  const MonteCarlo::WeightWindowMesh::ElementHandleLowerWeightBoundMap&
+    lower_weight_bounds =
+    generator.getWeightWindowMesh()->getLowerWeightBounds( MonteCarlo::NEUTRON );
+
+  FRENSIE_REQUIRE_EQUAL( lower_weight_bounds.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[0] )->second,
+                                   0.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_weight_bounds.find( elements[1] )->second,
+                                   0.125,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  mesh.reset( new Utility::StructuredHexMesh( {0.0, 1.0, 2.0, 3.0},
+                                              {0.0, 1.0},
+                                              {0.0, 1.0} ) );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    const double point[3] = {i+0.5, 0.5, 0.5};
+
+    elements[i] = mesh->whichElementIsPointIn( point );
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
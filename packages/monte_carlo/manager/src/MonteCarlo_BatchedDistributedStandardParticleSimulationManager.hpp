@@ -31,6 +31,8 @@ public:
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
@@ -71,8 +73,8 @@ private:
                                  const bool rendezvous_required,
                                  const uint64_t batch_number );
 
-  // Check for idle worker
-  bool isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info );
+  // Wait for an idle worker
+  void waitForIdleWorker( Utility::Communicator::Status& idle_worker_info );
 
   // Assign work to idle worker
   void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
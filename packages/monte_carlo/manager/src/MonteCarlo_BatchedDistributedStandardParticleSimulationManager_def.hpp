@@ -24,6 +24,8 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
@@ -36,6 +38,8 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              event_handler,
                                              weight_windows,
                                              collision_forcer,
+                                             delta_tracking_region,
+                                             instrumentation,
                                              properties,
                                              next_history,
                                              rendezvous_number,
@@ -135,6 +139,12 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details The simulation completion criterion is only checked when the
+ * simulation starts, after each rendezvous and when a worker requests a new
+ * batch (i.e. when the data that the criterion depends on can have
+ * changed). The root process blocks while it waits for a worker to request
+ * a new batch.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
@@ -148,10 +158,12 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
   Utility::Communicator::Status idle_worker_info;
 
   bool rendezvous_required = false;
+
+  bool simulation_complete = this->isSimulationComplete();
   
   while( true )
   {
-    if( this->isSimulationComplete() )
+    if( simulation_complete )
     {
       this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
 
@@ -166,11 +178,23 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
       
       // Reset the batch number
       batch_number = 0;
+
+      simulation_complete = this->isSimulationComplete();
       
       continue;
     }
-    else if( this->isIdleWorkerPresent( idle_worker_info ) )
+    else
     {
+      this->waitForIdleWorker( idle_worker_info );
+
+      // The idle worker has completed a batch (the idle worker message will
+      // be received when the workers are stopped if the simulation is
+      // complete)
+      simulation_complete = this->isSimulationComplete();
+
+      if( simulation_complete )
+        continue;
+      
       // Set the batch start history
       task.first = this->getNextHistory() + batch_number*this->getBatchSize();
       
@@ -262,19 +286,17 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
     this->rendezvous();
 }
 
-// Check for idle worker
+// Wait for an idle worker
 template<ParticleModeType mode>
-bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info )
+void BatchedDistributedStandardParticleSimulationManager<mode>::waitForIdleWorker( Utility::Communicator::Status& idle_worker_info )
 {
-  // Probe for an idle worker
+  // Block until an idle worker requests work
   try{
-    idle_worker_info = Utility::iprobe<int>( *d_comm );
+    idle_worker_info = Utility::probe<int>( *d_comm );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to probe for idle worker on root "
                            "process!" );
-
-  return idle_worker_info.hasMessageDetails();
 }
 
 // Assign work to idle worker
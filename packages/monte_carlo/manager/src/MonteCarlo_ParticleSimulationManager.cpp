@@ -17,6 +17,7 @@
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 // The registered managers (these must be global so that the custom signal
@@ -48,6 +49,8 @@ ParticleSimulationManager::ParticleSimulationManager(
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
@@ -61,7 +64,9 @@ ParticleSimulationManager::ParticleSimulationManager(
     d_event_handler( event_handler ),
     d_weight_windows( weight_windows ),
     d_collision_forcer( collision_forcer ),
+    d_delta_tracking_region( delta_tracking_region ),
     d_weight_roulette( std::make_shared<StandardWeightCutoffRoulette>() ),
+    d_instrumentation( instrumentation ),
     d_properties( properties ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
@@ -85,9 +90,118 @@ ParticleSimulationManager::ParticleSimulationManager(
   testPrecondition( weight_windows.get() );
   // Make sure that the collision forcer pointer is valid
   testPrecondition( collision_forcer.get() );
+  // Make sure that the delta tracking region pointer is valid
+  testPrecondition( delta_tracking_region.get() );
+  // Make sure that the instrumentation pointer is valid
+  testPrecondition( instrumentation.get() );
   // Make sure that the properties pointer is valid
   testPrecondition( properties.get() );
 
+  // Next-event estimators without a source emission pdf evaluator score
+  // source emission events with the isotropic emission pdf
+  std::set<Estimator::Id> isotropic_source_estimator_ids;
+
+  d_event_handler->getIsotropicSourceNextEventEstimatorIds(
+                                              isotropic_source_estimator_ids );
+
+  TEST_FOR_EXCEPTION( !isotropic_source_estimator_ids.empty() &&
+                      !d_source->isDirectionallyUniform(),
+                      std::runtime_error,
+                      "The source is not isotropic but next-event "
+                      "estimator(s) " << isotropic_source_estimator_ids <<
+                      " do not have a source emission pdf evaluator!" );
+
+  // Next-event estimators without a secondary emission pdf evaluator score
+  // secondary emission events with the isotropic emission pdf, which is only
+  // correct for fluorescence and annihilation photons (bremsstrahlung,
+  // photonuclear and neutron induced photons are not emitted isotropically)
+  std::set<Estimator::Id> isotropic_secondary_estimator_ids;
+
+  d_event_handler->getIsotropicSecondaryNextEventEstimatorIds(
+                                           isotropic_secondary_estimator_ids );
+
+  for( auto estimator_id : isotropic_secondary_estimator_ids )
+  {
+    const std::set<ParticleType>& particle_types =
+      d_event_handler->getEstimator( estimator_id ).getParticleTypes();
+
+    const bool only_isotropic_secondaries =
+      particle_types.size() == 1 && particle_types.count( PHOTON ) &&
+      d_properties->getParticleMode() == PHOTON_MODE &&
+      !d_properties->isPhotonuclearInteractionModeOn();
+
+    TEST_FOR_EXCEPTION( !only_isotropic_secondaries,
+                        std::runtime_error,
+                        "Next-event estimator " << estimator_id << " does "
+                        "not have a secondary emission pdf evaluator but "
+                        "the secondary particles that it observes can be "
+                        "emitted anisotropically!" );
+  }
+
+  // Only the collisions and the region boundary crossings of the delta
+  // tracked particles are known inside of a delta tracking region - the
+  // track lengths and the cell and surface crossings inside of the region
+  // are not known
+  std::set<ParticleType> delta_tracked_particle_types;
+
+  d_delta_tracking_region->getParticleTypes( delta_tracked_particle_types );
+
+  for( auto particle_type : delta_tracked_particle_types )
+  {
+    std::set<Geometry::Model::EntityId> delta_tracking_cells;
+
+    d_delta_tracking_region->getCells( particle_type, delta_tracking_cells );
+
+    std::set<Estimator::Id> track_length_estimator_ids;
+
+    d_event_handler->getCellTrackLengthEstimatorIds(
+                                                particle_type,
+                                                delta_tracking_cells,
+                                                track_length_estimator_ids );
+
+    TEST_FOR_EXCEPTION( !track_length_estimator_ids.empty(),
+                        std::runtime_error,
+                        "Cell track-length estimator(s) "
+                        << track_length_estimator_ids << " score "
+                        << particle_type << " track lengths in delta "
+                        "tracking cells - use cell collision estimators "
+                        "instead!" );
+
+    std::set<Estimator::Id> entering_or_leaving_estimator_ids;
+
+    d_event_handler->getCellEnteringOrLeavingEstimatorIds(
+                                         particle_type,
+                                         delta_tracking_cells,
+                                         entering_or_leaving_estimator_ids );
+
+    TEST_FOR_EXCEPTION( !entering_or_leaving_estimator_ids.empty(),
+                        std::runtime_error,
+                        "Estimator(s) " << entering_or_leaving_estimator_ids
+                        << " observe " << particle_type << " particles "
+                        "entering or leaving delta tracking cells (e.g. "
+                        "cell pulse-height estimators), which is not "
+                        "tracked inside of a delta tracking region!" );
+
+    // The surfaces of the model do not record the cells that they bound, so
+    // the surfaces inside of the region can't be rejected - only the region
+    // boundary surfaces will be scored
+    std::set<Estimator::Id> surface_estimator_ids;
+
+    d_event_handler->getSurfaceEstimatorIds( particle_type,
+                                             surface_estimator_ids );
+
+    if( !surface_estimator_ids.empty() )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "Delta Tracking",
+                                  "Surface estimator(s) "
+                                  << surface_estimator_ids << " observe "
+                                  << particle_type << " particles - "
+                                  "crossings of surfaces inside of the "
+                                  "delta tracking region will not be "
+                                  "scored!" );
+    }
+  }
+
   // Calculate the rendezvous batch size
   uint64_t number_of_histories = d_properties->getNumberOfHistories();
 
@@ -182,6 +296,23 @@ const SimulationProperties& ParticleSimulationManager::getSimulationProperties()
   return *d_properties;
 }
 
+// Return the transport instrumentation
+/*! \details The event counts are only updated at each rendezvous.
+ */
+const TransportInstrumentation&
+ParticleSimulationManager::getTransportInstrumentation() const
+{
+  return *d_instrumentation;
+}
+
+// Return the transport instrumentation
+/*! \details The event counts are only updated at each rendezvous.
+ */
+TransportInstrumentation& ParticleSimulationManager::getTransportInstrumentation()
+{
+  return *d_instrumentation;
+}
+
 // Get the simulation name
 const std::string& ParticleSimulationManager::getSimulationName() const
 {
@@ -462,6 +593,12 @@ const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
   return *d_collision_forcer;
 }
 
+// Get the delta tracking region
+const DeltaTrackingRegion& ParticleSimulationManager::getDeltaTrackingRegion() const
+{
+  return *d_delta_tracking_region;
+}
+
 // Enable thread support
 void ParticleSimulationManager::enableThreadSupport()
 {
@@ -473,6 +610,9 @@ void ParticleSimulationManager::enableThreadSupport()
 
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable transport instrumentation thread support
+  d_instrumentation->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 }
 
 // Reset data
@@ -480,6 +620,7 @@ void ParticleSimulationManager::resetData()
 {
   d_event_handler->resetObserverData();
   d_source->resetData();
+  d_instrumentation->resetData();
 }
 
 // Reduce distributed data
@@ -490,6 +631,7 @@ void ParticleSimulationManager::reduceData( const Utility::Communicator& comm,
 
   d_source->reduceData( comm, root_process );
   d_event_handler->reduceObserverData( comm, root_process );
+  d_instrumentation->reduceData( comm, root_process );
 
   comm.barrier();
 }
@@ -515,6 +657,9 @@ bool ParticleSimulationManager::isSimulationComplete()
 // Rendezvous (cache state)
 void ParticleSimulationManager::rendezvous()
 {
+  // Collect the thread event counters so that they will be archived
+  d_instrumentation->aggregateThreadData();
+
   this->basicRendezvous();
 
   ++d_rendezvous_number;
@@ -547,6 +692,8 @@ void ParticleSimulationManager::basicRendezvous() const
                  d_event_handler,
                  d_weight_windows,
                  d_collision_forcer,
+                 d_delta_tracking_region,
+                 d_instrumentation,
                  d_properties,
                  d_simulation_name,
                  d_archive_type,
@@ -562,6 +709,7 @@ void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
   d_source->printSummary( os );
   d_event_handler->printObserverSummaries( os );
+  d_instrumentation->printSummary( os );
 }
 
 // Log the simulation data
@@ -569,6 +717,7 @@ void ParticleSimulationManager::logSimulationSummary() const
 {
   d_source->logSummary();
   d_event_handler->logObserverSummaries();
+  d_instrumentation->logSummary();
 }
 
 // Run the simulation batch
@@ -648,6 +797,10 @@ void ParticleSimulationManager::runSimulationMicroBatch(
       }
       catch( const Geometry::GeometryError& exception )
       {
+        INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,
+                                    LOST_PARTICLE_EVENT,
+                                    source_bank.top() );
+
         LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
 
         FRENSIE_LOG_NESTED_ERROR( exception.what() );
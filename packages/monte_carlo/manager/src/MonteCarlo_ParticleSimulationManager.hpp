@@ -19,12 +19,14 @@
 #include "MonteCarlo_EventHandler.hpp"
 #include "MonteCarlo_WeightWindow.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
+#include "MonteCarlo_DeltaTrackingRegion.hpp"
 #include "MonteCarlo_StandardWeightCutoffRoulette.hpp"
 #include "MonteCarlo_ParticleSource.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_CollisionKernel.hpp"
 #include "MonteCarlo_TransportKernel.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "MonteCarlo_TransportInstrumentation.hpp"
 #include "Utility_Communicator.hpp"
 
 extern "C" void __custom_signal_handler__( int signal );
@@ -68,6 +70,12 @@ public:
   //! Return the simulation properties
   const SimulationProperties& getSimulationProperties() const;
 
+  //! Return the transport instrumentation
+  const TransportInstrumentation& getTransportInstrumentation() const;
+
+  //! Return the transport instrumentation
+  TransportInstrumentation& getTransportInstrumentation();
+
   //! Set the simulation name
   void setSimulationName( const std::string& new_name );
 
@@ -119,6 +127,8 @@ protected:
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
@@ -155,9 +165,18 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate a resolved particle using the delta tracking method
+  template<typename State>
+  void simulateParticleDeltaTracking( ParticleState& unresolved_particle,
+                                      ParticleBank& bank,
+                                      const bool source_particle );
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
+  //! Get the delta tracking region
+  const DeltaTrackingRegion& getDeltaTrackingRegion() const;
+
   //! Enable thread support
   void enableThreadSupport();
 
@@ -248,6 +267,13 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
+  // Simulate a resolved particle track using the delta tracking method
+  template<typename State>
+  void simulateParticleTrackDeltaTracking( State& particle,
+                                           ParticleBank& bank,
+                                           const double optical_path,
+                                           const bool starting_from_source );
+
   // Advance a particle to the cell boundary
   template<typename State>
   void advanceParticleToCellBoundary(
@@ -264,11 +290,19 @@ private:
                                const double track_start_position[3],
                                bool& global_subtrack_ending_event_dispatched );
 
+  // Advance a particle to the delta tracking region boundary
+  template<typename State>
+  void advanceParticleToDeltaTrackingRegionBoundary( State& particle );
+
   // Collide with the cell material
   template<typename State>
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Record the variance reduction events
+  void recordVarianceReductionEvents( const ParticleState& particle,
+                                      const uint64_t number_of_new_particles );
+
   // Conduct a basic rendezvous
   void basicRendezvous() const;
 
@@ -302,9 +336,15 @@ private:
   // The collision forcer
   std::shared_ptr<const CollisionForcer> d_collision_forcer;
 
+  // The delta tracking region
+  std::shared_ptr<const DeltaTrackingRegion> d_delta_tracking_region;
+
   // The weight cutoff roulette
   std::shared_ptr<StandardWeightCutoffRoulette> d_weight_roulette;
 
+  // The transport instrumentation
+  std::shared_ptr<TransportInstrumentation> d_instrumentation;
+
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
@@ -29,6 +29,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                 const std::shared_ptr<EventHandler>& event_handler,
                 const std::shared_ptr<const WeightWindow>& weight_windows,
                 const std::shared_ptr<const CollisionForcer>& collision_forcer,
+                const std::shared_ptr<const DeltaTrackingRegion>& delta_tracking_region,
+                const std::shared_ptr<TransportInstrumentation>& instrumentation,
                 const std::shared_ptr<const SimulationProperties>& properties,
                 const std::string& simulation_name,
                 const std::string& archive_type,
@@ -42,6 +44,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
     d_event_handler( event_handler ),
     d_weight_windows( weight_windows ),
     d_collision_forcer( collision_forcer ),
+    d_delta_tracking_region( delta_tracking_region ),
+    d_instrumentation( instrumentation ),
     d_properties( properties ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
@@ -73,6 +77,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
     d_event_handler( event_handler ),
     d_weight_windows( MonteCarlo::WeightWindow::getDefault() ),
     d_collision_forcer( MonteCarlo::CollisionForcer::getDefault() ),
+    d_delta_tracking_region( new DeltaTrackingRegion ),
+    d_instrumentation( new TransportInstrumentation ),
     d_properties( properties ),
     d_next_history( 0 ),
     d_rendezvous_number( 0 ),
@@ -273,6 +279,24 @@ void ParticleSimulationManagerFactory::setCollisionForcer(
   }
 }
 
+// Set the delta tracking region that will be used by the manager
+void ParticleSimulationManagerFactory::setDeltaTrackingRegion(
+     const std::shared_ptr<const DeltaTrackingRegion>& delta_tracking_region )
+{
+  if( delta_tracking_region )
+  {
+    if( d_next_history > 0 || d_simulation_manager )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "ParticleSimulationManagerFactory",
+                                  "Setting a delta tracking region after a "
+                                  "simulation has been started is not "
+                                  "allowed!" );
+    }
+    else
+      d_delta_tracking_region = delta_tracking_region;
+  }
+}
+
 namespace Details{
 
 //! The create model helper struct
@@ -293,6 +317,8 @@ struct ParticleSimulationManagerFactoryCreateHelper
                                           factory.d_event_handler,
                                           factory.d_weight_windows,
                                           factory.d_collision_forcer,
+                                          factory.d_delta_tracking_region,
+                                          factory.d_instrumentation,
                                           factory.d_properties,
                                           factory.d_next_history,
                                           factory.d_rendezvous_number,
@@ -310,6 +336,8 @@ struct ParticleSimulationManagerFactoryCreateHelper
                                       factory.d_event_handler,
                                       factory.d_weight_windows,
                                       factory.d_collision_forcer,
+                                      factory.d_delta_tracking_region,
+                                      factory.d_instrumentation,
                                       factory.d_properties,
                                       factory.d_next_history,
                                       factory.d_rendezvous_number,
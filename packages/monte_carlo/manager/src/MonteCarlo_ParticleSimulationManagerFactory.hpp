@@ -82,6 +82,9 @@ public:
   //! Set the collision forcer that will be used by the manager
   void setCollisionForcer( const std::shared_ptr<const CollisionForcer>& collision_forcer );
 
+  //! Set the delta tracking region that will be used by the manager
+  void setDeltaTrackingRegion( const std::shared_ptr<const DeltaTrackingRegion>& delta_tracking_region );
+
   //! Return the manager
   std::shared_ptr<ParticleSimulationManager> getManager();
 
@@ -103,6 +106,8 @@ private:
                 const std::shared_ptr<EventHandler>& event_handler,
                 const std::shared_ptr<const WeightWindow>& weight_windows,
                 const std::shared_ptr<const CollisionForcer>& collision_forcer,
+                const std::shared_ptr<const DeltaTrackingRegion>& delta_tracking_region,
+                const std::shared_ptr<TransportInstrumentation>& instrumentation,
                 const std::shared_ptr<const SimulationProperties>& properties,
                 const std::string& simulation_name,
                 const std::string& archive_type,
@@ -150,6 +155,12 @@ private:
   // The collision forcer
   std::shared_ptr<const CollisionForcer> d_collision_forcer;
 
+  // The delta tracking region
+  std::shared_ptr<const DeltaTrackingRegion> d_delta_tracking_region;
+
+  // The transport instrumentation
+  std::shared_ptr<TransportInstrumentation> d_instrumentation;
+
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
@@ -180,6 +191,21 @@ void ParticleSimulationManagerFactory::serialize( Archive& ar, const unsigned ve
   ar & BOOST_SERIALIZATION_NVP( d_event_handler );
   ar & BOOST_SERIALIZATION_NVP( d_weight_windows );
   ar & BOOST_SERIALIZATION_NVP( d_collision_forcer );
+
+  // Archives created before delta tracking was added will not use delta
+  // tracking
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_region );
+  else if( !d_delta_tracking_region )
+    d_delta_tracking_region.reset( new DeltaTrackingRegion );
+
+  // Archives created before the transport instrumentation was added will
+  // start with empty counters
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_instrumentation );
+  else if( !d_instrumentation )
+    d_instrumentation.reset( new TransportInstrumentation );
+
   ar & BOOST_SERIALIZATION_NVP( d_properties );
   ar & BOOST_SERIALIZATION_NVP( d_next_history );
   ar & BOOST_SERIALIZATION_NVP( d_rendezvous_number );
@@ -188,7 +214,7 @@ void ParticleSimulationManagerFactory::serialize( Archive& ar, const unsigned ve
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 2 );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSimulationManagerFactory );
 
 #endif // end FRENSIE_PARTICLE_SIMULATION_MANAGER_FACTORY_HPP
@@ -13,6 +13,10 @@
 #include <functional>
 #include <type_traits>
 
+// FRENSIE Includes
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
   FRENSIE_LOG_TAGGED_WARNING(                   \
@@ -30,6 +34,10 @@
   {                                                   \
     particle.setAsLost();                               \
                                                         \
+    INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,     \
+                                LOST_PARTICLE_EVENT,    \
+                                particle );             \
+                                                        \
     LOG_LOST_PARTICLE_DETAILS( particle );              \
                                                         \
     FRENSIE_LOG_NESTED_ERROR( exception.what() );       \
@@ -43,6 +51,10 @@
   {                                                   \
     particle.setAsLost();                               \
                                                         \
+    INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,     \
+                                LOST_PARTICLE_EVENT,    \
+                                particle );             \
+                                                        \
     LOG_LOST_PARTICLE_DETAILS( particle );              \
                                                         \
     FRENSIE_LOG_NESTED_ERROR( exception.what() );       \
@@ -56,6 +68,10 @@
   {                                                   \
     particle.setAsLost();                               \
                                                         \
+    INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,     \
+                                LOST_PARTICLE_EVENT,    \
+                                particle );             \
+                                                        \
     LOG_LOST_PARTICLE_DETAILS( particle );              \
                                                         \
     FRENSIE_LOG_NESTED_ERROR( exception.what() );       \
@@ -75,10 +91,13 @@ struct RaySafetyHelper
 {
   //! Return the distance to the next surface hit in the particle's direction
   static inline double getDistanceToSurfaceHit(
-                                State& particle,
-                                Geometry::Model::EntityId& surface_hit,
-                                const double )
+                 State& particle,
+                 Geometry::Model::EntityId& surface_hit,
+                 const double,
+                 TransportInstrumentation& TRANSPORT_INSTRUMENTATION_LINE( instrumentation ) )
   {
+    INSTRUMENT_TIMED_TRANSPORT_EVENT( instrumentation, FIRE_RAY_EVENT, particle );
+
     return particle.navigator().fireRay( surface_hit ).value();
   }
 
@@ -95,12 +114,17 @@ struct RaySafetyHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo:
 {
   // Return the distance to the next surface hit in the particle's direction
   static inline double getDistanceToSurfaceHit(
-                                        State& particle,
-                                        Geometry::Model::EntityId& surface_hit,
-                                        const double remaining_track )
+                 State& particle,
+                 Geometry::Model::EntityId& surface_hit,
+                 const double remaining_track,
+                 TransportInstrumentation& TRANSPORT_INSTRUMENTATION_LINE( instrumentation ) )
   {
     if ( particle.getRaySafetyDistance() < remaining_track )
+    {
+      INSTRUMENT_TIMED_TRANSPORT_EVENT( instrumentation, FIRE_RAY_EVENT, particle );
+
       return particle.navigator().fireRay( surface_hit ).value();
+    }
     else
       return std::numeric_limits<double>::infinity();
   }
@@ -170,6 +194,27 @@ void ParticleSimulationManager::simulateParticleAlternative(
                                                       std::placeholders::_4 ) );
 }
 
+// Simulate a resolved particle using the delta tracking method
+template<typename State>
+void ParticleSimulationManager::simulateParticleDeltaTracking(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<State>( unresolved_particle,
+                                     bank,
+                                     source_particle,
+                                     std::bind<void>( &ParticleSimulationManager::simulateParticleTrackDeltaTracking<State>,
+                                                      std::ref( *this ),
+                                                      std::placeholders::_1,
+                                                      std::placeholders::_2,
+                                                      std::placeholders::_3,
+                                                      std::placeholders::_4 ) );
+}
+
 // Simulate a resolved particle implementation
 template<typename State, typename SimulateParticleTrackMethod>
 void ParticleSimulationManager::simulateParticleImpl(
@@ -184,6 +229,9 @@ void ParticleSimulationManager::simulateParticleImpl(
   // Resolve the particle state
   State& particle = dynamic_cast<State&>( unresolved_particle );
 
+  // Cache the bank size so that the banked particles can be counted
+  TRANSPORT_INSTRUMENTATION_LINE( const uint64_t initial_bank_size = bank.size() );
+
   // Simulate a particle subtrack of random optical path length starting from a
   // source point
   if( source_particle )
@@ -208,6 +256,9 @@ void ParticleSimulationManager::simulateParticleImpl(
     }
     else
     {
+      d_event_handler->updateObserversFromParticleSourceEmissionGlobalEvent(
+                                                                    particle );
+
       simulate_particle_track( particle,
                                bank,
                                d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
@@ -235,6 +286,8 @@ void ParticleSimulationManager::simulateParticleImpl(
     // Roulette the particle if it is below the threshold weight
     d_weight_roulette->rouletteParticleWeight( particle );
 
+    TRANSPORT_INSTRUMENTATION_LINE( this->recordVarianceReductionEvents( particle, 0 ) );
+
     if( particle )
     {
       simulate_particle_track( particle,
@@ -243,6 +296,9 @@ void ParticleSimulationManager::simulateParticleImpl(
                                false );
     }
   }
+
+  // Count the particles that were added to the bank by this particle
+  TRANSPORT_INSTRUMENTATION_LINE( d_instrumentation->countEvent( TransportInstrumentation::BANK_PUSH_EVENT, particle.getParticleType(), bank.size() - initial_bank_size ) );
 }
 
 // Simulate an unresolved particle track
@@ -302,8 +358,12 @@ void ParticleSimulationManager::simulateParticleTrack(
   while( true )
   {
     // Get the total cross section for the cell
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoidAtIndex<State>( particle.getCellIndex() ) )
     {
+      INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                        CROSS_SECTION_LOOKUP_EVENT,
+                                        particle );
+
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
     }
@@ -315,7 +375,7 @@ void ParticleSimulationManager::simulateParticleTrack(
     // Fire a ray through the cell currently containing the particle
     try{
       distance_to_surface_hit =
-        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit( particle, surface_hit, cell_distance_to_collision );
+        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit( particle, surface_hit, cell_distance_to_collision, *d_instrumentation );
     }
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
@@ -333,7 +393,7 @@ void ParticleSimulationManager::simulateParticleTrack(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCellAtIndex( particle.getCellIndex() ) )
       {
         particle.setAsGone();
 
@@ -447,21 +507,31 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   {
     // Fire a ray through the cell currently containing the particle
     try{
+      INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                        FIRE_RAY_EVENT,
+                                        particle );
+
       distance_to_surface_hit = particle.navigator().fireRay( surface_hit ).value();
     }
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
     // Get the total cross section for the cell and the distance to collision
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoidAtIndex<State>( particle.getCellIndex() ) )
     {
-      cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      {
+        INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                          CROSS_SECTION_LOOKUP_EVENT,
+                                          particle );
+
+        cell_total_macro_cross_section =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      }
 
       // Only consider a forced collision cell if the subtrack is starting from
       // the source or from a cell boundary
       if( (subtrack_starting_from_source_point ||
            subtrack_starting_from_cell_boundary) &&
-          d_collision_forcer->isForcedCollisionCell<State>(particle.getCell()))
+          d_collision_forcer->isForcedCollisionCell( particle ) )
       {
         // This event must be dispatched before the particle weight changes
         d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
@@ -473,15 +543,23 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
         track_start_point[1] = particle.getYPosition();
         track_start_point[2] = particle.getZPosition();
 
+        // The optical path to the cell boundary is the one that has already
+        // been calculated for this subtrack. The collided particle track
+        // method only captures this manager, which allows the method
+        // wrapper to be created without a heap allocation.
         d_collision_forcer->forceCollision(
                         particle.getCell(),
                         cell_total_macro_cross_section*distance_to_surface_hit,
-                        std::bind<void>( &ParticleSimulationManager::simulateUnresolvedParticleTrackAlternative<State>,
-                                         std::ref( *this ),
-                                         std::placeholders::_1,
-                                         std::placeholders::_2,
-                                         std::placeholders::_3,
-                                         false ),
+                        [this]( ParticleState& collided_particle,
+                                ParticleBank& collided_particle_bank,
+                                const double optical_path )
+                        {
+                          this->simulateUnresolvedParticleTrackAlternative<State>(
+                                                        collided_particle,
+                                                        collided_particle_bank,
+                                                        optical_path,
+                                                        false );
+                        },
                         particle,
                         bank );
 
@@ -518,7 +596,7 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCellAtIndex( particle.getCellIndex() ) )
       {
         particle.setAsGone();
 
@@ -566,6 +644,282 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
 }
 
+// Simulate a resolved particle track using the delta tracking method
+// Note: Outside of the delta tracking region this method tracks the particle
+//       like the "alternative" method (without forced collisions). Inside of
+//       the region the flight distances are sampled using the majorant cross
+//       section and the cell is only located at the collision sites. Because
+//       the cells that are traversed by a flight are not known, the subtrack
+//       ending in cell events (track-length estimators) are not dispatched
+//       inside of the region. Instead, a colliding in cell event is
+//       dispatched with the inverse majorant cross section at every real and
+//       virtual collision site, which gives an unbiased collision estimate of
+//       the flux in the region cells. The cell entering and leaving events
+//       and the surface crossing events are only dispatched at the region
+//       boundary. Cell track-length estimators and cell entering or leaving
+//       estimators (e.g. cell pulse-height estimators) of the region cells
+//       are rejected when the manager is constructed. Surface estimators
+//       only score the region boundary surfaces (a warning is logged since
+//       the surfaces inside of the region can't be identified). Collision,
+//       global and next-event estimators are unaffected. The majorant cross
+//       section is evaluated at the particle energy, so it always bounds the
+//       cross sections of the region cells.
+template<typename State>
+void ParticleSimulationManager::simulateParticleTrackDeltaTracking(
+                                             State& particle,
+                                             ParticleBank& bank,
+                                             const double initial_optical_path,
+                                             const bool starting_from_source )
+{
+  // Particle tracking information (op = optical_path)
+  double op_to_collision = initial_optical_path;
+  double distance_to_collision;
+  double distance_to_surface_hit;
+
+  double track_start_point[3] = {particle.getXPosition(),
+                                 particle.getYPosition(),
+                                 particle.getZPosition()};
+
+  // Surface information
+  Geometry::Model::EntityId surface_hit;
+
+  // Cell information
+  double cell_total_macro_cross_section;
+
+  // Majorant cross section information (the majorant is only reevaluated
+  // when the particle energy changes)
+  double majorant_cross_section = 0.0;
+  double majorant_energy = -1.0;
+
+  // Records if global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+  }
+
+  // Track until a real collision occurs
+  while( true )
+  {
+    // Delta track inside of the region
+    if( d_delta_tracking_region->isParticleDeltaTracked( particle ) )
+    {
+      if( particle.getEnergy() != majorant_energy )
+      {
+        INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                          CROSS_SECTION_LOOKUP_EVENT,
+                                          particle );
+
+        majorant_cross_section =
+          d_delta_tracking_region->getMajorantCrossSection( *d_model,
+                                                            particle );
+
+        majorant_energy = particle.getEnergy();
+      }
+
+      distance_to_collision = op_to_collision/majorant_cross_section;
+
+      // Locate the cell that contains the tentative collision site (a void
+      // region has no collision sites)
+      Geometry::Model::EntityId collision_site_cell;
+      bool collision_site_in_region = false;
+
+      if( majorant_cross_section > 0.0 )
+      {
+        const double* position = particle.getPosition();
+        const double* direction = particle.getDirection();
+
+        double collision_site[3] =
+          {position[0] + direction[0]*distance_to_collision,
+           position[1] + direction[1]*distance_to_collision,
+           position[2] + direction[2]*distance_to_collision};
+
+        // The tentative collision site can lie outside of the geometry (e.g.
+        // past the termination cells). A site that can't be located is
+        // treated as a site outside of the region so that the particle is
+        // advanced to the region boundary instead of being lost.
+        try{
+          collision_site_cell = particle.navigator().findCellContainingRay(
+                 Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( collision_site ),
+                 direction );
+
+          collision_site_in_region =
+            d_delta_tracking_region->isDeltaTrackingCellAtIndex(
+                                  particle.getParticleType(),
+                                  d_model->getCellIndex( collision_site_cell ) );
+        }
+        catch( const std::runtime_error& )
+        {
+          collision_site_in_region = false;
+        }
+      }
+
+      // The collision site is inside of the region (because the region is
+      // convex the particle did not leave the region)
+      if( collision_site_in_region )
+      {
+        particle.advanceToPointInCell( distance_to_collision,
+                                       collision_site_cell );
+
+        // Set the ray safety distance to zero
+        particle.setRaySafetyDistance( 0.0 );
+
+        // Update the observers: particle colliding in cell event
+        d_event_handler->updateObserversFromParticleCollidingInCellEvent(
+                                                  particle,
+                                                  1.0/majorant_cross_section );
+
+        // Check if the collision is a real collision
+        if( !d_model->isCellVoidAtIndex<State>( particle.getCellIndex() ) )
+        {
+          {
+            INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                              CROSS_SECTION_LOOKUP_EVENT,
+                                              particle );
+
+            cell_total_macro_cross_section =
+              d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+          }
+
+          // Make sure that the majorant cross section is a bound
+          testInvariant( cell_total_macro_cross_section <=
+                         majorant_cross_section );
+
+          if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+              majorant_cross_section < cell_total_macro_cross_section )
+          {
+            // Update the observers: particle subtrack ending global event
+            d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+            global_subtrack_ending_event_dispatched = true;
+
+            this->collideWithCellMaterial( particle, bank );
+
+            // This track is finished
+            break;
+          }
+        }
+      }
+
+      // The particle leaves the region before the collision site
+      else
+      {
+        try{
+          this->advanceParticleToDeltaTrackingRegionBoundary( particle );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCellAtIndex( particle.getCellIndex() ) )
+        {
+          particle.setAsGone();
+
+          break;
+        }
+
+        // Set the ray safety distance to zero
+        particle.setRaySafetyDistance( 0.0 );
+      }
+
+      // Sample the optical path to the next (real or virtual) collision
+      op_to_collision =
+        d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+    }
+
+    // Surface track outside of the region
+    else
+    {
+      // Fire a ray through the cell currently containing the particle
+      try{
+        INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                          FIRE_RAY_EVENT,
+                                          particle );
+
+        distance_to_surface_hit =
+          particle.navigator().fireRay( surface_hit ).value();
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      // Get the total cross section for the cell and the distance to collision
+      if( !d_model->isCellVoidAtIndex<State>( particle.getCellIndex() ) )
+      {
+        {
+          INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                            CROSS_SECTION_LOOKUP_EVENT,
+                                            particle );
+
+          cell_total_macro_cross_section =
+            d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+        }
+
+        distance_to_collision =
+          op_to_collision/cell_total_macro_cross_section;
+      }
+      else
+        distance_to_collision = std::numeric_limits<double>::infinity();
+
+      // The particle passes through this cell to the next
+      if( distance_to_surface_hit < distance_to_collision )
+      {
+        try{
+          this->advanceParticleToCellBoundary( particle,
+                                               surface_hit,
+                                               distance_to_surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCellAtIndex( particle.getCellIndex() ) )
+        {
+          particle.setAsGone();
+
+          break;
+        }
+
+        // Set the ray safety distance to zero
+        particle.setRaySafetyDistance( 0.0 );
+
+        // Sample the optical path to collision in the new cell
+        op_to_collision =
+          d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+      }
+
+      // A collision occurs in this cell
+      else
+      {
+        this->advanceParticleToCollisionSite( particle,
+                                              op_to_collision,
+                                              distance_to_collision,
+                                              track_start_point,
+                                              global_subtrack_ending_event_dispatched );
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        break;
+      }
+    }
+  }
+
+  if( !global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
 // Advance a particle to the cell boundary
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
@@ -580,6 +934,10 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
   double surface_normal[3];
   bool reflected = particle.navigator().advanceToCellBoundary( surface_normal );
 
+  INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,
+                              SURFACE_CROSSING_EVENT,
+                              particle );
+
   // Update the observers: particle subtrack ending in cell event
   d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
                                                          particle,
@@ -635,6 +993,65 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
   global_subtrack_ending_event_dispatched = true;
 }
 
+// Advance a particle to the delta tracking region boundary
+/*! \details The particle will be advanced to the first boundary where it
+ * leaves the delta tracking region or where it is reflected. Only the events
+ * associated with this boundary will be dispatched - the surfaces inside of
+ * the region are crossed silently.
+ */
+template<typename State>
+void ParticleSimulationManager::advanceParticleToDeltaTrackingRegionBoundary(
+                                                              State& particle )
+{
+  Geometry::Model::EntityId start_cell;
+  Geometry::Model::EntityId surface_hit;
+
+  double surface_normal[3];
+  bool reflected;
+
+  do{
+    start_cell = particle.getCell();
+
+    {
+      INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                        FIRE_RAY_EVENT,
+                                        particle );
+
+      particle.navigator().fireRay( surface_hit );
+    }
+
+    reflected = particle.navigator().advanceToCellBoundary( surface_normal );
+
+    INSTRUMENT_TRANSPORT_EVENT( *d_instrumentation,
+                                SURFACE_CROSSING_EVENT,
+                                particle );
+  }
+  while( !reflected &&
+         d_delta_tracking_region->isDeltaTrackingCellAtIndex(
+                                                  particle.getParticleType(),
+                                                  particle.getCellIndex() ) );
+
+  // Update the observers: particle leaving cell event
+  d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
+
+  // Update the observers: particle crossing surface event
+  d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+                                                              particle,
+                                                              surface_hit,
+                                                              surface_normal );
+
+  if( reflected )
+  {
+    d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+                                                              particle,
+                                                              surface_hit,
+                                                              surface_normal );
+  }
+
+  // Update the observers: particle entering cell event
+  d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+}
+
 // Collide with the cell material
 template<typename State>
 void ParticleSimulationManager::collideWithCellMaterial( State& particle,
@@ -642,8 +1059,15 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
 {
   ParticleBank local_bank;
 
+  // This event must be dispatched before the particle state changes
+  d_event_handler->updateObserversFromParticleCollidingGlobalEvent( particle );
+
   // Undergo a collision with the material in the cell
   try{
+    INSTRUMENT_TIMED_TRANSPORT_EVENT( *d_instrumentation,
+                                      COLLISION_EVENT,
+                                      particle );
+
     d_collision_kernel->collideWithCellMaterial( particle, local_bank );
   }
   CATCH_LOST_PARTICLE( particle );
@@ -652,7 +1076,11 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
   // progeny
   if( particle )
   {
+    TRANSPORT_INSTRUMENTATION_LINE( const uint64_t bank_size = bank.size() );
+
     d_weight_windows->updateParticleState( particle, bank );
+
+    TRANSPORT_INSTRUMENTATION_LINE( this->recordVarianceReductionEvents( particle, bank.size() - bank_size ) );
   }
 
   while( !local_bank.isEmpty() )
@@ -661,8 +1089,13 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
 
     if( local_bank.top() )
     {
+      // This event must be dispatched before the weight windows are applied
+      d_event_handler->updateObserversFromParticleSecondaryEmissionGlobalEvent( local_bank.top() );
+
       d_weight_windows->updateParticleState( local_bank.top(),
                                              split_particle_bank );
+
+      TRANSPORT_INSTRUMENTATION_LINE( this->recordVarianceReductionEvents( local_bank.top(), split_particle_bank.size() ) );
     }
 
     std::shared_ptr<ParticleState> local_particle;
@@ -678,6 +1111,28 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
   }
 }
 
+// Record the variance reduction events
+/*! \details If the particle is gone it is assumed that it was killed by
+ * roulette. Any new particles are assumed to be split particles.
+ */
+inline void ParticleSimulationManager::recordVarianceReductionEvents(
+                                       const ParticleState& particle,
+                                       const uint64_t number_of_new_particles )
+{
+  if( !particle )
+  {
+    d_instrumentation->countEvent( TransportInstrumentation::ROULETTE_EVENT,
+                                   particle.getParticleType() );
+  }
+
+  if( number_of_new_particles > 0 )
+  {
+    d_instrumentation->countEvent( TransportInstrumentation::SPLIT_EVENT,
+                                   particle.getParticleType(),
+                                   number_of_new_particles );
+  }
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_PARTICLE_SIMULATION_MANAGER_DEF_HPP
@@ -39,6 +39,8 @@ public:
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
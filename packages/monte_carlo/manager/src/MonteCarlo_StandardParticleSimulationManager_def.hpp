@@ -19,6 +19,7 @@
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
 #include "MonteCarlo_StandardCollisionForcer.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -62,6 +63,8 @@ StandardParticleSimulationManager<mode>::StandardParticleSimulationManager(
                  const std::shared_ptr<EventHandler>& event_handler,
                  const std::shared_ptr<const WeightWindow> weight_windows,
                  const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const DeltaTrackingRegion> delta_tracking_region,
+                 const std::shared_ptr<TransportInstrumentation>& instrumentation,
                  const std::shared_ptr<const SimulationProperties>& properties,
                  const uint64_t next_history,
                  const uint64_t rendezvous_number,
@@ -73,6 +76,8 @@ StandardParticleSimulationManager<mode>::StandardParticleSimulationManager(
                                event_handler,
                                weight_windows,
                                collision_forcer,
+                               delta_tracking_region,
+                               instrumentation,
                                properties,
                                next_history,
                                rendezvous_number,
@@ -111,6 +116,12 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
   // Make sure that the state is compatible with the mode
   testPrecondition( MonteCarlo::isParticleTypeCompatible<mode>( particle_type ) );
 
+  TEST_FOR_EXCEPTION( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) &&
+                      this->getDeltaTrackingRegion().hasDeltaTrackingCells( particle_type ),
+                      std::runtime_error,
+                      "Forced collisions and delta tracking cannot both be "
+                      "used with " << particle_type << "s!" );
+
   if( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) )
   {
     d_simulate_particle_function_map[particle_type] =
@@ -120,6 +131,15 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
                        std::placeholders::_2,
                        std::placeholders::_3 );
   }
+  else if( this->getDeltaTrackingRegion().hasDeltaTrackingCells( particle_type ) )
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleDeltaTracking<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
   else
   {
     d_simulate_particle_function_map[particle_type] =
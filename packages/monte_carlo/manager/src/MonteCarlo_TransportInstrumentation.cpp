@@ -0,0 +1,356 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TransportInstrumentation.cpp
+//! \author Alex Robinson
+//! \brief  Transport instrumentation class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <sstream>
+#include <iomanip>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_TransportInstrumentation.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The tables are archived as flat arrays
+static_assert( sizeof(std::array<std::array<uint64_t,TransportInstrumentation::Event_END>,ParticleType_END>) ==
+               sizeof(uint64_t)*TransportInstrumentation::Event_END*ParticleType_END,
+               "The event count table is not contiguous!" );
+static_assert( sizeof(std::array<std::array<double,TransportInstrumentation::Event_END>,ParticleType_END>) ==
+               sizeof(double)*TransportInstrumentation::Event_END*ParticleType_END,
+               "The event time table is not contiguous!" );
+
+// Constructor
+TransportInstrumentation::TransportInstrumentation()
+  : d_event_timers_on( false ),
+    d_event_counts(),
+    d_event_times(),
+    d_thread_data()
+{
+  this->zeroTable( d_event_counts );
+  this->zeroTable( d_event_times );
+
+  this->enableThreadSupport( 1 );
+}
+
+// Check if the instrumentation hooks have been compiled in
+bool TransportInstrumentation::isEnabled()
+{
+  return HAVE_FRENSIE_TRANSPORT_INSTRUMENTATION;
+}
+
+// Turn on the event timers
+/*! \details The timers add two clock queries to every timed event. They
+ * should only be turned on when the time distribution is needed.
+ */
+void TransportInstrumentation::setEventTimersOn()
+{
+  d_event_timers_on = true;
+}
+
+// Turn off the event timers
+void TransportInstrumentation::setEventTimersOff()
+{
+  d_event_timers_on = false;
+}
+
+// Enable support for multiple threads
+/*! \details Any thread data that has not been aggregated will be aggregated
+ * first. Only the master thread should call this method.
+ */
+void TransportInstrumentation::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  this->aggregateThreadData();
+
+  d_thread_data.resize( num_threads );
+
+  for( auto&& thread_data : d_thread_data )
+  {
+    this->zeroTable( thread_data.event_counts );
+    this->zeroTable( thread_data.event_times );
+  }
+}
+
+// Aggregate the thread counters
+/*! \details The thread counters will be zeroed after they are added to the
+ * aggregated counters. Only the master thread should call this method (and
+ * only outside of a parallel block).
+ */
+void TransportInstrumentation::aggregateThreadData()
+{
+  for( auto&& thread_data : d_thread_data )
+  {
+    for( size_t i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      for( size_t j = Event_START; j < Event_END; ++j )
+      {
+        d_event_counts[i][j] += thread_data.event_counts[i][j];
+        d_event_times[i][j] += thread_data.event_times[i][j];
+      }
+    }
+
+    this->zeroTable( thread_data.event_counts );
+    this->zeroTable( thread_data.event_times );
+  }
+}
+
+// Return the number of times that an event occurred for a particle type
+/*! \details Only the aggregated counts will be considered.
+ */
+uint64_t TransportInstrumentation::getEventCount(
+                                      const Event event,
+                                      const ParticleType particle_type ) const
+{
+  return d_event_counts[particle_type][event];
+}
+
+// Return the number of times that an event occurred
+/*! \details Only the aggregated counts will be considered.
+ */
+uint64_t TransportInstrumentation::getEventCount( const Event event ) const
+{
+  uint64_t event_count = 0;
+
+  for( size_t i = ParticleType_START; i < ParticleType_END; ++i )
+    event_count += d_event_counts[i][event];
+
+  return event_count;
+}
+
+// Return the time spent processing an event for a particle type (s)
+/*! \details Only the aggregated times will be considered.
+ */
+double TransportInstrumentation::getEventTime(
+                                      const Event event,
+                                      const ParticleType particle_type ) const
+{
+  return d_event_times[particle_type][event];
+}
+
+// Return the time spent processing an event (s)
+/*! \details Only the aggregated times will be considered.
+ */
+double TransportInstrumentation::getEventTime( const Event event ) const
+{
+  double event_time = 0.0;
+
+  for( size_t i = ParticleType_START; i < ParticleType_END; ++i )
+    event_time += d_event_times[i][event];
+
+  return event_time;
+}
+
+// Reset the data
+void TransportInstrumentation::resetData()
+{
+  this->zeroTable( d_event_counts );
+  this->zeroTable( d_event_times );
+
+  for( auto&& thread_data : d_thread_data )
+  {
+    this->zeroTable( thread_data.event_counts );
+    this->zeroTable( thread_data.event_times );
+  }
+}
+
+// Reduce the distributed data
+/*! \details The thread data will be aggregated before the reduction. The
+ * data on all processes except the root process will be reset after the
+ * reduction.
+ */
+void TransportInstrumentation::reduceData( const Utility::Communicator& comm,
+                                           const int root_process )
+{
+  this->aggregateThreadData();
+
+  if( comm.size() > 1 )
+  {
+    const size_t table_size = ParticleType_END*Event_END;
+
+    Utility::ArrayView<const uint64_t>
+      event_counts_view( d_event_counts.front().data(), table_size );
+
+    Utility::ArrayView<const double>
+      event_times_view( d_event_times.front().data(), table_size );
+
+    comm.barrier();
+
+    try{
+      if( comm.rank() == root_process )
+      {
+        EventCountTable reduced_event_counts;
+        EventTimeTable reduced_event_times;
+
+        Utility::reduce( comm,
+                         event_counts_view,
+                         Utility::ArrayView<uint64_t>( reduced_event_counts.front().data(), table_size ),
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        Utility::reduce( comm,
+                         event_times_view,
+                         Utility::ArrayView<double>( reduced_event_times.front().data(), table_size ),
+                         std::plus<double>(),
+                         root_process );
+
+        d_event_counts = reduced_event_counts;
+        d_event_times = reduced_event_times;
+      }
+      else
+      {
+        Utility::reduce( comm,
+                         event_counts_view,
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        Utility::reduce( comm,
+                         event_times_view,
+                         std::plus<double>(),
+                         root_process );
+
+        this->resetData();
+      }
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in transport "
+                             "instrumentation!" );
+
+    comm.barrier();
+  }
+}
+
+// Print a summary of the data
+/*! \details Only particle types with at least one recorded event will be
+ * printed.
+ */
+void TransportInstrumentation::printSummary( std::ostream& os ) const
+{
+  os << "Transport Instrumentation Summary..." << "\n";
+
+  if( !this->isEnabled() )
+  {
+    os << "  Transport instrumentation has not been enabled "
+       << "(FRENSIE_ENABLE_TRANSPORT_INSTRUMENTATION=OFF)" << std::endl;
+
+    return;
+  }
+
+  for( size_t i = ParticleType_START; i < ParticleType_END; ++i )
+  {
+    const ParticleType particle_type = static_cast<ParticleType>( i );
+
+    bool events_recorded = false;
+
+    for( size_t j = Event_START; j < Event_END; ++j )
+    {
+      if( d_event_counts[i][j] > 0 )
+      {
+        events_recorded = true;
+        break;
+      }
+    }
+
+    if( !events_recorded )
+      continue;
+
+    os << "  " << particle_type << ":\n";
+
+    for( size_t j = Event_START; j < Event_END; ++j )
+    {
+      const Event event = static_cast<Event>( j );
+
+      os << "    " << std::left << std::setw( 22 )
+         << Utility::toString( event ) + ": " << d_event_counts[i][j];
+
+      if( d_event_times[i][j] > 0.0 )
+        os << " (" << d_event_times[i][j] << " s)";
+
+      os << "\n";
+    }
+  }
+
+  os << std::flush;
+}
+
+// Log a summary of the data
+void TransportInstrumentation::logSummary() const
+{
+  std::ostringstream oss;
+
+  this->printSummary( oss );
+
+  FRENSIE_LOG_NOTIFICATION( oss.str() );
+}
+
+// Zero a count table
+void TransportInstrumentation::zeroTable( EventCountTable& table )
+{
+  for( auto&& row : table )
+    row.fill( 0 );
+}
+
+// Zero a time table
+void TransportInstrumentation::zeroTable( EventTimeTable& table )
+{
+  for( auto&& row : table )
+    row.fill( 0.0 );
+}
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+// Convert a MonteCarlo::TransportInstrumentation::Event to a string
+std::string ToStringTraits<MonteCarlo::TransportInstrumentation::Event>::toString(
+                      const MonteCarlo::TransportInstrumentation::Event event )
+{
+  switch( event )
+  {
+  case MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT:
+    return "Fire ray";
+  case MonteCarlo::TransportInstrumentation::SURFACE_CROSSING_EVENT:
+    return "Surface crossing";
+  case MonteCarlo::TransportInstrumentation::COLLISION_EVENT:
+    return "Collision";
+  case MonteCarlo::TransportInstrumentation::CROSS_SECTION_LOOKUP_EVENT:
+    return "Cross section lookup";
+  case MonteCarlo::TransportInstrumentation::BANK_PUSH_EVENT:
+    return "Bank push";
+  case MonteCarlo::TransportInstrumentation::LOST_PARTICLE_EVENT:
+    return "Lost particle";
+  case MonteCarlo::TransportInstrumentation::ROULETTE_EVENT:
+    return "Roulette";
+  case MonteCarlo::TransportInstrumentation::SPLIT_EVENT:
+    return "Split";
+  default:
+    THROW_EXCEPTION( std::logic_error,
+                     "The transport instrumentation event " << (int)event <<
+                     " cannot be converted to a string!" );
+  }
+}
+
+// Place the MonteCarlo::TransportInstrumentation::Event in a stream
+void ToStringTraits<MonteCarlo::TransportInstrumentation::Event>::toStream(
+                      std::ostream& os,
+                      const MonteCarlo::TransportInstrumentation::Event event )
+{
+  os << ToStringTraits<MonteCarlo::TransportInstrumentation::Event>::toString( event );
+}
+
+} // end Utility namespace
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::TransportInstrumentation );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TransportInstrumentation.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,337 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TransportInstrumentation.hpp
+//! \author Alex Robinson
+//! \brief  Transport instrumentation class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_TRANSPORT_INSTRUMENTATION_HPP
+#define MONTE_CARLO_TRANSPORT_INSTRUMENTATION_HPP
+
+// Std Lib Includes
+#include <array>
+#include <vector>
+#include <chrono>
+#include <iostream>
+
+// Boost Includes
+#include <boost/serialization/array_wrapper.hpp>
+
+// FRENSIE Includes
+#include "FRENSIE_config.hpp"
+#include "MonteCarlo_ParticleType.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+#if HAVE_FRENSIE_TRANSPORT_INSTRUMENTATION
+
+/*! This line will only be used if transport instrumentation is enabled
+ * \ingroup transport_instrumentation
+ */
+#define TRANSPORT_INSTRUMENTATION_LINE( ... ) __VA_ARGS__
+
+/*! Count a transport event
+ * \ingroup transport_instrumentation
+ */
+#define INSTRUMENT_TRANSPORT_EVENT( instrumentation, event, particle )   \
+  (instrumentation).countEvent( MonteCarlo::TransportInstrumentation::event, \
+                                (particle).getParticleType() )
+
+/*! Count and time a transport event (the timer stops at the end of the scope)
+ * \ingroup transport_instrumentation
+ */
+#define INSTRUMENT_TIMED_TRANSPORT_EVENT( instrumentation, event, particle ) \
+  MonteCarlo::TransportInstrumentation::ScopedEventTimer                \
+  __##event##_timer__( (instrumentation),                                \
+                       MonteCarlo::TransportInstrumentation::event,      \
+                       (particle).getParticleType() )
+
+#else // HAVE_FRENSIE_TRANSPORT_INSTRUMENTATION
+
+#define TRANSPORT_INSTRUMENTATION_LINE( ... )
+#define INSTRUMENT_TRANSPORT_EVENT( instrumentation, event, particle )
+#define INSTRUMENT_TIMED_TRANSPORT_EVENT( instrumentation, event, particle )
+
+#endif // end HAVE_FRENSIE_TRANSPORT_INSTRUMENTATION
+
+namespace MonteCarlo{
+
+/*! The transport instrumentation class
+ * \details This class records the number of times that the hot-path transport
+ * events occur for each particle type (and optionally the time spent
+ * processing the events). Each thread has its own counters so no
+ * synchronization is done when an event is recorded. The thread counters are
+ * aggregated at each rendezvous. The instrumentation hooks in the particle
+ * simulation manager are compiled out unless the
+ * FRENSIE_ENABLE_TRANSPORT_INSTRUMENTATION option is set - when they are
+ * compiled out all event counts will be zero.
+ */
+class TransportInstrumentation
+{
+
+public:
+
+  //! The instrumented transport events
+  enum Event{
+    Event_START = 0,
+    FIRE_RAY_EVENT = Event_START,
+    SURFACE_CROSSING_EVENT,
+    COLLISION_EVENT,
+    CROSS_SECTION_LOOKUP_EVENT,
+    BANK_PUSH_EVENT,
+    LOST_PARTICLE_EVENT,
+    ROULETTE_EVENT,
+    SPLIT_EVENT,
+    Event_END
+  };
+
+  //! The scoped event timer
+  class ScopedEventTimer
+  {
+
+  public:
+
+    //! Constructor (the event will be counted)
+    ScopedEventTimer( TransportInstrumentation& instrumentation,
+                      const Event event,
+                      const ParticleType particle_type );
+
+    //! Destructor (the elapsed time will be recorded)
+    ~ScopedEventTimer();
+
+  private:
+
+    // The instrumentation
+    TransportInstrumentation& d_instrumentation;
+
+    // The event
+    Event d_event;
+
+    // The particle type
+    ParticleType d_particle_type;
+
+    // The start time
+    std::chrono::steady_clock::time_point d_start_time;
+  };
+
+  //! Constructor
+  TransportInstrumentation();
+
+  //! Destructor
+  ~TransportInstrumentation()
+  { /* ... */ }
+
+  //! Check if the instrumentation hooks have been compiled in
+  static bool isEnabled();
+
+  //! Turn on the event timers
+  void setEventTimersOn();
+
+  //! Turn off the event timers
+  void setEventTimersOff();
+
+  //! Check if the event timers are on
+  bool areEventTimersOn() const;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads );
+
+  //! Count an event
+  void countEvent( const Event event,
+                   const ParticleType particle_type,
+                   const uint64_t count = 1 );
+
+  //! Add time to an event
+  void addEventTime( const Event event,
+                     const ParticleType particle_type,
+                     const double time );
+
+  //! Aggregate the thread counters
+  void aggregateThreadData();
+
+  //! Return the number of times that an event occurred for a particle type
+  uint64_t getEventCount( const Event event,
+                          const ParticleType particle_type ) const;
+
+  //! Return the number of times that an event occurred
+  uint64_t getEventCount( const Event event ) const;
+
+  //! Return the time spent processing an event for a particle type (s)
+  double getEventTime( const Event event,
+                       const ParticleType particle_type ) const;
+
+  //! Return the time spent processing an event (s)
+  double getEventTime( const Event event ) const;
+
+  //! Reset the data
+  void resetData();
+
+  //! Reduce the distributed data
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process );
+
+  //! Print a summary of the data
+  void printSummary( std::ostream& os ) const;
+
+  //! Log a summary of the data
+  void logSummary() const;
+
+private:
+
+  // The event count table
+  typedef std::array<std::array<uint64_t,Event_END>,ParticleType_END> EventCountTable;
+
+  // The event time table
+  typedef std::array<std::array<double,Event_END>,ParticleType_END> EventTimeTable;
+
+  // The thread data
+  struct ThreadData
+  {
+    // The event counts
+    EventCountTable event_counts;
+
+    // The event times
+    EventTimeTable event_times;
+
+    // Padding that prevents false sharing between threads
+    char padding[64];
+  };
+
+  // Zero a count table
+  static void zeroTable( EventCountTable& table );
+
+  // Zero a time table
+  static void zeroTable( EventTimeTable& table );
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // Records if the event timers are on
+  bool d_event_timers_on;
+
+  // The aggregated event counts
+  EventCountTable d_event_counts;
+
+  // The aggregated event times
+  EventTimeTable d_event_times;
+
+  // The thread data
+  std::vector<ThreadData> d_thread_data;
+};
+
+// Count an event
+inline void TransportInstrumentation::countEvent(
+                                              const Event event,
+                                              const ParticleType particle_type,
+                                              const uint64_t count )
+{
+  d_thread_data[Utility::OpenMPProperties::getThreadId()].event_counts[particle_type][event] += count;
+}
+
+// Add time to an event
+inline void TransportInstrumentation::addEventTime(
+                                              const Event event,
+                                              const ParticleType particle_type,
+                                              const double time )
+{
+  d_thread_data[Utility::OpenMPProperties::getThreadId()].event_times[particle_type][event] += time;
+}
+
+// Check if the event timers are on
+inline bool TransportInstrumentation::areEventTimersOn() const
+{
+  return d_event_timers_on;
+}
+
+// Constructor (the event will be counted)
+inline TransportInstrumentation::ScopedEventTimer::ScopedEventTimer(
+                                     TransportInstrumentation& instrumentation,
+                                     const Event event,
+                                     const ParticleType particle_type )
+  : d_instrumentation( instrumentation ),
+    d_event( event ),
+    d_particle_type( particle_type ),
+    d_start_time()
+{
+  d_instrumentation.countEvent( event, particle_type );
+
+  if( d_instrumentation.areEventTimersOn() )
+    d_start_time = std::chrono::steady_clock::now();
+}
+
+// Destructor (the elapsed time will be recorded)
+inline TransportInstrumentation::ScopedEventTimer::~ScopedEventTimer()
+{
+  if( d_instrumentation.areEventTimersOn() )
+  {
+    std::chrono::duration<double> elapsed_time =
+      std::chrono::steady_clock::now() - d_start_time;
+
+    d_instrumentation.addEventTime( d_event,
+                                    d_particle_type,
+                                    elapsed_time.count() );
+  }
+}
+
+// Save the data to an archive
+template<typename Archive>
+void TransportInstrumentation::save( Archive& ar, const unsigned version ) const
+{
+  ar & BOOST_SERIALIZATION_NVP( d_event_timers_on );
+  ar & boost::serialization::make_nvp( "d_event_counts", boost::serialization::make_array( d_event_counts.front().data(), ParticleType_END*Event_END ) );
+  ar & boost::serialization::make_nvp( "d_event_times", boost::serialization::make_array( d_event_times.front().data(), ParticleType_END*Event_END ) );
+}
+
+// Load the data from an archive
+template<typename Archive>
+void TransportInstrumentation::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_event_timers_on );
+  ar & boost::serialization::make_nvp( "d_event_counts", boost::serialization::make_array( d_event_counts.front().data(), ParticleType_END*Event_END ) );
+  ar & boost::serialization::make_nvp( "d_event_times", boost::serialization::make_array( d_event_times.front().data(), ParticleType_END*Event_END ) );
+
+  // The thread data must be reinitialized
+  this->enableThreadSupport( 1 );
+}
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * MonteCarlo::TransportInstrumentation::Event
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<MonteCarlo::TransportInstrumentation::Event>
+{
+  //! Convert a MonteCarlo::TransportInstrumentation::Event to a string
+  static std::string toString( const MonteCarlo::TransportInstrumentation::Event event );
+
+  //! Place the MonteCarlo::TransportInstrumentation::Event in a stream
+  static void toStream( std::ostream& os, const MonteCarlo::TransportInstrumentation::Event event );
+};
+
+} // end Utility namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( TransportInstrumentation, MonteCarlo, 0 );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, TransportInstrumentation );
+
+#endif // end MONTE_CARLO_TRANSPORT_INSTRUMENTATION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TransportInstrumentation.hpp
+//---------------------------------------------------------------------------//
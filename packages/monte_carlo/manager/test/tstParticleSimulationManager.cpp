@@ -924,6 +924,79 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the transport events are counted
+FRENSIE_UNIT_TEST( ParticleSimulationManager, getTransportInstrumentation )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 10 );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    manager = factory->getManager();
+  }
+
+  manager->getTransportInstrumentation().setEventTimersOn();
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  const MonteCarlo::TransportInstrumentation& instrumentation =
+    manager->getTransportInstrumentation();
+
+  // Every source photon must fire at least one ray
+  if( MonteCarlo::TransportInstrumentation::isEnabled() )
+  {
+    FRENSIE_CHECK( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT, MonteCarlo::PHOTON ) >= 10 );
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT, MonteCarlo::NEUTRON ), 0 );
+    FRENSIE_CHECK( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ) > 0.0 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::LOST_PARTICLE_EVENT ), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
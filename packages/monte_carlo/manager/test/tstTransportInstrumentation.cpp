@@ -0,0 +1,241 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstTransportInstrumentation.cpp
+//! \author Alex Robinson
+//! \brief  Transport instrumentation unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_TransportInstrumentation.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the event timers can be turned on and off
+FRENSIE_UNIT_TEST( TransportInstrumentation, setEventTimersOn )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  FRENSIE_CHECK( !instrumentation.areEventTimersOn() );
+
+  instrumentation.setEventTimersOn();
+
+  FRENSIE_CHECK( instrumentation.areEventTimersOn() );
+
+  instrumentation.setEventTimersOff();
+
+  FRENSIE_CHECK( !instrumentation.areEventTimersOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that events can be counted
+FRENSIE_UNIT_TEST( TransportInstrumentation, countEvent )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  instrumentation.countEvent( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT,
+                              MonteCarlo::NEUTRON );
+  instrumentation.countEvent( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT,
+                              MonteCarlo::PHOTON,
+                              3 );
+  instrumentation.countEvent( MonteCarlo::TransportInstrumentation::SPLIT_EVENT,
+                              MonteCarlo::PHOTON,
+                              2 );
+
+  // The thread data has not been aggregated yet
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 0 );
+
+  instrumentation.aggregateThreadData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT, MonteCarlo::NEUTRON ), 1 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT, MonteCarlo::PHOTON ), 3 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 4 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::SPLIT_EVENT ), 2 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::COLLISION_EVENT ), 0 );
+
+  // Aggregating again must not double count
+  instrumentation.aggregateThreadData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 4 );
+
+  instrumentation.resetData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 0 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::SPLIT_EVENT ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that event times can be added
+FRENSIE_UNIT_TEST( TransportInstrumentation, addEventTime )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  instrumentation.addEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+                                MonteCarlo::NEUTRON,
+                                1.0 );
+  instrumentation.addEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+                                MonteCarlo::ELECTRON,
+                                0.5 );
+
+  instrumentation.aggregateThreadData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::NEUTRON ), 1.0 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT ), 1.5 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a scoped event timer counts and times an event
+FRENSIE_UNIT_TEST( TransportInstrumentation, ScopedEventTimer )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  MonteCarlo::NeutronState neutron( 0 );
+
+  {
+    MonteCarlo::TransportInstrumentation::ScopedEventTimer
+      timer( instrumentation,
+             MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+             neutron.getParticleType() );
+  }
+
+  instrumentation.setEventTimersOn();
+
+  {
+    MonteCarlo::TransportInstrumentation::ScopedEventTimer
+      timer( instrumentation,
+             MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+             neutron.getParticleType() );
+  }
+
+  instrumentation.aggregateThreadData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::NEUTRON ), 2 );
+  FRENSIE_CHECK( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::NEUTRON ) >= 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the instrumentation macros are compiled out when disabled
+FRENSIE_UNIT_TEST( TransportInstrumentation, macros )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  MonteCarlo::NeutronState neutron( 0 );
+
+  INSTRUMENT_TRANSPORT_EVENT( instrumentation, SURFACE_CROSSING_EVENT, neutron );
+
+  {
+    INSTRUMENT_TIMED_TRANSPORT_EVENT( instrumentation, FIRE_RAY_EVENT, neutron );
+  }
+
+  instrumentation.aggregateThreadData();
+
+  if( MonteCarlo::TransportInstrumentation::isEnabled() )
+  {
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::SURFACE_CROSSING_EVENT ), 1 );
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 1 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::SURFACE_CROSSING_EVENT ), 0 );
+    FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::FIRE_RAY_EVENT ), 0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a summary can be printed
+FRENSIE_UNIT_TEST( TransportInstrumentation, printSummary )
+{
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  instrumentation.countEvent( MonteCarlo::TransportInstrumentation::LOST_PARTICLE_EVENT,
+                              MonteCarlo::NEUTRON );
+  instrumentation.aggregateThreadData();
+
+  std::ostringstream oss;
+
+  instrumentation.printSummary( oss );
+
+  FRENSIE_CHECK( oss.str().find( "Transport Instrumentation Summary" ) !=
+                 std::string::npos );
+
+  if( MonteCarlo::TransportInstrumentation::isEnabled() )
+  {
+    FRENSIE_CHECK( oss.str().find( "Lost particle: " ) != std::string::npos );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the instrumentation can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( TransportInstrumentation,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_transport_instrumentation" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::TransportInstrumentation instrumentation;
+    instrumentation.setEventTimersOn();
+    instrumentation.countEvent( MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+                                MonteCarlo::PHOTON,
+                                10 );
+    instrumentation.addEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+                                  MonteCarlo::PHOTON,
+                                  2.0 );
+    instrumentation.aggregateThreadData();
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( instrumentation ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived instrumentation
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::TransportInstrumentation instrumentation;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( instrumentation ) );
+
+  FRENSIE_CHECK( instrumentation.areEventTimersOn() );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::PHOTON ), 10 );
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventTime( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::PHOTON ), 2.0 );
+
+  // The loaded instrumentation must still be usable
+  instrumentation.countEvent( MonteCarlo::TransportInstrumentation::COLLISION_EVENT,
+                              MonteCarlo::PHOTON );
+  instrumentation.aggregateThreadData();
+
+  FRENSIE_CHECK_EQUAL( instrumentation.getEventCount( MonteCarlo::TransportInstrumentation::COLLISION_EVENT, MonteCarlo::PHOTON ), 11 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstTransportInstrumentation.cpp
+//---------------------------------------------------------------------------//
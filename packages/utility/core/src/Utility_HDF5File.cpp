@@ -134,6 +134,46 @@ HDF5File::HDF5File( const std::string& filename,
 HDF5File::~HDF5File()
 { /* ... */ }
 
+// Check if a compression filter is available for writing
+/*! \details The szip filter is often built without encoding support, in
+ * which case it can only be used to read existing data sets.
+ */
+bool HDF5File::isCompressionFilterAvailable(
+                                  const HDF5File::CompressionFilter filter )
+{
+#ifdef HAVE_FRENSIE_HDF5
+  H5Z_filter_t filter_id;
+
+  switch( filter )
+  {
+    case HDF5File::NO_COMPRESSION: return true;
+    case HDF5File::GZIP_COMPRESSION:
+    {
+      filter_id = H5Z_FILTER_DEFLATE;
+      break;
+    }
+    case HDF5File::SZIP_COMPRESSION:
+    {
+      filter_id = H5Z_FILTER_SZIP;
+      break;
+    }
+    default: return false;
+  }
+
+  if( H5Zfilter_avail( filter_id ) <= 0 )
+    return false;
+
+  unsigned filter_config = 0;
+
+  if( H5Zget_filter_info( filter_id, &filter_config ) < 0 )
+    return false;
+
+  return filter_config & H5Z_FILTER_CONFIG_ENCODE_ENABLED;
+#else
+  return filter == HDF5File::NO_COMPRESSION;
+#endif // end HAVE_FRENSIE_HDF5
+}
+
 // Get the file name
 const std::string& HDF5File::getFilename() const throw()
 {
@@ -271,6 +311,30 @@ HDF5_ENABLED_DISABLED_SWITCH(hsize_t,size_t) HDF5File::getGroupAttributeSize(
 #endif
 }
 
+// Get the names of the objects (groups and data sets) in a group
+void HDF5File::getGroupObjectNames( const std::string& path_to_group,
+                                    std::vector<std::string>& object_names ) const
+{
+  object_names.clear();
+  
+#ifdef HAVE_FRENSIE_HDF5
+  std::unique_ptr<const H5::Group> group;
+
+  this->openGroup( path_to_group, group );
+
+  try{
+    const hsize_t number_of_objects = group->getNumObjs();
+
+    object_names.resize( number_of_objects );
+
+    for( hsize_t i = 0; i < number_of_objects; ++i )
+      object_names[i] = group->getObjnameByIdx( i );
+  }
+  HDF5_EXCEPTION_CATCH( "Could not get the names of the objects in group "
+                        << path_to_group << "!" );
+#endif // end HAVE_FRENSIE_HDF5
+}
+
 // Create a group
 void HDF5File::createGroup( const std::string& path_to_group )
 {
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <string>
+#include <vector>
 #include <memory>
 #include <stdexcept>
 #include <sstream>
@@ -43,6 +44,13 @@ public:
     OVERWRITE,
   };
 
+  //! Data set compression filters
+  enum CompressionFilter{
+    NO_COMPRESSION,
+    GZIP_COMPRESSION,
+    SZIP_COMPRESSION
+  };
+
   //! The exception class
   class Exception;
 
@@ -53,6 +61,9 @@ public:
   //! Destructor
   virtual ~HDF5File();
 
+  //! Check if a compression filter is available for writing
+  static bool isCompressionFilterAvailable( const HDF5File::CompressionFilter filter );
+
   //! Get the file name
   const std::string& getFilename() const throw();
 
@@ -84,6 +95,10 @@ public:
                                      const std::string& path_to_group,
                                      const std::string& attribute_name ) const;
 
+  //! Get the names of the objects (groups and data sets) in a group
+  void getGroupObjectNames( const std::string& path_to_group,
+                            std::vector<std::string>& object_names ) const;
+
   //! Create a group
   void createGroup( const std::string& path_to_group );
 
@@ -106,12 +121,29 @@ public:
   void writeToDataSet( const std::string& path_to_data_set,
                        const T& data );
 
+  //! Write data to a chunked data set
+  template<typename T>
+  void writeToChunkedDataSet( const std::string& path_to_data_set,
+                              const T* data,
+                              const size_t size,
+                              const size_t chunk_size,
+                              const HDF5File::CompressionFilter filter =
+                              HDF5File::NO_COMPRESSION,
+                              const bool shuffle = false );
+
   //! Read data from a data set
   template<typename T>
   void readFromDataSet( const std::string& path_to_data_set,
                         T* data,
                         const size_t size ) const;
 
+  //! Read a contiguous block of data from a data set
+  template<typename T>
+  void readBlockFromDataSet( const std::string& path_to_data_set,
+                             T* data,
+                             const size_t offset,
+                             const size_t size ) const;
+
   //! Write data to a data set attribute
   template<typename T>
   void writeToDataSetAttribute( const std::string& path_to_data_set,
@@ -213,6 +245,15 @@ private:
   void createDataSet( const std::string& path_to_data_set,
                       const size_t data_set_size,
                       std::unique_ptr<H5::DataSet>& data_set );
+
+  // Create a chunked data set
+  template<typename T>
+  void createChunkedDataSet( const std::string& path_to_data_set,
+                             const size_t data_set_size,
+                             const size_t chunk_size,
+                             const HDF5File::CompressionFilter filter,
+                             const bool shuffle,
+                             std::unique_ptr<H5::DataSet>& data_set );
   
   // Open a data set
   void openDataSet( const std::string& path_to_data_set,
@@ -9,6 +9,9 @@
 #ifndef UTILITY_HDF5_FILE_DEF_HPP
 #define UTILITY_HDF5_FILE_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "Utility_HDF5TypeTraits.hpp"
 #include "Utility_Array.hpp"
@@ -70,6 +73,73 @@ inline void HDF5File::writeToDataSet( const std::string& path_to_data_set,
                                       const T& data )
 { this->writeToDataSet( path_to_data_set, &data, 1 ); }
 
+// Write data to a chunked data set
+/*! \details The data set will be stored in chunks of the requested size
+ * (number of elements). Each chunk can be compressed independently, which
+ * makes chunked data sets ideal for very large arrays (e.g. estimator
+ * moments with millions of bins) that only need to be read back in blocks
+ * (see HDF5File::readBlockFromDataSet). The shuffle filter reorders the
+ * bytes of each chunk before compression, which usually improves the
+ * compression ratio of floating-point data. Empty data sets will be stored
+ * contiguously since HDF5 does not allow empty chunks.
+ */
+template<typename T>
+void HDF5File::writeToChunkedDataSet( const std::string& path_to_data_set,
+                                      const T* data,
+                                      const size_t size,
+                                      const size_t chunk_size,
+                                      const HDF5File::CompressionFilter filter,
+                                      const bool shuffle )
+{
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+  
+#ifdef HAVE_FRENSIE_HDF5
+  if( this->doesDataSetExist( path_to_data_set ) )
+  {
+    THROW_EXCEPTION( HDF5File::Exception,
+                     "Overwriting the data in an existing data set ("
+                     << path_to_data_set << ") is not currently supported!" );
+  }
+  else
+  {
+    if( !this->doesParentGroupExist( path_to_data_set ) )
+      this->createParentGroup( path_to_data_set );
+
+    // Create the data set
+    std::unique_ptr<H5::DataSet> data_set;
+
+    if( size > 0 )
+    {
+      this->createChunkedDataSet<T>( path_to_data_set,
+                                     size,
+                                     chunk_size,
+                                     filter,
+                                     shuffle,
+                                     data_set );
+    }
+    else
+      this->createDataSet<T>( path_to_data_set, size, data_set );
+
+    // Convert the data to a format that is compatible with HDF5
+    typename HDF5TypeTraits<T>::InternalType* internal_data =
+      HDF5TypeTraits<T>::initializeInternalData( data, size );
+
+    HDF5TypeTraits<T>::convertExternalDataToInternalData( data, size, internal_data );
+
+    // Write the data to the data set
+    try{
+      data_set->write( internal_data, HDF5TypeTraits<T>::dataType() );
+    }
+    HDF5_EXCEPTION_CATCH( "Could not write data to chunked data set "
+                          << path_to_data_set << "!" );
+
+    // Clean up the temporary data
+    HDF5TypeTraits<T>::freeInternalData( internal_data );
+  }
+#endif
+}
+
 // Read data from a data set
 template<typename T>
 void HDF5File::readFromDataSet( const std::string& path_to_data_set,
@@ -109,6 +179,78 @@ void HDF5File::readFromDataSet( const std::string& path_to_data_set,
 #endif
 }
 
+// Read a contiguous block of data from a data set
+/*! \details Only the requested block of the data set will be read from the
+ * file. When the data set is chunked only the chunks that overlap the block
+ * will be read (and decompressed).
+ */
+template<typename T>
+void HDF5File::readBlockFromDataSet( const std::string& path_to_data_set,
+                                     T* data,
+                                     const size_t offset,
+                                     const size_t size ) const
+{
+#ifdef HAVE_FRENSIE_HDF5
+  // Open the data set
+  std::unique_ptr<const H5::DataSet> data_set;
+
+  this->openDataSet( path_to_data_set, data_set );
+
+  hsize_t internal_offset =
+    HDF5TypeTraits<T>::calculateInternalDataSize( offset );
+
+  hsize_t internal_size =
+    HDF5TypeTraits<T>::calculateInternalDataSize( size );
+
+  // Check if the block can be stored in the desired memory location
+  TEST_FOR_EXCEPTION( !this->doesDataSetTypeMatch( HDF5TypeTraits<T>::dataType(), *data_set ),
+                      HDF5File::Exception,
+                      "Cannot store the contents of data set "
+                      << path_to_data_set << " in the desired memory "
+                      "location!" );
+
+  // Check if the block is inside of the data set
+  TEST_FOR_EXCEPTION( internal_offset + internal_size >
+                      this->getDataSetSize( *data_set ),
+                      HDF5File::Exception,
+                      "The requested block [" << offset << ","
+                      << offset + size << ") is outside of data set "
+                      << path_to_data_set << "!" );
+
+  if( size == 0 )
+    return;
+
+  // Load the block from the data set in its internal format
+  typename HDF5TypeTraits<T>::InternalType* internal_data =
+    HDF5TypeTraits<T>::initializeInternalData( data, size );
+
+  try{
+    H5::DataSpace file_space = data_set->getSpace();
+
+    file_space.selectHyperslab( H5S_SELECT_SET,
+                                &internal_size,
+                                &internal_offset );
+
+    H5::DataSpace memory_space( 1, &internal_size );
+
+    data_set->read( internal_data,
+                    HDF5TypeTraits<T>::dataType(),
+                    memory_space,
+                    file_space );
+  }
+  HDF5_EXCEPTION_CATCH( "Could not read a block of data from data set "
+                        << path_to_data_set << "!" );
+
+  // Convert the internal data to the desired format
+  HDF5TypeTraits<T>::convertInternalDataToExternalData( internal_data,
+                                                        size,
+                                                        data );
+
+  // Clean up temporary data
+  HDF5TypeTraits<T>::freeInternalData( internal_data );
+#endif
+}
+
 // Write data to a data set attribute
 template<typename T>
 void HDF5File::writeToDataSetAttribute( const std::string& path_to_data_set,
@@ -337,6 +479,62 @@ void HDF5File::createDataSet( const std::string& path_to_data_set,
                         << path_to_data_set << "!" );
 }
 
+// Create a chunked data set
+template<typename T>
+void HDF5File::createChunkedDataSet( const std::string& path_to_data_set,
+                                     const size_t array_size,
+                                     const size_t chunk_size,
+                                     const HDF5File::CompressionFilter filter,
+                                     const bool shuffle,
+                                     std::unique_ptr<H5::DataSet>& data_set )
+{
+  TEST_FOR_EXCEPTION( !HDF5File::isCompressionFilterAvailable( filter ),
+                      HDF5File::Exception,
+                      "Could not create data set " << path_to_data_set <<
+                      " because the requested compression filter ("
+                      << (unsigned)filter << ") is not available!" );
+  
+  try{
+    hsize_t data_set_size =
+      HDF5TypeTraits<T>::calculateInternalDataSize( array_size );
+
+    // The chunks of a fixed size data set cannot be larger than the data set
+    hsize_t data_set_chunk_size =
+      std::min( HDF5TypeTraits<T>::calculateInternalDataSize( chunk_size ),
+                data_set_size );
+    
+    H5::DataSpace space( 1, &data_set_size );
+
+    H5::DSetCreatPropList properties;
+    properties.setChunk( 1, &data_set_chunk_size );
+
+    // The shuffle filter must be applied before the compression filter
+    if( shuffle )
+      properties.setShuffle();
+
+    if( filter == HDF5File::GZIP_COMPRESSION )
+      properties.setDeflate( 6 );
+    else if( filter == HDF5File::SZIP_COMPRESSION )
+    {
+      // The number of pixels per block must be even and cannot exceed the
+      // number of elements in a chunk
+      const unsigned pixels_per_block =
+        std::min( data_set_chunk_size, (hsize_t)32 ) & ~(hsize_t)1;
+
+      if( pixels_per_block > 0 )
+        properties.setSzip( H5_SZIP_NN_OPTION_MASK, pixels_per_block );
+    }
+
+    data_set.reset( new H5::DataSet( d_hdf5_file->createDataSet(
+                                                 path_to_data_set,
+                                                 HDF5TypeTraits<T>::dataType(),
+                                                 space,
+                                                 properties ) ) );
+  }
+  HDF5_EXCEPTION_CATCH( "Could not create chunked data set "
+                        << path_to_data_set << "!" );
+}
+
 // Create a data set attribute
 template<typename T>
 void HDF5File::createDataSetAttribute( const H5::DataSet& data_set,
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <cstddef>
 
 // FRENSIE Includes
 #include "Utility_Timer.hpp"
@@ -40,6 +41,11 @@ public:
   //! Return if OpenMP has been configured for use
   static bool isOpenMPUsed();
 
+  //! Execute the loop body for every index with the requested threads
+  template<typename LoopBody>
+  static void parallelFor( const size_t number_of_iterations,
+                           const LoopBody& loop_body );
+
 private:
 
   // The number of threads to use in parallel blocks
@@ -48,6 +54,14 @@ private:
 
 } // end Utility namespace
 
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_OpenMPProperties_def.hpp"
+
+//---------------------------------------------------------------------------//
+
 #endif // end UTILITY_OPEN_MP_PROPERTIES_HPP
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,61 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_OpenMPProperties_def.hpp
+//! \author Alex Robinson
+//! \brief  Global OpenMP session details template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_OPEN_MP_PROPERTIES_DEF_HPP
+#define UTILITY_OPEN_MP_PROPERTIES_DEF_HPP
+
+// Std Lib Includes
+#include <exception>
+
+namespace Utility{
+
+// Execute the loop body for every index with the requested threads
+/*! \details The loop body must have the signature void(size_t) and it must
+ * be thread safe. The iterations are dynamically scheduled since the cost
+ * of each iteration can vary considerably (e.g. adaptive integration).
+ * Exceptions cannot leave an OpenMP parallel block. The exception thrown by
+ * the lowest index will be rethrown once all iterations have completed so
+ * that the error reported does not depend on the number of threads.
+ */
+template<typename LoopBody>
+void OpenMPProperties::parallelFor( const size_t number_of_iterations,
+                                    const LoopBody& loop_body )
+{
+  std::exception_ptr exception;
+  size_t exception_index = number_of_iterations;
+
+  #pragma omp parallel for num_threads( OpenMPProperties::getRequestedNumberOfThreads() ) schedule( dynamic )
+  for( size_t i = 0; i < number_of_iterations; ++i )
+  {
+    try{
+      loop_body( i );
+    }
+    catch( ... )
+    {
+      #pragma omp critical( openmp_properties_parallel_for_exception )
+      {
+        if( i < exception_index )
+        {
+          exception_index = i;
+          exception = std::current_exception();
+        }
+      }
+    }
+  }
+
+  if( exception )
+    std::rethrow_exception( exception );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_OPEN_MP_PROPERTIES_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_OpenMPProperties_def.hpp
+//---------------------------------------------------------------------------//
@@ -537,6 +537,123 @@ FRENSIE_UNIT_TEST_TEMPLATE( HDF5File, group_attribute_rw, TestTypes )
   delete[] extracted_data;
 }
 
+//---------------------------------------------------------------------------//
+// Check that data can be written to and read from a chunked data set
+FRENSIE_UNIT_TEST( HDF5File, chunked_data_set_rw )
+{
+  Utility::HDF5File hdf5_file( hdf5_file_name, Utility::HDF5File::READ_WRITE  );
+
+  std::vector<double> data( 1000 );
+
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = i*0.5;
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/uncompressed", data.data(), data.size(), 64 ) );
+  FRENSIE_REQUIRE( hdf5_file.doesDataSetExist( "/chunked_dir/uncompressed" ) );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getDataSetSize( "/chunked_dir/uncompressed" ),
+                       data.size() );
+
+  // The chunk size can be larger than the data set
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/large_chunk", data.data(), 10, 64 ) );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getDataSetSize( "/chunked_dir/large_chunk" ),
+                       10 );
+
+  // Empty data sets are stored contiguously
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/empty", data.data(), 0, 64 ) );
+  FRENSIE_CHECK_EQUAL( hdf5_file.getDataSetSize( "/chunked_dir/empty" ), 0 );
+
+  std::vector<double> extracted_data( data.size() );
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.readFromDataSet( "/chunked_dir/uncompressed", extracted_data.data(), extracted_data.size() ) );
+  FRENSIE_CHECK_EQUAL( extracted_data, data );
+
+  if( Utility::HDF5File::isCompressionFilterAvailable( Utility::HDF5File::GZIP_COMPRESSION ) )
+  {
+    FRENSIE_REQUIRE_NO_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/gzip", data.data(), data.size(), 64, Utility::HDF5File::GZIP_COMPRESSION, true ) );
+
+    extracted_data.assign( data.size(), 0.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( hdf5_file.readFromDataSet( "/chunked_dir/gzip", extracted_data.data(), extracted_data.size() ) );
+    FRENSIE_CHECK_EQUAL( extracted_data, data );
+  }
+
+  if( Utility::HDF5File::isCompressionFilterAvailable( Utility::HDF5File::SZIP_COMPRESSION ) )
+  {
+    FRENSIE_REQUIRE_NO_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/szip", data.data(), data.size(), 64, Utility::HDF5File::SZIP_COMPRESSION ) );
+
+    extracted_data.assign( data.size(), 0.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( hdf5_file.readFromDataSet( "/chunked_dir/szip", extracted_data.data(), extracted_data.size() ) );
+    FRENSIE_CHECK_EQUAL( extracted_data, data );
+  }
+
+  // Existing data sets cannot be overwritten
+  FRENSIE_CHECK_THROW( hdf5_file.writeToChunkedDataSet( "/chunked_dir/uncompressed", data.data(), data.size(), 64 ),
+                       Utility::HDF5File::Exception );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a block of data can be read from a data set
+FRENSIE_UNIT_TEST( HDF5File, readBlockFromDataSet )
+{
+  Utility::HDF5File hdf5_file( hdf5_file_name, Utility::HDF5File::READ_WRITE  );
+
+  std::vector<double> data( 1000 );
+
+  for( size_t i = 0; i < data.size(); ++i )
+    data[i] = i*0.5;
+
+  if( !hdf5_file.doesDataSetExist( "/block_dir/chunked" ) )
+    hdf5_file.writeToChunkedDataSet( "/block_dir/chunked", data.data(), data.size(), 64 );
+
+  if( !hdf5_file.doesDataSetExist( "/block_dir/contiguous" ) )
+    hdf5_file.writeToDataSet( "/block_dir/contiguous", data.data(), data.size() );
+
+  std::vector<double> block( 100 );
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.readBlockFromDataSet( "/block_dir/chunked", block.data(), 150, block.size() ) );
+  FRENSIE_CHECK_EQUAL( block, std::vector<double>( data.begin()+150, data.begin()+250 ) );
+
+  block.assign( block.size(), 0.0 );
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.readBlockFromDataSet( "/block_dir/contiguous", block.data(), 900, block.size() ) );
+  FRENSIE_CHECK_EQUAL( block, std::vector<double>( data.begin()+900, data.end() ) );
+
+  // The block must be inside of the data set
+  FRENSIE_CHECK_THROW( hdf5_file.readBlockFromDataSet( "/block_dir/chunked", block.data(), 901, block.size() ),
+                       Utility::HDF5File::Exception );
+
+  // The block type must match the data set type
+  std::vector<int> int_block( 10 );
+
+  FRENSIE_CHECK_THROW( hdf5_file.readBlockFromDataSet( "/block_dir/chunked", int_block.data(), 0, int_block.size() ),
+                       Utility::HDF5File::Exception );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the names of the objects in a group can be returned
+FRENSIE_UNIT_TEST( HDF5File, getGroupObjectNames )
+{
+  Utility::HDF5File hdf5_file( hdf5_file_name, Utility::HDF5File::READ_WRITE  );
+
+  if( !hdf5_file.doesGroupExist( "/names_dir/a/" ) )
+    hdf5_file.createGroup( "/names_dir/a/" );
+
+  if( !hdf5_file.doesDataSetExist( "/names_dir/b" ) )
+    hdf5_file.writeToDataSet( "/names_dir/b", 1.0 );
+
+  std::vector<std::string> object_names;
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.getGroupObjectNames( "/names_dir", object_names ) );
+  FRENSIE_CHECK_EQUAL( object_names, std::vector<std::string>({"a", "b"}) );
+
+  FRENSIE_REQUIRE_NO_THROW( hdf5_file.getGroupObjectNames( "/names_dir/a", object_names ) );
+  FRENSIE_CHECK( object_names.empty() );
+
+  FRENSIE_CHECK_THROW( hdf5_file.getGroupObjectNames( "/missing_dir", object_names ),
+                       Utility::HDF5File::Exception );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a hard link can be created
 FRENSIE_UNIT_TEST( HDF5File, createHardLink )
@@ -10,6 +10,8 @@
 #include <iostream>
 #include <sstream>
 #include <thread>
+#include <vector>
+#include <stdexcept>
 
 // Boost Includes
 #define BOOST_TEST_MAIN
@@ -115,6 +117,44 @@ BOOST_AUTO_TEST_CASE( createTimer )
                timer->elapsed().count() < 0.15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a loop can be executed with the requested threads
+BOOST_AUTO_TEST_CASE( parallelFor )
+{
+  Utility::OpenMPProperties::setNumberOfThreads( 4 );
+
+  std::vector<double> values( 100, 0.0 );
+
+  Utility::OpenMPProperties::parallelFor( values.size(),
+                                          [&values]( const size_t i )
+                                          { values[i] = 2.0*i; } );
+
+  for( size_t i = 0; i < values.size(); ++i )
+    BOOST_CHECK_EQUAL( values[i], 2.0*i );
+
+  // The exception from the lowest index should be rethrown
+  std::string message;
+
+  try{
+    Utility::OpenMPProperties::parallelFor( values.size(),
+                                            []( const size_t i )
+                                            {
+                                              if( i % 10 == 5 )
+                                              {
+                                                throw std::runtime_error( Utility::toString( i ) );
+                                              }
+                                            } );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    message = exception.what();
+  }
+
+  BOOST_CHECK_EQUAL( message, "5" );
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstOpenMPProperties.cpp
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <functional>
 #include <iostream>
+#include <vector>
 
 // Boost Includes
 #include <boost/function.hpp>
@@ -47,6 +48,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Set parallel refinement mode to on
+  void setParallelRefinementModeOn();
+
+  //! Set parallel refinement mode to off (default)
+  void setParallelRefinementModeOff();
+
+  //! Check if parallel refinement mode is on
+  bool isParallelRefinementModeOn() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
@@ -126,6 +136,18 @@ public:
 
 private:
 
+  // Refine the grid between the first and last point in batches
+  template<typename Functor>
+  void refineInBatches( std::vector<double>& grid,
+                        std::vector<double>& evaluated_function,
+                        const Functor& function ) const;
+
+  // Evaluate the function at a batch of points
+  template<typename Functor>
+  static void evaluateBatch( const std::vector<double>& points,
+                             std::vector<double>& evaluated_function,
+                             const Functor& function );
+
   // Check for convergence
   bool hasGridConverged( const double lower_grid_point,
                          const double mid_grid_point,
@@ -144,6 +166,9 @@ private:
 
   // Throw exception on dirty convergence
   bool d_throw_exceptions;
+
+  // Refine the grid in parallel batches
+  bool d_parallel_refinement;
 };
 
 } // end Utility namespace
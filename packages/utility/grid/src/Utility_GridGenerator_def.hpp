@@ -13,6 +13,8 @@
 #include <deque>
 #include <iterator>
 #include <sstream>
+#include <algorithm>
+#include <utility>
 
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
@@ -22,6 +24,7 @@
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 
 namespace Utility{
@@ -34,7 +37,8 @@ GridGenerator<InterpPolicy>::GridGenerator( const double convergence_tol,
   : d_convergence_tol( convergence_tol ),
     d_absolute_diff_tol( absolute_diff_tol ),
     d_distance_tol( distance_tol ),
-    d_throw_exceptions( false )
+    d_throw_exceptions( false ),
+    d_parallel_refinement( false )
 {
   // Make sure the convergence tolerance is valid
   testPrecondition( convergence_tol <= 1.0 );
@@ -78,6 +82,33 @@ bool GridGenerator<InterpPolicy>::isExceptionThrownOnDirtyConvergence() const
   return d_throw_exceptions;
 }
 
+// Set parallel refinement mode to on
+/*! \details In parallel refinement mode the function is evaluated at the
+ * midpoints of all unconverged grid intervals in a single batch, which is
+ * split between the requested number of OpenMP threads
+ * (see Utility::OpenMPProperties). The function must therefore be thread
+ * safe. The refined grid is identical to the grid generated in serial mode.
+ */
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::setParallelRefinementModeOn()
+{
+  d_parallel_refinement = true;
+}
+
+// Set parallel refinement mode to off (default)
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::setParallelRefinementModeOff()
+{
+  d_parallel_refinement = false;
+}
+
+// Check if parallel refinement mode is on
+template<typename InterpPolicy>
+bool GridGenerator<InterpPolicy>::isParallelRefinementModeOn() const
+{
+  return d_parallel_refinement;
+}
+
 // Set the convergence tolerance
 template<typename InterpPolicy>
 void GridGenerator<InterpPolicy>::setConvergenceTolerance(
@@ -286,74 +317,116 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
   grid.clear();
   evaluated_function.clear();
 
-  // Variables used to calculate the linearized grid
-  double x0, x1, x_mid, y0, y1, y_mid_exact, y_mid_estimated;
-
-  // Evaluate the grid point before the min value
-  while( !min_value_queue.empty() )
+  if( d_parallel_refinement )
   {
-    x0 = min_value_queue.front();
-    min_value_queue.pop_front();
+    std::vector<double> batch_grid, batch_evaluated_function;
 
-    y0 = function( x0 );
+    auto append_batch = [&grid, &evaluated_function, &batch_grid, &batch_evaluated_function]()
+    {
+      for( size_t i = 0; i < batch_grid.size(); ++i )
+      {
+        grid.push_back( batch_grid[i] );
+        evaluated_function.push_back( batch_evaluated_function[i] );
+      }
+    };
 
-    grid.push_back( x0 );
-    evaluated_function.push_back( y0 );
-  }
+    // Evaluate the grid points before the min value
+    batch_grid.assign( min_value_queue.begin(), min_value_queue.end() );
 
-  // Evaluate the grid point at the min value
-  x0 = min_value;
-  y0 = function( x0 );
+    GridGenerator<InterpPolicy>::evaluateBatch( batch_grid,
+                                                batch_evaluated_function,
+                                                function );
 
-  // Calculate the grid points
-  while( !grid_queue.empty() )
-  {
-    x1 = grid_queue.front();
+    append_batch();
+
+    // Calculate the grid points between the min and max value
+    batch_grid.assign( 1, min_value );
+    batch_grid.insert( batch_grid.end(), grid_queue.begin(), grid_queue.end() );
 
-    x_mid = InterpPolicy::recoverProcessedIndepVar(
-                                     0.5*(InterpPolicy::processIndepVar(x0) +
-                                          InterpPolicy::processIndepVar(x1)) );
+    this->refineInBatches( batch_grid, batch_evaluated_function, function );
 
-    y1 = function( x1 );
-    y_mid_exact = function( x_mid );
+    append_batch();
 
-    y_mid_estimated = InterpPolicy::interpolate( x0, x1, x_mid, y0, y1 );
+    // Evaluate the grid points after the max value
+    batch_grid.assign( max_value_queue.begin(), max_value_queue.end() );
 
-    bool converged =
-      this->hasGridConverged( x0, x_mid, x1, y_mid_estimated, y_mid_exact );
+    GridGenerator<InterpPolicy>::evaluateBatch( batch_grid,
+                                                batch_evaluated_function,
+                                                function );
 
-    // Keep the grid points
-    if( converged )
+    append_batch();
+  }
+  else
+  {
+    // Variables used to calculate the linearized grid
+    double x0, x1, x_mid, y0, y1, y_mid_exact, y_mid_estimated;
+
+    // Evaluate the grid point before the min value
+    while( !min_value_queue.empty() )
     {
+      x0 = min_value_queue.front();
+      min_value_queue.pop_front();
+
+      y0 = function( x0 );
+
       grid.push_back( x0 );
       evaluated_function.push_back( y0 );
+    }
 
-      x0 = x1;
-      grid_queue.pop_front();
+    // Evaluate the grid point at the min value
+    x0 = min_value;
+    y0 = function( x0 );
 
-      y0 = y1;
-    }
-    // Refine the grid
-    else
-      grid_queue.push_front( x_mid );
-  }
+    // Calculate the grid points
+    while( !grid_queue.empty() )
+    {
+      x1 = grid_queue.front();
 
-  // Add the last point to the linearized grid
-  grid.push_back( x0 );
-  evaluated_function.push_back( y0 );
+      x_mid = InterpPolicy::recoverProcessedIndepVar(
+                                       0.5*(InterpPolicy::processIndepVar(x0) +
+                                            InterpPolicy::processIndepVar(x1)) );
 
-  testPostcondition( x0 = max_value );
+      y1 = function( x1 );
+      y_mid_exact = function( x_mid );
 
-  // Evaluate the grid point after the max value
-  while( !max_value_queue.empty() )
-  {
-    x0 = max_value_queue.front();
-    max_value_queue.pop_front();
+      y_mid_estimated = InterpPolicy::interpolate( x0, x1, x_mid, y0, y1 );
 
-    y0 = function( x0 );
+      bool converged =
+        this->hasGridConverged( x0, x_mid, x1, y_mid_estimated, y_mid_exact );
+
+      // Keep the grid points
+      if( converged )
+      {
+        grid.push_back( x0 );
+        evaluated_function.push_back( y0 );
+
+        x0 = x1;
+        grid_queue.pop_front();
+
+        y0 = y1;
+      }
+      // Refine the grid
+      else
+        grid_queue.push_front( x_mid );
+    }
 
+    // Add the last point to the linearized grid
     grid.push_back( x0 );
     evaluated_function.push_back( y0 );
+
+    testPostcondition( x0 = max_value );
+
+    // Evaluate the grid point after the max value
+    while( !max_value_queue.empty() )
+    {
+      x0 = max_value_queue.front();
+      max_value_queue.pop_front();
+
+      y0 = function( x0 );
+
+      grid.push_back( x0 );
+      evaluated_function.push_back( y0 );
+    }
   }
 
   // Make sure the linearized grid has at least 2 points
@@ -524,6 +597,145 @@ void GridGenerator<InterpPolicy>::generateAndEvaluate(
   this->generateAndEvaluateInPlace( grid, evaluated_function, function );
 }
 
+// Refine the grid between the first and last point in batches
+/*! \details The convergence of every grid interval only depends on the
+ * interval end points. All unconverged intervals are therefore bisected at
+ * the same time and the function is evaluated at all of the midpoints in a
+ * single batch. The converged intervals are sorted once all intervals have
+ * converged so that the refined grid is identical to the grid generated by
+ * the serial (depth-first) algorithm.
+ */
+template<typename InterpPolicy>
+template<typename Functor>
+void GridGenerator<InterpPolicy>::refineInBatches(
+                                     std::vector<double>& grid,
+                                     std::vector<double>& evaluated_function,
+                                     const Functor& function ) const
+{
+  // Make sure at least 2 grid points have been given
+  testPrecondition( grid.size() >= 2 );
+
+  GridGenerator<InterpPolicy>::evaluateBatch( grid,
+                                              evaluated_function,
+                                              function );
+
+  // The unconverged intervals
+  std::vector<double> lower_points( grid.begin(), grid.end()-1 );
+  std::vector<double> upper_points( grid.begin()+1, grid.end() );
+  std::vector<double> lower_values( evaluated_function.begin(),
+                                    evaluated_function.end()-1 );
+  std::vector<double> upper_values( evaluated_function.begin()+1,
+                                    evaluated_function.end() );
+
+  // The converged intervals (lower point, lower value)
+  std::vector<std::pair<double,double> > converged_intervals;
+
+  std::vector<double> mid_points, mid_values;
+  std::vector<double> new_lower_points, new_upper_points;
+  std::vector<double> new_lower_values, new_upper_values;
+
+  while( !lower_points.empty() )
+  {
+    const size_t number_of_intervals = lower_points.size();
+
+    mid_points.resize( number_of_intervals );
+
+    for( size_t i = 0; i < number_of_intervals; ++i )
+    {
+      mid_points[i] = InterpPolicy::recoverProcessedIndepVar(
+                      0.5*(InterpPolicy::processIndepVar(lower_points[i]) +
+                           InterpPolicy::processIndepVar(upper_points[i])) );
+    }
+
+    GridGenerator<InterpPolicy>::evaluateBatch( mid_points,
+                                                mid_values,
+                                                function );
+
+    new_lower_points.clear();
+    new_upper_points.clear();
+    new_lower_values.clear();
+    new_upper_values.clear();
+
+    // The convergence checks are done in serial so that dirty convergence
+    // is always handled in the same order
+    for( size_t i = 0; i < number_of_intervals; ++i )
+    {
+      const double y_mid_estimated =
+        InterpPolicy::interpolate( lower_points[i],
+                                   upper_points[i],
+                                   mid_points[i],
+                                   lower_values[i],
+                                   upper_values[i] );
+
+      bool converged = this->hasGridConverged( lower_points[i],
+                                               mid_points[i],
+                                               upper_points[i],
+                                               y_mid_estimated,
+                                               mid_values[i] );
+
+      // Keep the interval
+      if( converged )
+      {
+        converged_intervals.push_back(
+                          std::make_pair( lower_points[i], lower_values[i] ) );
+      }
+      // Bisect the interval
+      else
+      {
+        new_lower_points.push_back( lower_points[i] );
+        new_upper_points.push_back( mid_points[i] );
+        new_lower_values.push_back( lower_values[i] );
+        new_upper_values.push_back( mid_values[i] );
+
+        new_lower_points.push_back( mid_points[i] );
+        new_upper_points.push_back( upper_points[i] );
+        new_lower_values.push_back( mid_values[i] );
+        new_upper_values.push_back( upper_values[i] );
+      }
+    }
+
+    lower_points.swap( new_lower_points );
+    upper_points.swap( new_upper_points );
+    lower_values.swap( new_lower_values );
+    upper_values.swap( new_upper_values );
+  }
+
+  // The converged intervals are disjoint - sorting them recovers the grid
+  std::sort( converged_intervals.begin(), converged_intervals.end() );
+
+  const double last_point = grid.back();
+  const double last_value = evaluated_function.back();
+
+  grid.clear();
+  evaluated_function.clear();
+
+  for( size_t i = 0; i < converged_intervals.size(); ++i )
+  {
+    grid.push_back( converged_intervals[i].first );
+    evaluated_function.push_back( converged_intervals[i].second );
+  }
+
+  grid.push_back( last_point );
+  evaluated_function.push_back( last_value );
+}
+
+// Evaluate the function at a batch of points
+template<typename InterpPolicy>
+template<typename Functor>
+void GridGenerator<InterpPolicy>::evaluateBatch(
+                                     const std::vector<double>& points,
+                                     std::vector<double>& evaluated_function,
+                                     const Functor& function )
+{
+  evaluated_function.resize( points.size() );
+
+  OpenMPProperties::parallelFor( points.size(),
+                                 [&points, &evaluated_function, &function]( const size_t i )
+                                 {
+                                   evaluated_function[i] = function( points[i] );
+                                 } );
+}
+
 // Check for convergence
 template<typename InterpPolicy>
 bool GridGenerator<InterpPolicy>::hasGridConverged(
@@ -59,6 +59,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Set parallel secondary grid refinement mode to on
+  void setParallelSecondaryRefinementModeOn();
+
+  //! Set parallel secondary grid refinement mode to off (default)
+  void setParallelSecondaryRefinementModeOff();
+
+  //! Check if parallel secondary grid refinement mode is on
+  bool isParallelSecondaryRefinementModeOn() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
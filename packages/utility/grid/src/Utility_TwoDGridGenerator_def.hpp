@@ -109,6 +109,31 @@ bool TwoDGridGenerator<TwoDInterpPolicy>::isExceptionThrownOnDirtyConvergence()
   return d_throw_exceptions;
 }
 
+// Set parallel secondary grid refinement mode to on
+/*! \details The secondary grids will be refined with the parallel
+ * refinement mode of the secondary grid generator. The function must
+ * therefore be thread safe.
+ */
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::setParallelSecondaryRefinementModeOn()
+{
+  d_secondary_grid_generator.setParallelRefinementModeOn();
+}
+
+// Set parallel secondary grid refinement mode to off (default)
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::setParallelSecondaryRefinementModeOff()
+{
+  d_secondary_grid_generator.setParallelRefinementModeOff();
+}
+
+// Check if parallel secondary grid refinement mode is on
+template<typename TwoDInterpPolicy>
+bool TwoDGridGenerator<TwoDInterpPolicy>::isParallelSecondaryRefinementModeOn() const
+{
+  return d_secondary_grid_generator.isParallelRefinementModeOn();
+}
+
 // Set the convergence tolerance
 template<typename TwoDInterpPolicy>
 void TwoDGridGenerator<TwoDInterpPolicy>::setConvergenceTolerance(
@@ -18,6 +18,7 @@
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_List.hpp"
 #include "Utility_InterpolationPolicy.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -87,6 +88,23 @@ FRENSIE_UNIT_TEST( GridGenerator, dirty_convergence_handling )
   FRENSIE_CHECK( !generator.isExceptionThrownOnDirtyConvergence() );
 }
 
+//---------------------------------------------------------------------------//
+// Check if parallel refinement mode can be set
+FRENSIE_UNIT_TEST( GridGenerator, parallel_refinement_mode )
+{
+  Utility::GridGenerator<Utility::LinLin> generator;
+
+  FRENSIE_CHECK( !generator.isParallelRefinementModeOn() );
+
+  generator.setParallelRefinementModeOn();
+
+  FRENSIE_CHECK( generator.isParallelRefinementModeOn() );
+
+  generator.setParallelRefinementModeOff();
+
+  FRENSIE_CHECK( !generator.isParallelRefinementModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the convergence tolerance can be set
 FRENSIE_UNIT_TEST( GridGenerator, setConvergenceTolerance )
@@ -790,6 +808,113 @@ FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace )
   FRENSIE_CHECK_EQUAL( grid.back(), initial_grid[7] );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a parallel refined grid is identical to a serial refined grid
+FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace_parallel )
+{
+  Utility::GridGenerator<Utility::LinLin> serial_generator( 0.001, 1e-12 );
+  Utility::GridGenerator<Utility::LinLin> parallel_generator( 0.001, 1e-12 );
+  parallel_generator.setParallelRefinementModeOn();
+
+  // Create the initial grid
+  std::vector<double> initial_grid( 4 );
+  initial_grid[0] = -1.0;
+  initial_grid[1] = 0.0;
+  initial_grid[2] = 10.0;
+  initial_grid[3] = 20.0;
+
+  // Refine a lin-lin grid for (x-2)^3
+  x3 x_cubed( 2 );
+  boost::function<double (double x)> function =
+    boost::bind<double>(x_cubed, _1);
+
+  std::vector<double> serial_grid = initial_grid, serial_evaluated_function;
+  std::vector<double> parallel_grid = initial_grid, parallel_evaluated_function;
+
+  serial_generator.refineAndEvaluateInPlace( serial_grid,
+                                             serial_evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  parallel_generator.refineAndEvaluateInPlace( parallel_grid,
+                                               parallel_evaluated_function,
+                                               function,
+                                               initial_grid[1],
+                                               initial_grid[2] );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid.size(), 710 );
+  FRENSIE_CHECK_EQUAL( parallel_grid, serial_grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function,
+                       serial_evaluated_function );
+
+  // Generate a log-log grid for x^2
+  Utility::GridGenerator<Utility::LogLog> serial_log_generator( 0.001, 1e-12 );
+  Utility::GridGenerator<Utility::LogLog> parallel_log_generator( 0.001, 1e-12 );
+  parallel_log_generator.setParallelRefinementModeOn();
+
+  initial_grid[0] = 1e-3;
+  initial_grid[1] = 1.0;
+
+  function = static_cast<double(*)(double)>(&std::exp);
+
+  serial_grid = initial_grid;
+  parallel_grid = initial_grid;
+
+  serial_log_generator.generateAndEvaluateInPlace( serial_grid,
+                                                   serial_evaluated_function,
+                                                   function );
+
+  parallel_log_generator.generateAndEvaluateInPlace( parallel_grid,
+                                                     parallel_evaluated_function,
+                                                     function );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid, serial_grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function,
+                       serial_evaluated_function );
+}
+
+//---------------------------------------------------------------------------//
+// Check that exceptions are propagated out of the parallel refinement
+FRENSIE_UNIT_TEST( GridGenerator, refineInPlace_parallel_dirty_convergence )
+{
+  Utility::GridGenerator<Utility::LinLin> generator( 1e-6, 1e-3, 1e-14 );
+  generator.setParallelRefinementModeOn();
+  generator.throwExceptionOnDirtyConvergence();
+
+  std::vector<double> grid( 2 );
+  grid[0] = 0.0;
+  grid[1] = 10.0;
+
+  boost::function<double (double x)> function = &x2;
+
+  FRENSIE_CHECK_THROW( generator.refineInPlace( grid, function, 0.0, 10.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
 //---------------------------------------------------------------------------//
 // end tstGridGenerator.cpp
 //---------------------------------------------------------------------------//
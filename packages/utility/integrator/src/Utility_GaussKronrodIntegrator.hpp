@@ -11,6 +11,7 @@
 
 // std Includes
 #include <queue>
+#include <functional>
 
 // Boost Includes
 #include <boost/numeric/odeint.hpp>
@@ -169,6 +170,27 @@ typedef std::vector<ExtrapolatedBinTraits<T>> BinArray;
 			  T& result,
 			  T& absolute_error ) const;
 
+  //! Integrate the function adaptively with a batch integrand
+  template<int Points, typename BatchFunctor>
+  void integrateAdaptivelyWithBatchIntegrand( BatchFunctor& batch_integrand,
+                                              T lower_limit,
+                                              T upper_limit,
+                                              T& result,
+                                              T& absolute_error ) const;
+
+  //! Integrate a function with known integrable singularities adaptively with a batch integrand
+  template<typename BatchFunctor>
+  void integrateAdaptivelyWynnEpsilonWithBatchIntegrand(
+                          BatchFunctor& batch_integrand,
+                          const Utility::ArrayView<T>& points_of_interest,
+                          T& result,
+                          T& absolute_error ) const;
+
+  //! Create a batch integrand that evaluates a thread safe integrand in parallel
+  template<typename Functor>
+  static std::function<void(const std::vector<T>&,std::vector<T>&)>
+  createParallelBatchIntegrand( const Functor& integrand );
+
   //! Integrate the function with point rule
   template<int Points, typename FunctorType = double, typename Functor>
   void integrateWithPointRule(
@@ -195,6 +217,53 @@ typedef std::vector<ExtrapolatedBinTraits<T>> BinArray;
 
 protected:
 
+  // The batch integrand (evaluates the integrand at every node in one call)
+  template<typename BatchFunctor>
+  struct BatchIntegrand
+  {
+    // Constructor
+    BatchIntegrand( BatchFunctor& batch_functor );
+
+    // Set the Kronrod nodes of an interval
+    template<int Points>
+    void setIntervalAbscissae( const size_t interval_index,
+                               const T lower_limit,
+                               const T upper_limit );
+
+    // Evaluate the integrand at every node
+    void evaluate();
+
+    // The batch functor
+    BatchFunctor& functor;
+
+    // The abscissae (Points nodes per interval)
+    std::vector<T> abscissae;
+
+    // The integrand values at the abscissae
+    std::vector<T> integrand_values;
+  };
+
+  // Integrate the function with point rule using a batch integrand
+  template<int Points, typename FunctorType = double, typename BatchFunctor>
+  void integrateWithPointRule( BatchIntegrand<BatchFunctor>& integrand,
+                               T lower_limit,
+                               T upper_limit,
+                               T& result,
+                               T& absolute_error,
+                               T& result_abs,
+                               T& result_asc ) const;
+
+  // Calculate the point rule estimates from the integrand values
+  template<int Points>
+  void calculatePointRuleEstimates( const T* integrand_values_lower,
+                                    const T* integrand_values_upper,
+                                    const T integrand_midpoint,
+                                    const T half_length,
+                                    T& result,
+                                    T& absolute_error,
+                                    T& result_abs,
+                                    T& result_asc ) const;
+
   // Calculate the quadrature upper and lower integrand values at an abscissa
   template<typename FunctorType = double, typename Functor>
   void calculateQuadratureIntegrandValuesAtAbscissa(
@@ -226,6 +295,16 @@ protected:
     T& bin_1_asc,
     T& bin_2_asc ) const;
 
+  // Bisect and integrate the given bin interval using a batch integrand
+  template<int Points, typename FunctorType = double, typename BatchFunctor, typename Bin>
+  void bisectAndIntegrateBinInterval(
+    BatchIntegrand<BatchFunctor>& integrand,
+    const Bin& bin,
+    Bin& bin_1,
+    Bin& bin_2,
+    T& bin_1_asc,
+    T& bin_2_asc ) const;
+
   // Bisect and integrate the given bin interval
   template<int Points, typename FunctorType = double, typename ParameterType = double, typename Functor, typename Bin>
   void bisectAndIntegrateBinInterval(
@@ -19,6 +19,7 @@
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_GaussKronrodQuadratureSetTraits.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 
 namespace Utility{
@@ -1862,6 +1863,81 @@ void GaussKronrodIntegrator<T>::integrateAdaptivelyWynnEpsilon(
   return;
 }
 
+// Integrate the function adaptively with a batch integrand
+/*! \details BatchFunctor must have
+ * operator()( const std::vector<T>& abscissae, std::vector<T>& values )
+ * defined. The integrand values vector will already be the same size as the
+ * abscissae vector. Every Kronrod node of a subinterval (and of both halves of
+ * a bisected subinterval) is passed to the batch functor in a single call,
+ * which allows the integrand to be vectorized or evaluated in parallel (see
+ * createParallelBatchIntegrand). The adaptive strategy is identical to
+ * integrateAdaptively so the result will be identical to the result obtained
+ * with the equivalent scalar integrand.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateAdaptivelyWithBatchIntegrand(
+                                                  BatchFunctor& batch_integrand,
+                                                  T lower_limit,
+                                                  T upper_limit,
+                                                  T& result,
+                                                  T& absolute_error ) const
+{
+  BatchIntegrand<BatchFunctor> integrand( batch_integrand );
+
+  this->integrateAdaptively<Points,T>( integrand,
+                                       lower_limit,
+                                       upper_limit,
+                                       result,
+                                       absolute_error );
+}
+
+// Integrate a function with known integrable singularities adaptively with a batch integrand
+/*! \details BatchFunctor must have
+ * operator()( const std::vector<T>& abscissae, std::vector<T>& values )
+ * defined (see integrateAdaptivelyWithBatchIntegrand). The result will be
+ * identical to the result obtained with integrateAdaptivelyWynnEpsilon and
+ * the equivalent scalar integrand.
+ */
+template<typename T>
+template<typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateAdaptivelyWynnEpsilonWithBatchIntegrand(
+                              BatchFunctor& batch_integrand,
+                              const Utility::ArrayView<T>& points_of_interest,
+                              T& result,
+                              T& absolute_error ) const
+{
+  BatchIntegrand<BatchFunctor> integrand( batch_integrand );
+
+  this->integrateAdaptivelyWynnEpsilon<T>( integrand,
+                                           points_of_interest,
+                                           result,
+                                           absolute_error );
+}
+
+// Create a batch integrand that evaluates a thread safe integrand in parallel
+/*! \details The integrand must have operator()( T ) const defined and it must
+ * be safe to call it from multiple threads. The batch will be distributed
+ * between the number of threads requested from Utility::OpenMPProperties.
+ * The returned batch integrand only stores a reference to the integrand.
+ */
+template<typename T>
+template<typename Functor>
+std::function<void(const std::vector<T>&,std::vector<T>&)>
+GaussKronrodIntegrator<T>::createParallelBatchIntegrand(
+                                                      const Functor& integrand )
+{
+  return [&integrand]( const std::vector<T>& abscissae,
+                       std::vector<T>& integrand_values )
+  {
+    Utility::OpenMPProperties::parallelFor( abscissae.size(),
+                                            [&]( const size_t i )
+    {
+      integrand_values[i] = integrand( abscissae[i] );
+    } );
+  };
+}
+
 // Integrate the function with given Gauss-Kronrod point rule
 /*! \details Functor must have operator()( double ) defined. This function
  * applies the specified integration rule (Points) to estimate
@@ -1900,7 +1976,6 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
 
     // half the length between the upper and lower integration limits
     T half_length = (upper_limit - lower_limit )/2.0;
-    T abs_half_length = fabs( half_length );
 
     // Get number of Kronrod weights
     int number_of_weights =
@@ -1908,12 +1983,8 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
 
     std::vector<T> integrand_values_lower( number_of_weights );
     std::vector<T> integrand_values_upper( number_of_weights );
-    std::vector<T> integrand_values_sum( number_of_weights );
-    std::vector<T> kronrod_values( number_of_weights );
 
-    // Estimate Kronrod and absolute value integral for all but last weight
-    T kronrod_result = 0.0;
-    result_abs = kronrod_result;
+    // Evaluate the integrand at the abscissae of all but the last weight
     for ( int j = 0; j < number_of_weights-1; ++j )
       {
         calculateQuadratureIntegrandValuesAtAbscissa<FunctorType>(
@@ -1923,72 +1994,20 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
             midpoint,
             integrand_values_lower[j],
             integrand_values_upper[j] );
-
-        integrand_values_sum[j] =
-          integrand_values_lower[j] + integrand_values_upper[j];
-
-        kronrod_result +=
-          GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*integrand_values_sum[j];
-
-        result_abs += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*(
-          fabs( integrand_values_lower[j] ) + fabs( integrand_values_upper[j] ) );
       };
 
     // Integrand at the midpoint
     T integrand_midpoint = integrand( (FunctorType)midpoint );
 
-    // Estimate Kronrod integral for the last weight
-    T kronrod_result_last_weight = integrand_midpoint*
-      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1];
-
-    // Update Kronrod estimate and absolute value with last weight
-    kronrod_result += kronrod_result_last_weight;
-    result_abs += fabs( kronrod_result_last_weight );
-
-    // Calculate final integral result and absolute value
-    result = kronrod_result*half_length;
-    result_abs *= abs_half_length;
-
-    // Calculate the mean kronrod result
-    T mean_kronrod_result = kronrod_result/2.0;
-
-    // Estimate the result asc for all but the last weight
-    result_asc = 0.0;
-    for ( int j = 0; j < number_of_weights - 1; ++j )
-      {
-        result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*
-          ( fabs( integrand_values_lower[j] - mean_kronrod_result ) +
-            fabs( integrand_values_upper[j] - mean_kronrod_result ) );
-      };
-
-    // Estimate the result asc for the last weight
-    result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1]*
-        fabs( integrand_midpoint - mean_kronrod_result );
-
-    // Calculate final result acx
-    result_asc *= abs_half_length;
-
-    // Estimate Gauss integral
-    T gauss_result = 0.0;
-
-    for ( int j = 0; j < (number_of_weights-1)/2; ++j )
-      {
-        int jj = j*2 + 1;
-        gauss_result += integrand_values_sum[jj]*
-          GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[j];
-      };
-
-    // Update Gauss estimate with last weight if needed
-    if ( number_of_weights % 2 == 0 )
-    {
-      gauss_result += integrand_midpoint*
-        GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[number_of_weights/2 - 1];
-    }
-
-    // Estimate error in integral
-    absolute_error = fabs( ( kronrod_result - gauss_result ) * half_length );
-    rescaleAbsoluteError( absolute_error, result_abs, result_asc);
-
+    // Estimate the integral and the error from the integrand values
+    this->calculatePointRuleEstimates<Points>( integrand_values_lower.data(),
+                                               integrand_values_upper.data(),
+                                               integrand_midpoint,
+                                               half_length,
+                                               result,
+                                               absolute_error,
+                                               result_abs,
+                                               result_asc );
   }
   else if( lower_limit == upper_limit )
   {
@@ -2042,7 +2061,6 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
 
     // half the length between the upper and lower integration limits
     T half_length = (upper_limit - lower_limit )/2.0;
-    T abs_half_length = fabs( half_length );
 
     // Get number of Kronrod weights
     int number_of_weights =
@@ -2050,12 +2068,8 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
 
     std::vector<T> integrand_values_lower( number_of_weights );
     std::vector<T> integrand_values_upper( number_of_weights );
-    std::vector<T> integrand_values_sum( number_of_weights );
-    std::vector<T> kronrod_values( number_of_weights );
 
-    // Estimate Kronrod and absolute value integral for all but last weight
-    T kronrod_result = 0.0;
-    result_abs = kronrod_result;
+    // Evaluate the integrand at the abscissae of all but the last weight
     for ( int j = 0; j < number_of_weights-1; ++j )
       {
         calculateQuadratureIntegrandValuesAtAbscissa<FunctorType, ParameterType>(
@@ -2066,73 +2080,71 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
             midpoint,
             integrand_values_lower[j],
             integrand_values_upper[j] );
-
-        integrand_values_sum[j] =
-          integrand_values_lower[j] + integrand_values_upper[j];
-
-        kronrod_result +=
-          GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*integrand_values_sum[j];
-
-        result_abs += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*(
-          fabs( integrand_values_lower[j] ) + fabs( integrand_values_upper[j] ) );
       };
 
     // Integrand at the midpoint
     T integrand_midpoint =
         integrand( integrand_parameter, (FunctorType)midpoint );
 
-    // Estimate Kronrod integral for the last weight
-    T kronrod_result_last_weight = integrand_midpoint*
-      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1];
-
-    // Update Kronrod estimate and absolute value with last weight
-    kronrod_result += kronrod_result_last_weight;
-    result_abs += fabs( kronrod_result_last_weight );
-
-    // Calculate final integral result and absolute value
-    result = kronrod_result*half_length;
-    result_abs *= abs_half_length;
-
-    // Calculate the mean kronrod result
-    T mean_kronrod_result = kronrod_result/2.0;
-
-    // Estimate the result asc for all but the last weight
-    result_asc = 0.0;
-    for ( int j = 0; j < number_of_weights - 1; ++j )
-      {
-        result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*
-          ( fabs( integrand_values_lower[j] - mean_kronrod_result ) +
-            fabs( integrand_values_upper[j] - mean_kronrod_result ) );
-      };
-
-    // Estimate the result asc for the last weight
-    result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1]*
-        fabs( integrand_midpoint - mean_kronrod_result );
-
-    // Calculate final result acx
-    result_asc *= abs_half_length;
+    // Estimate the integral and the error from the integrand values
+    this->calculatePointRuleEstimates<Points>( integrand_values_lower.data(),
+                                               integrand_values_upper.data(),
+                                               integrand_midpoint,
+                                               half_length,
+                                               result,
+                                               absolute_error,
+                                               result_abs,
+                                               result_asc );
+  }
+  else if( lower_limit == upper_limit )
+  {
+    result = 0.0;
+    absolute_error = 0.0;
+  }
+  else // invalid limits
+  {
+    THROW_EXCEPTION( Utility::IntegratorException,
+		     "Invalid integration limits: " << lower_limit << " !< "
+		     << upper_limit << "." );
+  }
+}
 
-    // Estimate Gauss integral
-    T gauss_result = 0.0;
+// Integrate the function with point rule using a batch integrand
+template<typename T>
+template<int Points, typename FunctorType, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateWithPointRule(
+                                       BatchIntegrand<BatchFunctor>& integrand,
+                                       T lower_limit,
+                                       T upper_limit,
+                                       T& result,
+                                       T& absolute_error,
+                                       T& result_abs,
+                                       T& result_asc ) const
+{
+  // Make sure the point rule is valid_rule
+  testStaticPrecondition( (GaussKronrodQuadratureSetTraits<Points,T>::valid_rule) );
+  // Make sure the integration limits are valid
+  testPrecondition( lower_limit <= upper_limit );
 
-    for ( int j = 0; j < (number_of_weights-1)/2; ++j )
-      {
-        int jj = j*2 + 1;
-        gauss_result += integrand_values_sum[jj]*
-          GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[j];
-      };
+  if( lower_limit < upper_limit )
+  {
+    integrand.abscissae.resize( Points );
 
-    // Update Gauss estimate with last weight if needed
-    if ( number_of_weights % 2 == 0 )
-    {
-      gauss_result += integrand_midpoint*
-        GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[number_of_weights/2 - 1];
-    }
+    integrand.template setIntervalAbscissae<Points>( 0, lower_limit, upper_limit );
+    integrand.evaluate();
 
-    // Estimate error in integral
-    absolute_error = fabs( ( kronrod_result - gauss_result ) * half_length );
-    rescaleAbsoluteError( absolute_error, result_abs, result_asc);
+    const int number_of_weights =
+      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
 
+    this->calculatePointRuleEstimates<Points>(
+                        integrand.integrand_values.data(),
+                        integrand.integrand_values.data() + number_of_weights-1,
+                        integrand.integrand_values[Points-1],
+                        (upper_limit - lower_limit )/2.0,
+                        result,
+                        absolute_error,
+                        result_abs,
+                        result_asc );
   }
   else if( lower_limit == upper_limit )
   {
@@ -2147,6 +2159,96 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
   }
 }
 
+// Calculate the point rule estimates from the integrand values
+/*! \details The lower and upper integrand values must be evaluated at the
+ * Kronrod abscissae of all but the last weight. The order of operations
+ * must not change - the scalar and the batch integrands rely on this method
+ * to produce identical results.
+ */
+template<typename T>
+template<int Points>
+void GaussKronrodIntegrator<T>::calculatePointRuleEstimates(
+                                            const T* integrand_values_lower,
+                                            const T* integrand_values_upper,
+                                            const T integrand_midpoint,
+                                            const T half_length,
+                                            T& result,
+                                            T& absolute_error,
+                                            T& result_abs,
+                                            T& result_asc ) const
+{
+  T abs_half_length = fabs( half_length );
+
+  // Get number of Kronrod weights
+  int number_of_weights =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
+
+  // Estimate Kronrod and absolute value integral for all but last weight
+  T kronrod_result = 0.0;
+  result_abs = kronrod_result;
+  for ( int j = 0; j < number_of_weights-1; ++j )
+    {
+      kronrod_result +=
+        GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*
+        (integrand_values_lower[j] + integrand_values_upper[j]);
+
+      result_abs += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*(
+        fabs( integrand_values_lower[j] ) + fabs( integrand_values_upper[j] ) );
+    };
+
+  // Estimate Kronrod integral for the last weight
+  T kronrod_result_last_weight = integrand_midpoint*
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1];
+
+  // Update Kronrod estimate and absolute value with last weight
+  kronrod_result += kronrod_result_last_weight;
+  result_abs += fabs( kronrod_result_last_weight );
+
+  // Calculate final integral result and absolute value
+  result = kronrod_result*half_length;
+  result_abs *= abs_half_length;
+
+  // Calculate the mean kronrod result
+  T mean_kronrod_result = kronrod_result/2.0;
+
+  // Estimate the result asc for all but the last weight
+  result_asc = 0.0;
+  for ( int j = 0; j < number_of_weights - 1; ++j )
+    {
+      result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[j]*
+        ( fabs( integrand_values_lower[j] - mean_kronrod_result ) +
+          fabs( integrand_values_upper[j] - mean_kronrod_result ) );
+    };
+
+  // Estimate the result asc for the last weight
+  result_asc += GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights[number_of_weights-1]*
+      fabs( integrand_midpoint - mean_kronrod_result );
+
+  // Calculate final result acx
+  result_asc *= abs_half_length;
+
+  // Estimate Gauss integral
+  T gauss_result = 0.0;
+
+  for ( int j = 0; j < (number_of_weights-1)/2; ++j )
+    {
+      int jj = j*2 + 1;
+      gauss_result += (integrand_values_lower[jj] + integrand_values_upper[jj])*
+        GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[j];
+    };
+
+  // Update Gauss estimate with last weight if needed
+  if ( number_of_weights % 2 == 0 )
+  {
+    gauss_result += integrand_midpoint*
+      GaussKronrodQuadratureSetTraits<Points,T>::gauss_weights[number_of_weights/2 - 1];
+  }
+
+  // Estimate error in integral
+  absolute_error = fabs( ( kronrod_result - gauss_result ) * half_length );
+  rescaleAbsoluteError( absolute_error, result_abs, result_asc);
+}
+
 // Test if subinterval is too small
 template<typename T>
 template<int Points>
@@ -2295,6 +2397,141 @@ void GaussKronrodIntegrator<T>::bisectAndIntegrateBinInterval(
       bin_2_asc );
 };
 
+// Bisect and integrate the given bin interval using a batch integrand
+/*! \details The nodes of both halves of the bin are evaluated with a single
+ * call to the batch integrand.
+ */
+template<typename T>
+template<int Points, typename FunctorType, typename BatchFunctor, typename Bin>
+void GaussKronrodIntegrator<T>::bisectAndIntegrateBinInterval(
+    BatchIntegrand<BatchFunctor>& integrand,
+    const Bin& bin,
+    Bin& bin_1,
+    Bin& bin_2,
+    T& bin_1_asc,
+    T& bin_2_asc ) const
+{
+  // Bisect the bin with the largest error estimate into bin 1 and bin 2
+  bin_1.lower_limit = bin.lower_limit;
+  bin_1.upper_limit = (1/2.0)  * ( bin.lower_limit + bin.upper_limit );
+
+  bin_2.lower_limit = bin_1.upper_limit;
+  bin_2.upper_limit = bin.upper_limit;
+
+  T bin_1_abs, bin_2_abs;
+
+  // A degenerate half can't be batched - integrate each half separately
+  if( !(bin_1.lower_limit < bin_1.upper_limit) ||
+      !(bin_2.lower_limit < bin_2.upper_limit) )
+  {
+    integrateWithPointRule<Points, FunctorType>( integrand,
+                                                 bin_1.lower_limit,
+                                                 bin_1.upper_limit,
+                                                 bin_1.result,
+                                                 bin_1.error,
+                                                 bin_1_abs,
+                                                 bin_1_asc );
+
+    integrateWithPointRule<Points, FunctorType>( integrand,
+                                                 bin_2.lower_limit,
+                                                 bin_2.upper_limit,
+                                                 bin_2.result,
+                                                 bin_2.error,
+                                                 bin_2_abs,
+                                                 bin_2_asc );
+    return;
+  }
+
+  integrand.abscissae.resize( 2*Points );
+
+  integrand.template setIntervalAbscissae<Points>( 0, bin_1.lower_limit, bin_1.upper_limit );
+  integrand.template setIntervalAbscissae<Points>( 1, bin_2.lower_limit, bin_2.upper_limit );
+  integrand.evaluate();
+
+  const int number_of_weights =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
+
+  const T* bin_1_values = integrand.integrand_values.data();
+  const T* bin_2_values = bin_1_values + Points;
+
+  this->calculatePointRuleEstimates<Points>(
+                                 bin_1_values,
+                                 bin_1_values + number_of_weights-1,
+                                 bin_1_values[Points-1],
+                                 (bin_1.upper_limit - bin_1.lower_limit )/2.0,
+                                 bin_1.result,
+                                 bin_1.error,
+                                 bin_1_abs,
+                                 bin_1_asc );
+
+  this->calculatePointRuleEstimates<Points>(
+                                 bin_2_values,
+                                 bin_2_values + number_of_weights-1,
+                                 bin_2_values[Points-1],
+                                 (bin_2.upper_limit - bin_2.lower_limit )/2.0,
+                                 bin_2.result,
+                                 bin_2.error,
+                                 bin_2_abs,
+                                 bin_2_asc );
+}
+
+// Constructor
+template<typename T>
+template<typename BatchFunctor>
+GaussKronrodIntegrator<T>::BatchIntegrand<BatchFunctor>::BatchIntegrand(
+                                                 BatchFunctor& batch_functor )
+  : functor( batch_functor ),
+    abscissae(),
+    integrand_values()
+{ /* ... */ }
+
+// Set the Kronrod nodes of an interval
+/*! \details The abscissae of an interval are stored in the following order:
+ * the lower abscissae of all but the last weight, the upper abscissae of all
+ * but the last weight and the midpoint. The abscissae are calculated in the
+ * same way as in calculateQuadratureIntegrandValuesAtAbscissa.
+ */
+template<typename T>
+template<typename BatchFunctor>
+template<int Points>
+void GaussKronrodIntegrator<T>::BatchIntegrand<BatchFunctor>::setIntervalAbscissae(
+                                                const size_t interval_index,
+                                                const T lower_limit,
+                                                const T upper_limit )
+{
+  // Make sure the interval index is valid
+  testPrecondition( (interval_index+1)*Points <= abscissae.size() );
+
+  T midpoint = ( upper_limit + lower_limit )/2.0;
+  T half_length = (upper_limit - lower_limit )/2.0;
+
+  const int number_of_weights =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
+
+  T* interval_abscissae = abscissae.data() + interval_index*Points;
+
+  for( int j = 0; j < number_of_weights-1; ++j )
+  {
+    T weighted_abscissa = half_length*
+      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_abscissae[j];
+
+    interval_abscissae[j] = midpoint - weighted_abscissa;
+    interval_abscissae[number_of_weights-1+j] = midpoint + weighted_abscissa;
+  }
+
+  interval_abscissae[Points-1] = midpoint;
+}
+
+// Evaluate the integrand at every node
+template<typename T>
+template<typename BatchFunctor>
+void GaussKronrodIntegrator<T>::BatchIntegrand<BatchFunctor>::evaluate()
+{
+  integrand_values.resize( abscissae.size() );
+
+  functor( abscissae, integrand_values );
+}
+
 // return max of two variables of type T
 template<typename T>
 T GaussKronrodIntegrator<T>::getMax( T variable_1, T variable_2 ) const
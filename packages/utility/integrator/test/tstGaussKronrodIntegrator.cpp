@@ -22,6 +22,7 @@
 #include "Utility_Vector.hpp"
 #include "Utility_ArrayView.hpp"
 #include "Utility_TypeNameTraits.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -257,6 +258,27 @@ typedef std::tuple<X2FunctorLong,X3FunctorLong> TestFunctorsLong;
 typedef std::tuple<X2FunctorBoost,X3FunctorBoost> TestFunctorsBoost;
 typedef std::tuple<X2FunctorParameter,X3FunctorParameter> TestFunctorsParameter;
 
+// Evaluates a scalar functor at every abscissa in a batch
+template<typename Functor>
+struct BatchFunctor
+{
+  BatchFunctor()
+    : number_of_calls( 0 )
+  { /* ... */ }
+
+  void operator()( const std::vector<double>& abscissae,
+                   std::vector<double>& integrand_values )
+  {
+    ++number_of_calls;
+
+    for( size_t i = 0; i < abscissae.size(); ++i )
+      integrand_values[i] = functor( abscissae[i] );
+  }
+
+  Functor functor;
+  size_t number_of_calls;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Functions
 //---------------------------------------------------------------------------//
@@ -1693,6 +1715,136 @@ FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
   FRENSIE_CHECK_FLOATING_EQUALITY( Functor::getIntegratedValue(), result, tol );
 }
 
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated with a batch integrand
+FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
+                            integrateAdaptivelyWithBatchIntegrand,
+                            TestFunctors )
+{
+  FETCH_TEMPLATE_PARAM( 0, Functor );
+
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  Functor functor_instance;
+  BatchFunctor<Functor> batch_functor;
+
+  double result, absolute_error, batch_result, batch_absolute_error;
+
+  // The batch integrand must give identical results for every rule
+  gk_integrator.integrateAdaptively<15>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<15>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, Functor::getIntegratedValue(), 1e-12 );
+
+  // Both halves of a bisected interval are evaluated in one call
+  FRENSIE_CHECK( batch_functor.number_of_calls > 1 );
+
+  gk_integrator.integrateAdaptively<21>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<21>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+
+  gk_integrator.integrateAdaptively<31>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<31>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+
+  gk_integrator.integrateAdaptively<41>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<41>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+
+  gk_integrator.integrateAdaptively<51>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<51>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+
+  gk_integrator.integrateAdaptively<61>( functor_instance, -1.0, 2.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<61>( batch_functor, -1.0, 2.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a function with integrable singularities can be integrated
+// with a batch integrand
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator,
+                   integrateAdaptivelyWynnEpsilonWithBatchIntegrand )
+{
+  std::function<double(double)> function_wrapper = inv_sqrt_abs_x;
+
+  std::function<void(const std::vector<double>&,std::vector<double>&)>
+    batch_function_wrapper =
+    Utility::GaussKronrodIntegrator<double>::createParallelBatchIntegrand(
+                                                            function_wrapper );
+
+  std::vector<double> points_of_interest( 3 );
+  points_of_interest[0] = -1.0;
+  points_of_interest[1] = 0.0; // integrable singularity
+  points_of_interest[2] = 1.0;
+
+  Utility::GaussKronrodIntegrator<double> gk_int( 1e-12, 0.0, 100000 );
+
+  double result, absolute_error, batch_result, batch_absolute_error;
+
+  gk_int.integrateAdaptivelyWynnEpsilon( function_wrapper,
+                                         Utility::arrayView(points_of_interest),
+                                         result,
+                                         absolute_error );
+
+  gk_int.integrateAdaptivelyWynnEpsilonWithBatchIntegrand(
+                                         batch_function_wrapper,
+                                         Utility::arrayView(points_of_interest),
+                                         batch_result,
+                                         batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, 4.0, batch_absolute_error/batch_result );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a parallel batch integrand gives the same result as the serial
+// integrand
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, createParallelBatchIntegrand )
+{
+  std::function<double(double)> function_wrapper = exp_neg_x;
+
+  std::function<void(const std::vector<double>&,std::vector<double>&)>
+    batch_function_wrapper =
+    Utility::GaussKronrodIntegrator<double>::createParallelBatchIntegrand(
+                                                            function_wrapper );
+
+  std::vector<double> abscissae( 100 ), integrand_values( 100 );
+
+  for( size_t i = 0; i < abscissae.size(); ++i )
+    abscissae[i] = i/10.0;
+
+  batch_function_wrapper( abscissae, integrand_values );
+
+  for( size_t i = 0; i < abscissae.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( integrand_values[i], exp_neg_x( abscissae[i] ) );
+  }
+
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error, batch_result, batch_absolute_error;
+
+  gk_integrator.integrateAdaptively<21>( function_wrapper, 0.0, 10.0, result, absolute_error );
+  gk_integrator.integrateAdaptivelyWithBatchIntegrand<21>( batch_function_wrapper, 0.0, 10.0, batch_result, batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that warnings can be thrown
 FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
@@ -1786,6 +1938,29 @@ FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
 //---------------------------------------------------------------------------//
 // end tstGaussKronrodIntegrator.cpp
 //---------------------------------------------------------------------------//